@@ -0,0 +1,87 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryBCryptTask.h"
+#include "FLowEntryBCryptTask.h"
+#include "LowEntryHashingBCryptLibrary.h"
+
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+
+
+ULowEntryBCryptTask::ULowEntryBCryptTask(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	KeepAliveCount = 1;
+	AddToRoot();
+}
+
+ULowEntryBCryptTask* ULowEntryBCryptTask::Create(const TArray<uint8>& Bytes, const TArray<uint8>& Salt, const int32 Strength)
+{
+	ULowEntryBCryptTask* Instance = NewObject<ULowEntryBCryptTask>();
+
+	// The instance stays rooted till Done runs, so the worker can safely hold on to it
+	ULowEntryHashingBCryptLibrary::HashAsync(Bytes, Salt, Strength, [Instance](const TArray<uint8>& Hash)
+	{
+		AsyncTask(ENamedThreads::GameThread, [Instance, Hash]()
+		{
+			Instance->Done(Hash);
+		});
+	});
+
+	return Instance;
+}
+
+
+void ULowEntryBCryptTask::WaitTillDone(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool& Success_, TArray<uint8>& Hash)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (World == nullptr)
+	{
+		return;
+	}
+	if (World->GetLatentActionManager().FindExistingAction<FLowEntryBCryptTask>(LatentInfo.CallbackTarget, LatentInfo.UUID) != nullptr)
+	{
+		return;
+	}
+	World->GetLatentActionManager().AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryBCryptTask(LatentInfo, this, Success_, Hash));
+
+	KeepAliveCount++;
+	if (KeepAliveCount == 1)
+	{
+		AddToRoot();
+	}
+}
+
+void ULowEntryBCryptTask::LatentActionDone()
+{
+	KeepAliveCount--;
+	if (KeepAliveCount == 0)
+	{
+		RemoveFromRoot();
+	}
+	if (KeepAliveCount < 0)
+	{
+		KeepAliveCount = 0;
+	}
+}
+
+void ULowEntryBCryptTask::Done(const TArray<uint8>& Hash)
+{
+	if (!Finished)
+	{
+		Success = (Hash.Num() > 0);
+		Result = Hash;
+		LatentActionDone(); // used to reduce KeepAliveCount by 1
+		Finished = true;
+	}
+}
+
+bool ULowEntryBCryptTask::IsDone()
+{
+	return Finished;
+}
+
+void ULowEntryBCryptTask::GetResult(bool& Success_, TArray<uint8>& Hash)
+{
+	Success_ = Success;
+	Hash = Result;
+}
@@ -0,0 +1,128 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryBCryptVerifyTask.h"
+#include "FLowEntryBCryptVerifyTask.h"
+#include "LowEntryHashingBCryptLibrary.h"
+
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+
+
+namespace
+{
+	TArray<TArrayView<const uint8>> ToViews(const TArray<TArray<uint8>>& Arrays)
+	{
+		TArray<TArrayView<const uint8>> Views;
+		Views.Reserve(Arrays.Num());
+		for (const TArray<uint8>& Array : Arrays)
+		{
+			Views.Add(TArrayView<const uint8>(Array));
+		}
+		return Views;
+	}
+}
+
+
+ULowEntryBCryptVerifyTask::ULowEntryBCryptVerifyTask(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	KeepAliveCount = 1;
+	AddToRoot();
+}
+
+ULowEntryBCryptVerifyTask* ULowEntryBCryptVerifyTask::Create(TArray<TArray<uint8>> Passwords, TArray<TArray<uint8>> Salts, TArray<TArray<uint8>> Hashes, const int32 Strength)
+{
+	ULowEntryBCryptVerifyTask* Instance = NewObject<ULowEntryBCryptVerifyTask>();
+	Instance->ChecksTotal = Passwords.Num();
+
+	// The instance stays rooted till Done runs, so the workers can safely hold on to it
+	Async(EAsyncExecution::TaskGraph, [Instance, Passwords = MoveTemp(Passwords), Salts = MoveTemp(Salts), Hashes = MoveTemp(Hashes), Strength]()
+	{
+		TArray<bool> Matches = ULowEntryHashingBCryptLibrary::VerifyBatch(ToViews(Passwords), ToViews(Salts), ToViews(Hashes), Strength, [Instance](const int32 Index, const bool bMatch)
+		{
+			Instance->ChecksDone++;
+			return !Instance->CancelRequested;
+		});
+		const bool bSuccess = !Instance->CancelRequested;
+
+		AsyncTask(ENamedThreads::GameThread, [Instance, bSuccess, Matches = MoveTemp(Matches)]()
+		{
+			Instance->Done(bSuccess, Matches);
+		});
+	});
+
+	return Instance;
+}
+
+
+void ULowEntryBCryptVerifyTask::WaitTillDone(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool& Success_, TArray<bool>& Matches)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (World == nullptr)
+	{
+		return;
+	}
+	if (World->GetLatentActionManager().FindExistingAction<FLowEntryBCryptVerifyTask>(LatentInfo.CallbackTarget, LatentInfo.UUID) != nullptr)
+	{
+		return;
+	}
+	World->GetLatentActionManager().AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryBCryptVerifyTask(LatentInfo, this, Success_, Matches));
+
+	KeepAliveCount++;
+	if (KeepAliveCount == 1)
+	{
+		AddToRoot();
+	}
+}
+
+void ULowEntryBCryptVerifyTask::LatentActionDone()
+{
+	KeepAliveCount--;
+	if (KeepAliveCount == 0)
+	{
+		RemoveFromRoot();
+	}
+	if (KeepAliveCount < 0)
+	{
+		KeepAliveCount = 0;
+	}
+}
+
+void ULowEntryBCryptVerifyTask::Done(const bool Success_, const TArray<bool>& Matches)
+{
+	if (!Finished)
+	{
+		Success = Success_;
+		Result = Matches;
+		LatentActionDone(); // used to reduce KeepAliveCount by 1
+		Finished = true;
+	}
+}
+
+void ULowEntryBCryptVerifyTask::Cancel()
+{
+	CancelRequested = true;
+}
+
+bool ULowEntryBCryptVerifyTask::IsDone()
+{
+	return Finished;
+}
+
+double ULowEntryBCryptVerifyTask::GetProgress()
+{
+	if (Finished)
+	{
+		return 1;
+	}
+	if (ChecksTotal <= 0)
+	{
+		return 0;
+	}
+	return static_cast<double>(ChecksDone) / static_cast<double>(ChecksTotal);
+}
+
+void ULowEntryBCryptVerifyTask::GetResult(bool& Success_, TArray<bool>& Matches)
+{
+	Success_ = Success;
+	Matches = Result;
+}
@@ -0,0 +1,301 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/OutputDevice.h"
+#include "LowEntryBitDataNative.h"
+#include "LowEntryBitDataReader.h"
+#include "LowEntryBitDataWriter.h"
+
+
+namespace
+{
+	// The byte-at-a-time implementation the 64-bit buffer replaced, kept as the baseline of the benchmark
+	// (the reader doesn't skip a byte after a partial byte that ends on a byte boundary, so its results can be compared)
+
+	const uint8 LegacyMask[9] = {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
+
+	class FLegacyBitWriter
+	{
+	public:
+		TArray<uint8> Bytes;
+		uint8 CurrentByte = 0;
+		int32 CurrentBytePosition = 0;
+
+
+		void AddRawByte(const uint8 Value)
+		{
+			if (CurrentBytePosition == 0)
+			{
+				Bytes.Add(Value);
+			}
+			else
+			{
+				CurrentByte |= (Value << CurrentBytePosition);
+				Bytes.Add(CurrentByte);
+				CurrentByte = static_cast<uint8>((Value >> (8 - CurrentBytePosition)) & LegacyMask[CurrentBytePosition]);
+			}
+		}
+
+		void AddPartialRawByte(uint8 Value, const int32 Bits)
+		{
+			Value &= LegacyMask[Bits];
+			CurrentByte |= (Value << CurrentBytePosition);
+			CurrentBytePosition += Bits;
+			if (CurrentBytePosition >= 8)
+			{
+				Bytes.Add(CurrentByte);
+				CurrentBytePosition -= 8;
+				CurrentByte = (CurrentBytePosition == 0) ? 0 : static_cast<uint8>(Value >> (Bits - CurrentBytePosition));
+			}
+		}
+
+		void AddBits(uint64 Value, int32 BitCount)
+		{
+			for (; BitCount >= 8; BitCount -= 8)
+			{
+				AddRawByte(static_cast<uint8>(Value));
+				Value >>= 8;
+			}
+			if (BitCount > 0)
+			{
+				AddPartialRawByte(static_cast<uint8>(Value), BitCount);
+			}
+		}
+
+		TArray<uint8> GetBytes() const
+		{
+			TArray<uint8> Data = Bytes;
+			if (CurrentBytePosition != 0)
+			{
+				Data.Add(CurrentByte);
+			}
+			return Data;
+		}
+	};
+
+	class FLegacyBitReader
+	{
+	public:
+		const TArray<uint8>& Bytes;
+		int32 Position = 0;
+		uint8 CurrentByte = 0;
+		int32 CurrentBytePosition = 0;
+
+
+		explicit FLegacyBitReader(const TArray<uint8>& Bytes0) : Bytes(Bytes0) {}
+
+		int32 GetAndIncreasePosition(const int32 Increasement)
+		{
+			const int32 Pos = Position;
+			if ((Bytes.Num() - Increasement) <= Position)
+			{
+				Position = Bytes.Num();
+			}
+			else
+			{
+				Position += Increasement;
+			}
+			return Pos;
+		}
+
+		uint8 GetRawByte()
+		{
+			if (CurrentBytePosition == 0)
+			{
+				const int32 Pos = GetAndIncreasePosition(1);
+				return (Bytes.Num() <= Pos) ? 0 : Bytes[Pos];
+			}
+			const uint8 B = ((CurrentByte >> CurrentBytePosition) & LegacyMask[8 - CurrentBytePosition]);
+			const int32 Pos = GetAndIncreasePosition(1);
+			if (Bytes.Num() <= Pos)
+			{
+				CurrentBytePosition = 0;
+				return B;
+			}
+			CurrentByte = Bytes[Pos];
+			return (B | (CurrentByte << (8 - CurrentBytePosition)));
+		}
+
+		uint8 GetPartialRawByte(const int32 Bits)
+		{
+			if (CurrentBytePosition == 0)
+			{
+				const int32 Pos = GetAndIncreasePosition(1);
+				if (Bytes.Num() <= Pos)
+				{
+					return 0;
+				}
+				CurrentByte = Bytes[Pos];
+			}
+			uint8 B = ((CurrentByte >> CurrentBytePosition) & LegacyMask[8 - CurrentBytePosition]);
+			CurrentBytePosition += Bits;
+			if (CurrentBytePosition == 8)
+			{
+				CurrentBytePosition = 0;
+			}
+			else if (CurrentBytePosition > 8)
+			{
+				const int32 Pos = GetAndIncreasePosition(1);
+				if (Bytes.Num() <= Pos)
+				{
+					CurrentBytePosition = 0;
+					return (B & LegacyMask[Bits]);
+				}
+				CurrentByte = Bytes[Pos];
+				CurrentBytePosition -= 8;
+				B = (B | (CurrentByte << (Bits - CurrentBytePosition)));
+			}
+			return (B & LegacyMask[Bits]);
+		}
+
+		uint64 GetBits(const int32 BitCount)
+		{
+			uint64 Value = 0;
+			int32 Shift = 0;
+			for (; (Shift + 8) <= BitCount; Shift += 8)
+			{
+				Value |= static_cast<uint64>(GetRawByte()) << Shift;
+			}
+			if (Shift < BitCount)
+			{
+				Value |= static_cast<uint64>(GetPartialRawByte(BitCount - Shift)) << Shift;
+			}
+			return Value;
+		}
+	};
+
+
+	template<typename FunctionType>
+	double MeasureSeconds(const int32 Iterations, FunctionType&& Function)
+	{
+		double Best = TNumericLimits<double>::Max();
+		for (int32 i = 0; i < Iterations; i++)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Function();
+			Best = FMath::Min(Best, FPlatformTime::Seconds() - Start);
+		}
+		return Best;
+	}
+
+	void RunBitDataBenchmark(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const int32 Count = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 10000000) : 1000000;
+		const int32 Iterations = 5;
+
+		// Mixed widths, like flags, small enums, quantized floats, ids and timestamps packed after each other
+		const int32 Widths[] = {1, 1, 3, 5, 7, 8, 12, 16, 17, 24, 31, 32, 48, 64};
+		FRandomStream Random(0xB17);
+		TArray<int32> BitCounts;
+		TArray<uint64> Values;
+		BitCounts.SetNumUninitialized(Count);
+		Values.SetNumUninitialized(Count);
+		int64 TotalBits = 0;
+		for (int32 i = 0; i < Count; i++)
+		{
+			const int32 BitCount = Widths[Random.RandHelper(UE_ARRAY_COUNT(Widths))];
+			const uint64 Value = (static_cast<uint64>(Random.GetUnsignedInt()) << 32) | Random.GetUnsignedInt();
+			BitCounts[i] = BitCount;
+			Values[i] = (BitCount < 64) ? (Value & ((static_cast<uint64>(1) << BitCount) - 1)) : Value;
+			TotalBits += BitCount;
+		}
+		const double Megabytes = TotalBits / (8.0 * 1024.0 * 1024.0);
+
+		Ar.Logf(TEXT("LowEntry bit data benchmark, %d values of 1 to 64 bits (%.1f MB), best of %d"), Count, Megabytes, Iterations);
+
+		TArray<uint8> LegacyBytes;
+		const double LegacyWriteSeconds = MeasureSeconds(Iterations, [&]()
+		{
+			FLegacyBitWriter Writer;
+			for (int32 i = 0; i < Count; i++)
+			{
+				Writer.AddBits(Values[i], BitCounts[i]);
+			}
+			LegacyBytes = Writer.GetBytes();
+		});
+
+		TArray<uint8> NativeBytes;
+		const double NativeWriteSeconds = MeasureSeconds(Iterations, [&]()
+		{
+			ULowEntryBitDataNativeWriter Writer;
+			Writer.Reserve(TotalBits);
+			for (int32 i = 0; i < Count; i++)
+			{
+				Writer.WriteBits(Values[i], BitCounts[i]);
+			}
+			NativeBytes = Writer.ReleaseBytes();
+		});
+
+		bool bLegacyCorrect = true;
+		const double LegacyReadSeconds = MeasureSeconds(Iterations, [&]()
+		{
+			FLegacyBitReader Reader(LegacyBytes);
+			for (int32 i = 0; i < Count; i++)
+			{
+				bLegacyCorrect &= (Reader.GetBits(BitCounts[i]) == Values[i]);
+			}
+		});
+
+		bool bNativeCorrect = true;
+		const double NativeReadSeconds = MeasureSeconds(Iterations, [&]()
+		{
+			ULowEntryBitDataNativeReader Reader(NativeBytes);
+			for (int32 i = 0; i < Count; i++)
+			{
+				bNativeCorrect &= (Reader.ReadBits(BitCounts[i]) == Values[i]);
+			}
+		});
+
+		// The blueprint API with the same payload, 64-bit values as two integers
+		ULowEntryBitDataWriter* BlueprintWriter = nullptr;
+		const double BlueprintWriteSeconds = MeasureSeconds(Iterations, [&]()
+		{
+			BlueprintWriter = ULowEntryBitDataWriter::Create();
+			for (int32 i = 0; i < Count; i++)
+			{
+				const int32 BitCount = BitCounts[i];
+				BlueprintWriter->AddIntegerLeastSignificantBits(static_cast<int32>(Values[i]), FMath::Min(BitCount, 32));
+				if (BitCount > 32)
+				{
+					BlueprintWriter->AddIntegerLeastSignificantBits(static_cast<int32>(Values[i] >> 32), BitCount - 32);
+				}
+			}
+		});
+		const TArray<uint8> BlueprintBytes = BlueprintWriter->GetBytes();
+
+		bool bBlueprintCorrect = true;
+		const double BlueprintReadSeconds = MeasureSeconds(Iterations, [&]()
+		{
+			ULowEntryBitDataReader* Reader = ULowEntryBitDataReader::Create(BlueprintBytes);
+			for (int32 i = 0; i < Count; i++)
+			{
+				const int32 BitCount = BitCounts[i];
+				uint64 Value = static_cast<uint32>(Reader->GetIntegerLeastSignificantBits(FMath::Min(BitCount, 32)));
+				if (BitCount > 32)
+				{
+					Value |= static_cast<uint64>(static_cast<uint32>(Reader->GetIntegerLeastSignificantBits(BitCount - 32))) << 32;
+				}
+				bBlueprintCorrect &= (Value == Values[i]);
+			}
+		});
+
+		Ar.Logf(TEXT("  %-10s write %8.1f MB/s, read %8.1f MB/s, values %s"), TEXT("Legacy"), Megabytes / LegacyWriteSeconds, Megabytes / LegacyReadSeconds, bLegacyCorrect ? TEXT("match") : TEXT("DO NOT MATCH"));
+		Ar.Logf(TEXT("  %-10s write %8.1f MB/s, read %8.1f MB/s, values %s"), TEXT("Native"), Megabytes / NativeWriteSeconds, Megabytes / NativeReadSeconds, bNativeCorrect ? TEXT("match") : TEXT("DO NOT MATCH"));
+		Ar.Logf(TEXT("  %-10s write %8.1f MB/s, read %8.1f MB/s, values %s"), TEXT("Blueprint"), Megabytes / BlueprintWriteSeconds, Megabytes / BlueprintReadSeconds, bBlueprintCorrect ? TEXT("match") : TEXT("DO NOT MATCH"));
+		Ar.Logf(TEXT("  Bytes %s the legacy implementation"), ((NativeBytes == LegacyBytes) && (BlueprintBytes == LegacyBytes)) ? TEXT("match") : TEXT("DO NOT MATCH"));
+	}
+
+	FAutoConsoleCommand BitDataBenchmarkCommand(
+		TEXT("LowEntry.BitDataBenchmark"),
+		TEXT("Compares writing and reading a payload of values with mixed bit widths byte by byte (the previous implementation) with the 64-bit buffered native writer and reader, and the blueprint BitData writer and reader built on them. Optional argument: number of values (default 1000000)."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&RunBitDataBenchmark)
+	);
+}
+
+#endif
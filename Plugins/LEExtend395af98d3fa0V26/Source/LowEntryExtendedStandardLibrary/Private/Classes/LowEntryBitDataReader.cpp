@@ -4,39 +4,47 @@
 #include "LowEntryExtendedStandardLibrary.h"
 
 
-constexpr uint8 ULowEntryBitDataReader::mask[9] = {static_cast<uint8>(0x00), static_cast<uint8>(0x01), static_cast<uint8>(0x03), static_cast<uint8>(0x07), static_cast<uint8>(0x0F), static_cast<uint8>(0x1F), static_cast<uint8>(0x3F), static_cast<uint8>(0x7F), static_cast<uint8>(0xFF)};
-
-
 ULowEntryBitDataReader::ULowEntryBitDataReader(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
 
 ULowEntryBitDataReader* ULowEntryBitDataReader::Create(const TArray<uint8>& Bytes, int32 Index, int32 Length)
 {
 	ULowEntryBitDataReader* Item = NewObject<ULowEntryBitDataReader>();
-	Item->Bytes = ULowEntryExtendedStandardLibrary::BytesSubArray(Bytes, Index, Length);
+	Item->SetBytes(ULowEntryByteSlice(Bytes, Index, Length));
+	return Item;
+}
+
+ULowEntryBitDataReader* ULowEntryBitDataReader::Create(const ULowEntryByteSlice& Bytes)
+{
+	ULowEntryBitDataReader* Item = NewObject<ULowEntryBitDataReader>();
+	Item->SetBytes(Bytes);
 	return Item;
 }
 
-ULowEntryBitDataReader* ULowEntryBitDataReader::CreateClone(const TArray<uint8>& Bytes, const int32 Position, const uint8 CurrentByte, const int32 CurrentBytePosition)
+ULowEntryBitDataReader* ULowEntryBitDataReader::CreateClone(const ULowEntryByteSlice& Bytes, const int64 BitPosition)
 {
 	ULowEntryBitDataReader* Item = NewObject<ULowEntryBitDataReader>();
-	Item->Bytes = Bytes;
-	Item->Position = Position;
-	Item->CurrentByte = CurrentByte;
-	Item->CurrentBytePosition = CurrentBytePosition;
+	Item->SetBytes(Bytes, BitPosition);
 	return Item;
 }
 
 
+void ULowEntryBitDataReader::SetBytes(const ULowEntryByteSlice& Bytes_, const int64 BitPosition)
+{
+	Bytes = Bytes_;
+	Reader = ULowEntryBitDataNativeReader(Bytes.View(), BitPosition);
+}
+
+// Continues at the next whole byte
 int32 ULowEntryBitDataReader::GetAndIncreasePosition(const int32 Increasement)
 {
-	int32 Pos = Position;
-	if ((Bytes.Num() - Increasement) <= Position)
+	const int32 Pos = Reader.Num() - Reader.Remaining();
+	if ((Reader.Num() - Increasement) <= Pos)
 	{
-		Position = Bytes.Num();
+		Reader.Empty();
 	}
 	else
 	{
-		Position += Increasement;
+		Reader.SetBitPosition(static_cast<int64>(Pos + Increasement) * 8);
 	}
 	return Pos;
 }
@@ -58,118 +66,46 @@ int32 ULowEntryBitDataReader::MaxElementsRemaining(const int32 MinimumSizePerEle
 
 ULowEntryBitDataReader* ULowEntryBitDataReader::GetClone()
 {
-	return CreateClone(Bytes, Position, CurrentByte, CurrentBytePosition);
+	return CreateClone(Bytes, Reader.GetBitPosition());
 }
 
 int32 ULowEntryBitDataReader::GetPosition()
 {
-	return (Position * 8) + CurrentBytePosition;
+	return static_cast<int32>(FMath::Min<int64>(Reader.GetBitPosition(), MAX_int32));
 }
 
 void ULowEntryBitDataReader::SetPosition(const int32 Position_)
 {
-	if (Position_ < 0)
-	{
-		Reset();
-	}
-	else
-	{
-		Position = Position_ / 8;
-		CurrentBytePosition = Position_ % 8;
-		CurrentByte = 0;
-		if (Position > Bytes.Num())
-		{
-			Position = Bytes.Num();
-			CurrentBytePosition = 0;
-		}
-		else if (CurrentBytePosition > 0)
-		{
-			if (Position == 0)
-			{
-				CurrentBytePosition = 0;
-			}
-			else
-			{
-				CurrentByte = Bytes[Position - 1];
-			}
-		}
-	}
+	Reader.SetBitPosition(Position_);
 }
 
 void ULowEntryBitDataReader::Reset()
 {
-	Position = 0;
-	CurrentBytePosition = 0;
-	CurrentByte = 0;
+	Reader.Reset();
 }
 
 void ULowEntryBitDataReader::Empty()
 {
-	Position = Bytes.Num();
-	CurrentBytePosition = 0;
-	CurrentByte = 0;
+	Reader.Empty();
 }
 
 int32 ULowEntryBitDataReader::Remaining()
 {
-	if (CurrentBytePosition != 0)
-	{
-		return (Bytes.Num() - Position) + 1;
-	}
-	return Bytes.Num() - Position;
+	return Reader.Remaining();
 }
 
 
 bool ULowEntryBitDataReader::GetRawBit()
 {
-	if (CurrentBytePosition == 0)
-	{
-		int32 pos = GetAndIncreasePosition(1);
-		if (Bytes.Num() <= pos)
-		{
-			return false;
-		}
-		CurrentByte = Bytes[pos];
-	}
-
-	bool bit = (((CurrentByte >> CurrentBytePosition) & 1) != 0);
-
-	if (CurrentBytePosition == 7)
-	{
-		CurrentBytePosition = 0;
-	}
-	else
-	{
-		CurrentBytePosition++;
-	}
-
-	return bit;
+	return Reader.ReadBit();
 }
 
 uint8 ULowEntryBitDataReader::GetRawByte()
 {
-	if (CurrentBytePosition == 0)
-	{
-		int32 pos = GetAndIncreasePosition(1);
-		if (Bytes.Num() <= pos)
-		{
-			return 0;
-		}
-		return Bytes[pos];
-	}
-	uint8 b = ((CurrentByte >> CurrentBytePosition) & mask[8 - CurrentBytePosition]);
-
-	int32 pos = GetAndIncreasePosition(1);
-	if (Bytes.Num() <= pos)
-	{
-		CurrentBytePosition = 0;
-		return b;
-	}
-	CurrentByte = Bytes[pos];
-
-	return (b | (CurrentByte << (8 - CurrentBytePosition)));
+	return Reader.ReadRawByte();
 }
 
+// Negative bits read the most significant bits of the byte
 uint8 ULowEntryBitDataReader::GetPartialRawByte(int32 Bits)
 {
 	if (Bits == 0)
@@ -178,61 +114,21 @@ uint8 ULowEntryBitDataReader::GetPartialRawByte(int32 Bits)
 	}
 	if ((Bits >= 8) || (Bits <= -8))
 	{
-		return GetRawByte();
+		return Reader.ReadRawByte();
 	}
-
-	if (CurrentBytePosition == 0)
+	if (Bits < 0)
 	{
-		int32 pos = GetAndIncreasePosition(1);
-		if (Bytes.Num() <= pos)
-		{
-			return 0;
-		}
-		CurrentByte = Bytes[pos];
+		return static_cast<uint8>(Reader.ReadBits(-Bits) << (8 + Bits));
 	}
+	return static_cast<uint8>(Reader.ReadBits(Bits));
+}
 
-	bool mostSignificantBits = false;
-	if (Bits < 0)
-	{
-		Bits = -Bits;
-		mostSignificantBits = true;
-	}
-
-	uint8 b = ((CurrentByte >> CurrentBytePosition) & mask[8 - CurrentBytePosition]);
-	CurrentBytePosition += Bits;
-
-	if (CurrentBytePosition >= 8)
-	{
-		int32 pos = GetAndIncreasePosition(1);
-		if (Bytes.Num() <= pos)
-		{
-			CurrentBytePosition = 0;
-			b = (b & mask[Bits]);
-			if (mostSignificantBits)
-			{
-				return (b << (8 - Bits));
-			}
-			return b;
-		}
-		CurrentByte = Bytes[pos];
-		CurrentBytePosition -= 8;
-
-		if (CurrentBytePosition != 0)
-		{
-			b = ((b | (CurrentByte << (Bits - CurrentBytePosition))) & mask[Bits]);
-			if (mostSignificantBits)
-			{
-				return (b << (8 - Bits));
-			}
-			return b;
-		}
-	}
-	b = (b & mask[Bits]);
-	if (mostSignificantBits)
-	{
-		return (b << (8 - Bits));
-	}
-	return b;
+TArray<uint8> ULowEntryBitDataReader::GetRawBytes(const int32 Length)
+{
+	TArray<uint8> Data;
+	Data.SetNumUninitialized(Length);
+	Reader.ReadRawBytes(Data.GetData(), Length);
+	return Data;
 }
 
 
@@ -265,37 +161,7 @@ int32 ULowEntryBitDataReader::GetIntegerLeastSignificantBits(const int32 BitCoun
 	{
 		return 0;
 	}
-	if (BitCount >= 32)
-	{
-		uint8 b1 = GetRawByte();
-		uint8 b2 = GetRawByte();
-		uint8 b3 = GetRawByte();
-		uint8 b4 = GetRawByte();
-		return (b4 << 24) | (b3 << 16) | (b2 << 8) | b1;
-	}
-	if (BitCount > 24)
-	{
-		uint8 b1 = GetRawByte();
-		uint8 b2 = GetRawByte();
-		uint8 b3 = GetRawByte();
-		uint8 b4 = GetPartialRawByte(BitCount - 24);
-		return (b4 << 24) | (b3 << 16) | (b2 << 8) | b1;
-	}
-	if (BitCount > 16)
-	{
-		uint8 b1 = GetRawByte();
-		uint8 b2 = GetRawByte();
-		uint8 b3 = GetPartialRawByte(BitCount - 16);
-		return (b3 << 16) | (b2 << 8) | b1;
-	}
-	if (BitCount > 8)
-	{
-		uint8 b1 = GetRawByte();
-		uint8 b2 = GetPartialRawByte(BitCount - 8);
-		return (b2 << 8) | b1;
-	}
-	uint8 b1 = GetPartialRawByte(BitCount);
-	return b1;
+	return static_cast<int32>(static_cast<uint32>(Reader.ReadBits(FMath::Min(BitCount, 32))));
 }
 
 int32 ULowEntryBitDataReader::GetIntegerMostSignificantBits(int32 BitCount)
@@ -304,38 +170,11 @@ int32 ULowEntryBitDataReader::GetIntegerMostSignificantBits(int32 BitCount)
 	{
 		return 0;
 	}
-	BitCount = -BitCount;
-	if (BitCount <= -32)
-	{
-		uint8 b1 = GetRawByte();
-		uint8 b2 = GetRawByte();
-		uint8 b3 = GetRawByte();
-		uint8 b4 = GetRawByte();
-		return (b4 << 24) | (b3 << 16) | (b2 << 8) | b1;
-	}
-	if (BitCount < -24)
-	{
-		uint8 b1 = GetPartialRawByte(BitCount + 24);
-		uint8 b2 = GetRawByte();
-		uint8 b3 = GetRawByte();
-		uint8 b4 = GetRawByte();
-		return (b4 << 24) | (b3 << 16) | (b2 << 8) | b1;
-	}
-	if (BitCount < -16)
-	{
-		uint8 b1 = GetPartialRawByte(BitCount + 16);
-		uint8 b2 = GetRawByte();
-		uint8 b3 = GetRawByte();
-		return (b3 << 24) | (b2 << 16) | (b1 << 8);
-	}
-	if (BitCount < -8)
+	if (BitCount >= 32)
 	{
-		uint8 b1 = GetPartialRawByte(BitCount + 8);
-		uint8 b2 = GetRawByte();
-		return (b2 << 24) | (b1 << 16);
+		return static_cast<int32>(static_cast<uint32>(Reader.ReadBits(32)));
 	}
-	uint8 b1 = GetPartialRawByte(BitCount);
-	return (b1 << 24);
+	return static_cast<int32>(static_cast<uint32>(Reader.ReadBits(BitCount) << (32 - BitCount)));
 }
 
 uint8 ULowEntryBitDataReader::GetByte()
@@ -345,33 +184,7 @@ uint8 ULowEntryBitDataReader::GetByte()
 
 int32 ULowEntryBitDataReader::GetInteger()
 {
-	int32 RemainingCount = Remaining();
-	if (RemainingCount >= 4)
-	{
-		uint8 b1 = GetRawByte();
-		uint8 b2 = GetRawByte();
-		uint8 b3 = GetRawByte();
-		uint8 b4 = GetRawByte();
-		return (b1 << 24) | (b2 << 16) | (b3 << 8) | b4;
-	}
-	if (RemainingCount == 3)
-	{
-		uint8 b1 = GetRawByte();
-		uint8 b2 = GetRawByte();
-		uint8 b3 = GetRawByte();
-		return (b1 << 16) | (b2 << 8) | b3;
-	}
-	if (RemainingCount == 2)
-	{
-		uint8 b1 = GetRawByte();
-		uint8 b2 = GetRawByte();
-		return (b1 << 8) | b2;
-	}
-	if (RemainingCount == 1)
-	{
-		return GetRawByte();
-	}
-	return 0;
+	return static_cast<int32>(static_cast<uint32>(Reader.ReadBigEndian(FMath::Clamp(Remaining(), 0, 4))));
 }
 
 int32 ULowEntryBitDataReader::GetUinteger()
@@ -502,142 +315,12 @@ int32 ULowEntryBitDataReader::GetPositiveInteger3()
 
 int64 ULowEntryBitDataReader::GetLong()
 {
-	int32 RemainingCount = Remaining();
-	if (RemainingCount >= 8)
-	{
-		int64 b1 = GetRawByte();
-		int64 b2 = GetRawByte();
-		int64 b3 = GetRawByte();
-		int64 b4 = GetRawByte();
-		int64 b5 = GetRawByte();
-		int64 b6 = GetRawByte();
-		int64 b7 = GetRawByte();
-		int64 b8 = GetRawByte();
-		return (b1 << 56) | (b2 << 48) | (b3 << 40) | (b4 << 32) | (b5 << 24) | (b6 << 16) | (b7 << 8) | b8;
-	}
-	if (RemainingCount >= 7)
-	{
-		int64 b1 = GetRawByte();
-		int64 b2 = GetRawByte();
-		int64 b3 = GetRawByte();
-		int64 b4 = GetRawByte();
-		int64 b5 = GetRawByte();
-		int64 b6 = GetRawByte();
-		int64 b7 = GetRawByte();
-		return (b1 << 48) | (b2 << 40) | (b3 << 32) | (b4 << 24) | (b5 << 16) | (b6 << 8) | b7;
-	}
-	if (RemainingCount >= 6)
-	{
-		int64 b1 = GetRawByte();
-		int64 b2 = GetRawByte();
-		int64 b3 = GetRawByte();
-		int64 b4 = GetRawByte();
-		int64 b5 = GetRawByte();
-		int64 b6 = GetRawByte();
-		return (b1 << 40) | (b2 << 32) | (b3 << 24) | (b4 << 16) | (b5 << 8) | b6;
-	}
-	if (RemainingCount >= 5)
-	{
-		int64 b1 = GetRawByte();
-		int64 b2 = GetRawByte();
-		int64 b3 = GetRawByte();
-		int64 b4 = GetRawByte();
-		int64 b5 = GetRawByte();
-		return (b1 << 32) | (b2 << 24) | (b3 << 16) | (b4 << 8) | b5;
-	}
-	if (RemainingCount >= 4)
-	{
-		int64 b1 = GetRawByte();
-		int64 b2 = GetRawByte();
-		int64 b3 = GetRawByte();
-		int64 b4 = GetRawByte();
-		return (b1 << 24) | (b2 << 16) | (b3 << 8) | b4;
-	}
-	if (RemainingCount == 3)
-	{
-		int64 b1 = GetRawByte();
-		int64 b2 = GetRawByte();
-		int64 b3 = GetRawByte();
-		return (b1 << 16) | (b2 << 8) | b3;
-	}
-	if (RemainingCount == 2)
-	{
-		int64 b1 = GetRawByte();
-		int64 b2 = GetRawByte();
-		return (b1 << 8) | b2;
-	}
-	if (RemainingCount == 1)
-	{
-		return GetRawByte();
-	}
-	return 0;
+	return static_cast<int64>(Reader.ReadBigEndian(FMath::Clamp(Remaining(), 0, 8)));
 }
 
 ULowEntryLong* ULowEntryBitDataReader::GetLongBytes()
 {
-	TArray<uint8> Data;
-	int32 RemainingCount = Remaining();
-	if (RemainingCount >= 8)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 7)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 6)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 5)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 4)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 3)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 2)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 1)
-	{
-		Data.Add(GetRawByte());
-	}
-	return ULowEntryLong::Create(Data);
+	return ULowEntryLong::Create(GetRawBytes(FMath::Clamp(Remaining(), 0, 8)));
 }
 
 float ULowEntryBitDataReader::GetFloat()
@@ -654,69 +337,7 @@ double ULowEntryBitDataReader::GetDouble()
 
 ULowEntryDouble* ULowEntryBitDataReader::GetDoubleBytes()
 {
-	TArray<uint8> Data;
-	int32 RemainingCount = Remaining();
-	if (RemainingCount >= 8)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 7)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 6)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 5)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 4)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 3)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 2)
-	{
-		Data.Add(GetRawByte());
-		Data.Add(GetRawByte());
-	}
-	else if (RemainingCount == 1)
-	{
-		Data.Add(GetRawByte());
-	}
-	return ULowEntryDouble::Create(Data);
+	return ULowEntryDouble::Create(GetRawBytes(FMath::Clamp(Remaining(), 0, 8)));
 }
 
 bool ULowEntryBitDataReader::GetBoolean()
@@ -732,18 +353,7 @@ FString ULowEntryBitDataReader::GetStringUtf8()
 	{
 		return "";
 	}
-	if (CurrentBytePosition == 0)
-	{
-		int32 pos = GetAndIncreasePosition(length);
-		return ULowEntryExtendedStandardLibrary::BytesToStringUtf8(Bytes, pos, length);
-	}
-	TArray<uint8> Data;
-	Data.SetNum(length);
-	for (int i = 0; i < length; i++)
-	{
-		Data[i] = GetRawByte();
-	}
-	return ULowEntryExtendedStandardLibrary::BytesToStringUtf8(Data);
+	return ULowEntryExtendedStandardLibrary::BytesToStringUtf8(GetRawBytes(length));
 }
 
 
@@ -856,18 +466,7 @@ TArray<uint8> ULowEntryBitDataReader::GetByteArray()
 	{
 		return TArray<uint8>();
 	}
-	if (CurrentBytePosition == 0)
-	{
-		int32 pos = GetAndIncreasePosition(length);
-		return ULowEntryExtendedStandardLibrary::BytesSubArray(Bytes, pos, length);
-	}
-	TArray<uint8> Data;
-	Data.SetNum(length);
-	for (int i = 0; i < length; i++)
-	{
-		Data[i] = GetRawByte();
-	}
-	return Data;
+	return GetRawBytes(length);
 }
 
 TArray<int32> ULowEntryBitDataReader::GetIntegerArray()
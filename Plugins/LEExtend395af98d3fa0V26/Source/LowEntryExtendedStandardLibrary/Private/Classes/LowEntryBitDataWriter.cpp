@@ -5,9 +5,6 @@
 #include "LowEntryExtendedStandardLibrary.h"
 
 
-constexpr uint8 ULowEntryBitDataWriter::mask[9] = {static_cast<uint8>(0x00), static_cast<uint8>(0x01), static_cast<uint8>(0x03), static_cast<uint8>(0x07), static_cast<uint8>(0x0F), static_cast<uint8>(0x1F), static_cast<uint8>(0x3F), static_cast<uint8>(0x7F), static_cast<uint8>(0xFF)};
-
-
 ULowEntryBitDataWriter::ULowEntryBitDataWriter(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
 
 ULowEntryBitDataWriter* ULowEntryBitDataWriter::Create()
@@ -167,37 +164,15 @@ ULowEntryBitDataWriter* ULowEntryBitDataWriter::CreateFromEntryArray(const TArra
 
 void ULowEntryBitDataWriter::AddRawBit(const bool Value)
 {
-	if (Value)
-	{
-		CurrentByte |= (1 << CurrentBytePosition);
-	}
-
-	if (CurrentBytePosition == 7)
-	{
-		Bytes.Add(CurrentByte);
-		CurrentByte = 0;
-		CurrentBytePosition = 0;
-	}
-	else
-	{
-		CurrentBytePosition++;
-	}
+	Writer.WriteBit(Value);
 }
 
 void ULowEntryBitDataWriter::AddRawByte(const uint8 Value)
 {
-	if (CurrentBytePosition == 0)
-	{
-		Bytes.Add(Value);
-	}
-	else
-	{
-		CurrentByte |= (Value << CurrentBytePosition);
-		Bytes.Add(CurrentByte);
-		CurrentByte = static_cast<uint8>((Value >> (8 - CurrentBytePosition)) & mask[CurrentBytePosition]);
-	}
+	Writer.WriteRawByte(Value);
 }
 
+// Negative bits write the most significant bits of the byte
 void ULowEntryBitDataWriter::AddPartialRawByte(uint8 Value, int32 Bits)
 {
 	if (Bits == 0)
@@ -206,61 +181,26 @@ void ULowEntryBitDataWriter::AddPartialRawByte(uint8 Value, int32 Bits)
 	}
 	if ((Bits >= 8) || (Bits <= -8))
 	{
-		AddRawByte(Value);
+		Writer.WriteRawByte(Value);
 		return;
 	}
-
 	if (Bits < 0)
 	{
-		Bits = -Bits;
-		Value >>= (8 - Bits);
-	}
-
-	Value &= mask[Bits];
-
-	CurrentByte |= (Value << CurrentBytePosition);
-	CurrentBytePosition += Bits;
-
-	if (CurrentBytePosition >= 8)
-	{
-		Bytes.Add(CurrentByte);
-		CurrentBytePosition -= 8;
-		if (CurrentBytePosition == 0)
-		{
-			CurrentByte = 0;
-		}
-		else
-		{
-			CurrentByte = static_cast<uint8>(Value >> (Bits - CurrentBytePosition)); // b is already masked
-		}
+		Writer.WriteBits(Value >> (8 + Bits), -Bits);
+		return;
 	}
+	Writer.WriteBits(Value, Bits);
 }
 
 void ULowEntryBitDataWriter::AddRawBytes(const TArray<uint8>& Value)
 {
-	if (CurrentBytePosition == 0)
-	{
-		Bytes.Append(Value);
-	}
-	else
-	{
-		for (uint8 V : Value)
-		{
-			AddRawByte(V);
-		}
-	}
+	Writer.WriteRawBytes(Value);
 }
 
 
 TArray<uint8> ULowEntryBitDataWriter::GetBytes()
 {
-	if (CurrentBytePosition == 0)
-	{
-		return Bytes;
-	}
-	TArray<uint8> Data = Bytes;
-	Data.Add(CurrentByte);
-	return Data;
+	return Writer.GetBytes();
 }
 
 
@@ -286,70 +226,20 @@ void ULowEntryBitDataWriter::AddIntegerLeastSignificantBits(const int32 Value, c
 {
 	if (BitCount > 0)
 	{
-		if (BitCount >= 32)
-		{
-			AddRawByte(Value);
-			AddRawByte(Value >> 8);
-			AddRawByte(Value >> 16);
-			AddRawByte(Value >> 24);
-		}
-		else if (BitCount > 24)
-		{
-			AddRawByte(Value);
-			AddRawByte(Value >> 8);
-			AddRawByte(Value >> 16);
-			AddPartialRawByte((Value >> 24), (BitCount - 24));
-		}
-		else if (BitCount > 16)
-		{
-			AddRawByte(Value);
-			AddRawByte(Value >> 8);
-			AddPartialRawByte((Value >> 16), (BitCount - 16));
-		}
-		else if (BitCount > 8)
-		{
-			AddRawByte(Value);
-			AddPartialRawByte((Value >> 8), (BitCount - 8));
-		}
-		else
-		{
-			AddPartialRawByte(Value, BitCount);
-		}
+		Writer.WriteBits(static_cast<uint32>(Value), FMath::Min(BitCount, 32));
 	}
 }
 void ULowEntryBitDataWriter::AddIntegerMostSignificantBits(const int32 Value, int32 BitCount)
 {
 	if (BitCount > 0)
 	{
-		BitCount = -BitCount;
-		if (BitCount <= -32)
-		{
-			AddRawByte(Value);
-			AddRawByte(Value >> 8);
-			AddRawByte(Value >> 16);
-			AddRawByte(Value >> 24);
-		}
-		else if (BitCount < -24)
-		{
-			AddPartialRawByte((Value), (BitCount + 24));
-			AddRawByte(Value >> 8);
-			AddRawByte(Value >> 16);
-			AddRawByte(Value >> 24);
-		}
-		else if (BitCount < -16)
-		{
-			AddPartialRawByte((Value >> 8), (BitCount + 16));
-			AddRawByte(Value >> 16);
-			AddRawByte(Value >> 24);
-		}
-		else if (BitCount < -8)
+		if (BitCount >= 32)
 		{
-			AddPartialRawByte((Value >> 16), (BitCount + 8));
-			AddRawByte(Value >> 24);
+			Writer.WriteBits(static_cast<uint32>(Value), 32);
 		}
 		else
 		{
-			AddPartialRawByte((Value >> 24), BitCount);
+			Writer.WriteBits(static_cast<uint32>(Value) >> (32 - BitCount), BitCount);
 		}
 	}
 }
@@ -359,99 +249,60 @@ void ULowEntryBitDataWriter::AddByte(const uint8 Value)
 }
 void ULowEntryBitDataWriter::AddInteger(const int32 Value)
 {
-	AddRawByte(Value >> 24);
-	AddRawByte(Value >> 16);
-	AddRawByte(Value >> 8);
-	AddRawByte(Value);
+	Writer.WriteBigEndian(static_cast<uint32>(Value), 4);
 }
 void ULowEntryBitDataWriter::AddUinteger(const int32 Value)
 {
 	if (Value <= 0)
 	{
-		AddRawByte(0);
+		Writer.WriteRawByte(0);
 	}
 	else if (Value < 128)
 	{
-		AddRawByte(Value);
+		Writer.WriteRawByte(Value);
 	}
 	else
 	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
+		Writer.WriteBigEndian(static_cast<uint32>(Value) | (1u << 31), 4);
 	}
 }
 void ULowEntryBitDataWriter::AddPositiveInteger1(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-	}
-	else if (Value < 128)
-	{
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	AddUinteger(Value);
 }
 void ULowEntryBitDataWriter::AddPositiveInteger2(const int32 Value)
 {
 	if (Value <= 0)
 	{
-		AddRawByte(0);
-		AddRawByte(0);
+		Writer.WriteBigEndian(0, 2);
 	}
 	else if (Value < 32768)
 	{
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
+		Writer.WriteBigEndian(Value, 2);
 	}
 	else
 	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
+		Writer.WriteBigEndian(static_cast<uint32>(Value) | (1u << 31), 4);
 	}
 }
 void ULowEntryBitDataWriter::AddPositiveInteger3(const int32 Value)
 {
 	if (Value <= 0)
 	{
-		AddRawByte(0);
-		AddRawByte(0);
-		AddRawByte(0);
+		Writer.WriteBigEndian(0, 3);
 	}
 	else if (Value < 8388608)
 	{
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
+		Writer.WriteBigEndian(Value, 3);
 	}
 	else
 	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
+		Writer.WriteBigEndian(static_cast<uint32>(Value) | (1u << 31), 4);
 	}
 }
 void ULowEntryBitDataWriter::AddLong(const int64 Value)
 {
-	AddRawByte(Value >> 56);
-	AddRawByte(Value >> 48);
-	AddRawByte(Value >> 40);
-	AddRawByte(Value >> 32);
-	AddRawByte(Value >> 24);
-	AddRawByte(Value >> 16);
-	AddRawByte(Value >> 8);
-	AddRawByte(Value);
+	Writer.WriteBigEndian(static_cast<uint64>(Value), 8);
 }
 void ULowEntryBitDataWriter::AddLongBytes(ULowEntryLong* Value)
 {
@@ -466,11 +317,11 @@ void ULowEntryBitDataWriter::AddLongBytes(ULowEntryLong* Value)
 }
 void ULowEntryBitDataWriter::AddFloat(const float Value)
 {
-	AddRawBytes(ULowEntryExtendedStandardLibrary::FloatToBytes(Value));
+	Writer.WriteBigEndian(*reinterpret_cast<const uint32*>(&Value), 4);
 }
 void ULowEntryBitDataWriter::AddDouble(const double Value)
 {
-	AddRawBytes(ULowEntryExtendedStandardLibrary::DoubleToBytes(Value));
+	Writer.WriteBigEndian(*reinterpret_cast<const uint64*>(&Value), 8);
 }
 void ULowEntryBitDataWriter::AddDoubleBytes(ULowEntryDouble* Value)
 {
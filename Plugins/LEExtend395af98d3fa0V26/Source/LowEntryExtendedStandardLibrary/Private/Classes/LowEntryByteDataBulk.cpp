@@ -0,0 +1,151 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryByteDataBulk.h"
+#include "LowEntryHashingShaKernels.h"
+
+#include "Misc/ByteSwap.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+	#include <immintrin.h>
+
+	#if defined(__clang__) || defined(__GNUC__)
+		#define LOWENTRY_TARGET_AVX2 __attribute__((target("avx2")))
+	#else
+		#define LOWENTRY_TARGET_AVX2
+	#endif
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+	typedef void (*FCopyFunction)(uint8* Dest, const uint8* Src, int32 Count);
+
+
+	void Swap32Scalar(uint8* Dest, const uint8* Src, int32 Count)
+	{
+		for (int32 i = 0; i < Count; i++)
+		{
+			uint32 Value;
+			FMemory::Memcpy(&Value, Src + (i * 4), 4);
+			Value = BYTESWAP_ORDER32(Value);
+			FMemory::Memcpy(Dest + (i * 4), &Value, 4);
+		}
+	}
+
+	void Swap64Scalar(uint8* Dest, const uint8* Src, int32 Count)
+	{
+		for (int32 i = 0; i < Count; i++)
+		{
+			uint64 Value;
+			FMemory::Memcpy(&Value, Src + (i * 8), 8);
+			Value = BYTESWAP_ORDER64(Value);
+			FMemory::Memcpy(Dest + (i * 8), &Value, 8);
+		}
+	}
+
+
+#if PLATFORM_CPU_X86_FAMILY
+	// 32 bytes per step, the tail is done by the scalar version
+	LOWENTRY_TARGET_AVX2 void SwapAvx2(uint8* Dest, const uint8* Src, int32 Count, const __m256i Shuffle, const int32 ValueSize, FCopyFunction Tail)
+	{
+		const int32 ValuesPerStep = 32 / ValueSize;
+		int32 i = 0;
+		for (; (i + ValuesPerStep) <= Count; i += ValuesPerStep)
+		{
+			const __m256i Value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Src + (i * ValueSize)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dest + (i * ValueSize)), _mm256_shuffle_epi8(Value, Shuffle));
+		}
+		Tail(Dest + (i * ValueSize), Src + (i * ValueSize), Count - i);
+	}
+
+	LOWENTRY_TARGET_AVX2 void Swap32Avx2(uint8* Dest, const uint8* Src, int32 Count)
+	{
+		const __m256i Shuffle = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+		SwapAvx2(Dest, Src, Count, Shuffle, 4, &Swap32Scalar);
+	}
+
+	LOWENTRY_TARGET_AVX2 void Swap64Avx2(uint8* Dest, const uint8* Src, int32 Count)
+	{
+		const __m256i Shuffle = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+		SwapAvx2(Dest, Src, Count, Shuffle, 8, &Swap64Scalar);
+	}
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	void Swap32Neon(uint8* Dest, const uint8* Src, int32 Count)
+	{
+		int32 i = 0;
+		for (; (i + 4) <= Count; i += 4)
+		{
+			vst1q_u8(Dest + (i * 4), vrev32q_u8(vld1q_u8(Src + (i * 4))));
+		}
+		Swap32Scalar(Dest + (i * 4), Src + (i * 4), Count - i);
+	}
+
+	void Swap64Neon(uint8* Dest, const uint8* Src, int32 Count)
+	{
+		int32 i = 0;
+		for (; (i + 2) <= Count; i += 2)
+		{
+			vst1q_u8(Dest + (i * 8), vrev64q_u8(vld1q_u8(Src + (i * 8))));
+		}
+		Swap64Scalar(Dest + (i * 8), Src + (i * 8), Count - i);
+	}
+#endif
+
+
+	FCopyFunction GetSwap32()
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		if (ULowEntryHashingShaKernels::HasAvx2())
+		{
+			return &Swap32Avx2;
+		}
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		return &Swap32Neon;
+#endif
+		return &Swap32Scalar;
+	}
+
+	FCopyFunction GetSwap64()
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		if (ULowEntryHashingShaKernels::HasAvx2())
+		{
+			return &Swap64Avx2;
+		}
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		return &Swap64Neon;
+#endif
+		return &Swap64Scalar;
+	}
+}
+
+
+void ULowEntryByteDataBulk::CopyBigEndian32(void* Dest, const void* Src, const int32 Count)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+#if PLATFORM_LITTLE_ENDIAN
+	static const FCopyFunction Swap32 = GetSwap32();
+	Swap32(static_cast<uint8*>(Dest), static_cast<const uint8*>(Src), Count);
+#else
+	FMemory::Memcpy(Dest, Src, static_cast<SIZE_T>(Count) * 4);
+#endif
+}
+
+void ULowEntryByteDataBulk::CopyBigEndian64(void* Dest, const void* Src, const int32 Count)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+#if PLATFORM_LITTLE_ENDIAN
+	static const FCopyFunction Swap64 = GetSwap64();
+	Swap64(static_cast<uint8*>(Dest), static_cast<const uint8*>(Src), Count);
+#else
+	FMemory::Memcpy(Dest, Src, static_cast<SIZE_T>(Count) * 8);
+#endif
+}
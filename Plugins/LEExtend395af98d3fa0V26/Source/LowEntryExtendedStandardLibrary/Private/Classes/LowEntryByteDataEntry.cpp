@@ -164,6 +164,183 @@ ULowEntryByteDataEntry* ULowEntryByteDataEntry::CreateFromStringUtf8Array(const
 }
 
 
+int64 ULowEntryByteDataEntry::GetSize()
+{
+	switch (Type)
+	{
+	case 1:
+		return TLowEntryByteDataType<uint8>::GetSize(ByteValue);
+	case 2:
+		return TLowEntryByteDataType<int32>::GetSize(IntegerValue);
+	case 8:
+		return ULowEntryByteDataNativeWriter::GetUintegerSize(IntegerValue);
+	case 9:
+		return ULowEntryByteDataNativeWriter::GetPositiveInteger2Size(IntegerValue);
+	case 10:
+		return ULowEntryByteDataNativeWriter::GetPositiveInteger3Size(IntegerValue);
+	case 11:
+		return TLowEntryByteDataType<int64>::GetSize(LongValue);
+	case 3:
+		return ((LongBytesValue != nullptr) ? LongBytesValue->Bytes.Num() : 8);
+	case 4:
+		return TLowEntryByteDataType<float>::GetSize(FloatValue);
+	case 16:
+		return TLowEntryByteDataType<double>::GetSize(DoubleValue);
+	case 5:
+		return ((DoubleBytesValue != nullptr) ? DoubleBytesValue->Bytes.Num() : 8);
+	case 6:
+		return TLowEntryByteDataType<bool>::GetSize(BooleanValue);
+	case 7:
+		return TLowEntryByteDataType<FString>::GetSize(StringUtf8Value);
+
+	case 101:
+		return TLowEntryByteDataType<TArray<uint8>>::GetSize(ByteArrayValue);
+	case 102:
+		return TLowEntryByteDataType<TArray<int32>>::GetSize(IntegerArrayValue);
+	case 108:
+		return ULowEntryByteDataNativeWriter::GetPositiveInteger1ArraySize(IntegerArrayValue);
+	case 109:
+		return ULowEntryByteDataNativeWriter::GetPositiveInteger2ArraySize(IntegerArrayValue);
+	case 110:
+		return ULowEntryByteDataNativeWriter::GetPositiveInteger3ArraySize(IntegerArrayValue);
+	case 111:
+		return TLowEntryByteDataType<TArray<int64>>::GetSize(LongArrayValue);
+	case 103:
+		return ULowEntryByteDataNativeWriter::GetUintegerSize(LongBytesArrayValue.Num()) + (static_cast<int64>(LongBytesArrayValue.Num()) * 8);
+	case 104:
+		return TLowEntryByteDataType<TArray<float>>::GetSize(FloatArrayValue);
+	case 116:
+		return TLowEntryByteDataType<TArray<double>>::GetSize(DoubleArrayValue);
+	case 105:
+		return ULowEntryByteDataNativeWriter::GetUintegerSize(DoubleBytesArrayValue.Num()) + (static_cast<int64>(DoubleBytesArrayValue.Num()) * 8);
+	case 106:
+		return TLowEntryByteDataType<TArray<bool>>::GetSize(BooleanArrayValue);
+	case 107:
+		return TLowEntryByteDataType<TArray<FString>>::GetSize(StringUtf8ArrayValue);
+	default:
+		return 0;
+	}
+}
+
+void ULowEntryByteDataEntry::WriteTo(ULowEntryByteDataNativeWriter& Writer)
+{
+	switch (Type)
+	{
+	case 1:
+		Writer.Write(ByteValue);
+		break;
+	case 2:
+		Writer.Write(IntegerValue);
+		break;
+	case 8:
+		Writer.WritePositiveInteger1(IntegerValue);
+		break;
+	case 9:
+		Writer.WritePositiveInteger2(IntegerValue);
+		break;
+	case 10:
+		Writer.WritePositiveInteger3(IntegerValue);
+		break;
+	case 11:
+		Writer.Write(LongValue);
+		break;
+	case 3:
+		if (LongBytesValue != nullptr)
+		{
+			Writer.WriteRawBytes(LongBytesValue->Bytes);
+		}
+		else
+		{
+			Writer.WriteRawBytes(ULowEntryLong::GetDefaultBytes());
+		}
+		break;
+	case 4:
+		Writer.Write(FloatValue);
+		break;
+	case 16:
+		Writer.Write(DoubleValue);
+		break;
+	case 5:
+		if (DoubleBytesValue != nullptr)
+		{
+			Writer.WriteRawBytes(DoubleBytesValue->Bytes);
+		}
+		else
+		{
+			Writer.WriteRawBytes(ULowEntryDouble::GetDefaultBytes());
+		}
+		break;
+	case 6:
+		Writer.Write(BooleanValue);
+		break;
+	case 7:
+		Writer.Write(StringUtf8Value);
+		break;
+
+	case 101:
+		Writer.Write(ByteArrayValue);
+		break;
+	case 102:
+		Writer.Write(IntegerArrayValue);
+		break;
+	case 108:
+		Writer.WritePositiveInteger1Array(IntegerArrayValue);
+		break;
+	case 109:
+		Writer.WritePositiveInteger2Array(IntegerArrayValue);
+		break;
+	case 110:
+		Writer.WritePositiveInteger3Array(IntegerArrayValue);
+		break;
+	case 111:
+		Writer.Write(LongArrayValue);
+		break;
+	case 103:
+		Writer.WriteUinteger(LongBytesArrayValue.Num());
+		for (ULowEntryLong* V : LongBytesArrayValue)
+		{
+			if (V != nullptr)
+			{
+				Writer.WriteRawBytes(V->Bytes);
+			}
+			else
+			{
+				Writer.WriteRawBytes(ULowEntryLong::GetDefaultBytes());
+			}
+		}
+		break;
+	case 104:
+		Writer.Write(FloatArrayValue);
+		break;
+	case 116:
+		Writer.Write(DoubleArrayValue);
+		break;
+	case 105:
+		Writer.WriteUinteger(DoubleBytesArrayValue.Num());
+		for (ULowEntryDouble* V : DoubleBytesArrayValue)
+		{
+			if (V != nullptr)
+			{
+				Writer.WriteRawBytes(V->Bytes);
+			}
+			else
+			{
+				Writer.WriteRawBytes(ULowEntryDouble::GetDefaultBytes());
+			}
+		}
+		break;
+	case 106:
+		Writer.Write(BooleanArrayValue);
+		break;
+	case 107:
+		Writer.Write(StringUtf8ArrayValue);
+		break;
+	default:
+		break;
+	}
+}
+
+
 bool ULowEntryByteDataEntry::IsByte()
 {
 	return (Type == 1);
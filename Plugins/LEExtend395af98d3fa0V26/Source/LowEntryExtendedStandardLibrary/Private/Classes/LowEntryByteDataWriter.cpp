@@ -2,7 +2,6 @@
 
 #include "LowEntryByteDataWriter.h"
 #include "LowEntryByteDataEntry.h"
-#include "LowEntryExtendedStandardLibrary.h"
 
 
 ULowEntryByteDataWriter::ULowEntryByteDataWriter(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
@@ -14,108 +13,22 @@ ULowEntryByteDataWriter* ULowEntryByteDataWriter::Create()
 ULowEntryByteDataWriter* ULowEntryByteDataWriter::CreateFromEntryArray(const TArray<ULowEntryByteDataEntry*>& Array)
 {
 	ULowEntryByteDataWriter* Instance = NewObject<ULowEntryByteDataWriter>();
-	for (int64 i = 0; i < Array.Num(); i++)
+
+	int64 Size = 0;
+	for (ULowEntryByteDataEntry* Item : Array)
 	{
-		ULowEntryByteDataEntry* Item = Array[i];
 		if (Item != nullptr)
 		{
-			if (Item->IsByte())
-			{
-				Instance->AddByte(Item->GetByte());
-			}
-			else if (Item->IsInteger())
-			{
-				Instance->AddInteger(Item->GetInteger());
-			}
-			else if (Item->IsPositiveInteger1())
-			{
-				Instance->AddPositiveInteger1(Item->GetPositiveInteger1());
-			}
-			else if (Item->IsPositiveInteger2())
-			{
-				Instance->AddPositiveInteger2(Item->GetPositiveInteger2());
-			}
-			else if (Item->IsPositiveInteger3())
-			{
-				Instance->AddPositiveInteger3(Item->GetPositiveInteger3());
-			}
-			else if (Item->IsLong())
-			{
-				Instance->AddLong(Item->GetLong());
-			}
-			else if (Item->IsLongBytes())
-			{
-				Instance->AddLongBytes(Item->GetLongBytes());
-			}
-			else if (Item->IsFloat())
-			{
-				Instance->AddFloat(Item->GetFloat());
-			}
-			else if (Item->IsDouble())
-			{
-				Instance->AddDouble(Item->GetDouble());
-			}
-			else if (Item->IsDoubleBytes())
-			{
-				Instance->AddDoubleBytes(Item->GetDoubleBytes());
-			}
-			else if (Item->IsBoolean())
-			{
-				Instance->AddBoolean(Item->GetBoolean());
-			}
-			else if (Item->IsStringUtf8())
-			{
-				Instance->AddStringUtf8(Item->GetStringUtf8());
-			}
+			Size += Item->GetSize();
+		}
+	}
+	Instance->Writer.Reserve(Size);
 
-			else if (Item->IsByteArray())
-			{
-				Instance->AddByteArray(Item->GetByteArray());
-			}
-			else if (Item->IsIntegerArray())
-			{
-				Instance->AddIntegerArray(Item->GetIntegerArray());
-			}
-			else if (Item->IsPositiveInteger1Array())
-			{
-				Instance->AddPositiveInteger1Array(Item->GetPositiveInteger1Array());
-			}
-			else if (Item->IsPositiveInteger2Array())
-			{
-				Instance->AddPositiveInteger2Array(Item->GetPositiveInteger2Array());
-			}
-			else if (Item->IsPositiveInteger3Array())
-			{
-				Instance->AddPositiveInteger3Array(Item->GetPositiveInteger3Array());
-			}
-			else if (Item->IsLongArray())
-			{
-				Instance->AddLongArray(Item->GetLongArray());
-			}
-			else if (Item->IsLongBytesArray())
-			{
-				Instance->AddLongBytesArray(Item->GetLongBytesArray());
-			}
-			else if (Item->IsFloatArray())
-			{
-				Instance->AddFloatArray(Item->GetFloatArray());
-			}
-			else if (Item->IsDoubleArray())
-			{
-				Instance->AddDoubleArray(Item->GetDoubleArray());
-			}
-			else if (Item->IsDoubleBytesArray())
-			{
-				Instance->AddDoubleBytesArray(Item->GetDoubleBytesArray());
-			}
-			else if (Item->IsBooleanArray())
-			{
-				Instance->AddBooleanArray(Item->GetBooleanArray());
-			}
-			else if (Item->IsStringUtf8Array())
-			{
-				Instance->AddStringUtf8Array(Item->GetStringUtf8Array());
-			}
+	for (ULowEntryByteDataEntry* Item : Array)
+	{
+		if (Item != nullptr)
+		{
+			Item->WriteTo(Instance->Writer);
 		}
 	}
 	return Instance;
@@ -124,258 +37,117 @@ ULowEntryByteDataWriter* ULowEntryByteDataWriter::CreateFromEntryArray(const TAr
 
 void ULowEntryByteDataWriter::AddRawByte(const uint8 Value)
 {
-	Bytes.Add(Value);
+	Writer.WriteRawByte(Value);
 }
 
 void ULowEntryByteDataWriter::AddRawBytes(const TArray<uint8>& Value)
 {
-	Bytes.Append(Value);
+	Writer.WriteRawBytes(Value);
 }
 
 
 TArray<uint8> ULowEntryByteDataWriter::GetBytes()
 {
-	return Bytes;
+	return Writer.GetBytes();
 }
 
 
 void ULowEntryByteDataWriter::AddByte(const uint8 Value)
 {
-	AddRawByte(Value);
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddInteger(const int32 Value)
 {
-	AddRawByte(Value >> 24);
-	AddRawByte(Value >> 16);
-	AddRawByte(Value >> 8);
-	AddRawByte(Value);
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddUinteger(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-	}
-	else if (Value < 128)
-	{
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.WriteUinteger(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger1(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-	}
-	else if (Value < 128)
-	{
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.WritePositiveInteger1(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger2(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-		AddRawByte(0);
-	}
-	else if (Value < 32768)
-	{
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.WritePositiveInteger2(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger3(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-		AddRawByte(0);
-		AddRawByte(0);
-	}
-	else if (Value < 8388608)
-	{
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.WritePositiveInteger3(Value);
 }
 void ULowEntryByteDataWriter::AddLong(const int64 Value)
 {
-	AddRawByte(Value >> 56);
-	AddRawByte(Value >> 48);
-	AddRawByte(Value >> 40);
-	AddRawByte(Value >> 32);
-	AddRawByte(Value >> 24);
-	AddRawByte(Value >> 16);
-	AddRawByte(Value >> 8);
-	AddRawByte(Value);
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddLongBytes(ULowEntryLong* Value)
 {
 	if (Value != nullptr)
 	{
-		AddRawBytes(Value->Bytes);
+		Writer.WriteRawBytes(Value->Bytes);
 	}
 	else
 	{
-		AddRawBytes(ULowEntryLong::GetDefaultBytes());
+		Writer.WriteRawBytes(ULowEntryLong::GetDefaultBytes());
 	}
 }
 void ULowEntryByteDataWriter::AddFloat(const float Value)
 {
-	AddRawBytes(ULowEntryExtendedStandardLibrary::FloatToBytes(Value));
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddDouble(const double Value)
 {
-	AddRawBytes(ULowEntryExtendedStandardLibrary::DoubleToBytes(Value));
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddDoubleBytes(ULowEntryDouble* Value)
 {
 	if (Value != nullptr)
 	{
-		AddRawBytes(Value->Bytes);
+		Writer.WriteRawBytes(Value->Bytes);
 	}
 	else
 	{
-		AddRawBytes(ULowEntryDouble::GetDefaultBytes());
+		Writer.WriteRawBytes(ULowEntryDouble::GetDefaultBytes());
 	}
 }
 void ULowEntryByteDataWriter::AddBoolean(const bool Value)
 {
-	if (Value)
-	{
-		AddRawByte(0x01);
-	}
-	else
-	{
-		AddRawByte(0x00);
-	}
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddStringUtf8(const FString& Value)
 {
-	AddByteArray(ULowEntryExtendedStandardLibrary::StringToBytesUtf8(Value));
+	Writer.Write(Value);
 }
 
 
 void ULowEntryByteDataWriter::AddByteArray(const TArray<uint8>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	AddRawBytes(Value);
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddIntegerArray(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddInteger(V);
-	}
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger1Array(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddPositiveInteger1(V);
-	}
+	Writer.WritePositiveInteger1Array(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger2Array(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddPositiveInteger2(V);
-	}
+	Writer.WritePositiveInteger2Array(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger3Array(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddPositiveInteger3(V);
-	}
+	Writer.WritePositiveInteger3Array(Value);
 }
 void ULowEntryByteDataWriter::AddLongArray(const TArray<int64>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int64 V : Value)
-	{
-		AddLong(V);
-	}
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddLongBytesArray(const TArray<ULowEntryLong*>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
+	Writer.Reserve(ULowEntryByteDataNativeWriter::GetUintegerSize(Value.Num()) + (static_cast<int64>(Value.Num()) * 8));
+	Writer.WriteUinteger(Value.Num());
 	for (ULowEntryLong* V : Value)
 	{
 		AddLongBytes(V);
@@ -383,41 +155,16 @@ void ULowEntryByteDataWriter::AddLongBytesArray(const TArray<ULowEntryLong*>& Va
 }
 void ULowEntryByteDataWriter::AddFloatArray(const TArray<float>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (float V : Value)
-	{
-		AddFloat(V);
-	}
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddDoubleArray(const TArray<double>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (double V : Value)
-	{
-		AddDouble(V);
-	}
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddDoubleBytesArray(const TArray<ULowEntryDouble*>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
+	Writer.Reserve(ULowEntryByteDataNativeWriter::GetUintegerSize(Value.Num()) + (static_cast<int64>(Value.Num()) * 8));
+	Writer.WriteUinteger(Value.Num());
 	for (ULowEntryDouble* V : Value)
 	{
 		AddDoubleBytes(V);
@@ -425,45 +172,9 @@ void ULowEntryByteDataWriter::AddDoubleBytesArray(const TArray<ULowEntryDouble*>
 }
 void ULowEntryByteDataWriter::AddBooleanArray(const TArray<bool>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	uint8 B = 0;
-	int32 BIndex = 0;
-	for (bool V : Value)
-	{
-		if (V)
-		{
-			B |= (1 << (7 - BIndex));
-		}
-		BIndex++;
-		if (BIndex == 8)
-		{
-			AddRawByte(B);
-			B = 0;
-			BIndex = 0;
-		}
-	}
-	if (BIndex > 0)
-	{
-		AddRawByte(B);
-	}
+	Writer.Write(Value);
 }
 void ULowEntryByteDataWriter::AddStringUtf8Array(const TArray<FString>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (const FString& V : Value)
-	{
-		AddStringUtf8(V);
-	}
+	Writer.Write(Value);
 }
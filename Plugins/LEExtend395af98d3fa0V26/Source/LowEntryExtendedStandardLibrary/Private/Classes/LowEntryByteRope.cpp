@@ -0,0 +1,85 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryByteRope.h"
+
+
+void ULowEntryByteRope::Append(const ULowEntryByteSlice& Bytes)
+{
+	if (Bytes.IsEmpty())
+	{
+		return;
+	}
+	checkf(Bytes.Num() <= (MAX_int32 - Length), TEXT("ULowEntryByteRope can't hold more than MAX_int32 bytes"));
+	Segments.Add(Bytes);
+	Length += Bytes.Num();
+}
+
+void ULowEntryByteRope::Append(TArray<uint8>&& Bytes)
+{
+	if (Bytes.Num() <= 0)
+	{
+		return;
+	}
+	Append(ULowEntryByteSlice(MoveTemp(Bytes)));
+}
+
+void ULowEntryByteRope::Append(const TArray<uint8>& Bytes, int32 Index, int32 BytesLength)
+{
+	Append(ULowEntryByteSlice(Bytes, Index, BytesLength));
+}
+
+void ULowEntryByteRope::Append(const ULowEntryByteRope& Rope)
+{
+	if (&Rope == this)
+	{
+		const TArray<ULowEntryByteSlice> Copy = Segments;
+		for (const ULowEntryByteSlice& Segment : Copy)
+		{
+			Append(Segment);
+		}
+		return;
+	}
+	Segments.Reserve(Segments.Num() + Rope.Segments.Num());
+	for (const ULowEntryByteSlice& Segment : Rope.Segments)
+	{
+		Append(Segment);
+	}
+}
+
+
+void ULowEntryByteRope::Reset()
+{
+	Segments.Reset();
+	Length = 0;
+}
+
+
+TArray<uint8> ULowEntryByteRope::Flatten() const
+{
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(Length);
+	FlattenTo(Bytes.GetData());
+	return Bytes;
+}
+
+void ULowEntryByteRope::FlattenTo(uint8* Destination) const
+{
+	for (const ULowEntryByteSlice& Segment : Segments)
+	{
+		FMemory::Memcpy(Destination, Segment.GetData(), Segment.Num());
+		Destination += Segment.Num();
+	}
+}
+
+ULowEntryByteSlice ULowEntryByteRope::FlattenToSlice() const
+{
+	if (Segments.Num() == 1)
+	{
+		return Segments[0];
+	}
+	if (Segments.Num() <= 0)
+	{
+		return ULowEntryByteSlice();
+	}
+	return ULowEntryByteSlice(Flatten());
+}
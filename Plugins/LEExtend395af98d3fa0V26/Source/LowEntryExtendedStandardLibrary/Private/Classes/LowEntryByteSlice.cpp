@@ -0,0 +1,91 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryByteSlice.h"
+
+
+namespace
+{
+	// Shared by every empty slice, so creating one doesn't allocate
+	const ULowEntryByteSlice::FBuffer& GetEmptyBuffer()
+	{
+		static const ULowEntryByteSlice::FBuffer EmptyBuffer = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+		return EmptyBuffer;
+	}
+
+	// Clamps Index and Length to an array of the given size, like BytesSubArray does
+	void ClampRange(const int32 Size, int32& Index, int32& Length)
+	{
+		if (Index < 0)
+		{
+			Length += Index;
+			Index = 0;
+		}
+		if (Index > Size)
+		{
+			Index = Size;
+		}
+		if (Length > Size - Index)
+		{
+			Length = Size - Index;
+		}
+		if (Length < 0)
+		{
+			Length = 0;
+		}
+	}
+}
+
+
+ULowEntryByteSlice::ULowEntryByteSlice() : Buffer(GetEmptyBuffer()) {}
+
+ULowEntryByteSlice::ULowEntryByteSlice(TArray<uint8>&& Bytes) : Buffer(MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(Bytes)))
+{
+	Length = Buffer->Num();
+}
+
+ULowEntryByteSlice::ULowEntryByteSlice(const TArray<uint8>& Bytes, int32 Index, int32 Length0) : Buffer(GetEmptyBuffer())
+{
+	ClampRange(Bytes.Num(), Index, Length0);
+	if (Length0 > 0)
+	{
+		Buffer = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(Bytes.GetData() + Index, Length0);
+		Length = Length0;
+	}
+}
+
+ULowEntryByteSlice::ULowEntryByteSlice(const FBuffer& Buffer0, int32 Index, int32 Length0) : Buffer(Buffer0)
+{
+	ClampRange(Buffer->Num(), Index, Length0);
+	Offset = Index;
+	Length = Length0;
+}
+
+
+ULowEntryByteSlice ULowEntryByteSlice::Slice(int32 Index, int32 Length0) const
+{
+	ClampRange(Length, Index, Length0);
+	ULowEntryByteSlice Result = *this;
+	Result.Offset = Offset + Index;
+	Result.Length = Length0;
+	return Result;
+}
+
+void ULowEntryByteSlice::Split(const int32 LengthA, ULowEntryByteSlice& A, ULowEntryByteSlice& B) const
+{
+	const int32 SplitAt = FMath::Clamp(LengthA, 0, Length);
+	ULowEntryByteSlice Whole = *this; // A or B could be this slice
+	A = Whole.Slice(0, SplitAt);
+	B = Whole.Slice(SplitAt);
+}
+
+void ULowEntryByteSlice::ToBufferRange(int32& Index, int32& Length0) const
+{
+	ClampRange(Length, Index, Length0);
+	Index += Offset;
+}
+
+
+TArray<uint8> ULowEntryByteSlice::ToArray() const
+{
+	return TArray<uint8>(GetData(), Length);
+}
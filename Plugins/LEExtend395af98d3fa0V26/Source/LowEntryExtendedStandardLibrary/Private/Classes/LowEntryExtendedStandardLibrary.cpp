@@ -7,6 +7,13 @@
 #include "LowEntryHashingSha512Library.h"
 #include "LowEntryHashingPearsonLibrary.h"
 #include "LowEntryHashingHashcashLibrary.h"
+#include "LowEntryHashContext.h"
+#include "LowEntryHashFileTask.h"
+#include "LowEntryHashcashTask.h"
+#include "LowEntryBCryptTask.h"
+#include "LowEntryBCryptVerifyTask.h"
+#include "LowEntryHashingHmacContext.h"
+#include "LowEntryHmacContext.h"
 
 #include "LowEntryLatentActionBoolean.h"
 #include "LowEntryLatentActionFloat.h"
@@ -689,7 +696,7 @@ void ULowEntryExtendedStandardLibrary::SplitBytes(const TArray<uint8>& ByteArray
 	B.Append(ByteArray.GetData() + LengthA, ByteArray.Num() - LengthA);
 }
 
-TArray<uint8> ULowEntryExtendedStandardLibrary::MergeBytes(TArray<uint8> A, TArray<uint8> B)
+TArray<uint8> ULowEntryExtendedStandardLibrary::MergeBytes(const TArray<uint8>& A, const TArray<uint8>& B)
 {
 	if (A.Num() <= 0)
 	{
@@ -2237,11 +2244,59 @@ TArray<uint8> ULowEntryExtendedStandardLibrary::Sha512(const TArray<uint8>& Byte
 	return ULowEntryHashingSha512Library::Hash(ByteArray, Index, Length);
 }
 
+TArray<uint8> ULowEntryExtendedStandardLibrary::Sha256Batch(const TArray<ULowEntryByteArray*>& ByteArrays)
+{
+	return ULowEntryHashingSha256Library::HashBatch(ByteArraysToViews(ByteArrays));
+}
+
+TArray<uint8> ULowEntryExtendedStandardLibrary::Sha512Batch(const TArray<ULowEntryByteArray*>& ByteArrays)
+{
+	return ULowEntryHashingSha512Library::HashBatch(ByteArraysToViews(ByteArrays));
+}
+
+TArray<TArrayView<const uint8>> ULowEntryExtendedStandardLibrary::ByteArraysToViews(const TArray<ULowEntryByteArray*>& ByteArrays)
+{
+	TArray<TArrayView<const uint8>> Views;
+	Views.Reserve(ByteArrays.Num());
+	for (const ULowEntryByteArray* ByteArray : ByteArrays)
+	{
+		// Null entries hash like empty byte arrays, so every entry keeps its place in the result
+		Views.Add((ByteArray != nullptr) ? TArrayView<const uint8>(ByteArray->ByteArray) : TArrayView<const uint8>());
+	}
+	return Views;
+}
+
 TArray<uint8> ULowEntryExtendedStandardLibrary::BCrypt(const TArray<uint8>& ByteArray, const TArray<uint8>& Salt, int32 Strength, int32 Index, int32 Length)
 {
 	return ULowEntryHashingBCryptLibrary::Hash(BytesSubArray(ByteArray, Index, Length), Salt, Strength);
 }
 
+ULowEntryBCryptTask* ULowEntryExtendedStandardLibrary::BCryptAsync(const TArray<uint8>& ByteArray, const TArray<uint8>& Salt, int32 Strength, int32 Index, int32 Length)
+{
+	return ULowEntryBCryptTask::Create(BytesSubArray(ByteArray, Index, Length), Salt, Strength);
+}
+
+TArray<bool> ULowEntryExtendedStandardLibrary::BCryptVerifyBatch(const TArray<ULowEntryByteArray*>& Passwords, const TArray<ULowEntryByteArray*>& Salts, const TArray<ULowEntryByteArray*>& Hashes, int32 Strength)
+{
+	return ULowEntryHashingBCryptLibrary::VerifyBatch(ByteArraysToViews(Passwords), ByteArraysToViews(Salts), ByteArraysToViews(Hashes), Strength);
+}
+
+ULowEntryBCryptVerifyTask* ULowEntryExtendedStandardLibrary::BCryptVerifyBatchAsync(const TArray<ULowEntryByteArray*>& Passwords, const TArray<ULowEntryByteArray*>& Salts, const TArray<ULowEntryByteArray*>& Hashes, int32 Strength)
+{
+	// Copied, so the byte arrays can be changed or garbage collected while the task runs
+	auto Copy = [](const TArray<ULowEntryByteArray*>& ByteArrays)
+	{
+		TArray<TArray<uint8>> Arrays;
+		Arrays.Reserve(ByteArrays.Num());
+		for (const ULowEntryByteArray* ByteArray : ByteArrays)
+		{
+			Arrays.Add((ByteArray != nullptr) ? ByteArray->ByteArray : TArray<uint8>());
+		}
+		return Arrays;
+	};
+	return ULowEntryBCryptVerifyTask::Create(Copy(Passwords), Copy(Salts), Copy(Hashes), Strength);
+}
+
 
 TArray<uint8> ULowEntryExtendedStandardLibrary::HMAC(const TArray<uint8>& ByteArray, const TArray<uint8>& Key, ELowEntryHmacAlgorithm Algorithm, int32 Index, int32 Length)
 {
@@ -2255,69 +2310,35 @@ TArray<uint8> ULowEntryExtendedStandardLibrary::HMAC(const TArray<uint8>& ByteAr
 		Length = ByteArray.Num() - Index;
 	}
 
-	int32 BlockSize = HMAC_GetBlockSize(Algorithm);
-
-	TArray<uint8> KeyBytes = Key;
-	if (KeyBytes.Num() > BlockSize)
-	{
-		KeyBytes = HMAC_Hash(KeyBytes, Algorithm);// key = hash(key)
-	}
-	if (KeyBytes.Num() != BlockSize)
-	{
-		KeyBytes.SetNumZeroed(BlockSize);// key = key + 0x00 (till KeyBytes has BlockSize length)
-	}
-
-	TArray<uint8> ArrayO = KeyBytes;
-	TArray<uint8> ArrayI = KeyBytes;
-	for (int32 i = 0; i < KeyBytes.Num(); i++)
-	{
-		ArrayO[i] ^= 0x5c;// o_key_pad = 0x5c ^ key
-		ArrayI[i] ^= 0x36;// i_key_pad = 0x36 ^ key
-	}
-
-	if (Length > 0)// (i_key_pad + message)
-	{
-		ArrayI.Append(ByteArray.GetData() + Index, Length);
-	}
-	ArrayI = HMAC_Hash(ArrayI, Algorithm);// hash(i_key_pad + message)
-	ArrayO.Append(ArrayI.GetData(), ArrayI.Num());// (o_key_pad + hash(i_key_pad + message))
-	return HMAC_Hash(ArrayO, Algorithm);// hash(o_key_pad + hash(i_key_pad + message))
-}
-
-int32 ULowEntryExtendedStandardLibrary::HMAC_GetBlockSize(ELowEntryHmacAlgorithm Algorithm)
-{
 	switch (Algorithm)
 	{
 	case ELowEntryHmacAlgorithm::MD5:
-		return 64;
 	case ELowEntryHmacAlgorithm::SHA1:
-		return 64;
 	case ELowEntryHmacAlgorithm::SHA256:
-		return 64;
 	case ELowEntryHmacAlgorithm::SHA512:
-		return 128;
+		break;
 	default:
 		UE_LOG(LogBlueprintUserMessages, Error, TEXT("Unsupported HMAC Algorithm, falls back to SHA-256"));
-		return 64;// defaults to SHA-256
 	}
+
+	const ULowEntryHashingHmacContext Context(Algorithm, Key);
+	return Context.Sign((Length > 0) ? TConstArrayView<uint8>(ByteArray.GetData() + Index, Length) : TConstArrayView<uint8>());
 }
 
-TArray<uint8> ULowEntryExtendedStandardLibrary::HMAC_Hash(const TArray<uint8>& Array, ELowEntryHmacAlgorithm Algorithm)
+ULowEntryHmacContext* ULowEntryExtendedStandardLibrary::HmacContext_Create(const TArray<uint8>& Key, ELowEntryHmacAlgorithm Algorithm)
 {
-	switch (Algorithm)
-	{
-	case ELowEntryHmacAlgorithm::MD5:
-		return Md5(Array);
-	case ELowEntryHmacAlgorithm::SHA1:
-		return Sha1(Array);
-	case ELowEntryHmacAlgorithm::SHA256:
-		return Sha256(Array);
-	case ELowEntryHmacAlgorithm::SHA512:
-		return Sha512(Array);
-	default:
-		UE_LOG(LogBlueprintUserMessages, Error, TEXT("Unsupported HMAC Algorithm, falls back to SHA-256"));
-		return Sha256(Array);// defaults to SHA-256
-	}
+	return ULowEntryHmacContext::Create(Key, Algorithm);
+}
+
+
+ULowEntryHashContext* ULowEntryExtendedStandardLibrary::HashContext_Create(const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength)
+{
+	return ULowEntryHashContext::Create(Algorithm, PearsonHashLength);
+}
+
+ULowEntryHashFileTask* ULowEntryExtendedStandardLibrary::HashFile_Start(const FString& FilePath, const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength, const bool MemoryMapped, const int32 BlockSize)
+{
+	return ULowEntryHashFileTask::Create(FilePath, Algorithm, PearsonHashLength, MemoryMapped, BlockSize);
 }
 
 
@@ -2341,6 +2362,16 @@ FString ULowEntryExtendedStandardLibrary::HashcashCustomCreationDate(const FStri
 	return ULowEntryHashingHashcashLibrary::hashCustomCreationDate(Resource, UtcDate, Bits);
 }
 
+ULowEntryHashcashTask* ULowEntryExtendedStandardLibrary::HashcashAsync(const FString& Resource, const int32 Bits, const double TimeoutSeconds, const int32 Threads)
+{
+	return ULowEntryHashcashTask::Create(Resource, FDateTime::UtcNow(), Bits, TimeoutSeconds, Threads);
+}
+
+ULowEntryHashcashTask* ULowEntryExtendedStandardLibrary::HashcashAsyncCustomCreationDate(const FString& Resource, const FDateTime& UtcDate, const int32 Bits, const double TimeoutSeconds, const int32 Threads)
+{
+	return ULowEntryHashcashTask::Create(Resource, UtcDate, Bits, TimeoutSeconds, Threads);
+}
+
 
 TArray<ULowEntryParsedHashcash*> ULowEntryExtendedStandardLibrary::HashcashParseArray(const TArray<FString>& Hashes)
 {
@@ -0,0 +1,39 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHashContext.h"
+
+
+ULowEntryHashContext::ULowEntryHashContext(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntryHashContext* ULowEntryHashContext::Create(const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength)
+{
+	ULowEntryHashContext* Instance = NewObject<ULowEntryHashContext>();
+	Instance->Init(Algorithm, PearsonHashLength);
+	return Instance;
+}
+
+
+void ULowEntryHashContext::Init(const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength)
+{
+	Context.Init(Algorithm, PearsonHashLength);
+}
+
+void ULowEntryHashContext::Update(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+{
+	Context.Update(ByteArray, Index, Length);
+}
+
+void ULowEntryHashContext::UpdateRaw(const uint8* Bytes, const int64 Length)
+{
+	Context.Update(Bytes, Length);
+}
+
+TArray<uint8> ULowEntryHashContext::Final()
+{
+	return Context.Final();
+}
+
+ELowEntryHashAlgorithm ULowEntryHashContext::GetAlgorithm()
+{
+	return Context.GetAlgorithm();
+}
@@ -0,0 +1,114 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHashFileTask.h"
+#include "FLowEntryHashFileTask.h"
+#include "LowEntryHashingContext.h"
+
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+
+
+ULowEntryHashFileTask::ULowEntryHashFileTask(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	KeepAliveCount = 1;
+	AddToRoot();
+}
+
+ULowEntryHashFileTask* ULowEntryHashFileTask::Create(const FString& FilePath, const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength, const bool bMemoryMapped, const int32 BlockSize)
+{
+	ULowEntryHashFileTask* Instance = NewObject<ULowEntryHashFileTask>();
+
+	// The instance stays rooted till Done runs, so the worker can safely hold on to it
+	Async(EAsyncExecution::ThreadPool, [Instance, FilePath, Algorithm, PearsonHashLength, bMemoryMapped, BlockSize]()
+	{
+		TArray<uint8> Hash;
+		const bool bSuccess = ULowEntryHashingContext::HashFile(FilePath, Algorithm, PearsonHashLength, Hash, bMemoryMapped, BlockSize, [Instance](const int64 BytesDone, const int64 BytesTotal)
+		{
+			Instance->BytesTotal = BytesTotal;
+			Instance->BytesDone = BytesDone;
+			return !Instance->CancelRequested;
+		});
+
+		AsyncTask(ENamedThreads::GameThread, [Instance, bSuccess, Hash = MoveTemp(Hash)]()
+		{
+			Instance->Done(bSuccess, Hash);
+		});
+	});
+
+	return Instance;
+}
+
+
+void ULowEntryHashFileTask::WaitTillDone(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool& Success_, TArray<uint8>& Hash)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (World == nullptr)
+	{
+		return;
+	}
+	if (World->GetLatentActionManager().FindExistingAction<FLowEntryHashFileTask>(LatentInfo.CallbackTarget, LatentInfo.UUID) != nullptr)
+	{
+		return;
+	}
+	World->GetLatentActionManager().AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryHashFileTask(LatentInfo, this, Success_, Hash));
+
+	KeepAliveCount++;
+	if (KeepAliveCount == 1)
+	{
+		AddToRoot();
+	}
+}
+
+void ULowEntryHashFileTask::LatentActionDone()
+{
+	KeepAliveCount--;
+	if (KeepAliveCount == 0)
+	{
+		RemoveFromRoot();
+	}
+	if (KeepAliveCount < 0)
+	{
+		KeepAliveCount = 0;
+	}
+}
+
+void ULowEntryHashFileTask::Done(const bool Success_, const TArray<uint8>& Hash)
+{
+	if (!Finished)
+	{
+		Success = Success_;
+		Result = Hash;
+		LatentActionDone(); // used to reduce KeepAliveCount by 1
+		Finished = true;
+	}
+}
+
+void ULowEntryHashFileTask::Cancel()
+{
+	CancelRequested = true;
+}
+
+bool ULowEntryHashFileTask::IsDone()
+{
+	return Finished;
+}
+
+double ULowEntryHashFileTask::GetProgress()
+{
+	if (Finished)
+	{
+		return 1;
+	}
+	const int64 Total = BytesTotal;
+	if (Total <= 0)
+	{
+		return 0;
+	}
+	return static_cast<double>(BytesDone) / static_cast<double>(Total);
+}
+
+void ULowEntryHashFileTask::GetResult(bool& Success_, TArray<uint8>& Hash)
+{
+	Success_ = Success;
+	Hash = Result;
+}
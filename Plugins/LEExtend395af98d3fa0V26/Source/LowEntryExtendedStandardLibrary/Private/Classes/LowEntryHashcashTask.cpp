@@ -0,0 +1,104 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHashcashTask.h"
+#include "FLowEntryHashcashTask.h"
+
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+
+
+ULowEntryHashcashTask::ULowEntryHashcashTask(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	KeepAliveCount = 1;
+	AddToRoot();
+}
+
+ULowEntryHashcashTask* ULowEntryHashcashTask::Create(const FString& Resource, const FDateTime& UtcDate, const int32 Bits, const double TimeoutSeconds, const int32 Threads)
+{
+	ULowEntryHashcashTask* Instance = NewObject<ULowEntryHashcashTask>();
+
+	// The instance stays rooted till Done runs, which is after the last worker has stopped
+	Instance->Mint = ULowEntryHashingHashcashLibrary::hashAsync(Resource, UtcDate, Bits, Threads, TimeoutSeconds, [Instance](const FString& Hash)
+	{
+		AsyncTask(ENamedThreads::GameThread, [Instance, Hash]()
+		{
+			Instance->Done(Hash);
+		});
+	});
+
+	return Instance;
+}
+
+
+void ULowEntryHashcashTask::WaitTillDone(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool& Success_, FString& Hash)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (World == nullptr)
+	{
+		return;
+	}
+	if (World->GetLatentActionManager().FindExistingAction<FLowEntryHashcashTask>(LatentInfo.CallbackTarget, LatentInfo.UUID) != nullptr)
+	{
+		return;
+	}
+	World->GetLatentActionManager().AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryHashcashTask(LatentInfo, this, Success_, Hash));
+
+	KeepAliveCount++;
+	if (KeepAliveCount == 1)
+	{
+		AddToRoot();
+	}
+}
+
+void ULowEntryHashcashTask::LatentActionDone()
+{
+	KeepAliveCount--;
+	if (KeepAliveCount == 0)
+	{
+		RemoveFromRoot();
+	}
+	if (KeepAliveCount < 0)
+	{
+		KeepAliveCount = 0;
+	}
+}
+
+void ULowEntryHashcashTask::Done(const FString& Hash)
+{
+	if (!Finished)
+	{
+		Success = !Hash.IsEmpty();
+		Result = Hash;
+		LatentActionDone(); // used to reduce KeepAliveCount by 1
+		Finished = true;
+	}
+}
+
+void ULowEntryHashcashTask::Cancel()
+{
+	if (Mint.IsValid())
+	{
+		Mint->Cancel();
+	}
+}
+
+bool ULowEntryHashcashTask::IsDone()
+{
+	return Finished;
+}
+
+bool ULowEntryHashcashTask::IsTimedOut()
+{
+	return Mint.IsValid() && Mint->TimedOut;
+}
+
+double ULowEntryHashcashTask::GetHashesPerSecond()
+{
+	return Mint.IsValid() ? Mint->GetHashesPerSecond() : 0;
+}
+
+void ULowEntryHashcashTask::GetResult(bool& Success_, FString& Hash)
+{
+	Success_ = Success;
+	Hash = Result;
+}
@@ -0,0 +1,91 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/OutputDevice.h"
+#include "LowEntryHashingBCryptLibrary.h"
+
+
+namespace
+{
+	void RunBCryptBenchmark(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const int32 Strength = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 4, 16) : 10;
+		const int32 Count = (Args.Num() > 1) ? FMath::Clamp(FCString::Atoi(*Args[1]), 1, 100000) : FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads()) * 4;
+
+		// Every other entry gets a hash of a different password, so both outcomes are measured
+		FRandomStream Random(0xBC);
+		TArray<TArray<uint8>> Passwords;
+		TArray<TArray<uint8>> Salts;
+		TArray<TArray<uint8>> Hashes;
+		for (int32 i = 0; i < Count; i++)
+		{
+			TArray<uint8>& Password = Passwords.AddDefaulted_GetRef();
+			Password.SetNumUninitialized(8 + Random.RandHelper(24));
+			for (uint8& Byte : Password)
+			{
+				Byte = static_cast<uint8>(Random.RandHelper(256));
+			}
+			TArray<uint8>& Salt = Salts.AddDefaulted_GetRef();
+			Salt.SetNumUninitialized(16);
+			for (uint8& Byte : Salt)
+			{
+				Byte = static_cast<uint8>(Random.RandHelper(256));
+			}
+		}
+		TArray<TArrayView<const uint8>> PasswordViews;
+		TArray<TArrayView<const uint8>> SaltViews;
+		for (int32 i = 0; i < Count; i++)
+		{
+			PasswordViews.Add(Passwords[i]);
+			SaltViews.Add(Salts[i]);
+		}
+
+		Ar.Logf(TEXT("LowEntry BCrypt benchmark, strength %d, %d hashes"), Strength, Count);
+
+		const double SingleStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Count; i++)
+		{
+			TArray<uint8> Hash = ULowEntryHashingBCryptLibrary::Hash(PasswordViews[i], SaltViews[i], Strength);
+			if ((i % 2) == 1)
+			{
+				Hash[0] ^= 1;
+			}
+			Hashes.Add(MoveTemp(Hash));
+		}
+		const double SingleSeconds = FPlatformTime::Seconds() - SingleStart;
+
+		TArray<TArrayView<const uint8>> HashViews;
+		for (const TArray<uint8>& Hash : Hashes)
+		{
+			HashViews.Add(Hash);
+		}
+
+		const double BatchStart = FPlatformTime::Seconds();
+		const TArray<bool> Matches = ULowEntryHashingBCryptLibrary::VerifyBatch(PasswordViews, SaltViews, HashViews, Strength);
+		const double BatchSeconds = FPlatformTime::Seconds() - BatchStart;
+
+		bool bCorrect = (Matches.Num() == Count);
+		for (int32 i = 0; bCorrect && (i < Count); i++)
+		{
+			bCorrect = (Matches[i] == ((i % 2) == 0));
+		}
+
+		Ar.Logf(TEXT("  %-14s %8.1f hashes/s, %.1f ms per hash"), TEXT("Calling thread"), Count / SingleSeconds, (SingleSeconds * 1000) / Count);
+		Ar.Logf(TEXT("  %-14s %8.1f hashes/s, %.2fx, results %s"), TEXT("Verify batch"), Count / BatchSeconds, SingleSeconds / BatchSeconds, bCorrect ? TEXT("are correct") : TEXT("ARE WRONG"));
+	}
+
+	FAutoConsoleCommand BCryptBenchmarkCommand(
+		TEXT("LowEntry.BCryptBenchmark"),
+		TEXT("Compares generating BCrypt hashes one by one on the calling thread with verifying them with the batch API, which spreads them over all cores. Optional arguments: strength (default 10) and number of hashes (default 4 per core)."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&RunBCryptBenchmark)
+	);
+}
+
+#endif
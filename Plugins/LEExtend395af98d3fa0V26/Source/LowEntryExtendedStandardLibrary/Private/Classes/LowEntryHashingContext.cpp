@@ -0,0 +1,186 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHashingContext.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Async/MappedFileHandle.h"
+
+
+ULowEntryHashingContext::ULowEntryHashingContext()
+{
+	Init(ELowEntryHashAlgorithm::SHA256);
+}
+
+ULowEntryHashingContext::ULowEntryHashingContext(const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength)
+{
+	Init(Algorithm, PearsonHashLength);
+}
+
+
+void ULowEntryHashingContext::Init(const ELowEntryHashAlgorithm Algorithm_, const int32 PearsonHashLength)
+{
+	Algorithm = Algorithm_;
+	Length = 0;
+
+	switch (Algorithm)
+	{
+	case ELowEntryHashAlgorithm::MD5:
+		Md5 = FMD5();
+		break;
+	case ELowEntryHashAlgorithm::SHA1:
+		Sha1.Reset();
+		break;
+	case ELowEntryHashAlgorithm::SHA256:
+		Sha256.Init();
+		break;
+	case ELowEntryHashAlgorithm::SHA512:
+		Sha512.Init();
+		break;
+	case ELowEntryHashAlgorithm::Pearson:
+		Pearson.Init(PearsonHashLength);
+		break;
+	}
+}
+
+void ULowEntryHashingContext::Update(const uint8* Bytes, const int64 BytesLength)
+{
+	if (BytesLength <= 0)
+	{
+		return;
+	}
+	Length += BytesLength;
+
+	switch (Algorithm)
+	{
+	case ELowEntryHashAlgorithm::MD5:
+		Md5.Update(Bytes, BytesLength);
+		break;
+	case ELowEntryHashAlgorithm::SHA1:
+		Sha1.Update(Bytes, BytesLength);
+		break;
+	case ELowEntryHashAlgorithm::SHA256:
+		Sha256.Update(Bytes, BytesLength);
+		break;
+	case ELowEntryHashAlgorithm::SHA512:
+		Sha512.Update(Bytes, BytesLength);
+		break;
+	case ELowEntryHashAlgorithm::Pearson:
+		Pearson.Update(Bytes, BytesLength);
+		break;
+	}
+}
+
+void ULowEntryHashingContext::Update(const TArray<uint8>& Bytes, int32 Index, int32 BytesLength)
+{
+	if (Index < 0)
+	{
+		BytesLength += Index;
+		Index = 0;
+	}
+	if (BytesLength > (Bytes.Num() - Index))
+	{
+		BytesLength = Bytes.Num() - Index;
+	}
+	if (BytesLength <= 0)
+	{
+		return;
+	}
+	Update(Bytes.GetData() + Index, BytesLength);
+}
+
+TArray<uint8> ULowEntryHashingContext::Final()
+{
+	TArray<uint8> Result;
+	switch (Algorithm)
+	{
+	case ELowEntryHashAlgorithm::MD5:
+		Result.SetNumUninitialized(16);
+		Md5.Final(Result.GetData());
+		break;
+	case ELowEntryHashAlgorithm::SHA1:
+		Result.SetNumUninitialized(FSHA1::DigestSize);
+		Sha1.Final();
+		Sha1.GetHash(Result.GetData());
+		break;
+	case ELowEntryHashAlgorithm::SHA256:
+		Result = Sha256.Final();
+		break;
+	case ELowEntryHashAlgorithm::SHA512:
+		Result = Sha512.Final();
+		break;
+	case ELowEntryHashAlgorithm::Pearson:
+		Result = Pearson.Final();
+		break;
+	}
+	return Result;
+}
+
+
+bool ULowEntryHashingContext::HashFile(const FString& FilePath, const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength, TArray<uint8>& OutHash, const bool bMemoryMapped, const int32 BlockSize)
+{
+	return HashFile(FilePath, Algorithm, PearsonHashLength, OutHash, bMemoryMapped, BlockSize, [](const int64 BytesDone, const int64 BytesTotal)
+	{
+		return true;
+	});
+}
+
+bool ULowEntryHashingContext::HashFile(const FString& FilePath, const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength, TArray<uint8>& OutHash, const bool bMemoryMapped, const int32 BlockSize, TFunctionRef<bool(const int64 BytesDone, const int64 BytesTotal)> OnProgress)
+{
+	OutHash.Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const int64 ChunkSize = FMath::Max(BlockSize, 4096);
+	ULowEntryHashingContext Context(Algorithm, PearsonHashLength);
+
+	if (bMemoryMapped)
+	{
+		FOpenMappedResult Mapped = PlatformFile.OpenMappedEx(*FilePath);
+		if (!Mapped.HasError())
+		{
+			TUniquePtr<IMappedFileHandle> Handle = Mapped.StealValue();
+			const int64 Total = Handle->GetFileSize();
+			for (int64 Offset = 0; Offset < Total; Offset += ChunkSize)
+			{
+				// One region per block, so a huge file never needs to fit in the address space at once
+				TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion(Offset, FMath::Min(ChunkSize, Total - Offset)));
+				if (!Region.IsValid())
+				{
+					return false;
+				}
+				Context.Update(Region->GetMappedPtr(), Region->GetMappedSize());
+				if (!OnProgress(Offset + Region->GetMappedSize(), Total))
+				{
+					return false;
+				}
+			}
+			OutHash = Context.Final();
+			return true;
+		}
+	}
+
+	TUniquePtr<IFileHandle> Handle(PlatformFile.OpenRead(*FilePath));
+	if (!Handle.IsValid())
+	{
+		return false;
+	}
+
+	const int64 Total = Handle->Size();
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(FMath::Min(ChunkSize, FMath::Max<int64>(Total, 1)));
+	for (int64 Offset = 0; Offset < Total; Offset += Buffer.Num())
+	{
+		const int64 ReadSize = FMath::Min<int64>(Buffer.Num(), Total - Offset);
+		if (!Handle->Read(Buffer.GetData(), ReadSize))
+		{
+			return false;
+		}
+		Context.Update(Buffer.GetData(), ReadSize);
+		if (!OnProgress(Offset + ReadSize, Total))
+		{
+			return false;
+		}
+	}
+	OutHash = Context.Final();
+	return true;
+}
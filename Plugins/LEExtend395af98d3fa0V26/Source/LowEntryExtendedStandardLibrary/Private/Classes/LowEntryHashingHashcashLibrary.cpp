@@ -2,22 +2,26 @@
 
 #include "LowEntryHashingHashcashLibrary.h"
 #include "LowEntryExtendedStandardLibrary.h"
+#include "LowEntryHashingShaKernels.h"
 
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Base64.h"
+#include "Misc/Guid.h"
+#include "Misc/ScopeLock.h"
 
-const FString ULowEntryHashingHashcashLibrary::DATE_FORMAT_STRING = TEXT("%y%m%d%H%M%S");
-
-TArray<TArray<uint8>> ULowEntryHashingHashcashLibrary::BASE_64_CACHE = TArray<TArray<uint8>>();
 
+const FString ULowEntryHashingHashcashLibrary::DATE_FORMAT_STRING = TEXT("%y%m%d%H%M%S");
 
-TArray<TArray<uint8>> ULowEntryHashingHashcashLibrary::GenerateBase64Cache()
+double ULowEntryHashingHashcashLibrary::FMint::GetHashesPerSecond() const
 {
-	TArray<TArray<uint8>> Array;
-	Array.SetNum(MAX_COUNTER);
-	for (int32 i = 0; i < Array.Num(); i++)
+	const double End = EndTime;
+	const double Elapsed = ((End > 0) ? End : FPlatformTime::Seconds()) - StartTime;
+	if (Elapsed <= 0)
 	{
-		Array[i] = base64WithoutLeadingZeroBytes(i);
+		return 0;
 	}
-	return Array;
+	return static_cast<double>(Hashes) / Elapsed;
 }
 
 
@@ -29,10 +33,10 @@ TArray<FString> ULowEntryHashingHashcashLibrary::hashArrayCustomCreationDate(con
 {
 	TArray<FString> result;
 	result.SetNum(resources.Num());
-	for (int64 i = 0; i < resources.Num(); i++)
+	ParallelFor(resources.Num(), [&result, &resources, &date, bits](const int32 i)
 	{
 		result[i] = hashCustomCreationDate(resources[i], date, bits);
-	}
+	});
 	return result;
 }
 
@@ -42,47 +46,140 @@ FString ULowEntryHashingHashcashLibrary::hash(const FString& resource, const int
 }
 FString ULowEntryHashingHashcashLibrary::hashCustomCreationDate(const FString& resource, const FDateTime& date, const int32 bits)
 {
-	FSHA1 hasher;
-	TArray<uint8> hashBuffer;
-	hashBuffer.SetNum(FSHA1::DigestSize);
+	FMint Mint;
+	Mint.StartTime = FPlatformTime::Seconds();
+	mint(resource, date, bits, Mint);
+	return Mint.Result;
+}
 
-	FString dataPrefix = FString::FromInt(VERSION) + TEXT(":") + FString::FromInt(bits) + TEXT(":") + getDateString(date) + TEXT(":") + resource + TEXT("::");
-	TArray<uint8> dataPrefixBytes = ULowEntryExtendedStandardLibrary::StringToBytesUtf8(dataPrefix);
+TSharedRef<ULowEntryHashingHashcashLibrary::FMint, ESPMode::ThreadSafe> ULowEntryHashingHashcashLibrary::hashAsync(const FString& resource, const FDateTime& date, const int32 bits, const int32 threads, const double timeoutSeconds, TFunction<void(const FString& Result)> OnDone)
+{
+	TSharedRef<FMint, ESPMode::ThreadSafe> Mint = MakeShared<FMint, ESPMode::ThreadSafe>();
+	const int32 Workers = (threads > 0) ? threads : FMath::Max(1, FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+	Mint->StartTime = FPlatformTime::Seconds();
+	Mint->Deadline = (timeoutSeconds > 0) ? (Mint->StartTime + timeoutSeconds) : 0;
+	Mint->RunningWorkers = Workers;
 
-	TArray<uint8> buffer;
-	buffer.Reserve(dataPrefixBytes.Num() + 17 + 8);
-	buffer.Append(dataPrefixBytes);
+	for (int32 i = 0; i < Workers; i++)
+	{
+		Async(EAsyncExecution::ThreadPool, [Mint, resource, date, bits, OnDone]()
+		{
+			mint(resource, date, bits, *Mint);
+
+			// The last worker to stop reports, so no worker is still touching the mint when OnDone runs
+			if (--Mint->RunningWorkers == 0)
+			{
+				Mint->EndTime = FPlatformTime::Seconds();
+				FString Result;
+				{
+					FScopeLock Lock(&Mint->ResultLock);
+					Result = Mint->Result;
+				}
+				if (OnDone)
+				{
+					OnDone(Result);
+				}
+			}
+		});
+	}
+	return Mint;
+}
 
-	int32 prefixpos = buffer.Num();
+bool ULowEntryHashingHashcashLibrary::mint(const FString& resource, const FDateTime& date, const int32 bits, FMint& Mint)
+{
+	constexpr int32 CHECK_INTERVAL = 4096;
+	constexpr uint32 INITIAL_STATE[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+	static const uint8 BASE_64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
-	while (true)
-	{
-		buffer.SetNum(prefixpos, EAllowShrinking::No);
+	const FString dataPrefix = FString::FromInt(VERSION) + TEXT(":") + FString::FromInt(bits) + TEXT(":") + getDateString(date) + TEXT(":") + resource + TEXT("::");
+	const TArray<uint8> dataPrefixBytes = ULowEntryExtendedStandardLibrary::StringToBytesUtf8(dataPrefix);
 
-		TArray<uint8> randomBytes;
-		ULowEntryExtendedStandardLibrary::GenerateRandomBytes(12, randomBytes);
-		buffer.Append(ULowEntryExtendedStandardLibrary::StringToBytesUtf8(ULowEntryExtendedStandardLibrary::BytesToBase64(randomBytes) + TEXT(":")));
+	TArray<uint8> buffer;
+	buffer.Reserve(dataPrefixBytes.Num() + 17 + 4);
 
-		if (BASE_64_CACHE.Num() <= 0)
+	while (!Mint.Stop)
+	{
+		// Every round hashes its own random part, so workers never search the same nonces
+		const FGuid guid = FGuid::NewGuid();
+		uint8 randomBytes[12];
+		FMemory::Memcpy(randomBytes, &guid, sizeof(randomBytes));
+
+		buffer.Reset();
+		buffer.Append(dataPrefixBytes);
+		buffer.Append(ULowEntryExtendedStandardLibrary::StringToBytesUtf8(FBase64::Encode(randomBytes, sizeof(randomBytes)) + TEXT(":")));
+
+		// Counters below 16777216 always encode to 4 base64 characters, only those change from one hash to the next.
+		// The whole blocks before them are hashed once per round, the rest is one or two blocks that are rehashed per counter.
+		const int64 fullBlocks = buffer.Num() / 64;
+		uint32 midstate[5];
+		FMemory::Memcpy(midstate, INITIAL_STATE, sizeof(midstate));
+		ULowEntryHashingShaKernels::Sha1BlocksScalar(midstate, buffer.GetData(), fullBlocks);
+
+		uint8 tail[128];
+		const int32 counterPos = buffer.Num() - static_cast<int32>(fullBlocks * 64);
+		const int32 tailSize = ((counterPos + 4 + 1 + 8) > 64) ? 128 : 64;
+		FMemory::Memzero(tail, sizeof(tail));
+		FMemory::Memcpy(tail, buffer.GetData() + fullBlocks * 64, counterPos);
+		tail[counterPos + 4] = 0x80;
+		const uint64 bitLength = static_cast<uint64>(buffer.Num() + 4) << 3;
+		for (int32 j = 0; j < 8; j++)
 		{
-			BASE_64_CACHE = GenerateBase64Cache();
+			tail[tailSize - 1 - j] = static_cast<uint8>(bitLength >> (j * 8));
 		}
-		for (const TArray<uint8>& base64counter : BASE_64_CACHE)
-		{
-			hasher.Reset();
-			hasher.Update(buffer.GetData(), buffer.Num());
-			hasher.Update(base64counter.GetData(), base64counter.Num());
-			hasher.Final();
-			hasher.GetHash(hashBuffer.GetData());
 
-			int32 leadingZeroBits = countLeadingZeroBits(hashBuffer);
+		for (int32 counter = 0; counter < MAX_COUNTER; counter++)
+		{
+			// Base64 of the counter without its leading zero bytes, padded with '='
+			const int32 byteCount = (counter < 256) ? 1 : ((counter < 65536) ? 2 : 3);
+			const uint32 group = static_cast<uint32>(counter) << ((3 - byteCount) * 8);
+			tail[counterPos + 0] = BASE_64[(group >> 18) & 63];
+			tail[counterPos + 1] = BASE_64[(group >> 12) & 63];
+			tail[counterPos + 2] = (byteCount >= 2) ? BASE_64[(group >> 6) & 63] : '=';
+			tail[counterPos + 3] = (byteCount >= 3) ? BASE_64[group & 63] : '=';
+
+			uint32 state[5];
+			FMemory::Memcpy(state, midstate, sizeof(state));
+			ULowEntryHashingShaKernels::Sha1BlocksScalar(state, tail, tailSize / 64);
+
+			int32 leadingZeroBits = 0;
+			for (const uint32 word : state)
+			{
+				leadingZeroBits += FMath::CountLeadingZeros(word);
+				if (word != 0)
+				{
+					break;
+				}
+			}
 			if (leadingZeroBits >= bits)
 			{
-				buffer.Append(base64counter);
-				return ULowEntryExtendedStandardLibrary::BytesToStringUtf8(buffer);
+				Mint.Hashes += (counter % CHECK_INTERVAL) + 1;
+				buffer.Append(tail + counterPos, 4);
+				FScopeLock Lock(&Mint.ResultLock);
+				if (Mint.Result.IsEmpty())
+				{
+					Mint.Result = ULowEntryExtendedStandardLibrary::BytesToStringUtf8(buffer);
+				}
+				Mint.Stop = true;
+				return true;
+			}
+
+			if ((counter % CHECK_INTERVAL) == (CHECK_INTERVAL - 1))
+			{
+				Mint.Hashes += CHECK_INTERVAL;
+				if (Mint.Stop)
+				{
+					return false;
+				}
+				if ((Mint.Deadline > 0) && (FPlatformTime::Seconds() >= Mint.Deadline))
+				{
+					Mint.TimedOut = true;
+					Mint.Stop = true;
+					return false;
+				}
 			}
 		}
 	}
+	return false;
 }
 
 
@@ -143,47 +240,6 @@ ULowEntryParsedHashcash* ULowEntryHashingHashcashLibrary::parse(const FString& H
 }
 
 
-TArray<uint8> ULowEntryHashingHashcashLibrary::base64WithoutLeadingZeroBytes(const int32 value)
-{
-	TArray<uint8> bytes;
-	if (value < 0)
-	{
-		bytes.SetNum(4);
-		bytes[0] = static_cast<uint8>(value >> 24);
-		bytes[1] = static_cast<uint8>(value >> 16);
-		bytes[2] = static_cast<uint8>(value >> 8);
-		bytes[3] = static_cast<uint8>(value);
-	}
-	else if (value < 256)
-	{
-		bytes.SetNum(1);
-		bytes[0] = static_cast<uint8>(value);
-	}
-	else if (value < 65536)
-	{
-		bytes.SetNum(2);
-		bytes[0] = static_cast<uint8>(value >> 8);
-		bytes[1] = static_cast<uint8>(value);
-	}
-	else if (value < 16777216)
-	{
-		bytes.SetNum(3);
-		bytes[0] = static_cast<uint8>(value >> 16);
-		bytes[1] = static_cast<uint8>(value >> 8);
-		bytes[2] = static_cast<uint8>(value);
-	}
-	else
-	{
-		bytes.SetNum(4);
-		bytes[0] = static_cast<uint8>(value >> 24);
-		bytes[1] = static_cast<uint8>(value >> 16);
-		bytes[2] = static_cast<uint8>(value >> 8);
-		bytes[3] = static_cast<uint8>(value);
-	}
-	return ULowEntryExtendedStandardLibrary::StringToBytesUtf8(ULowEntryExtendedStandardLibrary::BytesToBase64(bytes));
-}
-
-
 FString ULowEntryHashingHashcashLibrary::getDateString(const FDateTime& date)
 {
 	return date.ToString(*DATE_FORMAT_STRING);
@@ -0,0 +1,290 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHashingHmacContext.h"
+
+#include "Async/ParallelFor.h"
+
+
+ULowEntryHashingHmacContext::ULowEntryHashingHmacContext()
+{
+	Init(ELowEntryHmacAlgorithm::SHA256, TConstArrayView<uint8>());
+}
+
+ULowEntryHashingHmacContext::ULowEntryHashingHmacContext(const ELowEntryHmacAlgorithm Algorithm0, const TConstArrayView<uint8> Key)
+{
+	Init(Algorithm0, Key);
+}
+
+
+void ULowEntryHashingHmacContext::Init(const ELowEntryHmacAlgorithm Algorithm0, const TConstArrayView<uint8> Key)
+{
+	switch (Algorithm0)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+	case ELowEntryHmacAlgorithm::SHA1:
+	case ELowEntryHmacAlgorithm::SHA256:
+	case ELowEntryHmacAlgorithm::SHA512:
+		Algorithm = Algorithm0;
+		break;
+	default:
+		Algorithm = ELowEntryHmacAlgorithm::SHA256;// defaults to SHA-256
+		break;
+	}
+
+	const int32 BlockSize = GetBlockSize(Algorithm);
+	uint8 KeyBlock[128] = {};
+	if (Key.Num() > BlockSize)
+	{
+		StateInit(Inner);
+		StateUpdate(Inner, Key.GetData(), Key.Num());
+		StateFinal(Inner, KeyBlock);// key = hash(key)
+	}
+	else if (Key.Num() > 0)
+	{
+		FMemory::Memcpy(KeyBlock, Key.GetData(), Key.Num());
+	}
+
+	uint8 PadI[128];
+	uint8 PadO[128];
+	for (int32 i = 0; i < BlockSize; i++)
+	{
+		PadI[i] = KeyBlock[i] ^ 0x36;// i_key_pad = 0x36 ^ key
+		PadO[i] = KeyBlock[i] ^ 0x5c;// o_key_pad = 0x5c ^ key
+	}
+
+	StateInit(Inner);
+	StateUpdate(Inner, PadI, BlockSize);
+	StateInit(Outer);
+	StateUpdate(Outer, PadO, BlockSize);
+	FMemory::Memzero(KeyBlock, sizeof(KeyBlock));
+
+	Reset();
+}
+
+void ULowEntryHashingHmacContext::Reset()
+{
+	StateCopy(Current, Inner);
+}
+
+void ULowEntryHashingHmacContext::Update(const uint8* Bytes, const int64 BytesLength)
+{
+	StateUpdate(Current, Bytes, BytesLength);
+}
+
+void ULowEntryHashingHmacContext::Update(const TArray<uint8>& Bytes, int32 Index, int32 BytesLength)
+{
+	if (Index < 0)
+	{
+		BytesLength += Index;
+		Index = 0;
+	}
+	if (BytesLength > (Bytes.Num() - Index))
+	{
+		BytesLength = Bytes.Num() - Index;
+	}
+	if (BytesLength <= 0)
+	{
+		return;
+	}
+	Update(Bytes.GetData() + Index, BytesLength);
+}
+
+TArray<uint8> ULowEntryHashingHmacContext::Final()
+{
+	TArray<uint8> Mac;
+	Mac.SetNumUninitialized(GetMacLength());
+	Finish(Current, Mac.GetData());
+	Reset();
+	return Mac;
+}
+
+
+TArray<uint8> ULowEntryHashingHmacContext::Sign(const TConstArrayView<uint8> Message) const
+{
+	TArray<uint8> Mac;
+	Mac.SetNumUninitialized(GetMacLength());
+	Sign(Message, Mac.GetData());
+	return Mac;
+}
+
+void ULowEntryHashingHmacContext::Sign(const TConstArrayView<uint8> Message, uint8* Mac) const
+{
+	FHashState State;
+	StateCopy(State, Inner);
+	StateUpdate(State, Message.GetData(), Message.Num());
+	Finish(State, Mac);
+}
+
+bool ULowEntryHashingHmacContext::Verify(const TConstArrayView<uint8> Message, const TConstArrayView<uint8> Mac) const
+{
+	const int32 MacLength = GetMacLength();
+	if (Mac.Num() != MacLength)
+	{
+		return false;
+	}
+
+	uint8 Actual[64];
+	Sign(Message, Actual);
+
+	// No early exit, so the time taken doesn't tell how many bytes matched
+	uint8 Difference = 0;
+	for (int32 i = 0; i < MacLength; i++)
+	{
+		Difference |= Actual[i] ^ Mac[i];
+	}
+	return (Difference == 0);
+}
+
+TArray<uint8> ULowEntryHashingHmacContext::SignBatch(const TConstArrayView<TArrayView<const uint8>> Messages) const
+{
+	TArray<uint8> Macs;
+	Macs.SetNumUninitialized(Messages.Num() * GetMacLength());
+	SignBatch(Messages, Macs.GetData());
+	return Macs;
+}
+
+void ULowEntryHashingHmacContext::SignBatch(const TConstArrayView<TArrayView<const uint8>> Messages, uint8* Macs) const
+{
+	constexpr int32 MESSAGES_PER_TASK = 64;
+
+	const int32 MacLength = GetMacLength();
+	const int32 Tasks = (Messages.Num() + MESSAGES_PER_TASK - 1) / MESSAGES_PER_TASK;
+
+	ParallelFor(Tasks, [this, Messages, Macs, MacLength](const int32 Task)
+	{
+		const int32 First = Task * MESSAGES_PER_TASK;
+		const int32 Last = FMath::Min(First + MESSAGES_PER_TASK, Messages.Num());
+		for (int32 i = First; i < Last; i++)
+		{
+			Sign(Messages[i], Macs + static_cast<int64>(i) * MacLength);
+		}
+	});
+}
+
+
+int32 ULowEntryHashingHmacContext::GetBlockSize(const ELowEntryHmacAlgorithm Algorithm)
+{
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		return 64;
+	case ELowEntryHmacAlgorithm::SHA1:
+		return 64;
+	case ELowEntryHmacAlgorithm::SHA256:
+		return 64;
+	case ELowEntryHmacAlgorithm::SHA512:
+		return 128;
+	default:
+		return 64;// defaults to SHA-256
+	}
+}
+
+int32 ULowEntryHashingHmacContext::GetMacLength(const ELowEntryHmacAlgorithm Algorithm)
+{
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		return 16;
+	case ELowEntryHmacAlgorithm::SHA1:
+		return 20;
+	case ELowEntryHmacAlgorithm::SHA256:
+		return 32;
+	case ELowEntryHmacAlgorithm::SHA512:
+		return 64;
+	default:
+		return 32;// defaults to SHA-256
+	}
+}
+
+
+void ULowEntryHashingHmacContext::StateInit(FHashState& State) const
+{
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		State.Md5 = FMD5();
+		break;
+	case ELowEntryHmacAlgorithm::SHA1:
+		State.Sha1.Init();
+		break;
+	case ELowEntryHmacAlgorithm::SHA512:
+		State.Sha512.Init();
+		break;
+	default:
+		State.Sha256.Init();
+		break;
+	}
+}
+
+void ULowEntryHashingHmacContext::StateCopy(FHashState& To, const FHashState& From) const
+{
+	// Only the member in use is copied, copying all of them would cost more than hashing a short message
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		To.Md5 = From.Md5;
+		break;
+	case ELowEntryHmacAlgorithm::SHA1:
+		To.Sha1 = From.Sha1;
+		break;
+	case ELowEntryHmacAlgorithm::SHA512:
+		To.Sha512 = From.Sha512;
+		break;
+	default:
+		To.Sha256 = From.Sha256;
+		break;
+	}
+}
+
+void ULowEntryHashingHmacContext::StateUpdate(FHashState& State, const uint8* Bytes, const int64 BytesLength) const
+{
+	if (BytesLength <= 0)
+	{
+		return;
+	}
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		State.Md5.Update(Bytes, BytesLength);
+		break;
+	case ELowEntryHmacAlgorithm::SHA1:
+		State.Sha1.Update(Bytes, BytesLength);
+		break;
+	case ELowEntryHmacAlgorithm::SHA512:
+		State.Sha512.Update(Bytes, BytesLength);
+		break;
+	default:
+		State.Sha256.Update(Bytes, BytesLength);
+		break;
+	}
+}
+
+void ULowEntryHashingHmacContext::StateFinal(FHashState& State, uint8* Digest) const
+{
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		State.Md5.Final(Digest);
+		break;
+	case ELowEntryHmacAlgorithm::SHA1:
+		FMemory::Memcpy(Digest, State.Sha1.Final().GetData(), 20);
+		break;
+	case ELowEntryHmacAlgorithm::SHA512:
+		FMemory::Memcpy(Digest, State.Sha512.Final().GetData(), 64);
+		break;
+	default:
+		FMemory::Memcpy(Digest, State.Sha256.Final().GetData(), 32);
+		break;
+	}
+}
+
+void ULowEntryHashingHmacContext::Finish(FHashState& State, uint8* Mac) const
+{
+	uint8 InnerDigest[64];
+	StateFinal(State, InnerDigest);// hash(i_key_pad + message)
+
+	FHashState OuterState;
+	StateCopy(OuterState, Outer);
+	StateUpdate(OuterState, InnerDigest, GetMacLength());
+	StateFinal(OuterState, Mac);// hash(o_key_pad + hash(i_key_pad + message))
+}
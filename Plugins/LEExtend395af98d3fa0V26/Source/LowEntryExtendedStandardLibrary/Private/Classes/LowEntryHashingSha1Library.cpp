@@ -0,0 +1,30 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHashingSha1Library.h"
+#include "LowEntryHashingShaKernels.h"
+#include "LowEntryHashingShaStream.h"
+
+
+void ULowEntryHashingSha1Library::Init()
+{
+	FMemory::Memcpy(state, INITIAL_STATE, sizeof(state));
+	count = 0;
+}
+
+void ULowEntryHashingSha1Library::Update(const uint8* b, const int64 len)
+{
+	TLowEntryHashingShaStream<uint32>::Update(state, buffer, count, b, len, &ULowEntryHashingShaKernels::Sha1BlocksScalar);
+}
+
+TArray<uint8> ULowEntryHashingSha1Library::Final()
+{
+	return TLowEntryHashingShaStream<uint32>::Final(state, buffer, count, 5, &ULowEntryHashingShaKernels::Sha1BlocksScalar);
+}
+
+
+TArray<uint8> ULowEntryHashingSha1Library::Hash(const TArray<uint8>& Bytes)
+{
+	ULowEntryHashingSha1Library instance = ULowEntryHashingSha1Library();
+	instance.Update(Bytes.GetData(), Bytes.Num());
+	return instance.Final();
+}
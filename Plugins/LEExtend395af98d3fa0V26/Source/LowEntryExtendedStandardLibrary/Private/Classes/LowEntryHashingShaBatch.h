@@ -0,0 +1,175 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+
+/**
+ * Hashes many independent messages with a multi-buffer block function, which processes one block of LANES messages per call.
+ *
+ * Every lane takes the next message as soon as its previous one is done, so messages of different lengths keep all lanes busy.
+ * Once no messages are left to hand out, the lanes that are still busy are finished with the single-buffer block function.
+ */
+template<typename WordType, int32 LANES>
+class TLowEntryHashingShaBatch
+{
+public:
+	constexpr static int32 BLOCK_SIZE = sizeof(WordType) * 16;
+	constexpr static int32 DIGEST_SIZE = sizeof(WordType) * 8;
+	constexpr static int32 LENGTH_SIZE = sizeof(WordType) * 2;
+
+	typedef void (*FMultiBlockFunction)(WordType* State, const uint8* const* Blocks);
+	typedef void (*FBlocksFunction)(WordType* State, const uint8* Data, int64 BlockCount);
+
+
+private:
+	struct FLane
+	{
+		int32 Message = INDEX_NONE;
+		const uint8* Data = nullptr;
+		int64 DataBlocks = 0;
+		int64 TotalBlocks = 0;
+		int64 NextBlock = 0;
+		uint8 Tail[BLOCK_SIZE * 2];
+
+		const uint8* GetBlock(const int64 Block) const
+		{
+			return (Block < DataBlocks) ? (Data + Block * BLOCK_SIZE) : (Tail + (Block - DataBlocks) * BLOCK_SIZE);
+		}
+	};
+
+
+public:
+	static void Hash(const TConstArrayView<TArrayView<const uint8>> Messages, uint8* Digests, const WordType (&InitialState)[8], FMultiBlockFunction MultiBlock, FBlocksFunction Blocks)
+	{
+		static const uint8 IdleBlock[BLOCK_SIZE] = {};
+
+		WordType State[8 * LANES];
+		FLane Lanes[LANES];
+		const uint8* LaneBlocks[LANES];
+		int32 NextMessage = 0;
+
+		while (true)
+		{
+			int32 Active = 0;
+			for (int32 Lane = 0; Lane < LANES; Lane++)
+			{
+				if ((Lanes[Lane].Message == INDEX_NONE) && (NextMessage < Messages.Num()))
+				{
+					Start(Lanes[Lane], NextMessage, Messages[NextMessage]);
+					NextMessage++;
+					for (int32 Word = 0; Word < 8; Word++)
+					{
+						State[Word * LANES + Lane] = InitialState[Word];
+					}
+				}
+				if (Lanes[Lane].Message != INDEX_NONE)
+				{
+					Active++;
+				}
+			}
+			if (Active <= 0)
+			{
+				return;
+			}
+
+			if (NextMessage >= Messages.Num() && Active < LANES)
+			{
+				// Nothing left to fill the idle lanes with, one message at a time is faster from here on
+				for (int32 Lane = 0; Lane < LANES; Lane++)
+				{
+					if (Lanes[Lane].Message != INDEX_NONE)
+					{
+						FinishSingle(Lanes[Lane], State, Lane, Digests, Blocks);
+					}
+				}
+				return;
+			}
+
+			for (int32 Lane = 0; Lane < LANES; Lane++)
+			{
+				LaneBlocks[Lane] = (Lanes[Lane].Message != INDEX_NONE) ? Lanes[Lane].GetBlock(Lanes[Lane].NextBlock) : IdleBlock;
+			}
+			MultiBlock(State, LaneBlocks);
+
+			for (int32 Lane = 0; Lane < LANES; Lane++)
+			{
+				FLane& Current = Lanes[Lane];
+				if (Current.Message == INDEX_NONE)
+				{
+					continue;
+				}
+				Current.NextBlock++;
+				if (Current.NextBlock >= Current.TotalBlocks)
+				{
+					WordType Column[8];
+					for (int32 Word = 0; Word < 8; Word++)
+					{
+						Column[Word] = State[Word * LANES + Lane];
+					}
+					StoreDigest(Column, Digests + static_cast<int64>(Current.Message) * DIGEST_SIZE);
+					Current.Message = INDEX_NONE;
+				}
+			}
+		}
+	}
+
+
+private:
+	static void Start(FLane& Lane, const int32 Message, const TArrayView<const uint8> Bytes)
+	{
+		const int64 Length = Bytes.Num();
+		const int32 Remaining = static_cast<int32>(Length % BLOCK_SIZE);
+
+		Lane.Message = Message;
+		Lane.Data = Bytes.GetData();
+		Lane.DataBlocks = Length / BLOCK_SIZE;
+		Lane.NextBlock = 0;
+
+		// The padding, and the last partial block of the message, go in a tail of one or two blocks
+		const int32 TailBlocks = ((Remaining + 1 + LENGTH_SIZE) > BLOCK_SIZE) ? 2 : 1;
+		const int32 TailSize = TailBlocks * BLOCK_SIZE;
+		if (Remaining > 0)
+		{
+			FMemory::Memcpy(Lane.Tail, Lane.Data + Lane.DataBlocks * BLOCK_SIZE, Remaining);
+		}
+		Lane.Tail[Remaining] = 0x80;
+		FMemory::Memzero(Lane.Tail + Remaining + 1, TailSize - Remaining - 1);
+		const uint64 Bits = static_cast<uint64>(Length) << 3;
+		for (int32 j = 0; j < 8; j++)
+		{
+			Lane.Tail[TailSize - 1 - j] = static_cast<uint8>(Bits >> (j * 8));
+		}
+		Lane.TotalBlocks = Lane.DataBlocks + TailBlocks;
+	}
+
+	static void FinishSingle(FLane& Lane, const WordType* State, const int32 LaneIndex, uint8* Digests, FBlocksFunction Blocks)
+	{
+		WordType Column[8];
+		for (int32 Word = 0; Word < 8; Word++)
+		{
+			Column[Word] = State[Word * LANES + LaneIndex];
+		}
+		if (Lane.NextBlock < Lane.DataBlocks)
+		{
+			Blocks(Column, Lane.GetBlock(Lane.NextBlock), Lane.DataBlocks - Lane.NextBlock);
+			Lane.NextBlock = Lane.DataBlocks;
+		}
+		Blocks(Column, Lane.GetBlock(Lane.NextBlock), Lane.TotalBlocks - Lane.NextBlock);
+		StoreDigest(Column, Digests + static_cast<int64>(Lane.Message) * DIGEST_SIZE);
+		Lane.Message = INDEX_NONE;
+	}
+
+	static void StoreDigest(const WordType* Column, uint8* Digest)
+	{
+		for (int32 Word = 0; Word < 8; Word++)
+		{
+			for (int32 j = 0; j < static_cast<int32>(sizeof(WordType)); j++)
+			{
+				Digest[Word * sizeof(WordType) + j] = static_cast<uint8>(Column[Word] >> ((sizeof(WordType) - 1 - j) * 8));
+			}
+		}
+	}
+};
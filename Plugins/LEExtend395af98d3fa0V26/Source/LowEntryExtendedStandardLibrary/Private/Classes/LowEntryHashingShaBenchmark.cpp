@@ -0,0 +1,585 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/OutputDevice.h"
+#include "LowEntryHashingSha256Library.h"
+#include "LowEntryHashingSha512Library.h"
+#include "LowEntryHashingShaKernels.h"
+
+
+namespace
+{
+	// The byte-by-byte implementation the kernels replaced, kept as the baseline of the benchmark
+
+	class FLegacySha256
+	{
+	private:
+		const static int32 k[64];
+		constexpr static int32 BLOCK_SIZE = 64;
+
+
+	private:
+		TArray<int32> w;
+
+		int32 h0 = 0x6a09e667;
+		int32 h1 = 0xbb67ae85;
+		int32 h2 = 0x3c6ef372;
+		int32 h3 = 0xa54ff53a;
+		int32 h4 = 0x510e527f;
+		int32 h5 = 0x9b05688c;
+		int32 h6 = 0x1f83d9ab;
+		int32 h7 = 0x5be0cd19;
+
+		int64 count = 0;
+		TArray<uint8> buffer;
+
+
+	private:
+		void initialize();
+		void update(const TArray<uint8>& b, const int64 offset, const int64 len);
+		TArray<uint8> digest();
+		TArray<uint8> padBuffer();
+		TArray<uint8> getResult();
+		void sha(const TArray<uint8>& in, int64 offset);
+		FORCEINLINE static int32 s(const int32 a, const int32 b);
+
+
+	public:
+		static TArray<uint8> Hash(const TArray<uint8>& Bytes);
+	};
+
+	constexpr int32 FLegacySha256::k[64] = {0x428a2f98, 0x71374491, static_cast<int32>(0xb5c0fbcf), static_cast<int32>(0xe9b5dba5), 0x3956c25b, 0x59f111f1, static_cast<int32>(0x923f82a4), static_cast<int32>(0xab1c5ed5), static_cast<int32>(0xd807aa98), 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, static_cast<int32>(0x80deb1fe), static_cast<int32>(0x9bdc06a7), static_cast<int32>(0xc19bf174), static_cast<int32>(0xe49b69c1), static_cast<int32>(0xefbe4786), 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, static_cast<int32>(0x983e5152), static_cast<int32>(0xa831c66d), static_cast<int32>(0xb00327c8), static_cast<int32>(0xbf597fc7), static_cast<int32>(0xc6e00bf3), static_cast<int32>(0xd5a79147), 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, static_cast<int32>(0x81c2c92e), static_cast<int32>(0x92722c85), static_cast<int32>(0xa2bfe8a1), static_cast<int32>(0xa81a664b), static_cast<int32>(0xc24b8b70), static_cast<int32>(0xc76c51a3), static_cast<int32>(0xd192e819), static_cast<int32>(0xd6990624), static_cast<int32>(0xf40e3585), 0x106aa070, 0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, static_cast<int32>(0x84c87814), static_cast<int32>(0x8cc70208), static_cast<int32>(0x90befffa), static_cast<int32>(0xa4506ceb), static_cast<int32>(0xbef9a3f7), static_cast<int32>(0xc67178f2)};
+
+
+	void FLegacySha256::initialize()
+	{
+		w.SetNum(64);
+		buffer.SetNum(64);
+	}
+
+	void FLegacySha256::update(const TArray<uint8>& b, const int64 offset, const int64 len)
+	{
+		int32 n = count % BLOCK_SIZE;
+		count += len;
+		int64 partLen = BLOCK_SIZE - n;
+		int64 i = 0;
+
+		if (len >= partLen)
+		{
+			for (int32 index = 0; index < partLen; index++)
+			{
+				buffer[n + index] = b[offset + index];
+			}
+			sha(buffer, 0);
+			for (i = partLen; ((i + BLOCK_SIZE) - 1) < len; i += BLOCK_SIZE)
+			{
+				sha(b, offset + i);
+			}
+			n = 0;
+		}
+
+		if (i < len)
+		{
+			for (int32 index = 0; index < len - i; index++)
+			{
+				buffer[n + index] = b[offset + i + index];
+			}
+		}
+	}
+
+	TArray<uint8> FLegacySha256::digest()
+	{
+		TArray<uint8> tail = padBuffer();
+		update(tail, 0, tail.Num());
+		return getResult();
+	}
+
+	TArray<uint8> FLegacySha256::padBuffer()
+	{
+		int32 n = count % BLOCK_SIZE;
+		int32 padding = (n < 56) ? (56 - n) : (120 - n);
+		TArray<uint8> result;
+		result.SetNum(padding + 8);
+		result[0] = static_cast<uint8>(0x80);
+		int64 bits = count << 3;
+		result[padding + 0] = static_cast<uint8>(bits >> 56);
+		result[padding + 1] = static_cast<uint8>(bits >> 48);
+		result[padding + 2] = static_cast<uint8>(bits >> 40);
+		result[padding + 3] = static_cast<uint8>(bits >> 32);
+		result[padding + 4] = static_cast<uint8>(bits >> 24);
+		result[padding + 5] = static_cast<uint8>(bits >> 16);
+		result[padding + 6] = static_cast<uint8>(bits >> 8);
+		result[padding + 7] = static_cast<uint8>(bits);
+		return result;
+	}
+
+	TArray<uint8> FLegacySha256::getResult()
+	{
+		TArray<uint8> result;
+		result.SetNum(32);
+
+		result[0] = static_cast<uint8>(h0 >> 24);
+		result[1] = static_cast<uint8>(h0 >> 16);
+		result[2] = static_cast<uint8>(h0 >> 8);
+		result[3] = static_cast<uint8>(h0);
+
+		result[4] = static_cast<uint8>(h1 >> 24);
+		result[5] = static_cast<uint8>(h1 >> 16);
+		result[6] = static_cast<uint8>(h1 >> 8);
+		result[7] = static_cast<uint8>(h1);
+
+		result[8] = static_cast<uint8>(h2 >> 24);
+		result[9] = static_cast<uint8>(h2 >> 16);
+		result[10] = static_cast<uint8>(h2 >> 8);
+		result[11] = static_cast<uint8>(h2);
+
+		result[12] = static_cast<uint8>(h3 >> 24);
+		result[13] = static_cast<uint8>(h3 >> 16);
+		result[14] = static_cast<uint8>(h3 >> 8);
+		result[15] = static_cast<uint8>(h3);
+
+		result[16] = static_cast<uint8>(h4 >> 24);
+		result[17] = static_cast<uint8>(h4 >> 16);
+		result[18] = static_cast<uint8>(h4 >> 8);
+		result[19] = static_cast<uint8>(h4);
+
+		result[20] = static_cast<uint8>(h5 >> 24);
+		result[21] = static_cast<uint8>(h5 >> 16);
+		result[22] = static_cast<uint8>(h5 >> 8);
+		result[23] = static_cast<uint8>(h5);
+
+		result[24] = static_cast<uint8>(h6 >> 24);
+		result[25] = static_cast<uint8>(h6 >> 16);
+		result[26] = static_cast<uint8>(h6 >> 8);
+		result[27] = static_cast<uint8>(h6);
+
+		result[28] = static_cast<uint8>(h7 >> 24);
+		result[29] = static_cast<uint8>(h7 >> 16);
+		result[30] = static_cast<uint8>(h7 >> 8);
+		result[31] = static_cast<uint8>(h7);
+
+		return result;
+	}
+
+	void FLegacySha256::sha(const TArray<uint8>& in, int64 offset)
+	{
+		int32 A = h0;
+		int32 B = h1;
+		int32 C = h2;
+		int32 D = h3;
+		int32 E = h4;
+		int32 F = h5;
+		int32 G = h6;
+		int32 H = h7;
+		int32 T;
+		int32 T2;
+		int32 r;
+		for (r = 0; r < 16; r++)
+		{
+			w[r] = ((in[offset] << 24) | ((in[offset + 1] & 0xFF) << 16) | ((in[offset + 2] & 0xFF) << 8) | (in[offset + 3] & 0xFF));
+			offset += 4;
+		}
+		for (r = 16; r < 64; r++)
+		{
+			T = w[r - 2];
+			T2 = w[r - 15];
+			w[r] = (((s(T, 17) | (T << 15)) ^ (s(T, 19) | (T << 13)) ^ s(T, 10)) + w[r - 7] + ((s(T2, 7) | (T2 << 25)) ^ (s(T2, 18) | (T2 << 14)) ^ s(T2, 3)) + w[r - 16]);
+		}
+		for (r = 0; r < 64; r++)
+		{
+			T = (H + ((s(E, 6) | (E << 26)) ^ (s(E, 11) | (E << 21)) ^ (s(E, 25) | (E << 7))) + ((E & F) ^ (~E & G)) + k[r] + w[r]);
+			T2 = (((s(A, 2) | (A << 30)) ^ (s(A, 13) | (A << 19)) ^ (s(A, 22) | (A << 10))) + ((A & B) ^ (A & C) ^ (B & C)));
+			H = G;
+			G = F;
+			F = E;
+			E = D + T;
+			D = C;
+			C = B;
+			B = A;
+			A = T + T2;
+		}
+		h0 += A;
+		h1 += B;
+		h2 += C;
+		h3 += D;
+		h4 += E;
+		h5 += F;
+		h6 += G;
+		h7 += H;
+	}
+
+	int32 FLegacySha256::s(const int32 a, const int32 b)
+	{
+		const uint32 A = a;
+		const uint32 B = b;
+		return (A >> B);
+	}
+
+
+	TArray<uint8> FLegacySha256::Hash(const TArray<uint8>& Bytes)
+	{
+		FLegacySha256 instance = FLegacySha256();
+		instance.initialize();
+		instance.update(Bytes, 0, Bytes.Num());
+		return instance.digest();
+	}
+
+
+	class FLegacySha512
+	{
+	private:
+		const static int64 k[80];
+		constexpr static int32 BLOCK_SIZE = 128;
+
+
+	private:
+		TArray<int64> w;
+
+		int64 h0 = 0x6a09e667f3bcc908L;
+		int64 h1 = 0xbb67ae8584caa73bL;
+		int64 h2 = 0x3c6ef372fe94f82bL;
+		int64 h3 = 0xa54ff53a5f1d36f1L;
+		int64 h4 = 0x510e527fade682d1L;
+		int64 h5 = 0x9b05688c2b3e6c1fL;
+		int64 h6 = 0x1f83d9abfb41bd6bL;
+		int64 h7 = 0x5be0cd19137e2179L;
+
+		int64 count = 0;
+		TArray<uint8> buffer;
+
+
+	private:
+		void initialize();
+		void update(const TArray<uint8>& b, const int64 offset, const int64 len);
+		TArray<uint8> digest();
+		TArray<uint8> padBuffer();
+		TArray<uint8> getResult();
+		void sha(const TArray<uint8>& in, int64 offset);
+		FORCEINLINE static int64 s(const int64 a, const int32 b);
+
+
+	public:
+		static TArray<uint8> Hash(const TArray<uint8>& Bytes);
+	};
+
+	constexpr int64 FLegacySha512::k[80] = {0x428a2f98d728ae22, 0x7137449123ef65cd, static_cast<int64>(0xb5c0fbcfec4d3b2f), static_cast<int64>(0xe9b5dba58189dbbc), 0x3956c25bf348b538, 0x59f111f1b605d019, static_cast<int64>(0x923f82a4af194f9b), static_cast<int64>(0xab1c5ed5da6d8118), static_cast<int64>(0xd807aa98a3030242), 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 0x72be5d74f27b896f, static_cast<int64>(0x80deb1fe3b1696b1), static_cast<int64>(0x9bdc06a725c71235), static_cast<int64>(0xc19bf174cf692694), static_cast<int64>(0xe49b69c19ef14ad2), static_cast<int64>(0xefbe4786384f25e3), 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65, 0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5, static_cast<int64>(0x983e5152ee66dfab), static_cast<int64>(0xa831c66d2db43210), static_cast<int64>(0xb00327c898fb213f), static_cast<int64>(0xbf597fc7beef0ee4), static_cast<int64>(0xc6e00bf33da88fc2), static_cast<int64>(0xd5a79147930aa725), 0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df, 0x650a73548baf63de, 0x766a0abb3c77b2a8, static_cast<int64>(0x81c2c92e47edaee6), static_cast<int64>(0x92722c851482353b), static_cast<int64>(0xa2bfe8a14cf10364), static_cast<int64>(0xa81a664bbc423001), static_cast<int64>(0xc24b8b70d0f89791), static_cast<int64>(0xc76c51a30654be30), static_cast<int64>(0xd192e819d6ef5218), static_cast<int64>(0xd69906245565a910), static_cast<int64>(0xf40e35855771202a), 0x106aa07032bbd1b8, 0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc, 0x78a5636f43172f60, static_cast<int64>(0x84c87814a1f0ab72), static_cast<int64>(0x8cc702081a6439ec), static_cast<int64>(0x90befffa23631e28), static_cast<int64>(0xa4506cebde82bde9), static_cast<int64>(0xbef9a3f7b2c67915), static_cast<int64>(0xc67178f2e372532b), static_cast<int64>(0xca273eceea26619c), static_cast<int64>(0xd186b8c721c0c207), static_cast<int64>(0xeada7dd6cde0eb1e), static_cast<int64>(0xf57d4f7fee6ed178), 0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b, 0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817};
+
+
+	void FLegacySha512::initialize()
+	{
+		w.SetNum(80);
+		buffer.SetNum(128);
+	}
+
+	void FLegacySha512::update(const TArray<uint8>& b, const int64 offset, const int64 len)
+	{
+		int32 n = count % BLOCK_SIZE;
+		count += len;
+		int64 partLen = BLOCK_SIZE - n;
+		int64 i = 0;
+
+		if (len >= partLen)
+		{
+			for (int32 index = 0; index < partLen; index++)
+			{
+				buffer[n + index] = b[offset + index];
+			}
+			sha(buffer, 0);
+			for (i = partLen; ((i + BLOCK_SIZE) - 1) < len; i += BLOCK_SIZE)
+			{
+				sha(b, offset + i);
+			}
+			n = 0;
+		}
+
+		if (i < len)
+		{
+			for (int32 index = 0; index < len - i; index++)
+			{
+				buffer[n + index] = b[offset + i + index];
+			}
+		}
+	}
+
+	TArray<uint8> FLegacySha512::digest()
+	{
+		TArray<uint8> tail = padBuffer();
+		update(tail, 0, tail.Num());
+		return getResult();
+	}
+
+	TArray<uint8> FLegacySha512::padBuffer()
+	{
+		int32 n = count % BLOCK_SIZE;
+		int32 padding = (n < 112) ? (112 - n) : (240 - n);
+		TArray<uint8> result;
+		result.SetNum(padding + 16);
+		result[0] = static_cast<uint8>(0x80);
+		uint64 bits = count << 3;
+		padding += 8;
+		result[padding + 0] = static_cast<uint8>(bits >> 56);
+		result[padding + 1] = static_cast<uint8>(bits >> 48);
+		result[padding + 2] = static_cast<uint8>(bits >> 40);
+		result[padding + 3] = static_cast<uint8>(bits >> 32);
+		result[padding + 4] = static_cast<uint8>(bits >> 24);
+		result[padding + 5] = static_cast<uint8>(bits >> 16);
+		result[padding + 6] = static_cast<uint8>(bits >> 8);
+		result[padding + 7] = static_cast<uint8>(bits);
+		return result;
+	}
+
+	TArray<uint8> FLegacySha512::getResult()
+	{
+		TArray<uint8> result;
+		result.SetNum(64);
+
+		result[0] = static_cast<uint8>(h0 >> 56);
+		result[1] = static_cast<uint8>(h0 >> 48);
+		result[2] = static_cast<uint8>(h0 >> 40);
+		result[3] = static_cast<uint8>(h0 >> 32);
+		result[4] = static_cast<uint8>(h0 >> 24);
+		result[5] = static_cast<uint8>(h0 >> 16);
+		result[6] = static_cast<uint8>(h0 >> 8);
+		result[7] = static_cast<uint8>(h0);
+
+		result[8] = static_cast<uint8>(h1 >> 56);
+		result[9] = static_cast<uint8>(h1 >> 48);
+		result[10] = static_cast<uint8>(h1 >> 40);
+		result[11] = static_cast<uint8>(h1 >> 32);
+		result[12] = static_cast<uint8>(h1 >> 24);
+		result[13] = static_cast<uint8>(h1 >> 16);
+		result[14] = static_cast<uint8>(h1 >> 8);
+		result[15] = static_cast<uint8>(h1);
+
+		result[16] = static_cast<uint8>(h2 >> 56);
+		result[17] = static_cast<uint8>(h2 >> 48);
+		result[18] = static_cast<uint8>(h2 >> 40);
+		result[19] = static_cast<uint8>(h2 >> 32);
+		result[20] = static_cast<uint8>(h2 >> 24);
+		result[21] = static_cast<uint8>(h2 >> 16);
+		result[22] = static_cast<uint8>(h2 >> 8);
+		result[23] = static_cast<uint8>(h2);
+
+		result[24] = static_cast<uint8>(h3 >> 56);
+		result[25] = static_cast<uint8>(h3 >> 48);
+		result[26] = static_cast<uint8>(h3 >> 40);
+		result[27] = static_cast<uint8>(h3 >> 32);
+		result[28] = static_cast<uint8>(h3 >> 24);
+		result[29] = static_cast<uint8>(h3 >> 16);
+		result[30] = static_cast<uint8>(h3 >> 8);
+		result[31] = static_cast<uint8>(h3);
+
+		result[32] = static_cast<uint8>(h4 >> 56);
+		result[33] = static_cast<uint8>(h4 >> 48);
+		result[34] = static_cast<uint8>(h4 >> 40);
+		result[35] = static_cast<uint8>(h4 >> 32);
+		result[36] = static_cast<uint8>(h4 >> 24);
+		result[37] = static_cast<uint8>(h4 >> 16);
+		result[38] = static_cast<uint8>(h4 >> 8);
+		result[39] = static_cast<uint8>(h4);
+
+		result[40] = static_cast<uint8>(h5 >> 56);
+		result[41] = static_cast<uint8>(h5 >> 48);
+		result[42] = static_cast<uint8>(h5 >> 40);
+		result[43] = static_cast<uint8>(h5 >> 32);
+		result[44] = static_cast<uint8>(h5 >> 24);
+		result[45] = static_cast<uint8>(h5 >> 16);
+		result[46] = static_cast<uint8>(h5 >> 8);
+		result[47] = static_cast<uint8>(h5);
+
+		result[48] = static_cast<uint8>(h6 >> 56);
+		result[49] = static_cast<uint8>(h6 >> 48);
+		result[50] = static_cast<uint8>(h6 >> 40);
+		result[51] = static_cast<uint8>(h6 >> 32);
+		result[52] = static_cast<uint8>(h6 >> 24);
+		result[53] = static_cast<uint8>(h6 >> 16);
+		result[54] = static_cast<uint8>(h6 >> 8);
+		result[55] = static_cast<uint8>(h6);
+
+		result[56] = static_cast<uint8>(h7 >> 56);
+		result[57] = static_cast<uint8>(h7 >> 48);
+		result[58] = static_cast<uint8>(h7 >> 40);
+		result[59] = static_cast<uint8>(h7 >> 32);
+		result[60] = static_cast<uint8>(h7 >> 24);
+		result[61] = static_cast<uint8>(h7 >> 16);
+		result[62] = static_cast<uint8>(h7 >> 8);
+		result[63] = static_cast<uint8>(h7);
+
+		return result;
+	}
+
+	void FLegacySha512::sha(const TArray<uint8>& in, int64 offset)
+	{
+		int64 A = h0;
+		int64 B = h1;
+		int64 C = h2;
+		int64 D = h3;
+		int64 E = h4;
+		int64 F = h5;
+		int64 G = h6;
+		int64 H = h7;
+		uint64 T;
+		uint64 T2;
+		int32 r;
+		for (r = 0; r < 16; r++)
+		{
+			w[r] = (static_cast<int64>(in[offset]) << 56) | ((static_cast<int64>(in[offset + 1]) & 0xFF) << 48) | ((static_cast<int64>(in[offset + 2]) & 0xFF) << 40) | ((static_cast<int64>(in[offset + 3]) & 0xFF) << 32) | ((static_cast<int64>(in[offset + 4]) & 0xFF) << 24) | ((static_cast<int64>(in[offset + 5]) & 0xFF) << 16) | ((static_cast<int64>(in[offset + 6]) & 0xFF) << 8) | (static_cast<int64>(in[offset + 7]) & 0xFF);
+			offset += 8;
+		}
+		for (r = 16; r < 80; r++)
+		{
+			T = w[r - 2];
+			T2 = w[r - 15];
+			w[r] = ((s(T, 19) | (T << 45)) ^ (s(T, 61) | (T << 3)) ^ s(T, 6)) + w[r - 7] + ((s(T2, 1) | (T2 << 63)) ^ (s(T2, 8) | (T2 << 56)) ^ s(T2, 7)) + w[r - 16];
+		}
+		for (r = 0; r < 80; r++)
+		{
+			T = H + ((s(E, 14) | (E << 50)) ^ (s(E, 18) | (E << 46)) ^ (s(E, 41) | (E << 23))) + ((E & F) ^ ((~E) & G)) + k[r] + w[r];
+			T2 = ((s(A, 28) | (A << 36)) ^ (s(A, 34) | (A << 30)) ^ (s(A, 39) | (A << 25))) + ((A & B) ^ (A & C) ^ (B & C));
+			H = G;
+			G = F;
+			F = E;
+			E = D + T;
+			D = C;
+			C = B;
+			B = A;
+			A = T + T2;
+		}
+		h0 += A;
+		h1 += B;
+		h2 += C;
+		h3 += D;
+		h4 += E;
+		h5 += F;
+		h6 += G;
+		h7 += H;
+	}
+
+	int64 FLegacySha512::s(const int64 a, const int32 b)
+	{
+		const uint64 A = a;
+		const uint32 B = b;
+		return (A >> B);
+	}
+
+
+	TArray<uint8> FLegacySha512::Hash(const TArray<uint8>& Bytes)
+	{
+		FLegacySha512 instance = FLegacySha512();
+		instance.initialize();
+		instance.update(Bytes, 0, Bytes.Num());
+		return instance.digest();
+	}
+
+
+
+	template <typename FunctionType>
+	double MeasureSeconds(const int32 Iterations, FunctionType&& Function)
+	{
+		double Best = TNumericLimits<double>::Max();
+		for (int32 i = 0; i < Iterations; i++)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Function();
+			Best = FMath::Min(Best, FPlatformTime::Seconds() - Start);
+		}
+		return Best;
+	}
+
+	void RunHashBenchmark(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const int32 Megabytes = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 1024) : 16;
+		const int32 Iterations = 5;
+
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(Megabytes * 1024 * 1024);
+		FRandomStream Random(0x10E);
+		for (uint8& Byte : Data)
+		{
+			Byte = static_cast<uint8>(Random.RandHelper(256));
+		}
+		const double Size = Data.Num() / (1024.0 * 1024.0);
+
+		Ar.Logf(TEXT("LowEntry hash benchmark, %d MB, best of %d"), Megabytes, Iterations);
+
+		TArray<uint8> Expected256 = FLegacySha256::Hash(Data);
+		Ar.Logf(TEXT("  SHA-256 %-8s %8.1f MB/s"), TEXT("Legacy"), Size / MeasureSeconds(Iterations, [&Data]() { FLegacySha256::Hash(Data); }));
+		for (const ULowEntryHashingShaKernels::FSha256Kernel& Kernel : ULowEntryHashingShaKernels::GetSha256Kernels())
+		{
+			// The kernels only run whole blocks; the tail and the padding are the same for all of them and left out
+			uint32 State[8] = {};
+			const int64 Blocks = Data.Num() / 64;
+			const double Seconds = MeasureSeconds(Iterations, [&]() { Kernel.Function(State, Data.GetData(), Blocks); });
+			Ar.Logf(TEXT("  SHA-256 %-8s %8.1f MB/s"), Kernel.Name, Size / Seconds);
+		}
+		const bool bMatch256 = (ULowEntryHashingSha256Library::Hash(Data) == Expected256);
+		Ar.Logf(TEXT("  SHA-256 digest %s the legacy implementation"), bMatch256 ? TEXT("matches") : TEXT("DOES NOT MATCH"));
+
+		TArray<uint8> Expected512 = FLegacySha512::Hash(Data);
+		Ar.Logf(TEXT("  SHA-512 %-8s %8.1f MB/s"), TEXT("Legacy"), Size / MeasureSeconds(Iterations, [&Data]() { FLegacySha512::Hash(Data); }));
+		for (const ULowEntryHashingShaKernels::FSha512Kernel& Kernel : ULowEntryHashingShaKernels::GetSha512Kernels())
+		{
+			uint64 State[8] = {};
+			const int64 Blocks = Data.Num() / 128;
+			const double Seconds = MeasureSeconds(Iterations, [&]() { Kernel.Function(State, Data.GetData(), Blocks); });
+			Ar.Logf(TEXT("  SHA-512 %-8s %8.1f MB/s"), Kernel.Name, Size / Seconds);
+		}
+		const bool bMatch512 = (ULowEntryHashingSha512Library::Hash(Data) == Expected512);
+		Ar.Logf(TEXT("  SHA-512 digest %s the legacy implementation"), bMatch512 ? TEXT("matches") : TEXT("DOES NOT MATCH"));
+
+		// Many small messages, like save chunks or replay segments: one by one against the batch API
+		const int32 MessageSize = 256;
+		TArray<TArrayView<const uint8>> Messages;
+		for (int32 Offset = 0; (Offset + MessageSize) <= Data.Num(); Offset += MessageSize)
+		{
+			Messages.Add(TArrayView<const uint8>(Data.GetData() + Offset, MessageSize));
+		}
+		Ar.Logf(TEXT("LowEntry batch hash benchmark, %d messages of %d bytes"), Messages.Num(), MessageSize);
+
+		TArray<uint8> Single256;
+		TArray<uint8> Single512;
+		const double SingleSeconds256 = MeasureSeconds(Iterations, [&]()
+		{
+			Single256.Reset();
+			for (const TArrayView<const uint8>& Message : Messages)
+			{
+				ULowEntryHashingSha256Library Instance;
+				Instance.Update(Message.GetData(), Message.Num());
+				Single256.Append(Instance.Final());
+			}
+		});
+		const double SingleSeconds512 = MeasureSeconds(Iterations, [&]()
+		{
+			Single512.Reset();
+			for (const TArrayView<const uint8>& Message : Messages)
+			{
+				ULowEntryHashingSha512Library Instance;
+				Instance.Update(Message.GetData(), Message.Num());
+				Single512.Append(Instance.Final());
+			}
+		});
+		TArray<uint8> Batch256;
+		TArray<uint8> Batch512;
+		const double BatchSeconds256 = MeasureSeconds(Iterations, [&]() { Batch256 = ULowEntryHashingSha256Library::HashBatch(Messages); });
+		const double BatchSeconds512 = MeasureSeconds(Iterations, [&]() { Batch512 = ULowEntryHashingSha512Library::HashBatch(Messages); });
+
+		Ar.Logf(TEXT("  SHA-256 %-8s %8.1f MB/s"), TEXT("Single"), Size / SingleSeconds256);
+		Ar.Logf(TEXT("  SHA-256 %-8s %8.1f MB/s, digests %s"), TEXT("Batch"), Size / BatchSeconds256, (Batch256 == Single256) ? TEXT("match") : TEXT("DO NOT MATCH"));
+		Ar.Logf(TEXT("  SHA-512 %-8s %8.1f MB/s"), TEXT("Single"), Size / SingleSeconds512);
+		Ar.Logf(TEXT("  SHA-512 %-8s %8.1f MB/s, digests %s"), TEXT("Batch"), Size / BatchSeconds512, (Batch512 == Single512) ? TEXT("match") : TEXT("DO NOT MATCH"));
+	}
+
+	FAutoConsoleCommand HashBenchmarkCommand(
+		TEXT("LowEntry.HashBenchmark"),
+		TEXT("Compares the SHA-256 and SHA-512 kernels this CPU supports with the previous implementation, and the batch API with hashing messages one by one. Optional argument: megabytes to hash (default 16)."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&RunHashBenchmark)
+	);
+}
+
+#endif
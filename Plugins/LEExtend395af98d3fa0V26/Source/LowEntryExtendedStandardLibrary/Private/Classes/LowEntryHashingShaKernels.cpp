@@ -0,0 +1,758 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHashingShaKernels.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+	#include <immintrin.h>
+
+	// MSVC allows any intrinsic anywhere, clang and gcc only in functions compiled for the instruction set
+	#if defined(__clang__) || defined(__GNUC__)
+		#define LOWENTRY_TARGET_SHANI __attribute__((target("sha,sse4.1,ssse3")))
+		#define LOWENTRY_TARGET_AVX2 __attribute__((target("avx2,bmi2")))
+	#else
+		#define LOWENTRY_TARGET_SHANI
+		#define LOWENTRY_TARGET_AVX2
+	#endif
+#endif
+
+
+const uint32 ULowEntryHashingShaKernels::Sha256K[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+const uint64 ULowEntryHashingShaKernels::Sha512K[80] = {
+	0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc, 0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+	0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694,
+	0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65, 0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+	0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70,
+	0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df, 0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+	0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
+	0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+	0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec, 0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+	0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
+	0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817
+};
+
+
+namespace
+{
+	FORCEINLINE uint32 Rotr32(const uint32 X, const uint32 N)
+	{
+		return (X >> N) | (X << (32 - N));
+	}
+
+	FORCEINLINE uint64 Rotr64(const uint64 X, const uint64 N)
+	{
+		return (X >> N) | (X << (64 - N));
+	}
+
+	FORCEINLINE uint32 LoadBigEndian32(const uint8* P)
+	{
+		return (static_cast<uint32>(P[0]) << 24) | (static_cast<uint32>(P[1]) << 16) | (static_cast<uint32>(P[2]) << 8) | static_cast<uint32>(P[3]);
+	}
+
+	FORCEINLINE uint64 LoadBigEndian64(const uint8* P)
+	{
+		return (static_cast<uint64>(LoadBigEndian32(P)) << 32) | LoadBigEndian32(P + 4);
+	}
+
+
+	// The rounds take W[i] + K[i] precomputed, so the scalar and the AVX2 kernels share them
+	#define LOWENTRY_SHA256_ROUND(a, b, c, d, e, f, g, h, WK) \
+		{ \
+			const uint32 T1 = h + (Rotr32(e, 6) ^ Rotr32(e, 11) ^ Rotr32(e, 25)) + (g ^ (e & (f ^ g))) + (WK); \
+			const uint32 T2 = (Rotr32(a, 2) ^ Rotr32(a, 13) ^ Rotr32(a, 22)) + ((a & b) | (c & (a | b))); \
+			d += T1; \
+			h = T1 + T2; \
+		}
+
+	#define LOWENTRY_SHA256_ROUNDS_8(WK, i) \
+		LOWENTRY_SHA256_ROUND(A, B, C, D, E, F, G, H, WK[i + 0]); \
+		LOWENTRY_SHA256_ROUND(H, A, B, C, D, E, F, G, WK[i + 1]); \
+		LOWENTRY_SHA256_ROUND(G, H, A, B, C, D, E, F, WK[i + 2]); \
+		LOWENTRY_SHA256_ROUND(F, G, H, A, B, C, D, E, WK[i + 3]); \
+		LOWENTRY_SHA256_ROUND(E, F, G, H, A, B, C, D, WK[i + 4]); \
+		LOWENTRY_SHA256_ROUND(D, E, F, G, H, A, B, C, WK[i + 5]); \
+		LOWENTRY_SHA256_ROUND(C, D, E, F, G, H, A, B, WK[i + 6]); \
+		LOWENTRY_SHA256_ROUND(B, C, D, E, F, G, H, A, WK[i + 7]);
+
+	#define LOWENTRY_SHA512_ROUND(a, b, c, d, e, f, g, h, WK) \
+		{ \
+			const uint64 T1 = h + (Rotr64(e, 14) ^ Rotr64(e, 18) ^ Rotr64(e, 41)) + (g ^ (e & (f ^ g))) + (WK); \
+			const uint64 T2 = (Rotr64(a, 28) ^ Rotr64(a, 34) ^ Rotr64(a, 39)) + ((a & b) | (c & (a | b))); \
+			d += T1; \
+			h = T1 + T2; \
+		}
+
+	#define LOWENTRY_SHA512_ROUNDS_8(WK, i) \
+		LOWENTRY_SHA512_ROUND(A, B, C, D, E, F, G, H, WK[i + 0]); \
+		LOWENTRY_SHA512_ROUND(H, A, B, C, D, E, F, G, WK[i + 1]); \
+		LOWENTRY_SHA512_ROUND(G, H, A, B, C, D, E, F, WK[i + 2]); \
+		LOWENTRY_SHA512_ROUND(F, G, H, A, B, C, D, E, WK[i + 3]); \
+		LOWENTRY_SHA512_ROUND(E, F, G, H, A, B, C, D, WK[i + 4]); \
+		LOWENTRY_SHA512_ROUND(D, E, F, G, H, A, B, C, WK[i + 5]); \
+		LOWENTRY_SHA512_ROUND(C, D, E, F, G, H, A, B, WK[i + 6]); \
+		LOWENTRY_SHA512_ROUND(B, C, D, E, F, G, H, A, WK[i + 7]);
+
+
+	FORCEINLINE void Sha256Compress(uint32* State, const uint32* WK)
+	{
+		uint32 A = State[0];
+		uint32 B = State[1];
+		uint32 C = State[2];
+		uint32 D = State[3];
+		uint32 E = State[4];
+		uint32 F = State[5];
+		uint32 G = State[6];
+		uint32 H = State[7];
+		for (int32 i = 0; i < 64; i += 8)
+		{
+			LOWENTRY_SHA256_ROUNDS_8(WK, i);
+		}
+		State[0] += A;
+		State[1] += B;
+		State[2] += C;
+		State[3] += D;
+		State[4] += E;
+		State[5] += F;
+		State[6] += G;
+		State[7] += H;
+	}
+
+	FORCEINLINE void Sha512Compress(uint64* State, const uint64* WK)
+	{
+		uint64 A = State[0];
+		uint64 B = State[1];
+		uint64 C = State[2];
+		uint64 D = State[3];
+		uint64 E = State[4];
+		uint64 F = State[5];
+		uint64 G = State[6];
+		uint64 H = State[7];
+		for (int32 i = 0; i < 80; i += 8)
+		{
+			LOWENTRY_SHA512_ROUNDS_8(WK, i);
+		}
+		State[0] += A;
+		State[1] += B;
+		State[2] += C;
+		State[3] += D;
+		State[4] += E;
+		State[5] += F;
+		State[6] += G;
+		State[7] += H;
+	}
+
+
+#if PLATFORM_CPU_X86_FAMILY
+	struct FCpuFeatures
+	{
+		bool bShaNi = false;
+		bool bAvx2 = false;
+	};
+
+	void CpuId(const uint32 Leaf, const uint32 SubLeaf, uint32 (&Registers)[4])
+	{
+	#if defined(_MSC_VER)
+		int32 Info[4];
+		__cpuidex(Info, Leaf, SubLeaf);
+		FMemory::Memcpy(Registers, Info, sizeof(Info));
+	#else
+		if (!__get_cpuid_count(Leaf, SubLeaf, &Registers[0], &Registers[1], &Registers[2], &Registers[3]))
+		{
+			FMemory::Memzero(Registers, sizeof(Registers));
+		}
+	#endif
+	}
+
+	uint64 XGetBv0()
+	{
+	#if defined(_MSC_VER)
+		return _xgetbv(0);
+	#else
+		uint32 Eax;
+		uint32 Edx;
+		__asm__ volatile("xgetbv" : "=a"(Eax), "=d"(Edx) : "c"(0));
+		return (static_cast<uint64>(Edx) << 32) | Eax;
+	#endif
+	}
+
+	FCpuFeatures DetectCpuFeatures()
+	{
+		FCpuFeatures Features;
+		uint32 Registers[4];
+		CpuId(0, 0, Registers);
+		const uint32 MaxLeaf = Registers[0];
+
+		CpuId(1, 0, Registers);
+		const bool bSsse3 = (Registers[2] & (1u << 9)) != 0;
+		const bool bSse41 = (Registers[2] & (1u << 19)) != 0;
+		const bool bOsXSave = (Registers[2] & (1u << 27)) != 0;
+		const bool bAvx = (Registers[2] & (1u << 28)) != 0;
+		// The OS has to save the YMM registers too, not just the CPU support them
+		const bool bYmmState = bOsXSave && ((XGetBv0() & 0x6) == 0x6);
+
+		if (MaxLeaf >= 7)
+		{
+			CpuId(7, 0, Registers);
+			const bool bAvx2 = (Registers[1] & (1u << 5)) != 0;
+			const bool bBmi2 = (Registers[1] & (1u << 8)) != 0;
+			const bool bSha = (Registers[1] & (1u << 29)) != 0;
+			Features.bShaNi = bSha && bSse41 && bSsse3;
+			Features.bAvx2 = bAvx && bYmmState && bAvx2 && bBmi2;
+		}
+		return Features;
+	}
+
+	const FCpuFeatures& GetCpuFeatures()
+	{
+		static const FCpuFeatures Features = DetectCpuFeatures();
+		return Features;
+	}
+
+
+	// SHA-NI keeps the state as ABEF and CDGH and runs two rounds per instruction
+	LOWENTRY_TARGET_SHANI void Sha256BlocksShaNi(uint32* State, const uint8* Data, int64 BlockCount)
+	{
+		const __m128i ByteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+		__m128i Tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(State)), 0xB1); // CDAB
+		__m128i State1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 4)), 0x1B); // EFGH
+		__m128i State0 = _mm_alignr_epi8(Tmp, State1, 8); // ABEF
+		State1 = _mm_blend_epi16(State1, Tmp, 0xF0); // CDGH
+
+		for (; BlockCount > 0; BlockCount--, Data += 64)
+		{
+			const __m128i SavedState0 = State0;
+			const __m128i SavedState1 = State1;
+			__m128i Msg[4];
+
+			// Four rounds per step; the message schedule runs three steps ahead of the rounds that use it
+			for (int32 Step = 0; Step < 16; Step++)
+			{
+				if (Step < 4)
+				{
+					Msg[Step] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Step * 16)), ByteSwap);
+				}
+
+				__m128i WK = _mm_add_epi32(Msg[Step & 3], _mm_loadu_si128(reinterpret_cast<const __m128i*>(ULowEntryHashingShaKernels::Sha256K + Step * 4)));
+				State1 = _mm_sha256rnds2_epu32(State1, State0, WK);
+				if ((Step >= 3) && (Step <= 14))
+				{
+					__m128i& Next = Msg[(Step + 1) & 3];
+					Next = _mm_add_epi32(Next, _mm_alignr_epi8(Msg[Step & 3], Msg[(Step + 3) & 3], 4));
+					Next = _mm_sha256msg2_epu32(Next, Msg[Step & 3]);
+				}
+				WK = _mm_shuffle_epi32(WK, 0x0E);
+				State0 = _mm_sha256rnds2_epu32(State0, State1, WK);
+				if ((Step >= 1) && (Step <= 12))
+				{
+					Msg[(Step + 3) & 3] = _mm_sha256msg1_epu32(Msg[(Step + 3) & 3], Msg[Step & 3]);
+				}
+			}
+
+			State0 = _mm_add_epi32(State0, SavedState0);
+			State1 = _mm_add_epi32(State1, SavedState1);
+		}
+
+		Tmp = _mm_shuffle_epi32(State0, 0x1B); // FEBA
+		State1 = _mm_shuffle_epi32(State1, 0xB1); // DCHG
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(State), _mm_blend_epi16(Tmp, State1, 0xF0)); // DCBA
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(State + 4), _mm_alignr_epi8(State1, Tmp, 8)); // HGFE
+	}
+
+
+	// AVX2 has no use inside the rounds, which are a serial chain. It computes the message schedule instead, of two blocks at once
+	// (one per 128-bit lane), and the rounds then read W + K from the stack. BMI2 gives the rounds three-operand rotates.
+	LOWENTRY_TARGET_AVX2 FORCEINLINE __m256i Avx2Rotr32(const __m256i X, const int32 N)
+	{
+		return _mm256_or_si256(_mm256_srli_epi32(X, N), _mm256_slli_epi32(X, 32 - N));
+	}
+
+	LOWENTRY_TARGET_AVX2 FORCEINLINE __m256i Avx2Rotr64(const __m256i X, const int32 N)
+	{
+		return _mm256_or_si256(_mm256_srli_epi64(X, N), _mm256_slli_epi64(X, 64 - N));
+	}
+
+	LOWENTRY_TARGET_AVX2 FORCEINLINE __m256i Avx2LoadTwoBlocks(const uint8* Block0, const uint8* Block1, const int32 Offset, const __m256i ByteSwap)
+	{
+		const __m256i Words = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Block0 + Offset))), _mm_loadu_si128(reinterpret_cast<const __m128i*>(Block1 + Offset)), 1);
+		return _mm256_shuffle_epi8(Words, ByteSwap);
+	}
+
+	LOWENTRY_TARGET_AVX2 FORCEINLINE void Avx2StoreTwoBlocks(const __m256i Words, uint32* WK0, uint32* WK1, const int32 Index)
+	{
+		const __m256i Sum = _mm256_add_epi32(Words, _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ULowEntryHashingShaKernels::Sha256K + Index))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(WK0 + Index), _mm256_castsi256_si128(Sum));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(WK1 + Index), _mm256_extracti128_si256(Sum, 1));
+	}
+
+	LOWENTRY_TARGET_AVX2 FORCEINLINE void Avx2StoreTwoBlocks(const __m256i Words, uint64* WK0, uint64* WK1, const int32 Index)
+	{
+		const __m256i Sum = _mm256_add_epi64(Words, _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ULowEntryHashingShaKernels::Sha512K + Index))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(WK0 + Index), _mm256_castsi256_si128(Sum));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(WK1 + Index), _mm256_extracti128_si256(Sum, 1));
+	}
+
+	LOWENTRY_TARGET_AVX2 void Sha256BlocksAvx2(uint32* State, const uint8* Data, int64 BlockCount)
+	{
+		const __m256i ByteSwap = _mm256_broadcastsi128_si256(_mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL));
+		const __m256i LowHalf = _mm256_broadcastsi128_si256(_mm_set_epi32(0, 0, -1, -1));
+
+		alignas(32) uint32 WK0[64];
+		alignas(32) uint32 WK1[64];
+		for (; BlockCount > 0; BlockCount -= 2, Data += 128)
+		{
+			// An odd block at the end gets scheduled twice; the copy in the second lane is not used
+			const uint8* Block1 = (BlockCount >= 2) ? (Data + 64) : Data;
+
+			// X[0..3] hold W[t-16..t-1], four words per lane
+			__m256i X[4];
+			for (int32 i = 0; i < 4; i++)
+			{
+				X[i] = Avx2LoadTwoBlocks(Data, Block1, i * 16, ByteSwap);
+				Avx2StoreTwoBlocks(X[i], WK0, WK1, i * 4);
+			}
+
+			for (int32 t = 16; t < 64; t += 4)
+			{
+				const __m256i W15 = _mm256_alignr_epi8(X[1], X[0], 4); // W[t-15..t-12]
+				const __m256i W7 = _mm256_alignr_epi8(X[3], X[2], 4); // W[t-7..t-4]
+				const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr32(W15, 7), Avx2Rotr32(W15, 18)), _mm256_srli_epi32(W15, 3));
+				__m256i Next = _mm256_add_epi32(_mm256_add_epi32(X[0], W7), S0);
+
+				// s1 of W[t-2] and W[t-1] completes W[t] and W[t+1], whose s1 then completes W[t+2] and W[t+3]
+				const __m256i W2 = _mm256_shuffle_epi32(X[3], 0xFE); // W[t-2], W[t-1], -, -
+				const __m256i S1Low = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr32(W2, 17), Avx2Rotr32(W2, 19)), _mm256_srli_epi32(W2, 10));
+				Next = _mm256_add_epi32(Next, _mm256_and_si256(S1Low, LowHalf));
+				const __m256i W0 = _mm256_shuffle_epi32(Next, 0x40); // -, -, W[t], W[t+1]
+				const __m256i S1High = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr32(W0, 17), Avx2Rotr32(W0, 19)), _mm256_srli_epi32(W0, 10));
+				Next = _mm256_add_epi32(Next, _mm256_andnot_si256(LowHalf, S1High));
+
+				X[0] = X[1];
+				X[1] = X[2];
+				X[2] = X[3];
+				X[3] = Next;
+				Avx2StoreTwoBlocks(Next, WK0, WK1, t);
+			}
+
+			Sha256Compress(State, WK0);
+			if (BlockCount >= 2)
+			{
+				Sha256Compress(State, WK1);
+			}
+		}
+	}
+
+	LOWENTRY_TARGET_AVX2 void Sha512BlocksAvx2(uint64* State, const uint8* Data, int64 BlockCount)
+	{
+		const __m256i ByteSwap = _mm256_broadcastsi128_si256(_mm_set_epi64x(0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL));
+
+		alignas(32) uint64 WK0[80];
+		alignas(32) uint64 WK1[80];
+		for (; BlockCount > 0; BlockCount -= 2, Data += 256)
+		{
+			const uint8* Block1 = (BlockCount >= 2) ? (Data + 128) : Data;
+
+			// X[0..7] hold W[t-16..t-1], two words per lane. W[t] and W[t+1] only need W[t-2] and W[t-1], so both come out in one go.
+			__m256i X[8];
+			for (int32 i = 0; i < 8; i++)
+			{
+				X[i] = Avx2LoadTwoBlocks(Data, Block1, i * 16, ByteSwap);
+				Avx2StoreTwoBlocks(X[i], WK0, WK1, i * 2);
+			}
+
+			for (int32 t = 16; t < 80; t += 2)
+			{
+				const __m256i W15 = _mm256_alignr_epi8(X[1], X[0], 8); // W[t-15], W[t-14]
+				const __m256i W7 = _mm256_alignr_epi8(X[5], X[4], 8); // W[t-7], W[t-6]
+				const __m256i W2 = X[7]; // W[t-2], W[t-1]
+				const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr64(W15, 1), Avx2Rotr64(W15, 8)), _mm256_srli_epi64(W15, 7));
+				const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr64(W2, 19), Avx2Rotr64(W2, 61)), _mm256_srli_epi64(W2, 6));
+				const __m256i Next = _mm256_add_epi64(_mm256_add_epi64(X[0], W7), _mm256_add_epi64(S0, S1));
+
+				for (int32 i = 0; i < 7; i++)
+				{
+					X[i] = X[i + 1];
+				}
+				X[7] = Next;
+				Avx2StoreTwoBlocks(Next, WK0, WK1, t);
+			}
+
+			Sha512Compress(State, WK0);
+			if (BlockCount >= 2)
+			{
+				Sha512Compress(State, WK1);
+			}
+		}
+	}
+
+	// Multi-buffer: every 32-bit (SHA-256) or 64-bit (SHA-512) element of a vector belongs to another message, so the rounds,
+	// which are serial within a message, run 8 or 4 messages wide. The state is stored word major, State[Word * Lanes + Lane].
+	LOWENTRY_TARGET_AVX2 FORCEINLINE void Avx2Transpose8x32(__m256i (&R)[8])
+	{
+		const __m256i T0 = _mm256_unpacklo_epi32(R[0], R[1]);
+		const __m256i T1 = _mm256_unpackhi_epi32(R[0], R[1]);
+		const __m256i T2 = _mm256_unpacklo_epi32(R[2], R[3]);
+		const __m256i T3 = _mm256_unpackhi_epi32(R[2], R[3]);
+		const __m256i T4 = _mm256_unpacklo_epi32(R[4], R[5]);
+		const __m256i T5 = _mm256_unpackhi_epi32(R[4], R[5]);
+		const __m256i T6 = _mm256_unpacklo_epi32(R[6], R[7]);
+		const __m256i T7 = _mm256_unpackhi_epi32(R[6], R[7]);
+		const __m256i U0 = _mm256_unpacklo_epi64(T0, T2);
+		const __m256i U1 = _mm256_unpackhi_epi64(T0, T2);
+		const __m256i U2 = _mm256_unpacklo_epi64(T1, T3);
+		const __m256i U3 = _mm256_unpackhi_epi64(T1, T3);
+		const __m256i U4 = _mm256_unpacklo_epi64(T4, T6);
+		const __m256i U5 = _mm256_unpackhi_epi64(T4, T6);
+		const __m256i U6 = _mm256_unpacklo_epi64(T5, T7);
+		const __m256i U7 = _mm256_unpackhi_epi64(T5, T7);
+		R[0] = _mm256_permute2x128_si256(U0, U4, 0x20);
+		R[1] = _mm256_permute2x128_si256(U1, U5, 0x20);
+		R[2] = _mm256_permute2x128_si256(U2, U6, 0x20);
+		R[3] = _mm256_permute2x128_si256(U3, U7, 0x20);
+		R[4] = _mm256_permute2x128_si256(U0, U4, 0x31);
+		R[5] = _mm256_permute2x128_si256(U1, U5, 0x31);
+		R[6] = _mm256_permute2x128_si256(U2, U6, 0x31);
+		R[7] = _mm256_permute2x128_si256(U3, U7, 0x31);
+	}
+
+	LOWENTRY_TARGET_AVX2 FORCEINLINE void Avx2Transpose4x64(__m256i (&R)[4])
+	{
+		const __m256i T0 = _mm256_unpacklo_epi64(R[0], R[1]);
+		const __m256i T1 = _mm256_unpackhi_epi64(R[0], R[1]);
+		const __m256i T2 = _mm256_unpacklo_epi64(R[2], R[3]);
+		const __m256i T3 = _mm256_unpackhi_epi64(R[2], R[3]);
+		R[0] = _mm256_permute2x128_si256(T0, T2, 0x20);
+		R[1] = _mm256_permute2x128_si256(T1, T3, 0x20);
+		R[2] = _mm256_permute2x128_si256(T0, T2, 0x31);
+		R[3] = _mm256_permute2x128_si256(T1, T3, 0x31);
+	}
+
+	LOWENTRY_TARGET_AVX2 void Sha256x8BlockAvx2(uint32* State, const uint8* const* Blocks)
+	{
+		const __m256i ByteSwap = _mm256_broadcastsi128_si256(_mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL));
+
+		__m256i W[16];
+		for (int32 Half = 0; Half < 2; Half++)
+		{
+			__m256i R[8];
+			for (int32 Lane = 0; Lane < 8; Lane++)
+			{
+				R[Lane] = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Blocks[Lane] + Half * 32)), ByteSwap);
+			}
+			Avx2Transpose8x32(R);
+			for (int32 i = 0; i < 8; i++)
+			{
+				W[Half * 8 + i] = R[i];
+			}
+		}
+
+		__m256i A = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 0));
+		__m256i B = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 8));
+		__m256i C = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 16));
+		__m256i D = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 24));
+		__m256i E = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 32));
+		__m256i F = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 40));
+		__m256i G = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 48));
+		__m256i H = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 56));
+
+		for (int32 t = 0; t < 64; t++)
+		{
+			if (t >= 16)
+			{
+				const __m256i W15 = W[(t - 15) & 15];
+				const __m256i W2 = W[(t - 2) & 15];
+				const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr32(W15, 7), Avx2Rotr32(W15, 18)), _mm256_srli_epi32(W15, 3));
+				const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr32(W2, 17), Avx2Rotr32(W2, 19)), _mm256_srli_epi32(W2, 10));
+				W[t & 15] = _mm256_add_epi32(_mm256_add_epi32(W[t & 15], W[(t - 7) & 15]), _mm256_add_epi32(S0, S1));
+			}
+
+			const __m256i Sigma1 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr32(E, 6), Avx2Rotr32(E, 11)), Avx2Rotr32(E, 25));
+			const __m256i Ch = _mm256_xor_si256(G, _mm256_and_si256(E, _mm256_xor_si256(F, G)));
+			const __m256i T1 = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(H, Sigma1), _mm256_add_epi32(Ch, W[t & 15])), _mm256_set1_epi32(static_cast<int32>(ULowEntryHashingShaKernels::Sha256K[t])));
+			const __m256i Sigma0 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr32(A, 2), Avx2Rotr32(A, 13)), Avx2Rotr32(A, 22));
+			const __m256i Maj = _mm256_or_si256(_mm256_and_si256(A, B), _mm256_and_si256(C, _mm256_or_si256(A, B)));
+			H = G;
+			G = F;
+			F = E;
+			E = _mm256_add_epi32(D, T1);
+			D = C;
+			C = B;
+			B = A;
+			A = _mm256_add_epi32(T1, _mm256_add_epi32(Sigma0, Maj));
+		}
+
+		const __m256i Result[8] = {A, B, C, D, E, F, G, H};
+		for (int32 i = 0; i < 8; i++)
+		{
+			__m256i* Word = reinterpret_cast<__m256i*>(State + i * 8);
+			_mm256_storeu_si256(Word, _mm256_add_epi32(_mm256_loadu_si256(Word), Result[i]));
+		}
+	}
+
+	LOWENTRY_TARGET_AVX2 void Sha512x4BlockAvx2(uint64* State, const uint8* const* Blocks)
+	{
+		const __m256i ByteSwap = _mm256_broadcastsi128_si256(_mm_set_epi64x(0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL));
+
+		__m256i W[16];
+		for (int32 Quarter = 0; Quarter < 4; Quarter++)
+		{
+			__m256i R[4];
+			for (int32 Lane = 0; Lane < 4; Lane++)
+			{
+				R[Lane] = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Blocks[Lane] + Quarter * 32)), ByteSwap);
+			}
+			Avx2Transpose4x64(R);
+			for (int32 i = 0; i < 4; i++)
+			{
+				W[Quarter * 4 + i] = R[i];
+			}
+		}
+
+		__m256i A = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 0));
+		__m256i B = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 4));
+		__m256i C = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 8));
+		__m256i D = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 12));
+		__m256i E = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 16));
+		__m256i F = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 20));
+		__m256i G = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 24));
+		__m256i H = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + 28));
+
+		for (int32 t = 0; t < 80; t++)
+		{
+			if (t >= 16)
+			{
+				const __m256i W15 = W[(t - 15) & 15];
+				const __m256i W2 = W[(t - 2) & 15];
+				const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr64(W15, 1), Avx2Rotr64(W15, 8)), _mm256_srli_epi64(W15, 7));
+				const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr64(W2, 19), Avx2Rotr64(W2, 61)), _mm256_srli_epi64(W2, 6));
+				W[t & 15] = _mm256_add_epi64(_mm256_add_epi64(W[t & 15], W[(t - 7) & 15]), _mm256_add_epi64(S0, S1));
+			}
+
+			const __m256i Sigma1 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr64(E, 14), Avx2Rotr64(E, 18)), Avx2Rotr64(E, 41));
+			const __m256i Ch = _mm256_xor_si256(G, _mm256_and_si256(E, _mm256_xor_si256(F, G)));
+			const __m256i T1 = _mm256_add_epi64(_mm256_add_epi64(_mm256_add_epi64(H, Sigma1), _mm256_add_epi64(Ch, W[t & 15])), _mm256_set1_epi64x(static_cast<int64>(ULowEntryHashingShaKernels::Sha512K[t])));
+			const __m256i Sigma0 = _mm256_xor_si256(_mm256_xor_si256(Avx2Rotr64(A, 28), Avx2Rotr64(A, 34)), Avx2Rotr64(A, 39));
+			const __m256i Maj = _mm256_or_si256(_mm256_and_si256(A, B), _mm256_and_si256(C, _mm256_or_si256(A, B)));
+			H = G;
+			G = F;
+			F = E;
+			E = _mm256_add_epi64(D, T1);
+			D = C;
+			C = B;
+			B = A;
+			A = _mm256_add_epi64(T1, _mm256_add_epi64(Sigma0, Maj));
+		}
+
+		const __m256i Result[8] = {A, B, C, D, E, F, G, H};
+		for (int32 i = 0; i < 8; i++)
+		{
+			__m256i* Word = reinterpret_cast<__m256i*>(State + i * 4);
+			_mm256_storeu_si256(Word, _mm256_add_epi64(_mm256_loadu_si256(Word), Result[i]));
+		}
+	}
+#endif
+}
+
+
+void ULowEntryHashingShaKernels::Sha256BlocksScalar(uint32* State, const uint8* Data, int64 BlockCount)
+{
+	uint32 W[64];
+	for (; BlockCount > 0; BlockCount--, Data += 64)
+	{
+		for (int32 i = 0; i < 16; i++)
+		{
+			W[i] = LoadBigEndian32(Data + i * 4);
+		}
+		for (int32 i = 16; i < 64; i++)
+		{
+			const uint32 S0 = Rotr32(W[i - 15], 7) ^ Rotr32(W[i - 15], 18) ^ (W[i - 15] >> 3);
+			const uint32 S1 = Rotr32(W[i - 2], 17) ^ Rotr32(W[i - 2], 19) ^ (W[i - 2] >> 10);
+			W[i] = W[i - 16] + S0 + W[i - 7] + S1;
+		}
+		for (int32 i = 0; i < 64; i++)
+		{
+			W[i] += Sha256K[i];
+		}
+		Sha256Compress(State, W);
+	}
+}
+
+void ULowEntryHashingShaKernels::Sha512BlocksScalar(uint64* State, const uint8* Data, int64 BlockCount)
+{
+	uint64 W[80];
+	for (; BlockCount > 0; BlockCount--, Data += 128)
+	{
+		for (int32 i = 0; i < 16; i++)
+		{
+			W[i] = LoadBigEndian64(Data + i * 8);
+		}
+		for (int32 i = 16; i < 80; i++)
+		{
+			const uint64 S0 = Rotr64(W[i - 15], 1) ^ Rotr64(W[i - 15], 8) ^ (W[i - 15] >> 7);
+			const uint64 S1 = Rotr64(W[i - 2], 19) ^ Rotr64(W[i - 2], 61) ^ (W[i - 2] >> 6);
+			W[i] = W[i - 16] + S0 + W[i - 7] + S1;
+		}
+		for (int32 i = 0; i < 80; i++)
+		{
+			W[i] += Sha512K[i];
+		}
+		Sha512Compress(State, W);
+	}
+}
+
+
+void ULowEntryHashingShaKernels::Sha1BlocksScalar(uint32* State, const uint8* Data, int64 BlockCount)
+{
+	uint32 W[80];
+	for (; BlockCount > 0; BlockCount--, Data += 64)
+	{
+		for (int32 i = 0; i < 16; i++)
+		{
+			W[i] = LoadBigEndian32(Data + i * 4);
+		}
+		for (int32 i = 16; i < 80; i++)
+		{
+			W[i] = Rotr32(W[i - 3] ^ W[i - 8] ^ W[i - 14] ^ W[i - 16], 31);
+		}
+
+		uint32 A = State[0];
+		uint32 B = State[1];
+		uint32 C = State[2];
+		uint32 D = State[3];
+		uint32 E = State[4];
+		for (int32 i = 0; i < 80; i++)
+		{
+			uint32 F;
+			uint32 K;
+			if (i < 20)
+			{
+				F = D ^ (B & (C ^ D));
+				K = 0x5a827999;
+			}
+			else if (i < 40)
+			{
+				F = B ^ C ^ D;
+				K = 0x6ed9eba1;
+			}
+			else if (i < 60)
+			{
+				F = (B & C) | (D & (B | C));
+				K = 0x8f1bbcdc;
+			}
+			else
+			{
+				F = B ^ C ^ D;
+				K = 0xca62c1d6;
+			}
+			const uint32 T = Rotr32(A, 27) + F + E + K + W[i];
+			E = D;
+			D = C;
+			C = Rotr32(B, 2);
+			B = A;
+			A = T;
+		}
+		State[0] += A;
+		State[1] += B;
+		State[2] += C;
+		State[3] += D;
+		State[4] += E;
+	}
+}
+
+
+bool ULowEntryHashingShaKernels::HasShaNi()
+{
+#if PLATFORM_CPU_X86_FAMILY
+	return GetCpuFeatures().bShaNi;
+#else
+	return false;
+#endif
+}
+
+bool ULowEntryHashingShaKernels::HasAvx2()
+{
+#if PLATFORM_CPU_X86_FAMILY
+	return GetCpuFeatures().bAvx2;
+#else
+	return false;
+#endif
+}
+
+ULowEntryHashingShaKernels::FSha256BlocksFunction ULowEntryHashingShaKernels::GetSha256Blocks()
+{
+	static const FSha256BlocksFunction Function = GetSha256Kernels().Last().Function;
+	return Function;
+}
+
+ULowEntryHashingShaKernels::FSha512BlocksFunction ULowEntryHashingShaKernels::GetSha512Blocks()
+{
+	static const FSha512BlocksFunction Function = GetSha512Kernels().Last().Function;
+	return Function;
+}
+
+ULowEntryHashingShaKernels::FSha256x8BlockFunction ULowEntryHashingShaKernels::GetSha256x8Block()
+{
+#if PLATFORM_CPU_X86_FAMILY
+	if (HasAvx2())
+	{
+		return &Sha256x8BlockAvx2;
+	}
+#endif
+	return nullptr;
+}
+
+ULowEntryHashingShaKernels::FSha512x4BlockFunction ULowEntryHashingShaKernels::GetSha512x4Block()
+{
+#if PLATFORM_CPU_X86_FAMILY
+	if (HasAvx2())
+	{
+		return &Sha512x4BlockAvx2;
+	}
+#endif
+	return nullptr;
+}
+
+TArray<ULowEntryHashingShaKernels::FSha256Kernel> ULowEntryHashingShaKernels::GetSha256Kernels()
+{
+	// Slowest first, the last one is the one that gets used
+	TArray<FSha256Kernel> Kernels;
+	Kernels.Add({TEXT("Scalar"), &Sha256BlocksScalar});
+#if PLATFORM_CPU_X86_FAMILY
+	if (HasAvx2())
+	{
+		Kernels.Add({TEXT("AVX2"), &Sha256BlocksAvx2});
+	}
+	if (HasShaNi())
+	{
+		Kernels.Add({TEXT("SHA-NI"), &Sha256BlocksShaNi});
+	}
+#endif
+	return Kernels;
+}
+
+TArray<ULowEntryHashingShaKernels::FSha512Kernel> ULowEntryHashingShaKernels::GetSha512Kernels()
+{
+	TArray<FSha512Kernel> Kernels;
+	Kernels.Add({TEXT("Scalar"), &Sha512BlocksScalar});
+#if PLATFORM_CPU_X86_FAMILY
+	if (HasAvx2())
+	{
+		Kernels.Add({TEXT("AVX2"), &Sha512BlocksAvx2});
+	}
+#endif
+	return Kernels;
+}
@@ -0,0 +1,65 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+
+/**
+ * Block functions of SHA-256 and SHA-512: they run the compression function over whole blocks (64 bytes for SHA-256, 128 bytes for SHA-512).
+ *
+ * Every function exists as a portable unrolled scalar version, plus SHA-NI (SHA-256) and AVX2 (both) versions on x86.
+ * GetSha256Blocks and GetSha512Blocks return the fastest one the CPU supports, which is picked on first use.
+ *
+ * For hashing many messages at once there are multi-buffer AVX2 versions as well, which hash a block of 8 or 4 messages per call.
+ */
+class ULowEntryHashingShaKernels
+{
+public:
+	typedef void (*FSha256BlocksFunction)(uint32* State, const uint8* Data, int64 BlockCount);
+	typedef void (*FSha512BlocksFunction)(uint64* State, const uint8* Data, int64 BlockCount);
+
+	// One block of each of 8 (SHA-256) or 4 (SHA-512) independent messages, the state is stored as State[Word * Lanes + Lane]
+	typedef void (*FSha256x8BlockFunction)(uint32* State, const uint8* const* Blocks);
+	typedef void (*FSha512x4BlockFunction)(uint64* State, const uint8* const* Blocks);
+
+	struct FSha256Kernel
+	{
+		const TCHAR* Name;
+		FSha256BlocksFunction Function;
+	};
+
+	struct FSha512Kernel
+	{
+		const TCHAR* Name;
+		FSha512BlocksFunction Function;
+	};
+
+
+public:
+	static const uint32 Sha256K[64];
+	static const uint64 Sha512K[80];
+
+
+public:
+	static FSha256BlocksFunction GetSha256Blocks();
+	static FSha512BlocksFunction GetSha512Blocks();
+
+	static void Sha256BlocksScalar(uint32* State, const uint8* Data, int64 BlockCount);
+	static void Sha512BlocksScalar(uint64* State, const uint8* Data, int64 BlockCount);
+
+	// SHA-1 (State is 5 words), used where the midstate of a shared prefix has to be kept, which FSHA1 doesn't allow
+	static void Sha1BlocksScalar(uint32* State, const uint8* Data, int64 BlockCount);
+
+	// Multi-buffer versions, nullptr if the CPU has no vector unit to run them on
+	static FSha256x8BlockFunction GetSha256x8Block();
+	static FSha512x4BlockFunction GetSha512x4Block();
+
+	static bool HasShaNi();
+	static bool HasAvx2();
+
+	// Every kernel this CPU can run, the scalar one first; for tests and benchmarks
+	static TArray<FSha256Kernel> GetSha256Kernels();
+	static TArray<FSha512Kernel> GetSha512Kernels();
+};
@@ -0,0 +1,92 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+
+/**
+ * The streaming part of SHA-1, SHA-256 and SHA-512: buffering input into blocks, padding the last block and writing out the digest.
+ *
+ * The hash itself is done by the given block function, the state, buffer and byte count are owned by the caller.
+ */
+template<typename WordType>
+class TLowEntryHashingShaStream
+{
+public:
+	constexpr static int32 BLOCK_SIZE = sizeof(WordType) * 16;
+	constexpr static int32 LENGTH_SIZE = sizeof(WordType) * 2;
+
+	typedef void (*FBlocksFunction)(WordType* State, const uint8* Data, int64 BlockCount);
+
+
+	static void Update(WordType* State, uint8* Buffer, int64& Count, const uint8* Data, const int64 Length, const FBlocksFunction Blocks)
+	{
+		if (Length <= 0)
+		{
+			return;
+		}
+
+		const int32 n = Count % BLOCK_SIZE;
+		Count += Length;
+		int64 i = 0;
+
+		if (n > 0)
+		{
+			const int64 partLen = FMath::Min<int64>(BLOCK_SIZE - n, Length);
+			FMemory::Memcpy(Buffer + n, Data, partLen);
+			if ((n + partLen) < BLOCK_SIZE)
+			{
+				return;
+			}
+			Blocks(State, Buffer, 1);
+			i = partLen;
+		}
+
+		// Whole blocks are hashed straight from the input
+		const int64 blockCount = (Length - i) / BLOCK_SIZE;
+		if (blockCount > 0)
+		{
+			Blocks(State, Data + i, blockCount);
+			i += blockCount * BLOCK_SIZE;
+		}
+
+		if (i < Length)
+		{
+			FMemory::Memcpy(Buffer, Data + i, Length - i);
+		}
+	}
+
+	// Pads and hashes the last block, then returns the first DigestWords words of the state as big-endian bytes
+	static TArray<uint8> Final(WordType* State, uint8* Buffer, const int64 Count, const int32 DigestWords, const FBlocksFunction Blocks)
+	{
+		int32 n = Count % BLOCK_SIZE;
+		Buffer[n++] = 0x80;
+		if (n > (BLOCK_SIZE - LENGTH_SIZE))
+		{
+			FMemory::Memzero(Buffer + n, BLOCK_SIZE - n);
+			Blocks(State, Buffer, 1);
+			n = 0;
+		}
+		FMemory::Memzero(Buffer + n, BLOCK_SIZE - n);
+
+		const uint64 bits = static_cast<uint64>(Count) << 3;
+		for (int32 j = 0; j < 8; j++)
+		{
+			Buffer[BLOCK_SIZE - 1 - j] = static_cast<uint8>(bits >> (j * 8));
+		}
+		Blocks(State, Buffer, 1);
+
+		TArray<uint8> result;
+		result.SetNumUninitialized(DigestWords * sizeof(WordType));
+		for (int32 i = 0; i < DigestWords; i++)
+		{
+			for (int32 j = 0; j < static_cast<int32>(sizeof(WordType)); j++)
+			{
+				result[i * sizeof(WordType) + j] = static_cast<uint8>(State[i] >> (((sizeof(WordType) - 1) - j) * 8));
+			}
+		}
+		return result;
+	}
+};
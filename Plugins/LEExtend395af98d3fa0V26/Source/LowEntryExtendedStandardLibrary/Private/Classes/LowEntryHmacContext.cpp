@@ -0,0 +1,89 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHmacContext.h"
+#include "LowEntryByteArray.h"
+
+
+namespace
+{
+	TConstArrayView<uint8> SubArrayView(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+	{
+		if (Index < 0)
+		{
+			Length += Index;
+			Index = 0;
+		}
+		if (Length > (ByteArray.Num() - Index))
+		{
+			Length = ByteArray.Num() - Index;
+		}
+		if (Length <= 0)
+		{
+			return TConstArrayView<uint8>();
+		}
+		return TConstArrayView<uint8>(ByteArray.GetData() + Index, Length);
+	}
+}
+
+
+ULowEntryHmacContext::ULowEntryHmacContext(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntryHmacContext* ULowEntryHmacContext::Create(const TArray<uint8>& Key, const ELowEntryHmacAlgorithm Algorithm)
+{
+	ULowEntryHmacContext* Instance = NewObject<ULowEntryHmacContext>();
+	Instance->Init(Key, Algorithm);
+	return Instance;
+}
+
+
+void ULowEntryHmacContext::Init(const TArray<uint8>& Key, const ELowEntryHmacAlgorithm Algorithm)
+{
+	Context.Init(Algorithm, Key);
+}
+
+void ULowEntryHmacContext::Reset()
+{
+	Context.Reset();
+}
+
+void ULowEntryHmacContext::Update(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+{
+	Context.Update(ByteArray, Index, Length);
+}
+
+TArray<uint8> ULowEntryHmacContext::Final()
+{
+	return Context.Final();
+}
+
+TArray<uint8> ULowEntryHmacContext::Sign(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+{
+	return Context.Sign(SubArrayView(ByteArray, Index, Length));
+}
+
+bool ULowEntryHmacContext::Verify(const TArray<uint8>& ByteArray, const TArray<uint8>& Hash, int32 Index, int32 Length)
+{
+	return Context.Verify(SubArrayView(ByteArray, Index, Length), Hash);
+}
+
+TArray<uint8> ULowEntryHmacContext::SignBatch(const TArray<ULowEntryByteArray*>& ByteArrays)
+{
+	TArray<TArrayView<const uint8>> Messages;
+	Messages.Reserve(ByteArrays.Num());
+	for (const ULowEntryByteArray* ByteArray : ByteArrays)
+	{
+		// Null entries are signed like empty byte arrays, so every entry keeps its place in the result
+		Messages.Add((ByteArray != nullptr) ? TArrayView<const uint8>(ByteArray->ByteArray) : TArrayView<const uint8>());
+	}
+	return Context.SignBatch(Messages);
+}
+
+ELowEntryHmacAlgorithm ULowEntryHmacContext::GetAlgorithm()
+{
+	return Context.GetAlgorithm();
+}
+
+int32 ULowEntryHmacContext::GetHashLength()
+{
+	return Context.GetMacLength();
+}
@@ -0,0 +1,19 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "ELowEntryHashAlgorithm.generated.h"
+
+
+UENUM(BlueprintType)
+enum class ELowEntryHashAlgorithm : uint8
+{
+	MD5,
+	SHA1,
+	SHA256,
+	SHA512,
+	Pearson
+};
@@ -0,0 +1,57 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LowEntryBCryptTask.generated.h"
+
+
+/**
+ * Generates a BCrypt hash on the task graph, so the game thread doesn't freeze while the key schedule runs.
+ */
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryBCryptTask : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryBCryptTask* Create(const TArray<uint8>& Bytes, const TArray<uint8>& Salt, const int32 Strength);
+
+
+public:
+	UPROPERTY()
+	bool Finished = false;
+	UPROPERTY()
+	bool Success = false;
+	UPROPERTY()
+	TArray<uint8> Result;
+
+	UPROPERTY()
+	int32 KeepAliveCount = 0;
+
+
+	/**
+	* Waits till the BCrypt hash has been generated.
+	*
+	* Success will be false if the salt or the strength were invalid, the hash will be empty then.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Bcrypt", meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Wait Till Done", Keywords = "untill for end finished complete completion"))
+	void WaitTillDone(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool& Success_, TArray<uint8>& Hash);
+
+	void LatentActionDone();
+
+	void Done(const TArray<uint8>& Hash);
+
+	/**
+	* Returns true if the BCrypt hash has been generated.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Bcrypt", Meta = (DisplayName = "Is Done", Keywords = "end finished complete completion"))
+	bool IsDone();
+
+	/**
+	* Returns the result.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Bcrypt", Meta = (DisplayName = "Get Result", Keywords = "result return value"))
+	void GetResult(bool& Success_, TArray<uint8>& Hash);
+};
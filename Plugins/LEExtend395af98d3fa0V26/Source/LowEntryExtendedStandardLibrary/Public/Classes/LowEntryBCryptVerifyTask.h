@@ -0,0 +1,75 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+#include "LowEntryBCryptVerifyTask.generated.h"
+
+
+/**
+ * Verifies many passwords against their BCrypt hashes, the checks are spread over all cores and run in the background.
+ */
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryBCryptVerifyTask : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryBCryptVerifyTask* Create(TArray<TArray<uint8>> Passwords, TArray<TArray<uint8>> Salts, TArray<TArray<uint8>> Hashes, const int32 Strength);
+
+
+public:
+	UPROPERTY()
+	bool Finished = false;
+	UPROPERTY()
+	bool Success = false;
+	UPROPERTY()
+	TArray<bool> Result;
+
+	UPROPERTY()
+	int32 KeepAliveCount = 0;
+
+	std::atomic<int32> ChecksDone{0};
+	int32 ChecksTotal = 0;
+	std::atomic<bool> CancelRequested{false};
+
+
+	/**
+	* Waits till every password has been checked.
+	*
+	* Matches has an entry for every password, in the same order. Success will be false if the task was cancelled.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Bcrypt", meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Wait Till Done", Keywords = "untill for end finished complete completion"))
+	void WaitTillDone(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool& Success_, TArray<bool>& Matches);
+
+	void LatentActionDone();
+
+	void Done(const bool Success_, const TArray<bool>& Matches);
+
+	/**
+	* Stops checking passwords, the task will be done with Success set to false.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Bcrypt", Meta = (DisplayName = "Cancel", Keywords = "stop abort"))
+	void Cancel();
+
+	/**
+	* Returns true if every password has been checked, or the task was cancelled.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Bcrypt", Meta = (DisplayName = "Is Done", Keywords = "end finished complete completion"))
+	bool IsDone();
+
+	/**
+	* Returns how many of the passwords have been checked, from 0 to 1.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Bcrypt", Meta = (DisplayName = "Get Progress", Keywords = "percentage done"))
+	double GetProgress();
+
+	/**
+	* Returns the result.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Bcrypt", Meta = (DisplayName = "Get Result", Keywords = "result return value"))
+	void GetResult(bool& Success_, TArray<bool>& Matches);
+};
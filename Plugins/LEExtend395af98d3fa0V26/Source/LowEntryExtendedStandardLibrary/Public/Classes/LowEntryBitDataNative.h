@@ -0,0 +1,330 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "Misc/ByteSwap.h"
+
+
+/**
+ * Writes bit data in the same format as ULowEntryBitDataWriter, without the UObject overhead.
+ *
+ * Bits are written from the lowest to the highest bit of every byte. They're collected in a 64-bit buffer, which is only flushed to the bytes once it's full.
+ */
+class ULowEntryBitDataNativeWriter
+{
+private:
+	TArray<uint8> Bytes;
+	// The bits that aren't in Bytes yet, the first one in the lowest bit, everything above BufferBits is zero
+	uint64 Buffer = 0;
+	int32 BufferBits = 0;
+
+
+public:
+	void Reserve(const int64 BitCount)
+	{
+		Bytes.Reserve(static_cast<int32>(FMath::Min<int64>(Bytes.Num() + ((BitCount + 7) / 8), MAX_int32)));
+	}
+
+	void Reset()
+	{
+		Bytes.Reset();
+		Buffer = 0;
+		BufferBits = 0;
+	}
+
+	int64 NumBits() const { return (static_cast<int64>(Bytes.Num()) * 8) + BufferBits; }
+
+	// The number of bytes written, counting a partially written last byte as a whole one
+	int32 Num() const { return Bytes.Num() + ((BufferBits + 7) / 8); }
+
+	TArray<uint8> GetBytes() const
+	{
+		TArray<uint8> Result;
+		Result.Reserve(Num());
+		Result.Append(Bytes);
+		AppendBuffer(Result);
+		return Result;
+	}
+
+	// Moves the written bytes out of the writer, which leaves the writer empty
+	TArray<uint8> ReleaseBytes()
+	{
+		AppendBuffer(Bytes);
+		Buffer = 0;
+		BufferBits = 0;
+		return MoveTemp(Bytes);
+	}
+
+
+	// Writes the lowest BitCount bits (0 to 64) of Value, the lowest bit first
+	void WriteBits(uint64 Value, const int32 BitCount)
+	{
+		if (BitCount <= 0)
+		{
+			return;
+		}
+		if (BitCount < 64)
+		{
+			Value &= (static_cast<uint64>(1) << BitCount) - 1;
+		}
+		Buffer |= Value << BufferBits;
+		const int32 TotalBits = BufferBits + BitCount;
+		if (TotalBits < 64)
+		{
+			BufferBits = TotalBits;
+			return;
+		}
+		FlushWord(Buffer);
+		Buffer = (BufferBits == 0) ? 0 : (Value >> (64 - BufferBits));
+		BufferBits = TotalBits - 64;
+	}
+
+	void WriteBit(const bool Value)
+	{
+		WriteBits(Value ? 1 : 0, 1);
+	}
+
+	void WriteRawByte(const uint8 Value)
+	{
+		WriteBits(Value, 8);
+	}
+
+	void WriteRawBytes(const TConstArrayView<uint8> Value)
+	{
+		const uint8* Src = Value.GetData();
+		const int32 Count = Value.Num();
+		if ((BufferBits % 8) == 0)
+		{
+			AppendBuffer(Bytes);
+			Buffer = 0;
+			BufferBits = 0;
+			Bytes.Append(Src, Count);
+			return;
+		}
+		int32 i = 0;
+		for (; (i + 8) <= Count; i += 8)
+		{
+			uint64 Word = 0;
+			for (int32 j = 7; j >= 0; j--)
+			{
+				Word = (Word << 8) | Src[i + j];
+			}
+			WriteBits(Word, 64);
+		}
+		for (; i < Count; i++)
+		{
+			WriteBits(Src[i], 8);
+		}
+	}
+
+	// Writes the lowest ByteCount bytes (0 to 8) of Value, the most significant byte first
+	void WriteBigEndian(const uint64 Value, const int32 ByteCount)
+	{
+		if (ByteCount <= 0)
+		{
+			return;
+		}
+		WriteBits(BYTESWAP_ORDER64(Value) >> (64 - (ByteCount * 8)), ByteCount * 8);
+	}
+
+
+private:
+	void FlushWord(const uint64 Word)
+	{
+		const int32 Index = Bytes.AddUninitialized(8);
+		uint8* Dest = Bytes.GetData() + Index;
+		for (int32 i = 0; i < 8; i++)
+		{
+			Dest[i] = static_cast<uint8>(Word >> (i * 8));
+		}
+	}
+
+	void AppendBuffer(TArray<uint8>& Dest) const
+	{
+		for (int32 i = 0; i < BufferBits; i += 8)
+		{
+			Dest.Add(static_cast<uint8>(Buffer >> i));
+		}
+	}
+};
+
+
+/**
+ * Reads bit data in the same format as ULowEntryBitDataReader, without the UObject overhead.
+ *
+ * Reads from a view, the bytes have to stay alive (and unchanged) for as long as the reader is used.
+ * Bytes are loaded into a 64-bit buffer up to 8 at a time, so reading any number of bits is a shift and a mask most of the time.
+ * Reading past the end returns the bits that are left followed by zeroes, and moves the position to the end.
+ */
+class ULowEntryBitDataNativeReader
+{
+private:
+	TConstArrayView<uint8> Bytes;
+	// The next byte to load into Buffer
+	int32 BytePosition = 0;
+	// The loaded bits that haven't been read yet, the next one in the lowest bit, everything above BufferBits is zero
+	uint64 Buffer = 0;
+	int32 BufferBits = 0;
+
+
+public:
+	ULowEntryBitDataNativeReader() {}
+	explicit ULowEntryBitDataNativeReader(const TConstArrayView<uint8> Bytes0, const int64 BitPosition = 0) : Bytes(Bytes0)
+	{
+		SetBitPosition(BitPosition);
+	}
+
+
+	TConstArrayView<uint8> GetBytes() const { return Bytes; }
+	int32 Num() const { return Bytes.Num(); }
+	int64 NumBits() const { return static_cast<int64>(Bytes.Num()) * 8; }
+
+	int64 GetBitPosition() const { return (static_cast<int64>(BytePosition) * 8) - BufferBits; }
+
+	// Clamped to the bits there are
+	void SetBitPosition(const int64 BitPosition)
+	{
+		const int64 Clamped = FMath::Clamp<int64>(BitPosition, 0, NumBits());
+		BytePosition = static_cast<int32>(Clamped / 8);
+		Buffer = 0;
+		BufferBits = 0;
+		const int32 Skip = static_cast<int32>(Clamped % 8);
+		if (Skip > 0)
+		{
+			Buffer = static_cast<uint64>(Bytes[BytePosition] >> Skip);
+			BufferBits = 8 - Skip;
+			BytePosition++;
+		}
+	}
+
+	void Reset() { SetBitPosition(0); }
+	void Empty() { SetBitPosition(NumBits()); }
+
+	int64 RemainingBits() const { return NumBits() - GetBitPosition(); }
+
+	// The number of bytes left, counting a partially read byte as a whole one
+	int32 Remaining() const { return static_cast<int32>((RemainingBits() + 7) / 8); }
+
+	bool IsByteAligned() const { return (BufferBits % 8) == 0; }
+
+
+	// Reads BitCount bits (0 to 64), the first one in the lowest bit of the result
+	uint64 ReadBits(const int32 BitCount)
+	{
+		if (BitCount <= 0)
+		{
+			return 0;
+		}
+		if (BitCount > 56)
+		{
+			const uint64 Low = ReadBits(32);
+			return Low | (ReadBits(BitCount - 32) << 32);
+		}
+		if (BufferBits < BitCount)
+		{
+			Refill();
+			if (BufferBits < BitCount)
+			{
+				// past the end: what's left, the position ends up at the end
+				const uint64 Value = Buffer;
+				Buffer = 0;
+				BufferBits = 0;
+				return Value;
+			}
+		}
+		const uint64 Value = Buffer & ((static_cast<uint64>(1) << BitCount) - 1);
+		Buffer >>= BitCount;
+		BufferBits -= BitCount;
+		return Value;
+	}
+
+	bool ReadBit()
+	{
+		return (ReadBits(1) != 0);
+	}
+
+	uint8 ReadRawByte()
+	{
+		return static_cast<uint8>(ReadBits(8));
+	}
+
+	// Reads Count bytes, which are zero past the end
+	void ReadRawBytes(uint8* Dest, int32 Count)
+	{
+		if (IsByteAligned())
+		{
+			for (; (Count > 0) && (BufferBits > 0); Count--)
+			{
+				*Dest++ = static_cast<uint8>(Buffer);
+				Buffer >>= 8;
+				BufferBits -= 8;
+			}
+			const int32 CopyCount = FMath::Min(Count, Bytes.Num() - BytePosition);
+			if (CopyCount > 0)
+			{
+				FMemory::Memcpy(Dest, Bytes.GetData() + BytePosition, CopyCount);
+				BytePosition += CopyCount;
+				Dest += CopyCount;
+				Count -= CopyCount;
+			}
+			if (Count > 0)
+			{
+				FMemory::Memzero(Dest, Count);
+			}
+			return;
+		}
+		for (; Count >= 7; Count -= 7)
+		{
+			const uint64 Value = ReadBits(56);
+			for (int32 i = 0; i < 7; i++)
+			{
+				*Dest++ = static_cast<uint8>(Value >> (i * 8));
+			}
+		}
+		for (; Count > 0; Count--)
+		{
+			*Dest++ = ReadRawByte();
+		}
+	}
+
+	// Reads ByteCount bytes (0 to 8) as a big-endian number
+	uint64 ReadBigEndian(const int32 ByteCount)
+	{
+		if (ByteCount <= 0)
+		{
+			return 0;
+		}
+		return BYTESWAP_ORDER64(ReadBits(ByteCount * 8)) >> (64 - (ByteCount * 8));
+	}
+
+
+private:
+	// Loads as many whole bytes as fit into Buffer, only called with at most 56 bits in it
+	void Refill()
+	{
+		if ((Bytes.Num() - BytePosition) >= 8)
+		{
+			const uint8* Src = Bytes.GetData() + BytePosition;
+			uint64 Word = 0;
+			for (int32 i = 7; i >= 0; i--)
+			{
+				Word = (Word << 8) | Src[i];
+			}
+			const int32 LoadCount = (63 - BufferBits) / 8;
+			BytePosition += LoadCount;
+			Buffer |= Word << BufferBits;
+			BufferBits += LoadCount * 8;
+			Buffer &= (static_cast<uint64>(1) << BufferBits) - 1;
+			return;
+		}
+		while ((BufferBits <= 56) && (BytePosition < Bytes.Num()))
+		{
+			Buffer |= static_cast<uint64>(Bytes[BytePosition]) << BufferBits;
+			BytePosition++;
+			BufferBits += 8;
+		}
+	}
+};
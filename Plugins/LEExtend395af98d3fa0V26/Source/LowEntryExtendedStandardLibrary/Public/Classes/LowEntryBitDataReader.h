@@ -7,6 +7,8 @@
 
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
+#include "LowEntryByteSlice.h"
+#include "LowEntryBitDataNative.h"
 
 #include "LowEntryBitDataReader.generated.h"
 
@@ -15,13 +17,10 @@ UCLASS(BlueprintType)
 class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryBitDataReader : public UObject
 {
 	GENERATED_UCLASS_BODY()
-private:
-	const static uint8 mask[9];
-
-
 public:
 	static ULowEntryBitDataReader* Create(const TArray<uint8>& Bytes, int32 Index = 0, int32 Length = 0x7FFFFFFF);
-	static ULowEntryBitDataReader* CreateClone(const TArray<uint8>& Bytes, const int32 Position, const uint8 CurrentByte, const int32 CurrentBytePosition);
+	static ULowEntryBitDataReader* Create(const ULowEntryByteSlice& Bytes);
+	static ULowEntryBitDataReader* CreateClone(const ULowEntryByteSlice& Bytes, const int64 BitPosition);
 
 	int32 GetAndIncreasePosition(const int32 Increasement);
 	int32 MaxElementsRemaining(const int32 MinimumSizePerElement);
@@ -32,17 +31,22 @@ protected:
 	uint8 GetRawByte();
 	uint8 GetPartialRawByte(int32 Bits);
 	int32 GetUinteger();
+	TArray<uint8> GetRawBytes(const int32 Length);
+	void SetBytes(const ULowEntryByteSlice& Bytes_, const int64 BitPosition = 0);
+
+
+protected:
+	// Clones share the same buffer
+	ULowEntryByteSlice Bytes;
+	// Reads from Bytes, holds the position
+	ULowEntryBitDataNativeReader Reader;
 
 
 public:
-	UPROPERTY()
-	TArray<uint8> Bytes;
-	UPROPERTY()
-	int32 Position = 0;
-	UPROPERTY()
-	uint8 CurrentByte = 0;
-	UPROPERTY()
-	int32 CurrentBytePosition = 0;
+	const ULowEntryByteSlice& GetSlice() const { return Bytes; }
+
+	// For reading with ReadBits, stays valid as long as this BitDataReader does
+	ULowEntryBitDataNativeReader& GetNativeReader() { return Reader; }
 
 
 	/**
@@ -7,6 +7,7 @@
 
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
+#include "LowEntryBitDataNative.h"
 
 #include "LowEntryBitDataWriter.generated.h"
 
@@ -18,10 +19,6 @@ UCLASS(BlueprintType)
 class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryBitDataWriter : public UObject
 {
 	GENERATED_UCLASS_BODY()
-private:
-	const static uint8 mask[9];
-
-
 public:
 	static ULowEntryBitDataWriter* Create();
 	static ULowEntryBitDataWriter* CreateFromEntryArray(const TArray<ULowEntryBitDataEntry*>& Array);
@@ -37,12 +34,7 @@ protected:
 
 
 public:
-	UPROPERTY()
-	TArray<uint8> Bytes;
-	UPROPERTY()
-	uint8 CurrentByte = 0;
-	UPROPERTY()
-	int32 CurrentBytePosition = 0;
+	ULowEntryBitDataNativeWriter Writer;
 
 
 	/**
@@ -0,0 +1,34 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+
+/**
+ * Bulk conversion of 32-bit and 64-bit values between native and big-endian (byte data) order.
+ *
+ * Byte-swaps whole blocks with SIMD where the CPU supports it (AVX2 on x86, NEON on ARM), and is a plain memcpy on big-endian platforms.
+ * Swapping is its own inverse, so the same functions are used for writing and reading. Dest and Src don't need to be aligned, but can't overlap.
+ */
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryByteDataBulk
+{
+public:
+	static void CopyBigEndian32(void* Dest, const void* Src, const int32 Count);
+	static void CopyBigEndian64(void* Dest, const void* Src, const int32 Count);
+
+	template<int32 ValueSize>
+	static void CopyBigEndian(void* Dest, const void* Src, const int32 Count)
+	{
+		static_assert((ValueSize == 4) || (ValueSize == 8), "CopyBigEndian only supports 32-bit and 64-bit values");
+		if constexpr (ValueSize == 4)
+		{
+			CopyBigEndian32(Dest, Src, Count);
+		}
+		else
+		{
+			CopyBigEndian64(Dest, Src, Count);
+		}
+	}
+};
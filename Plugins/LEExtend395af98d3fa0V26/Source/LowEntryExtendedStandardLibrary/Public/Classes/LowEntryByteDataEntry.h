@@ -7,6 +7,7 @@
 
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
+#include "LowEntryByteDataNative.h"
 
 #include "LowEntryByteDataEntry.generated.h"
 
@@ -97,6 +98,12 @@ public:
 	TArray<FString> StringUtf8ArrayValue;
 
 
+public:
+	// The number of bytes WriteTo writes
+	int64 GetSize();
+	void WriteTo(ULowEntryByteDataNativeWriter& Writer);
+
+
 public:
 	bool IsByte();
 	void SetByte(const uint8 Value);
@@ -0,0 +1,870 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LowEntryByteDataBulk.h"
+
+
+/**
+ * The wire format of a type in byte data, used by Write<T> and Read<T> of the native writer and reader.
+ *
+ * Specialized for uint8, int32, int64, float, double, bool, FString, and TArrays of those.
+ * Arrays of int32, int64, float and double are written and read in bulk, see ULowEntryByteDataBulk.
+ * Specialize it for your own types to make them writable and readable as well, it needs:
+ *
+ * - static int64 GetSize(const T& Value): the number of bytes Encode writes
+ * - static void Encode(uint8*& Dest, const T& Value): writes the value, moves Dest to the end of it
+ * - static T Read(ULowEntryByteDataNativeReader& Reader)
+ * - constexpr static int32 MINIMUM_SIZE: the least bytes a value can take, used to cap the length of arrays read from malformed data
+ */
+template<typename T>
+struct TLowEntryByteDataType;
+
+
+/**
+ * Writes byte data in the same format as ULowEntryByteDataWriter, without the UObject overhead.
+ *
+ * Every write grows the buffer once, by the full size of the value (so an array of values causes one allocation at most).
+ * Serialize and Reserve with GetSize allow reserving the final size of the whole data up front.
+ */
+class ULowEntryByteDataNativeWriter
+{
+private:
+	TArray<uint8> Bytes;
+
+
+public:
+	ULowEntryByteDataNativeWriter() {}
+	explicit ULowEntryByteDataNativeWriter(const int64 ReserveSize)
+	{
+		Reserve(ReserveSize);
+	}
+
+
+	void Reserve(const int64 Size)
+	{
+		Bytes.Reserve(static_cast<int32>(FMath::Min<int64>(Bytes.Num() + Size, MAX_int32)));
+	}
+
+	void Reset()
+	{
+		Bytes.Reset();
+	}
+
+	int32 Num() const { return Bytes.Num(); }
+	const TArray<uint8>& GetBytes() const { return Bytes; }
+
+	// Moves the written bytes out of the writer, which leaves the writer empty
+	TArray<uint8> ReleaseBytes() { return MoveTemp(Bytes); }
+
+
+	template<typename T>
+	void Write(const T& Value)
+	{
+		uint8* Dest = AddUninitialized(TLowEntryByteDataType<T>::GetSize(Value));
+		TLowEntryByteDataType<T>::Encode(Dest, Value);
+	}
+
+	void WriteRawByte(const uint8 Value)
+	{
+		Bytes.Add(Value);
+	}
+
+	void WriteRawBytes(const TConstArrayView<uint8> Value)
+	{
+		Bytes.Append(Value.GetData(), Value.Num());
+	}
+
+	void WriteUinteger(const int32 Value)
+	{
+		uint8* Dest = AddUninitialized(GetUintegerSize(Value));
+		EncodeUinteger(Dest, Value);
+	}
+
+	void WritePositiveInteger1(const int32 Value)
+	{
+		WriteUinteger(Value);
+	}
+
+	void WritePositiveInteger2(const int32 Value)
+	{
+		uint8* Dest = AddUninitialized(GetPositiveInteger2Size(Value));
+		EncodePositiveInteger2(Dest, Value);
+	}
+
+	void WritePositiveInteger3(const int32 Value)
+	{
+		uint8* Dest = AddUninitialized(GetPositiveInteger3Size(Value));
+		EncodePositiveInteger3(Dest, Value);
+	}
+
+	void WritePositiveInteger1Array(const TConstArrayView<int32> Values)
+	{
+		WritePositiveIntegerArray(Values, &GetUintegerSize, &EncodeUinteger);
+	}
+
+	void WritePositiveInteger2Array(const TConstArrayView<int32> Values)
+	{
+		WritePositiveIntegerArray(Values, &GetPositiveInteger2Size, &EncodePositiveInteger2);
+	}
+
+	void WritePositiveInteger3Array(const TConstArrayView<int32> Values)
+	{
+		WritePositiveIntegerArray(Values, &GetPositiveInteger3Size, &EncodePositiveInteger3);
+	}
+
+
+	// Returns the bytes of the given values written after each other, with the buffer allocated once at its final size
+	template<typename... T>
+	static TArray<uint8> Serialize(const T&... Values)
+	{
+		ULowEntryByteDataNativeWriter Writer(GetSize(Values...));
+		(Writer.Write(Values), ...);
+		return Writer.ReleaseBytes();
+	}
+
+	// Returns the number of bytes writing the given values takes
+	template<typename... T>
+	static int64 GetSize(const T&... Values)
+	{
+		return (static_cast<int64>(0) + ... + TLowEntryByteDataType<T>::GetSize(Values));
+	}
+
+
+public:
+	static int32 GetUintegerSize(const int32 Value)
+	{
+		return (Value < 128) ? 1 : 4;
+	}
+
+	static int32 GetPositiveInteger2Size(const int32 Value)
+	{
+		return (Value < 32768) ? 2 : 4;
+	}
+
+	static int32 GetPositiveInteger3Size(const int32 Value)
+	{
+		return (Value < 8388608) ? 3 : 4;
+	}
+
+	static int64 GetPositiveInteger1ArraySize(const TConstArrayView<int32> Values)
+	{
+		return GetPositiveIntegerArraySize(Values, &GetUintegerSize);
+	}
+
+	static int64 GetPositiveInteger2ArraySize(const TConstArrayView<int32> Values)
+	{
+		return GetPositiveIntegerArraySize(Values, &GetPositiveInteger2Size);
+	}
+
+	static int64 GetPositiveInteger3ArraySize(const TConstArrayView<int32> Values)
+	{
+		return GetPositiveIntegerArraySize(Values, &GetPositiveInteger3Size);
+	}
+
+	static void EncodeInteger(uint8*& Dest, const int32 Value)
+	{
+		Dest[0] = static_cast<uint8>(Value >> 24);
+		Dest[1] = static_cast<uint8>(Value >> 16);
+		Dest[2] = static_cast<uint8>(Value >> 8);
+		Dest[3] = static_cast<uint8>(Value);
+		Dest += 4;
+	}
+
+	static void EncodeLong(uint8*& Dest, const int64 Value)
+	{
+		EncodeInteger(Dest, static_cast<int32>(Value >> 32));
+		EncodeInteger(Dest, static_cast<int32>(Value));
+	}
+
+	// The 4 byte form of the variable length integers, which has the highest bit set
+	static void EncodeFlaggedInteger(uint8*& Dest, const int32 Value)
+	{
+		Dest[0] = static_cast<uint8>((Value >> 24) | (1 << 7));
+		Dest[1] = static_cast<uint8>(Value >> 16);
+		Dest[2] = static_cast<uint8>(Value >> 8);
+		Dest[3] = static_cast<uint8>(Value);
+		Dest += 4;
+	}
+
+	// The length prefix of strings and arrays, 1 byte below 128, 4 bytes with the highest bit set otherwise
+	static void EncodeUinteger(uint8*& Dest, const int32 Value)
+	{
+		if (Value <= 0)
+		{
+			*Dest++ = 0;
+		}
+		else if (Value < 128)
+		{
+			*Dest++ = static_cast<uint8>(Value);
+		}
+		else
+		{
+			EncodeFlaggedInteger(Dest, Value);
+		}
+	}
+
+	static void EncodePositiveInteger2(uint8*& Dest, const int32 Value)
+	{
+		if (Value <= 0)
+		{
+			*Dest++ = 0;
+			*Dest++ = 0;
+		}
+		else if (Value < 32768)
+		{
+			*Dest++ = static_cast<uint8>(Value >> 8);
+			*Dest++ = static_cast<uint8>(Value);
+		}
+		else
+		{
+			EncodeFlaggedInteger(Dest, Value);
+		}
+	}
+
+	static void EncodePositiveInteger3(uint8*& Dest, const int32 Value)
+	{
+		if (Value <= 0)
+		{
+			*Dest++ = 0;
+			*Dest++ = 0;
+			*Dest++ = 0;
+		}
+		else if (Value < 8388608)
+		{
+			*Dest++ = static_cast<uint8>(Value >> 16);
+			*Dest++ = static_cast<uint8>(Value >> 8);
+			*Dest++ = static_cast<uint8>(Value);
+		}
+		else
+		{
+			EncodeFlaggedInteger(Dest, Value);
+		}
+	}
+
+
+private:
+	uint8* AddUninitialized(const int64 Size)
+	{
+		checkf(Size <= (MAX_int32 - Bytes.Num()), TEXT("ULowEntryByteDataNativeWriter can't hold more than MAX_int32 bytes"));
+		const int32 Index = Bytes.AddUninitialized(static_cast<int32>(Size));
+		return Bytes.GetData() + Index;
+	}
+
+	static int64 GetPositiveIntegerArraySize(const TConstArrayView<int32> Values, int32 (*GetValueSize)(int32))
+	{
+		int64 Size = GetUintegerSize(Values.Num());
+		for (const int32 Value : Values)
+		{
+			Size += GetValueSize(Value);
+		}
+		return Size;
+	}
+
+	void WritePositiveIntegerArray(const TConstArrayView<int32> Values, int32 (*GetValueSize)(int32), void (*EncodeValue)(uint8*&, int32))
+	{
+		uint8* Dest = AddUninitialized(GetPositiveIntegerArraySize(Values, GetValueSize));
+		EncodeUinteger(Dest, Values.Num());
+		for (const int32 Value : Values)
+		{
+			EncodeValue(Dest, Value);
+		}
+	}
+};
+
+
+/**
+ * Reads byte data in the same format as ULowEntryByteDataReader, without the UObject overhead.
+ *
+ * Reads from a view, the bytes have to stay alive (and unchanged) for as long as the reader is used.
+ * Reading past the end (or reading malformed data) never fails: it returns zeroes and empty values, the same as ULowEntryByteDataReader.
+ */
+class ULowEntryByteDataNativeReader
+{
+private:
+	TConstArrayView<uint8> Bytes;
+	int32 Position = 0;
+
+
+public:
+	ULowEntryByteDataNativeReader() {}
+	explicit ULowEntryByteDataNativeReader(const TConstArrayView<uint8> Bytes0, const int32 Position0 = 0) : Bytes(Bytes0), Position(Position0) {}
+
+
+	TConstArrayView<uint8> GetBytes() const { return Bytes; }
+	int32 Num() const { return Bytes.Num(); }
+
+	int32 GetPosition() const { return Position; }
+	void SetPosition(const int32 Position0) { Position = Position0; }
+	void Reset() { Position = 0; }
+	void Empty() { Position = Bytes.Num(); }
+	int32 Remaining() const { return Bytes.Num() - Position; }
+
+	// Returns the current position and moves it ahead by Increasement, to the end at most
+	int32 GetAndIncreasePosition(const int32 Increasement)
+	{
+		const int32 Pos = Position;
+		if ((Bytes.Num() - Increasement) <= Position)
+		{
+			Position = Bytes.Num();
+		}
+		else
+		{
+			Position += Increasement;
+		}
+		return Pos;
+	}
+
+	// The most elements an array could have with the bytes left, used to cap the length of arrays read from malformed data
+	int32 MaxElementsRemaining(const int32 MinimumSizePerElement) const
+	{
+		const int32 RemainingCount = Remaining();
+		if (RemainingCount <= 0)
+		{
+			return 0;
+		}
+		if (MinimumSizePerElement <= 1)
+		{
+			return RemainingCount;
+		}
+		return (RemainingCount / MinimumSizePerElement) + 1;
+	}
+
+
+	template<typename T>
+	T Read()
+	{
+		return TLowEntryByteDataType<T>::Read(*this);
+	}
+
+	uint8 ReadByte()
+	{
+		const int32 Pos = GetAndIncreasePosition(1);
+		if ((Pos < 0) || (Bytes.Num() <= Pos))
+		{
+			return 0;
+		}
+		return Bytes[Pos];
+	}
+
+	// Reads Size bytes as a big-endian number, or fewer if there aren't that many left (like ULowEntryExtendedStandardLibrary::BytesToLong does)
+	int64 ReadBigEndian(const int32 Size)
+	{
+		int32 Pos = GetAndIncreasePosition(Size);
+		if (Bytes.Num() <= Pos)
+		{
+			return 0;
+		}
+		int32 Length = Size;
+		if (Pos < 0)
+		{
+			Length += Pos;
+			Pos = 0;
+		}
+		Length = FMath::Min(Length, Bytes.Num() - Pos);
+
+		uint64 Value = 0;
+		for (int32 i = 0; i < Length; i++)
+		{
+			Value = (Value << 8) | Bytes[Pos + i];
+		}
+		return static_cast<int64>(Value);
+	}
+
+	int32 ReadUinteger()
+	{
+		const int32 Pos = GetAndIncreasePosition(1);
+		if ((Pos < 0) || (Bytes.Num() <= Pos))
+		{
+			return 0;
+		}
+		const uint8 B = Bytes[Pos];
+		if (((B >> 7) & 1) == 0)
+		{
+			return B;
+		}
+
+		const int32 Pos2 = GetAndIncreasePosition(3);
+		if (Bytes.Num() <= (Pos2 + 2))
+		{
+			return 0;
+		}
+		const int32 Value = ((B & ~(1 << 7)) << 24) | (Bytes[Pos2 + 0] << 16) | (Bytes[Pos2 + 1] << 8) | Bytes[Pos2 + 2];
+		if (Value < 128)
+		{
+			return 0;
+		}
+		return Value;
+	}
+
+	int32 ReadPositiveInteger1()
+	{
+		return ReadUinteger();
+	}
+
+	int32 ReadPositiveInteger2()
+	{
+		const int32 Pos = GetAndIncreasePosition(2);
+		if ((Pos < 0) || (Bytes.Num() <= (Pos + 1)))
+		{
+			return 0;
+		}
+		const uint8 B1 = Bytes[Pos + 0];
+		const uint8 B2 = Bytes[Pos + 1];
+		if (((B1 >> 7) & 1) == 0)
+		{
+			return (B1 << 8) | B2;
+		}
+
+		const int32 Pos2 = GetAndIncreasePosition(2);
+		if (Bytes.Num() <= (Pos2 + 1))
+		{
+			return 0;
+		}
+		const int32 Value = ((B1 & ~(1 << 7)) << 24) | (B2 << 16) | (Bytes[Pos2 + 0] << 8) | Bytes[Pos2 + 1];
+		if (Value < 32768)
+		{
+			return 0;
+		}
+		return Value;
+	}
+
+	int32 ReadPositiveInteger3()
+	{
+		const int32 Pos = GetAndIncreasePosition(3);
+		if ((Pos < 0) || (Bytes.Num() <= (Pos + 2)))
+		{
+			return 0;
+		}
+		const uint8 B1 = Bytes[Pos + 0];
+		const uint8 B2 = Bytes[Pos + 1];
+		const uint8 B3 = Bytes[Pos + 2];
+		if (((B1 >> 7) & 1) == 0)
+		{
+			return (B1 << 16) | (B2 << 8) | B3;
+		}
+
+		const int32 Pos2 = GetAndIncreasePosition(1);
+		if (Bytes.Num() <= Pos2)
+		{
+			return 0;
+		}
+		const int32 Value = ((B1 & ~(1 << 7)) << 24) | (B2 << 16) | (B3 << 8) | Bytes[Pos2];
+		if (Value < 8388608)
+		{
+			return 0;
+		}
+		return Value;
+	}
+
+	TArray<int32> ReadPositiveInteger1Array()
+	{
+		return ReadArray<int32>(1, [](ULowEntryByteDataNativeReader& Reader) { return Reader.ReadPositiveInteger1(); });
+	}
+
+	TArray<int32> ReadPositiveInteger2Array()
+	{
+		return ReadArray<int32>(2, [](ULowEntryByteDataNativeReader& Reader) { return Reader.ReadPositiveInteger2(); });
+	}
+
+	TArray<int32> ReadPositiveInteger3Array()
+	{
+		return ReadArray<int32>(3, [](ULowEntryByteDataNativeReader& Reader) { return Reader.ReadPositiveInteger3(); });
+	}
+
+	// Reads a byte array without copying it, the view points into the bytes of this reader
+	TConstArrayView<uint8> ReadByteArrayView()
+	{
+		const int32 Length = ReadUinteger();
+		if (Length <= 0)
+		{
+			return TConstArrayView<uint8>();
+		}
+		const int32 Pos = GetAndIncreasePosition(Length);
+		if ((Pos < 0) || (Bytes.Num() <= Pos))
+		{
+			return TConstArrayView<uint8>();
+		}
+		return Bytes.Slice(Pos, FMath::Min(Length, Bytes.Num() - Pos));
+	}
+
+	// Reads the length of an array, then every element with ReadElement
+	template<typename T, typename FunctionType>
+	TArray<T> ReadArray(const int32 MinimumSizePerElement, FunctionType&& ReadElement)
+	{
+		int32 Length = ReadUinteger();
+		Length = FMath::Min(Length, MaxElementsRemaining(MinimumSizePerElement));
+		if (Length <= 0)
+		{
+			return TArray<T>();
+		}
+		TArray<T> Array;
+		Array.Reserve(Length);
+		for (int32 i = 0; i < Length; i++)
+		{
+			Array.Add(ReadElement(*this));
+		}
+		return Array;
+	}
+
+	// Reads an array of 4 or 8 byte numbers: checks the bounds once, then byte-swaps every whole element in one go
+	template<typename T>
+	TArray<T> ReadFixedSizeArray()
+	{
+		int32 Length = ReadUinteger();
+		Length = FMath::Min(Length, MaxElementsRemaining(static_cast<int32>(sizeof(T))));
+		if (Length <= 0)
+		{
+			return TArray<T>();
+		}
+		TArray<T> Array;
+		Array.SetNumUninitialized(Length);
+		int32 WholeCount = 0;
+		if (Position >= 0)
+		{
+			WholeCount = FMath::Min(Length, Remaining() / static_cast<int32>(sizeof(T)));
+			ULowEntryByteDataBulk::CopyBigEndian<sizeof(T)>(Array.GetData(), Bytes.GetData() + Position, WholeCount);
+			Position += WholeCount * static_cast<int32>(sizeof(T));
+		}
+		for (int32 i = WholeCount; i < Length; i++)
+		{
+			// a cut off last element, or the zeroes past the end
+			Array[i] = TLowEntryByteDataType<T>::Read(*this);
+		}
+		return Array;
+	}
+
+
+	static int32 SafeMultiply(const int32 A, const int32 B)
+	{
+		return static_cast<int32>(FMath::Clamp<int64>(static_cast<int64>(A) * static_cast<int64>(B), MIN_int32, MAX_int32));
+	}
+};
+
+
+template<>
+struct TLowEntryByteDataType<uint8>
+{
+	constexpr static int32 MINIMUM_SIZE = 1;
+
+	static int64 GetSize(const uint8 Value)
+	{
+		return 1;
+	}
+
+	static void Encode(uint8*& Dest, const uint8 Value)
+	{
+		*Dest++ = Value;
+	}
+
+	static uint8 Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		return Reader.ReadByte();
+	}
+};
+
+template<>
+struct TLowEntryByteDataType<int32>
+{
+	constexpr static int32 MINIMUM_SIZE = 4;
+
+	static int64 GetSize(const int32 Value)
+	{
+		return 4;
+	}
+
+	static void Encode(uint8*& Dest, const int32 Value)
+	{
+		ULowEntryByteDataNativeWriter::EncodeInteger(Dest, Value);
+	}
+
+	static int32 Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		return static_cast<int32>(Reader.ReadBigEndian(4));
+	}
+};
+
+template<>
+struct TLowEntryByteDataType<int64>
+{
+	constexpr static int32 MINIMUM_SIZE = 8;
+
+	static int64 GetSize(const int64 Value)
+	{
+		return 8;
+	}
+
+	static void Encode(uint8*& Dest, const int64 Value)
+	{
+		ULowEntryByteDataNativeWriter::EncodeLong(Dest, Value);
+	}
+
+	static int64 Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		return Reader.ReadBigEndian(8);
+	}
+};
+
+template<>
+struct TLowEntryByteDataType<float>
+{
+	constexpr static int32 MINIMUM_SIZE = 4;
+
+	static int64 GetSize(const float Value)
+	{
+		return 4;
+	}
+
+	static void Encode(uint8*& Dest, const float Value)
+	{
+		ULowEntryByteDataNativeWriter::EncodeInteger(Dest, *reinterpret_cast<const int32*>(&Value));
+	}
+
+	static float Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		const int32 IntValue = static_cast<int32>(Reader.ReadBigEndian(4));
+		return *reinterpret_cast<const float*>(&IntValue);
+	}
+};
+
+template<>
+struct TLowEntryByteDataType<double>
+{
+	constexpr static int32 MINIMUM_SIZE = 8;
+
+	static int64 GetSize(const double Value)
+	{
+		return 8;
+	}
+
+	static void Encode(uint8*& Dest, const double Value)
+	{
+		ULowEntryByteDataNativeWriter::EncodeLong(Dest, *reinterpret_cast<const int64*>(&Value));
+	}
+
+	static double Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		const int64 LongValue = Reader.ReadBigEndian(8);
+		return *reinterpret_cast<const double*>(&LongValue);
+	}
+};
+
+template<>
+struct TLowEntryByteDataType<bool>
+{
+	constexpr static int32 MINIMUM_SIZE = 1;
+
+	static int64 GetSize(const bool Value)
+	{
+		return 1;
+	}
+
+	static void Encode(uint8*& Dest, const bool Value)
+	{
+		*Dest++ = (Value ? 0x01 : 0x00);
+	}
+
+	static bool Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		return (Reader.ReadByte() == 0x01);
+	}
+};
+
+// UTF-8, prefixed with its length in bytes
+template<>
+struct TLowEntryByteDataType<FString>
+{
+	constexpr static int32 MINIMUM_SIZE = 1;
+
+	static int64 GetSize(const FString& Value)
+	{
+		const int32 Length = GetUtf8Length(Value);
+		return ULowEntryByteDataNativeWriter::GetUintegerSize(Length) + Length;
+	}
+
+	static void Encode(uint8*& Dest, const FString& Value)
+	{
+		const int32 Length = GetUtf8Length(Value);
+		ULowEntryByteDataNativeWriter::EncodeUinteger(Dest, Length);
+		if (Length > 0)
+		{
+			FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Dest), Length, *Value, FCString::Strlen(*Value));
+			Dest += Length;
+		}
+	}
+
+	static FString Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		const TConstArrayView<uint8> Bytes = Reader.ReadByteArrayView();
+		if (Bytes.Num() <= 0)
+		{
+			return TEXT("");
+		}
+		const FUTF8ToTCHAR Src(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+		return FString(Src.Length(), Src.Get());
+	}
+
+	// Stops at the first null character, like ULowEntryExtendedStandardLibrary::StringToBytesUtf8 does
+	static int32 GetUtf8Length(const FString& Value)
+	{
+		return FPlatformString::ConvertedLength<UTF8CHAR>(*Value, FCString::Strlen(*Value));
+	}
+};
+
+// Byte arrays are written as they are, prefixed with their length
+template<>
+struct TLowEntryByteDataType<TArray<uint8>>
+{
+	constexpr static int32 MINIMUM_SIZE = 1;
+
+	static int64 GetSize(const TArray<uint8>& Value)
+	{
+		return ULowEntryByteDataNativeWriter::GetUintegerSize(Value.Num()) + Value.Num();
+	}
+
+	static void Encode(uint8*& Dest, const TArray<uint8>& Value)
+	{
+		ULowEntryByteDataNativeWriter::EncodeUinteger(Dest, Value.Num());
+		if (Value.Num() > 0)
+		{
+			FMemory::Memcpy(Dest, Value.GetData(), Value.Num());
+			Dest += Value.Num();
+		}
+	}
+
+	static TArray<uint8> Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		return TArray<uint8>(Reader.ReadByteArrayView());
+	}
+};
+
+// Booleans are packed 8 in a byte, the first one in the highest bit
+template<>
+struct TLowEntryByteDataType<TArray<bool>>
+{
+	constexpr static int32 MINIMUM_SIZE = 1;
+
+	static int64 GetSize(const TArray<bool>& Value)
+	{
+		return ULowEntryByteDataNativeWriter::GetUintegerSize(Value.Num()) + ((Value.Num() + 7) / 8);
+	}
+
+	static void Encode(uint8*& Dest, const TArray<bool>& Value)
+	{
+		ULowEntryByteDataNativeWriter::EncodeUinteger(Dest, Value.Num());
+		uint8 B = 0;
+		int32 BIndex = 0;
+		for (const bool V : Value)
+		{
+			if (V)
+			{
+				B |= (1 << (7 - BIndex));
+			}
+			BIndex++;
+			if (BIndex == 8)
+			{
+				*Dest++ = B;
+				B = 0;
+				BIndex = 0;
+			}
+		}
+		if (BIndex > 0)
+		{
+			*Dest++ = B;
+		}
+	}
+
+	static TArray<bool> Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		int32 Length = Reader.ReadUinteger();
+		Length = FMath::Min(Length, ULowEntryByteDataNativeReader::SafeMultiply(Reader.MaxElementsRemaining(1), 8));
+		if (Length <= 0)
+		{
+			return TArray<bool>();
+		}
+		TArray<bool> Array;
+		Array.SetNum(Length);
+		for (int32 i = 0; i < Length; i += 8)
+		{
+			const uint8 B = Reader.ReadByte();
+			const int32 BCount = FMath::Min(8, Length - i);
+			for (int32 BIndex = 0; BIndex < BCount; BIndex++)
+			{
+				Array[i + BIndex] = (((B >> (7 - BIndex)) & 1) != 0);
+			}
+		}
+		return Array;
+	}
+};
+
+// Arrays of 4 or 8 byte numbers: their length, followed by every element, converted to big-endian in bulk
+template<typename T>
+struct TLowEntryByteDataFixedSizeArrayType
+{
+	static_assert((sizeof(T) == 4) || (sizeof(T) == 8), "TLowEntryByteDataFixedSizeArrayType only supports 4 and 8 byte types");
+
+	constexpr static int32 MINIMUM_SIZE = 1;
+
+	static int64 GetSize(const TArray<T>& Value)
+	{
+		return ULowEntryByteDataNativeWriter::GetUintegerSize(Value.Num()) + (static_cast<int64>(Value.Num()) * sizeof(T));
+	}
+
+	static void Encode(uint8*& Dest, const TArray<T>& Value)
+	{
+		ULowEntryByteDataNativeWriter::EncodeUinteger(Dest, Value.Num());
+		ULowEntryByteDataBulk::CopyBigEndian<sizeof(T)>(Dest, Value.GetData(), Value.Num());
+		Dest += static_cast<int64>(Value.Num()) * sizeof(T);
+	}
+
+	static TArray<T> Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		return Reader.ReadFixedSizeArray<T>();
+	}
+};
+
+template<>
+struct TLowEntryByteDataType<TArray<int32>> : TLowEntryByteDataFixedSizeArrayType<int32> {};
+
+template<>
+struct TLowEntryByteDataType<TArray<int64>> : TLowEntryByteDataFixedSizeArrayType<int64> {};
+
+template<>
+struct TLowEntryByteDataType<TArray<float>> : TLowEntryByteDataFixedSizeArrayType<float> {};
+
+template<>
+struct TLowEntryByteDataType<TArray<double>> : TLowEntryByteDataFixedSizeArrayType<double> {};
+
+// Any other array: its length, followed by every element
+template<typename T>
+struct TLowEntryByteDataType<TArray<T>>
+{
+	constexpr static int32 MINIMUM_SIZE = 1;
+
+	static int64 GetSize(const TArray<T>& Value)
+	{
+		int64 Size = ULowEntryByteDataNativeWriter::GetUintegerSize(Value.Num());
+		for (const T& V : Value)
+		{
+			Size += TLowEntryByteDataType<T>::GetSize(V);
+		}
+		return Size;
+	}
+
+	static void Encode(uint8*& Dest, const TArray<T>& Value)
+	{
+		ULowEntryByteDataNativeWriter::EncodeUinteger(Dest, Value.Num());
+		for (const T& V : Value)
+		{
+			TLowEntryByteDataType<T>::Encode(Dest, V);
+		}
+	}
+
+	static TArray<T> Read(ULowEntryByteDataNativeReader& Reader)
+	{
+		return Reader.ReadArray<T>(TLowEntryByteDataType<T>::MINIMUM_SIZE, [](ULowEntryByteDataNativeReader& ElementReader) { return TLowEntryByteDataType<T>::Read(ElementReader); });
+	}
+};
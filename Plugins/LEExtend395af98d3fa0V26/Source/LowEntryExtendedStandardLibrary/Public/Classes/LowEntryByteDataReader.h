@@ -7,6 +7,8 @@
 
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
+#include "LowEntryByteSlice.h"
+#include "LowEntryByteDataNative.h"
 
 #include "LowEntryByteDataReader.generated.h"
 
@@ -17,7 +19,10 @@ class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryByteDataReader : public UObje
 	GENERATED_UCLASS_BODY()
 public:
 	static ULowEntryByteDataReader* Create(const TArray<uint8>& Bytes, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+	static ULowEntryByteDataReader* Create(TArray<uint8>&& Bytes);
+	static ULowEntryByteDataReader* Create(const ULowEntryByteSlice& Bytes);
 	static ULowEntryByteDataReader* CreateClone(const TArray<uint8>& Bytes, const int32 Position);
+	static ULowEntryByteDataReader* CreateClone(const ULowEntryByteSlice& Bytes, const int32 Position);
 
 	int32 GetAndIncreasePosition(const int32 Increasement);
 	int32 MaxElementsRemaining(const int32 MinimumSizePerElement);
@@ -25,13 +30,32 @@ public:
 
 protected:
 	int32 GetUinteger();
+	void SetBytes(const ULowEntryByteSlice& Bytes_, const int32 Position_ = 0);
+
+
+protected:
+	// Readers created from each other (clones, byte array readers) share the same buffer
+	ULowEntryByteSlice Bytes;
+	// Reads from Bytes, holds the position
+	ULowEntryByteDataNativeReader Reader;
 
 
 public:
-	UPROPERTY()
-	TArray<uint8> Bytes;
-	UPROPERTY()
-	int32 Position = 0;
+	const ULowEntryByteSlice& GetSlice() const { return Bytes; }
+
+	// For reading with Read<T>, stays valid as long as this ByteDataReader does
+	ULowEntryByteDataNativeReader& GetNativeReader() { return Reader; }
+
+
+	/**
+	* Gets a byte array, as a slice of the bytes of this reader (doesn't copy the bytes).
+	*/
+	ULowEntryByteSlice GetByteArraySlice();
+
+	/**
+	* Returns the bytes left, as a slice of the bytes of this reader (doesn't copy the bytes), without changing the position.
+	*/
+	ULowEntryByteSlice GetRemainingSlice();
 
 
 	/**
@@ -152,6 +176,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get Byte Array"))
 	TArray<uint8> GetByteArray();
 
+	/**
+	* Gets a byte array, and returns a ByteDataReader that reads from it.
+	* 
+	* Doesn't copy the bytes, which makes this a lot faster than Get Byte Array for reading nested data.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get Byte Array (Reader)", Keywords = "nested slice"))
+	ULowEntryByteDataReader* GetByteArrayReader();
+
 	/**
 	* Gets an integer array.
 	*/
@@ -7,6 +7,7 @@
 
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
+#include "LowEntryByteDataNative.h"
 
 #include "LowEntryByteDataWriter.generated.h"
 
@@ -31,8 +32,7 @@ protected:
 
 
 public:
-	UPROPERTY()
-	TArray<uint8> Bytes;
+	ULowEntryByteDataNativeWriter Writer;
 
 
 	/**
@@ -0,0 +1,40 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LowEntryByteSlice.h"
+
+
+/**
+ * Concatenates bytes without copying them: every append only adds a slice to a list of segments.
+ *
+ * The bytes are copied once, by Flatten, into an array that's allocated at its final size.
+ */
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryByteRope
+{
+private:
+	TArray<ULowEntryByteSlice> Segments;
+	int32 Length = 0;
+
+
+public:
+	void Append(const ULowEntryByteSlice& Bytes);
+	void Append(TArray<uint8>&& Bytes); // takes over the array, without copying
+	void Append(const TArray<uint8>& Bytes, int32 Index = 0, int32 BytesLength = 0x7FFFFFFF); // copies the given part of the array once
+	void Append(const ULowEntryByteRope& Rope);
+
+	void Reset();
+
+	int32 Num() const { return Length; }
+	bool IsEmpty() const { return (Length <= 0); }
+	const TArray<ULowEntryByteSlice>& GetSegments() const { return Segments; }
+
+	TArray<uint8> Flatten() const;
+	void FlattenTo(uint8* Destination) const; // Destination has to have room for Num() bytes
+
+	// Returns the only segment as it is if there's just one, flattens into a new buffer otherwise
+	ULowEntryByteSlice FlattenToSlice() const;
+};
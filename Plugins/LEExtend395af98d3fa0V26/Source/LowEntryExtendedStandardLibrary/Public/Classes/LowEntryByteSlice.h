@@ -0,0 +1,58 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+
+/**
+ * A view of a part of a ref-counted, immutable byte buffer.
+ *
+ * Slicing, splitting and copying a slice only copies the pointer to the buffer (and bumps its ref-count), never the bytes themselves.
+ * The buffer is freed once the last slice of it is gone. Slices can be passed between threads freely.
+ *
+ * Index and Length parameters are clamped the same way as in ULowEntryExtendedStandardLibrary::BytesSubArray.
+ */
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryByteSlice
+{
+public:
+	typedef TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> FBuffer;
+
+
+private:
+	FBuffer Buffer;
+	int32 Offset = 0;
+	int32 Length = 0;
+
+
+public:
+	ULowEntryByteSlice();
+	explicit ULowEntryByteSlice(TArray<uint8>&& Bytes); // takes over the array, without copying
+	explicit ULowEntryByteSlice(const TArray<uint8>& Bytes, int32 Index = 0, int32 Length = 0x7FFFFFFF); // copies the given part of the array once
+	explicit ULowEntryByteSlice(const FBuffer& Buffer, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	ULowEntryByteSlice Slice(int32 Index, int32 Length = 0x7FFFFFFF) const;
+	void Split(const int32 LengthA, ULowEntryByteSlice& A, ULowEntryByteSlice& B) const;
+
+	int32 Num() const { return Length; }
+	bool IsEmpty() const { return (Length <= 0); }
+	const uint8* GetData() const { return Buffer->GetData() + Offset; }
+	TConstArrayView<uint8> View() const { return TConstArrayView<uint8>(GetData(), Length); }
+
+	const uint8& operator[](const int32 Index) const
+	{
+		checkSlow((Index >= 0) && (Index < Length));
+		return (*Buffer)[Offset + Index];
+	}
+
+	// The buffer this is a slice of, and where in it the slice starts
+	const FBuffer& GetBuffer() const { return Buffer; }
+	int32 GetOffset() const { return Offset; }
+
+	// Turns a range of this slice into the same range of the buffer, clamped to this slice
+	void ToBufferRange(int32& Index, int32& Length) const;
+
+	// Copies the bytes of the slice into a new array
+	TArray<uint8> ToArray() const;
+};
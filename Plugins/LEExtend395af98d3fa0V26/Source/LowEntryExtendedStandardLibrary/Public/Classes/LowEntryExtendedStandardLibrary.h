@@ -29,6 +29,7 @@
 #include "ELowEntryImageFormat.h"
 
 #include "ELowEntryHmacAlgorithm.h"
+#include "ELowEntryHashAlgorithm.h"
 
 #include "IMediaModule.h"
 #include "IMediaPlayer.h"
@@ -52,6 +53,13 @@ class ULowEntryLatentActionString;
 class ULowEntryLatentActionStruct;
 
 class ULowEntryParsedHashcash;
+class ULowEntryHashcashTask;
+class ULowEntryBCryptTask;
+class ULowEntryBCryptVerifyTask;
+class ULowEntryHmacContext;
+
+class ULowEntryHashContext;
+class ULowEntryHashFileTask;
 
 class ULowEntryByteArray;
 
@@ -465,7 +473,7 @@ public:
 	* Merges multiple Byte Arrays into one.
 	*/
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Bytes", Meta = (DeprecatedFunction, DeprecationMessage = "This function is commutative, meaning it sometimes causes bytes to be merged in an incorrect order. Use the new Merge Bytes node instead.", DisplayName = "Merge Bytes (commutative)", Keywords = "byte array", CommutativeAssociativeBinaryOperator = "true"))
-	static TArray<uint8> MergeBytes(TArray<uint8> A, TArray<uint8> B);
+	static TArray<uint8> MergeBytes(const TArray<uint8>& A, const TArray<uint8>& B);
 
 	/**
 	* Returns the values of the given bytes of the given index and length.
@@ -1110,6 +1118,27 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hash (Sha-512)", AdvancedDisplay = "1"))
 	static TArray<uint8> Sha512(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
 
+	/**
+	* Generates a SHA-256 hash of every given byte array, returns all the hashes after each other (32 bytes per byte array).
+	*
+	* Faster than hashing the byte arrays one by one, especially for many small byte arrays.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hashes (Sha-256, Batch)", Keywords = "multiple many"))
+	static TArray<uint8> Sha256Batch(const TArray<ULowEntryByteArray*>& ByteArrays);
+
+	/**
+	* Generates a SHA-512 hash of every given byte array, returns all the hashes after each other (64 bytes per byte array).
+	*
+	* Faster than hashing the byte arrays one by one, especially for many small byte arrays.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hashes (Sha-512, Batch)", Keywords = "multiple many"))
+	static TArray<uint8> Sha512Batch(const TArray<ULowEntryByteArray*>& ByteArrays);
+
+private:
+	static TArray<TArrayView<const uint8>> ByteArraysToViews(const TArray<ULowEntryByteArray*>& ByteArrays);
+
+public:
+
 	/**
 	* Generates a BCrypt hash, always returns 24 bytes.
 	* 
@@ -1125,6 +1154,32 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hash (Bcrypt)", AdvancedDisplay = "3"))
 	static TArray<uint8> BCrypt(const TArray<uint8>& ByteArray, const TArray<uint8>& Salt, int32 Strength = 10, int32 Index = 0, int32 Length = 0x7FFFFFFF);
 
+	/**
+	* Starts generating a BCrypt hash on a worker thread, so the game thread doesn't freeze while it's being generated.
+	*
+	* The conditions of the Generate Hash (Bcrypt) blueprint apply, use the returned task to wait for the hash.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hash (Bcrypt) (Async)", AdvancedDisplay = "3", Keywords = "thread background multithreaded"))
+	static ULowEntryBCryptTask* BCryptAsync(const TArray<uint8>& ByteArray, const TArray<uint8>& Salt, int32 Strength = 10, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Checks every password against the salt and BCrypt hash at the same index, returns for every password whether it matches.
+	*
+	* The checks are spread over all cores, but this blueprint still waits till all of them are done, use the async version to keep the game thread running.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Verify", Meta = (DisplayName = "Verify Hashes (Bcrypt, Batch)", Keywords = "multiple many check compare password login"))
+	static TArray<bool> BCryptVerifyBatch(const TArray<ULowEntryByteArray*>& Passwords, const TArray<ULowEntryByteArray*>& Salts, const TArray<ULowEntryByteArray*>& Hashes, int32 Strength = 10);
+
+	/**
+	* Starts checking every password against the salt and BCrypt hash at the same index, the checks are spread over all cores and run in the background.
+	*
+	* Use the returned task to wait for the results, to get the progress, or to cancel it.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Verify", Meta = (DisplayName = "Verify Hashes (Bcrypt, Batch) (Async)", Keywords = "multiple many check compare password login thread background multithreaded"))
+	static ULowEntryBCryptVerifyTask* BCryptVerifyBatchAsync(const TArray<ULowEntryByteArray*>& Passwords, const TArray<ULowEntryByteArray*>& Salts, const TArray<ULowEntryByteArray*>& Hashes, int32 Strength = 10);
+
 
 	/**
 	* Generates a HMAC hash.
@@ -1134,11 +1189,34 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hash (Hmac)", AdvancedDisplay = "3"))
 	static TArray<uint8> HMAC(const TArray<uint8>& ByteArray, const TArray<uint8>& Key, ELowEntryHmacAlgorithm Algorithm = ELowEntryHmacAlgorithm::SHA256, int32 Index = 0, int32 Length = 0x7FFFFFFF);
 
-private:
-	static int32 HMAC_GetBlockSize(ELowEntryHmacAlgorithm Algorithm);
-	static TArray<uint8> HMAC_Hash(const TArray<uint8>& Array, ELowEntryHmacAlgorithm Algorithm);
+	/**
+	* Creates a HMAC context for the given key, which hashes the key once, after which it can sign and verify any number of messages.
+	*
+	* Faster than the Generate Hash (Hmac) blueprint when many messages are signed with the same key.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Create Hmac Context", Keywords = "make instance key sign reuse"))
+	static ULowEntryHmacContext* HmacContext_Create(const TArray<uint8>& Key, ELowEntryHmacAlgorithm Algorithm = ELowEntryHmacAlgorithm::SHA256);
+
+	/**
+	* Creates a hash context, which hashes bytes that are added to it over time, use Update to add bytes and Final to get the hash.
+	*
+	* The results are the same as those of the Generate Hash blueprints, without needing all the bytes in a single byte array.
+	*
+	* The PearsonHashLength is only used by the Pearson algorithm.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Context", Meta = (DisplayName = "Create Hash Context", AdvancedDisplay = "1", Keywords = "make instance stream incremental"))
+	static ULowEntryHashContext* HashContext_Create(const ELowEntryHashAlgorithm Algorithm = ELowEntryHashAlgorithm::SHA256, const int32 PearsonHashLength = 8);
+
+	/**
+	* Starts hashing a file on a worker thread, the file is read in blocks of BlockSize bytes, so it never has to fit in memory.
+	*
+	* With MemoryMapped the blocks are memory mapped instead of read, on platforms that support it.
+	*
+	* Use the returned task to wait for the hash, to get the progress, or to cancel it.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|File", Meta = (DisplayName = "Hash File", AdvancedDisplay = "2", Keywords = "stream async background"))
+	static ULowEntryHashFileTask* HashFile_Start(const FString& FilePath, const ELowEntryHashAlgorithm Algorithm = ELowEntryHashAlgorithm::SHA256, const int32 PearsonHashLength = 8, const bool MemoryMapped = false, const int32 BlockSize = 1048576);
 
-public:
 	/**
 	* Creates Hashcash hashes, each will have a variable amount of characters.
 	*
@@ -1211,6 +1289,26 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashcash|Generate", Meta = (DisplayName = "Generate Hashcash (Custom Creation Date)"))
 	static FString HashcashCustomCreationDate(const FString& Resource, const FDateTime& UtcDate, const int32 Bits = 22);
 
+	/**
+	* Starts creating a Hashcash hash on worker threads, so the game thread doesn't freeze while searching for one.
+	*
+	* Threads is the number of worker threads to search with, 0 uses one per core. A TimeoutSeconds of 0 means no timeout.
+	*
+	* Use the returned task to wait for the Hashcash hash, to cancel it, or to see how many hashes per second are being tried.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Generate", Meta = (DisplayName = "Generate Hashcash (Async)", AdvancedDisplay = "2", Keywords = "thread background multithreaded"))
+	static ULowEntryHashcashTask* HashcashAsync(const FString& Resource, const int32 Bits = 22, const double TimeoutSeconds = 0, const int32 Threads = 0);
+
+	/**
+	* Starts creating a Hashcash hash on worker threads, so the game thread doesn't freeze while searching for one.
+	*
+	* Threads is the number of worker threads to search with, 0 uses one per core. A TimeoutSeconds of 0 means no timeout.
+	*
+	* Use the returned task to wait for the Hashcash hash, to cancel it, or to see how many hashes per second are being tried.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Generate", Meta = (DisplayName = "Generate Hashcash (Async) (Custom Creation Date)", AdvancedDisplay = "3", Keywords = "thread background multithreaded"))
+	static ULowEntryHashcashTask* HashcashAsyncCustomCreationDate(const FString& Resource, const FDateTime& UtcDate, const int32 Bits = 22, const double TimeoutSeconds = 0, const int32 Threads = 0);
+
 
 	/**
 	* Parses and validates a Hashcash hash.
@@ -0,0 +1,57 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "ELowEntryHashAlgorithm.h"
+#include "LowEntryHashingContext.h"
+
+#include "LowEntryHashContext.generated.h"
+
+
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryHashContext : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryHashContext* Create(const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength = 8);
+
+
+public:
+	ULowEntryHashingContext Context;
+
+
+	/**
+	* Starts a new hash, discarding everything added so far.
+	*
+	* The PearsonHashLength is only used by the Pearson algorithm.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Context", Meta = (DisplayName = "Init", AdvancedDisplay = "1", Keywords = "reset start begin"))
+	void Init(const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength = 8);
+
+	/**
+	* Adds bytes to the hash.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Context", Meta = (DisplayName = "Update", AdvancedDisplay = "1", Keywords = "add append"))
+	void Update(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	void UpdateRaw(const uint8* Bytes, const int64 Length);
+
+	/**
+	* Returns the hash of all the bytes added since the last Init.
+	*
+	* Call Init before adding bytes again.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Context", Meta = (DisplayName = "Final", Keywords = "finish end digest result"))
+	TArray<uint8> Final();
+
+	/**
+	* Returns the algorithm of this context.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Context", Meta = (DisplayName = "Get Algorithm"))
+	ELowEntryHashAlgorithm GetAlgorithm();
+};
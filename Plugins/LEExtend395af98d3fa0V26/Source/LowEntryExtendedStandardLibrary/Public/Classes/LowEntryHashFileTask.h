@@ -0,0 +1,77 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "ELowEntryHashAlgorithm.h"
+
+#include <atomic>
+
+#include "LowEntryHashFileTask.generated.h"
+
+
+/**
+ * Hashes a file on a worker thread, in fixed size blocks, so the file never has to be loaded into memory as a whole.
+ */
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryHashFileTask : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryHashFileTask* Create(const FString& FilePath, const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength = 8, const bool bMemoryMapped = false, const int32 BlockSize = 1024 * 1024);
+
+
+public:
+	UPROPERTY()
+	bool Finished = false;
+	UPROPERTY()
+	bool Success = false;
+	UPROPERTY()
+	TArray<uint8> Result;
+
+	UPROPERTY()
+	int32 KeepAliveCount = 0;
+
+	std::atomic<int64> BytesDone{0};
+	std::atomic<int64> BytesTotal{0};
+	std::atomic<bool> CancelRequested{false};
+
+
+	/**
+	* Waits till the file has been hashed.
+	*
+	* Success will be false if the file couldn't be read or the task was cancelled.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|File", meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Wait Till Done", Keywords = "untill for end finished complete completion"))
+	void WaitTillDone(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool& Success_, TArray<uint8>& Hash);
+
+	void LatentActionDone();
+
+	void Done(const bool Success_, const TArray<uint8>& Hash);
+
+	/**
+	* Stops hashing the file, the task will be done with Success set to false.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|File", Meta = (DisplayName = "Cancel", Keywords = "stop abort"))
+	void Cancel();
+
+	/**
+	* Returns true if the file has been hashed, or the task failed or was cancelled.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|File", Meta = (DisplayName = "Is Done", Keywords = "end finished complete completion"))
+	bool IsDone();
+
+	/**
+	* Returns how much of the file has been hashed, from 0 to 1.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|File", Meta = (DisplayName = "Get Progress", Keywords = "percentage done"))
+	double GetProgress();
+
+	/**
+	* Returns the result.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|File", Meta = (DisplayName = "Get Result", Keywords = "result return value"))
+	void GetResult(bool& Success_, TArray<uint8>& Hash);
+};
@@ -0,0 +1,79 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LowEntryHashingHashcashLibrary.h"
+
+#include "LowEntryHashcashTask.generated.h"
+
+
+/**
+ * Creates a Hashcash hash on worker threads, so the game thread doesn't freeze while searching for it.
+ */
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryHashcashTask : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryHashcashTask* Create(const FString& Resource, const FDateTime& UtcDate, const int32 Bits, const double TimeoutSeconds = 0, const int32 Threads = 0);
+
+
+public:
+	UPROPERTY()
+	bool Finished = false;
+	UPROPERTY()
+	bool Success = false;
+	UPROPERTY()
+	FString Result;
+
+	UPROPERTY()
+	int32 KeepAliveCount = 0;
+
+	TSharedPtr<ULowEntryHashingHashcashLibrary::FMint, ESPMode::ThreadSafe> Mint;
+
+
+	/**
+	* Waits till the Hashcash hash has been created.
+	*
+	* Success will be false if the task was cancelled or timed out.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Task", meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Wait Till Done", Keywords = "untill for end finished complete completion"))
+	void WaitTillDone(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool& Success_, FString& Hash);
+
+	void LatentActionDone();
+
+	void Done(const FString& Hash);
+
+	/**
+	* Stops searching, the task will be done with Success set to false.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Task", Meta = (DisplayName = "Cancel", Keywords = "stop abort"))
+	void Cancel();
+
+	/**
+	* Returns true if the Hashcash hash has been created, or the task was cancelled or timed out.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashcash|Task", Meta = (DisplayName = "Is Done", Keywords = "end finished complete completion"))
+	bool IsDone();
+
+	/**
+	* Returns true if the task stopped because it ran out of time.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashcash|Task", Meta = (DisplayName = "Is Timed Out", Keywords = "timeout expired"))
+	bool IsTimedOut();
+
+	/**
+	* Returns the number of hashes tried per second, over all threads.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashcash|Task", Meta = (DisplayName = "Get Hashes Per Second", Keywords = "speed rate progress"))
+	double GetHashesPerSecond();
+
+	/**
+	* Returns the result.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashcash|Task", Meta = (DisplayName = "Get Result", Keywords = "result return value"))
+	void GetResult(bool& Success_, FString& Hash);
+};
@@ -33,14 +33,37 @@ private:
 
 private:
 	void encipher(int32 lr[], const int32 off);
-	static int32 streamtoword(const TArray<uint8>& data, int32 offp[]);
+	static int32 streamtoword(const TConstArrayView<uint8> data, int32 offp[]);
 	void init_key();
-	void key(const TArray<uint8>& key);
-	void ekskey(const TArray<uint8>& data, const TArray<uint8>& key);
-	TArray<uint8> crypt_raw(const TArray<uint8>& password, const TArray<uint8>& salt, const int32 log_rounds, int32 cdata[]);
-	TArray<uint8> crypt_raw(const TArray<uint8>& password, const TArray<uint8>& salt, const int32 log_rounds);
+	void key(const TConstArrayView<uint8> key);
+	void ekskey(const TConstArrayView<uint8> data, const TConstArrayView<uint8> key);
+	TArray<uint8> crypt_raw(const TConstArrayView<uint8> password, const TConstArrayView<uint8> salt, const int32 log_rounds, int32 cdata[]);
+	TArray<uint8> crypt_raw(const TConstArrayView<uint8> password, const TConstArrayView<uint8> salt, const int32 log_rounds);
 
 
 public:
+	/**
+	 * Instances share no state, so any number of hashes can be generated on different threads at the same time.
+	 */
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes, const TArray<uint8>& Salt, const int32 Strength);
+	static TArray<uint8> Hash(const TConstArrayView<uint8> Bytes, const TConstArrayView<uint8> Salt, const int32 Strength);
+
+	/**
+	 * Generates the hash on the task graph, OnDone is called with the hash on the worker thread that generated it.
+	 */
+	static void HashAsync(const TArray<uint8>& Bytes, const TArray<uint8>& Salt, const int32 Strength, TFunction<void(const TArray<uint8>&)> OnDone);
+
+	/**
+	 * Returns true if the bytes hash to the given hash, the hashes are compared in constant time.
+	 */
+	static bool Verify(const TConstArrayView<uint8> Bytes, const TConstArrayView<uint8> Salt, const int32 Strength, const TConstArrayView<uint8> ExpectedHash);
+
+	/**
+	 * Verifies every password against the salt and hash at the same index, the checks are spread over all cores.
+	 * Entries without a salt or a hash (because Salts or Hashes are shorter than Passwords) don't match.
+	 *
+	 * OnVerified is called on worker threads (so possibly on several at once) after every check, returning false skips the checks that haven't started yet, those don't match either.
+	 */
+	static TArray<bool> VerifyBatch(const TConstArrayView<TArrayView<const uint8>> Passwords, const TConstArrayView<TArrayView<const uint8>> Salts, const TConstArrayView<TArrayView<const uint8>> Hashes, const int32 Strength);
+	static TArray<bool> VerifyBatch(const TConstArrayView<TArrayView<const uint8>> Passwords, const TConstArrayView<TArrayView<const uint8>> Salts, const TConstArrayView<TArrayView<const uint8>> Hashes, const int32 Strength, TFunctionRef<bool(int32 Index, bool bMatch)> OnVerified);
 };
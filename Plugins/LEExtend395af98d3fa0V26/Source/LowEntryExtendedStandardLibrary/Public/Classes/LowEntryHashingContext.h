@@ -0,0 +1,63 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+
+#include "ELowEntryHashAlgorithm.h"
+
+#include "LowEntryHashingSha256Library.h"
+#include "LowEntryHashingSha512Library.h"
+#include "LowEntryHashingPearsonLibrary.h"
+
+
+/**
+ * Incremental hashing: Init, any number of Updates, then Final.
+ *
+ * Gives the same hashes as the one-shot hash functions, without needing all the data in memory at once.
+ * An instance isn't thread safe, but can be moved between threads between calls.
+ */
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryHashingContext
+{
+public:
+	constexpr static int32 DEFAULT_FILE_BLOCK_SIZE = 1024 * 1024;
+
+
+private:
+	ELowEntryHashAlgorithm Algorithm = ELowEntryHashAlgorithm::SHA256;
+	int64 Length = 0;
+
+	FMD5 Md5;
+	FSHA1 Sha1;
+	ULowEntryHashingSha256Library Sha256;
+	ULowEntryHashingSha512Library Sha512;
+	ULowEntryHashingPearsonLibrary Pearson;
+
+
+public:
+	ULowEntryHashingContext();
+	explicit ULowEntryHashingContext(const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength = 8);
+
+	void Init(const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength = 8);
+	void Update(const uint8* Bytes, const int64 BytesLength);
+	void Update(const TArray<uint8>& Bytes, int32 Index = 0, int32 BytesLength = 0x7FFFFFFF);
+	TArray<uint8> Final();
+
+	ELowEntryHashAlgorithm GetAlgorithm() const { return Algorithm; }
+	int64 GetLength() const { return Length; }
+
+
+public:
+	/**
+	 * Hashes a file in blocks of BlockSize bytes, on the calling thread.
+	 *
+	 * With bMemoryMapped the blocks are mapped instead of read, falling back to reads on platforms that can't map the file.
+	 * OnProgress is called after every block with the bytes done so far and the file size, returning false from it cancels the hashing.
+	 *
+	 * Returns false if the file couldn't be read or the hashing was cancelled.
+	 */
+	static bool HashFile(const FString& FilePath, const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength, TArray<uint8>& OutHash, const bool bMemoryMapped = false, const int32 BlockSize = DEFAULT_FILE_BLOCK_SIZE);
+	static bool HashFile(const FString& FilePath, const ELowEntryHashAlgorithm Algorithm, const int32 PearsonHashLength, TArray<uint8>& OutHash, const bool bMemoryMapped, const int32 BlockSize, TFunctionRef<bool(const int64 BytesDone, const int64 BytesTotal)> OnProgress);
+};
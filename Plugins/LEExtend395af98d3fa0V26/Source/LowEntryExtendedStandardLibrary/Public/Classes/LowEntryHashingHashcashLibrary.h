@@ -4,20 +4,48 @@
 
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 
 #include "LowEntryParsedHashcash.h"
 
+#include <atomic>
+
 
 class ULowEntryHashingHashcashLibrary
 {
+public:
+	/**
+	 * The state of a multithreaded mint, shared by its workers and whoever started it.
+	 *
+	 * Everything in here can be read and cancelled from any thread while the mint runs.
+	 */
+	class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FMint
+	{
+	public:
+		std::atomic<bool> Stop{false};
+		std::atomic<bool> TimedOut{false};
+		std::atomic<uint64> Hashes{0};
+		std::atomic<int32> RunningWorkers{0};
+
+		double StartTime = 0;
+		double Deadline = 0;
+		std::atomic<double> EndTime{0};
+
+		FCriticalSection ResultLock;
+		FString Result;
+
+	public:
+		void Cancel() { Stop = true; }
+		double GetHashesPerSecond() const;
+	};
+
+
 private:
 	constexpr static int32 VERSION = 1;
 	constexpr static int32 MAX_COUNTER = 1048576;
 
 	const static FString DATE_FORMAT_STRING;
 
-	static TArray<TArray<uint8>> BASE_64_CACHE;
-
 
 public:
 	static TArray<FString> hashArray(const TArray<FString>& resource, const int32 bits);
@@ -25,13 +53,20 @@ public:
 	static FString hash(const FString& resource, const int32 bits);
 	static FString hashCustomCreationDate(const FString& resource, const FDateTime& date, const int32 bits);
 
+	/**
+	 * Mints on the given number of worker threads (0 is one per core), each searching its own random part of the nonce space.
+	 *
+	 * OnDone is called on a worker thread once all workers have stopped, with an empty string if the mint was cancelled or timed out.
+	 * A TimeoutSeconds of 0 or less means no timeout.
+	 */
+	static TSharedRef<FMint, ESPMode::ThreadSafe> hashAsync(const FString& resource, const FDateTime& date, const int32 bits, const int32 threads, const double timeoutSeconds, TFunction<void(const FString& Result)> OnDone);
+
 	static TArray<ULowEntryParsedHashcash*> parseArray(const TArray<FString>& Hashcashes);
 	static ULowEntryParsedHashcash* parse(const FString& Hashcash);
 
 
 private:
-	static TArray<TArray<uint8>> GenerateBase64Cache();
-	static TArray<uint8> base64WithoutLeadingZeroBytes(const int32 value);
+	static bool mint(const FString& resource, const FDateTime& date, const int32 bits, FMint& Mint);
 	static FString getDateString(const FDateTime& date);
 	static FDateTime parseDateString(const FString& date);
 	FORCEINLINE static int32 countLeadingZeroBits(const TArray<uint8>& values);
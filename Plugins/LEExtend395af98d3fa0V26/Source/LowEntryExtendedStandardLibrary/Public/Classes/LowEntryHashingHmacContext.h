@@ -0,0 +1,83 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+
+#include "ELowEntryHmacAlgorithm.h"
+
+#include "LowEntryHashingSha1Library.h"
+#include "LowEntryHashingSha256Library.h"
+#include "LowEntryHashingSha512Library.h"
+
+
+/**
+ * HMAC with a fixed key: the key pads are hashed once by Init, every message after that only costs the hashing of the message itself plus one outer block.
+ *
+ * Messages can be added with Update and finished with Final (which readies the context for the next message), or signed in one go with Sign and SignBatch.
+ * Sign, Verify and SignBatch don't change the context, so they can be called from several threads at once; Update and Final can't.
+ */
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryHashingHmacContext
+{
+private:
+	// A hash in progress, only the member of the context's algorithm is used
+	struct FHashState
+	{
+		FMD5 Md5;
+		ULowEntryHashingSha1Library Sha1;
+		ULowEntryHashingSha256Library Sha256;
+		ULowEntryHashingSha512Library Sha512;
+	};
+
+
+private:
+	ELowEntryHmacAlgorithm Algorithm = ELowEntryHmacAlgorithm::SHA256;
+
+	FHashState Inner; // after hashing i_key_pad
+	FHashState Outer; // after hashing o_key_pad
+	FHashState Current;
+
+
+public:
+	ULowEntryHashingHmacContext();
+	ULowEntryHashingHmacContext(const ELowEntryHmacAlgorithm Algorithm, const TConstArrayView<uint8> Key);
+
+	void Init(const ELowEntryHmacAlgorithm Algorithm, const TConstArrayView<uint8> Key);
+
+	// Discards the message added so far, keeps the key
+	void Reset();
+	void Update(const uint8* Bytes, const int64 BytesLength);
+	void Update(const TArray<uint8>& Bytes, int32 Index = 0, int32 BytesLength = 0x7FFFFFFF);
+	TArray<uint8> Final();
+
+	TArray<uint8> Sign(const TConstArrayView<uint8> Message) const;
+	void Sign(const TConstArrayView<uint8> Message, uint8* Mac) const;
+
+	// Compares in constant time
+	bool Verify(const TConstArrayView<uint8> Message, const TConstArrayView<uint8> Mac) const;
+
+	/**
+	 * Signs every message on its own, returns all the MACs after each other (GetMacLength bytes each, in the order of the messages).
+	 * Large batches are spread over worker threads.
+	 */
+	TArray<uint8> SignBatch(const TConstArrayView<TArrayView<const uint8>> Messages) const;
+	void SignBatch(const TConstArrayView<TArrayView<const uint8>> Messages, uint8* Macs) const;
+
+	ELowEntryHmacAlgorithm GetAlgorithm() const { return Algorithm; }
+	int32 GetMacLength() const { return GetMacLength(Algorithm); }
+
+
+public:
+	static int32 GetBlockSize(const ELowEntryHmacAlgorithm Algorithm);
+	static int32 GetMacLength(const ELowEntryHmacAlgorithm Algorithm);
+
+
+private:
+	void StateInit(FHashState& State) const;
+	void StateCopy(FHashState& To, const FHashState& From) const;
+	void StateUpdate(FHashState& State, const uint8* Bytes, const int64 BytesLength) const;
+	void StateFinal(FHashState& State, uint8* Digest) const;
+	void Finish(FHashState& State, uint8* Mac) const;
+};
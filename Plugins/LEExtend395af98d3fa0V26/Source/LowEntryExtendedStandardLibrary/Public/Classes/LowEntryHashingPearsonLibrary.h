@@ -12,6 +12,22 @@ private:
 	const static uint8 pearson[256];
 
 
+private:
+	TArray<uint8> hash;
+	uint8 first[256];
+	int64 count = 0;
+
+
+public:
+	/**
+	 * Streaming use, gives the same result as Hash with an Index of 0.
+	 * Like Hash, every byte after the first 256 is mixed in as the byte at (position & 0xff), so only the first 256 bytes and the total length are kept.
+	 */
+	void Init(const int32 HashLength);
+	void Update(const uint8* b, const int64 len);
+	TArray<uint8> Final();
+
+
 public:
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes, const int32 HashLength) { return Hash(Bytes, 0, 0xf7777777, HashLength); }
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes, int32 Index, int32 Length, const int32 HashLength);
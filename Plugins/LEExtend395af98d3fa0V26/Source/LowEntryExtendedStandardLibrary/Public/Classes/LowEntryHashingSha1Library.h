@@ -0,0 +1,39 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+
+/**
+ * SHA-1 with the same streaming interface as the SHA-256 and SHA-512 libraries.
+ *
+ * Unlike FSHA1 an instance can be copied, so a hash in progress (like the keyed state of an HMAC) can be continued more than once.
+ */
+class ULowEntryHashingSha1Library
+{
+private:
+	constexpr static int32 BLOCK_SIZE = 64;
+
+
+private:
+	constexpr static uint32 INITIAL_STATE[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+
+	uint32 state[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+
+	int64 count = 0;
+	uint8 buffer[BLOCK_SIZE];
+
+
+public:
+	/**
+	 * Streaming use: Update can be called any number of times, Final returns the digest of everything passed to Update since the last Init.
+	 * Call Init before reusing an instance after Final.
+	 */
+	void Init();
+	void Update(const uint8* b, const int64 len);
+	TArray<uint8> Final();
+
+	static TArray<uint8> Hash(const TArray<uint8>& Bytes);
+};
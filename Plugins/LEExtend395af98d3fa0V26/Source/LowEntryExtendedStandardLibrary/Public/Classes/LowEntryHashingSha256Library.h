@@ -9,37 +9,34 @@
 class ULowEntryHashingSha256Library
 {
 private:
-	const static int32 k[64];
 	constexpr static int32 BLOCK_SIZE = 64;
 
 
 private:
-	TArray<int32> w;
+	constexpr static uint32 INITIAL_STATE[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
 
-	int32 h0 = 0x6a09e667;
-	int32 h1 = 0xbb67ae85;
-	int32 h2 = 0x3c6ef372;
-	int32 h3 = 0xa54ff53a;
-	int32 h4 = 0x510e527f;
-	int32 h5 = 0x9b05688c;
-	int32 h6 = 0x1f83d9ab;
-	int32 h7 = 0x5be0cd19;
+	uint32 state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
 
 	int64 count = 0;
-	TArray<uint8> buffer;
-
-
-private:
-	void initialize();
-	void update(const TArray<uint8>& b, const int64 offset, const int64 len);
-	TArray<uint8> digest();
-	TArray<uint8> padBuffer();
-	TArray<uint8> getResult();
-	void sha(const TArray<uint8>& in, int64 offset);
-	FORCEINLINE static int32 s(const int32 a, const int32 b);
+	uint8 buffer[BLOCK_SIZE];
 
 
 public:
+	/**
+	 * Streaming use: Update can be called any number of times, Final returns the digest of everything passed to Update since the last Init.
+	 * Call Init before reusing an instance after Final.
+	 */
+	void Init();
+	void Update(const uint8* b, const int64 len);
+	TArray<uint8> Final();
+
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes);
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes, int32 Index, int32 Length);
+
+	/**
+	 * Hashes every message on its own, returns all the digests after each other (32 bytes each, in the order of the messages).
+	 * Uses multi-buffer SIMD where the CPU supports it, large batches are spread over worker threads.
+	 */
+	static TArray<uint8> HashBatch(const TConstArrayView<TArrayView<const uint8>> Messages);
+	static void HashBatch(const TConstArrayView<TArrayView<const uint8>> Messages, uint8* Digests);
 };
@@ -9,37 +9,34 @@
 class ULowEntryHashingSha512Library
 {
 private:
-	const static int64 k[80];
 	constexpr static int32 BLOCK_SIZE = 128;
 
 
 private:
-	TArray<int64> w;
+	constexpr static uint64 INITIAL_STATE[8] = {0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179};
 
-	int64 h0 = 0x6a09e667f3bcc908L;
-	int64 h1 = 0xbb67ae8584caa73bL;
-	int64 h2 = 0x3c6ef372fe94f82bL;
-	int64 h3 = 0xa54ff53a5f1d36f1L;
-	int64 h4 = 0x510e527fade682d1L;
-	int64 h5 = 0x9b05688c2b3e6c1fL;
-	int64 h6 = 0x1f83d9abfb41bd6bL;
-	int64 h7 = 0x5be0cd19137e2179L;
+	uint64 state[8] = {0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179};
 
 	int64 count = 0;
-	TArray<uint8> buffer;
-
-
-private:
-	void initialize();
-	void update(const TArray<uint8>& b, const int64 offset, const int64 len);
-	TArray<uint8> digest();
-	TArray<uint8> padBuffer();
-	TArray<uint8> getResult();
-	void sha(const TArray<uint8>& in, int64 offset);
-	FORCEINLINE static int64 s(const int64 a, const int32 b);
+	uint8 buffer[BLOCK_SIZE];
 
 
 public:
+	/**
+	 * Streaming use: Update can be called any number of times, Final returns the digest of everything passed to Update since the last Init.
+	 * Call Init before reusing an instance after Final.
+	 */
+	void Init();
+	void Update(const uint8* b, const int64 len);
+	TArray<uint8> Final();
+
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes);
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes, int32 Index, int32 Length);
+
+	/**
+	 * Hashes every message on its own, returns all the digests after each other (64 bytes each, in the order of the messages).
+	 * Uses multi-buffer SIMD where the CPU supports it, large batches are spread over worker threads.
+	 */
+	static TArray<uint8> HashBatch(const TConstArrayView<TArrayView<const uint8>> Messages);
+	static void HashBatch(const TConstArrayView<TArrayView<const uint8>> Messages, uint8* Digests);
 };
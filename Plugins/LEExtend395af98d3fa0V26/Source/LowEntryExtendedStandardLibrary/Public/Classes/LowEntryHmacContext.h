@@ -0,0 +1,88 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "ELowEntryHmacAlgorithm.h"
+#include "LowEntryHashingHmacContext.h"
+
+#include "LowEntryHmacContext.generated.h"
+
+
+class ULowEntryByteArray;
+
+
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryHmacContext : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryHmacContext* Create(const TArray<uint8>& Key, const ELowEntryHmacAlgorithm Algorithm);
+
+
+public:
+	ULowEntryHashingHmacContext Context;
+
+
+	/**
+	* Sets a new key, discarding the message added so far.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Init", Keywords = "reset start begin key"))
+	void Init(const TArray<uint8>& Key, const ELowEntryHmacAlgorithm Algorithm = ELowEntryHmacAlgorithm::SHA256);
+
+	/**
+	* Discards the message added so far, the key stays the same.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Reset", Keywords = "clear start begin"))
+	void Reset();
+
+	/**
+	* Adds bytes to the message.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Update", AdvancedDisplay = "1", Keywords = "add append"))
+	void Update(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Returns the HMAC hash of all the bytes added since the last Init, Reset or Final, and starts a new message with the same key.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Final", Keywords = "finish end digest result sign"))
+	TArray<uint8> Final();
+
+	/**
+	* Returns the HMAC hash of the given bytes, the message added with Update is left alone.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Sign", AdvancedDisplay = "1", Keywords = "hash generate"))
+	TArray<uint8> Sign(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Returns true if the given HMAC hash is the HMAC hash of the given bytes, the hashes are compared in constant time.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Verify", AdvancedDisplay = "2", Keywords = "check compare equals"))
+	bool Verify(const TArray<uint8>& ByteArray, const TArray<uint8>& Hash, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Returns the HMAC hash of every given byte array after each other (Get Hash Length bytes per byte array).
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Sign (Batch)", Keywords = "hash generate multiple many"))
+	TArray<uint8> SignBatch(const TArray<ULowEntryByteArray*>& ByteArrays);
+
+	/**
+	* Returns the algorithm of this context.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Get Algorithm"))
+	ELowEntryHmacAlgorithm GetAlgorithm();
+
+	/**
+	* Returns the length of the HMAC hashes of this context, in bytes.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Hmac Context", Meta = (DisplayName = "Get Hash Length", Keywords = "size mac"))
+	int32 GetHashLength();
+};
@@ -0,0 +1,72 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LatentActions.h"
+
+#include "LowEntryBCryptTask.h"
+
+
+class FLowEntryBCryptTask : public FPendingLatentAction
+{
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	ULowEntryBCryptTask* Task = nullptr;
+	bool& Success;
+	TArray<uint8>& Hash;
+
+	bool Done = false;
+
+	FLowEntryBCryptTask(const FLatentActionInfo& LatentInfo, ULowEntryBCryptTask* Task0, bool& Success0, TArray<uint8>& Hash0)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, Success(Success0)
+		, Hash(Hash0)
+	{
+		this->Task = Task0;
+	}
+
+	virtual ~FLowEntryBCryptTask() override
+	{
+		if (!Done)
+		{
+			if (IsValid(Task))
+			{
+				Done = true;
+				Task->LatentActionDone();
+			}
+		}
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (!IsValid(Task))
+		{
+			Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+			return;
+		}
+		if (Task->Finished)
+		{
+			Done = true;
+			Success = Task->Success;
+			Hash = Task->Result;
+			Task->LatentActionDone();
+			Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+		}
+	}
+
+#if WITH_EDITOR
+	// Returns a human readable description of the latent operation's current state
+	virtual FString GetDescription() const override
+	{
+		return TEXT("Hashing...");
+	}
+#endif
+};
@@ -0,0 +1,72 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LatentActions.h"
+
+#include "LowEntryBCryptVerifyTask.h"
+
+
+class FLowEntryBCryptVerifyTask : public FPendingLatentAction
+{
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	ULowEntryBCryptVerifyTask* Task = nullptr;
+	bool& Success;
+	TArray<bool>& Matches;
+
+	bool Done = false;
+
+	FLowEntryBCryptVerifyTask(const FLatentActionInfo& LatentInfo, ULowEntryBCryptVerifyTask* Task0, bool& Success0, TArray<bool>& Matches0)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, Success(Success0)
+		, Matches(Matches0)
+	{
+		this->Task = Task0;
+	}
+
+	virtual ~FLowEntryBCryptVerifyTask() override
+	{
+		if (!Done)
+		{
+			if (IsValid(Task))
+			{
+				Done = true;
+				Task->LatentActionDone();
+			}
+		}
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (!IsValid(Task))
+		{
+			Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+			return;
+		}
+		if (Task->Finished)
+		{
+			Done = true;
+			Success = Task->Success;
+			Matches = Task->Result;
+			Task->LatentActionDone();
+			Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+		}
+	}
+
+#if WITH_EDITOR
+	// Returns a human readable description of the latent operation's current state
+	virtual FString GetDescription() const override
+	{
+		return FString::Printf(TEXT("Verifying... %d%%"), IsValid(Task) ? FMath::FloorToInt32(Task->GetProgress() * 100) : 0);
+	}
+#endif
+};
@@ -0,0 +1,72 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LatentActions.h"
+
+#include "LowEntryHashFileTask.h"
+
+
+class FLowEntryHashFileTask : public FPendingLatentAction
+{
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	ULowEntryHashFileTask* Task = nullptr;
+	bool& Success;
+	TArray<uint8>& Hash;
+
+	bool Done = false;
+
+	FLowEntryHashFileTask(const FLatentActionInfo& LatentInfo, ULowEntryHashFileTask* Task0, bool& Success0, TArray<uint8>& Hash0)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, Success(Success0)
+		, Hash(Hash0)
+	{
+		this->Task = Task0;
+	}
+
+	virtual ~FLowEntryHashFileTask() override
+	{
+		if (!Done)
+		{
+			if (IsValid(Task))
+			{
+				Done = true;
+				Task->LatentActionDone();
+			}
+		}
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (!IsValid(Task))
+		{
+			Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+			return;
+		}
+		if (Task->Finished)
+		{
+			Done = true;
+			Success = Task->Success;
+			Hash = Task->Result;
+			Task->LatentActionDone();
+			Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+		}
+	}
+
+#if WITH_EDITOR
+	// Returns a human readable description of the latent operation's current state
+	virtual FString GetDescription() const override
+	{
+		return FString::Printf(TEXT("Hashing... %d%%"), IsValid(Task) ? FMath::FloorToInt32(Task->GetProgress() * 100) : 0);
+	}
+#endif
+};
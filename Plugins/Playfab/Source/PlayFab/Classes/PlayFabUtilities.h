@@ -33,4 +33,16 @@ public:
     /** Returns the requested photon application id. */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Photon | Authentication")
         static FString getPhotonAppId(bool Realtime = false, bool Chat = false, bool Turnbased = false);
+
+    /** Starts keeping an estimate of the PlayFab server clock, sampled every IntervalSeconds once the player is logged in. */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Time")
+        static void startServerTimeSync(float IntervalSeconds = 60.0f);
+
+    /** Returns the estimated PlayFab server time (UTC) without a network call. Never goes backwards once synced. */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Time")
+        static FDateTime getServerTime();
+
+    /** Returns whether the server time estimate is based on at least one sample, and how accurate it is in milliseconds. */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Time")
+        static bool isServerTimeSynced(float& AccuracyMs);
 };
@@ -14,9 +14,7 @@
 #include "PlayFabJsonObject.h"
 
 
-#include "PlayFabAdminAPI.h" 
 #include "PlayFabClientAPI.h" 
-#include "PlayFabServerAPI.h" 
 #include "PlayFabAuthenticationAPI.h" 
 #include "PlayFabCloudScriptAPI.h" 
 #include "PlayFabDataAPI.h" 
@@ -40,9 +38,7 @@ class FPlayFab : public IPlayFab
         UPlayFabJsonObject::StaticClass();
         UPlayFabJsonValue::StaticClass();
 
-        UPlayFabAdminAPI::StaticClass();
         UPlayFabClientAPI::StaticClass();
-        UPlayFabServerAPI::StaticClass();
         UPlayFabAuthenticationAPI::StaticClass();
         UPlayFabCloudScriptAPI::StaticClass();
         UPlayFabDataAPI::StaticClass();
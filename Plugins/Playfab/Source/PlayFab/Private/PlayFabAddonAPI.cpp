@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabAddonAPI::UPlayFabAddonAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -1674,7 +1675,7 @@ void UPlayFabAddonAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabAddonAPI::ResetResponseData()
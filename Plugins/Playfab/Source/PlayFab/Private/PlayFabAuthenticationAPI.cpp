@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabAuthenticationAPI::UPlayFabAuthenticationAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -426,7 +427,7 @@ void UPlayFabAuthenticationAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabAuthenticationAPI::ResetResponseData()
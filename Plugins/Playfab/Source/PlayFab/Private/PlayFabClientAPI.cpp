@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabClientAPI::UPlayFabClientAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -10188,7 +10189,7 @@ void UPlayFabClientAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabClientAPI::ResetResponseData()
@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabCloudScriptAPI::UPlayFabCloudScriptAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -1033,7 +1034,7 @@ void UPlayFabCloudScriptAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabCloudScriptAPI::ResetResponseData()
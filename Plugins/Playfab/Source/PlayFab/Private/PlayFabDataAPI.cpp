@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabDataAPI::UPlayFabDataAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -608,7 +609,7 @@ void UPlayFabDataAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabDataAPI::ResetResponseData()
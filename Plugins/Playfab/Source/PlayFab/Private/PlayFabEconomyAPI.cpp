@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabEconomyAPI::UPlayFabEconomyAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -3003,7 +3004,7 @@ void UPlayFabEconomyAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::ResetResponseData()
@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabExperimentationAPI::UPlayFabExperimentationAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -1002,7 +1003,7 @@ void UPlayFabExperimentationAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabExperimentationAPI::ResetResponseData()
@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabInsightsAPI::UPlayFabInsightsAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -519,7 +520,7 @@ void UPlayFabInsightsAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabInsightsAPI::ResetResponseData()
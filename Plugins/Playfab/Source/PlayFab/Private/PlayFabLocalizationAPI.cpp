@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabLocalizationAPI::UPlayFabLocalizationAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -266,7 +267,7 @@ void UPlayFabLocalizationAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabLocalizationAPI::ResetResponseData()
@@ -18,7 +18,6 @@
 
 #include "Modules/ModuleManager.h"
 
-DECLARE_LOG_CATEGORY_EXTERN(LogPlayFab, Log, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogPlayFabTests, Log, All);
 
 #include "PlayFab/Public/IPlayFab.h"
@@ -16,6 +16,7 @@
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabProgressionAPI::UPlayFabProgressionAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -1514,7 +1515,7 @@ void UPlayFabProgressionAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabProgressionAPI::ResetResponseData()
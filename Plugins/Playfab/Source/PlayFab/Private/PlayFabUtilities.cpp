@@ -14,6 +14,7 @@
 #include "PlayFabCommon/Public/PlayFabRuntimeSettings.h"
 #include "IPlayFab.h"
 #include "PlayFabPrivate.h"
+#include "Core/PlayFabTimeSync.h"
 
 void UPlayFabUtilities::setPlayFabSettings(FString GameTitleId, FString PlayFabSecretApiKey, FString ProductionUrl, FString PhotonRealtimeAppId, FString PhotonTurnbasedAppId, FString PhotonChatAppId)
 {
@@ -930,3 +931,31 @@ FString UPlayFabUtilities::getErrorText(int32 code)
     // Return the text
     return returnText;
 }
+
+void UPlayFabUtilities::startServerTimeSync(float IntervalSeconds)
+{
+#if WITH_PLAYFAB_CLIENT_API
+    PlayFab::PlayFabTimeSync::Get().Start(IntervalSeconds);
+#endif
+}
+
+FDateTime UPlayFabUtilities::getServerTime()
+{
+#if WITH_PLAYFAB_CLIENT_API
+    return PlayFab::PlayFabTimeSync::Get().GetServerTime();
+#else
+    return FDateTime::UtcNow();
+#endif
+}
+
+bool UPlayFabUtilities::isServerTimeSynced(float& AccuracyMs)
+{
+#if WITH_PLAYFAB_CLIENT_API
+    const PlayFab::PlayFabTimeSync::FStats Stats = PlayFab::PlayFabTimeSync::Get().GetStats();
+    AccuracyMs = (float)Stats.AccuracyMs;
+    return PlayFab::PlayFabTimeSync::Get().IsSynced();
+#else
+    AccuracyMs = 0.0f;
+    return false;
+#endif
+}
@@ -8,6 +8,9 @@
 #include "Modules/ModuleManager.h"
 #include "PlayFabCommon.h"
 
+// Exported for the PlayFabAdminServer module
+PLAYFAB_API DECLARE_LOG_CATEGORY_EXTERN(LogPlayFab, Log, All);
+
 /**
 * The public interface to this module.  In most cases, this interface is only public to sibling modules
 * within this plugin.
@@ -24,7 +24,7 @@ class UPlayFabAuthenticationContext;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnPlayFabAdminRequestCompleted, FPlayFabBaseModel, response, UObject*, customData, bool, successful);
 
 UCLASS(Blueprintable, BlueprintType)
-class PLAYFAB_API UPlayFabAdminAPI : public UOnlineBlueprintCallProxyBase
+class PLAYFABADMINSERVER_API UPlayFabAdminAPI : public UOnlineBlueprintCallProxyBase
 {
     GENERATED_UCLASS_BODY()
 
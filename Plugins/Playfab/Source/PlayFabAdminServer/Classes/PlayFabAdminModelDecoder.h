@@ -21,7 +21,7 @@
 class UPlayFabJsonObject;
 
 UCLASS()
-class PLAYFAB_API UPlayFabAdminModelDecoder : public UBlueprintFunctionLibrary
+class PLAYFABADMINSERVER_API UPlayFabAdminModelDecoder : public UBlueprintFunctionLibrary
 {
     GENERATED_BODY()
 
@@ -35,7 +35,7 @@ class UPlayFabJsonObject;
  * use this feature with caution. Returns information about the new bans.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminBanUsersRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminBanUsersRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -48,7 +48,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminBanUsersResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminBanUsersResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -69,7 +69,7 @@ public:
  * the deletion by calling GetPlayedTitleList, before calling this API.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteMasterPlayerAccountRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteMasterPlayerAccountRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -82,7 +82,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteMasterPlayerAccountResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteMasterPlayerAccountResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -102,7 +102,7 @@ public:
  * asynchronous deletion. It may take some time before the data is deleted.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteMasterPlayerEventDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteMasterPlayerEventDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -112,7 +112,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteMasterPlayerEventDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteMasterPlayerEventDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -120,7 +120,7 @@ public:
 
 /** This API lets developers delete a membership subscription. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteMembershipSubscriptionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteMembershipSubscriptionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -139,7 +139,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteMembershipSubscriptionResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteMembershipSubscriptionResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -155,7 +155,7 @@ public:
  * the same user account in the same title will fail with the 'AccountDeleted' error.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeletePlayerRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeletePlayerRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -165,7 +165,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeletePlayerResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeletePlayerResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -181,14 +181,14 @@ public:
  * the title data is fully deleted, attempts to call APIs with the title will fail with the 'TitleDeleted' error.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteTitleRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteTitleRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteTitleResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteTitleResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -203,7 +203,7 @@ public:
  * download the export dump will be sent to the notification email address configured for the title.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminExportMasterPlayerDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminExportMasterPlayerDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -213,7 +213,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminExportMasterPlayerDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminExportMasterPlayerDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -227,7 +227,7 @@ public:
 
 /** Useful for identifying titles of which the player's data will be deleted by DeleteMasterPlayer. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayedTitleListRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayedTitleListRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -237,7 +237,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayedTitleListResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayedTitleListResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -251,7 +251,7 @@ public:
  * expired.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerIdFromAuthTokenRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerIdFromAuthTokenRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -264,7 +264,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerIdFromAuthTokenResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerIdFromAuthTokenResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -280,7 +280,7 @@ public:
  * have accessed the title, the recommendation is to not store this data locally.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerProfileRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerProfileRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -300,7 +300,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerProfileResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerProfileResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -319,7 +319,7 @@ public:
  * have accessed the title, the recommendation is to not store this data locally.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminLookupUserAccountInfoRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminLookupUserAccountInfoRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -338,7 +338,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminLookupUserAccountInfoResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminLookupUserAccountInfoResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -349,7 +349,7 @@ public:
 
 /** Get all bans for a user, including inactive and expired bans. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetUserBansRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetUserBansRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -359,7 +359,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetUserBansResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetUserBansResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -373,7 +373,7 @@ public:
  * playerto their email. The token expires after 30 minutes.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminResetPasswordRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminResetPasswordRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -389,7 +389,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminResetPasswordResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminResetPasswordResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -400,7 +400,7 @@ public:
  * ignored, however. Returns information about applied updates only.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRevokeAllBansForUserRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminRevokeAllBansForUserRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -410,7 +410,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRevokeAllBansForUserResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminRevokeAllBansForUserResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -424,7 +424,7 @@ public:
  * that do not exist will be skipped. Returns information about applied updates only.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRevokeBansRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminRevokeBansRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -434,7 +434,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRevokeBansResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminRevokeBansResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -449,7 +449,7 @@ public:
  * able to receive a password reset email using this API.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSendAccountRecoveryEmailRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminSendAccountRecoveryEmailRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -465,7 +465,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSendAccountRecoveryEmailResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminSendAccountRecoveryEmailResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -473,7 +473,7 @@ public:
 
 /** This API lets developers set overrides for membership expirations, independent of any subscriptions setting it. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetMembershipOverrideRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminSetMembershipOverrideRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -492,7 +492,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetMembershipOverrideResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminSetMembershipOverrideResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -503,7 +503,7 @@ public:
  * the rest are still applied. Returns information about applied updates only.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateBansRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateBansRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -513,7 +513,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateBansResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateBansResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -528,7 +528,7 @@ public:
  * This API enables changing that name, whether due to a customer request, an offensive name choice, etc.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateUserTitleDisplayNameRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateUserTitleDisplayNameRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -544,7 +544,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateUserTitleDisplayNameResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateUserTitleDisplayNameResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -559,7 +559,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreateOpenIdConnectionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminCreateOpenIdConnectionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -592,7 +592,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminEmptyResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminEmptyResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -603,7 +603,7 @@ public:
  * RSA CSP blob to be used to encrypt the payload of account creation requests when that API requires a signature header.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreatePlayerSharedSecretRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminCreatePlayerSharedSecretRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -613,7 +613,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreatePlayerSharedSecretResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminCreatePlayerSharedSecretResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -623,7 +623,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteOpenIdConnectionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteOpenIdConnectionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -637,7 +637,7 @@ public:
  * RSA CSP blob to be used to encrypt the payload of account creation requests when that API requires a signature header.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeletePlayerSharedSecretRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeletePlayerSharedSecretRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -647,7 +647,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeletePlayerSharedSecretResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeletePlayerSharedSecretResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -658,14 +658,14 @@ public:
  * RSA CSP blob to be used to encrypt the payload of account creation requests when that API requires a signature header.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerSharedSecretsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerSharedSecretsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerSharedSecretsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerSharedSecretsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -676,7 +676,7 @@ public:
 
 /** Views the requested policy. Today, the only supported policy is 'ApiPolicy'. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPolicyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPolicyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -686,7 +686,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPolicyResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPolicyResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -702,14 +702,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminListOpenIdConnectionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminListOpenIdConnectionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminListOpenIdConnectionResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminListOpenIdConnectionResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -727,7 +727,7 @@ public:
  * signature.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetPlayerSecretRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminSetPlayerSecretRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -740,14 +740,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetPlayerSecretResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminSetPlayerSecretResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateOpenIdConnectionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateOpenIdConnectionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -779,7 +779,7 @@ public:
  * RSA CSP blob to be used to encrypt the payload of account creation requests when that API requires a signature header.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdatePlayerSharedSecretRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdatePlayerSharedSecretRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -795,7 +795,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdatePlayerSharedSecretResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdatePlayerSharedSecretResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -810,7 +810,7 @@ public:
  * errors.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdatePolicyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdatePolicyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -829,7 +829,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdatePolicyResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdatePolicyResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -851,7 +851,7 @@ public:
  * leaderboards for the game.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminResetCharacterStatisticsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminResetCharacterStatisticsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -867,7 +867,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminResetCharacterStatisticsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminResetCharacterStatisticsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -879,14 +879,14 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminBlankResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminBlankResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteContentRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteContentRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -896,7 +896,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetContentListRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetContentListRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -909,7 +909,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetContentListResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetContentListResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -925,7 +925,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetContentUploadUrlRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetContentUploadUrlRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -941,7 +941,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetContentUploadUrlResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetContentUploadUrlResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -983,7 +983,7 @@ public:
  * smallest (Min), or add them together (Sum).
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreatePlayerStatisticDefinitionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminCreatePlayerStatisticDefinitionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1002,7 +1002,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreatePlayerStatisticDefinitionResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminCreatePlayerStatisticDefinitionResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1013,7 +1013,7 @@ public:
 
 /** Deletes custom properties for the specified player. The list of provided property names must be non-empty. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeletePlayerCustomPropertiesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeletePlayerCustomPropertiesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1035,7 +1035,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeletePlayerCustomPropertiesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeletePlayerCustomPropertiesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1058,7 +1058,7 @@ public:
  * available in the Game Manager, in the Analytics->Reports tab.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetDataReportRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetDataReportRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1077,7 +1077,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetDataReportResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetDataReportResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1090,7 +1090,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerCustomPropertyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerCustomPropertyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1103,7 +1103,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerCustomPropertyResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerCustomPropertyResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1122,7 +1122,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerStatisticDefinitionsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerStatisticDefinitionsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1143,7 +1143,7 @@ public:
  * smallest (Min), or add them together (Sum).
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerStatisticDefinitionsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerStatisticDefinitionsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1153,7 +1153,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerStatisticVersionsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerStatisticVersionsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1174,7 +1174,7 @@ public:
  * not been reset (incremented/versioned) will only have a single version which is not scheduled to reset.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerStatisticVersionsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerStatisticVersionsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1188,7 +1188,7 @@ public:
  * the data specific to the indicated Keys. Otherwise, the full set of custom user data will be returned.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetUserDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetUserDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1207,7 +1207,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetUserDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetUserDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1238,7 +1238,7 @@ public:
  * information (GetPlayerStatisticVersions).
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminIncrementPlayerStatisticVersionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminIncrementPlayerStatisticVersionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1251,7 +1251,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminIncrementPlayerStatisticVersionResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminIncrementPlayerStatisticVersionResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1261,7 +1261,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminListPlayerCustomPropertiesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminListPlayerCustomPropertiesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1271,7 +1271,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminListPlayerCustomPropertiesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminListPlayerCustomPropertiesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1290,7 +1290,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRefundPurchaseRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminRefundPurchaseRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1310,7 +1310,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRefundPurchaseResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminRefundPurchaseResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1324,7 +1324,7 @@ public:
  * leaderboards for the game.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminResetUserStatisticsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminResetUserStatisticsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1337,14 +1337,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminResetUserStatisticsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminResetUserStatisticsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminResolvePurchaseDisputeRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminResolvePurchaseDisputeRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1370,7 +1370,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminResolvePurchaseDisputeResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminResolvePurchaseDisputeResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1385,7 +1385,7 @@ public:
  * from those specified in the call.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdatePlayerCustomPropertiesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdatePlayerCustomPropertiesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1407,7 +1407,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdatePlayerCustomPropertiesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdatePlayerCustomPropertiesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1437,7 +1437,7 @@ public:
  * smallest (Min), or add them together (Sum).
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdatePlayerStatisticDefinitionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdatePlayerStatisticDefinitionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1456,7 +1456,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdatePlayerStatisticDefinitionResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdatePlayerStatisticDefinitionResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1471,7 +1471,7 @@ public:
  * with null values will be removed. No other key-value pairs will be changed apart from those specified in the call.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateUserDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateUserDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1499,7 +1499,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateUserDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateUserDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1517,7 +1517,7 @@ public:
  * null values will be removed. No other key-value pairs will be changed apart from those specified in the call.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateUserInternalDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateUserInternalDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1547,7 +1547,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminAddUserVirtualCurrencyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminAddUserVirtualCurrencyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1569,7 +1569,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminModifyUserVirtualCurrencyResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminModifyUserVirtualCurrencyResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1592,7 +1592,7 @@ public:
 
 /** This returns the total number of these items available. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCheckLimitedEditionItemAvailabilityRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminCheckLimitedEditionItemAvailabilityRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1605,7 +1605,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCheckLimitedEditionItemAvailabilityResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminCheckLimitedEditionItemAvailabilityResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1621,7 +1621,7 @@ public:
  * changes to be reflected in the GetUserInventory API response.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetUserInventoryRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetUserInventoryRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1634,7 +1634,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetUserInventoryResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetUserInventoryResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1659,7 +1659,7 @@ public:
  * the grant/purchase operation.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGrantItemsToUsersRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGrantItemsToUsersRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1676,7 +1676,7 @@ public:
 
 /** Please note that the order of the items in the response may not match the order of items in the request. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGrantItemsToUsersResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGrantItemsToUsersResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1690,7 +1690,7 @@ public:
  * decremented, except by actual grants.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminIncrementLimitedEditionItemAvailabilityRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminIncrementLimitedEditionItemAvailabilityRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1709,7 +1709,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminIncrementLimitedEditionItemAvailabilityResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminIncrementLimitedEditionItemAvailabilityResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1720,7 +1720,7 @@ public:
  * will not revoke access or otherwise remove the items which were dispensed.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRevokeInventoryItemRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminRevokeInventoryItemRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1736,7 +1736,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRevokeInventoryResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminRevokeInventoryResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1747,7 +1747,7 @@ public:
  * will not revoke access or otherwise remove the items which were dispensed.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRevokeInventoryItemsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminRevokeInventoryItemsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1757,7 +1757,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRevokeInventoryItemsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminRevokeInventoryItemsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1767,7 +1767,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSubtractUserVirtualCurrencyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminSubtractUserVirtualCurrencyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1796,7 +1796,7 @@ public:
  * number of tags a title can have.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminAddPlayerTagRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminAddPlayerTagRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1812,7 +1812,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminAddPlayerTagResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminAddPlayerTagResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1820,7 +1820,7 @@ public:
 
 /** Request must contain the Segment ID */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminExportPlayersInSegmentRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminExportPlayersInSegmentRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1830,7 +1830,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminExportPlayersInSegmentResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminExportPlayersInSegmentResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1844,14 +1844,14 @@ public:
 
 /** Request has no paramaters. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetAllSegmentsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetAllSegmentsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetAllSegmentsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetAllSegmentsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1861,7 +1861,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerSegmentsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerSegmentsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1871,7 +1871,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayersSegmentsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayersSegmentsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1893,7 +1893,7 @@ public:
  * the API may be rejected with the APIConcurrentRequestLimitExceeded error.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayersInSegmentRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayersInSegmentRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1928,7 +1928,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayersInSegmentResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayersInSegmentResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1949,7 +1949,7 @@ public:
  * 128 characters.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerTagsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerTagsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1965,7 +1965,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayerTagsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayerTagsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1979,7 +1979,7 @@ public:
 
 /** Request must contain the ExportId */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayersInSegmentExportRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayersInSegmentExportRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1989,7 +1989,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPlayersInSegmentExportResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPlayersInSegmentExportResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2006,7 +2006,7 @@ public:
  * corresponding player profile. TagName can be used for segmentation and it is limited to 256 characters
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRemovePlayerTagRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminRemovePlayerTagRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2022,7 +2022,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRemovePlayerTagResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminRemovePlayerTagResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2035,7 +2035,7 @@ public:
 
 /** If the task instance has already completed, there will be no-op. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminAbortTaskInstanceRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminAbortTaskInstanceRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2052,7 +2052,7 @@ public:
  * create-task requests within a short time will cause a create conflict error.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreateActionsOnPlayerSegmentTaskRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminCreateActionsOnPlayerSegmentTaskRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2077,7 +2077,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreateTaskResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminCreateTaskResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2091,7 +2091,7 @@ public:
  * create-task requests within a short time will cause a create conflict error.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreateCloudScriptTaskRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminCreateCloudScriptTaskRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2120,7 +2120,7 @@ public:
  * create-task requests within a short time will cause a create conflict error.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreateInsightsScheduledScalingTaskRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminCreateInsightsScheduledScalingTaskRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2150,7 +2150,7 @@ public:
  * task specified does not exist, the deletion is considered a success.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteTaskRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteTaskRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2160,7 +2160,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetActionsOnPlayersInSegmentTaskInstanceResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetActionsOnPlayersInSegmentTaskInstanceResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2178,7 +2178,7 @@ public:
  * GetTaskInstances.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetTaskInstanceRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetTaskInstanceRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2188,7 +2188,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetCloudScriptTaskInstanceResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetCloudScriptTaskInstanceResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2206,7 +2206,7 @@ public:
  * corresponding task type.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetTaskInstancesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetTaskInstancesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2228,7 +2228,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetTaskInstancesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetTaskInstancesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2242,7 +2242,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetTasksRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetTasksRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2252,7 +2252,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetTasksResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetTasksResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2263,7 +2263,7 @@ public:
 
 /** The returned task instance ID can be used to query for task execution status. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRunTaskRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminRunTaskRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2276,7 +2276,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRunTaskResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminRunTaskResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2295,7 +2295,7 @@ public:
  * logics where the task name is used as an identifier.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateTaskRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateTaskRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2332,7 +2332,7 @@ public:
 
 /** Send all the segment details part of CreateSegmentRequest */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreateSegmentRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminCreateSegmentRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2342,7 +2342,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminCreateSegmentResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminCreateSegmentResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2356,7 +2356,7 @@ public:
 
 /** Send segment id planning to delete part of DeleteSegmentRequest object */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteSegmentRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteSegmentRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2366,7 +2366,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteSegmentsResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteSegmentsResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2377,7 +2377,7 @@ public:
 
 /** Given input segment ids, return list of segments. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetSegmentsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetSegmentsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2387,7 +2387,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetSegmentsResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetSegmentsResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2401,7 +2401,7 @@ public:
 
 /** Update segment properties data which are planning to update */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateSegmentRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateSegmentRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2411,7 +2411,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateSegmentResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateSegmentResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2429,7 +2429,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetCloudScriptRevisionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetCloudScriptRevisionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2442,7 +2442,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetCloudScriptRevisionResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetCloudScriptRevisionResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2464,14 +2464,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetCloudScriptVersionsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetCloudScriptVersionsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetCloudScriptVersionsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetCloudScriptVersionsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2481,7 +2481,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetPublishedRevisionRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminSetPublishedRevisionRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2497,14 +2497,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetPublishedRevisionResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminSetPublishedRevisionResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateCloudScriptRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateCloudScriptRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2523,7 +2523,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateCloudScriptResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateCloudScriptResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2548,7 +2548,7 @@ public:
  * Value. For more information email helloplayfab@microsoft.com
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetPublisherDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminSetPublisherDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2564,7 +2564,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetPublisherDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminSetPublisherDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2576,7 +2576,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminAddLocalizedNewsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminAddLocalizedNewsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2598,14 +2598,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminAddLocalizedNewsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminAddLocalizedNewsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminAddNewsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminAddNewsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2624,7 +2624,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminAddNewsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminAddNewsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2638,7 +2638,7 @@ public:
  * title, while any CurrencyCode identifiers matching existing ones in the game will be overwritten with the new values.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminAddVirtualCurrencyTypesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminAddVirtualCurrencyTypesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2652,7 +2652,7 @@ public:
 
 /** This non-reversible operation will permanently delete the requested store. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteStoreRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteStoreRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2668,7 +2668,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteStoreResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteStoreResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2676,7 +2676,7 @@ public:
 
 /** Will delete all the title data associated with the given override label. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteTitleDataOverrideRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteTitleDataOverrideRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2686,14 +2686,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminDeleteTitleDataOverrideResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminDeleteTitleDataOverrideResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetCatalogItemsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetCatalogItemsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2703,7 +2703,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetCatalogItemsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetCatalogItemsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2719,7 +2719,7 @@ public:
  * getting title data guarantees no delay in between update and retrieval of newly set data.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPublisherDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetPublisherDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2729,7 +2729,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetPublisherDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetPublisherDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2739,7 +2739,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetRandomResultTablesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetRandomResultTablesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2749,7 +2749,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetRandomResultTablesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetRandomResultTablesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2769,7 +2769,7 @@ public:
  * specified in the store for an item, the price set in the catalog should be displayed to the user.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetStoreItemsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetStoreItemsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2782,7 +2782,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetStoreItemsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetStoreItemsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2812,7 +2812,7 @@ public:
  * value.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetTitleDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminGetTitleDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2828,7 +2828,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminGetTitleDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminGetTitleDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2838,14 +2838,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminListVirtualCurrencyTypesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminListVirtualCurrencyTypesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminListVirtualCurrencyTypesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminListVirtualCurrencyTypesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2860,7 +2860,7 @@ public:
  * balances will be in an undefined state.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminRemoveVirtualCurrencyTypesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminRemoveVirtualCurrencyTypesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2877,7 +2877,7 @@ public:
  * in the catalog will overwrite those items with the given values.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateCatalogItemsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateCatalogItemsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2902,7 +2902,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateCatalogItemsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateCatalogItemsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2924,7 +2924,7 @@ public:
  * should be displayed to the user.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateStoreItemsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateStoreItemsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2946,7 +2946,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateStoreItemsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateStoreItemsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2957,7 +2957,7 @@ public:
  * If it already exists, the Value for that key will be overwritten with the new Value.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetTitleDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminSetTitleDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2973,7 +2973,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetTitleDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminSetTitleDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2984,7 +2984,7 @@ public:
  * or not.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetTitleDataAndOverridesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminSetTitleDataAndOverridesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3000,7 +3000,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetTitleDataAndOverridesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminSetTitleDataAndOverridesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3012,7 +3012,7 @@ public:
  * The current ARN (if one exists) can be overwritten by setting the OverwriteOldARN boolean to true.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetupPushNotificationRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminSetupPushNotificationRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3040,7 +3040,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminSetupPushNotificationResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminSetupPushNotificationResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3054,7 +3054,7 @@ public:
  * values matching Tables currently in the catalog will be overwritten with the given values.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateRandomResultTablesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateRandomResultTablesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3073,7 +3073,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FAdminUpdateRandomResultTablesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FAdminUpdateRandomResultTablesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
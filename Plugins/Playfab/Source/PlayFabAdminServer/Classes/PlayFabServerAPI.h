@@ -24,7 +24,7 @@ class UPlayFabAuthenticationContext;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnPlayFabServerRequestCompleted, FPlayFabBaseModel, response, UObject*, customData, bool, successful);
 
 UCLASS(Blueprintable, BlueprintType)
-class PLAYFAB_API UPlayFabServerAPI : public UOnlineBlueprintCallProxyBase
+class PLAYFABADMINSERVER_API UPlayFabServerAPI : public UOnlineBlueprintCallProxyBase
 {
     GENERATED_UCLASS_BODY()
 
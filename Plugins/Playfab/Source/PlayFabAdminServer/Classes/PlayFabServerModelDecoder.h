@@ -21,7 +21,7 @@
 class UPlayFabJsonObject;
 
 UCLASS()
-class PLAYFAB_API UPlayFabServerModelDecoder : public UBlueprintFunctionLibrary
+class PLAYFABADMINSERVER_API UPlayFabServerModelDecoder : public UBlueprintFunctionLibrary
 {
     GENERATED_BODY()
 
@@ -31,7 +31,7 @@ class UPlayFabJsonObject;
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAddGenericIDRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerAddGenericIDRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -44,7 +44,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerEmptyResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerEmptyResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -55,7 +55,7 @@ public:
  * use this feature with caution. Returns information about the new bans.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerBanUsersRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerBanUsersRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -68,7 +68,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerBanUsersResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerBanUsersResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -88,7 +88,7 @@ public:
  * an option in the game manager website. It is disabled by default.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerDeletePlayerRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerDeletePlayerRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -98,7 +98,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerDeletePlayerResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerDeletePlayerResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -106,7 +106,7 @@ public:
 
 /** Represents the request to delete a push notification template. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerDeletePushNotificationTemplateRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerDeletePushNotificationTemplateRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -116,7 +116,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerDeletePushNotificationTemplateResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerDeletePushNotificationTemplateResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -129,7 +129,7 @@ public:
  * have accessed the title, the recommendation is to not store this data locally.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerProfileRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerProfileRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -149,7 +149,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerProfileResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerProfileResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -162,7 +162,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromFacebookIDsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromFacebookIDsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -176,7 +176,7 @@ public:
 
 /** For Facebook identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromFacebookIDsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromFacebookIDsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -186,7 +186,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromFacebookInstantGamesIdsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromFacebookInstantGamesIdsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -200,7 +200,7 @@ public:
 
 /** For Facebook Instant Games identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromFacebookInstantGamesIdsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromFacebookInstantGamesIdsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -210,7 +210,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromGenericIDsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromGenericIDsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -224,7 +224,7 @@ public:
 
 /** For generic service identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromGenericIDsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromGenericIDsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -234,7 +234,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromNintendoServiceAccountIdsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromNintendoServiceAccountIdsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -248,7 +248,7 @@ public:
 
 /** For Nintendo Service Account identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromNintendoServiceAccountIdsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromNintendoServiceAccountIdsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -258,7 +258,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -272,7 +272,7 @@ public:
 
 /** For Nintendo Switch Device identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromNintendoSwitchDeviceIdsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromNintendoSwitchDeviceIdsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -282,7 +282,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromPSNAccountIDsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromPSNAccountIDsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -299,7 +299,7 @@ public:
 
 /** For PlayStation :tm: Network identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromPSNAccountIDsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromPSNAccountIDsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -309,7 +309,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromPSNOnlineIDsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromPSNOnlineIDsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -326,7 +326,7 @@ public:
 
 /** For PlayStation :tm: Network identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromPSNOnlineIDsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromPSNOnlineIDsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -336,7 +336,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromSteamIDsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromSteamIDsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -350,7 +350,7 @@ public:
 
 /** For Steam identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromSteamIDsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromSteamIDsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -360,7 +360,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromSteamNamesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromSteamNamesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -374,7 +374,7 @@ public:
 
 /** For Steam identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromSteamNamesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromSteamNamesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -384,7 +384,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromTwitchIDsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromTwitchIDsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -398,7 +398,7 @@ public:
 
 /** For Twitch identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromTwitchIDsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromTwitchIDsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -408,7 +408,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromXboxLiveIDsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromXboxLiveIDsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -425,7 +425,7 @@ public:
 
 /** For XboxLive identifiers which have not been linked to PlayFab accounts, null will be returned. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayFabIDsFromXboxLiveIDsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayFabIDsFromXboxLiveIDsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -435,7 +435,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetServerCustomIDsFromPlayFabIDsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetServerCustomIDsFromPlayFabIDsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -449,7 +449,7 @@ public:
 
 /** For a PlayFab account that isn't associated with a server custom identity, ServerCustomId will be null. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetServerCustomIDsFromPlayFabIDsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetServerCustomIDsFromPlayFabIDsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -465,7 +465,7 @@ public:
  * have accessed the title, the recommendation is to not store this data locally.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetUserAccountInfoRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetUserAccountInfoRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -475,7 +475,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetUserAccountInfoResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetUserAccountInfoResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -486,7 +486,7 @@ public:
 
 /** Get all bans for a user, including inactive and expired bans. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetUserBansRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetUserBansRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -496,7 +496,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetUserBansResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetUserBansResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -506,7 +506,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkNintendoServiceAccountRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLinkNintendoServiceAccountRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -528,7 +528,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkNintendoServiceAccountSubjectRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLinkNintendoServiceAccountSubjectRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -547,7 +547,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkNintendoSwitchDeviceIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLinkNintendoSwitchDeviceIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -566,14 +566,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkNintendoSwitchDeviceIdResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerLinkNintendoSwitchDeviceIdResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkPSNAccountRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLinkPSNAccountRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -598,14 +598,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkPSNAccountResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerLinkPSNAccountResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkPSNIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLinkPSNIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -627,14 +627,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkPSNIdResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerLinkPSNIdResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkServerCustomIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLinkServerCustomIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -653,14 +653,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkServerCustomIdResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerLinkServerCustomIdResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkSteamIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLinkSteamIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -679,14 +679,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkSteamIdResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerLinkSteamIdResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkXboxAccountRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLinkXboxAccountRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -705,14 +705,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLinkXboxAccountResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerLinkXboxAccountResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRemoveGenericIDRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerRemoveGenericIDRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -729,7 +729,7 @@ public:
  * ignored, however. Returns information about applied updates only.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRevokeAllBansForUserRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerRevokeAllBansForUserRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -739,7 +739,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRevokeAllBansForUserResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerRevokeAllBansForUserResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -753,7 +753,7 @@ public:
  * that do not exist will be skipped. Returns information about applied updates only.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRevokeBansRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerRevokeBansRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -763,7 +763,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRevokeBansResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerRevokeBansResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -774,7 +774,7 @@ public:
 
 /** Represents the save push notification template request. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSavePushNotificationTemplateRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSavePushNotificationTemplateRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -797,7 +797,7 @@ public:
 
 /** Represents the save push notification template result. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSavePushNotificationTemplateResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerSavePushNotificationTemplateResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -811,7 +811,7 @@ public:
  * API.The email sent must be an account recovery email template. The username or email can be passed in to send the email
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSendCustomAccountRecoveryEmailRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSendCustomAccountRecoveryEmailRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -830,7 +830,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSendCustomAccountRecoveryEmailResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerSendCustomAccountRecoveryEmailResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -841,7 +841,7 @@ public:
  * specifyingthe email template to send.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSendEmailFromTemplateRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSendEmailFromTemplateRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -857,14 +857,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSendEmailFromTemplateResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerSendEmailFromTemplateResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSendPushNotificationRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSendPushNotificationRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -898,7 +898,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSendPushNotificationResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerSendPushNotificationResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -906,7 +906,7 @@ public:
 
 /** Represents the request for sending a push notification template to a recipient. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSendPushNotificationFromTemplateRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSendPushNotificationFromTemplateRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -922,14 +922,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerEmptyResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerEmptyResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkNintendoServiceAccountRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkNintendoServiceAccountRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -942,7 +942,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkNintendoSwitchDeviceIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkNintendoSwitchDeviceIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -958,14 +958,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkNintendoSwitchDeviceIdResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkNintendoSwitchDeviceIdResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkPSNAccountRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkPSNAccountRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -978,14 +978,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkPSNAccountResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkPSNAccountResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkServerCustomIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkServerCustomIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1001,14 +1001,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkServerCustomIdResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkServerCustomIdResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkSteamIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkSteamIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1021,14 +1021,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkSteamIdResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkSteamIdResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkXboxAccountRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkXboxAccountRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1041,14 +1041,14 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlinkXboxAccountResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUnlinkXboxAccountResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateAvatarUrlRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdateAvatarUrlRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1065,7 +1065,7 @@ public:
  * the rest are still applied. Returns information about applied updates only.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateBansRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdateBansRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1075,7 +1075,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateBansResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUpdateBansResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1090,7 +1090,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerWriteEventResponse : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerWriteEventResponse : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1108,7 +1108,7 @@ public:
  * authenticated title.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerWriteServerCharacterEventRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerWriteServerCharacterEventRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1141,7 +1141,7 @@ public:
  * authenticated title.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerWriteServerPlayerEventRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerWriteServerPlayerEventRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1171,7 +1171,7 @@ public:
  * authenticated title.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerWriteTitleEventRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerWriteTitleEventRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1203,7 +1203,7 @@ public:
  * have accessed the title, the recommendation is to not store this data locally.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAuthenticateSessionTicketRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerAuthenticateSessionTicketRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1213,7 +1213,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAuthenticateSessionTicketResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerAuthenticateSessionTicketResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1233,7 +1233,7 @@ public:
  * of a PlayFab account.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLoginWithPSNRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLoginWithPSNRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1258,7 +1258,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerServerLoginResult : public FPlayFabLoginResultCommon
+struct PLAYFABADMINSERVER_API FServerServerLoginResult : public FPlayFabLoginResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1292,7 +1292,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLoginWithServerCustomIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLoginWithServerCustomIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1322,7 +1322,7 @@ public:
  * until they login while the Client is open.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLoginWithSteamIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLoginWithSteamIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1347,7 +1347,7 @@ public:
  * indicating this will be returned, so that the title can guide the user through creation of a PlayFab account.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLoginWithXboxRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLoginWithXboxRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1372,7 +1372,7 @@ public:
  * returned, so that the title can guide the user through creation of a PlayFab account.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerLoginWithXboxIdRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerLoginWithXboxIdRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1402,7 +1402,7 @@ public:
  * signature.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSetPlayerSecretRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSetPlayerSecretRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1415,7 +1415,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSetPlayerSecretResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerSetPlayerSecretResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1431,7 +1431,7 @@ public:
  * the data specific to the indicated Keys. Otherwise, the full set of custom user data will be returned.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCharacterDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetCharacterDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1453,7 +1453,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCharacterDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetCharacterDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1480,7 +1480,7 @@ public:
  * with null values will be removed. No other key-value pairs will be changed apart from those specified in the call.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateCharacterDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdateCharacterDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1511,7 +1511,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateCharacterDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUpdateCharacterDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1534,7 +1534,7 @@ public:
  * preserve leaderboard integrity.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerDeleteCharacterFromUserRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerDeleteCharacterFromUserRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1556,7 +1556,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerDeleteCharacterFromUserResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerDeleteCharacterFromUserResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1564,7 +1564,7 @@ public:
 
 /** Returns a list of every character that currently belongs to a user. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerListUsersCharactersRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerListUsersCharactersRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1574,7 +1574,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerListUsersCharactersResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerListUsersCharactersResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1584,7 +1584,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCharacterLeaderboardRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetCharacterLeaderboardRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1601,7 +1601,7 @@ public:
 
 /** Note that the Position of the character in the results is for the overall leaderboard. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCharacterLeaderboardResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetCharacterLeaderboardResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1616,7 +1616,7 @@ public:
  * by the title, the statistics are used for all leaderboard operations in PlayFab.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCharacterStatisticsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetCharacterStatisticsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1629,7 +1629,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCharacterStatisticsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetCharacterStatisticsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1645,7 +1645,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetLeaderboardAroundCharacterRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetLeaderboardAroundCharacterRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1668,7 +1668,7 @@ public:
  * not have the corresponding statistic.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetLeaderboardAroundCharacterResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetLeaderboardAroundCharacterResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1678,7 +1678,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetLeaderboardForUsersCharactersRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetLeaderboardForUsersCharactersRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1696,7 +1696,7 @@ public:
  * actual leaderboard.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetLeaderboardForUsersCharactersResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetLeaderboardForUsersCharactersResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1707,7 +1707,7 @@ public:
 
 /** Grants a character to the user of the type and name specified in the request. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGrantCharacterToUserRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGrantCharacterToUserRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1726,7 +1726,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGrantCharacterToUserResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGrantCharacterToUserResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1741,7 +1741,7 @@ public:
  * by the title, the statistics are used for all leaderboard operations in PlayFab.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateCharacterStatisticsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdateCharacterStatisticsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1760,7 +1760,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateCharacterStatisticsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUpdateCharacterStatisticsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1772,7 +1772,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetContentDownloadUrlRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetContentDownloadUrlRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1791,7 +1791,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetContentDownloadUrlResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetContentDownloadUrlResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1806,7 +1806,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAddFriendRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerAddFriendRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1828,7 +1828,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetFriendsListRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetFriendsListRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1863,7 +1863,7 @@ public:
  * Xbox Live recently, and only friends who also play this game will be included.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetFriendsListResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetFriendsListResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1873,7 +1873,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRemoveFriendRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerRemoveFriendRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1891,7 +1891,7 @@ public:
  * list from a social site integration (such as Facebook or Steam) will return the AccountNotFound error.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSetFriendTagsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSetFriendTagsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1917,7 +1917,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAwardSteamAchievementRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerAwardSteamAchievementRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1927,7 +1927,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAwardSteamAchievementResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerAwardSteamAchievementResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1943,7 +1943,7 @@ public:
 
 /** Deletes custom properties for the specified player. The list of provided property names must be non-empty. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerDeletePlayerCustomPropertiesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerDeletePlayerCustomPropertiesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1965,7 +1965,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerDeletePlayerCustomPropertiesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerDeletePlayerCustomPropertiesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -1984,7 +1984,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetFriendLeaderboardRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetFriendLeaderboardRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2029,7 +2029,7 @@ public:
 
 /** Note that the Position of the user in the results is for the overall leaderboard. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetLeaderboardResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetLeaderboardResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2045,7 +2045,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetLeaderboardRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetLeaderboardRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2077,7 +2077,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetLeaderboardAroundUserRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetLeaderboardAroundUserRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2113,7 +2113,7 @@ public:
  * the corresponding statistic.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetLeaderboardAroundUserResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetLeaderboardAroundUserResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2129,7 +2129,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerCombinedInfoRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerCombinedInfoRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2145,7 +2145,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerCombinedInfoResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerCombinedInfoResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2158,7 +2158,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerCustomPropertyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerCustomPropertyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2171,7 +2171,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerCustomPropertyResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerCustomPropertyResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2190,7 +2190,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerStatisticsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerStatisticsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2213,7 +2213,7 @@ public:
 
 /** In addition to being available for use by the title, the statistics are used for all leaderboard operations in PlayFab. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerStatisticsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerStatisticsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2226,7 +2226,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerStatisticVersionsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerStatisticVersionsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2239,7 +2239,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerStatisticVersionsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerStatisticVersionsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2253,7 +2253,7 @@ public:
  * the data specific to the indicated Keys. Otherwise, the full set of custom user data will be returned.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetUserDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetUserDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2272,7 +2272,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetUserDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetUserDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2291,7 +2291,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerListPlayerCustomPropertiesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerListPlayerCustomPropertiesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2301,7 +2301,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerListPlayerCustomPropertiesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerListPlayerCustomPropertiesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2325,7 +2325,7 @@ public:
  * from those specified in the call.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdatePlayerCustomPropertiesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdatePlayerCustomPropertiesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2347,7 +2347,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdatePlayerCustomPropertiesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUpdatePlayerCustomPropertiesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2367,7 +2367,7 @@ public:
  * with the given values. All other user statistics will remain unchanged.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdatePlayerStatisticsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdatePlayerStatisticsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2389,7 +2389,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdatePlayerStatisticsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUpdatePlayerStatisticsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2401,7 +2401,7 @@ public:
  * with null values will be removed. No other key-value pairs will be changed apart from those specified in the call.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateUserDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdateUserDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2429,7 +2429,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateUserDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUpdateUserDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2447,7 +2447,7 @@ public:
  * null values will be removed. No other key-value pairs will be changed apart from those specified in the call.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateUserInternalDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdateUserInternalDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2477,7 +2477,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAddCharacterVirtualCurrencyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerAddCharacterVirtualCurrencyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2502,7 +2502,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerModifyCharacterVirtualCurrencyResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerModifyCharacterVirtualCurrencyResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2515,7 +2515,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAddUserVirtualCurrencyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerAddUserVirtualCurrencyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2537,7 +2537,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerModifyUserVirtualCurrencyResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerModifyUserVirtualCurrencyResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2559,7 +2559,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerConsumeItemRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerConsumeItemRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2581,7 +2581,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerConsumeItemResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerConsumeItemResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2594,7 +2594,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerEvaluateRandomResultTableRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerEvaluateRandomResultTableRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2614,7 +2614,7 @@ public:
  * catalog if one is not specified), an InvalidDropTable error will be returned.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerEvaluateRandomResultTableResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerEvaluateRandomResultTableResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2629,7 +2629,7 @@ public:
  * user's current inventory, and so will not be not included. Also returns their virtual currency balances.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCharacterInventoryRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetCharacterInventoryRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2648,7 +2648,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCharacterInventoryResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetCharacterInventoryResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2670,7 +2670,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetRandomResultTablesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetRandomResultTablesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2690,7 +2690,7 @@ public:
  * error will be returned.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetRandomResultTablesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetRandomResultTablesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2705,7 +2705,7 @@ public:
  * user's current inventory, and so will not be not included.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetUserInventoryRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetUserInventoryRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2718,7 +2718,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetUserInventoryResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetUserInventoryResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2743,7 +2743,7 @@ public:
  * more items are in the grant/purchase operation.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGrantItemsToCharacterRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGrantItemsToCharacterRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2768,7 +2768,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGrantItemsToCharacterResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGrantItemsToCharacterResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2784,7 +2784,7 @@ public:
  * are in the grant/purchase operation.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGrantItemsToUserRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGrantItemsToUserRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2807,7 +2807,7 @@ public:
 
 /** Please note that the order of the items in the response may not match the order of items in the request. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGrantItemsToUserResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGrantItemsToUserResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2823,7 +2823,7 @@ public:
  * the grant/purchase operation.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGrantItemsToUsersRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGrantItemsToUsersRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2840,7 +2840,7 @@ public:
 
 /** Please note that the order of the items in the response may not match the order of items in the request. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGrantItemsToUsersResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGrantItemsToUsersResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2854,7 +2854,7 @@ public:
  * be removed from active inventory.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerModifyItemUsesRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerModifyItemUsesRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2873,7 +2873,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerModifyItemUsesResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerModifyItemUsesResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2891,7 +2891,7 @@ public:
  * item instead.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerMoveItemToCharacterFromCharacterRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerMoveItemToCharacterFromCharacterRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2910,7 +2910,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerMoveItemToCharacterFromCharacterResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerMoveItemToCharacterFromCharacterResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2921,7 +2921,7 @@ public:
  * unless it is moved back), and will enable the character to make use of the item instead.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerMoveItemToCharacterFromUserRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerMoveItemToCharacterFromUserRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2937,7 +2937,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerMoveItemToCharacterFromUserResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerMoveItemToCharacterFromUserResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2948,7 +2948,7 @@ public:
  * and unless it is moved back), and will enable the user to make use of the item instead.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerMoveItemToUserFromCharacterRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerMoveItemToUserFromCharacterRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2964,7 +2964,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerMoveItemToUserFromCharacterResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerMoveItemToUserFromCharacterResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2976,7 +2976,7 @@ public:
  * or a code which has not yet been created in the service, will result in an error.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRedeemCouponRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerRedeemCouponRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -2998,7 +2998,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRedeemCouponResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerRedeemCouponResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3008,7 +3008,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerReportPlayerServerRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerReportPlayerServerRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3031,7 +3031,7 @@ public:
  * will result in Updated being returned as false.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerReportPlayerServerResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerReportPlayerServerResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3045,7 +3045,7 @@ public:
  * will not revoke access or otherwise remove the items which were dispensed.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRevokeInventoryItemRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerRevokeInventoryItemRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3061,7 +3061,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRevokeInventoryResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerRevokeInventoryResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3072,7 +3072,7 @@ public:
  * will not revoke access or otherwise remove the items which were dispensed.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRevokeInventoryItemsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerRevokeInventoryItemsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3082,7 +3082,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRevokeInventoryItemsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerRevokeInventoryItemsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3092,7 +3092,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSubtractCharacterVirtualCurrencyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSubtractCharacterVirtualCurrencyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3114,7 +3114,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSubtractUserVirtualCurrencyRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSubtractUserVirtualCurrencyRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3134,7 +3134,7 @@ public:
 
 /** Specify the container and optionally the catalogVersion for the container to open */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlockContainerInstanceRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUnlockContainerInstanceRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3166,7 +3166,7 @@ public:
 
 /** The items and vc found within the container. These will be added and stacked in your inventory as appropriate. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlockContainerItemResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUnlockContainerItemResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3186,7 +3186,7 @@ public:
 
 /** Specify the type of container to open and optionally the catalogVersion for the container to open */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUnlockContainerItemRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUnlockContainerItemRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3217,7 +3217,7 @@ public:
  * apart from those specified in the call.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateUserInventoryItemDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdateUserInventoryItemDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3258,7 +3258,7 @@ public:
  * number of tags a title can have.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAddPlayerTagRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerAddPlayerTagRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3274,7 +3274,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAddPlayerTagResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerAddPlayerTagResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3282,14 +3282,14 @@ public:
 
 /** Request has no paramaters. */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetAllSegmentsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetAllSegmentsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetAllSegmentsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetAllSegmentsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3299,7 +3299,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerSegmentsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerSegmentsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3309,7 +3309,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayersSegmentsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayersSegmentsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3331,7 +3331,7 @@ public:
  * the API may be rejected with the APIConcurrentRequestLimitExceeded error.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayersInSegmentRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayersInSegmentRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3366,7 +3366,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayersInSegmentResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayersInSegmentResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3387,7 +3387,7 @@ public:
  * 128 characters.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerTagsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerTagsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3403,7 +3403,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPlayerTagsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPlayerTagsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3420,7 +3420,7 @@ public:
  * corresponding player profile. TagName can be used for segmentation and it is limited to 256 characters
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRemovePlayerTagRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerRemovePlayerTagRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3436,7 +3436,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRemovePlayerTagResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerRemovePlayerTagResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3448,7 +3448,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerExecuteCloudScriptResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerExecuteCloudScriptResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3501,7 +3501,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerExecuteCloudScriptServerRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerExecuteCloudScriptServerRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3541,7 +3541,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAddSharedGroupMembersRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerAddSharedGroupMembersRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3554,7 +3554,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerAddSharedGroupMembersResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerAddSharedGroupMembersResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3565,7 +3565,7 @@ public:
  * if it is already in use. If no SharedGroupId is specified, a random identifier will be assigned.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerCreateSharedGroupRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerCreateSharedGroupRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3575,7 +3575,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerCreateSharedGroupResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerCreateSharedGroupResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3585,7 +3585,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerDeleteSharedGroupRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerDeleteSharedGroupRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3595,7 +3595,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetSharedGroupDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetSharedGroupDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3614,7 +3614,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetSharedGroupDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetSharedGroupDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3627,7 +3627,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRemoveSharedGroupMembersRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerRemoveSharedGroupMembersRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3640,7 +3640,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerRemoveSharedGroupMembersResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerRemoveSharedGroupMembersResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3653,7 +3653,7 @@ public:
  * combination of user data and shared group data.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateSharedGroupDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerUpdateSharedGroupDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3681,7 +3681,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerUpdateSharedGroupDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerUpdateSharedGroupDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3693,7 +3693,7 @@ public:
 //////////////////////////////////////////////////////
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCatalogItemsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetCatalogItemsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3703,7 +3703,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetCatalogItemsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetCatalogItemsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3719,7 +3719,7 @@ public:
  * to a minute delay in between updating title data and this API call returning the newest value.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPublisherDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetPublisherDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3729,7 +3729,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetPublisherDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetPublisherDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3739,7 +3739,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetStoreItemsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetStoreItemsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3772,7 +3772,7 @@ public:
  * to the user.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetStoreItemsServerRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetStoreItemsServerRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3798,7 +3798,7 @@ public:
  * servers, there is a potential variance of up to 5 seconds.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetTimeRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetTimeRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3806,7 +3806,7 @@ public:
 
 /** Time is always returned as Coordinated Universal Time (UTC). */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetTimeResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetTimeResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3824,7 +3824,7 @@ public:
  * newest value.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetTitleDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetTitleDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3840,7 +3840,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetTitleDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetTitleDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3850,7 +3850,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetTitleNewsRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerGetTitleNewsRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3860,7 +3860,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerGetTitleNewsResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerGetTitleNewsResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3877,7 +3877,7 @@ public:
  * Value. For more information email helloplayfab@microsoft.com
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSetPublisherDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSetPublisherDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3893,7 +3893,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSetPublisherDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerSetPublisherDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3907,7 +3907,7 @@ public:
  * Value. If it already exists, the Value for that key will be overwritten with the new Value.
  */
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSetTitleDataRequest : public FPlayFabRequestCommon
+struct PLAYFABADMINSERVER_API FServerSetTitleDataRequest : public FPlayFabRequestCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -3923,7 +3923,7 @@ public:
 };
 
 USTRUCT(BlueprintType)
-struct PLAYFAB_API FServerSetTitleDataResult : public FPlayFabResultCommon
+struct PLAYFABADMINSERVER_API FServerSetTitleDataResult : public FPlayFabResultCommon
 {
     GENERATED_USTRUCT_BODY()
 public:
@@ -0,0 +1,33 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+using UnrealBuildTool;
+using System.IO; 
+
+namespace UnrealBuildTool.Rules
+{
+    public class PlayFabAdminServer : ModuleRules
+    {
+        public PlayFabAdminServer(ReadOnlyTargetRules Target) : base(Target)
+        {
+            PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+            PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Private"));
+
+            PublicDependencyModuleNames.AddRange(
+                new string[]
+                {
+                    "Core",
+                    "CoreUObject",
+                    "Engine",
+                    "HTTP",
+                    "Json",
+                    "JsonUtilities",
+                    "PlayFabCommon",
+                    "PlayFab"
+                }
+            );
+        }
+    }
+}
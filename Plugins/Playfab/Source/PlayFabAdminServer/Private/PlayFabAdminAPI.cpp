@@ -12,10 +12,11 @@
 #include "PlayFabAdminAPI.h"
 #include "PlayFabAdminModels.h"
 #include "PlayFabAdminModelDecoder.h"
-#include "PlayFabPrivate.h"
+#include "PlayFabAdminServerPrivate.h"
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabAdminAPI::UPlayFabAdminAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -6933,7 +6934,7 @@ void UPlayFabAdminAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabAdminAPI::ResetResponseData()
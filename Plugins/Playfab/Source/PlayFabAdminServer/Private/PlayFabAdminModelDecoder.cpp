@@ -10,7 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "PlayFabAdminModelDecoder.h"
-#include "PlayFabPrivate.h"
+#include "PlayFabAdminServerPrivate.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Admin API Functions
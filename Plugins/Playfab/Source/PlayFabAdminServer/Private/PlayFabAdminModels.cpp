@@ -10,4 +10,4 @@
 //////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "PlayFabAdminModels.h"
-#include "PlayFabPrivate.h"
\ No newline at end of file
+#include "PlayFabAdminServerPrivate.h"
\ No newline at end of file
@@ -0,0 +1,35 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Blueprint nodes for the Admin and Server APIs.
+// Kept out of the PlayFab module so that game clients neither ship nor register them;
+// the plugin only loads this module in Editor and Server targets.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CoreMinimal.h"
+#include "PlayFabAdminServerPrivate.h"
+
+#include "PlayFabAdminAPI.h"
+#include "PlayFabServerAPI.h"
+
+class FPlayFabAdminServer : public IModuleInterface
+{
+    /** IModuleInterface implementation */
+    virtual void StartupModule() override
+    {
+        //Force classes to be compiled on shipping build
+        UPlayFabAdminAPI::StaticClass();
+        UPlayFabServerAPI::StaticClass();
+    }
+
+    virtual void ShutdownModule() override
+    {
+
+    }
+
+};
+
+IMPLEMENT_MODULE(FPlayFabAdminServer, PlayFabAdminServer)
@@ -0,0 +1,21 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// PlayFab Admin/Server Blueprint Header File
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Delegates/Delegate.h"
+#include "Http.h"
+#include "Containers/Map.h"
+
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include "Modules/ModuleManager.h"
+
+#include "IPlayFab.h"
@@ -12,10 +12,11 @@
 #include "PlayFabServerAPI.h"
 #include "PlayFabServerModels.h"
 #include "PlayFabServerModelDecoder.h"
-#include "PlayFabPrivate.h"
+#include "PlayFabAdminServerPrivate.h"
 #include "PlayFabEnums.h"
 #include "PlayFabAuthenticationContext.h"
 #include "PlayFabCommonUtils.h"
+#include "PlayFabDispatchScheduler.h"
 
 UPlayFabServerAPI::UPlayFabServerAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -8736,7 +8737,7 @@ void UPlayFabServerAPI::Activate()
 
     // Execute the request
     pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest);
 }
 
 void UPlayFabServerAPI::ResetResponseData()
@@ -10,7 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "PlayFabServerModelDecoder.h"
-#include "PlayFabPrivate.h"
+#include "PlayFabAdminServerPrivate.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Server API Functions
@@ -10,4 +10,4 @@
 //////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "PlayFabServerModels.h"
-#include "PlayFabPrivate.h"
\ No newline at end of file
+#include "PlayFabAdminServerPrivate.h"
\ No newline at end of file
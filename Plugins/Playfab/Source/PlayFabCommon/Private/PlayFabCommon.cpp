@@ -31,20 +31,20 @@ class FPlayFabCommonModule : public IPlayFabCommonModuleInterface
     FString GetBuildIdentifier() const override { return PlayFabCommon::PlayFabCommonSettings::buildIdentifier; }
     FString GetVersionString() const override { return PlayFabCommon::PlayFabCommonSettings::versionString; }
 
-    FString GetClientSessionTicket() const override { return PlayFabCommon::PlayFabCommonSettings::clientSessionTicket; }
-    FString GetEntityToken() const override { return PlayFabCommon::PlayFabCommonSettings::entityToken; }
+    FString GetClientSessionTicket() const override { return PlayFabCommon::PlayFabCommonSettings::GetClientSessionTicket(); }
+    FString GetEntityToken() const override { return PlayFabCommon::PlayFabCommonSettings::GetEntityToken(); }
 
-    void SetClientSessionTicket(const FString& clientSessionTicket) override { PlayFabCommon::PlayFabCommonSettings::clientSessionTicket = clientSessionTicket; }
-    void SetEntityToken(const FString& entityToken) override { PlayFabCommon::PlayFabCommonSettings::entityToken = entityToken; }  
+    void SetClientSessionTicket(const FString& clientSessionTicket) override { PlayFabCommon::PlayFabCommonSettings::SetClientSessionTicket(clientSessionTicket); }
+    void SetEntityToken(const FString& entityToken) override { PlayFabCommon::PlayFabCommonSettings::SetEntityToken(entityToken); }  
 
-    FString GetPhotonRealtimeAppId() const override { return PlayFabCommon::PlayFabCommonSettings::photonRealtimeAppId; }
-    void SetPhotonRealtimeAppId(const FString & photonRealtimeAppId) override { PlayFabCommon::PlayFabCommonSettings::photonRealtimeAppId = photonRealtimeAppId; }
+    FString GetPhotonRealtimeAppId() const override { return PlayFabCommon::PlayFabCommonSettings::GetPhotonRealtimeAppId(); }
+    void SetPhotonRealtimeAppId(const FString & photonRealtimeAppId) override { PlayFabCommon::PlayFabCommonSettings::SetPhotonRealtimeAppId(photonRealtimeAppId); }
 
-    FString GetPhotonTurnbasedAppId() const override { return PlayFabCommon::PlayFabCommonSettings::photonTurnbasedAppId; }
-    void SetPhotonTurnbasedAppId(const FString & photonTurnbasedAppId) override { PlayFabCommon::PlayFabCommonSettings::photonTurnbasedAppId = photonTurnbasedAppId; }
+    FString GetPhotonTurnbasedAppId() const override { return PlayFabCommon::PlayFabCommonSettings::GetPhotonTurnbasedAppId(); }
+    void SetPhotonTurnbasedAppId(const FString & photonTurnbasedAppId) override { PlayFabCommon::PlayFabCommonSettings::SetPhotonTurnbasedAppId(photonTurnbasedAppId); }
 
-    FString GetPhotonChatAppId() const override { return PlayFabCommon::PlayFabCommonSettings::photonChatAppId; }
-    void SetPhotonChatAppId(const FString & photonChatAppId) override { PlayFabCommon::PlayFabCommonSettings::photonChatAppId = photonChatAppId; }
+    FString GetPhotonChatAppId() const override { return PlayFabCommon::PlayFabCommonSettings::GetPhotonChatAppId(); }
+    void SetPhotonChatAppId(const FString & photonChatAppId) override { PlayFabCommon::PlayFabCommonSettings::SetPhotonChatAppId(photonChatAppId); }
 
     FString GeneratePfUrl(const FString& urlPath) const override { return PlayFabCommon::PlayFabCommonSettings::GeneratePfUrl(urlPath); }
 };
@@ -5,6 +5,7 @@
 
 #include "PlayFabCommonSettings.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeRWLock.h"
 
 namespace PlayFabCommon
 {
@@ -26,9 +27,70 @@ namespace PlayFabCommon
     const FString PlayFabCommonSettings::platformString = UGameplayStatics::GetPlatformName();
 #endif
 
+    FRWLock PlayFabCommonSettings::sessionLock;
     FString PlayFabCommonSettings::clientSessionTicket;
     FString PlayFabCommonSettings::entityToken;
     FString PlayFabCommonSettings::photonRealtimeAppId;
     FString PlayFabCommonSettings::photonTurnbasedAppId;
     FString PlayFabCommonSettings::photonChatAppId;
+
+    FString PlayFabCommonSettings::GetClientSessionTicket()
+    {
+        FReadScopeLock ReadLock(sessionLock);
+        return clientSessionTicket;
+    }
+
+    void PlayFabCommonSettings::SetClientSessionTicket(const FString& InClientSessionTicket)
+    {
+        FWriteScopeLock WriteLock(sessionLock);
+        clientSessionTicket = InClientSessionTicket;
+    }
+
+    FString PlayFabCommonSettings::GetEntityToken()
+    {
+        FReadScopeLock ReadLock(sessionLock);
+        return entityToken;
+    }
+
+    void PlayFabCommonSettings::SetEntityToken(const FString& InEntityToken)
+    {
+        FWriteScopeLock WriteLock(sessionLock);
+        entityToken = InEntityToken;
+    }
+
+    FString PlayFabCommonSettings::GetPhotonRealtimeAppId()
+    {
+        FReadScopeLock ReadLock(sessionLock);
+        return photonRealtimeAppId;
+    }
+
+    void PlayFabCommonSettings::SetPhotonRealtimeAppId(const FString& InPhotonRealtimeAppId)
+    {
+        FWriteScopeLock WriteLock(sessionLock);
+        photonRealtimeAppId = InPhotonRealtimeAppId;
+    }
+
+    FString PlayFabCommonSettings::GetPhotonTurnbasedAppId()
+    {
+        FReadScopeLock ReadLock(sessionLock);
+        return photonTurnbasedAppId;
+    }
+
+    void PlayFabCommonSettings::SetPhotonTurnbasedAppId(const FString& InPhotonTurnbasedAppId)
+    {
+        FWriteScopeLock WriteLock(sessionLock);
+        photonTurnbasedAppId = InPhotonTurnbasedAppId;
+    }
+
+    FString PlayFabCommonSettings::GetPhotonChatAppId()
+    {
+        FReadScopeLock ReadLock(sessionLock);
+        return photonChatAppId;
+    }
+
+    void PlayFabCommonSettings::SetPhotonChatAppId(const FString& InPhotonChatAppId)
+    {
+        FWriteScopeLock WriteLock(sessionLock);
+        photonChatAppId = InPhotonChatAppId;
+    }
 }
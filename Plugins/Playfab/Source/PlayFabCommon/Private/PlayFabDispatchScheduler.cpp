@@ -0,0 +1,484 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabDispatchScheduler.h"
+#include "PlayFabCommon.h"
+#include "PlayFabRuntimeSettings.h"
+#include "PlayFabTrace.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFabCommon;
+
+namespace
+{
+    // PlayFab error codes that mean "slow down"
+    const int32 ThrottlingErrorCodes[] = {
+        1130, // APIRequestLimitExceeded
+        1199, // APIClientRequestRateLimitExceeded
+        1342, // APIConcurrentRequestLimitExceeded
+        1380, // MultiplayerServerTooManyRequests
+        1392, // PerEntityEventRateLimitExceeded
+        1441, // PartyTooManyRequests
+        1452, // QueryRateLimitExceeded
+        1455, // UpdateInventoryRateLimitExceeded
+    };
+
+    // Only the head of the body is scanned, "code" and "errorCode" come before "errorDetails" and "data"
+    const int32 MaxScannedResponseBytes = 512;
+
+    bool FindNumberAfter(const TArray<uint8>& Content, const ANSICHAR* Key, int32& OutNumber)
+    {
+        const int32 KeyLen = FCStringAnsi::Strlen(Key);
+        const int32 Limit = FMath::Min(Content.Num(), MaxScannedResponseBytes) - KeyLen;
+        for (int32 i = 0; i <= Limit; ++i)
+        {
+            if (FMemory::Memcmp(Content.GetData() + i, Key, KeyLen) != 0)
+            {
+                continue;
+            }
+
+            int32 Pos = i + KeyLen;
+            int32 Value = 0;
+            bool bHasDigit = false;
+            while (Pos < Content.Num() && Content[Pos] >= '0' && Content[Pos] <= '9')
+            {
+                Value = Value * 10 + (Content[Pos] - '0');
+                bHasDigit = true;
+                ++Pos;
+            }
+            if (bHasDigit)
+            {
+                OutNumber = Value;
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+int32 FPlayFabDispatchStats::GetTotalQueueDepth() const
+{
+    int32 Total = 0;
+    for (int32 Depth : QueueDepth)
+    {
+        Total += Depth;
+    }
+    return Total;
+}
+
+PlayFabDispatchScheduler& PlayFabDispatchScheduler::Get()
+{
+    static PlayFabDispatchScheduler Instance;
+    return Instance;
+}
+
+bool PlayFabDispatchScheduler::Submit(const TSharedRef<IHttpRequest>& Request, float TimeoutSeconds, uint64 TraceRequestId)
+{
+    const FString UrlPath = GetUrlPath(Request->GetURL());
+    EPlayFabDispatchLane Lane = GetDefaultLane(UrlPath);
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (const EPlayFabDispatchLane* Override = LaneOverrides.Find(UrlPath))
+        {
+            Lane = *Override;
+        }
+    }
+    return Submit(Request, Lane, TimeoutSeconds, TraceRequestId);
+}
+
+bool PlayFabDispatchScheduler::Submit(const TSharedRef<IHttpRequest>& Request, EPlayFabDispatchLane Lane, float TimeoutSeconds, uint64 TraceRequestId)
+{
+    const double Now = FPlatformTime::Seconds();
+    const double Deadline = TimeoutSeconds > 0.0f ? Now + TimeoutSeconds : 0.0;
+    PlayFabTrace::BeginRequest(*Request, GetUrlPath(Request->GetURL()), TraceRequestId);
+
+    if (!IsInGameThread())
+    {
+        // No lock on this path; the game thread moves it into its lane on the next tick
+        Incoming.Enqueue(FIncomingRequest{ Request, Lane, Now, Deadline });
+        EnsureTicker();
+        return true;
+    }
+
+    Enqueue(Request, Lane, Now, Deadline);
+    Pump();
+    return true;
+}
+
+void PlayFabDispatchScheduler::Enqueue(const TSharedRef<IHttpRequest>& Request, EPlayFabDispatchLane Lane, double QueuedAt, double Deadline)
+{
+    const FString Url = Request->GetURL();
+    FQueuedRequest Entry{ Request, GetApiFamily(GetUrlPath(Url)), FGenericPlatformHttp::GetUrlDomain(Url), QueuedAt, Deadline };
+
+    FScopeLock ScopeLock(&Lock);
+    Queues[(int32)Lane].Add(MoveTemp(Entry));
+    Stats.QueueDepth[(int32)Lane] = Queues[(int32)Lane].Num();
+    Stats.PeakQueueDepth = FMath::Max(Stats.PeakQueueDepth, Stats.GetTotalQueueDepth());
+}
+
+void PlayFabDispatchScheduler::DrainIncoming()
+{
+    FIncomingRequest Item;
+    while (Incoming.Dequeue(Item))
+    {
+        Enqueue(Item.Request.ToSharedRef(), Item.Lane, Item.QueuedAt, Item.Deadline);
+    }
+}
+
+bool PlayFabDispatchScheduler::Cancel(const TSharedRef<IHttpRequest>& Request)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        DrainIncoming();
+        for (int32 LaneIdx = 0; LaneIdx < (int32)EPlayFabDispatchLane::Count; ++LaneIdx)
+        {
+            const int32 Removed = Queues[LaneIdx].RemoveAll([&Request](const FQueuedRequest& Entry) { return Entry.Request == Request; });
+            if (Removed > 0)
+            {
+                Stats.QueueDepth[LaneIdx] = Queues[LaneIdx].Num();
+                PlayFabTrace::EndPhase(PlayFabTrace::FindRequestId(&Request.Get()), EPlayFabTracePhase::Queue);
+                PlayFabTrace::EndRequest(&Request.Get());
+                return true;
+            }
+        }
+
+        const bool* bStarted = InFlightRequests.Find(&Request.Get());
+        if (bStarted == nullptr)
+        {
+            return false;
+        }
+        CancelledRequests.Add(&Request.Get());
+        if (!*bStarted)
+        {
+            // Taken out of its lane but ProcessRequest has not returned yet; Dispatch drops or cancels it
+            return true;
+        }
+    }
+
+    // Completes through OnRequestComplete, which swallows the result
+    Request->CancelRequest();
+    return true;
+}
+
+EPlayFabDispatchLane PlayFabDispatchScheduler::GetDefaultLane(const FString& UrlPath)
+{
+    if (UrlPath.Contains(TEXT("/Login")) || UrlPath.Contains(TEXT("/RegisterPlayFabUser"))
+        || UrlPath.Contains(TEXT("/GetEntityToken")) || UrlPath.Contains(TEXT("/AuthenticateGameServerWithCustomId")))
+    {
+        return EPlayFabDispatchLane::Auth;
+    }
+
+    const FString Family = GetApiFamily(UrlPath);
+    if (Family == TEXT("Event") || Family == TEXT("Insights")
+        || (UrlPath.Contains(TEXT("/Write")) && UrlPath.EndsWith(TEXT("Event")))
+        || UrlPath.EndsWith(TEXT("/ReportDeviceInfo")) || UrlPath.EndsWith(TEXT("/ReportAdActivity")))
+    {
+        return EPlayFabDispatchLane::Background;
+    }
+
+    return EPlayFabDispatchLane::Gameplay;
+}
+
+void PlayFabDispatchScheduler::SetLaneOverride(const FString& UrlPath, EPlayFabDispatchLane Lane)
+{
+    FScopeLock ScopeLock(&Lock);
+    LaneOverrides.Add(UrlPath, Lane);
+}
+
+FPlayFabDispatchStats PlayFabDispatchScheduler::GetStats() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return Stats;
+}
+
+int32 PlayFabDispatchScheduler::GetQueueDepth(EPlayFabDispatchLane Lane) const
+{
+    FScopeLock ScopeLock(&Lock);
+    return Queues[(int32)Lane].Num();
+}
+
+FString PlayFabDispatchScheduler::GetUrlPath(const FString& Url)
+{
+    // https://titleId.playfabapi.com/Client/GetTime?sdk=... -> /Client/GetTime
+    int32 Start = Url.Find(TEXT("://"));
+    Start = Start == INDEX_NONE ? 0 : Start + 3;
+    Start = Url.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+    if (Start == INDEX_NONE)
+    {
+        return FString();
+    }
+    int32 End = Url.Find(TEXT("?"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+    return End == INDEX_NONE ? Url.Mid(Start) : Url.Mid(Start, End - Start);
+}
+
+FString PlayFabDispatchScheduler::GetApiFamily(const FString& UrlPath)
+{
+    // /Client/GetTime -> Client
+    FString Family = UrlPath;
+    Family.RemoveFromStart(TEXT("/"));
+    int32 Slash;
+    if (Family.FindChar(TEXT('/'), Slash))
+    {
+        Family.LeftInline(Slash);
+    }
+    return Family;
+}
+
+bool PlayFabDispatchScheduler::TryAcquire(FFamilyState& Family, const FString& Host, double Now)
+{
+    const UPlayFabRuntimeSettings* rSettings = GetDefault<UPlayFabRuntimeSettings>();
+
+    int32& InFlight = InFlightPerHost.FindOrAdd(Host);
+    if (rSettings->MaxConcurrentRequestsPerHost > 0 && InFlight >= rSettings->MaxConcurrentRequestsPerHost)
+    {
+        return false;
+    }
+    if (Now < Family.BackoffUntil)
+    {
+        return false;
+    }
+
+    if (rSettings->DispatchRequestsPerSecond > 0.0f)
+    {
+        const double Burst = FMath::Max(1, rSettings->DispatchBurstSize);
+        if (Family.Tokens < 0.0)
+        {
+            Family.Tokens = Burst;
+        }
+        else
+        {
+            Family.Tokens = FMath::Min(Burst, Family.Tokens + (Now - Family.LastRefill) * rSettings->DispatchRequestsPerSecond);
+        }
+        Family.LastRefill = Now;
+
+        if (Family.Tokens < 1.0)
+        {
+            return false;
+        }
+        Family.Tokens -= 1.0;
+    }
+
+    InFlight += 1;
+    return true;
+}
+
+void PlayFabDispatchScheduler::Pump()
+{
+    TArray<FQueuedRequest> Ready;
+    TArray<FQueuedRequest> Expired;
+    bool bHasWaiting = false;
+    {
+        FScopeLock ScopeLock(&Lock);
+        DrainIncoming();
+        const double Now = FPlatformTime::Seconds();
+        for (int32 LaneIdx = 0; LaneIdx < (int32)EPlayFabDispatchLane::Count; ++LaneIdx)
+        {
+            TArray<FQueuedRequest>& Queue = Queues[LaneIdx];
+            for (int32 i = 0; i < Queue.Num();)
+            {
+                if (Queue[i].Deadline > 0.0 && Now >= Queue[i].Deadline)
+                {
+                    Expired.Add(MoveTemp(Queue[i]));
+                    Queue.RemoveAt(i, 1, EAllowShrinking::No);
+                    continue;
+                }
+
+                FFamilyState& Family = Families.FindOrAdd(Queue[i].Family);
+                if (TryAcquire(Family, Queue[i].Host, Now))
+                {
+                    Ready.Add(MoveTemp(Queue[i]));
+                    Queue.RemoveAt(i, 1, EAllowShrinking::No);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+            Stats.QueueDepth[LaneIdx] = Queue.Num();
+            bHasWaiting |= Queue.Num() > 0;
+        }
+        for (const FQueuedRequest& Entry : Ready)
+        {
+            InFlightRequests.Add(&Entry.Request.Get(), false);
+        }
+        Stats.InFlight += Ready.Num();
+        Stats.Dispatched += Ready.Num();
+    }
+
+    for (FQueuedRequest& Entry : Expired)
+    {
+        Expire(MoveTemp(Entry));
+    }
+    for (FQueuedRequest& Entry : Ready)
+    {
+        Dispatch(MoveTemp(Entry));
+    }
+
+    if (bHasWaiting)
+    {
+        EnsureTicker();
+    }
+}
+
+void PlayFabDispatchScheduler::Dispatch(FQueuedRequest&& Entry)
+{
+    const IHttpRequest* RequestPtr = &Entry.Request.Get();
+    const uint64 TraceId = PlayFabTrace::FindRequestId(RequestPtr);
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (CancelledRequests.Remove(RequestPtr) > 0)
+        {
+            // Cancelled between Pump and here: never sent, so the caller's completion stays unbound and the slot is freed right away
+            InFlightRequests.Remove(RequestPtr);
+            ReleaseSlot(Entry.Host);
+            PlayFabTrace::EndPhase(TraceId, EPlayFabTracePhase::Queue);
+            PlayFabTrace::EndRequest(RequestPtr);
+            return;
+        }
+    }
+
+    // Wrap the caller's completion so the slot is released and throttling is observed before user code runs
+    FHttpRequestCompleteDelegate Original = Entry.Request->OnProcessRequestComplete();
+    Entry.Request->OnProcessRequestComplete().BindRaw(this, &PlayFabDispatchScheduler::OnRequestComplete, Original, Entry.Family, Entry.Host);
+
+    if (Entry.Deadline > 0.0)
+    {
+        // What is left of the deadline after the time spent in the queue
+        Entry.Request->SetTimeout(FMath::Max(0.001f, (float)(Entry.Deadline - FPlatformTime::Seconds())));
+    }
+
+    PlayFabTrace::EndPhase(TraceId, EPlayFabTracePhase::Queue);
+    PlayFabTrace::BeginPhase(TraceId, EPlayFabTracePhase::Http);
+
+    // A request that fails to start still completes through the delegate above, which frees its slot
+    Entry.Request->ProcessRequest();
+
+    // From here on Cancel aborts the request itself; one that came in while it was starting is done now
+    bool bCancelledWhileStarting = false;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (bool* bStarted = InFlightRequests.Find(RequestPtr))
+        {
+            *bStarted = true;
+            bCancelledWhileStarting = CancelledRequests.Contains(RequestPtr);
+        }
+    }
+    if (bCancelledWhileStarting)
+    {
+        Entry.Request->CancelRequest();
+    }
+}
+
+void PlayFabDispatchScheduler::Expire(FQueuedRequest&& Entry)
+{
+    // Never sent, report it the same way as a request the HTTP layer gave up on
+    UE_LOG(LogPlayFabCommon, Verbose, TEXT("PlayFab request %s missed its deadline while queued"), *Entry.Request->GetURL());
+    FHttpRequestCompleteDelegate Original = Entry.Request->OnProcessRequestComplete();
+    PlayFabTrace::EndPhase(PlayFabTrace::FindRequestId(&Entry.Request.Get()), EPlayFabTracePhase::Queue);
+    Original.ExecuteIfBound(Entry.Request, nullptr, false);
+    PlayFabTrace::EndRequest(&Entry.Request.Get());
+}
+
+void PlayFabDispatchScheduler::OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded, FHttpRequestCompleteDelegate Original, FString Family, FString Host)
+{
+    PlayFabTrace::EndPhase(PlayFabTrace::FindRequestId(Request.Get()), EPlayFabTracePhase::Http);
+
+    const bool bThrottled = IsThrottled(Response);
+    bool bCancelled = false;
+    {
+        FScopeLock ScopeLock(&Lock);
+        ReleaseSlot(Host);
+        InFlightRequests.Remove(Request.Get());
+        bCancelled = CancelledRequests.Remove(Request.Get()) > 0;
+
+        FFamilyState& State = Families.FindOrAdd(Family);
+        if (bThrottled)
+        {
+            const UPlayFabRuntimeSettings* rSettings = GetDefault<UPlayFabRuntimeSettings>();
+            State.ThrottleStreak += 1;
+            const float Backoff = FMath::Min(rSettings->MaxThrottleBackoffSeconds,
+                rSettings->ThrottleBackoffSeconds * FMath::Pow(2.0f, (float)FMath::Min(State.ThrottleStreak - 1, 16)));
+            State.BackoffUntil = FPlatformTime::Seconds() + Backoff * FMath::FRandRange(0.8f, 1.2f);
+            Stats.Throttled += 1;
+            UE_LOG(LogPlayFabCommon, Warning, TEXT("PlayFab throttled the %s API, holding it back for %.2f seconds"), *Family, Backoff);
+        }
+        else if (bSucceeded)
+        {
+            State.ThrottleStreak = 0;
+        }
+    }
+
+    if (!bCancelled)
+    {
+        Original.ExecuteIfBound(Request, Response, bSucceeded);
+    }
+    PlayFabTrace::EndRequest(Request.Get());
+    Pump();
+}
+
+void PlayFabDispatchScheduler::ReleaseSlot(const FString& Host)
+{
+    if (int32* InFlight = InFlightPerHost.Find(Host))
+    {
+        *InFlight = FMath::Max(0, *InFlight - 1);
+    }
+    Stats.InFlight = FMath::Max(0, Stats.InFlight - 1);
+}
+
+void PlayFabDispatchScheduler::EnsureTicker()
+{
+    FScopeLock ScopeLock(&Lock);
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &PlayFabDispatchScheduler::Tick), 0.05f);
+    }
+}
+
+bool PlayFabDispatchScheduler::Tick(float DeltaTime)
+{
+    Pump();
+
+    FScopeLock ScopeLock(&Lock);
+    if (Stats.GetTotalQueueDepth() == 0 && Incoming.IsEmpty())
+    {
+        TickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+bool PlayFabDispatchScheduler::IsThrottled(const FHttpResponsePtr& Response)
+{
+    if (!Response.IsValid())
+    {
+        return false;
+    }
+    if (Response->GetResponseCode() == 429)
+    {
+        return true;
+    }
+
+    // The Blueprint layer asks for X-ReportErrorAsSuccess, so the real code only shows up in the body
+    const TArray<uint8>& Content = Response->GetContent();
+    int32 Code = 0;
+    if (FindNumberAfter(Content, "\"code\":", Code) && Code == 429)
+    {
+        return true;
+    }
+    int32 ErrorCode = 0;
+    if (Code != 200 && FindNumberAfter(Content, "\"errorCode\":", ErrorCode))
+    {
+        for (int32 ThrottlingCode : ThrottlingErrorCodes)
+        {
+            if (ErrorCode == ThrottlingCode)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
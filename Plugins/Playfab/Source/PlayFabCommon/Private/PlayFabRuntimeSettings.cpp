@@ -12,5 +12,10 @@ UPlayFabRuntimeSettings::UPlayFabRuntimeSettings()
     : ProductionEnvironmentURL(TEXT(".playfabapi.com"))
     , TitleId()
     , DeveloperSecretKey()
+    , DispatchRequestsPerSecond(10.0f)
+    , DispatchBurstSize(20)
+    , MaxConcurrentRequestsPerHost(8)
+    , ThrottleBackoffSeconds(1.0f)
+    , MaxThrottleBackoffSeconds(30.0f)
 {
 }
@@ -0,0 +1,271 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabTrace.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include <atomic>
+
+using namespace PlayFabCommon;
+
+#if PLAYFAB_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(PlayFabChannel)
+
+UE_TRACE_EVENT_BEGIN(PlayFab, RequestBegin)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint64, RequestId)
+    UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, UrlPath)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(PlayFab, PhaseBegin)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint64, RequestId)
+    UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+    UE_TRACE_EVENT_FIELD(uint8, Phase)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(PlayFab, PhaseEnd)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint64, RequestId)
+    UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+    UE_TRACE_EVENT_FIELD(uint8, Phase)
+UE_TRACE_EVENT_END()
+
+namespace
+{
+    struct FTracedRequest
+    {
+        uint64 RequestId = 0;
+        FString RegionName;
+        bool bDelegateOpen = false;
+        bool bDelegateCpuScope = false;
+    };
+
+    std::atomic<uint64> NextRequestId(1);
+    // Lets completions skip the lock when nothing was ever tracked
+    std::atomic<int32> TrackedCount(0);
+    FCriticalSection TrackedLock;
+    TMap<const IHttpRequest*, FTracedRequest> Tracked;
+
+    bool IsSynchronous(EPlayFabTracePhase Phase)
+    {
+        return Phase != EPlayFabTracePhase::Queue && Phase != EPlayFabTracePhase::Http;
+    }
+
+    bool IsCpuTraceEnabled()
+    {
+#if CPUPROFILERTRACE_ENABLED
+        return UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel);
+#else
+        return false;
+#endif
+    }
+
+    void BeginCpuScope(EPlayFabTracePhase Phase)
+    {
+#if CPUPROFILERTRACE_ENABLED
+        static const uint32 SpecIds[] = {
+            FCpuProfilerTrace::OutputEventType(TEXT("PlayFab::Serialize")),
+            0,
+            0,
+            FCpuProfilerTrace::OutputEventType(TEXT("PlayFab::Decode")),
+            FCpuProfilerTrace::OutputEventType(TEXT("PlayFab::ModelDecode")),
+            FCpuProfilerTrace::OutputEventType(TEXT("PlayFab::Delegate")),
+        };
+        FCpuProfilerTrace::OutputBeginEvent(SpecIds[(int32)Phase]);
+#endif
+    }
+
+    void EndCpuScope()
+    {
+#if CPUPROFILERTRACE_ENABLED
+        FCpuProfilerTrace::OutputEndEvent();
+#endif
+    }
+
+    void LogPhaseBegin(uint64 RequestId, EPlayFabTracePhase Phase)
+    {
+        UE_TRACE_LOG(PlayFab, PhaseBegin, PlayFabChannel)
+            << PhaseBegin.Cycle(FPlatformTime::Cycles64())
+            << PhaseBegin.RequestId(RequestId)
+            << PhaseBegin.ThreadId(FPlatformTLS::GetCurrentThreadId())
+            << PhaseBegin.Phase((uint8)Phase);
+    }
+
+    void LogPhaseEnd(uint64 RequestId, EPlayFabTracePhase Phase)
+    {
+        UE_TRACE_LOG(PlayFab, PhaseEnd, PlayFabChannel)
+            << PhaseEnd.Cycle(FPlatformTime::Cycles64())
+            << PhaseEnd.RequestId(RequestId)
+            << PhaseEnd.ThreadId(FPlatformTLS::GetCurrentThreadId())
+            << PhaseEnd.Phase((uint8)Phase);
+    }
+}
+
+#endif // PLAYFAB_TRACE_ENABLED
+
+bool PlayFabTrace::IsEnabled()
+{
+#if PLAYFAB_TRACE_ENABLED
+    return UE_TRACE_CHANNELEXPR_IS_ENABLED(PlayFabChannel);
+#else
+    return false;
+#endif
+}
+
+uint64 PlayFabTrace::BeginSerialize()
+{
+#if PLAYFAB_TRACE_ENABLED
+    if (!IsEnabled())
+    {
+        return 0;
+    }
+    const uint64 RequestId = NextRequestId++;
+    BeginPhase(RequestId, EPlayFabTracePhase::Serialize);
+    return RequestId;
+#else
+    return 0;
+#endif
+}
+
+void PlayFabTrace::EndSerialize(uint64 RequestId)
+{
+#if PLAYFAB_TRACE_ENABLED
+    if (RequestId != 0)
+    {
+        EndPhase(RequestId, EPlayFabTracePhase::Serialize);
+    }
+#endif
+}
+
+void PlayFabTrace::BeginRequest(const IHttpRequest& Request, const FString& UrlPath, uint64 RequestId)
+{
+#if PLAYFAB_TRACE_ENABLED
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    // Bodies built without toJSONString get their id here
+    FTracedRequest Traced;
+    Traced.RequestId = RequestId != 0 ? RequestId : NextRequestId++;
+    Traced.RegionName = FString::Printf(TEXT("PlayFab #%llu %s"), Traced.RequestId, *UrlPath);
+
+    UE_TRACE_LOG(PlayFab, RequestBegin, PlayFabChannel)
+        << RequestBegin.Cycle(FPlatformTime::Cycles64())
+        << RequestBegin.RequestId(Traced.RequestId)
+        << RequestBegin.ThreadId(FPlatformTLS::GetCurrentThreadId())
+        << RequestBegin.UrlPath(*UrlPath, UrlPath.Len());
+    TRACE_BEGIN_REGION(*Traced.RegionName);
+    BeginPhase(Traced.RequestId, EPlayFabTracePhase::Queue);
+
+    FScopeLock ScopeLock(&TrackedLock);
+    Tracked.Add(&Request, MoveTemp(Traced));
+    TrackedCount = Tracked.Num();
+#endif
+}
+
+void PlayFabTrace::EndRequest(const IHttpRequest* Request)
+{
+#if PLAYFAB_TRACE_ENABLED
+    if (TrackedCount.load() == 0)
+    {
+        return;
+    }
+
+    FTracedRequest Traced;
+    {
+        FScopeLock ScopeLock(&TrackedLock);
+        if (!Tracked.RemoveAndCopyValue(Request, Traced))
+        {
+            return;
+        }
+        TrackedCount = Tracked.Num();
+    }
+
+    if (Traced.bDelegateOpen)
+    {
+        LogPhaseEnd(Traced.RequestId, EPlayFabTracePhase::Delegate);
+    }
+    if (Traced.bDelegateCpuScope)
+    {
+        EndCpuScope();
+    }
+    TRACE_END_REGION(*Traced.RegionName);
+#endif
+}
+
+uint64 PlayFabTrace::FindRequestId(const IHttpRequest* Request)
+{
+#if PLAYFAB_TRACE_ENABLED
+    if (TrackedCount.load() == 0)
+    {
+        return 0;
+    }
+
+    FScopeLock ScopeLock(&TrackedLock);
+    const FTracedRequest* Traced = Tracked.Find(Request);
+    return Traced ? Traced->RequestId : 0;
+#else
+    return 0;
+#endif
+}
+
+void PlayFabTrace::BeginPhase(uint64 RequestId, EPlayFabTracePhase Phase)
+{
+#if PLAYFAB_TRACE_ENABLED
+    if (RequestId == 0)
+    {
+        return;
+    }
+
+    LogPhaseBegin(RequestId, Phase);
+    if (IsSynchronous(Phase) && IsCpuTraceEnabled())
+    {
+        BeginCpuScope(Phase);
+    }
+#endif
+}
+
+void PlayFabTrace::EndPhase(uint64 RequestId, EPlayFabTracePhase Phase)
+{
+#if PLAYFAB_TRACE_ENABLED
+    if (RequestId == 0)
+    {
+        return;
+    }
+
+    LogPhaseEnd(RequestId, Phase);
+    if (IsSynchronous(Phase) && IsCpuTraceEnabled())
+    {
+        EndCpuScope();
+    }
+    if (Phase != EPlayFabTracePhase::Decode)
+    {
+        return;
+    }
+
+    // The API layer runs the delegate right after decoding; it ends when the completion returns to the scheduler
+    FScopeLock ScopeLock(&TrackedLock);
+    for (TPair<const IHttpRequest*, FTracedRequest>& Pair : Tracked)
+    {
+        if (Pair.Value.RequestId == RequestId)
+        {
+            Pair.Value.bDelegateOpen = true;
+            Pair.Value.bDelegateCpuScope = IsCpuTraceEnabled();
+            LogPhaseBegin(RequestId, EPlayFabTracePhase::Delegate);
+            if (Pair.Value.bDelegateCpuScope)
+            {
+                BeginCpuScope(EPlayFabTracePhase::Delegate);
+            }
+            break;
+        }
+    }
+#endif
+}
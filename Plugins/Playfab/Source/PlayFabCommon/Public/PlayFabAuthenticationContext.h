@@ -20,8 +20,8 @@ class PLAYFABCOMMON_API UPlayFabAuthenticationContext : public UObject
 public:
     UPlayFabAuthenticationContext()
     {
-        ClientSessionTicket = PlayFabCommon::PlayFabCommonSettings::clientSessionTicket;
-        EntityToken = PlayFabCommon::PlayFabCommonSettings::entityToken;
+        ClientSessionTicket = PlayFabCommon::PlayFabCommonSettings::GetClientSessionTicket();
+        EntityToken = PlayFabCommon::PlayFabCommonSettings::GetEntityToken();
         DeveloperSecretKey = GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
         ClientAdminSecurityCheck();
     }
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 #include "PlayFabRuntimeSettings.h"
 
 namespace PlayFabCommon
@@ -20,11 +21,17 @@ namespace PlayFabCommon
         static const FString engineVersion;
         static const FString platformString;
 
-        static FString clientSessionTicket; // Secret token that represents your session in the Client API. Set by calling any login method in the Client API
-        static FString entityToken; // Secret token that represents your session in the Entity API. Set by calling GetEntityToken in the Entity API
-        static FString photonRealtimeAppId;
-        static FString photonTurnbasedAppId;
-        static FString photonChatAppId;
+        // The session values below may be read and written from any thread
+        static FString GetClientSessionTicket();
+        static void SetClientSessionTicket(const FString& InClientSessionTicket);
+        static FString GetEntityToken();
+        static void SetEntityToken(const FString& InEntityToken);
+        static FString GetPhotonRealtimeAppId();
+        static void SetPhotonRealtimeAppId(const FString& InPhotonRealtimeAppId);
+        static FString GetPhotonTurnbasedAppId();
+        static void SetPhotonTurnbasedAppId(const FString& InPhotonTurnbasedAppId);
+        static FString GetPhotonChatAppId();
+        static void SetPhotonChatAppId(const FString& InPhotonChatAppId);
 
         static FString GeneratePfUrl(const FString& urlPath)
         {
@@ -40,5 +47,13 @@ namespace PlayFabCommon
                     + urlPath + TEXT("?sdk=") + versionString + TEXT("&engine=") + engineVersion + TEXT("&platform=") + platformString;
             }
         }
+
+    private:
+        static FRWLock sessionLock;
+        static FString clientSessionTicket; // Secret token that represents your session in the Client API. Set by calling any login method in the Client API
+        static FString entityToken; // Secret token that represents your session in the Entity API. Set by calling GetEntityToken in the Entity API
+        static FString photonRealtimeAppId;
+        static FString photonTurnbasedAppId;
+        static FString photonChatAppId;
     };
 }
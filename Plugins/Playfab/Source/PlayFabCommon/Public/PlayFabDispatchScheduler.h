@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+
+namespace PlayFabCommon
+{
+    // Priority lanes, highest priority first
+    enum class EPlayFabDispatchLane : uint8
+    {
+        Auth,
+        Gameplay,
+        Background,
+
+        Count
+    };
+
+    // Snapshot of the scheduler state, for debug HUDs and telemetry
+    struct PLAYFABCOMMON_API FPlayFabDispatchStats
+    {
+        int32 QueueDepth[(int32)EPlayFabDispatchLane::Count] = {};
+        int32 PeakQueueDepth = 0;
+        int32 InFlight = 0;
+        uint64 Dispatched = 0;
+        uint64 Throttled = 0;
+
+        int32 GetTotalQueueDepth() const;
+    };
+
+    /**
+    * Sits between the API layers and IHttpRequest::ProcessRequest.
+    * Requests are released by lane priority, limited by a token bucket per API family (the first path segment,
+    * e.g. "Client" for /Client/GetTime) and by a maximum number of concurrent requests per host.
+    * A family that answers with a throttling error is held back with exponential backoff.
+    *
+    * Threading: Submit and Cancel may be called from any thread. Requests submitted off the game thread go through a
+    * lock-free MPSC queue and are picked up on the next game thread tick; sending, completion and deadline expiry always
+    * happen on the game thread, so the completion delegates (and the API success/error delegates behind them) run there.
+    */
+    class PLAYFABCOMMON_API PlayFabDispatchScheduler
+    {
+    public:
+        static PlayFabDispatchScheduler& Get();
+
+        // Queues the request, or (on the game thread) sends it right away when nothing holds it back. The completion delegate must be bound already.
+        // A positive TimeoutSeconds is a deadline counted from now, queue time included; past it the request completes as failed.
+        // TraceRequestId is the PlayFabTrace id of the serialized body, 0 when there is none.
+        bool Submit(const TSharedRef<IHttpRequest>& Request, float TimeoutSeconds = 0.0f, uint64 TraceRequestId = 0);
+        bool Submit(const TSharedRef<IHttpRequest>& Request, EPlayFabDispatchLane Lane, float TimeoutSeconds = 0.0f, uint64 TraceRequestId = 0);
+
+        // Drops a queued request or aborts one in flight. The completion delegate bound before Submit is never called afterwards.
+        // Returns false when the scheduler does not know the request (not submitted, or already completed).
+        bool Cancel(const TSharedRef<IHttpRequest>& Request);
+
+        // Lane used when Submit is called without one: logins go to Auth, Events/Insights to Background, the rest to Gameplay
+        static EPlayFabDispatchLane GetDefaultLane(const FString& UrlPath);
+        // Forces a lane for one API path, e.g. "/Client/WriteTitleEvent"
+        void SetLaneOverride(const FString& UrlPath, EPlayFabDispatchLane Lane);
+
+        FPlayFabDispatchStats GetStats() const;
+        int32 GetQueueDepth(EPlayFabDispatchLane Lane) const;
+
+        static FString GetUrlPath(const FString& Url);
+        static FString GetApiFamily(const FString& UrlPath);
+
+    private:
+        struct FQueuedRequest
+        {
+            TSharedRef<IHttpRequest> Request;
+            FString Family;
+            FString Host;
+            double QueuedAt;
+            double Deadline; // 0 when the call has no deadline
+        };
+
+        // Handed over from other threads; TQueue needs default-constructible items
+        struct FIncomingRequest
+        {
+            TSharedPtr<IHttpRequest> Request;
+            EPlayFabDispatchLane Lane = EPlayFabDispatchLane::Gameplay;
+            double QueuedAt = 0.0;
+            double Deadline = 0.0;
+        };
+
+        struct FFamilyState
+        {
+            double Tokens = -1.0; // Negative until the first refill
+            double LastRefill = 0.0;
+            double BackoffUntil = 0.0;
+            int32 ThrottleStreak = 0;
+        };
+
+        PlayFabDispatchScheduler() {}
+
+        void Enqueue(const TSharedRef<IHttpRequest>& Request, EPlayFabDispatchLane Lane, double QueuedAt, double Deadline);
+        void DrainIncoming();
+        bool TryAcquire(FFamilyState& Family, const FString& Host, double Now);
+        void Pump();
+        void Dispatch(FQueuedRequest&& Entry);
+        void Expire(FQueuedRequest&& Entry);
+        void OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded, FHttpRequestCompleteDelegate Original, FString Family, FString Host);
+        void ReleaseSlot(const FString& Host);
+        void EnsureTicker();
+        bool Tick(float DeltaTime);
+
+        static bool IsThrottled(const FHttpResponsePtr& Response);
+
+        mutable FCriticalSection Lock;
+        TArray<FQueuedRequest> Queues[(int32)EPlayFabDispatchLane::Count];
+        TQueue<FIncomingRequest, EQueueMode::Mpsc> Incoming; // Only dequeued with Lock held, which keeps a single consumer
+        TMap<FString, FFamilyState> Families;
+        TMap<FString, int32> InFlightPerHost;
+        TMap<const IHttpRequest*, bool> InFlightRequests; // True once ProcessRequest has returned, before that Cancel only flags the request
+        TSet<const IHttpRequest*> CancelledRequests;
+        TMap<FString, EPlayFabDispatchLane> LaneOverrides;
+        FPlayFabDispatchStats Stats;
+        FTSTicker::FDelegateHandle TickerHandle;
+    };
+}
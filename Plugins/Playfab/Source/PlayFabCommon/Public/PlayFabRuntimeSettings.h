@@ -30,4 +30,24 @@ public:
     // Secret Key, Do not add this to the clients!
     UPROPERTY(EditAnywhere, config, Category = Settings)
     FString DeveloperSecretKey;
+
+    // Requests per second allowed for each API family (Client, Server, Event, ...). 0 disables the limit
+    UPROPERTY(EditAnywhere, config, Category = Dispatch, meta = (ClampMin = "0"))
+    float DispatchRequestsPerSecond;
+
+    // Number of requests an idle API family may send back to back before the rate limit applies
+    UPROPERTY(EditAnywhere, config, Category = Dispatch, meta = (ClampMin = "1"))
+    int32 DispatchBurstSize;
+
+    // Maximum number of requests in flight to a single host. 0 disables the limit
+    UPROPERTY(EditAnywhere, config, Category = Dispatch, meta = (ClampMin = "0"))
+    int32 MaxConcurrentRequestsPerHost;
+
+    // First backoff applied to an API family after a throttling error, doubled on every consecutive one
+    UPROPERTY(EditAnywhere, config, Category = Dispatch, meta = (ClampMin = "0"))
+    float ThrottleBackoffSeconds;
+
+    // Upper bound of the throttling backoff
+    UPROPERTY(EditAnywhere, config, Category = Dispatch, meta = (ClampMin = "0"))
+    float MaxThrottleBackoffSeconds;
 };
@@ -0,0 +1,91 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Trace/Trace.h"
+
+#ifndef PLAYFAB_TRACE_ENABLED
+#define PLAYFAB_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+#if PLAYFAB_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(PlayFabChannel, PLAYFABCOMMON_API)
+#endif
+
+namespace PlayFabCommon
+{
+    // Stages of one PlayFab call, in the order they happen
+    enum class EPlayFabTracePhase : uint8
+    {
+        Serialize,   // Request model to JSON (toJSONString), on the calling thread
+        Queue,       // Submitted to PlayFabDispatchScheduler, waiting for a slot
+        Http,        // Sent, until the HTTP module completes it
+        Decode,      // PlayFabRequestHandler::DecodeRequest
+        ModelDecode, // The result model reading the parsed JSON, inside Decode
+        Delegate,    // The success or error delegate, right after Decode
+    };
+
+    /**
+    * Unreal Insights events for PlayFab calls, on the "PlayFab" trace channel (-trace=default,playfab).
+    *
+    * Every call gets a request id when its body is serialized. The request model keeps the id and hands it to Submit with the HTTP request,
+    * so the begin and end events of every phase of a call carry the same id, whichever thread emits them.
+    * The whole call shows as a timing region named "PlayFab #<id> <path>" from submit to the end of its delegate; the synchronous
+    * phases (Serialize, Decode, ModelDecode, Delegate) also show as CPU scopes on the thread that ran them. The raw PlayFab.PhaseBegin /
+    * PlayFab.PhaseEnd events carry id, phase, thread and cycle count for custom analysis.
+    *
+    * Everything here is a no-op while the channel is off, and compiled out in shipping builds.
+    */
+    class PLAYFABCOMMON_API PlayFabTrace
+    {
+    public:
+        static bool IsEnabled();
+
+        // Around toJSONString. Returns 0 when not tracing. The caller passes the id on to Submit with the request built from the body.
+        static uint64 BeginSerialize();
+        static void EndSerialize(uint64 RequestId);
+
+        // Called by PlayFabDispatchScheduler: Submit starts tracking the request, its completion ends it.
+        // RequestId is the id of the serialized body, 0 gives the request a new one.
+        static void BeginRequest(const IHttpRequest& Request, const FString& UrlPath, uint64 RequestId = 0);
+        static void EndRequest(const IHttpRequest* Request);
+        // 0 when the request is not tracked
+        static uint64 FindRequestId(const IHttpRequest* Request);
+
+        // Ending Decode begins Delegate, which EndRequest ends once the completion delegate returns
+        static void BeginPhase(uint64 RequestId, EPlayFabTracePhase Phase);
+        static void EndPhase(uint64 RequestId, EPlayFabTracePhase Phase);
+    };
+
+    // Begin/EndPhase for the lifetime of the scope; does nothing for request id 0
+    class FPlayFabTraceScope
+    {
+    public:
+        FPlayFabTraceScope(uint64 InRequestId, EPlayFabTracePhase InPhase)
+            : RequestId(InRequestId)
+            , Phase(InPhase)
+        {
+            if (RequestId != 0)
+            {
+                PlayFabTrace::BeginPhase(RequestId, Phase);
+            }
+        }
+
+        ~FPlayFabTraceScope()
+        {
+            if (RequestId != 0)
+            {
+                PlayFabTrace::EndPhase(RequestId, Phase);
+            }
+        }
+
+    private:
+        uint64 RequestId;
+        EPlayFabTracePhase Phase;
+    };
+}
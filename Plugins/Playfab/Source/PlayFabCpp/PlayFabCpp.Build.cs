@@ -3,6 +3,7 @@
 //////////////////////////////////////////////////////
 
 using UnrealBuildTool;
+using System;
 using System.IO; 
 
 public class PlayFabCpp : ModuleRules
@@ -27,5 +28,44 @@ public class PlayFabCpp : ModuleRules
             "JsonUtilities",
             "PlayFabCommon"
         });
+
+        // One WITH_PLAYFAB_<FAMILY>_API switch per API family. Shipping game/client builds only compile the
+        // families a game client calls; everything else (Admin, Server, Multiplayer, ...) is left out of the binary.
+        // Families that are switched off keep their headers, and their IPlayFabModuleInterface getters return nullptr.
+        bool bClientOnly = Target.Configuration == UnrealTargetConfiguration.Shipping
+            && (Target.Type == TargetType.Game || Target.Type == TargetType.Client);
+        foreach (string ApiFamily in ApiFamilies)
+        {
+            bool bEnabled = !bClientOnly || Array.IndexOf(ClientApiFamilies, ApiFamily) >= 0;
+            PublicDefinitions.Add(string.Format("WITH_PLAYFAB_{0}_API={1}", ApiFamily.ToUpperInvariant(), bEnabled ? 1 : 0));
+        }
     }
+
+    static readonly string[] ApiFamilies = {
+        "Admin",
+        "Client",
+        "Server",
+        "Authentication",
+        "CloudScript",
+        "Data",
+        "Economy",
+        "Events",
+        "Experimentation",
+        "Insights",
+        "Groups",
+        "Progression",
+        "Localization",
+        "Multiplayer",
+        "Profiles",
+        "Addon"
+    };
+
+    // Families compiled into shipping game clients. CloudScript is needed by ExecuteFunction and PlayFabCloudScriptBatcher.
+    static readonly string[] ClientApiFamilies = {
+        "Client",
+        "CloudScript",
+        "Events",
+        "Progression",
+        "Economy"
+    };
 }
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_ADDON_API
 #include "Core/PlayFabAddonAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabAddonAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabAddonAPI::CreateOrUpdateApple(
+FPlayFabRequestHandle UPlayFabAddonAPI::CreateOrUpdateApple(
     AddonModels::FCreateOrUpdateAppleRequest& request,
     const FCreateOrUpdateAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabAddonAPI::CreateOrUpdateApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/CreateOrUpdateApple"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnCreateOrUpdateAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnCreateOrUpdateAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabAddonAPI::OnCreateOrUpdateAppleResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonAPI::CreateOrUpdateFacebook(
+FPlayFabRequestHandle UPlayFabAddonAPI::CreateOrUpdateFacebook(
     AddonModels::FCreateOrUpdateFacebookRequest& request,
     const FCreateOrUpdateFacebookDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabAddonAPI::CreateOrUpdateFacebook(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/CreateOrUpdateFacebook"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnCreateOrUpdateFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnCreateOrUpdateFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabAddonAPI::OnCreateOrUpdateFacebookResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAddonAPI::CreateOrUpdateFacebookInstantGames(
+FPlayFabRequestHandle UPlayFabAddonAPI::CreateOrUpdateFacebookInstantGames(
     AddonModels::FCreateOrUpdateFacebookInstantGamesRequest& request,
     const FCreateOrUpdateFacebookInstantGamesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabAddonAPI::CreateOrUpdateFacebookInstantGames(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/CreateOrUpdateFacebookInstantGames"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnCreateOrUpdateFacebookInstantGamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnCreateOrUpdateFacebookInstantGamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateFacebookInstantGamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabAddonAPI::OnCreateOrUpdateFacebookInstantGamesResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabAddonAPI::CreateOrUpdateGoogle(
+FPlayFabRequestHandle UPlayFabAddonAPI::CreateOrUpdateGoogle(
     AddonModels::FCreateOrUpdateGoogleRequest& request,
     const FCreateOrUpdateGoogleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabAddonAPI::CreateOrUpdateGoogle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/CreateOrUpdateGoogle"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnCreateOrUpdateGoogleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnCreateOrUpdateGoogleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateGoogleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabAddonAPI::OnCreateOrUpdateGoogleResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonAPI::CreateOrUpdateKongregate(
+FPlayFabRequestHandle UPlayFabAddonAPI::CreateOrUpdateKongregate(
     AddonModels::FCreateOrUpdateKongregateRequest& request,
     const FCreateOrUpdateKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabAddonAPI::CreateOrUpdateKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/CreateOrUpdateKongregate"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnCreateOrUpdateKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnCreateOrUpdateKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabAddonAPI::OnCreateOrUpdateKongregateResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAddonAPI::CreateOrUpdateNintendo(
+FPlayFabRequestHandle UPlayFabAddonAPI::CreateOrUpdateNintendo(
     AddonModels::FCreateOrUpdateNintendoRequest& request,
     const FCreateOrUpdateNintendoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabAddonAPI::CreateOrUpdateNintendo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/CreateOrUpdateNintendo"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnCreateOrUpdateNintendoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnCreateOrUpdateNintendoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateNintendoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabAddonAPI::OnCreateOrUpdateNintendoResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAddonAPI::CreateOrUpdatePSN(
+FPlayFabRequestHandle UPlayFabAddonAPI::CreateOrUpdatePSN(
     AddonModels::FCreateOrUpdatePSNRequest& request,
     const FCreateOrUpdatePSNDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,7 +221,7 @@ bool UPlayFabAddonAPI::CreateOrUpdatePSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/CreateOrUpdatePSN"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnCreateOrUpdatePSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnCreateOrUpdatePSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdatePSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -237,7 +238,7 @@ void UPlayFabAddonAPI::OnCreateOrUpdatePSNResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabAddonAPI::CreateOrUpdateSteam(
+FPlayFabRequestHandle UPlayFabAddonAPI::CreateOrUpdateSteam(
     AddonModels::FCreateOrUpdateSteamRequest& request,
     const FCreateOrUpdateSteamDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -250,7 +251,7 @@ bool UPlayFabAddonAPI::CreateOrUpdateSteam(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/CreateOrUpdateSteam"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnCreateOrUpdateSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnCreateOrUpdateSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -267,7 +268,7 @@ void UPlayFabAddonAPI::OnCreateOrUpdateSteamResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonAPI::CreateOrUpdateTwitch(
+FPlayFabRequestHandle UPlayFabAddonAPI::CreateOrUpdateTwitch(
     AddonModels::FCreateOrUpdateTwitchRequest& request,
     const FCreateOrUpdateTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -280,7 +281,7 @@ bool UPlayFabAddonAPI::CreateOrUpdateTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/CreateOrUpdateTwitch"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnCreateOrUpdateTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnCreateOrUpdateTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -297,7 +298,7 @@ void UPlayFabAddonAPI::OnCreateOrUpdateTwitchResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonAPI::DeleteApple(
+FPlayFabRequestHandle UPlayFabAddonAPI::DeleteApple(
     AddonModels::FDeleteAppleRequest& request,
     const FDeleteAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -310,7 +311,7 @@ bool UPlayFabAddonAPI::DeleteApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/DeleteApple"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnDeleteAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnDeleteAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -327,7 +328,7 @@ void UPlayFabAddonAPI::OnDeleteAppleResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabAddonAPI::DeleteFacebook(
+FPlayFabRequestHandle UPlayFabAddonAPI::DeleteFacebook(
     AddonModels::FDeleteFacebookRequest& request,
     const FDeleteFacebookDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -340,7 +341,7 @@ bool UPlayFabAddonAPI::DeleteFacebook(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/DeleteFacebook"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnDeleteFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnDeleteFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -357,7 +358,7 @@ void UPlayFabAddonAPI::OnDeleteFacebookResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabAddonAPI::DeleteFacebookInstantGames(
+FPlayFabRequestHandle UPlayFabAddonAPI::DeleteFacebookInstantGames(
     AddonModels::FDeleteFacebookInstantGamesRequest& request,
     const FDeleteFacebookInstantGamesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -370,7 +371,7 @@ bool UPlayFabAddonAPI::DeleteFacebookInstantGames(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/DeleteFacebookInstantGames"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnDeleteFacebookInstantGamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnDeleteFacebookInstantGamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteFacebookInstantGamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -387,7 +388,7 @@ void UPlayFabAddonAPI::OnDeleteFacebookInstantGamesResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabAddonAPI::DeleteGoogle(
+FPlayFabRequestHandle UPlayFabAddonAPI::DeleteGoogle(
     AddonModels::FDeleteGoogleRequest& request,
     const FDeleteGoogleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -400,7 +401,7 @@ bool UPlayFabAddonAPI::DeleteGoogle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/DeleteGoogle"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnDeleteGoogleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnDeleteGoogleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteGoogleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -417,7 +418,7 @@ void UPlayFabAddonAPI::OnDeleteGoogleResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabAddonAPI::DeleteKongregate(
+FPlayFabRequestHandle UPlayFabAddonAPI::DeleteKongregate(
     AddonModels::FDeleteKongregateRequest& request,
     const FDeleteKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -430,7 +431,7 @@ bool UPlayFabAddonAPI::DeleteKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/DeleteKongregate"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnDeleteKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnDeleteKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -447,7 +448,7 @@ void UPlayFabAddonAPI::OnDeleteKongregateResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAddonAPI::DeleteNintendo(
+FPlayFabRequestHandle UPlayFabAddonAPI::DeleteNintendo(
     AddonModels::FDeleteNintendoRequest& request,
     const FDeleteNintendoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -460,7 +461,7 @@ bool UPlayFabAddonAPI::DeleteNintendo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/DeleteNintendo"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnDeleteNintendoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnDeleteNintendoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteNintendoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -477,7 +478,7 @@ void UPlayFabAddonAPI::OnDeleteNintendoResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabAddonAPI::DeletePSN(
+FPlayFabRequestHandle UPlayFabAddonAPI::DeletePSN(
     AddonModels::FDeletePSNRequest& request,
     const FDeletePSNDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -490,7 +491,7 @@ bool UPlayFabAddonAPI::DeletePSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/DeletePSN"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnDeletePSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnDeletePSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -507,7 +508,7 @@ void UPlayFabAddonAPI::OnDeletePSNResult(FHttpRequestPtr HttpRequest, FHttpRespo
     }
 }
 
-bool UPlayFabAddonAPI::DeleteSteam(
+FPlayFabRequestHandle UPlayFabAddonAPI::DeleteSteam(
     AddonModels::FDeleteSteamRequest& request,
     const FDeleteSteamDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -520,7 +521,7 @@ bool UPlayFabAddonAPI::DeleteSteam(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/DeleteSteam"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnDeleteSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnDeleteSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -537,7 +538,7 @@ void UPlayFabAddonAPI::OnDeleteSteamResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabAddonAPI::DeleteTwitch(
+FPlayFabRequestHandle UPlayFabAddonAPI::DeleteTwitch(
     AddonModels::FDeleteTwitchRequest& request,
     const FDeleteTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -550,7 +551,7 @@ bool UPlayFabAddonAPI::DeleteTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/DeleteTwitch"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnDeleteTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnDeleteTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -567,7 +568,7 @@ void UPlayFabAddonAPI::OnDeleteTwitchResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabAddonAPI::GetApple(
+FPlayFabRequestHandle UPlayFabAddonAPI::GetApple(
     AddonModels::FGetAppleRequest& request,
     const FGetAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -580,7 +581,7 @@ bool UPlayFabAddonAPI::GetApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/GetApple"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnGetAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnGetAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -597,7 +598,7 @@ void UPlayFabAddonAPI::OnGetAppleResult(FHttpRequestPtr HttpRequest, FHttpRespon
     }
 }
 
-bool UPlayFabAddonAPI::GetFacebook(
+FPlayFabRequestHandle UPlayFabAddonAPI::GetFacebook(
     AddonModels::FGetFacebookRequest& request,
     const FGetFacebookDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -610,7 +611,7 @@ bool UPlayFabAddonAPI::GetFacebook(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/GetFacebook"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnGetFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnGetFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -627,7 +628,7 @@ void UPlayFabAddonAPI::OnGetFacebookResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabAddonAPI::GetFacebookInstantGames(
+FPlayFabRequestHandle UPlayFabAddonAPI::GetFacebookInstantGames(
     AddonModels::FGetFacebookInstantGamesRequest& request,
     const FGetFacebookInstantGamesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -640,7 +641,7 @@ bool UPlayFabAddonAPI::GetFacebookInstantGames(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/GetFacebookInstantGames"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnGetFacebookInstantGamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnGetFacebookInstantGamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFacebookInstantGamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -657,7 +658,7 @@ void UPlayFabAddonAPI::OnGetFacebookInstantGamesResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAddonAPI::GetGoogle(
+FPlayFabRequestHandle UPlayFabAddonAPI::GetGoogle(
     AddonModels::FGetGoogleRequest& request,
     const FGetGoogleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -670,7 +671,7 @@ bool UPlayFabAddonAPI::GetGoogle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/GetGoogle"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnGetGoogleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnGetGoogleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGoogleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -687,7 +688,7 @@ void UPlayFabAddonAPI::OnGetGoogleResult(FHttpRequestPtr HttpRequest, FHttpRespo
     }
 }
 
-bool UPlayFabAddonAPI::GetKongregate(
+FPlayFabRequestHandle UPlayFabAddonAPI::GetKongregate(
     AddonModels::FGetKongregateRequest& request,
     const FGetKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -700,7 +701,7 @@ bool UPlayFabAddonAPI::GetKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/GetKongregate"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnGetKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnGetKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -717,7 +718,7 @@ void UPlayFabAddonAPI::OnGetKongregateResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAddonAPI::GetNintendo(
+FPlayFabRequestHandle UPlayFabAddonAPI::GetNintendo(
     AddonModels::FGetNintendoRequest& request,
     const FGetNintendoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -730,7 +731,7 @@ bool UPlayFabAddonAPI::GetNintendo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/GetNintendo"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnGetNintendoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnGetNintendoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetNintendoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -747,7 +748,7 @@ void UPlayFabAddonAPI::OnGetNintendoResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabAddonAPI::GetPSN(
+FPlayFabRequestHandle UPlayFabAddonAPI::GetPSN(
     AddonModels::FGetPSNRequest& request,
     const FGetPSNDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -760,7 +761,7 @@ bool UPlayFabAddonAPI::GetPSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/GetPSN"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnGetPSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnGetPSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -777,7 +778,7 @@ void UPlayFabAddonAPI::OnGetPSNResult(FHttpRequestPtr HttpRequest, FHttpResponse
     }
 }
 
-bool UPlayFabAddonAPI::GetSteam(
+FPlayFabRequestHandle UPlayFabAddonAPI::GetSteam(
     AddonModels::FGetSteamRequest& request,
     const FGetSteamDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -790,7 +791,7 @@ bool UPlayFabAddonAPI::GetSteam(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/GetSteam"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnGetSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnGetSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -807,7 +808,7 @@ void UPlayFabAddonAPI::OnGetSteamResult(FHttpRequestPtr HttpRequest, FHttpRespon
     }
 }
 
-bool UPlayFabAddonAPI::GetTwitch(
+FPlayFabRequestHandle UPlayFabAddonAPI::GetTwitch(
     AddonModels::FGetTwitchRequest& request,
     const FGetTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -820,7 +821,7 @@ bool UPlayFabAddonAPI::GetTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Addon/GetTwitch"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonAPI::OnGetTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonAPI::OnGetTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -836,3 +837,5 @@ void UPlayFabAddonAPI::OnGetTwitchResult(FHttpRequestPtr HttpRequest, FHttpRespo
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_ADDON_API
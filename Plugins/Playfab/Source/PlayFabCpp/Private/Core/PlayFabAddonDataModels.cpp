@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_ADDON_API
 
 #include "Core/PlayFabAddonDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -27,7 +28,7 @@ void PlayFab::AddonModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -145,6 +146,7 @@ bool PlayFab::AddonModels::FCreateOrUpdateAppleRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -277,6 +279,7 @@ bool PlayFab::AddonModels::FCreateOrUpdateFacebookInstantGamesRequest::readFromV
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -405,6 +408,7 @@ bool PlayFab::AddonModels::FCreateOrUpdateFacebookRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -546,6 +550,7 @@ bool PlayFab::AddonModels::FCreateOrUpdateGoogleRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -668,6 +673,7 @@ bool PlayFab::AddonModels::FCreateOrUpdateKongregateRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -839,6 +845,7 @@ bool PlayFab::AddonModels::FCreateOrUpdateNintendoRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -852,11 +859,7 @@ bool PlayFab::AddonModels::FCreateOrUpdateNintendoRequest::readFromValue(const T
     }
 
     const TArray<TSharedPtr<FJsonValue>>&EnvironmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Environments"));
-    for (int32 Idx = 0; Idx < EnvironmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = EnvironmentsArray[Idx];
-        Environments.Add(FNintendoEnvironment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(EnvironmentsArray, Environments);
 
 
     const TSharedPtr<FJsonValue> ErrorIfExistsValue = obj->TryGetField(TEXT("ErrorIfExists"));
@@ -969,6 +972,7 @@ bool PlayFab::AddonModels::FCreateOrUpdatePSNRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1106,6 +1110,7 @@ bool PlayFab::AddonModels::FCreateOrUpdateSteamRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1237,6 +1242,7 @@ bool PlayFab::AddonModels::FCreateOrUpdateTwitchRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1315,6 +1321,7 @@ bool PlayFab::AddonModels::FDeleteAppleRequest::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1386,6 +1393,7 @@ bool PlayFab::AddonModels::FDeleteFacebookInstantGamesRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1457,6 +1465,7 @@ bool PlayFab::AddonModels::FDeleteFacebookRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1528,6 +1537,7 @@ bool PlayFab::AddonModels::FDeleteGoogleRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1599,6 +1609,7 @@ bool PlayFab::AddonModels::FDeleteKongregateRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1670,6 +1681,7 @@ bool PlayFab::AddonModels::FDeleteNintendoRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1741,6 +1753,7 @@ bool PlayFab::AddonModels::FDeletePSNRequest::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1812,6 +1825,7 @@ bool PlayFab::AddonModels::FDeleteSteamRequest::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1883,6 +1897,7 @@ bool PlayFab::AddonModels::FDeleteTwitchRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1954,6 +1969,7 @@ bool PlayFab::AddonModels::FGetAppleRequest::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2074,6 +2090,7 @@ bool PlayFab::AddonModels::FGetFacebookInstantGamesRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2168,6 +2185,7 @@ bool PlayFab::AddonModels::FGetFacebookRequest::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2275,6 +2293,7 @@ bool PlayFab::AddonModels::FGetGoogleRequest::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2395,6 +2414,7 @@ bool PlayFab::AddonModels::FGetKongregateRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2476,6 +2496,7 @@ bool PlayFab::AddonModels::FGetNintendoRequest::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2540,11 +2561,7 @@ bool PlayFab::AddonModels::FGetNintendoResponse::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&EnvironmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Environments"));
-    for (int32 Idx = 0; Idx < EnvironmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = EnvironmentsArray[Idx];
-        Environments.Add(FNintendoEnvironment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(EnvironmentsArray, Environments);
 
 
     return HasSucceeded;
@@ -2587,6 +2604,7 @@ bool PlayFab::AddonModels::FGetPSNRequest::readFromValue(const TSharedPtr<FJsonO
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2694,6 +2712,7 @@ bool PlayFab::AddonModels::FGetSteamRequest::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2814,6 +2833,7 @@ bool PlayFab::AddonModels::FGetTwitchRequest::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2871,3 +2891,5 @@ bool PlayFab::AddonModels::FGetTwitchResponse::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_ADDON_API
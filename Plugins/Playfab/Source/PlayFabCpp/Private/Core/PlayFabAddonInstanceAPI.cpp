@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_ADDON_API
 #include "Core/PlayFabAddonInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabAddonInstanceAPI::GetOrCreateA
     return this->authContext;
 }
 
-bool UPlayFabAddonInstanceAPI::CreateOrUpdateApple(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::CreateOrUpdateApple(
     AddonModels::FCreateOrUpdateAppleRequest& request,
     const FCreateOrUpdateAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabAddonInstanceAPI::CreateOrUpdateApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/CreateOrUpdateApple"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnCreateOrUpdateAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnCreateOrUpdateAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabAddonInstanceAPI::OnCreateOrUpdateAppleResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAddonInstanceAPI::CreateOrUpdateFacebook(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::CreateOrUpdateFacebook(
     AddonModels::FCreateOrUpdateFacebookRequest& request,
     const FCreateOrUpdateFacebookDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabAddonInstanceAPI::CreateOrUpdateFacebook(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/CreateOrUpdateFacebook"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnCreateOrUpdateFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnCreateOrUpdateFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabAddonInstanceAPI::OnCreateOrUpdateFacebookResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAddonInstanceAPI::CreateOrUpdateFacebookInstantGames(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::CreateOrUpdateFacebookInstantGames(
     AddonModels::FCreateOrUpdateFacebookInstantGamesRequest& request,
     const FCreateOrUpdateFacebookInstantGamesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabAddonInstanceAPI::CreateOrUpdateFacebookInstantGames(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/CreateOrUpdateFacebookInstantGames"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnCreateOrUpdateFacebookInstantGamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnCreateOrUpdateFacebookInstantGamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateFacebookInstantGamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabAddonInstanceAPI::OnCreateOrUpdateFacebookInstantGamesResult(FHttpR
     }
 }
 
-bool UPlayFabAddonInstanceAPI::CreateOrUpdateGoogle(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::CreateOrUpdateGoogle(
     AddonModels::FCreateOrUpdateGoogleRequest& request,
     const FCreateOrUpdateGoogleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabAddonInstanceAPI::CreateOrUpdateGoogle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/CreateOrUpdateGoogle"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnCreateOrUpdateGoogleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnCreateOrUpdateGoogleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateGoogleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabAddonInstanceAPI::OnCreateOrUpdateGoogleResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAddonInstanceAPI::CreateOrUpdateKongregate(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::CreateOrUpdateKongregate(
     AddonModels::FCreateOrUpdateKongregateRequest& request,
     const FCreateOrUpdateKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabAddonInstanceAPI::CreateOrUpdateKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/CreateOrUpdateKongregate"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnCreateOrUpdateKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnCreateOrUpdateKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabAddonInstanceAPI::OnCreateOrUpdateKongregateResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAddonInstanceAPI::CreateOrUpdateNintendo(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::CreateOrUpdateNintendo(
     AddonModels::FCreateOrUpdateNintendoRequest& request,
     const FCreateOrUpdateNintendoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabAddonInstanceAPI::CreateOrUpdateNintendo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/CreateOrUpdateNintendo"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnCreateOrUpdateNintendoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnCreateOrUpdateNintendoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateNintendoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabAddonInstanceAPI::OnCreateOrUpdateNintendoResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAddonInstanceAPI::CreateOrUpdatePSN(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::CreateOrUpdatePSN(
     AddonModels::FCreateOrUpdatePSNRequest& request,
     const FCreateOrUpdatePSNDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabAddonInstanceAPI::CreateOrUpdatePSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/CreateOrUpdatePSN"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnCreateOrUpdatePSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnCreateOrUpdatePSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdatePSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabAddonInstanceAPI::OnCreateOrUpdatePSNResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabAddonInstanceAPI::CreateOrUpdateSteam(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::CreateOrUpdateSteam(
     AddonModels::FCreateOrUpdateSteamRequest& request,
     const FCreateOrUpdateSteamDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabAddonInstanceAPI::CreateOrUpdateSteam(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/CreateOrUpdateSteam"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnCreateOrUpdateSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnCreateOrUpdateSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabAddonInstanceAPI::OnCreateOrUpdateSteamResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAddonInstanceAPI::CreateOrUpdateTwitch(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::CreateOrUpdateTwitch(
     AddonModels::FCreateOrUpdateTwitchRequest& request,
     const FCreateOrUpdateTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabAddonInstanceAPI::CreateOrUpdateTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/CreateOrUpdateTwitch"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnCreateOrUpdateTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnCreateOrUpdateTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOrUpdateTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -347,7 +348,7 @@ void UPlayFabAddonInstanceAPI::OnCreateOrUpdateTwitchResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAddonInstanceAPI::DeleteApple(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::DeleteApple(
     AddonModels::FDeleteAppleRequest& request,
     const FDeleteAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -360,7 +361,7 @@ bool UPlayFabAddonInstanceAPI::DeleteApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/DeleteApple"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnDeleteAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnDeleteAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -377,7 +378,7 @@ void UPlayFabAddonInstanceAPI::OnDeleteAppleResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonInstanceAPI::DeleteFacebook(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::DeleteFacebook(
     AddonModels::FDeleteFacebookRequest& request,
     const FDeleteFacebookDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -390,7 +391,7 @@ bool UPlayFabAddonInstanceAPI::DeleteFacebook(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/DeleteFacebook"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnDeleteFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnDeleteFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -407,7 +408,7 @@ void UPlayFabAddonInstanceAPI::OnDeleteFacebookResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAddonInstanceAPI::DeleteFacebookInstantGames(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::DeleteFacebookInstantGames(
     AddonModels::FDeleteFacebookInstantGamesRequest& request,
     const FDeleteFacebookInstantGamesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -420,7 +421,7 @@ bool UPlayFabAddonInstanceAPI::DeleteFacebookInstantGames(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/DeleteFacebookInstantGames"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnDeleteFacebookInstantGamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnDeleteFacebookInstantGamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteFacebookInstantGamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -437,7 +438,7 @@ void UPlayFabAddonInstanceAPI::OnDeleteFacebookInstantGamesResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabAddonInstanceAPI::DeleteGoogle(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::DeleteGoogle(
     AddonModels::FDeleteGoogleRequest& request,
     const FDeleteGoogleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -450,7 +451,7 @@ bool UPlayFabAddonInstanceAPI::DeleteGoogle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/DeleteGoogle"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnDeleteGoogleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnDeleteGoogleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteGoogleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -467,7 +468,7 @@ void UPlayFabAddonInstanceAPI::OnDeleteGoogleResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonInstanceAPI::DeleteKongregate(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::DeleteKongregate(
     AddonModels::FDeleteKongregateRequest& request,
     const FDeleteKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -480,7 +481,7 @@ bool UPlayFabAddonInstanceAPI::DeleteKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/DeleteKongregate"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnDeleteKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnDeleteKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -497,7 +498,7 @@ void UPlayFabAddonInstanceAPI::OnDeleteKongregateResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAddonInstanceAPI::DeleteNintendo(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::DeleteNintendo(
     AddonModels::FDeleteNintendoRequest& request,
     const FDeleteNintendoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -510,7 +511,7 @@ bool UPlayFabAddonInstanceAPI::DeleteNintendo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/DeleteNintendo"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnDeleteNintendoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnDeleteNintendoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteNintendoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -527,7 +528,7 @@ void UPlayFabAddonInstanceAPI::OnDeleteNintendoResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAddonInstanceAPI::DeletePSN(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::DeletePSN(
     AddonModels::FDeletePSNRequest& request,
     const FDeletePSNDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -540,7 +541,7 @@ bool UPlayFabAddonInstanceAPI::DeletePSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/DeletePSN"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnDeletePSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnDeletePSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -557,7 +558,7 @@ void UPlayFabAddonInstanceAPI::OnDeletePSNResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabAddonInstanceAPI::DeleteSteam(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::DeleteSteam(
     AddonModels::FDeleteSteamRequest& request,
     const FDeleteSteamDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -570,7 +571,7 @@ bool UPlayFabAddonInstanceAPI::DeleteSteam(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/DeleteSteam"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnDeleteSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnDeleteSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -587,7 +588,7 @@ void UPlayFabAddonInstanceAPI::OnDeleteSteamResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonInstanceAPI::DeleteTwitch(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::DeleteTwitch(
     AddonModels::FDeleteTwitchRequest& request,
     const FDeleteTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -600,7 +601,7 @@ bool UPlayFabAddonInstanceAPI::DeleteTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/DeleteTwitch"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnDeleteTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnDeleteTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -617,7 +618,7 @@ void UPlayFabAddonInstanceAPI::OnDeleteTwitchResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonInstanceAPI::GetApple(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::GetApple(
     AddonModels::FGetAppleRequest& request,
     const FGetAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -630,7 +631,7 @@ bool UPlayFabAddonInstanceAPI::GetApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/GetApple"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnGetAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnGetAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -647,7 +648,7 @@ void UPlayFabAddonInstanceAPI::OnGetAppleResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAddonInstanceAPI::GetFacebook(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::GetFacebook(
     AddonModels::FGetFacebookRequest& request,
     const FGetFacebookDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -660,7 +661,7 @@ bool UPlayFabAddonInstanceAPI::GetFacebook(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/GetFacebook"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnGetFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnGetFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -677,7 +678,7 @@ void UPlayFabAddonInstanceAPI::OnGetFacebookResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonInstanceAPI::GetFacebookInstantGames(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::GetFacebookInstantGames(
     AddonModels::FGetFacebookInstantGamesRequest& request,
     const FGetFacebookInstantGamesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -690,7 +691,7 @@ bool UPlayFabAddonInstanceAPI::GetFacebookInstantGames(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/GetFacebookInstantGames"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnGetFacebookInstantGamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnGetFacebookInstantGamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFacebookInstantGamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -707,7 +708,7 @@ void UPlayFabAddonInstanceAPI::OnGetFacebookInstantGamesResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAddonInstanceAPI::GetGoogle(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::GetGoogle(
     AddonModels::FGetGoogleRequest& request,
     const FGetGoogleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -720,7 +721,7 @@ bool UPlayFabAddonInstanceAPI::GetGoogle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/GetGoogle"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnGetGoogleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnGetGoogleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGoogleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -737,7 +738,7 @@ void UPlayFabAddonInstanceAPI::OnGetGoogleResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabAddonInstanceAPI::GetKongregate(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::GetKongregate(
     AddonModels::FGetKongregateRequest& request,
     const FGetKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -750,7 +751,7 @@ bool UPlayFabAddonInstanceAPI::GetKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/GetKongregate"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnGetKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnGetKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -767,7 +768,7 @@ void UPlayFabAddonInstanceAPI::OnGetKongregateResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAddonInstanceAPI::GetNintendo(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::GetNintendo(
     AddonModels::FGetNintendoRequest& request,
     const FGetNintendoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -780,7 +781,7 @@ bool UPlayFabAddonInstanceAPI::GetNintendo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/GetNintendo"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnGetNintendoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnGetNintendoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetNintendoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -797,7 +798,7 @@ void UPlayFabAddonInstanceAPI::OnGetNintendoResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAddonInstanceAPI::GetPSN(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::GetPSN(
     AddonModels::FGetPSNRequest& request,
     const FGetPSNDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -810,7 +811,7 @@ bool UPlayFabAddonInstanceAPI::GetPSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/GetPSN"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnGetPSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnGetPSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -827,7 +828,7 @@ void UPlayFabAddonInstanceAPI::OnGetPSNResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabAddonInstanceAPI::GetSteam(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::GetSteam(
     AddonModels::FGetSteamRequest& request,
     const FGetSteamDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -840,7 +841,7 @@ bool UPlayFabAddonInstanceAPI::GetSteam(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/GetSteam"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnGetSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnGetSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -857,7 +858,7 @@ void UPlayFabAddonInstanceAPI::OnGetSteamResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAddonInstanceAPI::GetTwitch(
+FPlayFabRequestHandle UPlayFabAddonInstanceAPI::GetTwitch(
     AddonModels::FGetTwitchRequest& request,
     const FGetTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -870,7 +871,7 @@ bool UPlayFabAddonInstanceAPI::GetTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Addon/GetTwitch"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAddonInstanceAPI::OnGetTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAddonInstanceAPI::OnGetTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -886,3 +887,5 @@ void UPlayFabAddonInstanceAPI::OnGetTwitchResult(FHttpRequestPtr HttpRequest, FH
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_ADDON_API
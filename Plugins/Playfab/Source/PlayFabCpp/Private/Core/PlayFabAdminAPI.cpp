@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_ADMIN_API
 #include "Core/PlayFabAdminAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabAdminAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabAdminAPI::AbortTaskInstance(
+FPlayFabRequestHandle UPlayFabAdminAPI::AbortTaskInstance(
     AdminModels::FAbortTaskInstanceRequest& request,
     const FAbortTaskInstanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabAdminAPI::AbortTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AbortTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAbortTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnAbortTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAbortTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabAdminAPI::OnAbortTaskInstanceResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabAdminAPI::AddLocalizedNews(
+FPlayFabRequestHandle UPlayFabAdminAPI::AddLocalizedNews(
     AdminModels::FAddLocalizedNewsRequest& request,
     const FAddLocalizedNewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabAdminAPI::AddLocalizedNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddLocalizedNews"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddLocalizedNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnAddLocalizedNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddLocalizedNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabAdminAPI::OnAddLocalizedNewsResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminAPI::AddNews(
+FPlayFabRequestHandle UPlayFabAdminAPI::AddNews(
     AdminModels::FAddNewsRequest& request,
     const FAddNewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabAdminAPI::AddNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddNews"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnAddNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabAdminAPI::OnAddNewsResult(FHttpRequestPtr HttpRequest, FHttpRespons
     }
 }
 
-bool UPlayFabAdminAPI::AddPlayerTag(
+FPlayFabRequestHandle UPlayFabAdminAPI::AddPlayerTag(
     AdminModels::FAddPlayerTagRequest& request,
     const FAddPlayerTagDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabAdminAPI::AddPlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddPlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddPlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabAdminAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabAdminAPI::AddUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabAdminAPI::AddUserVirtualCurrency(
     AdminModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabAdminAPI::AddUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabAdminAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::AddVirtualCurrencyTypes(
+FPlayFabRequestHandle UPlayFabAdminAPI::AddVirtualCurrencyTypes(
     AdminModels::FAddVirtualCurrencyTypesRequest& request,
     const FAddVirtualCurrencyTypesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabAdminAPI::AddVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnAddVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabAdminAPI::OnAddVirtualCurrencyTypesResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAdminAPI::BanUsers(
+FPlayFabRequestHandle UPlayFabAdminAPI::BanUsers(
     AdminModels::FBanUsersRequest& request,
     const FBanUsersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,7 +221,7 @@ bool UPlayFabAdminAPI::BanUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/BanUsers"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBanUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -237,7 +238,7 @@ void UPlayFabAdminAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHttpRespon
     }
 }
 
-bool UPlayFabAdminAPI::CheckLimitedEditionItemAvailability(
+FPlayFabRequestHandle UPlayFabAdminAPI::CheckLimitedEditionItemAvailability(
     AdminModels::FCheckLimitedEditionItemAvailabilityRequest& request,
     const FCheckLimitedEditionItemAvailabilityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -250,7 +251,7 @@ bool UPlayFabAdminAPI::CheckLimitedEditionItemAvailability(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CheckLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCheckLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnCheckLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCheckLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -267,7 +268,7 @@ void UPlayFabAdminAPI::OnCheckLimitedEditionItemAvailabilityResult(FHttpRequestP
     }
 }
 
-bool UPlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(
+FPlayFabRequestHandle UPlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(
     AdminModels::FCreateActionsOnPlayerSegmentTaskRequest& request,
     const FCreateActionsOnPlayersInSegmentTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -280,7 +281,7 @@ bool UPlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateActionsOnPlayersInSegmentTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateActionsOnPlayersInSegmentTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnCreateActionsOnPlayersInSegmentTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateActionsOnPlayersInSegmentTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -297,7 +298,7 @@ void UPlayFabAdminAPI::OnCreateActionsOnPlayersInSegmentTaskResult(FHttpRequestP
     }
 }
 
-bool UPlayFabAdminAPI::CreateCloudScriptTask(
+FPlayFabRequestHandle UPlayFabAdminAPI::CreateCloudScriptTask(
     AdminModels::FCreateCloudScriptTaskRequest& request,
     const FCreateCloudScriptTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -310,7 +311,7 @@ bool UPlayFabAdminAPI::CreateCloudScriptTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateCloudScriptTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateCloudScriptTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnCreateCloudScriptTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateCloudScriptTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -327,7 +328,7 @@ void UPlayFabAdminAPI::OnCreateCloudScriptTaskResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminAPI::CreateInsightsScheduledScalingTask(
+FPlayFabRequestHandle UPlayFabAdminAPI::CreateInsightsScheduledScalingTask(
     AdminModels::FCreateInsightsScheduledScalingTaskRequest& request,
     const FCreateInsightsScheduledScalingTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -340,7 +341,7 @@ bool UPlayFabAdminAPI::CreateInsightsScheduledScalingTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateInsightsScheduledScalingTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateInsightsScheduledScalingTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnCreateInsightsScheduledScalingTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateInsightsScheduledScalingTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -357,7 +358,7 @@ void UPlayFabAdminAPI::OnCreateInsightsScheduledScalingTaskResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabAdminAPI::CreateOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminAPI::CreateOpenIdConnection(
     AdminModels::FCreateOpenIdConnectionRequest& request,
     const FCreateOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -370,7 +371,7 @@ bool UPlayFabAdminAPI::CreateOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnCreateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -387,7 +388,7 @@ void UPlayFabAdminAPI::OnCreateOpenIdConnectionResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::CreatePlayerSharedSecret(
+FPlayFabRequestHandle UPlayFabAdminAPI::CreatePlayerSharedSecret(
     AdminModels::FCreatePlayerSharedSecretRequest& request,
     const FCreatePlayerSharedSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -400,7 +401,7 @@ bool UPlayFabAdminAPI::CreatePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnCreatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -417,7 +418,7 @@ void UPlayFabAdminAPI::OnCreatePlayerSharedSecretResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::CreatePlayerStatisticDefinition(
+FPlayFabRequestHandle UPlayFabAdminAPI::CreatePlayerStatisticDefinition(
     AdminModels::FCreatePlayerStatisticDefinitionRequest& request,
     const FCreatePlayerStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -430,7 +431,7 @@ bool UPlayFabAdminAPI::CreatePlayerStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnCreatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -447,7 +448,7 @@ void UPlayFabAdminAPI::OnCreatePlayerStatisticDefinitionResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAdminAPI::CreateSegment(
+FPlayFabRequestHandle UPlayFabAdminAPI::CreateSegment(
     AdminModels::FCreateSegmentRequest& request,
     const FCreateSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -460,7 +461,7 @@ bool UPlayFabAdminAPI::CreateSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnCreateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -477,7 +478,7 @@ void UPlayFabAdminAPI::OnCreateSegmentResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAdminAPI::DeleteContent(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteContent(
     AdminModels::FDeleteContentRequest& request,
     const FDeleteContentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -490,7 +491,7 @@ bool UPlayFabAdminAPI::DeleteContent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteContent"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteContentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteContentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteContentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -507,7 +508,7 @@ void UPlayFabAdminAPI::OnDeleteContentResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAdminAPI::DeleteMasterPlayerAccount(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteMasterPlayerAccount(
     AdminModels::FDeleteMasterPlayerAccountRequest& request,
     const FDeleteMasterPlayerAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -520,7 +521,7 @@ bool UPlayFabAdminAPI::DeleteMasterPlayerAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteMasterPlayerAccount"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteMasterPlayerAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteMasterPlayerAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMasterPlayerAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -537,7 +538,7 @@ void UPlayFabAdminAPI::OnDeleteMasterPlayerAccountResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabAdminAPI::DeleteMasterPlayerEventData(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteMasterPlayerEventData(
     AdminModels::FDeleteMasterPlayerEventDataRequest& request,
     const FDeleteMasterPlayerEventDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -550,7 +551,7 @@ bool UPlayFabAdminAPI::DeleteMasterPlayerEventData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteMasterPlayerEventData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteMasterPlayerEventDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteMasterPlayerEventDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMasterPlayerEventDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -567,7 +568,7 @@ void UPlayFabAdminAPI::OnDeleteMasterPlayerEventDataResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAdminAPI::DeleteMembershipSubscription(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteMembershipSubscription(
     AdminModels::FDeleteMembershipSubscriptionRequest& request,
     const FDeleteMembershipSubscriptionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -580,7 +581,7 @@ bool UPlayFabAdminAPI::DeleteMembershipSubscription(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteMembershipSubscription"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteMembershipSubscriptionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteMembershipSubscriptionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMembershipSubscriptionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -597,7 +598,7 @@ void UPlayFabAdminAPI::OnDeleteMembershipSubscriptionResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminAPI::DeleteOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteOpenIdConnection(
     AdminModels::FDeleteOpenIdConnectionRequest& request,
     const FDeleteOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -610,7 +611,7 @@ bool UPlayFabAdminAPI::DeleteOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -627,7 +628,7 @@ void UPlayFabAdminAPI::OnDeleteOpenIdConnectionResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::DeletePlayer(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeletePlayer(
     AdminModels::FDeletePlayerRequest& request,
     const FDeletePlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -640,7 +641,7 @@ bool UPlayFabAdminAPI::DeletePlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeletePlayer"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -657,7 +658,7 @@ void UPlayFabAdminAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabAdminAPI::DeletePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeletePlayerCustomProperties(
     AdminModels::FDeletePlayerCustomPropertiesRequest& request,
     const FDeletePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -670,7 +671,7 @@ bool UPlayFabAdminAPI::DeletePlayerCustomProperties(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeletePlayerCustomProperties"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeletePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeletePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -687,7 +688,7 @@ void UPlayFabAdminAPI::OnDeletePlayerCustomPropertiesResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminAPI::DeletePlayerSharedSecret(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeletePlayerSharedSecret(
     AdminModels::FDeletePlayerSharedSecretRequest& request,
     const FDeletePlayerSharedSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -700,7 +701,7 @@ bool UPlayFabAdminAPI::DeletePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeletePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeletePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeletePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -717,7 +718,7 @@ void UPlayFabAdminAPI::OnDeletePlayerSharedSecretResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::DeleteSegment(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteSegment(
     AdminModels::FDeleteSegmentRequest& request,
     const FDeleteSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -730,7 +731,7 @@ bool UPlayFabAdminAPI::DeleteSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -747,7 +748,7 @@ void UPlayFabAdminAPI::OnDeleteSegmentResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAdminAPI::DeleteStore(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteStore(
     AdminModels::FDeleteStoreRequest& request,
     const FDeleteStoreDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -760,7 +761,7 @@ bool UPlayFabAdminAPI::DeleteStore(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteStore"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteStoreResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteStoreResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteStoreDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -777,7 +778,7 @@ void UPlayFabAdminAPI::OnDeleteStoreResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabAdminAPI::DeleteTask(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteTask(
     AdminModels::FDeleteTaskRequest& request,
     const FDeleteTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -790,7 +791,7 @@ bool UPlayFabAdminAPI::DeleteTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -807,7 +808,7 @@ void UPlayFabAdminAPI::OnDeleteTaskResult(FHttpRequestPtr HttpRequest, FHttpResp
     }
 }
 
-bool UPlayFabAdminAPI::DeleteTitle(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteTitle(
     const FDeleteTitleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -815,7 +816,7 @@ bool UPlayFabAdminAPI::DeleteTitle(
     return UPlayFabAdminAPI::DeleteTitle(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminAPI::DeleteTitle(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteTitle(
     AdminModels::FDeleteTitleRequest& request,
     const FDeleteTitleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -828,7 +829,7 @@ bool UPlayFabAdminAPI::DeleteTitle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteTitle"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -845,7 +846,7 @@ void UPlayFabAdminAPI::OnDeleteTitleResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabAdminAPI::DeleteTitleDataOverride(
+FPlayFabRequestHandle UPlayFabAdminAPI::DeleteTitleDataOverride(
     AdminModels::FDeleteTitleDataOverrideRequest& request,
     const FDeleteTitleDataOverrideDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -858,7 +859,7 @@ bool UPlayFabAdminAPI::DeleteTitleDataOverride(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteTitleDataOverride"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteTitleDataOverrideResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnDeleteTitleDataOverrideResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDataOverrideDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -875,7 +876,7 @@ void UPlayFabAdminAPI::OnDeleteTitleDataOverrideResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAdminAPI::ExportMasterPlayerData(
+FPlayFabRequestHandle UPlayFabAdminAPI::ExportMasterPlayerData(
     AdminModels::FExportMasterPlayerDataRequest& request,
     const FExportMasterPlayerDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -888,7 +889,7 @@ bool UPlayFabAdminAPI::ExportMasterPlayerData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ExportMasterPlayerData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnExportMasterPlayerDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnExportMasterPlayerDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExportMasterPlayerDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -905,7 +906,7 @@ void UPlayFabAdminAPI::OnExportMasterPlayerDataResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::ExportPlayersInSegment(
+FPlayFabRequestHandle UPlayFabAdminAPI::ExportPlayersInSegment(
     AdminModels::FExportPlayersInSegmentRequest& request,
     const FExportPlayersInSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -918,7 +919,7 @@ bool UPlayFabAdminAPI::ExportPlayersInSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ExportPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnExportPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnExportPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExportPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -935,7 +936,7 @@ void UPlayFabAdminAPI::OnExportPlayersInSegmentResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(
     AdminModels::FGetTaskInstanceRequest& request,
     const FGetActionsOnPlayersInSegmentTaskInstanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -948,7 +949,7 @@ bool UPlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetActionsOnPlayersInSegmentTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetActionsOnPlayersInSegmentTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -965,7 +966,7 @@ void UPlayFabAdminAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(FHttpReq
     }
 }
 
-bool UPlayFabAdminAPI::GetAllSegments(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetAllSegments(
     const FGetAllSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -973,7 +974,7 @@ bool UPlayFabAdminAPI::GetAllSegments(
     return UPlayFabAdminAPI::GetAllSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminAPI::GetAllSegments(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetAllSegments(
     AdminModels::FGetAllSegmentsRequest& request,
     const FGetAllSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -986,7 +987,7 @@ bool UPlayFabAdminAPI::GetAllSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetAllSegments"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1003,7 +1004,7 @@ void UPlayFabAdminAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabAdminAPI::GetCatalogItems(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetCatalogItems(
     AdminModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1016,7 +1017,7 @@ bool UPlayFabAdminAPI::GetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1033,7 +1034,7 @@ void UPlayFabAdminAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabAdminAPI::GetCloudScriptRevision(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetCloudScriptRevision(
     AdminModels::FGetCloudScriptRevisionRequest& request,
     const FGetCloudScriptRevisionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1046,7 +1047,7 @@ bool UPlayFabAdminAPI::GetCloudScriptRevision(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetCloudScriptRevision"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetCloudScriptRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetCloudScriptRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1063,7 +1064,7 @@ void UPlayFabAdminAPI::OnGetCloudScriptRevisionResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::GetCloudScriptTaskInstance(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetCloudScriptTaskInstance(
     AdminModels::FGetTaskInstanceRequest& request,
     const FGetCloudScriptTaskInstanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1076,7 +1077,7 @@ bool UPlayFabAdminAPI::GetCloudScriptTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetCloudScriptTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetCloudScriptTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetCloudScriptTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1093,7 +1094,7 @@ void UPlayFabAdminAPI::OnGetCloudScriptTaskInstanceResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabAdminAPI::GetCloudScriptVersions(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetCloudScriptVersions(
     const FGetCloudScriptVersionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -1101,7 +1102,7 @@ bool UPlayFabAdminAPI::GetCloudScriptVersions(
     return UPlayFabAdminAPI::GetCloudScriptVersions(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminAPI::GetCloudScriptVersions(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetCloudScriptVersions(
     AdminModels::FGetCloudScriptVersionsRequest& request,
     const FGetCloudScriptVersionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1114,7 +1115,7 @@ bool UPlayFabAdminAPI::GetCloudScriptVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetCloudScriptVersions"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetCloudScriptVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetCloudScriptVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1131,7 +1132,7 @@ void UPlayFabAdminAPI::OnGetCloudScriptVersionsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::GetContentList(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetContentList(
     AdminModels::FGetContentListRequest& request,
     const FGetContentListDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1144,7 +1145,7 @@ bool UPlayFabAdminAPI::GetContentList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetContentList"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetContentListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetContentListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1161,7 +1162,7 @@ void UPlayFabAdminAPI::OnGetContentListResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabAdminAPI::GetContentUploadUrl(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetContentUploadUrl(
     AdminModels::FGetContentUploadUrlRequest& request,
     const FGetContentUploadUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1174,7 +1175,7 @@ bool UPlayFabAdminAPI::GetContentUploadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetContentUploadUrl"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetContentUploadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetContentUploadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentUploadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1191,7 +1192,7 @@ void UPlayFabAdminAPI::OnGetContentUploadUrlResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::GetDataReport(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetDataReport(
     AdminModels::FGetDataReportRequest& request,
     const FGetDataReportDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1204,7 +1205,7 @@ bool UPlayFabAdminAPI::GetDataReport(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetDataReport"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetDataReportResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetDataReportResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDataReportDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1221,7 +1222,7 @@ void UPlayFabAdminAPI::OnGetDataReportResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayedTitleList(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayedTitleList(
     AdminModels::FGetPlayedTitleListRequest& request,
     const FGetPlayedTitleListDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1234,7 +1235,7 @@ bool UPlayFabAdminAPI::GetPlayedTitleList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayedTitleList"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayedTitleListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayedTitleListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayedTitleListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1251,7 +1252,7 @@ void UPlayFabAdminAPI::OnGetPlayedTitleListResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayerCustomProperty(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerCustomProperty(
     AdminModels::FGetPlayerCustomPropertyRequest& request,
     const FGetPlayerCustomPropertyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1264,7 +1265,7 @@ bool UPlayFabAdminAPI::GetPlayerCustomProperty(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerCustomProperty"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerCustomPropertyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCustomPropertyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1281,7 +1282,7 @@ void UPlayFabAdminAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayerIdFromAuthToken(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerIdFromAuthToken(
     AdminModels::FGetPlayerIdFromAuthTokenRequest& request,
     const FGetPlayerIdFromAuthTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1294,7 +1295,7 @@ bool UPlayFabAdminAPI::GetPlayerIdFromAuthToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerIdFromAuthToken"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerIdFromAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerIdFromAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerIdFromAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1311,7 +1312,7 @@ void UPlayFabAdminAPI::OnGetPlayerIdFromAuthTokenResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayerProfile(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerProfile(
     AdminModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1324,7 +1325,7 @@ bool UPlayFabAdminAPI::GetPlayerProfile(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerProfile"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1341,7 +1342,7 @@ void UPlayFabAdminAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayerSegments(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerSegments(
     AdminModels::FGetPlayersSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1354,7 +1355,7 @@ bool UPlayFabAdminAPI::GetPlayerSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerSegments"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1371,7 +1372,7 @@ void UPlayFabAdminAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayerSharedSecrets(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerSharedSecrets(
     const FGetPlayerSharedSecretsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -1379,7 +1380,7 @@ bool UPlayFabAdminAPI::GetPlayerSharedSecrets(
     return UPlayFabAdminAPI::GetPlayerSharedSecrets(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminAPI::GetPlayerSharedSecrets(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerSharedSecrets(
     AdminModels::FGetPlayerSharedSecretsRequest& request,
     const FGetPlayerSharedSecretsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1392,7 +1393,7 @@ bool UPlayFabAdminAPI::GetPlayerSharedSecrets(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerSharedSecrets"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerSharedSecretsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerSharedSecretsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSharedSecretsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1409,7 +1410,7 @@ void UPlayFabAdminAPI::OnGetPlayerSharedSecretsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayersInSegment(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayersInSegment(
     AdminModels::FGetPlayersInSegmentRequest& request,
     const FGetPlayersInSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1422,7 +1423,7 @@ bool UPlayFabAdminAPI::GetPlayersInSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1439,7 +1440,7 @@ void UPlayFabAdminAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayerStatisticDefinitions(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerStatisticDefinitions(
     const FGetPlayerStatisticDefinitionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -1447,7 +1448,7 @@ bool UPlayFabAdminAPI::GetPlayerStatisticDefinitions(
     return UPlayFabAdminAPI::GetPlayerStatisticDefinitions(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminAPI::GetPlayerStatisticDefinitions(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerStatisticDefinitions(
     AdminModels::FGetPlayerStatisticDefinitionsRequest& request,
     const FGetPlayerStatisticDefinitionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1460,7 +1461,7 @@ bool UPlayFabAdminAPI::GetPlayerStatisticDefinitions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerStatisticDefinitions"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerStatisticDefinitionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerStatisticDefinitionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticDefinitionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1477,7 +1478,7 @@ void UPlayFabAdminAPI::OnGetPlayerStatisticDefinitionsResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayerStatisticVersions(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerStatisticVersions(
     AdminModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1490,7 +1491,7 @@ bool UPlayFabAdminAPI::GetPlayerStatisticVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1507,7 +1508,7 @@ void UPlayFabAdminAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabAdminAPI::GetPlayerTags(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPlayerTags(
     AdminModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1520,7 +1521,7 @@ bool UPlayFabAdminAPI::GetPlayerTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerTags"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1537,7 +1538,7 @@ void UPlayFabAdminAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAdminAPI::GetPolicy(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPolicy(
     AdminModels::FGetPolicyRequest& request,
     const FGetPolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1550,7 +1551,7 @@ bool UPlayFabAdminAPI::GetPolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPolicy"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1567,7 +1568,7 @@ void UPlayFabAdminAPI::OnGetPolicyResult(FHttpRequestPtr HttpRequest, FHttpRespo
     }
 }
 
-bool UPlayFabAdminAPI::GetPublisherData(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetPublisherData(
     AdminModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1580,7 +1581,7 @@ bool UPlayFabAdminAPI::GetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1597,7 +1598,7 @@ void UPlayFabAdminAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminAPI::GetRandomResultTables(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetRandomResultTables(
     AdminModels::FGetRandomResultTablesRequest& request,
     const FGetRandomResultTablesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1610,7 +1611,7 @@ bool UPlayFabAdminAPI::GetRandomResultTables(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1627,7 +1628,7 @@ void UPlayFabAdminAPI::OnGetRandomResultTablesResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminAPI::GetSegmentExport(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetSegmentExport(
     AdminModels::FGetPlayersInSegmentExportRequest& request,
     const FGetSegmentExportDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1640,7 +1641,7 @@ bool UPlayFabAdminAPI::GetSegmentExport(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetSegmentExport"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetSegmentExportResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetSegmentExportResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSegmentExportDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1657,7 +1658,7 @@ void UPlayFabAdminAPI::OnGetSegmentExportResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminAPI::GetSegments(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetSegments(
     AdminModels::FGetSegmentsRequest& request,
     const FGetSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1670,7 +1671,7 @@ bool UPlayFabAdminAPI::GetSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetSegments"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1687,7 +1688,7 @@ void UPlayFabAdminAPI::OnGetSegmentsResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabAdminAPI::GetStoreItems(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetStoreItems(
     AdminModels::FGetStoreItemsRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1700,7 +1701,7 @@ bool UPlayFabAdminAPI::GetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1717,7 +1718,7 @@ void UPlayFabAdminAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAdminAPI::GetTaskInstances(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetTaskInstances(
     AdminModels::FGetTaskInstancesRequest& request,
     const FGetTaskInstancesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1730,7 +1731,7 @@ bool UPlayFabAdminAPI::GetTaskInstances(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetTaskInstances"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetTaskInstancesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetTaskInstancesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTaskInstancesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1747,7 +1748,7 @@ void UPlayFabAdminAPI::OnGetTaskInstancesResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminAPI::GetTasks(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetTasks(
     AdminModels::FGetTasksRequest& request,
     const FGetTasksDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1760,7 +1761,7 @@ bool UPlayFabAdminAPI::GetTasks(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetTasks"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetTasksResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetTasksResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTasksDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1777,7 +1778,7 @@ void UPlayFabAdminAPI::OnGetTasksResult(FHttpRequestPtr HttpRequest, FHttpRespon
     }
 }
 
-bool UPlayFabAdminAPI::GetTitleData(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetTitleData(
     AdminModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1790,7 +1791,7 @@ bool UPlayFabAdminAPI::GetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1807,7 +1808,7 @@ void UPlayFabAdminAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabAdminAPI::GetTitleInternalData(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetTitleInternalData(
     AdminModels::FGetTitleDataRequest& request,
     const FGetTitleInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1820,7 +1821,7 @@ bool UPlayFabAdminAPI::GetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1837,7 +1838,7 @@ void UPlayFabAdminAPI::OnGetTitleInternalDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::GetUserAccountInfo(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetUserAccountInfo(
     AdminModels::FLookupUserAccountInfoRequest& request,
     const FGetUserAccountInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1850,7 +1851,7 @@ bool UPlayFabAdminAPI::GetUserAccountInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserAccountInfo"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1867,7 +1868,7 @@ void UPlayFabAdminAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabAdminAPI::GetUserBans(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetUserBans(
     AdminModels::FGetUserBansRequest& request,
     const FGetUserBansDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1880,7 +1881,7 @@ bool UPlayFabAdminAPI::GetUserBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserBans"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1897,7 +1898,7 @@ void UPlayFabAdminAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabAdminAPI::GetUserData(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetUserData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1910,7 +1911,7 @@ bool UPlayFabAdminAPI::GetUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1927,7 +1928,7 @@ void UPlayFabAdminAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabAdminAPI::GetUserInternalData(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetUserInternalData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1940,7 +1941,7 @@ bool UPlayFabAdminAPI::GetUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1957,7 +1958,7 @@ void UPlayFabAdminAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::GetUserInventory(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetUserInventory(
     AdminModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1970,7 +1971,7 @@ bool UPlayFabAdminAPI::GetUserInventory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserInventory"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1987,7 +1988,7 @@ void UPlayFabAdminAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminAPI::GetUserPublisherData(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetUserPublisherData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2000,7 +2001,7 @@ bool UPlayFabAdminAPI::GetUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2017,7 +2018,7 @@ void UPlayFabAdminAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::GetUserPublisherInternalData(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetUserPublisherInternalData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserPublisherInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2030,7 +2031,7 @@ bool UPlayFabAdminAPI::GetUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2047,7 +2048,7 @@ void UPlayFabAdminAPI::OnGetUserPublisherInternalDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminAPI::GetUserPublisherReadOnlyData(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetUserPublisherReadOnlyData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2060,7 +2061,7 @@ bool UPlayFabAdminAPI::GetUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2077,7 +2078,7 @@ void UPlayFabAdminAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminAPI::GetUserReadOnlyData(
+FPlayFabRequestHandle UPlayFabAdminAPI::GetUserReadOnlyData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2090,7 +2091,7 @@ bool UPlayFabAdminAPI::GetUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2107,7 +2108,7 @@ void UPlayFabAdminAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::GrantItemsToUsers(
+FPlayFabRequestHandle UPlayFabAdminAPI::GrantItemsToUsers(
     AdminModels::FGrantItemsToUsersRequest& request,
     const FGrantItemsToUsersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2120,7 +2121,7 @@ bool UPlayFabAdminAPI::GrantItemsToUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GrantItemsToUsers"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2137,7 +2138,7 @@ void UPlayFabAdminAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabAdminAPI::IncrementLimitedEditionItemAvailability(
+FPlayFabRequestHandle UPlayFabAdminAPI::IncrementLimitedEditionItemAvailability(
     AdminModels::FIncrementLimitedEditionItemAvailabilityRequest& request,
     const FIncrementLimitedEditionItemAvailabilityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2150,7 +2151,7 @@ bool UPlayFabAdminAPI::IncrementLimitedEditionItemAvailability(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/IncrementLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnIncrementLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnIncrementLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2167,7 +2168,7 @@ void UPlayFabAdminAPI::OnIncrementLimitedEditionItemAvailabilityResult(FHttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::IncrementPlayerStatisticVersion(
+FPlayFabRequestHandle UPlayFabAdminAPI::IncrementPlayerStatisticVersion(
     AdminModels::FIncrementPlayerStatisticVersionRequest& request,
     const FIncrementPlayerStatisticVersionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2180,7 +2181,7 @@ bool UPlayFabAdminAPI::IncrementPlayerStatisticVersion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/IncrementPlayerStatisticVersion"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnIncrementPlayerStatisticVersionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnIncrementPlayerStatisticVersionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementPlayerStatisticVersionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2197,7 +2198,7 @@ void UPlayFabAdminAPI::OnIncrementPlayerStatisticVersionResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAdminAPI::ListOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminAPI::ListOpenIdConnection(
     const FListOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -2205,7 +2206,7 @@ bool UPlayFabAdminAPI::ListOpenIdConnection(
     return UPlayFabAdminAPI::ListOpenIdConnection(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminAPI::ListOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminAPI::ListOpenIdConnection(
     AdminModels::FListOpenIdConnectionRequest& request,
     const FListOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2218,7 +2219,7 @@ bool UPlayFabAdminAPI::ListOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ListOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnListOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnListOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2235,7 +2236,7 @@ void UPlayFabAdminAPI::OnListOpenIdConnectionResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::ListPlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabAdminAPI::ListPlayerCustomProperties(
     AdminModels::FListPlayerCustomPropertiesRequest& request,
     const FListPlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2248,7 +2249,7 @@ bool UPlayFabAdminAPI::ListPlayerCustomProperties(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ListPlayerCustomProperties"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnListPlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnListPlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListPlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2265,7 +2266,7 @@ void UPlayFabAdminAPI::OnListPlayerCustomPropertiesResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabAdminAPI::ListVirtualCurrencyTypes(
+FPlayFabRequestHandle UPlayFabAdminAPI::ListVirtualCurrencyTypes(
     const FListVirtualCurrencyTypesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -2273,7 +2274,7 @@ bool UPlayFabAdminAPI::ListVirtualCurrencyTypes(
     return UPlayFabAdminAPI::ListVirtualCurrencyTypes(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminAPI::ListVirtualCurrencyTypes(
+FPlayFabRequestHandle UPlayFabAdminAPI::ListVirtualCurrencyTypes(
     AdminModels::FListVirtualCurrencyTypesRequest& request,
     const FListVirtualCurrencyTypesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2286,7 +2287,7 @@ bool UPlayFabAdminAPI::ListVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ListVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnListVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnListVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2303,7 +2304,7 @@ void UPlayFabAdminAPI::OnListVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::RefundPurchase(
+FPlayFabRequestHandle UPlayFabAdminAPI::RefundPurchase(
     AdminModels::FRefundPurchaseRequest& request,
     const FRefundPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2316,7 +2317,7 @@ bool UPlayFabAdminAPI::RefundPurchase(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RefundPurchase"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRefundPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnRefundPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefundPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2333,7 +2334,7 @@ void UPlayFabAdminAPI::OnRefundPurchaseResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabAdminAPI::RemovePlayerTag(
+FPlayFabRequestHandle UPlayFabAdminAPI::RemovePlayerTag(
     AdminModels::FRemovePlayerTagRequest& request,
     const FRemovePlayerTagDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2346,7 +2347,7 @@ bool UPlayFabAdminAPI::RemovePlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RemovePlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemovePlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2363,7 +2364,7 @@ void UPlayFabAdminAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabAdminAPI::RemoveVirtualCurrencyTypes(
+FPlayFabRequestHandle UPlayFabAdminAPI::RemoveVirtualCurrencyTypes(
     AdminModels::FRemoveVirtualCurrencyTypesRequest& request,
     const FRemoveVirtualCurrencyTypesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2376,7 +2377,7 @@ bool UPlayFabAdminAPI::RemoveVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RemoveVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRemoveVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnRemoveVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2393,7 +2394,7 @@ void UPlayFabAdminAPI::OnRemoveVirtualCurrencyTypesResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabAdminAPI::ResetCharacterStatistics(
+FPlayFabRequestHandle UPlayFabAdminAPI::ResetCharacterStatistics(
     AdminModels::FResetCharacterStatisticsRequest& request,
     const FResetCharacterStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2406,7 +2407,7 @@ bool UPlayFabAdminAPI::ResetCharacterStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ResetCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnResetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnResetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2423,7 +2424,7 @@ void UPlayFabAdminAPI::OnResetCharacterStatisticsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::ResetPassword(
+FPlayFabRequestHandle UPlayFabAdminAPI::ResetPassword(
     AdminModels::FResetPasswordRequest& request,
     const FResetPasswordDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2436,7 +2437,7 @@ bool UPlayFabAdminAPI::ResetPassword(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ResetPassword"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnResetPasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnResetPasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetPasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2453,7 +2454,7 @@ void UPlayFabAdminAPI::OnResetPasswordResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAdminAPI::ResetUserStatistics(
+FPlayFabRequestHandle UPlayFabAdminAPI::ResetUserStatistics(
     AdminModels::FResetUserStatisticsRequest& request,
     const FResetUserStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2466,7 +2467,7 @@ bool UPlayFabAdminAPI::ResetUserStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ResetUserStatistics"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnResetUserStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnResetUserStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetUserStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2483,7 +2484,7 @@ void UPlayFabAdminAPI::OnResetUserStatisticsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::ResolvePurchaseDispute(
+FPlayFabRequestHandle UPlayFabAdminAPI::ResolvePurchaseDispute(
     AdminModels::FResolvePurchaseDisputeRequest& request,
     const FResolvePurchaseDisputeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2496,7 +2497,7 @@ bool UPlayFabAdminAPI::ResolvePurchaseDispute(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ResolvePurchaseDispute"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnResolvePurchaseDisputeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnResolvePurchaseDisputeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResolvePurchaseDisputeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2513,7 +2514,7 @@ void UPlayFabAdminAPI::OnResolvePurchaseDisputeResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::RevokeAllBansForUser(
+FPlayFabRequestHandle UPlayFabAdminAPI::RevokeAllBansForUser(
     AdminModels::FRevokeAllBansForUserRequest& request,
     const FRevokeAllBansForUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2526,7 +2527,7 @@ bool UPlayFabAdminAPI::RevokeAllBansForUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RevokeAllBansForUser"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeAllBansForUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2543,7 +2544,7 @@ void UPlayFabAdminAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::RevokeBans(
+FPlayFabRequestHandle UPlayFabAdminAPI::RevokeBans(
     AdminModels::FRevokeBansRequest& request,
     const FRevokeBansDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2556,7 +2557,7 @@ bool UPlayFabAdminAPI::RevokeBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RevokeBans"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2573,7 +2574,7 @@ void UPlayFabAdminAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, FHttpResp
     }
 }
 
-bool UPlayFabAdminAPI::RevokeInventoryItem(
+FPlayFabRequestHandle UPlayFabAdminAPI::RevokeInventoryItem(
     AdminModels::FRevokeInventoryItemRequest& request,
     const FRevokeInventoryItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2586,7 +2587,7 @@ bool UPlayFabAdminAPI::RevokeInventoryItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RevokeInventoryItem"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2603,7 +2604,7 @@ void UPlayFabAdminAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::RevokeInventoryItems(
+FPlayFabRequestHandle UPlayFabAdminAPI::RevokeInventoryItems(
     AdminModels::FRevokeInventoryItemsRequest& request,
     const FRevokeInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2616,7 +2617,7 @@ bool UPlayFabAdminAPI::RevokeInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RevokeInventoryItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2633,7 +2634,7 @@ void UPlayFabAdminAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::RunTask(
+FPlayFabRequestHandle UPlayFabAdminAPI::RunTask(
     AdminModels::FRunTaskRequest& request,
     const FRunTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2646,7 +2647,7 @@ bool UPlayFabAdminAPI::RunTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RunTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRunTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnRunTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRunTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2663,7 +2664,7 @@ void UPlayFabAdminAPI::OnRunTaskResult(FHttpRequestPtr HttpRequest, FHttpRespons
     }
 }
 
-bool UPlayFabAdminAPI::SendAccountRecoveryEmail(
+FPlayFabRequestHandle UPlayFabAdminAPI::SendAccountRecoveryEmail(
     AdminModels::FSendAccountRecoveryEmailRequest& request,
     const FSendAccountRecoveryEmailDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2676,7 +2677,7 @@ bool UPlayFabAdminAPI::SendAccountRecoveryEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SendAccountRecoveryEmail"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2693,7 +2694,7 @@ void UPlayFabAdminAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::SetCatalogItems(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetCatalogItems(
     AdminModels::FUpdateCatalogItemsRequest& request,
     const FSetCatalogItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2706,7 +2707,7 @@ bool UPlayFabAdminAPI::SetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2723,7 +2724,7 @@ void UPlayFabAdminAPI::OnSetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabAdminAPI::SetMembershipOverride(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetMembershipOverride(
     AdminModels::FSetMembershipOverrideRequest& request,
     const FSetMembershipOverrideDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2736,7 +2737,7 @@ bool UPlayFabAdminAPI::SetMembershipOverride(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetMembershipOverride"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetMembershipOverrideResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetMembershipOverrideResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetMembershipOverrideDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2753,7 +2754,7 @@ void UPlayFabAdminAPI::OnSetMembershipOverrideResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminAPI::SetPlayerSecret(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetPlayerSecret(
     AdminModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2766,7 +2767,7 @@ bool UPlayFabAdminAPI::SetPlayerSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetPlayerSecret"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2783,7 +2784,7 @@ void UPlayFabAdminAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabAdminAPI::SetPublishedRevision(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetPublishedRevision(
     AdminModels::FSetPublishedRevisionRequest& request,
     const FSetPublishedRevisionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2796,7 +2797,7 @@ bool UPlayFabAdminAPI::SetPublishedRevision(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetPublishedRevision"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetPublishedRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetPublishedRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublishedRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2813,7 +2814,7 @@ void UPlayFabAdminAPI::OnSetPublishedRevisionResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::SetPublisherData(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetPublisherData(
     AdminModels::FSetPublisherDataRequest& request,
     const FSetPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2826,7 +2827,7 @@ bool UPlayFabAdminAPI::SetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2843,7 +2844,7 @@ void UPlayFabAdminAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminAPI::SetStoreItems(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetStoreItems(
     AdminModels::FUpdateStoreItemsRequest& request,
     const FSetStoreItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2856,7 +2857,7 @@ bool UPlayFabAdminAPI::SetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2873,7 +2874,7 @@ void UPlayFabAdminAPI::OnSetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAdminAPI::SetTitleData(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetTitleData(
     AdminModels::FSetTitleDataRequest& request,
     const FSetTitleDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2886,7 +2887,7 @@ bool UPlayFabAdminAPI::SetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2903,7 +2904,7 @@ void UPlayFabAdminAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabAdminAPI::SetTitleDataAndOverrides(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetTitleDataAndOverrides(
     AdminModels::FSetTitleDataAndOverridesRequest& request,
     const FSetTitleDataAndOverridesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2916,7 +2917,7 @@ bool UPlayFabAdminAPI::SetTitleDataAndOverrides(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetTitleDataAndOverrides"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetTitleDataAndOverridesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetTitleDataAndOverridesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataAndOverridesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2933,7 +2934,7 @@ void UPlayFabAdminAPI::OnSetTitleDataAndOverridesResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::SetTitleInternalData(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetTitleInternalData(
     AdminModels::FSetTitleDataRequest& request,
     const FSetTitleInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2946,7 +2947,7 @@ bool UPlayFabAdminAPI::SetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2963,7 +2964,7 @@ void UPlayFabAdminAPI::OnSetTitleInternalDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminAPI::SetupPushNotification(
+FPlayFabRequestHandle UPlayFabAdminAPI::SetupPushNotification(
     AdminModels::FSetupPushNotificationRequest& request,
     const FSetupPushNotificationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2976,7 +2977,7 @@ bool UPlayFabAdminAPI::SetupPushNotification(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetupPushNotification"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetupPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSetupPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetupPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2993,7 +2994,7 @@ void UPlayFabAdminAPI::OnSetupPushNotificationResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminAPI::SubtractUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabAdminAPI::SubtractUserVirtualCurrency(
     AdminModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3006,7 +3007,7 @@ bool UPlayFabAdminAPI::SubtractUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3023,7 +3024,7 @@ void UPlayFabAdminAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAdminAPI::UpdateBans(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateBans(
     AdminModels::FUpdateBansRequest& request,
     const FUpdateBansDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3036,7 +3037,7 @@ bool UPlayFabAdminAPI::UpdateBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateBans"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3053,7 +3054,7 @@ void UPlayFabAdminAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, FHttpResp
     }
 }
 
-bool UPlayFabAdminAPI::UpdateCatalogItems(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateCatalogItems(
     AdminModels::FUpdateCatalogItemsRequest& request,
     const FUpdateCatalogItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3066,7 +3067,7 @@ bool UPlayFabAdminAPI::UpdateCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3083,7 +3084,7 @@ void UPlayFabAdminAPI::OnUpdateCatalogItemsResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabAdminAPI::UpdateCloudScript(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateCloudScript(
     AdminModels::FUpdateCloudScriptRequest& request,
     const FUpdateCloudScriptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3096,7 +3097,7 @@ bool UPlayFabAdminAPI::UpdateCloudScript(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateCloudScript"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3113,7 +3114,7 @@ void UPlayFabAdminAPI::OnUpdateCloudScriptResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabAdminAPI::UpdateOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateOpenIdConnection(
     AdminModels::FUpdateOpenIdConnectionRequest& request,
     const FUpdateOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3126,7 +3127,7 @@ bool UPlayFabAdminAPI::UpdateOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3143,7 +3144,7 @@ void UPlayFabAdminAPI::OnUpdateOpenIdConnectionResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::UpdatePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdatePlayerCustomProperties(
     AdminModels::FUpdatePlayerCustomPropertiesRequest& request,
     const FUpdatePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3156,7 +3157,7 @@ bool UPlayFabAdminAPI::UpdatePlayerCustomProperties(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdatePlayerCustomProperties"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdatePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdatePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3173,7 +3174,7 @@ void UPlayFabAdminAPI::OnUpdatePlayerCustomPropertiesResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminAPI::UpdatePlayerSharedSecret(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdatePlayerSharedSecret(
     AdminModels::FUpdatePlayerSharedSecretRequest& request,
     const FUpdatePlayerSharedSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3186,7 +3187,7 @@ bool UPlayFabAdminAPI::UpdatePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3203,7 +3204,7 @@ void UPlayFabAdminAPI::OnUpdatePlayerSharedSecretResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::UpdatePlayerStatisticDefinition(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdatePlayerStatisticDefinition(
     AdminModels::FUpdatePlayerStatisticDefinitionRequest& request,
     const FUpdatePlayerStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3216,7 +3217,7 @@ bool UPlayFabAdminAPI::UpdatePlayerStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3233,7 +3234,7 @@ void UPlayFabAdminAPI::OnUpdatePlayerStatisticDefinitionResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAdminAPI::UpdatePolicy(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdatePolicy(
     AdminModels::FUpdatePolicyRequest& request,
     const FUpdatePolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3246,7 +3247,7 @@ bool UPlayFabAdminAPI::UpdatePolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdatePolicy"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdatePolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdatePolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3263,7 +3264,7 @@ void UPlayFabAdminAPI::OnUpdatePolicyResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabAdminAPI::UpdateRandomResultTables(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateRandomResultTables(
     AdminModels::FUpdateRandomResultTablesRequest& request,
     const FUpdateRandomResultTablesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3276,7 +3277,7 @@ bool UPlayFabAdminAPI::UpdateRandomResultTables(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3293,7 +3294,7 @@ void UPlayFabAdminAPI::OnUpdateRandomResultTablesResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminAPI::UpdateSegment(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateSegment(
     AdminModels::FUpdateSegmentRequest& request,
     const FUpdateSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3306,7 +3307,7 @@ bool UPlayFabAdminAPI::UpdateSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3323,7 +3324,7 @@ void UPlayFabAdminAPI::OnUpdateSegmentResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabAdminAPI::UpdateStoreItems(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateStoreItems(
     AdminModels::FUpdateStoreItemsRequest& request,
     const FUpdateStoreItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3336,7 +3337,7 @@ bool UPlayFabAdminAPI::UpdateStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3353,7 +3354,7 @@ void UPlayFabAdminAPI::OnUpdateStoreItemsResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminAPI::UpdateTask(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateTask(
     AdminModels::FUpdateTaskRequest& request,
     const FUpdateTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3366,7 +3367,7 @@ bool UPlayFabAdminAPI::UpdateTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3383,7 +3384,7 @@ void UPlayFabAdminAPI::OnUpdateTaskResult(FHttpRequestPtr HttpRequest, FHttpResp
     }
 }
 
-bool UPlayFabAdminAPI::UpdateUserData(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateUserData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3396,7 +3397,7 @@ bool UPlayFabAdminAPI::UpdateUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3413,7 +3414,7 @@ void UPlayFabAdminAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabAdminAPI::UpdateUserInternalData(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateUserInternalData(
     AdminModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3426,7 +3427,7 @@ bool UPlayFabAdminAPI::UpdateUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3443,7 +3444,7 @@ void UPlayFabAdminAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::UpdateUserPublisherData(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateUserPublisherData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3456,7 +3457,7 @@ bool UPlayFabAdminAPI::UpdateUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3473,7 +3474,7 @@ void UPlayFabAdminAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAdminAPI::UpdateUserPublisherInternalData(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateUserPublisherInternalData(
     AdminModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserPublisherInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3486,7 +3487,7 @@ bool UPlayFabAdminAPI::UpdateUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3503,7 +3504,7 @@ void UPlayFabAdminAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAdminAPI::UpdateUserPublisherReadOnlyData(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateUserPublisherReadOnlyData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3516,7 +3517,7 @@ bool UPlayFabAdminAPI::UpdateUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3533,7 +3534,7 @@ void UPlayFabAdminAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAdminAPI::UpdateUserReadOnlyData(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateUserReadOnlyData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3546,7 +3547,7 @@ bool UPlayFabAdminAPI::UpdateUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3563,7 +3564,7 @@ void UPlayFabAdminAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminAPI::UpdateUserTitleDisplayName(
+FPlayFabRequestHandle UPlayFabAdminAPI::UpdateUserTitleDisplayName(
     AdminModels::FUpdateUserTitleDisplayNameRequest& request,
     const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3576,7 +3577,7 @@ bool UPlayFabAdminAPI::UpdateUserTitleDisplayName(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3592,3 +3593,5 @@ void UPlayFabAdminAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRe
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_ADMIN_API
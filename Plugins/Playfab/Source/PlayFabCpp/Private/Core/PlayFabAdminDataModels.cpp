@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_ADMIN_API
 
 #include "Core/PlayFabAdminDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -51,6 +52,7 @@ bool PlayFab::AdminModels::FAbortTaskInstanceRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -935,11 +937,7 @@ bool PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::readFromValu
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ActionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Actions"));
-    for (int32 Idx = 0; Idx < ActionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ActionsArray[Idx];
-        Actions.Add(FAction(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ActionsArray, Actions);
 
 
     const TSharedPtr<FJsonValue> SegmentIdValue = obj->TryGetField(TEXT("SegmentId"));
@@ -973,18 +971,18 @@ AdminModels::TaskInstanceStatus PlayFab::AdminModels::readTaskInstanceStatusFrom
 
 AdminModels::TaskInstanceStatus PlayFab::AdminModels::readTaskInstanceStatusFromValue(const FString& value)
 {
-    static TMap<FString, TaskInstanceStatus> _TaskInstanceStatusMap;
-    if (_TaskInstanceStatusMap.Num() == 0)
+    static const TMap<FString, TaskInstanceStatus> _TaskInstanceStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _TaskInstanceStatusMap.Add(TEXT("Succeeded"), TaskInstanceStatusSucceeded);
-        _TaskInstanceStatusMap.Add(TEXT("Starting"), TaskInstanceStatusStarting);
-        _TaskInstanceStatusMap.Add(TEXT("InProgress"), TaskInstanceStatusInProgress);
-        _TaskInstanceStatusMap.Add(TEXT("Failed"), TaskInstanceStatusFailed);
-        _TaskInstanceStatusMap.Add(TEXT("Aborted"), TaskInstanceStatusAborted);
-        _TaskInstanceStatusMap.Add(TEXT("Stalled"), TaskInstanceStatusStalled);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, TaskInstanceStatus> Map;
+        Map.Add(TEXT("Succeeded"), TaskInstanceStatusSucceeded);
+        Map.Add(TEXT("Starting"), TaskInstanceStatusStarting);
+        Map.Add(TEXT("InProgress"), TaskInstanceStatusInProgress);
+        Map.Add(TEXT("Failed"), TaskInstanceStatusFailed);
+        Map.Add(TEXT("Aborted"), TaskInstanceStatusAborted);
+        Map.Add(TEXT("Stalled"), TaskInstanceStatusStalled);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1334,21 +1332,21 @@ AdminModels::SegmentFilterComparison PlayFab::AdminModels::readSegmentFilterComp
 
 AdminModels::SegmentFilterComparison PlayFab::AdminModels::readSegmentFilterComparisonFromValue(const FString& value)
 {
-    static TMap<FString, SegmentFilterComparison> _SegmentFilterComparisonMap;
-    if (_SegmentFilterComparisonMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _SegmentFilterComparisonMap.Add(TEXT("GreaterThan"), SegmentFilterComparisonGreaterThan);
-        _SegmentFilterComparisonMap.Add(TEXT("LessThan"), SegmentFilterComparisonLessThan);
-        _SegmentFilterComparisonMap.Add(TEXT("EqualTo"), SegmentFilterComparisonEqualTo);
-        _SegmentFilterComparisonMap.Add(TEXT("NotEqualTo"), SegmentFilterComparisonNotEqualTo);
-        _SegmentFilterComparisonMap.Add(TEXT("GreaterThanOrEqual"), SegmentFilterComparisonGreaterThanOrEqual);
-        _SegmentFilterComparisonMap.Add(TEXT("LessThanOrEqual"), SegmentFilterComparisonLessThanOrEqual);
-        _SegmentFilterComparisonMap.Add(TEXT("Exists"), SegmentFilterComparisonExists);
-        _SegmentFilterComparisonMap.Add(TEXT("Contains"), SegmentFilterComparisonContains);
-        _SegmentFilterComparisonMap.Add(TEXT("NotContains"), SegmentFilterComparisonNotContains);
-
-    }
+    static const TMap<FString, SegmentFilterComparison> _SegmentFilterComparisonMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SegmentFilterComparison> Map;
+        Map.Add(TEXT("GreaterThan"), SegmentFilterComparisonGreaterThan);
+        Map.Add(TEXT("LessThan"), SegmentFilterComparisonLessThan);
+        Map.Add(TEXT("EqualTo"), SegmentFilterComparisonEqualTo);
+        Map.Add(TEXT("NotEqualTo"), SegmentFilterComparisonNotEqualTo);
+        Map.Add(TEXT("GreaterThanOrEqual"), SegmentFilterComparisonGreaterThanOrEqual);
+        Map.Add(TEXT("LessThanOrEqual"), SegmentFilterComparisonLessThanOrEqual);
+        Map.Add(TEXT("Exists"), SegmentFilterComparisonExists);
+        Map.Add(TEXT("Contains"), SegmentFilterComparisonContains);
+        Map.Add(TEXT("NotContains"), SegmentFilterComparisonNotContains);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1574,6 +1572,7 @@ bool PlayFab::AdminModels::FAddLocalizedNewsRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1686,6 +1685,7 @@ bool PlayFab::AdminModels::FAddNewsRequest::readFromValue(const TSharedPtr<FJson
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1766,7 +1766,7 @@ void PlayFab::AdminModels::FAddPlayerTagRequest::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!TagName.IsEmpty() == false)
@@ -1789,6 +1789,7 @@ bool PlayFab::AdminModels::FAddPlayerTagRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1861,7 +1862,7 @@ void PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!VirtualCurrency.IsEmpty() == false)
@@ -1891,6 +1892,7 @@ bool PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2025,11 +2027,7 @@ bool PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&VirtualCurrenciesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("VirtualCurrencies"));
-    for (int32 Idx = 0; Idx < VirtualCurrenciesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VirtualCurrenciesArray[Idx];
-        VirtualCurrencies.Add(FVirtualCurrencyData(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VirtualCurrenciesArray, VirtualCurrencies);
 
 
     return HasSucceeded;
@@ -2072,15 +2070,15 @@ AdminModels::Conditionals PlayFab::AdminModels::readConditionalsFromValue(const
 
 AdminModels::Conditionals PlayFab::AdminModels::readConditionalsFromValue(const FString& value)
 {
-    static TMap<FString, Conditionals> _ConditionalsMap;
-    if (_ConditionalsMap.Num() == 0)
+    static const TMap<FString, Conditionals> _ConditionalsMap = []()
     {
-        // Auto-generate the map on the first use
-        _ConditionalsMap.Add(TEXT("Any"), ConditionalsAny);
-        _ConditionalsMap.Add(TEXT("True"), ConditionalsTrue);
-        _ConditionalsMap.Add(TEXT("False"), ConditionalsFalse);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, Conditionals> Map;
+        Map.Add(TEXT("Any"), ConditionalsAny);
+        Map.Add(TEXT("True"), ConditionalsTrue);
+        Map.Add(TEXT("False"), ConditionalsFalse);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2135,13 +2133,13 @@ AdminModels::AuthTokenType PlayFab::AdminModels::readAuthTokenTypeFromValue(cons
 
 AdminModels::AuthTokenType PlayFab::AdminModels::readAuthTokenTypeFromValue(const FString& value)
 {
-    static TMap<FString, AuthTokenType> _AuthTokenTypeMap;
-    if (_AuthTokenTypeMap.Num() == 0)
+    static const TMap<FString, AuthTokenType> _AuthTokenTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _AuthTokenTypeMap.Add(TEXT("Email"), AuthTokenTypeEmail);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, AuthTokenType> Map;
+        Map.Add(TEXT("Email"), AuthTokenTypeEmail);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2192,7 +2190,7 @@ void PlayFab::AdminModels::FBanInfo::writeJSON(JsonWriter& writer) const
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Reason.IsEmpty() == false)
@@ -2332,15 +2330,15 @@ AdminModels::UserFamilyType PlayFab::AdminModels::readUserFamilyTypeFromValue(co
 
 AdminModels::UserFamilyType PlayFab::AdminModels::readUserFamilyTypeFromValue(const FString& value)
 {
-    static TMap<FString, UserFamilyType> _UserFamilyTypeMap;
-    if (_UserFamilyTypeMap.Num() == 0)
+    static const TMap<FString, UserFamilyType> _UserFamilyTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _UserFamilyTypeMap.Add(TEXT("None"), UserFamilyTypeNone);
-        _UserFamilyTypeMap.Add(TEXT("Xbox"), UserFamilyTypeXbox);
-        _UserFamilyTypeMap.Add(TEXT("Steam"), UserFamilyTypeSteam);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, UserFamilyType> Map;
+        Map.Add(TEXT("None"), UserFamilyTypeNone);
+        Map.Add(TEXT("Xbox"), UserFamilyTypeXbox);
+        Map.Add(TEXT("Steam"), UserFamilyTypeSteam);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2380,7 +2378,7 @@ void PlayFab::AdminModels::FBanRequest::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Reason.IsEmpty() == false)
@@ -2469,16 +2467,13 @@ bool PlayFab::AdminModels::FBanUsersRequest::readFromValue(const TSharedPtr<FJso
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BansArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Bans"));
-    for (int32 Idx = 0; Idx < BansArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BansArray[Idx];
-        Bans.Add(FBanRequest(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BansArray, Bans);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2514,11 +2509,7 @@ bool PlayFab::AdminModels::FBanUsersResult::readFromValue(const TSharedPtr<FJson
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -3091,16 +3082,16 @@ AdminModels::ChurnRiskLevel PlayFab::AdminModels::readChurnRiskLevelFromValue(co
 
 AdminModels::ChurnRiskLevel PlayFab::AdminModels::readChurnRiskLevelFromValue(const FString& value)
 {
-    static TMap<FString, ChurnRiskLevel> _ChurnRiskLevelMap;
-    if (_ChurnRiskLevelMap.Num() == 0)
+    static const TMap<FString, ChurnRiskLevel> _ChurnRiskLevelMap = []()
     {
-        // Auto-generate the map on the first use
-        _ChurnRiskLevelMap.Add(TEXT("NoData"), ChurnRiskLevelNoData);
-        _ChurnRiskLevelMap.Add(TEXT("LowRisk"), ChurnRiskLevelLowRisk);
-        _ChurnRiskLevelMap.Add(TEXT("MediumRisk"), ChurnRiskLevelMediumRisk);
-        _ChurnRiskLevelMap.Add(TEXT("HighRisk"), ChurnRiskLevelHighRisk);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ChurnRiskLevel> Map;
+        Map.Add(TEXT("NoData"), ChurnRiskLevelNoData);
+        Map.Add(TEXT("LowRisk"), ChurnRiskLevelLowRisk);
+        Map.Add(TEXT("MediumRisk"), ChurnRiskLevelMediumRisk);
+        Map.Add(TEXT("HighRisk"), ChurnRiskLevelHighRisk);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -3481,11 +3472,7 @@ bool PlayFab::AdminModels::FExecuteCloudScriptResult::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&LogsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Logs"));
-    for (int32 Idx = 0; Idx < LogsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LogsArray[Idx];
-        Logs.Add(FLogStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LogsArray, Logs);
 
 
     const TSharedPtr<FJsonValue> LogsTooLargeValue = obj->TryGetField(TEXT("LogsTooLarge"));
@@ -3710,15 +3697,15 @@ AdminModels::EmailVerificationStatus PlayFab::AdminModels::readEmailVerification
 
 AdminModels::EmailVerificationStatus PlayFab::AdminModels::readEmailVerificationStatusFromValue(const FString& value)
 {
-    static TMap<FString, EmailVerificationStatus> _EmailVerificationStatusMap;
-    if (_EmailVerificationStatusMap.Num() == 0)
+    static const TMap<FString, EmailVerificationStatus> _EmailVerificationStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _EmailVerificationStatusMap.Add(TEXT("Unverified"), EmailVerificationStatusUnverified);
-        _EmailVerificationStatusMap.Add(TEXT("Pending"), EmailVerificationStatusPending);
-        _EmailVerificationStatusMap.Add(TEXT("Confirmed"), EmailVerificationStatusConfirmed);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, EmailVerificationStatus> Map;
+        Map.Add(TEXT("Unverified"), EmailVerificationStatusUnverified);
+        Map.Add(TEXT("Pending"), EmailVerificationStatusPending);
+        Map.Add(TEXT("Confirmed"), EmailVerificationStatusConfirmed);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -3909,20 +3896,20 @@ AdminModels::ContinentCode PlayFab::AdminModels::readContinentCodeFromValue(cons
 
 AdminModels::ContinentCode PlayFab::AdminModels::readContinentCodeFromValue(const FString& value)
 {
-    static TMap<FString, ContinentCode> _ContinentCodeMap;
-    if (_ContinentCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _ContinentCodeMap.Add(TEXT("AF"), ContinentCodeAF);
-        _ContinentCodeMap.Add(TEXT("AN"), ContinentCodeAN);
-        _ContinentCodeMap.Add(TEXT("AS"), ContinentCodeAS);
-        _ContinentCodeMap.Add(TEXT("EU"), ContinentCodeEU);
-        _ContinentCodeMap.Add(TEXT("NA"), ContinentCodeNA);
-        _ContinentCodeMap.Add(TEXT("OC"), ContinentCodeOC);
-        _ContinentCodeMap.Add(TEXT("SA"), ContinentCodeSA);
-        _ContinentCodeMap.Add(TEXT("Unknown"), ContinentCodeUnknown);
-
-    }
+    static const TMap<FString, ContinentCode> _ContinentCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ContinentCode> Map;
+        Map.Add(TEXT("AF"), ContinentCodeAF);
+        Map.Add(TEXT("AN"), ContinentCodeAN);
+        Map.Add(TEXT("AS"), ContinentCodeAS);
+        Map.Add(TEXT("EU"), ContinentCodeEU);
+        Map.Add(TEXT("NA"), ContinentCodeNA);
+        Map.Add(TEXT("OC"), ContinentCodeOC);
+        Map.Add(TEXT("SA"), ContinentCodeSA);
+        Map.Add(TEXT("Unknown"), ContinentCodeUnknown);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -4199,262 +4186,262 @@ AdminModels::CountryCode PlayFab::AdminModels::readCountryCodeFromValue(const TS
 
 AdminModels::CountryCode PlayFab::AdminModels::readCountryCodeFromValue(const FString& value)
 {
-    static TMap<FString, CountryCode> _CountryCodeMap;
-    if (_CountryCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _CountryCodeMap.Add(TEXT("AF"), CountryCodeAF);
-        _CountryCodeMap.Add(TEXT("AX"), CountryCodeAX);
-        _CountryCodeMap.Add(TEXT("AL"), CountryCodeAL);
-        _CountryCodeMap.Add(TEXT("DZ"), CountryCodeDZ);
-        _CountryCodeMap.Add(TEXT("AS"), CountryCodeAS);
-        _CountryCodeMap.Add(TEXT("AD"), CountryCodeAD);
-        _CountryCodeMap.Add(TEXT("AO"), CountryCodeAO);
-        _CountryCodeMap.Add(TEXT("AI"), CountryCodeAI);
-        _CountryCodeMap.Add(TEXT("AQ"), CountryCodeAQ);
-        _CountryCodeMap.Add(TEXT("AG"), CountryCodeAG);
-        _CountryCodeMap.Add(TEXT("AR"), CountryCodeAR);
-        _CountryCodeMap.Add(TEXT("AM"), CountryCodeAM);
-        _CountryCodeMap.Add(TEXT("AW"), CountryCodeAW);
-        _CountryCodeMap.Add(TEXT("AU"), CountryCodeAU);
-        _CountryCodeMap.Add(TEXT("AT"), CountryCodeAT);
-        _CountryCodeMap.Add(TEXT("AZ"), CountryCodeAZ);
-        _CountryCodeMap.Add(TEXT("BS"), CountryCodeBS);
-        _CountryCodeMap.Add(TEXT("BH"), CountryCodeBH);
-        _CountryCodeMap.Add(TEXT("BD"), CountryCodeBD);
-        _CountryCodeMap.Add(TEXT("BB"), CountryCodeBB);
-        _CountryCodeMap.Add(TEXT("BY"), CountryCodeBY);
-        _CountryCodeMap.Add(TEXT("BE"), CountryCodeBE);
-        _CountryCodeMap.Add(TEXT("BZ"), CountryCodeBZ);
-        _CountryCodeMap.Add(TEXT("BJ"), CountryCodeBJ);
-        _CountryCodeMap.Add(TEXT("BM"), CountryCodeBM);
-        _CountryCodeMap.Add(TEXT("BT"), CountryCodeBT);
-        _CountryCodeMap.Add(TEXT("BO"), CountryCodeBO);
-        _CountryCodeMap.Add(TEXT("BQ"), CountryCodeBQ);
-        _CountryCodeMap.Add(TEXT("BA"), CountryCodeBA);
-        _CountryCodeMap.Add(TEXT("BW"), CountryCodeBW);
-        _CountryCodeMap.Add(TEXT("BV"), CountryCodeBV);
-        _CountryCodeMap.Add(TEXT("BR"), CountryCodeBR);
-        _CountryCodeMap.Add(TEXT("IO"), CountryCodeIO);
-        _CountryCodeMap.Add(TEXT("BN"), CountryCodeBN);
-        _CountryCodeMap.Add(TEXT("BG"), CountryCodeBG);
-        _CountryCodeMap.Add(TEXT("BF"), CountryCodeBF);
-        _CountryCodeMap.Add(TEXT("BI"), CountryCodeBI);
-        _CountryCodeMap.Add(TEXT("KH"), CountryCodeKH);
-        _CountryCodeMap.Add(TEXT("CM"), CountryCodeCM);
-        _CountryCodeMap.Add(TEXT("CA"), CountryCodeCA);
-        _CountryCodeMap.Add(TEXT("CV"), CountryCodeCV);
-        _CountryCodeMap.Add(TEXT("KY"), CountryCodeKY);
-        _CountryCodeMap.Add(TEXT("CF"), CountryCodeCF);
-        _CountryCodeMap.Add(TEXT("TD"), CountryCodeTD);
-        _CountryCodeMap.Add(TEXT("CL"), CountryCodeCL);
-        _CountryCodeMap.Add(TEXT("CN"), CountryCodeCN);
-        _CountryCodeMap.Add(TEXT("CX"), CountryCodeCX);
-        _CountryCodeMap.Add(TEXT("CC"), CountryCodeCC);
-        _CountryCodeMap.Add(TEXT("CO"), CountryCodeCO);
-        _CountryCodeMap.Add(TEXT("KM"), CountryCodeKM);
-        _CountryCodeMap.Add(TEXT("CG"), CountryCodeCG);
-        _CountryCodeMap.Add(TEXT("CD"), CountryCodeCD);
-        _CountryCodeMap.Add(TEXT("CK"), CountryCodeCK);
-        _CountryCodeMap.Add(TEXT("CR"), CountryCodeCR);
-        _CountryCodeMap.Add(TEXT("CI"), CountryCodeCI);
-        _CountryCodeMap.Add(TEXT("HR"), CountryCodeHR);
-        _CountryCodeMap.Add(TEXT("CU"), CountryCodeCU);
-        _CountryCodeMap.Add(TEXT("CW"), CountryCodeCW);
-        _CountryCodeMap.Add(TEXT("CY"), CountryCodeCY);
-        _CountryCodeMap.Add(TEXT("CZ"), CountryCodeCZ);
-        _CountryCodeMap.Add(TEXT("DK"), CountryCodeDK);
-        _CountryCodeMap.Add(TEXT("DJ"), CountryCodeDJ);
-        _CountryCodeMap.Add(TEXT("DM"), CountryCodeDM);
-        _CountryCodeMap.Add(TEXT("DO"), CountryCodeDO);
-        _CountryCodeMap.Add(TEXT("EC"), CountryCodeEC);
-        _CountryCodeMap.Add(TEXT("EG"), CountryCodeEG);
-        _CountryCodeMap.Add(TEXT("SV"), CountryCodeSV);
-        _CountryCodeMap.Add(TEXT("GQ"), CountryCodeGQ);
-        _CountryCodeMap.Add(TEXT("ER"), CountryCodeER);
-        _CountryCodeMap.Add(TEXT("EE"), CountryCodeEE);
-        _CountryCodeMap.Add(TEXT("ET"), CountryCodeET);
-        _CountryCodeMap.Add(TEXT("FK"), CountryCodeFK);
-        _CountryCodeMap.Add(TEXT("FO"), CountryCodeFO);
-        _CountryCodeMap.Add(TEXT("FJ"), CountryCodeFJ);
-        _CountryCodeMap.Add(TEXT("FI"), CountryCodeFI);
-        _CountryCodeMap.Add(TEXT("FR"), CountryCodeFR);
-        _CountryCodeMap.Add(TEXT("GF"), CountryCodeGF);
-        _CountryCodeMap.Add(TEXT("PF"), CountryCodePF);
-        _CountryCodeMap.Add(TEXT("TF"), CountryCodeTF);
-        _CountryCodeMap.Add(TEXT("GA"), CountryCodeGA);
-        _CountryCodeMap.Add(TEXT("GM"), CountryCodeGM);
-        _CountryCodeMap.Add(TEXT("GE"), CountryCodeGE);
-        _CountryCodeMap.Add(TEXT("DE"), CountryCodeDE);
-        _CountryCodeMap.Add(TEXT("GH"), CountryCodeGH);
-        _CountryCodeMap.Add(TEXT("GI"), CountryCodeGI);
-        _CountryCodeMap.Add(TEXT("GR"), CountryCodeGR);
-        _CountryCodeMap.Add(TEXT("GL"), CountryCodeGL);
-        _CountryCodeMap.Add(TEXT("GD"), CountryCodeGD);
-        _CountryCodeMap.Add(TEXT("GP"), CountryCodeGP);
-        _CountryCodeMap.Add(TEXT("GU"), CountryCodeGU);
-        _CountryCodeMap.Add(TEXT("GT"), CountryCodeGT);
-        _CountryCodeMap.Add(TEXT("GG"), CountryCodeGG);
-        _CountryCodeMap.Add(TEXT("GN"), CountryCodeGN);
-        _CountryCodeMap.Add(TEXT("GW"), CountryCodeGW);
-        _CountryCodeMap.Add(TEXT("GY"), CountryCodeGY);
-        _CountryCodeMap.Add(TEXT("HT"), CountryCodeHT);
-        _CountryCodeMap.Add(TEXT("HM"), CountryCodeHM);
-        _CountryCodeMap.Add(TEXT("VA"), CountryCodeVA);
-        _CountryCodeMap.Add(TEXT("HN"), CountryCodeHN);
-        _CountryCodeMap.Add(TEXT("HK"), CountryCodeHK);
-        _CountryCodeMap.Add(TEXT("HU"), CountryCodeHU);
-        _CountryCodeMap.Add(TEXT("IS"), CountryCodeIS);
-        _CountryCodeMap.Add(TEXT("IN"), CountryCodeIN);
-        _CountryCodeMap.Add(TEXT("ID"), CountryCodeID);
-        _CountryCodeMap.Add(TEXT("IR"), CountryCodeIR);
-        _CountryCodeMap.Add(TEXT("IQ"), CountryCodeIQ);
-        _CountryCodeMap.Add(TEXT("IE"), CountryCodeIE);
-        _CountryCodeMap.Add(TEXT("IM"), CountryCodeIM);
-        _CountryCodeMap.Add(TEXT("IL"), CountryCodeIL);
-        _CountryCodeMap.Add(TEXT("IT"), CountryCodeIT);
-        _CountryCodeMap.Add(TEXT("JM"), CountryCodeJM);
-        _CountryCodeMap.Add(TEXT("JP"), CountryCodeJP);
-        _CountryCodeMap.Add(TEXT("JE"), CountryCodeJE);
-        _CountryCodeMap.Add(TEXT("JO"), CountryCodeJO);
-        _CountryCodeMap.Add(TEXT("KZ"), CountryCodeKZ);
-        _CountryCodeMap.Add(TEXT("KE"), CountryCodeKE);
-        _CountryCodeMap.Add(TEXT("KI"), CountryCodeKI);
-        _CountryCodeMap.Add(TEXT("KP"), CountryCodeKP);
-        _CountryCodeMap.Add(TEXT("KR"), CountryCodeKR);
-        _CountryCodeMap.Add(TEXT("KW"), CountryCodeKW);
-        _CountryCodeMap.Add(TEXT("KG"), CountryCodeKG);
-        _CountryCodeMap.Add(TEXT("LA"), CountryCodeLA);
-        _CountryCodeMap.Add(TEXT("LV"), CountryCodeLV);
-        _CountryCodeMap.Add(TEXT("LB"), CountryCodeLB);
-        _CountryCodeMap.Add(TEXT("LS"), CountryCodeLS);
-        _CountryCodeMap.Add(TEXT("LR"), CountryCodeLR);
-        _CountryCodeMap.Add(TEXT("LY"), CountryCodeLY);
-        _CountryCodeMap.Add(TEXT("LI"), CountryCodeLI);
-        _CountryCodeMap.Add(TEXT("LT"), CountryCodeLT);
-        _CountryCodeMap.Add(TEXT("LU"), CountryCodeLU);
-        _CountryCodeMap.Add(TEXT("MO"), CountryCodeMO);
-        _CountryCodeMap.Add(TEXT("MK"), CountryCodeMK);
-        _CountryCodeMap.Add(TEXT("MG"), CountryCodeMG);
-        _CountryCodeMap.Add(TEXT("MW"), CountryCodeMW);
-        _CountryCodeMap.Add(TEXT("MY"), CountryCodeMY);
-        _CountryCodeMap.Add(TEXT("MV"), CountryCodeMV);
-        _CountryCodeMap.Add(TEXT("ML"), CountryCodeML);
-        _CountryCodeMap.Add(TEXT("MT"), CountryCodeMT);
-        _CountryCodeMap.Add(TEXT("MH"), CountryCodeMH);
-        _CountryCodeMap.Add(TEXT("MQ"), CountryCodeMQ);
-        _CountryCodeMap.Add(TEXT("MR"), CountryCodeMR);
-        _CountryCodeMap.Add(TEXT("MU"), CountryCodeMU);
-        _CountryCodeMap.Add(TEXT("YT"), CountryCodeYT);
-        _CountryCodeMap.Add(TEXT("MX"), CountryCodeMX);
-        _CountryCodeMap.Add(TEXT("FM"), CountryCodeFM);
-        _CountryCodeMap.Add(TEXT("MD"), CountryCodeMD);
-        _CountryCodeMap.Add(TEXT("MC"), CountryCodeMC);
-        _CountryCodeMap.Add(TEXT("MN"), CountryCodeMN);
-        _CountryCodeMap.Add(TEXT("ME"), CountryCodeME);
-        _CountryCodeMap.Add(TEXT("MS"), CountryCodeMS);
-        _CountryCodeMap.Add(TEXT("MA"), CountryCodeMA);
-        _CountryCodeMap.Add(TEXT("MZ"), CountryCodeMZ);
-        _CountryCodeMap.Add(TEXT("MM"), CountryCodeMM);
-        _CountryCodeMap.Add(TEXT("NA"), CountryCodeNA);
-        _CountryCodeMap.Add(TEXT("NR"), CountryCodeNR);
-        _CountryCodeMap.Add(TEXT("NP"), CountryCodeNP);
-        _CountryCodeMap.Add(TEXT("NL"), CountryCodeNL);
-        _CountryCodeMap.Add(TEXT("NC"), CountryCodeNC);
-        _CountryCodeMap.Add(TEXT("NZ"), CountryCodeNZ);
-        _CountryCodeMap.Add(TEXT("NI"), CountryCodeNI);
-        _CountryCodeMap.Add(TEXT("NE"), CountryCodeNE);
-        _CountryCodeMap.Add(TEXT("NG"), CountryCodeNG);
-        _CountryCodeMap.Add(TEXT("NU"), CountryCodeNU);
-        _CountryCodeMap.Add(TEXT("NF"), CountryCodeNF);
-        _CountryCodeMap.Add(TEXT("MP"), CountryCodeMP);
-        _CountryCodeMap.Add(TEXT("NO"), CountryCodeNO);
-        _CountryCodeMap.Add(TEXT("OM"), CountryCodeOM);
-        _CountryCodeMap.Add(TEXT("PK"), CountryCodePK);
-        _CountryCodeMap.Add(TEXT("PW"), CountryCodePW);
-        _CountryCodeMap.Add(TEXT("PS"), CountryCodePS);
-        _CountryCodeMap.Add(TEXT("PA"), CountryCodePA);
-        _CountryCodeMap.Add(TEXT("PG"), CountryCodePG);
-        _CountryCodeMap.Add(TEXT("PY"), CountryCodePY);
-        _CountryCodeMap.Add(TEXT("PE"), CountryCodePE);
-        _CountryCodeMap.Add(TEXT("PH"), CountryCodePH);
-        _CountryCodeMap.Add(TEXT("PN"), CountryCodePN);
-        _CountryCodeMap.Add(TEXT("PL"), CountryCodePL);
-        _CountryCodeMap.Add(TEXT("PT"), CountryCodePT);
-        _CountryCodeMap.Add(TEXT("PR"), CountryCodePR);
-        _CountryCodeMap.Add(TEXT("QA"), CountryCodeQA);
-        _CountryCodeMap.Add(TEXT("RE"), CountryCodeRE);
-        _CountryCodeMap.Add(TEXT("RO"), CountryCodeRO);
-        _CountryCodeMap.Add(TEXT("RU"), CountryCodeRU);
-        _CountryCodeMap.Add(TEXT("RW"), CountryCodeRW);
-        _CountryCodeMap.Add(TEXT("BL"), CountryCodeBL);
-        _CountryCodeMap.Add(TEXT("SH"), CountryCodeSH);
-        _CountryCodeMap.Add(TEXT("KN"), CountryCodeKN);
-        _CountryCodeMap.Add(TEXT("LC"), CountryCodeLC);
-        _CountryCodeMap.Add(TEXT("MF"), CountryCodeMF);
-        _CountryCodeMap.Add(TEXT("PM"), CountryCodePM);
-        _CountryCodeMap.Add(TEXT("VC"), CountryCodeVC);
-        _CountryCodeMap.Add(TEXT("WS"), CountryCodeWS);
-        _CountryCodeMap.Add(TEXT("SM"), CountryCodeSM);
-        _CountryCodeMap.Add(TEXT("ST"), CountryCodeST);
-        _CountryCodeMap.Add(TEXT("SA"), CountryCodeSA);
-        _CountryCodeMap.Add(TEXT("SN"), CountryCodeSN);
-        _CountryCodeMap.Add(TEXT("RS"), CountryCodeRS);
-        _CountryCodeMap.Add(TEXT("SC"), CountryCodeSC);
-        _CountryCodeMap.Add(TEXT("SL"), CountryCodeSL);
-        _CountryCodeMap.Add(TEXT("SG"), CountryCodeSG);
-        _CountryCodeMap.Add(TEXT("SX"), CountryCodeSX);
-        _CountryCodeMap.Add(TEXT("SK"), CountryCodeSK);
-        _CountryCodeMap.Add(TEXT("SI"), CountryCodeSI);
-        _CountryCodeMap.Add(TEXT("SB"), CountryCodeSB);
-        _CountryCodeMap.Add(TEXT("SO"), CountryCodeSO);
-        _CountryCodeMap.Add(TEXT("ZA"), CountryCodeZA);
-        _CountryCodeMap.Add(TEXT("GS"), CountryCodeGS);
-        _CountryCodeMap.Add(TEXT("SS"), CountryCodeSS);
-        _CountryCodeMap.Add(TEXT("ES"), CountryCodeES);
-        _CountryCodeMap.Add(TEXT("LK"), CountryCodeLK);
-        _CountryCodeMap.Add(TEXT("SD"), CountryCodeSD);
-        _CountryCodeMap.Add(TEXT("SR"), CountryCodeSR);
-        _CountryCodeMap.Add(TEXT("SJ"), CountryCodeSJ);
-        _CountryCodeMap.Add(TEXT("SZ"), CountryCodeSZ);
-        _CountryCodeMap.Add(TEXT("SE"), CountryCodeSE);
-        _CountryCodeMap.Add(TEXT("CH"), CountryCodeCH);
-        _CountryCodeMap.Add(TEXT("SY"), CountryCodeSY);
-        _CountryCodeMap.Add(TEXT("TW"), CountryCodeTW);
-        _CountryCodeMap.Add(TEXT("TJ"), CountryCodeTJ);
-        _CountryCodeMap.Add(TEXT("TZ"), CountryCodeTZ);
-        _CountryCodeMap.Add(TEXT("TH"), CountryCodeTH);
-        _CountryCodeMap.Add(TEXT("TL"), CountryCodeTL);
-        _CountryCodeMap.Add(TEXT("TG"), CountryCodeTG);
-        _CountryCodeMap.Add(TEXT("TK"), CountryCodeTK);
-        _CountryCodeMap.Add(TEXT("TO"), CountryCodeTO);
-        _CountryCodeMap.Add(TEXT("TT"), CountryCodeTT);
-        _CountryCodeMap.Add(TEXT("TN"), CountryCodeTN);
-        _CountryCodeMap.Add(TEXT("TR"), CountryCodeTR);
-        _CountryCodeMap.Add(TEXT("TM"), CountryCodeTM);
-        _CountryCodeMap.Add(TEXT("TC"), CountryCodeTC);
-        _CountryCodeMap.Add(TEXT("TV"), CountryCodeTV);
-        _CountryCodeMap.Add(TEXT("UG"), CountryCodeUG);
-        _CountryCodeMap.Add(TEXT("UA"), CountryCodeUA);
-        _CountryCodeMap.Add(TEXT("AE"), CountryCodeAE);
-        _CountryCodeMap.Add(TEXT("GB"), CountryCodeGB);
-        _CountryCodeMap.Add(TEXT("US"), CountryCodeUS);
-        _CountryCodeMap.Add(TEXT("UM"), CountryCodeUM);
-        _CountryCodeMap.Add(TEXT("UY"), CountryCodeUY);
-        _CountryCodeMap.Add(TEXT("UZ"), CountryCodeUZ);
-        _CountryCodeMap.Add(TEXT("VU"), CountryCodeVU);
-        _CountryCodeMap.Add(TEXT("VE"), CountryCodeVE);
-        _CountryCodeMap.Add(TEXT("VN"), CountryCodeVN);
-        _CountryCodeMap.Add(TEXT("VG"), CountryCodeVG);
-        _CountryCodeMap.Add(TEXT("VI"), CountryCodeVI);
-        _CountryCodeMap.Add(TEXT("WF"), CountryCodeWF);
-        _CountryCodeMap.Add(TEXT("EH"), CountryCodeEH);
-        _CountryCodeMap.Add(TEXT("YE"), CountryCodeYE);
-        _CountryCodeMap.Add(TEXT("ZM"), CountryCodeZM);
-        _CountryCodeMap.Add(TEXT("ZW"), CountryCodeZW);
-        _CountryCodeMap.Add(TEXT("Unknown"), CountryCodeUnknown);
-
-    }
+    static const TMap<FString, CountryCode> _CountryCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, CountryCode> Map;
+        Map.Add(TEXT("AF"), CountryCodeAF);
+        Map.Add(TEXT("AX"), CountryCodeAX);
+        Map.Add(TEXT("AL"), CountryCodeAL);
+        Map.Add(TEXT("DZ"), CountryCodeDZ);
+        Map.Add(TEXT("AS"), CountryCodeAS);
+        Map.Add(TEXT("AD"), CountryCodeAD);
+        Map.Add(TEXT("AO"), CountryCodeAO);
+        Map.Add(TEXT("AI"), CountryCodeAI);
+        Map.Add(TEXT("AQ"), CountryCodeAQ);
+        Map.Add(TEXT("AG"), CountryCodeAG);
+        Map.Add(TEXT("AR"), CountryCodeAR);
+        Map.Add(TEXT("AM"), CountryCodeAM);
+        Map.Add(TEXT("AW"), CountryCodeAW);
+        Map.Add(TEXT("AU"), CountryCodeAU);
+        Map.Add(TEXT("AT"), CountryCodeAT);
+        Map.Add(TEXT("AZ"), CountryCodeAZ);
+        Map.Add(TEXT("BS"), CountryCodeBS);
+        Map.Add(TEXT("BH"), CountryCodeBH);
+        Map.Add(TEXT("BD"), CountryCodeBD);
+        Map.Add(TEXT("BB"), CountryCodeBB);
+        Map.Add(TEXT("BY"), CountryCodeBY);
+        Map.Add(TEXT("BE"), CountryCodeBE);
+        Map.Add(TEXT("BZ"), CountryCodeBZ);
+        Map.Add(TEXT("BJ"), CountryCodeBJ);
+        Map.Add(TEXT("BM"), CountryCodeBM);
+        Map.Add(TEXT("BT"), CountryCodeBT);
+        Map.Add(TEXT("BO"), CountryCodeBO);
+        Map.Add(TEXT("BQ"), CountryCodeBQ);
+        Map.Add(TEXT("BA"), CountryCodeBA);
+        Map.Add(TEXT("BW"), CountryCodeBW);
+        Map.Add(TEXT("BV"), CountryCodeBV);
+        Map.Add(TEXT("BR"), CountryCodeBR);
+        Map.Add(TEXT("IO"), CountryCodeIO);
+        Map.Add(TEXT("BN"), CountryCodeBN);
+        Map.Add(TEXT("BG"), CountryCodeBG);
+        Map.Add(TEXT("BF"), CountryCodeBF);
+        Map.Add(TEXT("BI"), CountryCodeBI);
+        Map.Add(TEXT("KH"), CountryCodeKH);
+        Map.Add(TEXT("CM"), CountryCodeCM);
+        Map.Add(TEXT("CA"), CountryCodeCA);
+        Map.Add(TEXT("CV"), CountryCodeCV);
+        Map.Add(TEXT("KY"), CountryCodeKY);
+        Map.Add(TEXT("CF"), CountryCodeCF);
+        Map.Add(TEXT("TD"), CountryCodeTD);
+        Map.Add(TEXT("CL"), CountryCodeCL);
+        Map.Add(TEXT("CN"), CountryCodeCN);
+        Map.Add(TEXT("CX"), CountryCodeCX);
+        Map.Add(TEXT("CC"), CountryCodeCC);
+        Map.Add(TEXT("CO"), CountryCodeCO);
+        Map.Add(TEXT("KM"), CountryCodeKM);
+        Map.Add(TEXT("CG"), CountryCodeCG);
+        Map.Add(TEXT("CD"), CountryCodeCD);
+        Map.Add(TEXT("CK"), CountryCodeCK);
+        Map.Add(TEXT("CR"), CountryCodeCR);
+        Map.Add(TEXT("CI"), CountryCodeCI);
+        Map.Add(TEXT("HR"), CountryCodeHR);
+        Map.Add(TEXT("CU"), CountryCodeCU);
+        Map.Add(TEXT("CW"), CountryCodeCW);
+        Map.Add(TEXT("CY"), CountryCodeCY);
+        Map.Add(TEXT("CZ"), CountryCodeCZ);
+        Map.Add(TEXT("DK"), CountryCodeDK);
+        Map.Add(TEXT("DJ"), CountryCodeDJ);
+        Map.Add(TEXT("DM"), CountryCodeDM);
+        Map.Add(TEXT("DO"), CountryCodeDO);
+        Map.Add(TEXT("EC"), CountryCodeEC);
+        Map.Add(TEXT("EG"), CountryCodeEG);
+        Map.Add(TEXT("SV"), CountryCodeSV);
+        Map.Add(TEXT("GQ"), CountryCodeGQ);
+        Map.Add(TEXT("ER"), CountryCodeER);
+        Map.Add(TEXT("EE"), CountryCodeEE);
+        Map.Add(TEXT("ET"), CountryCodeET);
+        Map.Add(TEXT("FK"), CountryCodeFK);
+        Map.Add(TEXT("FO"), CountryCodeFO);
+        Map.Add(TEXT("FJ"), CountryCodeFJ);
+        Map.Add(TEXT("FI"), CountryCodeFI);
+        Map.Add(TEXT("FR"), CountryCodeFR);
+        Map.Add(TEXT("GF"), CountryCodeGF);
+        Map.Add(TEXT("PF"), CountryCodePF);
+        Map.Add(TEXT("TF"), CountryCodeTF);
+        Map.Add(TEXT("GA"), CountryCodeGA);
+        Map.Add(TEXT("GM"), CountryCodeGM);
+        Map.Add(TEXT("GE"), CountryCodeGE);
+        Map.Add(TEXT("DE"), CountryCodeDE);
+        Map.Add(TEXT("GH"), CountryCodeGH);
+        Map.Add(TEXT("GI"), CountryCodeGI);
+        Map.Add(TEXT("GR"), CountryCodeGR);
+        Map.Add(TEXT("GL"), CountryCodeGL);
+        Map.Add(TEXT("GD"), CountryCodeGD);
+        Map.Add(TEXT("GP"), CountryCodeGP);
+        Map.Add(TEXT("GU"), CountryCodeGU);
+        Map.Add(TEXT("GT"), CountryCodeGT);
+        Map.Add(TEXT("GG"), CountryCodeGG);
+        Map.Add(TEXT("GN"), CountryCodeGN);
+        Map.Add(TEXT("GW"), CountryCodeGW);
+        Map.Add(TEXT("GY"), CountryCodeGY);
+        Map.Add(TEXT("HT"), CountryCodeHT);
+        Map.Add(TEXT("HM"), CountryCodeHM);
+        Map.Add(TEXT("VA"), CountryCodeVA);
+        Map.Add(TEXT("HN"), CountryCodeHN);
+        Map.Add(TEXT("HK"), CountryCodeHK);
+        Map.Add(TEXT("HU"), CountryCodeHU);
+        Map.Add(TEXT("IS"), CountryCodeIS);
+        Map.Add(TEXT("IN"), CountryCodeIN);
+        Map.Add(TEXT("ID"), CountryCodeID);
+        Map.Add(TEXT("IR"), CountryCodeIR);
+        Map.Add(TEXT("IQ"), CountryCodeIQ);
+        Map.Add(TEXT("IE"), CountryCodeIE);
+        Map.Add(TEXT("IM"), CountryCodeIM);
+        Map.Add(TEXT("IL"), CountryCodeIL);
+        Map.Add(TEXT("IT"), CountryCodeIT);
+        Map.Add(TEXT("JM"), CountryCodeJM);
+        Map.Add(TEXT("JP"), CountryCodeJP);
+        Map.Add(TEXT("JE"), CountryCodeJE);
+        Map.Add(TEXT("JO"), CountryCodeJO);
+        Map.Add(TEXT("KZ"), CountryCodeKZ);
+        Map.Add(TEXT("KE"), CountryCodeKE);
+        Map.Add(TEXT("KI"), CountryCodeKI);
+        Map.Add(TEXT("KP"), CountryCodeKP);
+        Map.Add(TEXT("KR"), CountryCodeKR);
+        Map.Add(TEXT("KW"), CountryCodeKW);
+        Map.Add(TEXT("KG"), CountryCodeKG);
+        Map.Add(TEXT("LA"), CountryCodeLA);
+        Map.Add(TEXT("LV"), CountryCodeLV);
+        Map.Add(TEXT("LB"), CountryCodeLB);
+        Map.Add(TEXT("LS"), CountryCodeLS);
+        Map.Add(TEXT("LR"), CountryCodeLR);
+        Map.Add(TEXT("LY"), CountryCodeLY);
+        Map.Add(TEXT("LI"), CountryCodeLI);
+        Map.Add(TEXT("LT"), CountryCodeLT);
+        Map.Add(TEXT("LU"), CountryCodeLU);
+        Map.Add(TEXT("MO"), CountryCodeMO);
+        Map.Add(TEXT("MK"), CountryCodeMK);
+        Map.Add(TEXT("MG"), CountryCodeMG);
+        Map.Add(TEXT("MW"), CountryCodeMW);
+        Map.Add(TEXT("MY"), CountryCodeMY);
+        Map.Add(TEXT("MV"), CountryCodeMV);
+        Map.Add(TEXT("ML"), CountryCodeML);
+        Map.Add(TEXT("MT"), CountryCodeMT);
+        Map.Add(TEXT("MH"), CountryCodeMH);
+        Map.Add(TEXT("MQ"), CountryCodeMQ);
+        Map.Add(TEXT("MR"), CountryCodeMR);
+        Map.Add(TEXT("MU"), CountryCodeMU);
+        Map.Add(TEXT("YT"), CountryCodeYT);
+        Map.Add(TEXT("MX"), CountryCodeMX);
+        Map.Add(TEXT("FM"), CountryCodeFM);
+        Map.Add(TEXT("MD"), CountryCodeMD);
+        Map.Add(TEXT("MC"), CountryCodeMC);
+        Map.Add(TEXT("MN"), CountryCodeMN);
+        Map.Add(TEXT("ME"), CountryCodeME);
+        Map.Add(TEXT("MS"), CountryCodeMS);
+        Map.Add(TEXT("MA"), CountryCodeMA);
+        Map.Add(TEXT("MZ"), CountryCodeMZ);
+        Map.Add(TEXT("MM"), CountryCodeMM);
+        Map.Add(TEXT("NA"), CountryCodeNA);
+        Map.Add(TEXT("NR"), CountryCodeNR);
+        Map.Add(TEXT("NP"), CountryCodeNP);
+        Map.Add(TEXT("NL"), CountryCodeNL);
+        Map.Add(TEXT("NC"), CountryCodeNC);
+        Map.Add(TEXT("NZ"), CountryCodeNZ);
+        Map.Add(TEXT("NI"), CountryCodeNI);
+        Map.Add(TEXT("NE"), CountryCodeNE);
+        Map.Add(TEXT("NG"), CountryCodeNG);
+        Map.Add(TEXT("NU"), CountryCodeNU);
+        Map.Add(TEXT("NF"), CountryCodeNF);
+        Map.Add(TEXT("MP"), CountryCodeMP);
+        Map.Add(TEXT("NO"), CountryCodeNO);
+        Map.Add(TEXT("OM"), CountryCodeOM);
+        Map.Add(TEXT("PK"), CountryCodePK);
+        Map.Add(TEXT("PW"), CountryCodePW);
+        Map.Add(TEXT("PS"), CountryCodePS);
+        Map.Add(TEXT("PA"), CountryCodePA);
+        Map.Add(TEXT("PG"), CountryCodePG);
+        Map.Add(TEXT("PY"), CountryCodePY);
+        Map.Add(TEXT("PE"), CountryCodePE);
+        Map.Add(TEXT("PH"), CountryCodePH);
+        Map.Add(TEXT("PN"), CountryCodePN);
+        Map.Add(TEXT("PL"), CountryCodePL);
+        Map.Add(TEXT("PT"), CountryCodePT);
+        Map.Add(TEXT("PR"), CountryCodePR);
+        Map.Add(TEXT("QA"), CountryCodeQA);
+        Map.Add(TEXT("RE"), CountryCodeRE);
+        Map.Add(TEXT("RO"), CountryCodeRO);
+        Map.Add(TEXT("RU"), CountryCodeRU);
+        Map.Add(TEXT("RW"), CountryCodeRW);
+        Map.Add(TEXT("BL"), CountryCodeBL);
+        Map.Add(TEXT("SH"), CountryCodeSH);
+        Map.Add(TEXT("KN"), CountryCodeKN);
+        Map.Add(TEXT("LC"), CountryCodeLC);
+        Map.Add(TEXT("MF"), CountryCodeMF);
+        Map.Add(TEXT("PM"), CountryCodePM);
+        Map.Add(TEXT("VC"), CountryCodeVC);
+        Map.Add(TEXT("WS"), CountryCodeWS);
+        Map.Add(TEXT("SM"), CountryCodeSM);
+        Map.Add(TEXT("ST"), CountryCodeST);
+        Map.Add(TEXT("SA"), CountryCodeSA);
+        Map.Add(TEXT("SN"), CountryCodeSN);
+        Map.Add(TEXT("RS"), CountryCodeRS);
+        Map.Add(TEXT("SC"), CountryCodeSC);
+        Map.Add(TEXT("SL"), CountryCodeSL);
+        Map.Add(TEXT("SG"), CountryCodeSG);
+        Map.Add(TEXT("SX"), CountryCodeSX);
+        Map.Add(TEXT("SK"), CountryCodeSK);
+        Map.Add(TEXT("SI"), CountryCodeSI);
+        Map.Add(TEXT("SB"), CountryCodeSB);
+        Map.Add(TEXT("SO"), CountryCodeSO);
+        Map.Add(TEXT("ZA"), CountryCodeZA);
+        Map.Add(TEXT("GS"), CountryCodeGS);
+        Map.Add(TEXT("SS"), CountryCodeSS);
+        Map.Add(TEXT("ES"), CountryCodeES);
+        Map.Add(TEXT("LK"), CountryCodeLK);
+        Map.Add(TEXT("SD"), CountryCodeSD);
+        Map.Add(TEXT("SR"), CountryCodeSR);
+        Map.Add(TEXT("SJ"), CountryCodeSJ);
+        Map.Add(TEXT("SZ"), CountryCodeSZ);
+        Map.Add(TEXT("SE"), CountryCodeSE);
+        Map.Add(TEXT("CH"), CountryCodeCH);
+        Map.Add(TEXT("SY"), CountryCodeSY);
+        Map.Add(TEXT("TW"), CountryCodeTW);
+        Map.Add(TEXT("TJ"), CountryCodeTJ);
+        Map.Add(TEXT("TZ"), CountryCodeTZ);
+        Map.Add(TEXT("TH"), CountryCodeTH);
+        Map.Add(TEXT("TL"), CountryCodeTL);
+        Map.Add(TEXT("TG"), CountryCodeTG);
+        Map.Add(TEXT("TK"), CountryCodeTK);
+        Map.Add(TEXT("TO"), CountryCodeTO);
+        Map.Add(TEXT("TT"), CountryCodeTT);
+        Map.Add(TEXT("TN"), CountryCodeTN);
+        Map.Add(TEXT("TR"), CountryCodeTR);
+        Map.Add(TEXT("TM"), CountryCodeTM);
+        Map.Add(TEXT("TC"), CountryCodeTC);
+        Map.Add(TEXT("TV"), CountryCodeTV);
+        Map.Add(TEXT("UG"), CountryCodeUG);
+        Map.Add(TEXT("UA"), CountryCodeUA);
+        Map.Add(TEXT("AE"), CountryCodeAE);
+        Map.Add(TEXT("GB"), CountryCodeGB);
+        Map.Add(TEXT("US"), CountryCodeUS);
+        Map.Add(TEXT("UM"), CountryCodeUM);
+        Map.Add(TEXT("UY"), CountryCodeUY);
+        Map.Add(TEXT("UZ"), CountryCodeUZ);
+        Map.Add(TEXT("VU"), CountryCodeVU);
+        Map.Add(TEXT("VE"), CountryCodeVE);
+        Map.Add(TEXT("VN"), CountryCodeVN);
+        Map.Add(TEXT("VG"), CountryCodeVG);
+        Map.Add(TEXT("VI"), CountryCodeVI);
+        Map.Add(TEXT("WF"), CountryCodeWF);
+        Map.Add(TEXT("EH"), CountryCodeEH);
+        Map.Add(TEXT("YE"), CountryCodeYE);
+        Map.Add(TEXT("ZM"), CountryCodeZM);
+        Map.Add(TEXT("ZW"), CountryCodeZW);
+        Map.Add(TEXT("Unknown"), CountryCodeUnknown);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -4524,6 +4511,7 @@ bool PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4625,6 +4613,7 @@ bool PlayFab::AdminModels::FCreateCloudScriptTaskRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4755,6 +4744,7 @@ bool PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::readFromV
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5082,16 +5072,16 @@ AdminModels::StatisticAggregationMethod PlayFab::AdminModels::readStatisticAggre
 
 AdminModels::StatisticAggregationMethod PlayFab::AdminModels::readStatisticAggregationMethodFromValue(const FString& value)
 {
-    static TMap<FString, StatisticAggregationMethod> _StatisticAggregationMethodMap;
-    if (_StatisticAggregationMethodMap.Num() == 0)
+    static const TMap<FString, StatisticAggregationMethod> _StatisticAggregationMethodMap = []()
     {
-        // Auto-generate the map on the first use
-        _StatisticAggregationMethodMap.Add(TEXT("Last"), StatisticAggregationMethodLast);
-        _StatisticAggregationMethodMap.Add(TEXT("Min"), StatisticAggregationMethodMin);
-        _StatisticAggregationMethodMap.Add(TEXT("Max"), StatisticAggregationMethodMax);
-        _StatisticAggregationMethodMap.Add(TEXT("Sum"), StatisticAggregationMethodSum);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, StatisticAggregationMethod> Map;
+        Map.Add(TEXT("Last"), StatisticAggregationMethodLast);
+        Map.Add(TEXT("Min"), StatisticAggregationMethodMin);
+        Map.Add(TEXT("Max"), StatisticAggregationMethodMax);
+        Map.Add(TEXT("Sum"), StatisticAggregationMethodSum);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -5123,17 +5113,17 @@ AdminModels::StatisticResetIntervalOption PlayFab::AdminModels::readStatisticRes
 
 AdminModels::StatisticResetIntervalOption PlayFab::AdminModels::readStatisticResetIntervalOptionFromValue(const FString& value)
 {
-    static TMap<FString, StatisticResetIntervalOption> _StatisticResetIntervalOptionMap;
-    if (_StatisticResetIntervalOptionMap.Num() == 0)
+    static const TMap<FString, StatisticResetIntervalOption> _StatisticResetIntervalOptionMap = []()
     {
-        // Auto-generate the map on the first use
-        _StatisticResetIntervalOptionMap.Add(TEXT("Never"), StatisticResetIntervalOptionNever);
-        _StatisticResetIntervalOptionMap.Add(TEXT("Hour"), StatisticResetIntervalOptionHour);
-        _StatisticResetIntervalOptionMap.Add(TEXT("Day"), StatisticResetIntervalOptionDay);
-        _StatisticResetIntervalOptionMap.Add(TEXT("Week"), StatisticResetIntervalOptionWeek);
-        _StatisticResetIntervalOptionMap.Add(TEXT("Month"), StatisticResetIntervalOptionMonth);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, StatisticResetIntervalOption> Map;
+        Map.Add(TEXT("Never"), StatisticResetIntervalOptionNever);
+        Map.Add(TEXT("Hour"), StatisticResetIntervalOptionHour);
+        Map.Add(TEXT("Day"), StatisticResetIntervalOptionDay);
+        Map.Add(TEXT("Week"), StatisticResetIntervalOptionWeek);
+        Map.Add(TEXT("Month"), StatisticResetIntervalOptionMonth);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -5199,6 +5189,7 @@ bool PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6407,34 +6398,34 @@ AdminModels::SegmentLoginIdentityProvider PlayFab::AdminModels::readSegmentLogin
 
 AdminModels::SegmentLoginIdentityProvider PlayFab::AdminModels::readSegmentLoginIdentityProviderFromValue(const FString& value)
 {
-    static TMap<FString, SegmentLoginIdentityProvider> _SegmentLoginIdentityProviderMap;
-    if (_SegmentLoginIdentityProviderMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _SegmentLoginIdentityProviderMap.Add(TEXT("Unknown"), SegmentLoginIdentityProviderUnknown);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("PlayFab"), SegmentLoginIdentityProviderPlayFab);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("Custom"), SegmentLoginIdentityProviderCustom);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("GameCenter"), SegmentLoginIdentityProviderGameCenter);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("GooglePlay"), SegmentLoginIdentityProviderGooglePlay);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("Steam"), SegmentLoginIdentityProviderSteam);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("XBoxLive"), SegmentLoginIdentityProviderXBoxLive);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("PSN"), SegmentLoginIdentityProviderPSN);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("Kongregate"), SegmentLoginIdentityProviderKongregate);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("Facebook"), SegmentLoginIdentityProviderFacebook);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("IOSDevice"), SegmentLoginIdentityProviderIOSDevice);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("AndroidDevice"), SegmentLoginIdentityProviderAndroidDevice);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("Twitch"), SegmentLoginIdentityProviderTwitch);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("WindowsHello"), SegmentLoginIdentityProviderWindowsHello);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("GameServer"), SegmentLoginIdentityProviderGameServer);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("CustomServer"), SegmentLoginIdentityProviderCustomServer);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("NintendoSwitch"), SegmentLoginIdentityProviderNintendoSwitch);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("FacebookInstantGames"), SegmentLoginIdentityProviderFacebookInstantGames);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("OpenIdConnect"), SegmentLoginIdentityProviderOpenIdConnect);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("Apple"), SegmentLoginIdentityProviderApple);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("NintendoSwitchAccount"), SegmentLoginIdentityProviderNintendoSwitchAccount);
-        _SegmentLoginIdentityProviderMap.Add(TEXT("GooglePlayGames"), SegmentLoginIdentityProviderGooglePlayGames);
-
-    }
+    static const TMap<FString, SegmentLoginIdentityProvider> _SegmentLoginIdentityProviderMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SegmentLoginIdentityProvider> Map;
+        Map.Add(TEXT("Unknown"), SegmentLoginIdentityProviderUnknown);
+        Map.Add(TEXT("PlayFab"), SegmentLoginIdentityProviderPlayFab);
+        Map.Add(TEXT("Custom"), SegmentLoginIdentityProviderCustom);
+        Map.Add(TEXT("GameCenter"), SegmentLoginIdentityProviderGameCenter);
+        Map.Add(TEXT("GooglePlay"), SegmentLoginIdentityProviderGooglePlay);
+        Map.Add(TEXT("Steam"), SegmentLoginIdentityProviderSteam);
+        Map.Add(TEXT("XBoxLive"), SegmentLoginIdentityProviderXBoxLive);
+        Map.Add(TEXT("PSN"), SegmentLoginIdentityProviderPSN);
+        Map.Add(TEXT("Kongregate"), SegmentLoginIdentityProviderKongregate);
+        Map.Add(TEXT("Facebook"), SegmentLoginIdentityProviderFacebook);
+        Map.Add(TEXT("IOSDevice"), SegmentLoginIdentityProviderIOSDevice);
+        Map.Add(TEXT("AndroidDevice"), SegmentLoginIdentityProviderAndroidDevice);
+        Map.Add(TEXT("Twitch"), SegmentLoginIdentityProviderTwitch);
+        Map.Add(TEXT("WindowsHello"), SegmentLoginIdentityProviderWindowsHello);
+        Map.Add(TEXT("GameServer"), SegmentLoginIdentityProviderGameServer);
+        Map.Add(TEXT("CustomServer"), SegmentLoginIdentityProviderCustomServer);
+        Map.Add(TEXT("NintendoSwitch"), SegmentLoginIdentityProviderNintendoSwitch);
+        Map.Add(TEXT("FacebookInstantGames"), SegmentLoginIdentityProviderFacebookInstantGames);
+        Map.Add(TEXT("OpenIdConnect"), SegmentLoginIdentityProviderOpenIdConnect);
+        Map.Add(TEXT("Apple"), SegmentLoginIdentityProviderApple);
+        Map.Add(TEXT("NintendoSwitchAccount"), SegmentLoginIdentityProviderNintendoSwitchAccount);
+        Map.Add(TEXT("GooglePlayGames"), SegmentLoginIdentityProviderGooglePlayGames);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6772,261 +6763,261 @@ AdminModels::SegmentCountryCode PlayFab::AdminModels::readSegmentCountryCodeFrom
 
 AdminModels::SegmentCountryCode PlayFab::AdminModels::readSegmentCountryCodeFromValue(const FString& value)
 {
-    static TMap<FString, SegmentCountryCode> _SegmentCountryCodeMap;
-    if (_SegmentCountryCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _SegmentCountryCodeMap.Add(TEXT("AF"), SegmentCountryCodeAF);
-        _SegmentCountryCodeMap.Add(TEXT("AX"), SegmentCountryCodeAX);
-        _SegmentCountryCodeMap.Add(TEXT("AL"), SegmentCountryCodeAL);
-        _SegmentCountryCodeMap.Add(TEXT("DZ"), SegmentCountryCodeDZ);
-        _SegmentCountryCodeMap.Add(TEXT("AS"), SegmentCountryCodeAS);
-        _SegmentCountryCodeMap.Add(TEXT("AD"), SegmentCountryCodeAD);
-        _SegmentCountryCodeMap.Add(TEXT("AO"), SegmentCountryCodeAO);
-        _SegmentCountryCodeMap.Add(TEXT("AI"), SegmentCountryCodeAI);
-        _SegmentCountryCodeMap.Add(TEXT("AQ"), SegmentCountryCodeAQ);
-        _SegmentCountryCodeMap.Add(TEXT("AG"), SegmentCountryCodeAG);
-        _SegmentCountryCodeMap.Add(TEXT("AR"), SegmentCountryCodeAR);
-        _SegmentCountryCodeMap.Add(TEXT("AM"), SegmentCountryCodeAM);
-        _SegmentCountryCodeMap.Add(TEXT("AW"), SegmentCountryCodeAW);
-        _SegmentCountryCodeMap.Add(TEXT("AU"), SegmentCountryCodeAU);
-        _SegmentCountryCodeMap.Add(TEXT("AT"), SegmentCountryCodeAT);
-        _SegmentCountryCodeMap.Add(TEXT("AZ"), SegmentCountryCodeAZ);
-        _SegmentCountryCodeMap.Add(TEXT("BS"), SegmentCountryCodeBS);
-        _SegmentCountryCodeMap.Add(TEXT("BH"), SegmentCountryCodeBH);
-        _SegmentCountryCodeMap.Add(TEXT("BD"), SegmentCountryCodeBD);
-        _SegmentCountryCodeMap.Add(TEXT("BB"), SegmentCountryCodeBB);
-        _SegmentCountryCodeMap.Add(TEXT("BY"), SegmentCountryCodeBY);
-        _SegmentCountryCodeMap.Add(TEXT("BE"), SegmentCountryCodeBE);
-        _SegmentCountryCodeMap.Add(TEXT("BZ"), SegmentCountryCodeBZ);
-        _SegmentCountryCodeMap.Add(TEXT("BJ"), SegmentCountryCodeBJ);
-        _SegmentCountryCodeMap.Add(TEXT("BM"), SegmentCountryCodeBM);
-        _SegmentCountryCodeMap.Add(TEXT("BT"), SegmentCountryCodeBT);
-        _SegmentCountryCodeMap.Add(TEXT("BO"), SegmentCountryCodeBO);
-        _SegmentCountryCodeMap.Add(TEXT("BQ"), SegmentCountryCodeBQ);
-        _SegmentCountryCodeMap.Add(TEXT("BA"), SegmentCountryCodeBA);
-        _SegmentCountryCodeMap.Add(TEXT("BW"), SegmentCountryCodeBW);
-        _SegmentCountryCodeMap.Add(TEXT("BV"), SegmentCountryCodeBV);
-        _SegmentCountryCodeMap.Add(TEXT("BR"), SegmentCountryCodeBR);
-        _SegmentCountryCodeMap.Add(TEXT("IO"), SegmentCountryCodeIO);
-        _SegmentCountryCodeMap.Add(TEXT("BN"), SegmentCountryCodeBN);
-        _SegmentCountryCodeMap.Add(TEXT("BG"), SegmentCountryCodeBG);
-        _SegmentCountryCodeMap.Add(TEXT("BF"), SegmentCountryCodeBF);
-        _SegmentCountryCodeMap.Add(TEXT("BI"), SegmentCountryCodeBI);
-        _SegmentCountryCodeMap.Add(TEXT("KH"), SegmentCountryCodeKH);
-        _SegmentCountryCodeMap.Add(TEXT("CM"), SegmentCountryCodeCM);
-        _SegmentCountryCodeMap.Add(TEXT("CA"), SegmentCountryCodeCA);
-        _SegmentCountryCodeMap.Add(TEXT("CV"), SegmentCountryCodeCV);
-        _SegmentCountryCodeMap.Add(TEXT("KY"), SegmentCountryCodeKY);
-        _SegmentCountryCodeMap.Add(TEXT("CF"), SegmentCountryCodeCF);
-        _SegmentCountryCodeMap.Add(TEXT("TD"), SegmentCountryCodeTD);
-        _SegmentCountryCodeMap.Add(TEXT("CL"), SegmentCountryCodeCL);
-        _SegmentCountryCodeMap.Add(TEXT("CN"), SegmentCountryCodeCN);
-        _SegmentCountryCodeMap.Add(TEXT("CX"), SegmentCountryCodeCX);
-        _SegmentCountryCodeMap.Add(TEXT("CC"), SegmentCountryCodeCC);
-        _SegmentCountryCodeMap.Add(TEXT("CO"), SegmentCountryCodeCO);
-        _SegmentCountryCodeMap.Add(TEXT("KM"), SegmentCountryCodeKM);
-        _SegmentCountryCodeMap.Add(TEXT("CG"), SegmentCountryCodeCG);
-        _SegmentCountryCodeMap.Add(TEXT("CD"), SegmentCountryCodeCD);
-        _SegmentCountryCodeMap.Add(TEXT("CK"), SegmentCountryCodeCK);
-        _SegmentCountryCodeMap.Add(TEXT("CR"), SegmentCountryCodeCR);
-        _SegmentCountryCodeMap.Add(TEXT("CI"), SegmentCountryCodeCI);
-        _SegmentCountryCodeMap.Add(TEXT("HR"), SegmentCountryCodeHR);
-        _SegmentCountryCodeMap.Add(TEXT("CU"), SegmentCountryCodeCU);
-        _SegmentCountryCodeMap.Add(TEXT("CW"), SegmentCountryCodeCW);
-        _SegmentCountryCodeMap.Add(TEXT("CY"), SegmentCountryCodeCY);
-        _SegmentCountryCodeMap.Add(TEXT("CZ"), SegmentCountryCodeCZ);
-        _SegmentCountryCodeMap.Add(TEXT("DK"), SegmentCountryCodeDK);
-        _SegmentCountryCodeMap.Add(TEXT("DJ"), SegmentCountryCodeDJ);
-        _SegmentCountryCodeMap.Add(TEXT("DM"), SegmentCountryCodeDM);
-        _SegmentCountryCodeMap.Add(TEXT("DO"), SegmentCountryCodeDO);
-        _SegmentCountryCodeMap.Add(TEXT("EC"), SegmentCountryCodeEC);
-        _SegmentCountryCodeMap.Add(TEXT("EG"), SegmentCountryCodeEG);
-        _SegmentCountryCodeMap.Add(TEXT("SV"), SegmentCountryCodeSV);
-        _SegmentCountryCodeMap.Add(TEXT("GQ"), SegmentCountryCodeGQ);
-        _SegmentCountryCodeMap.Add(TEXT("ER"), SegmentCountryCodeER);
-        _SegmentCountryCodeMap.Add(TEXT("EE"), SegmentCountryCodeEE);
-        _SegmentCountryCodeMap.Add(TEXT("ET"), SegmentCountryCodeET);
-        _SegmentCountryCodeMap.Add(TEXT("FK"), SegmentCountryCodeFK);
-        _SegmentCountryCodeMap.Add(TEXT("FO"), SegmentCountryCodeFO);
-        _SegmentCountryCodeMap.Add(TEXT("FJ"), SegmentCountryCodeFJ);
-        _SegmentCountryCodeMap.Add(TEXT("FI"), SegmentCountryCodeFI);
-        _SegmentCountryCodeMap.Add(TEXT("FR"), SegmentCountryCodeFR);
-        _SegmentCountryCodeMap.Add(TEXT("GF"), SegmentCountryCodeGF);
-        _SegmentCountryCodeMap.Add(TEXT("PF"), SegmentCountryCodePF);
-        _SegmentCountryCodeMap.Add(TEXT("TF"), SegmentCountryCodeTF);
-        _SegmentCountryCodeMap.Add(TEXT("GA"), SegmentCountryCodeGA);
-        _SegmentCountryCodeMap.Add(TEXT("GM"), SegmentCountryCodeGM);
-        _SegmentCountryCodeMap.Add(TEXT("GE"), SegmentCountryCodeGE);
-        _SegmentCountryCodeMap.Add(TEXT("DE"), SegmentCountryCodeDE);
-        _SegmentCountryCodeMap.Add(TEXT("GH"), SegmentCountryCodeGH);
-        _SegmentCountryCodeMap.Add(TEXT("GI"), SegmentCountryCodeGI);
-        _SegmentCountryCodeMap.Add(TEXT("GR"), SegmentCountryCodeGR);
-        _SegmentCountryCodeMap.Add(TEXT("GL"), SegmentCountryCodeGL);
-        _SegmentCountryCodeMap.Add(TEXT("GD"), SegmentCountryCodeGD);
-        _SegmentCountryCodeMap.Add(TEXT("GP"), SegmentCountryCodeGP);
-        _SegmentCountryCodeMap.Add(TEXT("GU"), SegmentCountryCodeGU);
-        _SegmentCountryCodeMap.Add(TEXT("GT"), SegmentCountryCodeGT);
-        _SegmentCountryCodeMap.Add(TEXT("GG"), SegmentCountryCodeGG);
-        _SegmentCountryCodeMap.Add(TEXT("GN"), SegmentCountryCodeGN);
-        _SegmentCountryCodeMap.Add(TEXT("GW"), SegmentCountryCodeGW);
-        _SegmentCountryCodeMap.Add(TEXT("GY"), SegmentCountryCodeGY);
-        _SegmentCountryCodeMap.Add(TEXT("HT"), SegmentCountryCodeHT);
-        _SegmentCountryCodeMap.Add(TEXT("HM"), SegmentCountryCodeHM);
-        _SegmentCountryCodeMap.Add(TEXT("VA"), SegmentCountryCodeVA);
-        _SegmentCountryCodeMap.Add(TEXT("HN"), SegmentCountryCodeHN);
-        _SegmentCountryCodeMap.Add(TEXT("HK"), SegmentCountryCodeHK);
-        _SegmentCountryCodeMap.Add(TEXT("HU"), SegmentCountryCodeHU);
-        _SegmentCountryCodeMap.Add(TEXT("IS"), SegmentCountryCodeIS);
-        _SegmentCountryCodeMap.Add(TEXT("IN"), SegmentCountryCodeIN);
-        _SegmentCountryCodeMap.Add(TEXT("ID"), SegmentCountryCodeID);
-        _SegmentCountryCodeMap.Add(TEXT("IR"), SegmentCountryCodeIR);
-        _SegmentCountryCodeMap.Add(TEXT("IQ"), SegmentCountryCodeIQ);
-        _SegmentCountryCodeMap.Add(TEXT("IE"), SegmentCountryCodeIE);
-        _SegmentCountryCodeMap.Add(TEXT("IM"), SegmentCountryCodeIM);
-        _SegmentCountryCodeMap.Add(TEXT("IL"), SegmentCountryCodeIL);
-        _SegmentCountryCodeMap.Add(TEXT("IT"), SegmentCountryCodeIT);
-        _SegmentCountryCodeMap.Add(TEXT("JM"), SegmentCountryCodeJM);
-        _SegmentCountryCodeMap.Add(TEXT("JP"), SegmentCountryCodeJP);
-        _SegmentCountryCodeMap.Add(TEXT("JE"), SegmentCountryCodeJE);
-        _SegmentCountryCodeMap.Add(TEXT("JO"), SegmentCountryCodeJO);
-        _SegmentCountryCodeMap.Add(TEXT("KZ"), SegmentCountryCodeKZ);
-        _SegmentCountryCodeMap.Add(TEXT("KE"), SegmentCountryCodeKE);
-        _SegmentCountryCodeMap.Add(TEXT("KI"), SegmentCountryCodeKI);
-        _SegmentCountryCodeMap.Add(TEXT("KP"), SegmentCountryCodeKP);
-        _SegmentCountryCodeMap.Add(TEXT("KR"), SegmentCountryCodeKR);
-        _SegmentCountryCodeMap.Add(TEXT("KW"), SegmentCountryCodeKW);
-        _SegmentCountryCodeMap.Add(TEXT("KG"), SegmentCountryCodeKG);
-        _SegmentCountryCodeMap.Add(TEXT("LA"), SegmentCountryCodeLA);
-        _SegmentCountryCodeMap.Add(TEXT("LV"), SegmentCountryCodeLV);
-        _SegmentCountryCodeMap.Add(TEXT("LB"), SegmentCountryCodeLB);
-        _SegmentCountryCodeMap.Add(TEXT("LS"), SegmentCountryCodeLS);
-        _SegmentCountryCodeMap.Add(TEXT("LR"), SegmentCountryCodeLR);
-        _SegmentCountryCodeMap.Add(TEXT("LY"), SegmentCountryCodeLY);
-        _SegmentCountryCodeMap.Add(TEXT("LI"), SegmentCountryCodeLI);
-        _SegmentCountryCodeMap.Add(TEXT("LT"), SegmentCountryCodeLT);
-        _SegmentCountryCodeMap.Add(TEXT("LU"), SegmentCountryCodeLU);
-        _SegmentCountryCodeMap.Add(TEXT("MO"), SegmentCountryCodeMO);
-        _SegmentCountryCodeMap.Add(TEXT("MK"), SegmentCountryCodeMK);
-        _SegmentCountryCodeMap.Add(TEXT("MG"), SegmentCountryCodeMG);
-        _SegmentCountryCodeMap.Add(TEXT("MW"), SegmentCountryCodeMW);
-        _SegmentCountryCodeMap.Add(TEXT("MY"), SegmentCountryCodeMY);
-        _SegmentCountryCodeMap.Add(TEXT("MV"), SegmentCountryCodeMV);
-        _SegmentCountryCodeMap.Add(TEXT("ML"), SegmentCountryCodeML);
-        _SegmentCountryCodeMap.Add(TEXT("MT"), SegmentCountryCodeMT);
-        _SegmentCountryCodeMap.Add(TEXT("MH"), SegmentCountryCodeMH);
-        _SegmentCountryCodeMap.Add(TEXT("MQ"), SegmentCountryCodeMQ);
-        _SegmentCountryCodeMap.Add(TEXT("MR"), SegmentCountryCodeMR);
-        _SegmentCountryCodeMap.Add(TEXT("MU"), SegmentCountryCodeMU);
-        _SegmentCountryCodeMap.Add(TEXT("YT"), SegmentCountryCodeYT);
-        _SegmentCountryCodeMap.Add(TEXT("MX"), SegmentCountryCodeMX);
-        _SegmentCountryCodeMap.Add(TEXT("FM"), SegmentCountryCodeFM);
-        _SegmentCountryCodeMap.Add(TEXT("MD"), SegmentCountryCodeMD);
-        _SegmentCountryCodeMap.Add(TEXT("MC"), SegmentCountryCodeMC);
-        _SegmentCountryCodeMap.Add(TEXT("MN"), SegmentCountryCodeMN);
-        _SegmentCountryCodeMap.Add(TEXT("ME"), SegmentCountryCodeME);
-        _SegmentCountryCodeMap.Add(TEXT("MS"), SegmentCountryCodeMS);
-        _SegmentCountryCodeMap.Add(TEXT("MA"), SegmentCountryCodeMA);
-        _SegmentCountryCodeMap.Add(TEXT("MZ"), SegmentCountryCodeMZ);
-        _SegmentCountryCodeMap.Add(TEXT("MM"), SegmentCountryCodeMM);
-        _SegmentCountryCodeMap.Add(TEXT("NA"), SegmentCountryCodeNA);
-        _SegmentCountryCodeMap.Add(TEXT("NR"), SegmentCountryCodeNR);
-        _SegmentCountryCodeMap.Add(TEXT("NP"), SegmentCountryCodeNP);
-        _SegmentCountryCodeMap.Add(TEXT("NL"), SegmentCountryCodeNL);
-        _SegmentCountryCodeMap.Add(TEXT("NC"), SegmentCountryCodeNC);
-        _SegmentCountryCodeMap.Add(TEXT("NZ"), SegmentCountryCodeNZ);
-        _SegmentCountryCodeMap.Add(TEXT("NI"), SegmentCountryCodeNI);
-        _SegmentCountryCodeMap.Add(TEXT("NE"), SegmentCountryCodeNE);
-        _SegmentCountryCodeMap.Add(TEXT("NG"), SegmentCountryCodeNG);
-        _SegmentCountryCodeMap.Add(TEXT("NU"), SegmentCountryCodeNU);
-        _SegmentCountryCodeMap.Add(TEXT("NF"), SegmentCountryCodeNF);
-        _SegmentCountryCodeMap.Add(TEXT("MP"), SegmentCountryCodeMP);
-        _SegmentCountryCodeMap.Add(TEXT("NO"), SegmentCountryCodeNO);
-        _SegmentCountryCodeMap.Add(TEXT("OM"), SegmentCountryCodeOM);
-        _SegmentCountryCodeMap.Add(TEXT("PK"), SegmentCountryCodePK);
-        _SegmentCountryCodeMap.Add(TEXT("PW"), SegmentCountryCodePW);
-        _SegmentCountryCodeMap.Add(TEXT("PS"), SegmentCountryCodePS);
-        _SegmentCountryCodeMap.Add(TEXT("PA"), SegmentCountryCodePA);
-        _SegmentCountryCodeMap.Add(TEXT("PG"), SegmentCountryCodePG);
-        _SegmentCountryCodeMap.Add(TEXT("PY"), SegmentCountryCodePY);
-        _SegmentCountryCodeMap.Add(TEXT("PE"), SegmentCountryCodePE);
-        _SegmentCountryCodeMap.Add(TEXT("PH"), SegmentCountryCodePH);
-        _SegmentCountryCodeMap.Add(TEXT("PN"), SegmentCountryCodePN);
-        _SegmentCountryCodeMap.Add(TEXT("PL"), SegmentCountryCodePL);
-        _SegmentCountryCodeMap.Add(TEXT("PT"), SegmentCountryCodePT);
-        _SegmentCountryCodeMap.Add(TEXT("PR"), SegmentCountryCodePR);
-        _SegmentCountryCodeMap.Add(TEXT("QA"), SegmentCountryCodeQA);
-        _SegmentCountryCodeMap.Add(TEXT("RE"), SegmentCountryCodeRE);
-        _SegmentCountryCodeMap.Add(TEXT("RO"), SegmentCountryCodeRO);
-        _SegmentCountryCodeMap.Add(TEXT("RU"), SegmentCountryCodeRU);
-        _SegmentCountryCodeMap.Add(TEXT("RW"), SegmentCountryCodeRW);
-        _SegmentCountryCodeMap.Add(TEXT("BL"), SegmentCountryCodeBL);
-        _SegmentCountryCodeMap.Add(TEXT("SH"), SegmentCountryCodeSH);
-        _SegmentCountryCodeMap.Add(TEXT("KN"), SegmentCountryCodeKN);
-        _SegmentCountryCodeMap.Add(TEXT("LC"), SegmentCountryCodeLC);
-        _SegmentCountryCodeMap.Add(TEXT("MF"), SegmentCountryCodeMF);
-        _SegmentCountryCodeMap.Add(TEXT("PM"), SegmentCountryCodePM);
-        _SegmentCountryCodeMap.Add(TEXT("VC"), SegmentCountryCodeVC);
-        _SegmentCountryCodeMap.Add(TEXT("WS"), SegmentCountryCodeWS);
-        _SegmentCountryCodeMap.Add(TEXT("SM"), SegmentCountryCodeSM);
-        _SegmentCountryCodeMap.Add(TEXT("ST"), SegmentCountryCodeST);
-        _SegmentCountryCodeMap.Add(TEXT("SA"), SegmentCountryCodeSA);
-        _SegmentCountryCodeMap.Add(TEXT("SN"), SegmentCountryCodeSN);
-        _SegmentCountryCodeMap.Add(TEXT("RS"), SegmentCountryCodeRS);
-        _SegmentCountryCodeMap.Add(TEXT("SC"), SegmentCountryCodeSC);
-        _SegmentCountryCodeMap.Add(TEXT("SL"), SegmentCountryCodeSL);
-        _SegmentCountryCodeMap.Add(TEXT("SG"), SegmentCountryCodeSG);
-        _SegmentCountryCodeMap.Add(TEXT("SX"), SegmentCountryCodeSX);
-        _SegmentCountryCodeMap.Add(TEXT("SK"), SegmentCountryCodeSK);
-        _SegmentCountryCodeMap.Add(TEXT("SI"), SegmentCountryCodeSI);
-        _SegmentCountryCodeMap.Add(TEXT("SB"), SegmentCountryCodeSB);
-        _SegmentCountryCodeMap.Add(TEXT("SO"), SegmentCountryCodeSO);
-        _SegmentCountryCodeMap.Add(TEXT("ZA"), SegmentCountryCodeZA);
-        _SegmentCountryCodeMap.Add(TEXT("GS"), SegmentCountryCodeGS);
-        _SegmentCountryCodeMap.Add(TEXT("SS"), SegmentCountryCodeSS);
-        _SegmentCountryCodeMap.Add(TEXT("ES"), SegmentCountryCodeES);
-        _SegmentCountryCodeMap.Add(TEXT("LK"), SegmentCountryCodeLK);
-        _SegmentCountryCodeMap.Add(TEXT("SD"), SegmentCountryCodeSD);
-        _SegmentCountryCodeMap.Add(TEXT("SR"), SegmentCountryCodeSR);
-        _SegmentCountryCodeMap.Add(TEXT("SJ"), SegmentCountryCodeSJ);
-        _SegmentCountryCodeMap.Add(TEXT("SZ"), SegmentCountryCodeSZ);
-        _SegmentCountryCodeMap.Add(TEXT("SE"), SegmentCountryCodeSE);
-        _SegmentCountryCodeMap.Add(TEXT("CH"), SegmentCountryCodeCH);
-        _SegmentCountryCodeMap.Add(TEXT("SY"), SegmentCountryCodeSY);
-        _SegmentCountryCodeMap.Add(TEXT("TW"), SegmentCountryCodeTW);
-        _SegmentCountryCodeMap.Add(TEXT("TJ"), SegmentCountryCodeTJ);
-        _SegmentCountryCodeMap.Add(TEXT("TZ"), SegmentCountryCodeTZ);
-        _SegmentCountryCodeMap.Add(TEXT("TH"), SegmentCountryCodeTH);
-        _SegmentCountryCodeMap.Add(TEXT("TL"), SegmentCountryCodeTL);
-        _SegmentCountryCodeMap.Add(TEXT("TG"), SegmentCountryCodeTG);
-        _SegmentCountryCodeMap.Add(TEXT("TK"), SegmentCountryCodeTK);
-        _SegmentCountryCodeMap.Add(TEXT("TO"), SegmentCountryCodeTO);
-        _SegmentCountryCodeMap.Add(TEXT("TT"), SegmentCountryCodeTT);
-        _SegmentCountryCodeMap.Add(TEXT("TN"), SegmentCountryCodeTN);
-        _SegmentCountryCodeMap.Add(TEXT("TR"), SegmentCountryCodeTR);
-        _SegmentCountryCodeMap.Add(TEXT("TM"), SegmentCountryCodeTM);
-        _SegmentCountryCodeMap.Add(TEXT("TC"), SegmentCountryCodeTC);
-        _SegmentCountryCodeMap.Add(TEXT("TV"), SegmentCountryCodeTV);
-        _SegmentCountryCodeMap.Add(TEXT("UG"), SegmentCountryCodeUG);
-        _SegmentCountryCodeMap.Add(TEXT("UA"), SegmentCountryCodeUA);
-        _SegmentCountryCodeMap.Add(TEXT("AE"), SegmentCountryCodeAE);
-        _SegmentCountryCodeMap.Add(TEXT("GB"), SegmentCountryCodeGB);
-        _SegmentCountryCodeMap.Add(TEXT("US"), SegmentCountryCodeUS);
-        _SegmentCountryCodeMap.Add(TEXT("UM"), SegmentCountryCodeUM);
-        _SegmentCountryCodeMap.Add(TEXT("UY"), SegmentCountryCodeUY);
-        _SegmentCountryCodeMap.Add(TEXT("UZ"), SegmentCountryCodeUZ);
-        _SegmentCountryCodeMap.Add(TEXT("VU"), SegmentCountryCodeVU);
-        _SegmentCountryCodeMap.Add(TEXT("VE"), SegmentCountryCodeVE);
-        _SegmentCountryCodeMap.Add(TEXT("VN"), SegmentCountryCodeVN);
-        _SegmentCountryCodeMap.Add(TEXT("VG"), SegmentCountryCodeVG);
-        _SegmentCountryCodeMap.Add(TEXT("VI"), SegmentCountryCodeVI);
-        _SegmentCountryCodeMap.Add(TEXT("WF"), SegmentCountryCodeWF);
-        _SegmentCountryCodeMap.Add(TEXT("EH"), SegmentCountryCodeEH);
-        _SegmentCountryCodeMap.Add(TEXT("YE"), SegmentCountryCodeYE);
-        _SegmentCountryCodeMap.Add(TEXT("ZM"), SegmentCountryCodeZM);
-        _SegmentCountryCodeMap.Add(TEXT("ZW"), SegmentCountryCodeZW);
-
-    }
+    static const TMap<FString, SegmentCountryCode> _SegmentCountryCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SegmentCountryCode> Map;
+        Map.Add(TEXT("AF"), SegmentCountryCodeAF);
+        Map.Add(TEXT("AX"), SegmentCountryCodeAX);
+        Map.Add(TEXT("AL"), SegmentCountryCodeAL);
+        Map.Add(TEXT("DZ"), SegmentCountryCodeDZ);
+        Map.Add(TEXT("AS"), SegmentCountryCodeAS);
+        Map.Add(TEXT("AD"), SegmentCountryCodeAD);
+        Map.Add(TEXT("AO"), SegmentCountryCodeAO);
+        Map.Add(TEXT("AI"), SegmentCountryCodeAI);
+        Map.Add(TEXT("AQ"), SegmentCountryCodeAQ);
+        Map.Add(TEXT("AG"), SegmentCountryCodeAG);
+        Map.Add(TEXT("AR"), SegmentCountryCodeAR);
+        Map.Add(TEXT("AM"), SegmentCountryCodeAM);
+        Map.Add(TEXT("AW"), SegmentCountryCodeAW);
+        Map.Add(TEXT("AU"), SegmentCountryCodeAU);
+        Map.Add(TEXT("AT"), SegmentCountryCodeAT);
+        Map.Add(TEXT("AZ"), SegmentCountryCodeAZ);
+        Map.Add(TEXT("BS"), SegmentCountryCodeBS);
+        Map.Add(TEXT("BH"), SegmentCountryCodeBH);
+        Map.Add(TEXT("BD"), SegmentCountryCodeBD);
+        Map.Add(TEXT("BB"), SegmentCountryCodeBB);
+        Map.Add(TEXT("BY"), SegmentCountryCodeBY);
+        Map.Add(TEXT("BE"), SegmentCountryCodeBE);
+        Map.Add(TEXT("BZ"), SegmentCountryCodeBZ);
+        Map.Add(TEXT("BJ"), SegmentCountryCodeBJ);
+        Map.Add(TEXT("BM"), SegmentCountryCodeBM);
+        Map.Add(TEXT("BT"), SegmentCountryCodeBT);
+        Map.Add(TEXT("BO"), SegmentCountryCodeBO);
+        Map.Add(TEXT("BQ"), SegmentCountryCodeBQ);
+        Map.Add(TEXT("BA"), SegmentCountryCodeBA);
+        Map.Add(TEXT("BW"), SegmentCountryCodeBW);
+        Map.Add(TEXT("BV"), SegmentCountryCodeBV);
+        Map.Add(TEXT("BR"), SegmentCountryCodeBR);
+        Map.Add(TEXT("IO"), SegmentCountryCodeIO);
+        Map.Add(TEXT("BN"), SegmentCountryCodeBN);
+        Map.Add(TEXT("BG"), SegmentCountryCodeBG);
+        Map.Add(TEXT("BF"), SegmentCountryCodeBF);
+        Map.Add(TEXT("BI"), SegmentCountryCodeBI);
+        Map.Add(TEXT("KH"), SegmentCountryCodeKH);
+        Map.Add(TEXT("CM"), SegmentCountryCodeCM);
+        Map.Add(TEXT("CA"), SegmentCountryCodeCA);
+        Map.Add(TEXT("CV"), SegmentCountryCodeCV);
+        Map.Add(TEXT("KY"), SegmentCountryCodeKY);
+        Map.Add(TEXT("CF"), SegmentCountryCodeCF);
+        Map.Add(TEXT("TD"), SegmentCountryCodeTD);
+        Map.Add(TEXT("CL"), SegmentCountryCodeCL);
+        Map.Add(TEXT("CN"), SegmentCountryCodeCN);
+        Map.Add(TEXT("CX"), SegmentCountryCodeCX);
+        Map.Add(TEXT("CC"), SegmentCountryCodeCC);
+        Map.Add(TEXT("CO"), SegmentCountryCodeCO);
+        Map.Add(TEXT("KM"), SegmentCountryCodeKM);
+        Map.Add(TEXT("CG"), SegmentCountryCodeCG);
+        Map.Add(TEXT("CD"), SegmentCountryCodeCD);
+        Map.Add(TEXT("CK"), SegmentCountryCodeCK);
+        Map.Add(TEXT("CR"), SegmentCountryCodeCR);
+        Map.Add(TEXT("CI"), SegmentCountryCodeCI);
+        Map.Add(TEXT("HR"), SegmentCountryCodeHR);
+        Map.Add(TEXT("CU"), SegmentCountryCodeCU);
+        Map.Add(TEXT("CW"), SegmentCountryCodeCW);
+        Map.Add(TEXT("CY"), SegmentCountryCodeCY);
+        Map.Add(TEXT("CZ"), SegmentCountryCodeCZ);
+        Map.Add(TEXT("DK"), SegmentCountryCodeDK);
+        Map.Add(TEXT("DJ"), SegmentCountryCodeDJ);
+        Map.Add(TEXT("DM"), SegmentCountryCodeDM);
+        Map.Add(TEXT("DO"), SegmentCountryCodeDO);
+        Map.Add(TEXT("EC"), SegmentCountryCodeEC);
+        Map.Add(TEXT("EG"), SegmentCountryCodeEG);
+        Map.Add(TEXT("SV"), SegmentCountryCodeSV);
+        Map.Add(TEXT("GQ"), SegmentCountryCodeGQ);
+        Map.Add(TEXT("ER"), SegmentCountryCodeER);
+        Map.Add(TEXT("EE"), SegmentCountryCodeEE);
+        Map.Add(TEXT("ET"), SegmentCountryCodeET);
+        Map.Add(TEXT("FK"), SegmentCountryCodeFK);
+        Map.Add(TEXT("FO"), SegmentCountryCodeFO);
+        Map.Add(TEXT("FJ"), SegmentCountryCodeFJ);
+        Map.Add(TEXT("FI"), SegmentCountryCodeFI);
+        Map.Add(TEXT("FR"), SegmentCountryCodeFR);
+        Map.Add(TEXT("GF"), SegmentCountryCodeGF);
+        Map.Add(TEXT("PF"), SegmentCountryCodePF);
+        Map.Add(TEXT("TF"), SegmentCountryCodeTF);
+        Map.Add(TEXT("GA"), SegmentCountryCodeGA);
+        Map.Add(TEXT("GM"), SegmentCountryCodeGM);
+        Map.Add(TEXT("GE"), SegmentCountryCodeGE);
+        Map.Add(TEXT("DE"), SegmentCountryCodeDE);
+        Map.Add(TEXT("GH"), SegmentCountryCodeGH);
+        Map.Add(TEXT("GI"), SegmentCountryCodeGI);
+        Map.Add(TEXT("GR"), SegmentCountryCodeGR);
+        Map.Add(TEXT("GL"), SegmentCountryCodeGL);
+        Map.Add(TEXT("GD"), SegmentCountryCodeGD);
+        Map.Add(TEXT("GP"), SegmentCountryCodeGP);
+        Map.Add(TEXT("GU"), SegmentCountryCodeGU);
+        Map.Add(TEXT("GT"), SegmentCountryCodeGT);
+        Map.Add(TEXT("GG"), SegmentCountryCodeGG);
+        Map.Add(TEXT("GN"), SegmentCountryCodeGN);
+        Map.Add(TEXT("GW"), SegmentCountryCodeGW);
+        Map.Add(TEXT("GY"), SegmentCountryCodeGY);
+        Map.Add(TEXT("HT"), SegmentCountryCodeHT);
+        Map.Add(TEXT("HM"), SegmentCountryCodeHM);
+        Map.Add(TEXT("VA"), SegmentCountryCodeVA);
+        Map.Add(TEXT("HN"), SegmentCountryCodeHN);
+        Map.Add(TEXT("HK"), SegmentCountryCodeHK);
+        Map.Add(TEXT("HU"), SegmentCountryCodeHU);
+        Map.Add(TEXT("IS"), SegmentCountryCodeIS);
+        Map.Add(TEXT("IN"), SegmentCountryCodeIN);
+        Map.Add(TEXT("ID"), SegmentCountryCodeID);
+        Map.Add(TEXT("IR"), SegmentCountryCodeIR);
+        Map.Add(TEXT("IQ"), SegmentCountryCodeIQ);
+        Map.Add(TEXT("IE"), SegmentCountryCodeIE);
+        Map.Add(TEXT("IM"), SegmentCountryCodeIM);
+        Map.Add(TEXT("IL"), SegmentCountryCodeIL);
+        Map.Add(TEXT("IT"), SegmentCountryCodeIT);
+        Map.Add(TEXT("JM"), SegmentCountryCodeJM);
+        Map.Add(TEXT("JP"), SegmentCountryCodeJP);
+        Map.Add(TEXT("JE"), SegmentCountryCodeJE);
+        Map.Add(TEXT("JO"), SegmentCountryCodeJO);
+        Map.Add(TEXT("KZ"), SegmentCountryCodeKZ);
+        Map.Add(TEXT("KE"), SegmentCountryCodeKE);
+        Map.Add(TEXT("KI"), SegmentCountryCodeKI);
+        Map.Add(TEXT("KP"), SegmentCountryCodeKP);
+        Map.Add(TEXT("KR"), SegmentCountryCodeKR);
+        Map.Add(TEXT("KW"), SegmentCountryCodeKW);
+        Map.Add(TEXT("KG"), SegmentCountryCodeKG);
+        Map.Add(TEXT("LA"), SegmentCountryCodeLA);
+        Map.Add(TEXT("LV"), SegmentCountryCodeLV);
+        Map.Add(TEXT("LB"), SegmentCountryCodeLB);
+        Map.Add(TEXT("LS"), SegmentCountryCodeLS);
+        Map.Add(TEXT("LR"), SegmentCountryCodeLR);
+        Map.Add(TEXT("LY"), SegmentCountryCodeLY);
+        Map.Add(TEXT("LI"), SegmentCountryCodeLI);
+        Map.Add(TEXT("LT"), SegmentCountryCodeLT);
+        Map.Add(TEXT("LU"), SegmentCountryCodeLU);
+        Map.Add(TEXT("MO"), SegmentCountryCodeMO);
+        Map.Add(TEXT("MK"), SegmentCountryCodeMK);
+        Map.Add(TEXT("MG"), SegmentCountryCodeMG);
+        Map.Add(TEXT("MW"), SegmentCountryCodeMW);
+        Map.Add(TEXT("MY"), SegmentCountryCodeMY);
+        Map.Add(TEXT("MV"), SegmentCountryCodeMV);
+        Map.Add(TEXT("ML"), SegmentCountryCodeML);
+        Map.Add(TEXT("MT"), SegmentCountryCodeMT);
+        Map.Add(TEXT("MH"), SegmentCountryCodeMH);
+        Map.Add(TEXT("MQ"), SegmentCountryCodeMQ);
+        Map.Add(TEXT("MR"), SegmentCountryCodeMR);
+        Map.Add(TEXT("MU"), SegmentCountryCodeMU);
+        Map.Add(TEXT("YT"), SegmentCountryCodeYT);
+        Map.Add(TEXT("MX"), SegmentCountryCodeMX);
+        Map.Add(TEXT("FM"), SegmentCountryCodeFM);
+        Map.Add(TEXT("MD"), SegmentCountryCodeMD);
+        Map.Add(TEXT("MC"), SegmentCountryCodeMC);
+        Map.Add(TEXT("MN"), SegmentCountryCodeMN);
+        Map.Add(TEXT("ME"), SegmentCountryCodeME);
+        Map.Add(TEXT("MS"), SegmentCountryCodeMS);
+        Map.Add(TEXT("MA"), SegmentCountryCodeMA);
+        Map.Add(TEXT("MZ"), SegmentCountryCodeMZ);
+        Map.Add(TEXT("MM"), SegmentCountryCodeMM);
+        Map.Add(TEXT("NA"), SegmentCountryCodeNA);
+        Map.Add(TEXT("NR"), SegmentCountryCodeNR);
+        Map.Add(TEXT("NP"), SegmentCountryCodeNP);
+        Map.Add(TEXT("NL"), SegmentCountryCodeNL);
+        Map.Add(TEXT("NC"), SegmentCountryCodeNC);
+        Map.Add(TEXT("NZ"), SegmentCountryCodeNZ);
+        Map.Add(TEXT("NI"), SegmentCountryCodeNI);
+        Map.Add(TEXT("NE"), SegmentCountryCodeNE);
+        Map.Add(TEXT("NG"), SegmentCountryCodeNG);
+        Map.Add(TEXT("NU"), SegmentCountryCodeNU);
+        Map.Add(TEXT("NF"), SegmentCountryCodeNF);
+        Map.Add(TEXT("MP"), SegmentCountryCodeMP);
+        Map.Add(TEXT("NO"), SegmentCountryCodeNO);
+        Map.Add(TEXT("OM"), SegmentCountryCodeOM);
+        Map.Add(TEXT("PK"), SegmentCountryCodePK);
+        Map.Add(TEXT("PW"), SegmentCountryCodePW);
+        Map.Add(TEXT("PS"), SegmentCountryCodePS);
+        Map.Add(TEXT("PA"), SegmentCountryCodePA);
+        Map.Add(TEXT("PG"), SegmentCountryCodePG);
+        Map.Add(TEXT("PY"), SegmentCountryCodePY);
+        Map.Add(TEXT("PE"), SegmentCountryCodePE);
+        Map.Add(TEXT("PH"), SegmentCountryCodePH);
+        Map.Add(TEXT("PN"), SegmentCountryCodePN);
+        Map.Add(TEXT("PL"), SegmentCountryCodePL);
+        Map.Add(TEXT("PT"), SegmentCountryCodePT);
+        Map.Add(TEXT("PR"), SegmentCountryCodePR);
+        Map.Add(TEXT("QA"), SegmentCountryCodeQA);
+        Map.Add(TEXT("RE"), SegmentCountryCodeRE);
+        Map.Add(TEXT("RO"), SegmentCountryCodeRO);
+        Map.Add(TEXT("RU"), SegmentCountryCodeRU);
+        Map.Add(TEXT("RW"), SegmentCountryCodeRW);
+        Map.Add(TEXT("BL"), SegmentCountryCodeBL);
+        Map.Add(TEXT("SH"), SegmentCountryCodeSH);
+        Map.Add(TEXT("KN"), SegmentCountryCodeKN);
+        Map.Add(TEXT("LC"), SegmentCountryCodeLC);
+        Map.Add(TEXT("MF"), SegmentCountryCodeMF);
+        Map.Add(TEXT("PM"), SegmentCountryCodePM);
+        Map.Add(TEXT("VC"), SegmentCountryCodeVC);
+        Map.Add(TEXT("WS"), SegmentCountryCodeWS);
+        Map.Add(TEXT("SM"), SegmentCountryCodeSM);
+        Map.Add(TEXT("ST"), SegmentCountryCodeST);
+        Map.Add(TEXT("SA"), SegmentCountryCodeSA);
+        Map.Add(TEXT("SN"), SegmentCountryCodeSN);
+        Map.Add(TEXT("RS"), SegmentCountryCodeRS);
+        Map.Add(TEXT("SC"), SegmentCountryCodeSC);
+        Map.Add(TEXT("SL"), SegmentCountryCodeSL);
+        Map.Add(TEXT("SG"), SegmentCountryCodeSG);
+        Map.Add(TEXT("SX"), SegmentCountryCodeSX);
+        Map.Add(TEXT("SK"), SegmentCountryCodeSK);
+        Map.Add(TEXT("SI"), SegmentCountryCodeSI);
+        Map.Add(TEXT("SB"), SegmentCountryCodeSB);
+        Map.Add(TEXT("SO"), SegmentCountryCodeSO);
+        Map.Add(TEXT("ZA"), SegmentCountryCodeZA);
+        Map.Add(TEXT("GS"), SegmentCountryCodeGS);
+        Map.Add(TEXT("SS"), SegmentCountryCodeSS);
+        Map.Add(TEXT("ES"), SegmentCountryCodeES);
+        Map.Add(TEXT("LK"), SegmentCountryCodeLK);
+        Map.Add(TEXT("SD"), SegmentCountryCodeSD);
+        Map.Add(TEXT("SR"), SegmentCountryCodeSR);
+        Map.Add(TEXT("SJ"), SegmentCountryCodeSJ);
+        Map.Add(TEXT("SZ"), SegmentCountryCodeSZ);
+        Map.Add(TEXT("SE"), SegmentCountryCodeSE);
+        Map.Add(TEXT("CH"), SegmentCountryCodeCH);
+        Map.Add(TEXT("SY"), SegmentCountryCodeSY);
+        Map.Add(TEXT("TW"), SegmentCountryCodeTW);
+        Map.Add(TEXT("TJ"), SegmentCountryCodeTJ);
+        Map.Add(TEXT("TZ"), SegmentCountryCodeTZ);
+        Map.Add(TEXT("TH"), SegmentCountryCodeTH);
+        Map.Add(TEXT("TL"), SegmentCountryCodeTL);
+        Map.Add(TEXT("TG"), SegmentCountryCodeTG);
+        Map.Add(TEXT("TK"), SegmentCountryCodeTK);
+        Map.Add(TEXT("TO"), SegmentCountryCodeTO);
+        Map.Add(TEXT("TT"), SegmentCountryCodeTT);
+        Map.Add(TEXT("TN"), SegmentCountryCodeTN);
+        Map.Add(TEXT("TR"), SegmentCountryCodeTR);
+        Map.Add(TEXT("TM"), SegmentCountryCodeTM);
+        Map.Add(TEXT("TC"), SegmentCountryCodeTC);
+        Map.Add(TEXT("TV"), SegmentCountryCodeTV);
+        Map.Add(TEXT("UG"), SegmentCountryCodeUG);
+        Map.Add(TEXT("UA"), SegmentCountryCodeUA);
+        Map.Add(TEXT("AE"), SegmentCountryCodeAE);
+        Map.Add(TEXT("GB"), SegmentCountryCodeGB);
+        Map.Add(TEXT("US"), SegmentCountryCodeUS);
+        Map.Add(TEXT("UM"), SegmentCountryCodeUM);
+        Map.Add(TEXT("UY"), SegmentCountryCodeUY);
+        Map.Add(TEXT("UZ"), SegmentCountryCodeUZ);
+        Map.Add(TEXT("VU"), SegmentCountryCodeVU);
+        Map.Add(TEXT("VE"), SegmentCountryCodeVE);
+        Map.Add(TEXT("VN"), SegmentCountryCodeVN);
+        Map.Add(TEXT("VG"), SegmentCountryCodeVG);
+        Map.Add(TEXT("VI"), SegmentCountryCodeVI);
+        Map.Add(TEXT("WF"), SegmentCountryCodeWF);
+        Map.Add(TEXT("EH"), SegmentCountryCodeEH);
+        Map.Add(TEXT("YE"), SegmentCountryCodeYE);
+        Map.Add(TEXT("ZM"), SegmentCountryCodeZM);
+        Map.Add(TEXT("ZW"), SegmentCountryCodeZW);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -7189,14 +7180,14 @@ AdminModels::SegmentPushNotificationDevicePlatform PlayFab::AdminModels::readSeg
 
 AdminModels::SegmentPushNotificationDevicePlatform PlayFab::AdminModels::readSegmentPushNotificationDevicePlatformFromValue(const FString& value)
 {
-    static TMap<FString, SegmentPushNotificationDevicePlatform> _SegmentPushNotificationDevicePlatformMap;
-    if (_SegmentPushNotificationDevicePlatformMap.Num() == 0)
+    static const TMap<FString, SegmentPushNotificationDevicePlatform> _SegmentPushNotificationDevicePlatformMap = []()
     {
-        // Auto-generate the map on the first use
-        _SegmentPushNotificationDevicePlatformMap.Add(TEXT("ApplePushNotificationService"), SegmentPushNotificationDevicePlatformApplePushNotificationService);
-        _SegmentPushNotificationDevicePlatformMap.Add(TEXT("GoogleCloudMessaging"), SegmentPushNotificationDevicePlatformGoogleCloudMessaging);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SegmentPushNotificationDevicePlatform> Map;
+        Map.Add(TEXT("ApplePushNotificationService"), SegmentPushNotificationDevicePlatformApplePushNotificationService);
+        Map.Add(TEXT("GoogleCloudMessaging"), SegmentPushNotificationDevicePlatformGoogleCloudMessaging);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -7598,174 +7589,174 @@ AdminModels::SegmentCurrency PlayFab::AdminModels::readSegmentCurrencyFromValue(
 
 AdminModels::SegmentCurrency PlayFab::AdminModels::readSegmentCurrencyFromValue(const FString& value)
 {
-    static TMap<FString, SegmentCurrency> _SegmentCurrencyMap;
-    if (_SegmentCurrencyMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _SegmentCurrencyMap.Add(TEXT("AED"), SegmentCurrencyAED);
-        _SegmentCurrencyMap.Add(TEXT("AFN"), SegmentCurrencyAFN);
-        _SegmentCurrencyMap.Add(TEXT("ALL"), SegmentCurrencyALL);
-        _SegmentCurrencyMap.Add(TEXT("AMD"), SegmentCurrencyAMD);
-        _SegmentCurrencyMap.Add(TEXT("ANG"), SegmentCurrencyANG);
-        _SegmentCurrencyMap.Add(TEXT("AOA"), SegmentCurrencyAOA);
-        _SegmentCurrencyMap.Add(TEXT("ARS"), SegmentCurrencyARS);
-        _SegmentCurrencyMap.Add(TEXT("AUD"), SegmentCurrencyAUD);
-        _SegmentCurrencyMap.Add(TEXT("AWG"), SegmentCurrencyAWG);
-        _SegmentCurrencyMap.Add(TEXT("AZN"), SegmentCurrencyAZN);
-        _SegmentCurrencyMap.Add(TEXT("BAM"), SegmentCurrencyBAM);
-        _SegmentCurrencyMap.Add(TEXT("BBD"), SegmentCurrencyBBD);
-        _SegmentCurrencyMap.Add(TEXT("BDT"), SegmentCurrencyBDT);
-        _SegmentCurrencyMap.Add(TEXT("BGN"), SegmentCurrencyBGN);
-        _SegmentCurrencyMap.Add(TEXT("BHD"), SegmentCurrencyBHD);
-        _SegmentCurrencyMap.Add(TEXT("BIF"), SegmentCurrencyBIF);
-        _SegmentCurrencyMap.Add(TEXT("BMD"), SegmentCurrencyBMD);
-        _SegmentCurrencyMap.Add(TEXT("BND"), SegmentCurrencyBND);
-        _SegmentCurrencyMap.Add(TEXT("BOB"), SegmentCurrencyBOB);
-        _SegmentCurrencyMap.Add(TEXT("BRL"), SegmentCurrencyBRL);
-        _SegmentCurrencyMap.Add(TEXT("BSD"), SegmentCurrencyBSD);
-        _SegmentCurrencyMap.Add(TEXT("BTN"), SegmentCurrencyBTN);
-        _SegmentCurrencyMap.Add(TEXT("BWP"), SegmentCurrencyBWP);
-        _SegmentCurrencyMap.Add(TEXT("BYR"), SegmentCurrencyBYR);
-        _SegmentCurrencyMap.Add(TEXT("BZD"), SegmentCurrencyBZD);
-        _SegmentCurrencyMap.Add(TEXT("CAD"), SegmentCurrencyCAD);
-        _SegmentCurrencyMap.Add(TEXT("CDF"), SegmentCurrencyCDF);
-        _SegmentCurrencyMap.Add(TEXT("CHF"), SegmentCurrencyCHF);
-        _SegmentCurrencyMap.Add(TEXT("CLP"), SegmentCurrencyCLP);
-        _SegmentCurrencyMap.Add(TEXT("CNY"), SegmentCurrencyCNY);
-        _SegmentCurrencyMap.Add(TEXT("COP"), SegmentCurrencyCOP);
-        _SegmentCurrencyMap.Add(TEXT("CRC"), SegmentCurrencyCRC);
-        _SegmentCurrencyMap.Add(TEXT("CUC"), SegmentCurrencyCUC);
-        _SegmentCurrencyMap.Add(TEXT("CUP"), SegmentCurrencyCUP);
-        _SegmentCurrencyMap.Add(TEXT("CVE"), SegmentCurrencyCVE);
-        _SegmentCurrencyMap.Add(TEXT("CZK"), SegmentCurrencyCZK);
-        _SegmentCurrencyMap.Add(TEXT("DJF"), SegmentCurrencyDJF);
-        _SegmentCurrencyMap.Add(TEXT("DKK"), SegmentCurrencyDKK);
-        _SegmentCurrencyMap.Add(TEXT("DOP"), SegmentCurrencyDOP);
-        _SegmentCurrencyMap.Add(TEXT("DZD"), SegmentCurrencyDZD);
-        _SegmentCurrencyMap.Add(TEXT("EGP"), SegmentCurrencyEGP);
-        _SegmentCurrencyMap.Add(TEXT("ERN"), SegmentCurrencyERN);
-        _SegmentCurrencyMap.Add(TEXT("ETB"), SegmentCurrencyETB);
-        _SegmentCurrencyMap.Add(TEXT("EUR"), SegmentCurrencyEUR);
-        _SegmentCurrencyMap.Add(TEXT("FJD"), SegmentCurrencyFJD);
-        _SegmentCurrencyMap.Add(TEXT("FKP"), SegmentCurrencyFKP);
-        _SegmentCurrencyMap.Add(TEXT("GBP"), SegmentCurrencyGBP);
-        _SegmentCurrencyMap.Add(TEXT("GEL"), SegmentCurrencyGEL);
-        _SegmentCurrencyMap.Add(TEXT("GGP"), SegmentCurrencyGGP);
-        _SegmentCurrencyMap.Add(TEXT("GHS"), SegmentCurrencyGHS);
-        _SegmentCurrencyMap.Add(TEXT("GIP"), SegmentCurrencyGIP);
-        _SegmentCurrencyMap.Add(TEXT("GMD"), SegmentCurrencyGMD);
-        _SegmentCurrencyMap.Add(TEXT("GNF"), SegmentCurrencyGNF);
-        _SegmentCurrencyMap.Add(TEXT("GTQ"), SegmentCurrencyGTQ);
-        _SegmentCurrencyMap.Add(TEXT("GYD"), SegmentCurrencyGYD);
-        _SegmentCurrencyMap.Add(TEXT("HKD"), SegmentCurrencyHKD);
-        _SegmentCurrencyMap.Add(TEXT("HNL"), SegmentCurrencyHNL);
-        _SegmentCurrencyMap.Add(TEXT("HRK"), SegmentCurrencyHRK);
-        _SegmentCurrencyMap.Add(TEXT("HTG"), SegmentCurrencyHTG);
-        _SegmentCurrencyMap.Add(TEXT("HUF"), SegmentCurrencyHUF);
-        _SegmentCurrencyMap.Add(TEXT("IDR"), SegmentCurrencyIDR);
-        _SegmentCurrencyMap.Add(TEXT("ILS"), SegmentCurrencyILS);
-        _SegmentCurrencyMap.Add(TEXT("IMP"), SegmentCurrencyIMP);
-        _SegmentCurrencyMap.Add(TEXT("INR"), SegmentCurrencyINR);
-        _SegmentCurrencyMap.Add(TEXT("IQD"), SegmentCurrencyIQD);
-        _SegmentCurrencyMap.Add(TEXT("IRR"), SegmentCurrencyIRR);
-        _SegmentCurrencyMap.Add(TEXT("ISK"), SegmentCurrencyISK);
-        _SegmentCurrencyMap.Add(TEXT("JEP"), SegmentCurrencyJEP);
-        _SegmentCurrencyMap.Add(TEXT("JMD"), SegmentCurrencyJMD);
-        _SegmentCurrencyMap.Add(TEXT("JOD"), SegmentCurrencyJOD);
-        _SegmentCurrencyMap.Add(TEXT("JPY"), SegmentCurrencyJPY);
-        _SegmentCurrencyMap.Add(TEXT("KES"), SegmentCurrencyKES);
-        _SegmentCurrencyMap.Add(TEXT("KGS"), SegmentCurrencyKGS);
-        _SegmentCurrencyMap.Add(TEXT("KHR"), SegmentCurrencyKHR);
-        _SegmentCurrencyMap.Add(TEXT("KMF"), SegmentCurrencyKMF);
-        _SegmentCurrencyMap.Add(TEXT("KPW"), SegmentCurrencyKPW);
-        _SegmentCurrencyMap.Add(TEXT("KRW"), SegmentCurrencyKRW);
-        _SegmentCurrencyMap.Add(TEXT("KWD"), SegmentCurrencyKWD);
-        _SegmentCurrencyMap.Add(TEXT("KYD"), SegmentCurrencyKYD);
-        _SegmentCurrencyMap.Add(TEXT("KZT"), SegmentCurrencyKZT);
-        _SegmentCurrencyMap.Add(TEXT("LAK"), SegmentCurrencyLAK);
-        _SegmentCurrencyMap.Add(TEXT("LBP"), SegmentCurrencyLBP);
-        _SegmentCurrencyMap.Add(TEXT("LKR"), SegmentCurrencyLKR);
-        _SegmentCurrencyMap.Add(TEXT("LRD"), SegmentCurrencyLRD);
-        _SegmentCurrencyMap.Add(TEXT("LSL"), SegmentCurrencyLSL);
-        _SegmentCurrencyMap.Add(TEXT("LYD"), SegmentCurrencyLYD);
-        _SegmentCurrencyMap.Add(TEXT("MAD"), SegmentCurrencyMAD);
-        _SegmentCurrencyMap.Add(TEXT("MDL"), SegmentCurrencyMDL);
-        _SegmentCurrencyMap.Add(TEXT("MGA"), SegmentCurrencyMGA);
-        _SegmentCurrencyMap.Add(TEXT("MKD"), SegmentCurrencyMKD);
-        _SegmentCurrencyMap.Add(TEXT("MMK"), SegmentCurrencyMMK);
-        _SegmentCurrencyMap.Add(TEXT("MNT"), SegmentCurrencyMNT);
-        _SegmentCurrencyMap.Add(TEXT("MOP"), SegmentCurrencyMOP);
-        _SegmentCurrencyMap.Add(TEXT("MRO"), SegmentCurrencyMRO);
-        _SegmentCurrencyMap.Add(TEXT("MUR"), SegmentCurrencyMUR);
-        _SegmentCurrencyMap.Add(TEXT("MVR"), SegmentCurrencyMVR);
-        _SegmentCurrencyMap.Add(TEXT("MWK"), SegmentCurrencyMWK);
-        _SegmentCurrencyMap.Add(TEXT("MXN"), SegmentCurrencyMXN);
-        _SegmentCurrencyMap.Add(TEXT("MYR"), SegmentCurrencyMYR);
-        _SegmentCurrencyMap.Add(TEXT("MZN"), SegmentCurrencyMZN);
-        _SegmentCurrencyMap.Add(TEXT("NAD"), SegmentCurrencyNAD);
-        _SegmentCurrencyMap.Add(TEXT("NGN"), SegmentCurrencyNGN);
-        _SegmentCurrencyMap.Add(TEXT("NIO"), SegmentCurrencyNIO);
-        _SegmentCurrencyMap.Add(TEXT("NOK"), SegmentCurrencyNOK);
-        _SegmentCurrencyMap.Add(TEXT("NPR"), SegmentCurrencyNPR);
-        _SegmentCurrencyMap.Add(TEXT("NZD"), SegmentCurrencyNZD);
-        _SegmentCurrencyMap.Add(TEXT("OMR"), SegmentCurrencyOMR);
-        _SegmentCurrencyMap.Add(TEXT("PAB"), SegmentCurrencyPAB);
-        _SegmentCurrencyMap.Add(TEXT("PEN"), SegmentCurrencyPEN);
-        _SegmentCurrencyMap.Add(TEXT("PGK"), SegmentCurrencyPGK);
-        _SegmentCurrencyMap.Add(TEXT("PHP"), SegmentCurrencyPHP);
-        _SegmentCurrencyMap.Add(TEXT("PKR"), SegmentCurrencyPKR);
-        _SegmentCurrencyMap.Add(TEXT("PLN"), SegmentCurrencyPLN);
-        _SegmentCurrencyMap.Add(TEXT("PYG"), SegmentCurrencyPYG);
-        _SegmentCurrencyMap.Add(TEXT("QAR"), SegmentCurrencyQAR);
-        _SegmentCurrencyMap.Add(TEXT("RON"), SegmentCurrencyRON);
-        _SegmentCurrencyMap.Add(TEXT("RSD"), SegmentCurrencyRSD);
-        _SegmentCurrencyMap.Add(TEXT("RUB"), SegmentCurrencyRUB);
-        _SegmentCurrencyMap.Add(TEXT("RWF"), SegmentCurrencyRWF);
-        _SegmentCurrencyMap.Add(TEXT("SAR"), SegmentCurrencySAR);
-        _SegmentCurrencyMap.Add(TEXT("SBD"), SegmentCurrencySBD);
-        _SegmentCurrencyMap.Add(TEXT("SCR"), SegmentCurrencySCR);
-        _SegmentCurrencyMap.Add(TEXT("SDG"), SegmentCurrencySDG);
-        _SegmentCurrencyMap.Add(TEXT("SEK"), SegmentCurrencySEK);
-        _SegmentCurrencyMap.Add(TEXT("SGD"), SegmentCurrencySGD);
-        _SegmentCurrencyMap.Add(TEXT("SHP"), SegmentCurrencySHP);
-        _SegmentCurrencyMap.Add(TEXT("SLL"), SegmentCurrencySLL);
-        _SegmentCurrencyMap.Add(TEXT("SOS"), SegmentCurrencySOS);
-        _SegmentCurrencyMap.Add(TEXT("SPL"), SegmentCurrencySPL);
-        _SegmentCurrencyMap.Add(TEXT("SRD"), SegmentCurrencySRD);
-        _SegmentCurrencyMap.Add(TEXT("STD"), SegmentCurrencySTD);
-        _SegmentCurrencyMap.Add(TEXT("SVC"), SegmentCurrencySVC);
-        _SegmentCurrencyMap.Add(TEXT("SYP"), SegmentCurrencySYP);
-        _SegmentCurrencyMap.Add(TEXT("SZL"), SegmentCurrencySZL);
-        _SegmentCurrencyMap.Add(TEXT("THB"), SegmentCurrencyTHB);
-        _SegmentCurrencyMap.Add(TEXT("TJS"), SegmentCurrencyTJS);
-        _SegmentCurrencyMap.Add(TEXT("TMT"), SegmentCurrencyTMT);
-        _SegmentCurrencyMap.Add(TEXT("TND"), SegmentCurrencyTND);
-        _SegmentCurrencyMap.Add(TEXT("TOP"), SegmentCurrencyTOP);
-        _SegmentCurrencyMap.Add(TEXT("TRY"), SegmentCurrencyTRY);
-        _SegmentCurrencyMap.Add(TEXT("TTD"), SegmentCurrencyTTD);
-        _SegmentCurrencyMap.Add(TEXT("TVD"), SegmentCurrencyTVD);
-        _SegmentCurrencyMap.Add(TEXT("TWD"), SegmentCurrencyTWD);
-        _SegmentCurrencyMap.Add(TEXT("TZS"), SegmentCurrencyTZS);
-        _SegmentCurrencyMap.Add(TEXT("UAH"), SegmentCurrencyUAH);
-        _SegmentCurrencyMap.Add(TEXT("UGX"), SegmentCurrencyUGX);
-        _SegmentCurrencyMap.Add(TEXT("USD"), SegmentCurrencyUSD);
-        _SegmentCurrencyMap.Add(TEXT("UYU"), SegmentCurrencyUYU);
-        _SegmentCurrencyMap.Add(TEXT("UZS"), SegmentCurrencyUZS);
-        _SegmentCurrencyMap.Add(TEXT("VEF"), SegmentCurrencyVEF);
-        _SegmentCurrencyMap.Add(TEXT("VND"), SegmentCurrencyVND);
-        _SegmentCurrencyMap.Add(TEXT("VUV"), SegmentCurrencyVUV);
-        _SegmentCurrencyMap.Add(TEXT("WST"), SegmentCurrencyWST);
-        _SegmentCurrencyMap.Add(TEXT("XAF"), SegmentCurrencyXAF);
-        _SegmentCurrencyMap.Add(TEXT("XCD"), SegmentCurrencyXCD);
-        _SegmentCurrencyMap.Add(TEXT("XDR"), SegmentCurrencyXDR);
-        _SegmentCurrencyMap.Add(TEXT("XOF"), SegmentCurrencyXOF);
-        _SegmentCurrencyMap.Add(TEXT("XPF"), SegmentCurrencyXPF);
-        _SegmentCurrencyMap.Add(TEXT("YER"), SegmentCurrencyYER);
-        _SegmentCurrencyMap.Add(TEXT("ZAR"), SegmentCurrencyZAR);
-        _SegmentCurrencyMap.Add(TEXT("ZMW"), SegmentCurrencyZMW);
-        _SegmentCurrencyMap.Add(TEXT("ZWD"), SegmentCurrencyZWD);
-
-    }
+    static const TMap<FString, SegmentCurrency> _SegmentCurrencyMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SegmentCurrency> Map;
+        Map.Add(TEXT("AED"), SegmentCurrencyAED);
+        Map.Add(TEXT("AFN"), SegmentCurrencyAFN);
+        Map.Add(TEXT("ALL"), SegmentCurrencyALL);
+        Map.Add(TEXT("AMD"), SegmentCurrencyAMD);
+        Map.Add(TEXT("ANG"), SegmentCurrencyANG);
+        Map.Add(TEXT("AOA"), SegmentCurrencyAOA);
+        Map.Add(TEXT("ARS"), SegmentCurrencyARS);
+        Map.Add(TEXT("AUD"), SegmentCurrencyAUD);
+        Map.Add(TEXT("AWG"), SegmentCurrencyAWG);
+        Map.Add(TEXT("AZN"), SegmentCurrencyAZN);
+        Map.Add(TEXT("BAM"), SegmentCurrencyBAM);
+        Map.Add(TEXT("BBD"), SegmentCurrencyBBD);
+        Map.Add(TEXT("BDT"), SegmentCurrencyBDT);
+        Map.Add(TEXT("BGN"), SegmentCurrencyBGN);
+        Map.Add(TEXT("BHD"), SegmentCurrencyBHD);
+        Map.Add(TEXT("BIF"), SegmentCurrencyBIF);
+        Map.Add(TEXT("BMD"), SegmentCurrencyBMD);
+        Map.Add(TEXT("BND"), SegmentCurrencyBND);
+        Map.Add(TEXT("BOB"), SegmentCurrencyBOB);
+        Map.Add(TEXT("BRL"), SegmentCurrencyBRL);
+        Map.Add(TEXT("BSD"), SegmentCurrencyBSD);
+        Map.Add(TEXT("BTN"), SegmentCurrencyBTN);
+        Map.Add(TEXT("BWP"), SegmentCurrencyBWP);
+        Map.Add(TEXT("BYR"), SegmentCurrencyBYR);
+        Map.Add(TEXT("BZD"), SegmentCurrencyBZD);
+        Map.Add(TEXT("CAD"), SegmentCurrencyCAD);
+        Map.Add(TEXT("CDF"), SegmentCurrencyCDF);
+        Map.Add(TEXT("CHF"), SegmentCurrencyCHF);
+        Map.Add(TEXT("CLP"), SegmentCurrencyCLP);
+        Map.Add(TEXT("CNY"), SegmentCurrencyCNY);
+        Map.Add(TEXT("COP"), SegmentCurrencyCOP);
+        Map.Add(TEXT("CRC"), SegmentCurrencyCRC);
+        Map.Add(TEXT("CUC"), SegmentCurrencyCUC);
+        Map.Add(TEXT("CUP"), SegmentCurrencyCUP);
+        Map.Add(TEXT("CVE"), SegmentCurrencyCVE);
+        Map.Add(TEXT("CZK"), SegmentCurrencyCZK);
+        Map.Add(TEXT("DJF"), SegmentCurrencyDJF);
+        Map.Add(TEXT("DKK"), SegmentCurrencyDKK);
+        Map.Add(TEXT("DOP"), SegmentCurrencyDOP);
+        Map.Add(TEXT("DZD"), SegmentCurrencyDZD);
+        Map.Add(TEXT("EGP"), SegmentCurrencyEGP);
+        Map.Add(TEXT("ERN"), SegmentCurrencyERN);
+        Map.Add(TEXT("ETB"), SegmentCurrencyETB);
+        Map.Add(TEXT("EUR"), SegmentCurrencyEUR);
+        Map.Add(TEXT("FJD"), SegmentCurrencyFJD);
+        Map.Add(TEXT("FKP"), SegmentCurrencyFKP);
+        Map.Add(TEXT("GBP"), SegmentCurrencyGBP);
+        Map.Add(TEXT("GEL"), SegmentCurrencyGEL);
+        Map.Add(TEXT("GGP"), SegmentCurrencyGGP);
+        Map.Add(TEXT("GHS"), SegmentCurrencyGHS);
+        Map.Add(TEXT("GIP"), SegmentCurrencyGIP);
+        Map.Add(TEXT("GMD"), SegmentCurrencyGMD);
+        Map.Add(TEXT("GNF"), SegmentCurrencyGNF);
+        Map.Add(TEXT("GTQ"), SegmentCurrencyGTQ);
+        Map.Add(TEXT("GYD"), SegmentCurrencyGYD);
+        Map.Add(TEXT("HKD"), SegmentCurrencyHKD);
+        Map.Add(TEXT("HNL"), SegmentCurrencyHNL);
+        Map.Add(TEXT("HRK"), SegmentCurrencyHRK);
+        Map.Add(TEXT("HTG"), SegmentCurrencyHTG);
+        Map.Add(TEXT("HUF"), SegmentCurrencyHUF);
+        Map.Add(TEXT("IDR"), SegmentCurrencyIDR);
+        Map.Add(TEXT("ILS"), SegmentCurrencyILS);
+        Map.Add(TEXT("IMP"), SegmentCurrencyIMP);
+        Map.Add(TEXT("INR"), SegmentCurrencyINR);
+        Map.Add(TEXT("IQD"), SegmentCurrencyIQD);
+        Map.Add(TEXT("IRR"), SegmentCurrencyIRR);
+        Map.Add(TEXT("ISK"), SegmentCurrencyISK);
+        Map.Add(TEXT("JEP"), SegmentCurrencyJEP);
+        Map.Add(TEXT("JMD"), SegmentCurrencyJMD);
+        Map.Add(TEXT("JOD"), SegmentCurrencyJOD);
+        Map.Add(TEXT("JPY"), SegmentCurrencyJPY);
+        Map.Add(TEXT("KES"), SegmentCurrencyKES);
+        Map.Add(TEXT("KGS"), SegmentCurrencyKGS);
+        Map.Add(TEXT("KHR"), SegmentCurrencyKHR);
+        Map.Add(TEXT("KMF"), SegmentCurrencyKMF);
+        Map.Add(TEXT("KPW"), SegmentCurrencyKPW);
+        Map.Add(TEXT("KRW"), SegmentCurrencyKRW);
+        Map.Add(TEXT("KWD"), SegmentCurrencyKWD);
+        Map.Add(TEXT("KYD"), SegmentCurrencyKYD);
+        Map.Add(TEXT("KZT"), SegmentCurrencyKZT);
+        Map.Add(TEXT("LAK"), SegmentCurrencyLAK);
+        Map.Add(TEXT("LBP"), SegmentCurrencyLBP);
+        Map.Add(TEXT("LKR"), SegmentCurrencyLKR);
+        Map.Add(TEXT("LRD"), SegmentCurrencyLRD);
+        Map.Add(TEXT("LSL"), SegmentCurrencyLSL);
+        Map.Add(TEXT("LYD"), SegmentCurrencyLYD);
+        Map.Add(TEXT("MAD"), SegmentCurrencyMAD);
+        Map.Add(TEXT("MDL"), SegmentCurrencyMDL);
+        Map.Add(TEXT("MGA"), SegmentCurrencyMGA);
+        Map.Add(TEXT("MKD"), SegmentCurrencyMKD);
+        Map.Add(TEXT("MMK"), SegmentCurrencyMMK);
+        Map.Add(TEXT("MNT"), SegmentCurrencyMNT);
+        Map.Add(TEXT("MOP"), SegmentCurrencyMOP);
+        Map.Add(TEXT("MRO"), SegmentCurrencyMRO);
+        Map.Add(TEXT("MUR"), SegmentCurrencyMUR);
+        Map.Add(TEXT("MVR"), SegmentCurrencyMVR);
+        Map.Add(TEXT("MWK"), SegmentCurrencyMWK);
+        Map.Add(TEXT("MXN"), SegmentCurrencyMXN);
+        Map.Add(TEXT("MYR"), SegmentCurrencyMYR);
+        Map.Add(TEXT("MZN"), SegmentCurrencyMZN);
+        Map.Add(TEXT("NAD"), SegmentCurrencyNAD);
+        Map.Add(TEXT("NGN"), SegmentCurrencyNGN);
+        Map.Add(TEXT("NIO"), SegmentCurrencyNIO);
+        Map.Add(TEXT("NOK"), SegmentCurrencyNOK);
+        Map.Add(TEXT("NPR"), SegmentCurrencyNPR);
+        Map.Add(TEXT("NZD"), SegmentCurrencyNZD);
+        Map.Add(TEXT("OMR"), SegmentCurrencyOMR);
+        Map.Add(TEXT("PAB"), SegmentCurrencyPAB);
+        Map.Add(TEXT("PEN"), SegmentCurrencyPEN);
+        Map.Add(TEXT("PGK"), SegmentCurrencyPGK);
+        Map.Add(TEXT("PHP"), SegmentCurrencyPHP);
+        Map.Add(TEXT("PKR"), SegmentCurrencyPKR);
+        Map.Add(TEXT("PLN"), SegmentCurrencyPLN);
+        Map.Add(TEXT("PYG"), SegmentCurrencyPYG);
+        Map.Add(TEXT("QAR"), SegmentCurrencyQAR);
+        Map.Add(TEXT("RON"), SegmentCurrencyRON);
+        Map.Add(TEXT("RSD"), SegmentCurrencyRSD);
+        Map.Add(TEXT("RUB"), SegmentCurrencyRUB);
+        Map.Add(TEXT("RWF"), SegmentCurrencyRWF);
+        Map.Add(TEXT("SAR"), SegmentCurrencySAR);
+        Map.Add(TEXT("SBD"), SegmentCurrencySBD);
+        Map.Add(TEXT("SCR"), SegmentCurrencySCR);
+        Map.Add(TEXT("SDG"), SegmentCurrencySDG);
+        Map.Add(TEXT("SEK"), SegmentCurrencySEK);
+        Map.Add(TEXT("SGD"), SegmentCurrencySGD);
+        Map.Add(TEXT("SHP"), SegmentCurrencySHP);
+        Map.Add(TEXT("SLL"), SegmentCurrencySLL);
+        Map.Add(TEXT("SOS"), SegmentCurrencySOS);
+        Map.Add(TEXT("SPL"), SegmentCurrencySPL);
+        Map.Add(TEXT("SRD"), SegmentCurrencySRD);
+        Map.Add(TEXT("STD"), SegmentCurrencySTD);
+        Map.Add(TEXT("SVC"), SegmentCurrencySVC);
+        Map.Add(TEXT("SYP"), SegmentCurrencySYP);
+        Map.Add(TEXT("SZL"), SegmentCurrencySZL);
+        Map.Add(TEXT("THB"), SegmentCurrencyTHB);
+        Map.Add(TEXT("TJS"), SegmentCurrencyTJS);
+        Map.Add(TEXT("TMT"), SegmentCurrencyTMT);
+        Map.Add(TEXT("TND"), SegmentCurrencyTND);
+        Map.Add(TEXT("TOP"), SegmentCurrencyTOP);
+        Map.Add(TEXT("TRY"), SegmentCurrencyTRY);
+        Map.Add(TEXT("TTD"), SegmentCurrencyTTD);
+        Map.Add(TEXT("TVD"), SegmentCurrencyTVD);
+        Map.Add(TEXT("TWD"), SegmentCurrencyTWD);
+        Map.Add(TEXT("TZS"), SegmentCurrencyTZS);
+        Map.Add(TEXT("UAH"), SegmentCurrencyUAH);
+        Map.Add(TEXT("UGX"), SegmentCurrencyUGX);
+        Map.Add(TEXT("USD"), SegmentCurrencyUSD);
+        Map.Add(TEXT("UYU"), SegmentCurrencyUYU);
+        Map.Add(TEXT("UZS"), SegmentCurrencyUZS);
+        Map.Add(TEXT("VEF"), SegmentCurrencyVEF);
+        Map.Add(TEXT("VND"), SegmentCurrencyVND);
+        Map.Add(TEXT("VUV"), SegmentCurrencyVUV);
+        Map.Add(TEXT("WST"), SegmentCurrencyWST);
+        Map.Add(TEXT("XAF"), SegmentCurrencyXAF);
+        Map.Add(TEXT("XCD"), SegmentCurrencyXCD);
+        Map.Add(TEXT("XDR"), SegmentCurrencyXDR);
+        Map.Add(TEXT("XOF"), SegmentCurrencyXOF);
+        Map.Add(TEXT("XPF"), SegmentCurrencyXPF);
+        Map.Add(TEXT("YER"), SegmentCurrencyYER);
+        Map.Add(TEXT("ZAR"), SegmentCurrencyZAR);
+        Map.Add(TEXT("ZMW"), SegmentCurrencyZMW);
+        Map.Add(TEXT("ZWD"), SegmentCurrencyZWD);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -8232,11 +8223,7 @@ bool PlayFab::AdminModels::FSegmentOrDefinition::readFromValue(const TSharedPtr<
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&SegmentAndDefinitionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("SegmentAndDefinitions"));
-    for (int32 Idx = 0; Idx < SegmentAndDefinitionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SegmentAndDefinitionsArray[Idx];
-        SegmentAndDefinitions.Add(FSegmentAndDefinition(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SegmentAndDefinitionsArray, SegmentAndDefinitions);
 
 
     return HasSucceeded;
@@ -8314,11 +8301,7 @@ bool PlayFab::AdminModels::FSegmentModel::readFromValue(const TSharedPtr<FJsonOb
     }
 
     const TArray<TSharedPtr<FJsonValue>>&EnteredSegmentActionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("EnteredSegmentActions"));
-    for (int32 Idx = 0; Idx < EnteredSegmentActionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = EnteredSegmentActionsArray[Idx];
-        EnteredSegmentActions.Add(FSegmentTrigger(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(EnteredSegmentActionsArray, EnteredSegmentActions);
 
 
     const TSharedPtr<FJsonValue> LastUpdateTimeValue = obj->TryGetField(TEXT("LastUpdateTime"));
@@ -8327,11 +8310,7 @@ bool PlayFab::AdminModels::FSegmentModel::readFromValue(const TSharedPtr<FJsonOb
 
 
     const TArray<TSharedPtr<FJsonValue>>&LeftSegmentActionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("LeftSegmentActions"));
-    for (int32 Idx = 0; Idx < LeftSegmentActionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeftSegmentActionsArray[Idx];
-        LeftSegmentActions.Add(FSegmentTrigger(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeftSegmentActionsArray, LeftSegmentActions);
 
 
     const TSharedPtr<FJsonValue> NameValue = obj->TryGetField(TEXT("Name"));
@@ -8349,11 +8328,7 @@ bool PlayFab::AdminModels::FSegmentModel::readFromValue(const TSharedPtr<FJsonOb
     }
 
     const TArray<TSharedPtr<FJsonValue>>&SegmentOrDefinitionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("SegmentOrDefinitions"));
-    for (int32 Idx = 0; Idx < SegmentOrDefinitionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SegmentOrDefinitionsArray[Idx];
-        SegmentOrDefinitions.Add(FSegmentOrDefinition(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SegmentOrDefinitionsArray, SegmentOrDefinitions);
 
 
     return HasSucceeded;
@@ -8641,174 +8616,174 @@ AdminModels::Currency PlayFab::AdminModels::readCurrencyFromValue(const TSharedP
 
 AdminModels::Currency PlayFab::AdminModels::readCurrencyFromValue(const FString& value)
 {
-    static TMap<FString, Currency> _CurrencyMap;
-    if (_CurrencyMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _CurrencyMap.Add(TEXT("AED"), CurrencyAED);
-        _CurrencyMap.Add(TEXT("AFN"), CurrencyAFN);
-        _CurrencyMap.Add(TEXT("ALL"), CurrencyALL);
-        _CurrencyMap.Add(TEXT("AMD"), CurrencyAMD);
-        _CurrencyMap.Add(TEXT("ANG"), CurrencyANG);
-        _CurrencyMap.Add(TEXT("AOA"), CurrencyAOA);
-        _CurrencyMap.Add(TEXT("ARS"), CurrencyARS);
-        _CurrencyMap.Add(TEXT("AUD"), CurrencyAUD);
-        _CurrencyMap.Add(TEXT("AWG"), CurrencyAWG);
-        _CurrencyMap.Add(TEXT("AZN"), CurrencyAZN);
-        _CurrencyMap.Add(TEXT("BAM"), CurrencyBAM);
-        _CurrencyMap.Add(TEXT("BBD"), CurrencyBBD);
-        _CurrencyMap.Add(TEXT("BDT"), CurrencyBDT);
-        _CurrencyMap.Add(TEXT("BGN"), CurrencyBGN);
-        _CurrencyMap.Add(TEXT("BHD"), CurrencyBHD);
-        _CurrencyMap.Add(TEXT("BIF"), CurrencyBIF);
-        _CurrencyMap.Add(TEXT("BMD"), CurrencyBMD);
-        _CurrencyMap.Add(TEXT("BND"), CurrencyBND);
-        _CurrencyMap.Add(TEXT("BOB"), CurrencyBOB);
-        _CurrencyMap.Add(TEXT("BRL"), CurrencyBRL);
-        _CurrencyMap.Add(TEXT("BSD"), CurrencyBSD);
-        _CurrencyMap.Add(TEXT("BTN"), CurrencyBTN);
-        _CurrencyMap.Add(TEXT("BWP"), CurrencyBWP);
-        _CurrencyMap.Add(TEXT("BYR"), CurrencyBYR);
-        _CurrencyMap.Add(TEXT("BZD"), CurrencyBZD);
-        _CurrencyMap.Add(TEXT("CAD"), CurrencyCAD);
-        _CurrencyMap.Add(TEXT("CDF"), CurrencyCDF);
-        _CurrencyMap.Add(TEXT("CHF"), CurrencyCHF);
-        _CurrencyMap.Add(TEXT("CLP"), CurrencyCLP);
-        _CurrencyMap.Add(TEXT("CNY"), CurrencyCNY);
-        _CurrencyMap.Add(TEXT("COP"), CurrencyCOP);
-        _CurrencyMap.Add(TEXT("CRC"), CurrencyCRC);
-        _CurrencyMap.Add(TEXT("CUC"), CurrencyCUC);
-        _CurrencyMap.Add(TEXT("CUP"), CurrencyCUP);
-        _CurrencyMap.Add(TEXT("CVE"), CurrencyCVE);
-        _CurrencyMap.Add(TEXT("CZK"), CurrencyCZK);
-        _CurrencyMap.Add(TEXT("DJF"), CurrencyDJF);
-        _CurrencyMap.Add(TEXT("DKK"), CurrencyDKK);
-        _CurrencyMap.Add(TEXT("DOP"), CurrencyDOP);
-        _CurrencyMap.Add(TEXT("DZD"), CurrencyDZD);
-        _CurrencyMap.Add(TEXT("EGP"), CurrencyEGP);
-        _CurrencyMap.Add(TEXT("ERN"), CurrencyERN);
-        _CurrencyMap.Add(TEXT("ETB"), CurrencyETB);
-        _CurrencyMap.Add(TEXT("EUR"), CurrencyEUR);
-        _CurrencyMap.Add(TEXT("FJD"), CurrencyFJD);
-        _CurrencyMap.Add(TEXT("FKP"), CurrencyFKP);
-        _CurrencyMap.Add(TEXT("GBP"), CurrencyGBP);
-        _CurrencyMap.Add(TEXT("GEL"), CurrencyGEL);
-        _CurrencyMap.Add(TEXT("GGP"), CurrencyGGP);
-        _CurrencyMap.Add(TEXT("GHS"), CurrencyGHS);
-        _CurrencyMap.Add(TEXT("GIP"), CurrencyGIP);
-        _CurrencyMap.Add(TEXT("GMD"), CurrencyGMD);
-        _CurrencyMap.Add(TEXT("GNF"), CurrencyGNF);
-        _CurrencyMap.Add(TEXT("GTQ"), CurrencyGTQ);
-        _CurrencyMap.Add(TEXT("GYD"), CurrencyGYD);
-        _CurrencyMap.Add(TEXT("HKD"), CurrencyHKD);
-        _CurrencyMap.Add(TEXT("HNL"), CurrencyHNL);
-        _CurrencyMap.Add(TEXT("HRK"), CurrencyHRK);
-        _CurrencyMap.Add(TEXT("HTG"), CurrencyHTG);
-        _CurrencyMap.Add(TEXT("HUF"), CurrencyHUF);
-        _CurrencyMap.Add(TEXT("IDR"), CurrencyIDR);
-        _CurrencyMap.Add(TEXT("ILS"), CurrencyILS);
-        _CurrencyMap.Add(TEXT("IMP"), CurrencyIMP);
-        _CurrencyMap.Add(TEXT("INR"), CurrencyINR);
-        _CurrencyMap.Add(TEXT("IQD"), CurrencyIQD);
-        _CurrencyMap.Add(TEXT("IRR"), CurrencyIRR);
-        _CurrencyMap.Add(TEXT("ISK"), CurrencyISK);
-        _CurrencyMap.Add(TEXT("JEP"), CurrencyJEP);
-        _CurrencyMap.Add(TEXT("JMD"), CurrencyJMD);
-        _CurrencyMap.Add(TEXT("JOD"), CurrencyJOD);
-        _CurrencyMap.Add(TEXT("JPY"), CurrencyJPY);
-        _CurrencyMap.Add(TEXT("KES"), CurrencyKES);
-        _CurrencyMap.Add(TEXT("KGS"), CurrencyKGS);
-        _CurrencyMap.Add(TEXT("KHR"), CurrencyKHR);
-        _CurrencyMap.Add(TEXT("KMF"), CurrencyKMF);
-        _CurrencyMap.Add(TEXT("KPW"), CurrencyKPW);
-        _CurrencyMap.Add(TEXT("KRW"), CurrencyKRW);
-        _CurrencyMap.Add(TEXT("KWD"), CurrencyKWD);
-        _CurrencyMap.Add(TEXT("KYD"), CurrencyKYD);
-        _CurrencyMap.Add(TEXT("KZT"), CurrencyKZT);
-        _CurrencyMap.Add(TEXT("LAK"), CurrencyLAK);
-        _CurrencyMap.Add(TEXT("LBP"), CurrencyLBP);
-        _CurrencyMap.Add(TEXT("LKR"), CurrencyLKR);
-        _CurrencyMap.Add(TEXT("LRD"), CurrencyLRD);
-        _CurrencyMap.Add(TEXT("LSL"), CurrencyLSL);
-        _CurrencyMap.Add(TEXT("LYD"), CurrencyLYD);
-        _CurrencyMap.Add(TEXT("MAD"), CurrencyMAD);
-        _CurrencyMap.Add(TEXT("MDL"), CurrencyMDL);
-        _CurrencyMap.Add(TEXT("MGA"), CurrencyMGA);
-        _CurrencyMap.Add(TEXT("MKD"), CurrencyMKD);
-        _CurrencyMap.Add(TEXT("MMK"), CurrencyMMK);
-        _CurrencyMap.Add(TEXT("MNT"), CurrencyMNT);
-        _CurrencyMap.Add(TEXT("MOP"), CurrencyMOP);
-        _CurrencyMap.Add(TEXT("MRO"), CurrencyMRO);
-        _CurrencyMap.Add(TEXT("MUR"), CurrencyMUR);
-        _CurrencyMap.Add(TEXT("MVR"), CurrencyMVR);
-        _CurrencyMap.Add(TEXT("MWK"), CurrencyMWK);
-        _CurrencyMap.Add(TEXT("MXN"), CurrencyMXN);
-        _CurrencyMap.Add(TEXT("MYR"), CurrencyMYR);
-        _CurrencyMap.Add(TEXT("MZN"), CurrencyMZN);
-        _CurrencyMap.Add(TEXT("NAD"), CurrencyNAD);
-        _CurrencyMap.Add(TEXT("NGN"), CurrencyNGN);
-        _CurrencyMap.Add(TEXT("NIO"), CurrencyNIO);
-        _CurrencyMap.Add(TEXT("NOK"), CurrencyNOK);
-        _CurrencyMap.Add(TEXT("NPR"), CurrencyNPR);
-        _CurrencyMap.Add(TEXT("NZD"), CurrencyNZD);
-        _CurrencyMap.Add(TEXT("OMR"), CurrencyOMR);
-        _CurrencyMap.Add(TEXT("PAB"), CurrencyPAB);
-        _CurrencyMap.Add(TEXT("PEN"), CurrencyPEN);
-        _CurrencyMap.Add(TEXT("PGK"), CurrencyPGK);
-        _CurrencyMap.Add(TEXT("PHP"), CurrencyPHP);
-        _CurrencyMap.Add(TEXT("PKR"), CurrencyPKR);
-        _CurrencyMap.Add(TEXT("PLN"), CurrencyPLN);
-        _CurrencyMap.Add(TEXT("PYG"), CurrencyPYG);
-        _CurrencyMap.Add(TEXT("QAR"), CurrencyQAR);
-        _CurrencyMap.Add(TEXT("RON"), CurrencyRON);
-        _CurrencyMap.Add(TEXT("RSD"), CurrencyRSD);
-        _CurrencyMap.Add(TEXT("RUB"), CurrencyRUB);
-        _CurrencyMap.Add(TEXT("RWF"), CurrencyRWF);
-        _CurrencyMap.Add(TEXT("SAR"), CurrencySAR);
-        _CurrencyMap.Add(TEXT("SBD"), CurrencySBD);
-        _CurrencyMap.Add(TEXT("SCR"), CurrencySCR);
-        _CurrencyMap.Add(TEXT("SDG"), CurrencySDG);
-        _CurrencyMap.Add(TEXT("SEK"), CurrencySEK);
-        _CurrencyMap.Add(TEXT("SGD"), CurrencySGD);
-        _CurrencyMap.Add(TEXT("SHP"), CurrencySHP);
-        _CurrencyMap.Add(TEXT("SLL"), CurrencySLL);
-        _CurrencyMap.Add(TEXT("SOS"), CurrencySOS);
-        _CurrencyMap.Add(TEXT("SPL"), CurrencySPL);
-        _CurrencyMap.Add(TEXT("SRD"), CurrencySRD);
-        _CurrencyMap.Add(TEXT("STD"), CurrencySTD);
-        _CurrencyMap.Add(TEXT("SVC"), CurrencySVC);
-        _CurrencyMap.Add(TEXT("SYP"), CurrencySYP);
-        _CurrencyMap.Add(TEXT("SZL"), CurrencySZL);
-        _CurrencyMap.Add(TEXT("THB"), CurrencyTHB);
-        _CurrencyMap.Add(TEXT("TJS"), CurrencyTJS);
-        _CurrencyMap.Add(TEXT("TMT"), CurrencyTMT);
-        _CurrencyMap.Add(TEXT("TND"), CurrencyTND);
-        _CurrencyMap.Add(TEXT("TOP"), CurrencyTOP);
-        _CurrencyMap.Add(TEXT("TRY"), CurrencyTRY);
-        _CurrencyMap.Add(TEXT("TTD"), CurrencyTTD);
-        _CurrencyMap.Add(TEXT("TVD"), CurrencyTVD);
-        _CurrencyMap.Add(TEXT("TWD"), CurrencyTWD);
-        _CurrencyMap.Add(TEXT("TZS"), CurrencyTZS);
-        _CurrencyMap.Add(TEXT("UAH"), CurrencyUAH);
-        _CurrencyMap.Add(TEXT("UGX"), CurrencyUGX);
-        _CurrencyMap.Add(TEXT("USD"), CurrencyUSD);
-        _CurrencyMap.Add(TEXT("UYU"), CurrencyUYU);
-        _CurrencyMap.Add(TEXT("UZS"), CurrencyUZS);
-        _CurrencyMap.Add(TEXT("VEF"), CurrencyVEF);
-        _CurrencyMap.Add(TEXT("VND"), CurrencyVND);
-        _CurrencyMap.Add(TEXT("VUV"), CurrencyVUV);
-        _CurrencyMap.Add(TEXT("WST"), CurrencyWST);
-        _CurrencyMap.Add(TEXT("XAF"), CurrencyXAF);
-        _CurrencyMap.Add(TEXT("XCD"), CurrencyXCD);
-        _CurrencyMap.Add(TEXT("XDR"), CurrencyXDR);
-        _CurrencyMap.Add(TEXT("XOF"), CurrencyXOF);
-        _CurrencyMap.Add(TEXT("XPF"), CurrencyXPF);
-        _CurrencyMap.Add(TEXT("YER"), CurrencyYER);
-        _CurrencyMap.Add(TEXT("ZAR"), CurrencyZAR);
-        _CurrencyMap.Add(TEXT("ZMW"), CurrencyZMW);
-        _CurrencyMap.Add(TEXT("ZWD"), CurrencyZWD);
-
-    }
+    static const TMap<FString, Currency> _CurrencyMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, Currency> Map;
+        Map.Add(TEXT("AED"), CurrencyAED);
+        Map.Add(TEXT("AFN"), CurrencyAFN);
+        Map.Add(TEXT("ALL"), CurrencyALL);
+        Map.Add(TEXT("AMD"), CurrencyAMD);
+        Map.Add(TEXT("ANG"), CurrencyANG);
+        Map.Add(TEXT("AOA"), CurrencyAOA);
+        Map.Add(TEXT("ARS"), CurrencyARS);
+        Map.Add(TEXT("AUD"), CurrencyAUD);
+        Map.Add(TEXT("AWG"), CurrencyAWG);
+        Map.Add(TEXT("AZN"), CurrencyAZN);
+        Map.Add(TEXT("BAM"), CurrencyBAM);
+        Map.Add(TEXT("BBD"), CurrencyBBD);
+        Map.Add(TEXT("BDT"), CurrencyBDT);
+        Map.Add(TEXT("BGN"), CurrencyBGN);
+        Map.Add(TEXT("BHD"), CurrencyBHD);
+        Map.Add(TEXT("BIF"), CurrencyBIF);
+        Map.Add(TEXT("BMD"), CurrencyBMD);
+        Map.Add(TEXT("BND"), CurrencyBND);
+        Map.Add(TEXT("BOB"), CurrencyBOB);
+        Map.Add(TEXT("BRL"), CurrencyBRL);
+        Map.Add(TEXT("BSD"), CurrencyBSD);
+        Map.Add(TEXT("BTN"), CurrencyBTN);
+        Map.Add(TEXT("BWP"), CurrencyBWP);
+        Map.Add(TEXT("BYR"), CurrencyBYR);
+        Map.Add(TEXT("BZD"), CurrencyBZD);
+        Map.Add(TEXT("CAD"), CurrencyCAD);
+        Map.Add(TEXT("CDF"), CurrencyCDF);
+        Map.Add(TEXT("CHF"), CurrencyCHF);
+        Map.Add(TEXT("CLP"), CurrencyCLP);
+        Map.Add(TEXT("CNY"), CurrencyCNY);
+        Map.Add(TEXT("COP"), CurrencyCOP);
+        Map.Add(TEXT("CRC"), CurrencyCRC);
+        Map.Add(TEXT("CUC"), CurrencyCUC);
+        Map.Add(TEXT("CUP"), CurrencyCUP);
+        Map.Add(TEXT("CVE"), CurrencyCVE);
+        Map.Add(TEXT("CZK"), CurrencyCZK);
+        Map.Add(TEXT("DJF"), CurrencyDJF);
+        Map.Add(TEXT("DKK"), CurrencyDKK);
+        Map.Add(TEXT("DOP"), CurrencyDOP);
+        Map.Add(TEXT("DZD"), CurrencyDZD);
+        Map.Add(TEXT("EGP"), CurrencyEGP);
+        Map.Add(TEXT("ERN"), CurrencyERN);
+        Map.Add(TEXT("ETB"), CurrencyETB);
+        Map.Add(TEXT("EUR"), CurrencyEUR);
+        Map.Add(TEXT("FJD"), CurrencyFJD);
+        Map.Add(TEXT("FKP"), CurrencyFKP);
+        Map.Add(TEXT("GBP"), CurrencyGBP);
+        Map.Add(TEXT("GEL"), CurrencyGEL);
+        Map.Add(TEXT("GGP"), CurrencyGGP);
+        Map.Add(TEXT("GHS"), CurrencyGHS);
+        Map.Add(TEXT("GIP"), CurrencyGIP);
+        Map.Add(TEXT("GMD"), CurrencyGMD);
+        Map.Add(TEXT("GNF"), CurrencyGNF);
+        Map.Add(TEXT("GTQ"), CurrencyGTQ);
+        Map.Add(TEXT("GYD"), CurrencyGYD);
+        Map.Add(TEXT("HKD"), CurrencyHKD);
+        Map.Add(TEXT("HNL"), CurrencyHNL);
+        Map.Add(TEXT("HRK"), CurrencyHRK);
+        Map.Add(TEXT("HTG"), CurrencyHTG);
+        Map.Add(TEXT("HUF"), CurrencyHUF);
+        Map.Add(TEXT("IDR"), CurrencyIDR);
+        Map.Add(TEXT("ILS"), CurrencyILS);
+        Map.Add(TEXT("IMP"), CurrencyIMP);
+        Map.Add(TEXT("INR"), CurrencyINR);
+        Map.Add(TEXT("IQD"), CurrencyIQD);
+        Map.Add(TEXT("IRR"), CurrencyIRR);
+        Map.Add(TEXT("ISK"), CurrencyISK);
+        Map.Add(TEXT("JEP"), CurrencyJEP);
+        Map.Add(TEXT("JMD"), CurrencyJMD);
+        Map.Add(TEXT("JOD"), CurrencyJOD);
+        Map.Add(TEXT("JPY"), CurrencyJPY);
+        Map.Add(TEXT("KES"), CurrencyKES);
+        Map.Add(TEXT("KGS"), CurrencyKGS);
+        Map.Add(TEXT("KHR"), CurrencyKHR);
+        Map.Add(TEXT("KMF"), CurrencyKMF);
+        Map.Add(TEXT("KPW"), CurrencyKPW);
+        Map.Add(TEXT("KRW"), CurrencyKRW);
+        Map.Add(TEXT("KWD"), CurrencyKWD);
+        Map.Add(TEXT("KYD"), CurrencyKYD);
+        Map.Add(TEXT("KZT"), CurrencyKZT);
+        Map.Add(TEXT("LAK"), CurrencyLAK);
+        Map.Add(TEXT("LBP"), CurrencyLBP);
+        Map.Add(TEXT("LKR"), CurrencyLKR);
+        Map.Add(TEXT("LRD"), CurrencyLRD);
+        Map.Add(TEXT("LSL"), CurrencyLSL);
+        Map.Add(TEXT("LYD"), CurrencyLYD);
+        Map.Add(TEXT("MAD"), CurrencyMAD);
+        Map.Add(TEXT("MDL"), CurrencyMDL);
+        Map.Add(TEXT("MGA"), CurrencyMGA);
+        Map.Add(TEXT("MKD"), CurrencyMKD);
+        Map.Add(TEXT("MMK"), CurrencyMMK);
+        Map.Add(TEXT("MNT"), CurrencyMNT);
+        Map.Add(TEXT("MOP"), CurrencyMOP);
+        Map.Add(TEXT("MRO"), CurrencyMRO);
+        Map.Add(TEXT("MUR"), CurrencyMUR);
+        Map.Add(TEXT("MVR"), CurrencyMVR);
+        Map.Add(TEXT("MWK"), CurrencyMWK);
+        Map.Add(TEXT("MXN"), CurrencyMXN);
+        Map.Add(TEXT("MYR"), CurrencyMYR);
+        Map.Add(TEXT("MZN"), CurrencyMZN);
+        Map.Add(TEXT("NAD"), CurrencyNAD);
+        Map.Add(TEXT("NGN"), CurrencyNGN);
+        Map.Add(TEXT("NIO"), CurrencyNIO);
+        Map.Add(TEXT("NOK"), CurrencyNOK);
+        Map.Add(TEXT("NPR"), CurrencyNPR);
+        Map.Add(TEXT("NZD"), CurrencyNZD);
+        Map.Add(TEXT("OMR"), CurrencyOMR);
+        Map.Add(TEXT("PAB"), CurrencyPAB);
+        Map.Add(TEXT("PEN"), CurrencyPEN);
+        Map.Add(TEXT("PGK"), CurrencyPGK);
+        Map.Add(TEXT("PHP"), CurrencyPHP);
+        Map.Add(TEXT("PKR"), CurrencyPKR);
+        Map.Add(TEXT("PLN"), CurrencyPLN);
+        Map.Add(TEXT("PYG"), CurrencyPYG);
+        Map.Add(TEXT("QAR"), CurrencyQAR);
+        Map.Add(TEXT("RON"), CurrencyRON);
+        Map.Add(TEXT("RSD"), CurrencyRSD);
+        Map.Add(TEXT("RUB"), CurrencyRUB);
+        Map.Add(TEXT("RWF"), CurrencyRWF);
+        Map.Add(TEXT("SAR"), CurrencySAR);
+        Map.Add(TEXT("SBD"), CurrencySBD);
+        Map.Add(TEXT("SCR"), CurrencySCR);
+        Map.Add(TEXT("SDG"), CurrencySDG);
+        Map.Add(TEXT("SEK"), CurrencySEK);
+        Map.Add(TEXT("SGD"), CurrencySGD);
+        Map.Add(TEXT("SHP"), CurrencySHP);
+        Map.Add(TEXT("SLL"), CurrencySLL);
+        Map.Add(TEXT("SOS"), CurrencySOS);
+        Map.Add(TEXT("SPL"), CurrencySPL);
+        Map.Add(TEXT("SRD"), CurrencySRD);
+        Map.Add(TEXT("STD"), CurrencySTD);
+        Map.Add(TEXT("SVC"), CurrencySVC);
+        Map.Add(TEXT("SYP"), CurrencySYP);
+        Map.Add(TEXT("SZL"), CurrencySZL);
+        Map.Add(TEXT("THB"), CurrencyTHB);
+        Map.Add(TEXT("TJS"), CurrencyTJS);
+        Map.Add(TEXT("TMT"), CurrencyTMT);
+        Map.Add(TEXT("TND"), CurrencyTND);
+        Map.Add(TEXT("TOP"), CurrencyTOP);
+        Map.Add(TEXT("TRY"), CurrencyTRY);
+        Map.Add(TEXT("TTD"), CurrencyTTD);
+        Map.Add(TEXT("TVD"), CurrencyTVD);
+        Map.Add(TEXT("TWD"), CurrencyTWD);
+        Map.Add(TEXT("TZS"), CurrencyTZS);
+        Map.Add(TEXT("UAH"), CurrencyUAH);
+        Map.Add(TEXT("UGX"), CurrencyUGX);
+        Map.Add(TEXT("USD"), CurrencyUSD);
+        Map.Add(TEXT("UYU"), CurrencyUYU);
+        Map.Add(TEXT("UZS"), CurrencyUZS);
+        Map.Add(TEXT("VEF"), CurrencyVEF);
+        Map.Add(TEXT("VND"), CurrencyVND);
+        Map.Add(TEXT("VUV"), CurrencyVUV);
+        Map.Add(TEXT("WST"), CurrencyWST);
+        Map.Add(TEXT("XAF"), CurrencyXAF);
+        Map.Add(TEXT("XCD"), CurrencyXCD);
+        Map.Add(TEXT("XDR"), CurrencyXDR);
+        Map.Add(TEXT("XOF"), CurrencyXOF);
+        Map.Add(TEXT("XPF"), CurrencyXPF);
+        Map.Add(TEXT("YER"), CurrencyYER);
+        Map.Add(TEXT("ZAR"), CurrencyZAR);
+        Map.Add(TEXT("ZMW"), CurrencyZMW);
+        Map.Add(TEXT("ZWD"), CurrencyZWD);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -8964,7 +8939,7 @@ void PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::writeJSON(JsonWrit
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -9050,7 +9025,7 @@ void PlayFab::AdminModels::FDeleteMasterPlayerEventDataRequest::writeJSON(JsonWr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -9126,7 +9101,7 @@ void PlayFab::AdminModels::FDeleteMembershipSubscriptionRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!SubscriptionId.IsEmpty() == false)
@@ -9149,6 +9124,7 @@ bool PlayFab::AdminModels::FDeleteMembershipSubscriptionRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9267,7 +9243,7 @@ void PlayFab::AdminModels::FDeletePlayerCustomPropertiesRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("PropertyNames"));
@@ -9286,6 +9262,7 @@ bool PlayFab::AdminModels::FDeletePlayerCustomPropertiesRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9332,7 +9309,7 @@ void PlayFab::AdminModels::FDeletePlayerCustomPropertiesResult::writeJSON(JsonWr
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("PropertiesVersion"));
@@ -9346,11 +9323,7 @@ bool PlayFab::AdminModels::FDeletePlayerCustomPropertiesResult::readFromValue(co
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DeletedPropertiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("DeletedProperties"));
-    for (int32 Idx = 0; Idx < DeletedPropertiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DeletedPropertiesArray[Idx];
-        DeletedProperties.Add(FDeletedPropertyDetails(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DeletedPropertiesArray, DeletedProperties);
 
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -9386,7 +9359,7 @@ void PlayFab::AdminModels::FDeletePlayerRequest::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -9597,6 +9570,7 @@ bool PlayFab::AdminModels::FDeleteStoreRequest::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9774,14 +9748,14 @@ AdminModels::EffectType PlayFab::AdminModels::readEffectTypeFromValue(const TSha
 
 AdminModels::EffectType PlayFab::AdminModels::readEffectTypeFromValue(const FString& value)
 {
-    static TMap<FString, EffectType> _EffectTypeMap;
-    if (_EffectTypeMap.Num() == 0)
+    static const TMap<FString, EffectType> _EffectTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _EffectTypeMap.Add(TEXT("Allow"), EffectTypeAllow);
-        _EffectTypeMap.Add(TEXT("Deny"), EffectTypeDeny);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, EffectType> Map;
+        Map.Add(TEXT("Allow"), EffectTypeAllow);
+        Map.Add(TEXT("Deny"), EffectTypeDeny);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -9828,7 +9802,7 @@ void PlayFab::AdminModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -9877,7 +9851,7 @@ void PlayFab::AdminModels::FExportMasterPlayerDataRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -10162,11 +10136,7 @@ bool PlayFab::AdminModels::FGetAllSegmentsResult::readFromValue(const TSharedPtr
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&SegmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Segments"));
-    for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SegmentsArray, Segments);
 
 
     return HasSucceeded;
@@ -10230,11 +10200,7 @@ bool PlayFab::AdminModels::FGetCatalogItemsResult::readFromValue(const TSharedPt
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&CatalogArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Catalog"));
-    for (int32 Idx = 0; Idx < CatalogArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CatalogArray[Idx];
-        Catalog.Add(FCatalogItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CatalogArray, Catalog);
 
 
     return HasSucceeded;
@@ -10328,11 +10294,7 @@ bool PlayFab::AdminModels::FGetCloudScriptRevisionResult::readFromValue(const TS
 
 
     const TArray<TSharedPtr<FJsonValue>>&FilesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Files"));
-    for (int32 Idx = 0; Idx < FilesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FilesArray[Idx];
-        Files.Add(FCloudScriptFile(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FilesArray, Files);
 
 
     const TSharedPtr<FJsonValue> IsPublishedValue = obj->TryGetField(TEXT("IsPublished"));
@@ -10449,11 +10411,7 @@ bool PlayFab::AdminModels::FGetCloudScriptVersionsResult::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&VersionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Versions"));
-    for (int32 Idx = 0; Idx < VersionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VersionsArray[Idx];
-        Versions.Add(FCloudScriptVersionStatus(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VersionsArray, Versions);
 
 
     return HasSucceeded;
@@ -10523,11 +10481,7 @@ bool PlayFab::AdminModels::FGetContentListResult::readFromValue(const TSharedPtr
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ContentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Contents"));
-    for (int32 Idx = 0; Idx < ContentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContentsArray[Idx];
-        Contents.Add(FContentInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContentsArray, Contents);
 
 
     const TSharedPtr<FJsonValue> ItemCountValue = obj->TryGetField(TEXT("ItemCount"));
@@ -10742,7 +10696,7 @@ void PlayFab::AdminModels::FGetPlayedTitleListRequest::writeJSON(JsonWriter& wri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -10808,7 +10762,7 @@ void PlayFab::AdminModels::FGetPlayerCustomPropertyRequest::writeJSON(JsonWriter
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!PropertyName.IsEmpty() == false)
@@ -10858,7 +10812,7 @@ void PlayFab::AdminModels::FGetPlayerCustomPropertyResult::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("PropertiesVersion"));
@@ -10953,7 +10907,7 @@ void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::writeJSON(JsonWriter
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -11190,7 +11144,7 @@ void PlayFab::AdminModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& write
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (ProfileConstraints.IsValid())
@@ -11209,6 +11163,7 @@ bool PlayFab::AdminModels::FGetPlayerProfileRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11270,36 +11225,36 @@ AdminModels::LoginIdentityProvider PlayFab::AdminModels::readLoginIdentityProvid
 
 AdminModels::LoginIdentityProvider PlayFab::AdminModels::readLoginIdentityProviderFromValue(const FString& value)
 {
-    static TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap;
-    if (_LoginIdentityProviderMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _LoginIdentityProviderMap.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
-        _LoginIdentityProviderMap.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
-        _LoginIdentityProviderMap.Add(TEXT("Custom"), LoginIdentityProviderCustom);
-        _LoginIdentityProviderMap.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
-        _LoginIdentityProviderMap.Add(TEXT("Steam"), LoginIdentityProviderSteam);
-        _LoginIdentityProviderMap.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
-        _LoginIdentityProviderMap.Add(TEXT("PSN"), LoginIdentityProviderPSN);
-        _LoginIdentityProviderMap.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
-        _LoginIdentityProviderMap.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
-        _LoginIdentityProviderMap.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
-        _LoginIdentityProviderMap.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
-        _LoginIdentityProviderMap.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
-        _LoginIdentityProviderMap.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
-        _LoginIdentityProviderMap.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
-        _LoginIdentityProviderMap.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
-        _LoginIdentityProviderMap.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
-        _LoginIdentityProviderMap.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
-        _LoginIdentityProviderMap.Add(TEXT("Apple"), LoginIdentityProviderApple);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
-        _LoginIdentityProviderMap.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
-        _LoginIdentityProviderMap.Add(TEXT("King"), LoginIdentityProviderKing);
-
-    }
+    static const TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, LoginIdentityProvider> Map;
+        Map.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
+        Map.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
+        Map.Add(TEXT("Custom"), LoginIdentityProviderCustom);
+        Map.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
+        Map.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
+        Map.Add(TEXT("Steam"), LoginIdentityProviderSteam);
+        Map.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
+        Map.Add(TEXT("PSN"), LoginIdentityProviderPSN);
+        Map.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
+        Map.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
+        Map.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
+        Map.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
+        Map.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
+        Map.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
+        Map.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
+        Map.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
+        Map.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
+        Map.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
+        Map.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
+        Map.Add(TEXT("Apple"), LoginIdentityProviderApple);
+        Map.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
+        Map.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
+        Map.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
+        Map.Add(TEXT("King"), LoginIdentityProviderKing);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -11474,20 +11429,20 @@ AdminModels::SubscriptionProviderStatus PlayFab::AdminModels::readSubscriptionPr
 
 AdminModels::SubscriptionProviderStatus PlayFab::AdminModels::readSubscriptionProviderStatusFromValue(const FString& value)
 {
-    static TMap<FString, SubscriptionProviderStatus> _SubscriptionProviderStatusMap;
-    if (_SubscriptionProviderStatusMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _SubscriptionProviderStatusMap.Add(TEXT("NoError"), SubscriptionProviderStatusNoError);
-        _SubscriptionProviderStatusMap.Add(TEXT("Cancelled"), SubscriptionProviderStatusCancelled);
-        _SubscriptionProviderStatusMap.Add(TEXT("UnknownError"), SubscriptionProviderStatusUnknownError);
-        _SubscriptionProviderStatusMap.Add(TEXT("BillingError"), SubscriptionProviderStatusBillingError);
-        _SubscriptionProviderStatusMap.Add(TEXT("ProductUnavailable"), SubscriptionProviderStatusProductUnavailable);
-        _SubscriptionProviderStatusMap.Add(TEXT("CustomerDidNotAcceptPriceChange"), SubscriptionProviderStatusCustomerDidNotAcceptPriceChange);
-        _SubscriptionProviderStatusMap.Add(TEXT("FreeTrial"), SubscriptionProviderStatusFreeTrial);
-        _SubscriptionProviderStatusMap.Add(TEXT("PaymentPending"), SubscriptionProviderStatusPaymentPending);
-
-    }
+    static const TMap<FString, SubscriptionProviderStatus> _SubscriptionProviderStatusMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SubscriptionProviderStatus> Map;
+        Map.Add(TEXT("NoError"), SubscriptionProviderStatusNoError);
+        Map.Add(TEXT("Cancelled"), SubscriptionProviderStatusCancelled);
+        Map.Add(TEXT("UnknownError"), SubscriptionProviderStatusUnknownError);
+        Map.Add(TEXT("BillingError"), SubscriptionProviderStatusBillingError);
+        Map.Add(TEXT("ProductUnavailable"), SubscriptionProviderStatusProductUnavailable);
+        Map.Add(TEXT("CustomerDidNotAcceptPriceChange"), SubscriptionProviderStatusCustomerDidNotAcceptPriceChange);
+        Map.Add(TEXT("FreeTrial"), SubscriptionProviderStatusFreeTrial);
+        Map.Add(TEXT("PaymentPending"), SubscriptionProviderStatusPaymentPending);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -11672,11 +11627,7 @@ bool PlayFab::AdminModels::FMembershipModel::readFromValue(const TSharedPtr<FJso
     }
 
     const TArray<TSharedPtr<FJsonValue>>&SubscriptionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Subscriptions"));
-    for (int32 Idx = 0; Idx < SubscriptionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SubscriptionsArray[Idx];
-        Subscriptions.Add(FSubscriptionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SubscriptionsArray, Subscriptions);
 
 
     return HasSucceeded;
@@ -11699,14 +11650,14 @@ AdminModels::PushNotificationPlatform PlayFab::AdminModels::readPushNotification
 
 AdminModels::PushNotificationPlatform PlayFab::AdminModels::readPushNotificationPlatformFromValue(const FString& value)
 {
-    static TMap<FString, PushNotificationPlatform> _PushNotificationPlatformMap;
-    if (_PushNotificationPlatformMap.Num() == 0)
+    static const TMap<FString, PushNotificationPlatform> _PushNotificationPlatformMap = []()
     {
-        // Auto-generate the map on the first use
-        _PushNotificationPlatformMap.Add(TEXT("ApplePushNotificationService"), PushNotificationPlatformApplePushNotificationService);
-        _PushNotificationPlatformMap.Add(TEXT("GoogleCloudMessaging"), PushNotificationPlatformGoogleCloudMessaging);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, PushNotificationPlatform> Map;
+        Map.Add(TEXT("ApplePushNotificationService"), PushNotificationPlatformApplePushNotificationService);
+        Map.Add(TEXT("GoogleCloudMessaging"), PushNotificationPlatformGoogleCloudMessaging);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -12064,11 +12015,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AdCampaignAttributionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AdCampaignAttributions"));
-    for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttributionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AdCampaignAttributionsArray, AdCampaignAttributions);
 
 
     const TSharedPtr<FJsonValue> AvatarUrlValue = obj->TryGetField(TEXT("AvatarUrl"));
@@ -12084,11 +12031,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
 
 
     const TArray<TSharedPtr<FJsonValue>>&ContactEmailAddressesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ContactEmailAddresses"));
-    for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfoModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContactEmailAddressesArray, ContactEmailAddresses);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -12111,27 +12054,15 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
 
 
     const TArray<TSharedPtr<FJsonValue>>&LinkedAccountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("LinkedAccounts"));
-    for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FLinkedPlatformAccountModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LinkedAccountsArray, LinkedAccounts);
 
 
     const TArray<TSharedPtr<FJsonValue>>&LocationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Locations"));
-    for (int32 Idx = 0; Idx < LocationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LocationsArray[Idx];
-        Locations.Add(FLocationModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LocationsArray, Locations);
 
 
     const TArray<TSharedPtr<FJsonValue>>&MembershipsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Memberships"));
-    for (int32 Idx = 0; Idx < MembershipsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembershipsArray[Idx];
-        Memberships.Add(FMembershipModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembershipsArray, Memberships);
 
 
     Origination = readLoginIdentityProviderFromValue(obj->TryGetField(TEXT("Origination")));
@@ -12151,27 +12082,15 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PushNotificationRegistrationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PushNotificationRegistrations"));
-    for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistrationModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PushNotificationRegistrationsArray, PushNotificationRegistrations);
 
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     const TArray<TSharedPtr<FJsonValue>>&TagsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Tags"));
-    for (int32 Idx = 0; Idx < TagsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = TagsArray[Idx];
-        Tags.Add(FTagModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(TagsArray, Tags);
 
 
     const TSharedPtr<FJsonValue> TitleIdValue = obj->TryGetField(TEXT("TitleId"));
@@ -12189,11 +12108,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ValuesToDateArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ValuesToDate"));
-    for (int32 Idx = 0; Idx < ValuesToDateArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ValuesToDateArray[Idx];
-        ValuesToDate.Add(FValueToDateModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ValuesToDateArray, ValuesToDate);
 
 
     return HasSucceeded;
@@ -12257,11 +12172,7 @@ bool PlayFab::AdminModels::FGetPlayerSegmentsResult::readFromValue(const TShared
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&SegmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Segments"));
-    for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SegmentsArray, Segments);
 
 
     return HasSucceeded;
@@ -12367,11 +12278,7 @@ bool PlayFab::AdminModels::FGetPlayerSharedSecretsResult::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&SharedSecretsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("SharedSecrets"));
-    for (int32 Idx = 0; Idx < SharedSecretsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SharedSecretsArray[Idx];
-        SharedSecrets.Add(FSharedSecret(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SharedSecretsArray, SharedSecrets);
 
 
     return HasSucceeded;
@@ -12529,6 +12436,7 @@ bool PlayFab::AdminModels::FGetPlayersInSegmentRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13006,11 +12914,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AdCampaignAttributionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AdCampaignAttributions"));
-    for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttribution(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AdCampaignAttributionsArray, AdCampaignAttributions);
 
 
     const TSharedPtr<FJsonValue> AvatarUrlValue = obj->TryGetField(TEXT("AvatarUrl"));
@@ -13028,11 +12932,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     ChurnPrediction = readChurnRiskLevelFromValue(obj->TryGetField(TEXT("ChurnPrediction")));
 
     const TArray<TSharedPtr<FJsonValue>>&ContactEmailAddressesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ContactEmailAddresses"));
-    for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContactEmailAddressesArray, ContactEmailAddresses);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -13043,6 +12943,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     const TSharedPtr<FJsonObject>* CustomPropertiesObject;
     if (obj->TryGetObjectField(TEXT("CustomProperties"), CustomPropertiesObject))
     {
+        CustomProperties.Reserve((*CustomPropertiesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomPropertiesObject)->Values); It; ++It)
         {
             CustomProperties.Add(It.Key(), FJsonKeeper(It.Value()));
@@ -13062,16 +12963,13 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
 
 
     const TArray<TSharedPtr<FJsonValue>>&LinkedAccountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("LinkedAccounts"));
-    for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FPlayerLinkedAccount(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LinkedAccountsArray, LinkedAccounts);
 
 
     const TSharedPtr<FJsonObject>* LocationsObject;
     if (obj->TryGetObjectField(TEXT("Locations"), LocationsObject))
     {
+        Locations.Reserve((*LocationsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LocationsObject)->Values); It; ++It)
         {
             Locations.Add(It.Key(), FPlayerLocation(It.Value()->AsObject()));
@@ -13090,11 +12988,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PlayerStatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PlayerStatistics"));
-    for (int32 Idx = 0; Idx < PlayerStatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PlayerStatisticsArray[Idx];
-        PlayerStatistics.Add(FPlayerStatistic(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PlayerStatisticsArray, PlayerStatistics);
 
 
     const TSharedPtr<FJsonValue> PublisherIdValue = obj->TryGetField(TEXT("PublisherId"));
@@ -13105,11 +12999,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PushNotificationRegistrationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PushNotificationRegistrations"));
-    for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistration(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PushNotificationRegistrationsArray, PushNotificationRegistrations);
 
 
     const TSharedPtr<FJsonObject>* StatisticsObject;
@@ -13203,11 +13093,7 @@ bool PlayFab::AdminModels::FGetPlayersInSegmentResult::readFromValue(const TShar
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PlayerProfilesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PlayerProfiles"));
-    for (int32 Idx = 0; Idx < PlayerProfilesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PlayerProfilesArray[Idx];
-        PlayerProfiles.Add(FPlayerProfile(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PlayerProfilesArray, PlayerProfiles);
 
 
     const TSharedPtr<FJsonValue> ProfilesInSegmentValue = obj->TryGetField(TEXT("ProfilesInSegment"));
@@ -13247,7 +13133,7 @@ void PlayFab::AdminModels::FGetPlayersSegmentsRequest::writeJSON(JsonWriter& wri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -13260,6 +13146,7 @@ bool PlayFab::AdminModels::FGetPlayersSegmentsRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13321,11 +13208,7 @@ bool PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FPlayerStatisticDefinition(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     return HasSucceeded;
@@ -13367,6 +13250,7 @@ bool PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13403,17 +13287,17 @@ AdminModels::StatisticVersionStatus PlayFab::AdminModels::readStatisticVersionSt
 
 AdminModels::StatisticVersionStatus PlayFab::AdminModels::readStatisticVersionStatusFromValue(const FString& value)
 {
-    static TMap<FString, StatisticVersionStatus> _StatisticVersionStatusMap;
-    if (_StatisticVersionStatusMap.Num() == 0)
+    static const TMap<FString, StatisticVersionStatus> _StatisticVersionStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _StatisticVersionStatusMap.Add(TEXT("Active"), StatisticVersionStatusActive);
-        _StatisticVersionStatusMap.Add(TEXT("SnapshotPending"), StatisticVersionStatusSnapshotPending);
-        _StatisticVersionStatusMap.Add(TEXT("Snapshot"), StatisticVersionStatusSnapshot);
-        _StatisticVersionStatusMap.Add(TEXT("ArchivalPending"), StatisticVersionStatusArchivalPending);
-        _StatisticVersionStatusMap.Add(TEXT("Archived"), StatisticVersionStatusArchived);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, StatisticVersionStatus> Map;
+        Map.Add(TEXT("Active"), StatisticVersionStatusActive);
+        Map.Add(TEXT("SnapshotPending"), StatisticVersionStatusSnapshotPending);
+        Map.Add(TEXT("Snapshot"), StatisticVersionStatusSnapshot);
+        Map.Add(TEXT("ArchivalPending"), StatisticVersionStatusArchivalPending);
+        Map.Add(TEXT("Archived"), StatisticVersionStatusArchived);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -13555,11 +13439,7 @@ bool PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::readFromValue(cons
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticVersionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("StatisticVersions"));
-    for (int32 Idx = 0; Idx < StatisticVersionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticVersionsArray[Idx];
-        StatisticVersions.Add(FPlayerStatisticVersion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticVersionsArray, StatisticVersions);
 
 
     return HasSucceeded;
@@ -13598,7 +13478,7 @@ void PlayFab::AdminModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -13611,6 +13491,7 @@ bool PlayFab::AdminModels::FGetPlayerTagsRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13650,7 +13531,7 @@ void PlayFab::AdminModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("Tags"));
@@ -13860,11 +13741,7 @@ bool PlayFab::AdminModels::FGetPolicyResponse::readFromValue(const TSharedPtr<FJ
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatementsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statements"));
-    for (int32 Idx = 0; Idx < StatementsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatementsArray[Idx];
-        Statements.Add(FPermissionStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatementsArray, Statements);
 
 
     return HasSucceeded;
@@ -13927,6 +13804,7 @@ bool PlayFab::AdminModels::FGetPublisherDataResult::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -13985,14 +13863,14 @@ AdminModels::ResultTableNodeType PlayFab::AdminModels::readResultTableNodeTypeFr
 
 AdminModels::ResultTableNodeType PlayFab::AdminModels::readResultTableNodeTypeFromValue(const FString& value)
 {
-    static TMap<FString, ResultTableNodeType> _ResultTableNodeTypeMap;
-    if (_ResultTableNodeTypeMap.Num() == 0)
+    static const TMap<FString, ResultTableNodeType> _ResultTableNodeTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _ResultTableNodeTypeMap.Add(TEXT("ItemId"), ResultTableNodeTypeItemId);
-        _ResultTableNodeTypeMap.Add(TEXT("TableId"), ResultTableNodeTypeTableId);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ResultTableNodeType> Map;
+        Map.Add(TEXT("ItemId"), ResultTableNodeTypeItemId);
+        Map.Add(TEXT("TableId"), ResultTableNodeTypeTableId);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -14101,11 +13979,7 @@ bool PlayFab::AdminModels::FRandomResultTableListing::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&NodesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Nodes"));
-    for (int32 Idx = 0; Idx < NodesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = NodesArray[Idx];
-        Nodes.Add(FResultTableNode(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(NodesArray, Nodes);
 
 
     const TSharedPtr<FJsonValue> TableIdValue = obj->TryGetField(TEXT("TableId"));
@@ -14148,6 +14022,7 @@ bool PlayFab::AdminModels::FGetRandomResultTablesResult::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* TablesObject;
     if (obj->TryGetObjectField(TEXT("Tables"), TablesObject))
     {
+        Tables.Reserve((*TablesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TablesObject)->Values); It; ++It)
         {
             Tables.Add(It.Key(), FRandomResultTableListing(It.Value()->AsObject()));
@@ -14223,11 +14098,7 @@ bool PlayFab::AdminModels::FGetSegmentsResponse::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&SegmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Segments"));
-    for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FSegmentModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SegmentsArray, Segments);
 
 
     return HasSucceeded;
@@ -14361,19 +14232,19 @@ AdminModels::SourceType PlayFab::AdminModels::readSourceTypeFromValue(const TSha
 
 AdminModels::SourceType PlayFab::AdminModels::readSourceTypeFromValue(const FString& value)
 {
-    static TMap<FString, SourceType> _SourceTypeMap;
-    if (_SourceTypeMap.Num() == 0)
+    static const TMap<FString, SourceType> _SourceTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _SourceTypeMap.Add(TEXT("Admin"), SourceTypeAdmin);
-        _SourceTypeMap.Add(TEXT("BackEnd"), SourceTypeBackEnd);
-        _SourceTypeMap.Add(TEXT("GameClient"), SourceTypeGameClient);
-        _SourceTypeMap.Add(TEXT("GameServer"), SourceTypeGameServer);
-        _SourceTypeMap.Add(TEXT("Partner"), SourceTypePartner);
-        _SourceTypeMap.Add(TEXT("Custom"), SourceTypeCustom);
-        _SourceTypeMap.Add(TEXT("API"), SourceTypeAPI);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SourceType> Map;
+        Map.Add(TEXT("Admin"), SourceTypeAdmin);
+        Map.Add(TEXT("BackEnd"), SourceTypeBackEnd);
+        Map.Add(TEXT("GameClient"), SourceTypeGameClient);
+        Map.Add(TEXT("GameServer"), SourceTypeGameServer);
+        Map.Add(TEXT("Partner"), SourceTypePartner);
+        Map.Add(TEXT("Custom"), SourceTypeCustom);
+        Map.Add(TEXT("API"), SourceTypeAPI);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -14554,11 +14425,7 @@ bool PlayFab::AdminModels::FGetStoreItemsResult::readFromValue(const TSharedPtr<
     Source = readSourceTypeFromValue(obj->TryGetField(TEXT("Source")));
 
     const TArray<TSharedPtr<FJsonValue>>&StoreArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Store"));
-    for (int32 Idx = 0; Idx < StoreArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StoreArray[Idx];
-        Store.Add(FStoreItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StoreArray, Store);
 
 
     const TSharedPtr<FJsonValue> StoreIdValue = obj->TryGetField(TEXT("StoreId"));
@@ -14688,16 +14555,16 @@ AdminModels::ScheduledTaskType PlayFab::AdminModels::readScheduledTaskTypeFromVa
 
 AdminModels::ScheduledTaskType PlayFab::AdminModels::readScheduledTaskTypeFromValue(const FString& value)
 {
-    static TMap<FString, ScheduledTaskType> _ScheduledTaskTypeMap;
-    if (_ScheduledTaskTypeMap.Num() == 0)
+    static const TMap<FString, ScheduledTaskType> _ScheduledTaskTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _ScheduledTaskTypeMap.Add(TEXT("CloudScript"), ScheduledTaskTypeCloudScript);
-        _ScheduledTaskTypeMap.Add(TEXT("ActionsOnPlayerSegment"), ScheduledTaskTypeActionsOnPlayerSegment);
-        _ScheduledTaskTypeMap.Add(TEXT("CloudScriptAzureFunctions"), ScheduledTaskTypeCloudScriptAzureFunctions);
-        _ScheduledTaskTypeMap.Add(TEXT("InsightsScheduledScaling"), ScheduledTaskTypeInsightsScheduledScaling);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ScheduledTaskType> Map;
+        Map.Add(TEXT("CloudScript"), ScheduledTaskTypeCloudScript);
+        Map.Add(TEXT("ActionsOnPlayerSegment"), ScheduledTaskTypeActionsOnPlayerSegment);
+        Map.Add(TEXT("CloudScriptAzureFunctions"), ScheduledTaskTypeCloudScriptAzureFunctions);
+        Map.Add(TEXT("InsightsScheduledScaling"), ScheduledTaskTypeInsightsScheduledScaling);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -14867,11 +14734,7 @@ bool PlayFab::AdminModels::FGetTaskInstancesResult::readFromValue(const TSharedP
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&SummariesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Summaries"));
-    for (int32 Idx = 0; Idx < SummariesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SummariesArray[Idx];
-        Summaries.Add(FTaskInstanceBasicSummary(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SummariesArray, Summaries);
 
 
     return HasSucceeded;
@@ -15062,11 +14925,7 @@ bool PlayFab::AdminModels::FGetTasksResult::readFromValue(const TSharedPtr<FJson
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&TasksArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Tasks"));
-    for (int32 Idx = 0; Idx < TasksArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = TasksArray[Idx];
-        Tasks.Add(FScheduledTask(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(TasksArray, Tasks);
 
 
     return HasSucceeded;
@@ -15145,6 +15004,7 @@ bool PlayFab::AdminModels::FGetTitleDataResult::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -15170,7 +15030,7 @@ void PlayFab::AdminModels::FGetUserBansRequest::writeJSON(JsonWriter& writer) co
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -15216,11 +15076,7 @@ bool PlayFab::AdminModels::FGetUserBansResult::readFromValue(const TSharedPtr<FJ
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -15257,7 +15113,7 @@ void PlayFab::AdminModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) co
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -15303,14 +15159,14 @@ AdminModels::UserDataPermission PlayFab::AdminModels::readUserDataPermissionFrom
 
 AdminModels::UserDataPermission PlayFab::AdminModels::readUserDataPermissionFromValue(const FString& value)
 {
-    static TMap<FString, UserDataPermission> _UserDataPermissionMap;
-    if (_UserDataPermissionMap.Num() == 0)
+    static const TMap<FString, UserDataPermission> _UserDataPermissionMap = []()
     {
-        // Auto-generate the map on the first use
-        _UserDataPermissionMap.Add(TEXT("Private"), UserDataPermissionPrivate);
-        _UserDataPermissionMap.Add(TEXT("Public"), UserDataPermissionPublic);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, UserDataPermission> Map;
+        Map.Add(TEXT("Private"), UserDataPermissionPrivate);
+        Map.Add(TEXT("Public"), UserDataPermissionPublic);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -15396,7 +15252,7 @@ void PlayFab::AdminModels::FGetUserDataResult::writeJSON(JsonWriter& writer) con
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -15409,6 +15265,7 @@ bool PlayFab::AdminModels::FGetUserDataResult::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
@@ -15459,7 +15316,7 @@ void PlayFab::AdminModels::FGetUserInventoryRequest::writeJSON(JsonWriter& write
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -15472,6 +15329,7 @@ bool PlayFab::AdminModels::FGetUserInventoryRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15562,7 +15420,7 @@ void PlayFab::AdminModels::FItemInstance::writeJSON(JsonWriter& writer) const
     if (ItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (PurchaseDate.notNull())
@@ -15625,6 +15483,7 @@ bool PlayFab::AdminModels::FItemInstance::readFromValue(const TSharedPtr<FJsonOb
     const TSharedPtr<FJsonObject>* CustomDataObject;
     if (obj->TryGetObjectField(TEXT("CustomData"), CustomDataObject))
     {
+        CustomData.Reserve((*CustomDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
             CustomData.Add(It.Key(), It.Value()->AsString());
@@ -15768,7 +15627,7 @@ void PlayFab::AdminModels::FGetUserInventoryResult::writeJSON(JsonWriter& writer
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (VirtualCurrency.Num() != 0)
@@ -15801,11 +15660,7 @@ bool PlayFab::AdminModels::FGetUserInventoryResult::readFromValue(const TSharedP
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&InventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Inventory"));
-    for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(InventoryArray, Inventory);
 
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -15828,6 +15683,7 @@ bool PlayFab::AdminModels::FGetUserInventoryResult::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* VirtualCurrencyRechargeTimesObject;
     if (obj->TryGetObjectField(TEXT("VirtualCurrencyRechargeTimes"), VirtualCurrencyRechargeTimesObject))
     {
+        VirtualCurrencyRechargeTimes.Reserve((*VirtualCurrencyRechargeTimesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
             VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
@@ -15876,7 +15732,7 @@ void PlayFab::AdminModels::FGrantedItemInstance::writeJSON(JsonWriter& writer) c
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomData.Num() != 0)
@@ -15917,13 +15773,13 @@ void PlayFab::AdminModels::FGrantedItemInstance::writeJSON(JsonWriter& writer) c
     if (ItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (PurchaseDate.notNull())
@@ -15996,6 +15852,7 @@ bool PlayFab::AdminModels::FGrantedItemInstance::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomDataObject;
     if (obj->TryGetObjectField(TEXT("CustomData"), CustomDataObject))
     {
+        CustomData.Reserve((*CustomDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
             CustomData.Add(It.Key(), It.Value()->AsString());
@@ -16103,7 +15960,7 @@ void PlayFab::AdminModels::FItemGrant::writeJSON(JsonWriter& writer) const
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (Data.Num() != 0)
@@ -16143,7 +16000,7 @@ void PlayFab::AdminModels::FItemGrant::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -16170,6 +16027,7 @@ bool PlayFab::AdminModels::FItemGrant::readFromValue(const TSharedPtr<FJsonObjec
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -16244,6 +16102,7 @@ bool PlayFab::AdminModels::FGrantItemsToUsersRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16251,11 +16110,7 @@ bool PlayFab::AdminModels::FGrantItemsToUsersRequest::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ItemGrantsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ItemGrants"));
-    for (int32 Idx = 0; Idx < ItemGrantsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemGrantsArray[Idx];
-        ItemGrants.Add(FItemGrant(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemGrantsArray, ItemGrants);
 
 
     return HasSucceeded;
@@ -16287,11 +16142,7 @@ bool PlayFab::AdminModels::FGrantItemsToUsersResult::readFromValue(const TShared
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemGrantResultsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ItemGrantResults"));
-    for (int32 Idx = 0; Idx < ItemGrantResultsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemGrantResultsArray[Idx];
-        ItemGrantResults.Add(FGrantedItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemGrantResultsArray, ItemGrantResults);
 
 
     return HasSucceeded;
@@ -16360,6 +16211,7 @@ bool PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::read
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16431,6 +16283,7 @@ bool PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16631,11 +16484,7 @@ bool PlayFab::AdminModels::FListOpenIdConnectionResponse::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ConnectionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Connections"));
-    for (int32 Idx = 0; Idx < ConnectionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ConnectionsArray[Idx];
-        Connections.Add(FOpenIdConnection(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ConnectionsArray, Connections);
 
 
     return HasSucceeded;
@@ -16657,7 +16506,7 @@ void PlayFab::AdminModels::FListPlayerCustomPropertiesRequest::writeJSON(JsonWri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -16689,7 +16538,7 @@ void PlayFab::AdminModels::FListPlayerCustomPropertiesResult::writeJSON(JsonWrit
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Properties.Num() != 0)
@@ -16719,11 +16568,7 @@ bool PlayFab::AdminModels::FListPlayerCustomPropertiesResult::readFromValue(cons
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PropertiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Properties"));
-    for (int32 Idx = 0; Idx < PropertiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PropertiesArray[Idx];
-        Properties.Add(FCustomPropertyDetails(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PropertiesArray, Properties);
 
 
     const TSharedPtr<FJsonValue> PropertiesVersionValue = obj->TryGetField(TEXT("PropertiesVersion"));
@@ -16781,11 +16626,7 @@ bool PlayFab::AdminModels::FListVirtualCurrencyTypesResult::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&VirtualCurrenciesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("VirtualCurrencies"));
-    for (int32 Idx = 0; Idx < VirtualCurrenciesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VirtualCurrenciesArray[Idx];
-        VirtualCurrencies.Add(FVirtualCurrencyData(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VirtualCurrenciesArray, VirtualCurrencies);
 
 
     return HasSucceeded;
@@ -16809,7 +16650,7 @@ void PlayFab::AdminModels::FLookupUserAccountInfoRequest::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (TitleDisplayName.IsEmpty() == false)
@@ -17537,17 +17378,17 @@ AdminModels::TitleActivationStatus PlayFab::AdminModels::readTitleActivationStat
 
 AdminModels::TitleActivationStatus PlayFab::AdminModels::readTitleActivationStatusFromValue(const FString& value)
 {
-    static TMap<FString, TitleActivationStatus> _TitleActivationStatusMap;
-    if (_TitleActivationStatusMap.Num() == 0)
+    static const TMap<FString, TitleActivationStatus> _TitleActivationStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _TitleActivationStatusMap.Add(TEXT("None"), TitleActivationStatusNone);
-        _TitleActivationStatusMap.Add(TEXT("ActivatedTitleKey"), TitleActivationStatusActivatedTitleKey);
-        _TitleActivationStatusMap.Add(TEXT("PendingSteam"), TitleActivationStatusPendingSteam);
-        _TitleActivationStatusMap.Add(TEXT("ActivatedSteam"), TitleActivationStatusActivatedSteam);
-        _TitleActivationStatusMap.Add(TEXT("RevokedSteam"), TitleActivationStatusRevokedSteam);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, TitleActivationStatus> Map;
+        Map.Add(TEXT("None"), TitleActivationStatusNone);
+        Map.Add(TEXT("ActivatedTitleKey"), TitleActivationStatusActivatedTitleKey);
+        Map.Add(TEXT("PendingSteam"), TitleActivationStatusPendingSteam);
+        Map.Add(TEXT("ActivatedSteam"), TitleActivationStatusActivatedSteam);
+        Map.Add(TEXT("RevokedSteam"), TitleActivationStatusRevokedSteam);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -17675,39 +17516,39 @@ AdminModels::UserOrigination PlayFab::AdminModels::readUserOriginationFromValue(
 
 AdminModels::UserOrigination PlayFab::AdminModels::readUserOriginationFromValue(const FString& value)
 {
-    static TMap<FString, UserOrigination> _UserOriginationMap;
-    if (_UserOriginationMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _UserOriginationMap.Add(TEXT("Organic"), UserOriginationOrganic);
-        _UserOriginationMap.Add(TEXT("Steam"), UserOriginationSteam);
-        _UserOriginationMap.Add(TEXT("Google"), UserOriginationGoogle);
-        _UserOriginationMap.Add(TEXT("Amazon"), UserOriginationAmazon);
-        _UserOriginationMap.Add(TEXT("Facebook"), UserOriginationFacebook);
-        _UserOriginationMap.Add(TEXT("Kongregate"), UserOriginationKongregate);
-        _UserOriginationMap.Add(TEXT("GamersFirst"), UserOriginationGamersFirst);
-        _UserOriginationMap.Add(TEXT("Unknown"), UserOriginationUnknown);
-        _UserOriginationMap.Add(TEXT("IOS"), UserOriginationIOS);
-        _UserOriginationMap.Add(TEXT("LoadTest"), UserOriginationLoadTest);
-        _UserOriginationMap.Add(TEXT("Android"), UserOriginationAndroid);
-        _UserOriginationMap.Add(TEXT("PSN"), UserOriginationPSN);
-        _UserOriginationMap.Add(TEXT("GameCenter"), UserOriginationGameCenter);
-        _UserOriginationMap.Add(TEXT("CustomId"), UserOriginationCustomId);
-        _UserOriginationMap.Add(TEXT("XboxLive"), UserOriginationXboxLive);
-        _UserOriginationMap.Add(TEXT("Parse"), UserOriginationParse);
-        _UserOriginationMap.Add(TEXT("Twitch"), UserOriginationTwitch);
-        _UserOriginationMap.Add(TEXT("ServerCustomId"), UserOriginationServerCustomId);
-        _UserOriginationMap.Add(TEXT("NintendoSwitchDeviceId"), UserOriginationNintendoSwitchDeviceId);
-        _UserOriginationMap.Add(TEXT("FacebookInstantGamesId"), UserOriginationFacebookInstantGamesId);
-        _UserOriginationMap.Add(TEXT("OpenIdConnect"), UserOriginationOpenIdConnect);
-        _UserOriginationMap.Add(TEXT("Apple"), UserOriginationApple);
-        _UserOriginationMap.Add(TEXT("NintendoSwitchAccount"), UserOriginationNintendoSwitchAccount);
-        _UserOriginationMap.Add(TEXT("GooglePlayGames"), UserOriginationGooglePlayGames);
-        _UserOriginationMap.Add(TEXT("XboxMobileStore"), UserOriginationXboxMobileStore);
-        _UserOriginationMap.Add(TEXT("King"), UserOriginationKing);
-        _UserOriginationMap.Add(TEXT("BattleNet"), UserOriginationBattleNet);
-
-    }
+    static const TMap<FString, UserOrigination> _UserOriginationMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, UserOrigination> Map;
+        Map.Add(TEXT("Organic"), UserOriginationOrganic);
+        Map.Add(TEXT("Steam"), UserOriginationSteam);
+        Map.Add(TEXT("Google"), UserOriginationGoogle);
+        Map.Add(TEXT("Amazon"), UserOriginationAmazon);
+        Map.Add(TEXT("Facebook"), UserOriginationFacebook);
+        Map.Add(TEXT("Kongregate"), UserOriginationKongregate);
+        Map.Add(TEXT("GamersFirst"), UserOriginationGamersFirst);
+        Map.Add(TEXT("Unknown"), UserOriginationUnknown);
+        Map.Add(TEXT("IOS"), UserOriginationIOS);
+        Map.Add(TEXT("LoadTest"), UserOriginationLoadTest);
+        Map.Add(TEXT("Android"), UserOriginationAndroid);
+        Map.Add(TEXT("PSN"), UserOriginationPSN);
+        Map.Add(TEXT("GameCenter"), UserOriginationGameCenter);
+        Map.Add(TEXT("CustomId"), UserOriginationCustomId);
+        Map.Add(TEXT("XboxLive"), UserOriginationXboxLive);
+        Map.Add(TEXT("Parse"), UserOriginationParse);
+        Map.Add(TEXT("Twitch"), UserOriginationTwitch);
+        Map.Add(TEXT("ServerCustomId"), UserOriginationServerCustomId);
+        Map.Add(TEXT("NintendoSwitchDeviceId"), UserOriginationNintendoSwitchDeviceId);
+        Map.Add(TEXT("FacebookInstantGamesId"), UserOriginationFacebookInstantGamesId);
+        Map.Add(TEXT("OpenIdConnect"), UserOriginationOpenIdConnect);
+        Map.Add(TEXT("Apple"), UserOriginationApple);
+        Map.Add(TEXT("NintendoSwitchAccount"), UserOriginationNintendoSwitchAccount);
+        Map.Add(TEXT("GooglePlayGames"), UserOriginationGooglePlayGames);
+        Map.Add(TEXT("XboxMobileStore"), UserOriginationXboxMobileStore);
+        Map.Add(TEXT("King"), UserOriginationKing);
+        Map.Add(TEXT("BattleNet"), UserOriginationBattleNet);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -18033,7 +17874,7 @@ void PlayFab::AdminModels::FUserAccountInfo::writeJSON(JsonWriter& writer) const
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (PrivateInfo.IsValid())
@@ -18169,11 +18010,7 @@ bool PlayFab::AdminModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJso
     }
 
     const TArray<TSharedPtr<FJsonValue>>&OpenIdInfoArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("OpenIdInfo"));
-    for (int32 Idx = 0; Idx < OpenIdInfoArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = OpenIdInfoArray[Idx];
-        OpenIdInfo.Add(FUserOpenIdInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(OpenIdInfoArray, OpenIdInfo);
 
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -18285,7 +18122,7 @@ void PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWrite
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (VirtualCurrency.IsEmpty() == false)
@@ -18350,15 +18187,15 @@ AdminModels::PushSetupPlatform PlayFab::AdminModels::readPushSetupPlatformFromVa
 
 AdminModels::PushSetupPlatform PlayFab::AdminModels::readPushSetupPlatformFromValue(const FString& value)
 {
-    static TMap<FString, PushSetupPlatform> _PushSetupPlatformMap;
-    if (_PushSetupPlatformMap.Num() == 0)
+    static const TMap<FString, PushSetupPlatform> _PushSetupPlatformMap = []()
     {
-        // Auto-generate the map on the first use
-        _PushSetupPlatformMap.Add(TEXT("GCM"), PushSetupPlatformGCM);
-        _PushSetupPlatformMap.Add(TEXT("APNS"), PushSetupPlatformAPNS);
-        _PushSetupPlatformMap.Add(TEXT("APNS_SANDBOX"), PushSetupPlatformAPNS_SANDBOX);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, PushSetupPlatform> Map;
+        Map.Add(TEXT("GCM"), PushSetupPlatformGCM);
+        Map.Add(TEXT("APNS"), PushSetupPlatformAPNS);
+        Map.Add(TEXT("APNS_SANDBOX"), PushSetupPlatformAPNS_SANDBOX);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -18403,11 +18240,7 @@ bool PlayFab::AdminModels::FRandomResultTable::readFromValue(const TSharedPtr<FJ
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&NodesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Nodes"));
-    for (int32 Idx = 0; Idx < NodesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = NodesArray[Idx];
-        Nodes.Add(FResultTableNode(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(NodesArray, Nodes);
 
 
     const TSharedPtr<FJsonValue> TableIdValue = obj->TryGetField(TEXT("TableId"));
@@ -18446,7 +18279,7 @@ void PlayFab::AdminModels::FRefundPurchaseRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Reason.IsEmpty() == false)
@@ -18545,7 +18378,7 @@ void PlayFab::AdminModels::FRemovePlayerTagRequest::writeJSON(JsonWriter& writer
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!TagName.IsEmpty() == false)
@@ -18568,6 +18401,7 @@ bool PlayFab::AdminModels::FRemovePlayerTagRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18633,11 +18467,7 @@ bool PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&VirtualCurrenciesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("VirtualCurrencies"));
-    for (int32 Idx = 0; Idx < VirtualCurrenciesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VirtualCurrenciesArray[Idx];
-        VirtualCurrencies.Add(FVirtualCurrencyData(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VirtualCurrenciesArray, VirtualCurrencies);
 
 
     return HasSucceeded;
@@ -18659,7 +18489,7 @@ void PlayFab::AdminModels::FResetCharacterStatisticsRequest::writeJSON(JsonWrite
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -18680,7 +18510,7 @@ void PlayFab::AdminModels::FResetCharacterStatisticsRequest::writeJSON(JsonWrite
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -18700,6 +18530,7 @@ bool PlayFab::AdminModels::FResetCharacterStatisticsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18785,6 +18616,7 @@ bool PlayFab::AdminModels::FResetPasswordRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18854,7 +18686,7 @@ void PlayFab::AdminModels::FResetUserStatisticsRequest::writeJSON(JsonWriter& wr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -18867,6 +18699,7 @@ bool PlayFab::AdminModels::FResetUserStatisticsRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18920,15 +18753,15 @@ AdminModels::ResolutionOutcome PlayFab::AdminModels::readResolutionOutcomeFromVa
 
 AdminModels::ResolutionOutcome PlayFab::AdminModels::readResolutionOutcomeFromValue(const FString& value)
 {
-    static TMap<FString, ResolutionOutcome> _ResolutionOutcomeMap;
-    if (_ResolutionOutcomeMap.Num() == 0)
+    static const TMap<FString, ResolutionOutcome> _ResolutionOutcomeMap = []()
     {
-        // Auto-generate the map on the first use
-        _ResolutionOutcomeMap.Add(TEXT("Revoke"), ResolutionOutcomeRevoke);
-        _ResolutionOutcomeMap.Add(TEXT("Reinstate"), ResolutionOutcomeReinstate);
-        _ResolutionOutcomeMap.Add(TEXT("Manual"), ResolutionOutcomeManual);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ResolutionOutcome> Map;
+        Map.Add(TEXT("Revoke"), ResolutionOutcomeRevoke);
+        Map.Add(TEXT("Reinstate"), ResolutionOutcomeReinstate);
+        Map.Add(TEXT("Manual"), ResolutionOutcomeManual);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -18969,7 +18802,7 @@ void PlayFab::AdminModels::FResolvePurchaseDisputeRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Reason.IsEmpty() == false)
@@ -19059,7 +18892,7 @@ void PlayFab::AdminModels::FRevokeAllBansForUserRequest::writeJSON(JsonWriter& w
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19105,11 +18938,7 @@ bool PlayFab::AdminModels::FRevokeAllBansForUserResult::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -19168,11 +18997,7 @@ bool PlayFab::AdminModels::FRevokeBansResult::readFromValue(const TSharedPtr<FJs
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -19190,7 +19015,7 @@ void PlayFab::AdminModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer) c
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ItemInstanceId.IsEmpty() == false)
@@ -19200,7 +19025,7 @@ void PlayFab::AdminModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -19210,7 +19035,7 @@ void PlayFab::AdminModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19256,7 +19081,7 @@ void PlayFab::AdminModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& wr
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ItemInstanceId.IsEmpty() == false)
@@ -19266,7 +19091,7 @@ void PlayFab::AdminModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& wr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -19276,7 +19101,7 @@ void PlayFab::AdminModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& wr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19333,11 +19158,7 @@ bool PlayFab::AdminModels::FRevokeInventoryItemsRequest::readFromValue(const TSh
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FRevokeInventoryItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -19414,11 +19235,7 @@ bool PlayFab::AdminModels::FRevokeInventoryItemsResult::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ErrorsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Errors"));
-    for (int32 Idx = 0; Idx < ErrorsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ErrorsArray[Idx];
-        Errors.Add(FRevokeItemError(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ErrorsArray, Errors);
 
 
     return HasSucceeded;
@@ -19480,6 +19297,7 @@ bool PlayFab::AdminModels::FRunTaskRequest::readFromValue(const TSharedPtr<FJson
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19573,6 +19391,7 @@ bool PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19655,7 +19474,7 @@ void PlayFab::AdminModels::FSetMembershipOverrideRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19668,6 +19487,7 @@ bool PlayFab::AdminModels::FSetMembershipOverrideRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19737,7 +19557,7 @@ void PlayFab::AdminModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& writer
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19819,6 +19639,7 @@ bool PlayFab::AdminModels::FSetPublishedRevisionRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20003,11 +19824,7 @@ bool PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&KeyValuesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("KeyValues"));
-    for (int32 Idx = 0; Idx < KeyValuesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = KeyValuesArray[Idx];
-        KeyValues.Add(FTitleDataKeyValue(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(KeyValuesArray, KeyValues);
 
 
     const TSharedPtr<FJsonValue> OverrideLabelValue = obj->TryGetField(TEXT("OverrideLabel"));
@@ -20236,17 +20053,17 @@ AdminModels::StatisticVersionArchivalStatus PlayFab::AdminModels::readStatisticV
 
 AdminModels::StatisticVersionArchivalStatus PlayFab::AdminModels::readStatisticVersionArchivalStatusFromValue(const FString& value)
 {
-    static TMap<FString, StatisticVersionArchivalStatus> _StatisticVersionArchivalStatusMap;
-    if (_StatisticVersionArchivalStatusMap.Num() == 0)
+    static const TMap<FString, StatisticVersionArchivalStatus> _StatisticVersionArchivalStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _StatisticVersionArchivalStatusMap.Add(TEXT("NotScheduled"), StatisticVersionArchivalStatusNotScheduled);
-        _StatisticVersionArchivalStatusMap.Add(TEXT("Scheduled"), StatisticVersionArchivalStatusScheduled);
-        _StatisticVersionArchivalStatusMap.Add(TEXT("Queued"), StatisticVersionArchivalStatusQueued);
-        _StatisticVersionArchivalStatusMap.Add(TEXT("InProgress"), StatisticVersionArchivalStatusInProgress);
-        _StatisticVersionArchivalStatusMap.Add(TEXT("Complete"), StatisticVersionArchivalStatusComplete);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, StatisticVersionArchivalStatus> Map;
+        Map.Add(TEXT("NotScheduled"), StatisticVersionArchivalStatusNotScheduled);
+        Map.Add(TEXT("Scheduled"), StatisticVersionArchivalStatusScheduled);
+        Map.Add(TEXT("Queued"), StatisticVersionArchivalStatusQueued);
+        Map.Add(TEXT("InProgress"), StatisticVersionArchivalStatusInProgress);
+        Map.Add(TEXT("Complete"), StatisticVersionArchivalStatusComplete);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -20288,7 +20105,7 @@ void PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonWr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!VirtualCurrency.IsEmpty() == false)
@@ -20318,6 +20135,7 @@ bool PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20471,11 +20289,7 @@ bool PlayFab::AdminModels::FUpdateBansRequest::readFromValue(const TSharedPtr<FJ
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BansArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Bans"));
-    for (int32 Idx = 0; Idx < BansArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BansArray[Idx];
-        Bans.Add(FUpdateBanRequest(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BansArray, Bans);
 
 
     return HasSucceeded;
@@ -20507,11 +20321,7 @@ bool PlayFab::AdminModels::FUpdateBansResult::readFromValue(const TSharedPtr<FJs
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -20566,11 +20376,7 @@ bool PlayFab::AdminModels::FUpdateCatalogItemsRequest::readFromValue(const TShar
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&CatalogArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Catalog"));
-    for (int32 Idx = 0; Idx < CatalogArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CatalogArray[Idx];
-        Catalog.Add(FCatalogItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CatalogArray, Catalog);
 
 
     const TSharedPtr<FJsonValue> CatalogVersionValue = obj->TryGetField(TEXT("CatalogVersion"));
@@ -20583,6 +20389,7 @@ bool PlayFab::AdminModels::FUpdateCatalogItemsRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20641,7 +20448,7 @@ void PlayFab::AdminModels::FUpdateCloudScriptRequest::writeJSON(JsonWriter& writ
     if (DeveloperPlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("DeveloperPlayFabId"));
-        writer->WriteValue(DeveloperPlayFabId);
+        writer->WriteValue(DeveloperPlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("Files"));
@@ -20663,6 +20470,7 @@ bool PlayFab::AdminModels::FUpdateCloudScriptRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20677,11 +20485,7 @@ bool PlayFab::AdminModels::FUpdateCloudScriptRequest::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&FilesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Files"));
-    for (int32 Idx = 0; Idx < FilesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FilesArray[Idx];
-        Files.Add(FCloudScriptFile(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FilesArray, Files);
 
 
     const TSharedPtr<FJsonValue> PublishValue = obj->TryGetField(TEXT("Publish"));
@@ -20925,7 +20729,7 @@ void PlayFab::AdminModels::FUpdatePlayerCustomPropertiesRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("Properties"));
@@ -20944,6 +20748,7 @@ bool PlayFab::AdminModels::FUpdatePlayerCustomPropertiesRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20965,11 +20770,7 @@ bool PlayFab::AdminModels::FUpdatePlayerCustomPropertiesRequest::readFromValue(c
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PropertiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Properties"));
-    for (int32 Idx = 0; Idx < PropertiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PropertiesArray[Idx];
-        Properties.Add(FUpdateProperty(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PropertiesArray, Properties);
 
 
     return HasSucceeded;
@@ -20987,7 +20788,7 @@ void PlayFab::AdminModels::FUpdatePlayerCustomPropertiesResult::writeJSON(JsonWr
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("PropertiesVersion"));
@@ -21235,11 +21036,7 @@ bool PlayFab::AdminModels::FUpdatePolicyRequest::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatementsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statements"));
-    for (int32 Idx = 0; Idx < StatementsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatementsArray[Idx];
-        Statements.Add(FPermissionStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatementsArray, Statements);
 
 
     return HasSucceeded;
@@ -21284,11 +21081,7 @@ bool PlayFab::AdminModels::FUpdatePolicyResponse::readFromValue(const TSharedPtr
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatementsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statements"));
-    for (int32 Idx = 0; Idx < StatementsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatementsArray[Idx];
-        Statements.Add(FPermissionStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatementsArray, Statements);
 
 
     return HasSucceeded;
@@ -21346,6 +21139,7 @@ bool PlayFab::AdminModels::FUpdateRandomResultTablesRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21353,11 +21147,7 @@ bool PlayFab::AdminModels::FUpdateRandomResultTablesRequest::readFromValue(const
     }
 
     const TArray<TSharedPtr<FJsonValue>>&TablesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Tables"));
-    for (int32 Idx = 0; Idx < TablesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = TablesArray[Idx];
-        Tables.Add(FRandomResultTable(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(TablesArray, Tables);
 
 
     return HasSucceeded;
@@ -21524,6 +21314,7 @@ bool PlayFab::AdminModels::FUpdateStoreItemsRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21537,11 +21328,7 @@ bool PlayFab::AdminModels::FUpdateStoreItemsRequest::readFromValue(const TShared
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StoreArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Store"));
-    for (int32 Idx = 0; Idx < StoreArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StoreArray[Idx];
-        Store.Add(FStoreItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StoreArray, Store);
 
 
     const TSharedPtr<FJsonValue> StoreIdValue = obj->TryGetField(TEXT("StoreId"));
@@ -21644,6 +21431,7 @@ bool PlayFab::AdminModels::FUpdateTaskRequest::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21748,7 +21536,7 @@ void PlayFab::AdminModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -21761,6 +21549,7 @@ bool PlayFab::AdminModels::FUpdateUserDataRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21770,6 +21559,7 @@ bool PlayFab::AdminModels::FUpdateUserDataRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -21866,7 +21656,7 @@ void PlayFab::AdminModels::FUpdateUserInternalDataRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -21879,6 +21669,7 @@ bool PlayFab::AdminModels::FUpdateUserInternalDataRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21888,6 +21679,7 @@ bool PlayFab::AdminModels::FUpdateUserInternalDataRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -21943,7 +21735,7 @@ void PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::writeJSON(JsonWri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -21956,6 +21748,7 @@ bool PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22011,3 +21804,5 @@ bool PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::readFromValue(cons
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_ADMIN_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_ADMIN_API
 #include "Core/PlayFabAdminInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabAdminInstanceAPI::GetOrCreateA
     return this->authContext;
 }
 
-bool UPlayFabAdminInstanceAPI::AbortTaskInstance(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::AbortTaskInstance(
     AdminModels::FAbortTaskInstanceRequest& request,
     const FAbortTaskInstanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabAdminInstanceAPI::AbortTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AbortTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAbortTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnAbortTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAbortTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabAdminInstanceAPI::OnAbortTaskInstanceResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabAdminInstanceAPI::AddLocalizedNews(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::AddLocalizedNews(
     AdminModels::FAddLocalizedNewsRequest& request,
     const FAddLocalizedNewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabAdminInstanceAPI::AddLocalizedNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddLocalizedNews"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddLocalizedNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddLocalizedNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddLocalizedNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabAdminInstanceAPI::OnAddLocalizedNewsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::AddNews(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::AddNews(
     AdminModels::FAddNewsRequest& request,
     const FAddNewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabAdminInstanceAPI::AddNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddNews"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabAdminInstanceAPI::OnAddNewsResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::AddPlayerTag(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::AddPlayerTag(
     AdminModels::FAddPlayerTagRequest& request,
     const FAddPlayerTagDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabAdminInstanceAPI::AddPlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddPlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddPlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabAdminInstanceAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::AddUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::AddUserVirtualCurrency(
     AdminModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabAdminInstanceAPI::AddUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::AddVirtualCurrencyTypes(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::AddVirtualCurrencyTypes(
     AdminModels::FAddVirtualCurrencyTypesRequest& request,
     const FAddVirtualCurrencyTypesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabAdminInstanceAPI::AddVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAdminInstanceAPI::BanUsers(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::BanUsers(
     AdminModels::FBanUsersRequest& request,
     const FBanUsersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabAdminInstanceAPI::BanUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/BanUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBanUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabAdminInstanceAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::CheckLimitedEditionItemAvailability(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::CheckLimitedEditionItemAvailability(
     AdminModels::FCheckLimitedEditionItemAvailabilityRequest& request,
     const FCheckLimitedEditionItemAvailabilityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabAdminInstanceAPI::CheckLimitedEditionItemAvailability(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CheckLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCheckLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult(FHttp
     }
 }
 
-bool UPlayFabAdminInstanceAPI::CreateActionsOnPlayersInSegmentTask(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::CreateActionsOnPlayersInSegmentTask(
     AdminModels::FCreateActionsOnPlayerSegmentTaskRequest& request,
     const FCreateActionsOnPlayersInSegmentTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabAdminInstanceAPI::CreateActionsOnPlayersInSegmentTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateActionsOnPlayersInSegmentTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateActionsOnPlayersInSegmentTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -347,7 +348,7 @@ void UPlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult(FHttp
     }
 }
 
-bool UPlayFabAdminInstanceAPI::CreateCloudScriptTask(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::CreateCloudScriptTask(
     AdminModels::FCreateCloudScriptTaskRequest& request,
     const FCreateCloudScriptTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -360,7 +361,7 @@ bool UPlayFabAdminInstanceAPI::CreateCloudScriptTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateCloudScriptTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateCloudScriptTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -377,7 +378,7 @@ void UPlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::CreateInsightsScheduledScalingTask(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::CreateInsightsScheduledScalingTask(
     AdminModels::FCreateInsightsScheduledScalingTaskRequest& request,
     const FCreateInsightsScheduledScalingTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -390,7 +391,7 @@ bool UPlayFabAdminInstanceAPI::CreateInsightsScheduledScalingTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateInsightsScheduledScalingTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateInsightsScheduledScalingTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -407,7 +408,7 @@ void UPlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult(FHttpR
     }
 }
 
-bool UPlayFabAdminInstanceAPI::CreateOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::CreateOpenIdConnection(
     AdminModels::FCreateOpenIdConnectionRequest& request,
     const FCreateOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -420,7 +421,7 @@ bool UPlayFabAdminInstanceAPI::CreateOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -437,7 +438,7 @@ void UPlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::CreatePlayerSharedSecret(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::CreatePlayerSharedSecret(
     AdminModels::FCreatePlayerSharedSecretRequest& request,
     const FCreatePlayerSharedSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -450,7 +451,7 @@ bool UPlayFabAdminInstanceAPI::CreatePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -467,7 +468,7 @@ void UPlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::CreatePlayerStatisticDefinition(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::CreatePlayerStatisticDefinition(
     AdminModels::FCreatePlayerStatisticDefinitionRequest& request,
     const FCreatePlayerStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -480,7 +481,7 @@ bool UPlayFabAdminInstanceAPI::CreatePlayerStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -497,7 +498,7 @@ void UPlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult(FHttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::CreateSegment(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::CreateSegment(
     AdminModels::FCreateSegmentRequest& request,
     const FCreateSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -510,7 +511,7 @@ bool UPlayFabAdminInstanceAPI::CreateSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -527,7 +528,7 @@ void UPlayFabAdminInstanceAPI::OnCreateSegmentResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteContent(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteContent(
     AdminModels::FDeleteContentRequest& request,
     const FDeleteContentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -540,7 +541,7 @@ bool UPlayFabAdminInstanceAPI::DeleteContent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteContent"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteContentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteContentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteContentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -557,7 +558,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteContentResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteMasterPlayerAccount(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteMasterPlayerAccount(
     AdminModels::FDeleteMasterPlayerAccountRequest& request,
     const FDeleteMasterPlayerAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -570,7 +571,7 @@ bool UPlayFabAdminInstanceAPI::DeleteMasterPlayerAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteMasterPlayerAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMasterPlayerAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -587,7 +588,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteMasterPlayerEventData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteMasterPlayerEventData(
     AdminModels::FDeleteMasterPlayerEventDataRequest& request,
     const FDeleteMasterPlayerEventDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -600,7 +601,7 @@ bool UPlayFabAdminInstanceAPI::DeleteMasterPlayerEventData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteMasterPlayerEventData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerEventDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerEventDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMasterPlayerEventDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -617,7 +618,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerEventDataResult(FHttpRequestP
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteMembershipSubscription(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteMembershipSubscription(
     AdminModels::FDeleteMembershipSubscriptionRequest& request,
     const FDeleteMembershipSubscriptionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -630,7 +631,7 @@ bool UPlayFabAdminInstanceAPI::DeleteMembershipSubscription(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteMembershipSubscription"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteMembershipSubscriptionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteMembershipSubscriptionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMembershipSubscriptionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -647,7 +648,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteMembershipSubscriptionResult(FHttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteOpenIdConnection(
     AdminModels::FDeleteOpenIdConnectionRequest& request,
     const FDeleteOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -660,7 +661,7 @@ bool UPlayFabAdminInstanceAPI::DeleteOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -677,7 +678,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeletePlayer(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeletePlayer(
     AdminModels::FDeletePlayerRequest& request,
     const FDeletePlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -690,7 +691,7 @@ bool UPlayFabAdminInstanceAPI::DeletePlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeletePlayer"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -707,7 +708,7 @@ void UPlayFabAdminInstanceAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeletePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeletePlayerCustomProperties(
     AdminModels::FDeletePlayerCustomPropertiesRequest& request,
     const FDeletePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -720,7 +721,7 @@ bool UPlayFabAdminInstanceAPI::DeletePlayerCustomProperties(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeletePlayerCustomProperties"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeletePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeletePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -737,7 +738,7 @@ void UPlayFabAdminInstanceAPI::OnDeletePlayerCustomPropertiesResult(FHttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeletePlayerSharedSecret(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeletePlayerSharedSecret(
     AdminModels::FDeletePlayerSharedSecretRequest& request,
     const FDeletePlayerSharedSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -750,7 +751,7 @@ bool UPlayFabAdminInstanceAPI::DeletePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeletePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -767,7 +768,7 @@ void UPlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteSegment(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteSegment(
     AdminModels::FDeleteSegmentRequest& request,
     const FDeleteSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -780,7 +781,7 @@ bool UPlayFabAdminInstanceAPI::DeleteSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -797,7 +798,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteSegmentResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteStore(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteStore(
     AdminModels::FDeleteStoreRequest& request,
     const FDeleteStoreDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -810,7 +811,7 @@ bool UPlayFabAdminInstanceAPI::DeleteStore(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteStore"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteStoreResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteStoreResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteStoreDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -827,7 +828,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteStoreResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteTask(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteTask(
     AdminModels::FDeleteTaskRequest& request,
     const FDeleteTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -840,7 +841,7 @@ bool UPlayFabAdminInstanceAPI::DeleteTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -857,7 +858,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteTaskResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteTitle(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteTitle(
     const FDeleteTitleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -865,7 +866,7 @@ bool UPlayFabAdminInstanceAPI::DeleteTitle(
     return UPlayFabAdminInstanceAPI::DeleteTitle(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteTitle(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteTitle(
     AdminModels::FDeleteTitleRequest& request,
     const FDeleteTitleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -878,7 +879,7 @@ bool UPlayFabAdminInstanceAPI::DeleteTitle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTitle"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -895,7 +896,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteTitleResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::DeleteTitleDataOverride(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::DeleteTitleDataOverride(
     AdminModels::FDeleteTitleDataOverrideRequest& request,
     const FDeleteTitleDataOverrideDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -908,7 +909,7 @@ bool UPlayFabAdminInstanceAPI::DeleteTitleDataOverride(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTitleDataOverride"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDataOverrideDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -925,7 +926,7 @@ void UPlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAdminInstanceAPI::ExportMasterPlayerData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ExportMasterPlayerData(
     AdminModels::FExportMasterPlayerDataRequest& request,
     const FExportMasterPlayerDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -938,7 +939,7 @@ bool UPlayFabAdminInstanceAPI::ExportMasterPlayerData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ExportMasterPlayerData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExportMasterPlayerDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -955,7 +956,7 @@ void UPlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::ExportPlayersInSegment(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ExportPlayersInSegment(
     AdminModels::FExportPlayersInSegmentRequest& request,
     const FExportPlayersInSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -968,7 +969,7 @@ bool UPlayFabAdminInstanceAPI::ExportPlayersInSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ExportPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnExportPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnExportPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExportPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -985,7 +986,7 @@ void UPlayFabAdminInstanceAPI::OnExportPlayersInSegmentResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetActionsOnPlayersInSegmentTaskInstance(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetActionsOnPlayersInSegmentTaskInstance(
     AdminModels::FGetTaskInstanceRequest& request,
     const FGetActionsOnPlayersInSegmentTaskInstanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -998,7 +999,7 @@ bool UPlayFabAdminInstanceAPI::GetActionsOnPlayersInSegmentTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetActionsOnPlayersInSegmentTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetActionsOnPlayersInSegmentTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1015,7 +1016,7 @@ void UPlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetAllSegments(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetAllSegments(
     const FGetAllSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -1023,7 +1024,7 @@ bool UPlayFabAdminInstanceAPI::GetAllSegments(
     return UPlayFabAdminInstanceAPI::GetAllSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminInstanceAPI::GetAllSegments(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetAllSegments(
     AdminModels::FGetAllSegmentsRequest& request,
     const FGetAllSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1036,7 +1037,7 @@ bool UPlayFabAdminInstanceAPI::GetAllSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetAllSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1053,7 +1054,7 @@ void UPlayFabAdminInstanceAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetCatalogItems(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetCatalogItems(
     AdminModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1066,7 +1067,7 @@ bool UPlayFabAdminInstanceAPI::GetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1083,7 +1084,7 @@ void UPlayFabAdminInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetCloudScriptRevision(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetCloudScriptRevision(
     AdminModels::FGetCloudScriptRevisionRequest& request,
     const FGetCloudScriptRevisionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1096,7 +1097,7 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptRevision(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptRevision"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1113,7 +1114,7 @@ void UPlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetCloudScriptTaskInstance(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetCloudScriptTaskInstance(
     AdminModels::FGetTaskInstanceRequest& request,
     const FGetCloudScriptTaskInstanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1126,7 +1127,7 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1143,7 +1144,7 @@ void UPlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
     const FGetCloudScriptVersionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -1151,7 +1152,7 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
     return UPlayFabAdminInstanceAPI::GetCloudScriptVersions(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
     AdminModels::FGetCloudScriptVersionsRequest& request,
     const FGetCloudScriptVersionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1164,7 +1165,7 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptVersions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1181,7 +1182,7 @@ void UPlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetContentList(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetContentList(
     AdminModels::FGetContentListRequest& request,
     const FGetContentListDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1194,7 +1195,7 @@ bool UPlayFabAdminInstanceAPI::GetContentList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetContentList"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetContentListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetContentListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1211,7 +1212,7 @@ void UPlayFabAdminInstanceAPI::OnGetContentListResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetContentUploadUrl(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetContentUploadUrl(
     AdminModels::FGetContentUploadUrlRequest& request,
     const FGetContentUploadUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1224,7 +1225,7 @@ bool UPlayFabAdminInstanceAPI::GetContentUploadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetContentUploadUrl"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetContentUploadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetContentUploadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentUploadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1241,7 +1242,7 @@ void UPlayFabAdminInstanceAPI::OnGetContentUploadUrlResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetDataReport(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetDataReport(
     AdminModels::FGetDataReportRequest& request,
     const FGetDataReportDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1254,7 +1255,7 @@ bool UPlayFabAdminInstanceAPI::GetDataReport(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetDataReport"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetDataReportResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetDataReportResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDataReportDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1271,7 +1272,7 @@ void UPlayFabAdminInstanceAPI::OnGetDataReportResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayedTitleList(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayedTitleList(
     AdminModels::FGetPlayedTitleListRequest& request,
     const FGetPlayedTitleListDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1284,7 +1285,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayedTitleList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayedTitleList"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayedTitleListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayedTitleListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayedTitleListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1301,7 +1302,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayedTitleListResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerCustomProperty(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerCustomProperty(
     AdminModels::FGetPlayerCustomPropertyRequest& request,
     const FGetPlayerCustomPropertyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1314,7 +1315,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerCustomProperty(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerCustomProperty"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerCustomPropertyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCustomPropertyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1331,7 +1332,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerIdFromAuthToken(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerIdFromAuthToken(
     AdminModels::FGetPlayerIdFromAuthTokenRequest& request,
     const FGetPlayerIdFromAuthTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1344,7 +1345,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerIdFromAuthToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerIdFromAuthToken"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerIdFromAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1361,7 +1362,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerProfile(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerProfile(
     AdminModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1374,7 +1375,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerProfile(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerProfile"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1391,7 +1392,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerSegments(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerSegments(
     AdminModels::FGetPlayersSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1404,7 +1405,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1421,7 +1422,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
     const FGetPlayerSharedSecretsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -1429,7 +1430,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
     return UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
     AdminModels::FGetPlayerSharedSecretsRequest& request,
     const FGetPlayerSharedSecretsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1442,7 +1443,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerSharedSecrets"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSharedSecretsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1459,7 +1460,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayersInSegment(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayersInSegment(
     AdminModels::FGetPlayersInSegmentRequest& request,
     const FGetPlayersInSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1472,7 +1473,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayersInSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1489,7 +1490,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
     const FGetPlayerStatisticDefinitionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -1497,7 +1498,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
     return UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
     AdminModels::FGetPlayerStatisticDefinitionsRequest& request,
     const FGetPlayerStatisticDefinitionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1510,7 +1511,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerStatisticDefinitions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticDefinitionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1527,7 +1528,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult(FHttpReques
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerStatisticVersions(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerStatisticVersions(
     AdminModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1540,7 +1541,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerStatisticVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1557,7 +1558,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPlayerTags(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPlayerTags(
     AdminModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1570,7 +1571,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerTags"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1587,7 +1588,7 @@ void UPlayFabAdminInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPolicy(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPolicy(
     AdminModels::FGetPolicyRequest& request,
     const FGetPolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1600,7 +1601,7 @@ bool UPlayFabAdminInstanceAPI::GetPolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPolicy"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1617,7 +1618,7 @@ void UPlayFabAdminInstanceAPI::OnGetPolicyResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetPublisherData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetPublisherData(
     AdminModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1630,7 +1631,7 @@ bool UPlayFabAdminInstanceAPI::GetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1647,7 +1648,7 @@ void UPlayFabAdminInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetRandomResultTables(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetRandomResultTables(
     AdminModels::FGetRandomResultTablesRequest& request,
     const FGetRandomResultTablesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1660,7 +1661,7 @@ bool UPlayFabAdminInstanceAPI::GetRandomResultTables(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1677,7 +1678,7 @@ void UPlayFabAdminInstanceAPI::OnGetRandomResultTablesResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetSegmentExport(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetSegmentExport(
     AdminModels::FGetPlayersInSegmentExportRequest& request,
     const FGetSegmentExportDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1690,7 +1691,7 @@ bool UPlayFabAdminInstanceAPI::GetSegmentExport(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetSegmentExport"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetSegmentExportResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetSegmentExportResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSegmentExportDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1707,7 +1708,7 @@ void UPlayFabAdminInstanceAPI::OnGetSegmentExportResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetSegments(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetSegments(
     AdminModels::FGetSegmentsRequest& request,
     const FGetSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1720,7 +1721,7 @@ bool UPlayFabAdminInstanceAPI::GetSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1737,7 +1738,7 @@ void UPlayFabAdminInstanceAPI::OnGetSegmentsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetStoreItems(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetStoreItems(
     AdminModels::FGetStoreItemsRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1750,7 +1751,7 @@ bool UPlayFabAdminInstanceAPI::GetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1767,7 +1768,7 @@ void UPlayFabAdminInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetTaskInstances(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetTaskInstances(
     AdminModels::FGetTaskInstancesRequest& request,
     const FGetTaskInstancesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1780,7 +1781,7 @@ bool UPlayFabAdminInstanceAPI::GetTaskInstances(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTaskInstances"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTaskInstancesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTaskInstancesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTaskInstancesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1797,7 +1798,7 @@ void UPlayFabAdminInstanceAPI::OnGetTaskInstancesResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetTasks(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetTasks(
     AdminModels::FGetTasksRequest& request,
     const FGetTasksDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1810,7 +1811,7 @@ bool UPlayFabAdminInstanceAPI::GetTasks(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTasks"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTasksResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTasksResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTasksDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1827,7 +1828,7 @@ void UPlayFabAdminInstanceAPI::OnGetTasksResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetTitleData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetTitleData(
     AdminModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1840,7 +1841,7 @@ bool UPlayFabAdminInstanceAPI::GetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1857,7 +1858,7 @@ void UPlayFabAdminInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetTitleInternalData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetTitleInternalData(
     AdminModels::FGetTitleDataRequest& request,
     const FGetTitleInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1870,7 +1871,7 @@ bool UPlayFabAdminInstanceAPI::GetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1887,7 +1888,7 @@ void UPlayFabAdminInstanceAPI::OnGetTitleInternalDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetUserAccountInfo(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetUserAccountInfo(
     AdminModels::FLookupUserAccountInfoRequest& request,
     const FGetUserAccountInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1900,7 +1901,7 @@ bool UPlayFabAdminInstanceAPI::GetUserAccountInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserAccountInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1917,7 +1918,7 @@ void UPlayFabAdminInstanceAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetUserBans(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetUserBans(
     AdminModels::FGetUserBansRequest& request,
     const FGetUserBansDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1930,7 +1931,7 @@ bool UPlayFabAdminInstanceAPI::GetUserBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1947,7 +1948,7 @@ void UPlayFabAdminInstanceAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetUserData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetUserData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1960,7 +1961,7 @@ bool UPlayFabAdminInstanceAPI::GetUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1977,7 +1978,7 @@ void UPlayFabAdminInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetUserInternalData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetUserInternalData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1990,7 +1991,7 @@ bool UPlayFabAdminInstanceAPI::GetUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2007,7 +2008,7 @@ void UPlayFabAdminInstanceAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetUserInventory(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetUserInventory(
     AdminModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2020,7 +2021,7 @@ bool UPlayFabAdminInstanceAPI::GetUserInventory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserInventory"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2037,7 +2038,7 @@ void UPlayFabAdminInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetUserPublisherData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetUserPublisherData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2050,7 +2051,7 @@ bool UPlayFabAdminInstanceAPI::GetUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2067,7 +2068,7 @@ void UPlayFabAdminInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetUserPublisherInternalData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetUserPublisherInternalData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserPublisherInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2080,7 +2081,7 @@ bool UPlayFabAdminInstanceAPI::GetUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2097,7 +2098,7 @@ void UPlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult(FHttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetUserPublisherReadOnlyData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetUserPublisherReadOnlyData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2110,7 +2111,7 @@ bool UPlayFabAdminInstanceAPI::GetUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2127,7 +2128,7 @@ void UPlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GetUserReadOnlyData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GetUserReadOnlyData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2140,7 +2141,7 @@ bool UPlayFabAdminInstanceAPI::GetUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2157,7 +2158,7 @@ void UPlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAdminInstanceAPI::GrantItemsToUsers(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::GrantItemsToUsers(
     AdminModels::FGrantItemsToUsersRequest& request,
     const FGrantItemsToUsersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2170,7 +2171,7 @@ bool UPlayFabAdminInstanceAPI::GrantItemsToUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GrantItemsToUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2187,7 +2188,7 @@ void UPlayFabAdminInstanceAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabAdminInstanceAPI::IncrementLimitedEditionItemAvailability(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::IncrementLimitedEditionItemAvailability(
     AdminModels::FIncrementLimitedEditionItemAvailabilityRequest& request,
     const FIncrementLimitedEditionItemAvailabilityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2200,7 +2201,7 @@ bool UPlayFabAdminInstanceAPI::IncrementLimitedEditionItemAvailability(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/IncrementLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2217,7 +2218,7 @@ void UPlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult(F
     }
 }
 
-bool UPlayFabAdminInstanceAPI::IncrementPlayerStatisticVersion(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::IncrementPlayerStatisticVersion(
     AdminModels::FIncrementPlayerStatisticVersionRequest& request,
     const FIncrementPlayerStatisticVersionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2230,7 +2231,7 @@ bool UPlayFabAdminInstanceAPI::IncrementPlayerStatisticVersion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/IncrementPlayerStatisticVersion"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementPlayerStatisticVersionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2247,7 +2248,7 @@ void UPlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult(FHttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::ListOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ListOpenIdConnection(
     const FListOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -2255,7 +2256,7 @@ bool UPlayFabAdminInstanceAPI::ListOpenIdConnection(
     return UPlayFabAdminInstanceAPI::ListOpenIdConnection(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminInstanceAPI::ListOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ListOpenIdConnection(
     AdminModels::FListOpenIdConnectionRequest& request,
     const FListOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2268,7 +2269,7 @@ bool UPlayFabAdminInstanceAPI::ListOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnListOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnListOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2285,7 +2286,7 @@ void UPlayFabAdminInstanceAPI::OnListOpenIdConnectionResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminInstanceAPI::ListPlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ListPlayerCustomProperties(
     AdminModels::FListPlayerCustomPropertiesRequest& request,
     const FListPlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2298,7 +2299,7 @@ bool UPlayFabAdminInstanceAPI::ListPlayerCustomProperties(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListPlayerCustomProperties"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnListPlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnListPlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListPlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2315,7 +2316,7 @@ void UPlayFabAdminInstanceAPI::OnListPlayerCustomPropertiesResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
     const FListVirtualCurrencyTypesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -2323,7 +2324,7 @@ bool UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
     return UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
     AdminModels::FListVirtualCurrencyTypesRequest& request,
     const FListVirtualCurrencyTypesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2336,7 +2337,7 @@ bool UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2353,7 +2354,7 @@ void UPlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::RefundPurchase(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::RefundPurchase(
     AdminModels::FRefundPurchaseRequest& request,
     const FRefundPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2366,7 +2367,7 @@ bool UPlayFabAdminInstanceAPI::RefundPurchase(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RefundPurchase"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRefundPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnRefundPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefundPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2383,7 +2384,7 @@ void UPlayFabAdminInstanceAPI::OnRefundPurchaseResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminInstanceAPI::RemovePlayerTag(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::RemovePlayerTag(
     AdminModels::FRemovePlayerTagRequest& request,
     const FRemovePlayerTagDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2396,7 +2397,7 @@ bool UPlayFabAdminInstanceAPI::RemovePlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemovePlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemovePlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2413,7 +2414,7 @@ void UPlayFabAdminInstanceAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAdminInstanceAPI::RemoveVirtualCurrencyTypes(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::RemoveVirtualCurrencyTypes(
     AdminModels::FRemoveVirtualCurrencyTypesRequest& request,
     const FRemoveVirtualCurrencyTypesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2426,7 +2427,7 @@ bool UPlayFabAdminInstanceAPI::RemoveVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemoveVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2443,7 +2444,7 @@ void UPlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::ResetCharacterStatistics(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ResetCharacterStatistics(
     AdminModels::FResetCharacterStatisticsRequest& request,
     const FResetCharacterStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2456,7 +2457,7 @@ bool UPlayFabAdminInstanceAPI::ResetCharacterStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2473,7 +2474,7 @@ void UPlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::ResetPassword(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ResetPassword(
     AdminModels::FResetPasswordRequest& request,
     const FResetPasswordDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2486,7 +2487,7 @@ bool UPlayFabAdminInstanceAPI::ResetPassword(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetPassword"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResetPasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnResetPasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetPasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2503,7 +2504,7 @@ void UPlayFabAdminInstanceAPI::OnResetPasswordResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::ResetUserStatistics(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ResetUserStatistics(
     AdminModels::FResetUserStatisticsRequest& request,
     const FResetUserStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2516,7 +2517,7 @@ bool UPlayFabAdminInstanceAPI::ResetUserStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetUserStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResetUserStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnResetUserStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetUserStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2533,7 +2534,7 @@ void UPlayFabAdminInstanceAPI::OnResetUserStatisticsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAdminInstanceAPI::ResolvePurchaseDispute(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::ResolvePurchaseDispute(
     AdminModels::FResolvePurchaseDisputeRequest& request,
     const FResolvePurchaseDisputeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2546,7 +2547,7 @@ bool UPlayFabAdminInstanceAPI::ResolvePurchaseDispute(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResolvePurchaseDispute"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResolvePurchaseDisputeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2563,7 +2564,7 @@ void UPlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::RevokeAllBansForUser(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::RevokeAllBansForUser(
     AdminModels::FRevokeAllBansForUserRequest& request,
     const FRevokeAllBansForUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2576,7 +2577,7 @@ bool UPlayFabAdminInstanceAPI::RevokeAllBansForUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeAllBansForUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeAllBansForUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2593,7 +2594,7 @@ void UPlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminInstanceAPI::RevokeBans(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::RevokeBans(
     AdminModels::FRevokeBansRequest& request,
     const FRevokeBansDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2606,7 +2607,7 @@ bool UPlayFabAdminInstanceAPI::RevokeBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2623,7 +2624,7 @@ void UPlayFabAdminInstanceAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabAdminInstanceAPI::RevokeInventoryItem(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::RevokeInventoryItem(
     AdminModels::FRevokeInventoryItemRequest& request,
     const FRevokeInventoryItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2636,7 +2637,7 @@ bool UPlayFabAdminInstanceAPI::RevokeInventoryItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeInventoryItem"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2653,7 +2654,7 @@ void UPlayFabAdminInstanceAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabAdminInstanceAPI::RevokeInventoryItems(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::RevokeInventoryItems(
     AdminModels::FRevokeInventoryItemsRequest& request,
     const FRevokeInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2666,7 +2667,7 @@ bool UPlayFabAdminInstanceAPI::RevokeInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeInventoryItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2683,7 +2684,7 @@ void UPlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminInstanceAPI::RunTask(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::RunTask(
     AdminModels::FRunTaskRequest& request,
     const FRunTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2696,7 +2697,7 @@ bool UPlayFabAdminInstanceAPI::RunTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RunTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRunTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnRunTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRunTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2713,7 +2714,7 @@ void UPlayFabAdminInstanceAPI::OnRunTaskResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SendAccountRecoveryEmail(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SendAccountRecoveryEmail(
     AdminModels::FSendAccountRecoveryEmailRequest& request,
     const FSendAccountRecoveryEmailDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2726,7 +2727,7 @@ bool UPlayFabAdminInstanceAPI::SendAccountRecoveryEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SendAccountRecoveryEmail"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2743,7 +2744,7 @@ void UPlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetCatalogItems(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetCatalogItems(
     AdminModels::FUpdateCatalogItemsRequest& request,
     const FSetCatalogItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2756,7 +2757,7 @@ bool UPlayFabAdminInstanceAPI::SetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2773,7 +2774,7 @@ void UPlayFabAdminInstanceAPI::OnSetCatalogItemsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetMembershipOverride(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetMembershipOverride(
     AdminModels::FSetMembershipOverrideRequest& request,
     const FSetMembershipOverrideDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2786,7 +2787,7 @@ bool UPlayFabAdminInstanceAPI::SetMembershipOverride(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetMembershipOverride"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetMembershipOverrideResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetMembershipOverrideResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetMembershipOverrideDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2803,7 +2804,7 @@ void UPlayFabAdminInstanceAPI::OnSetMembershipOverrideResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetPlayerSecret(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetPlayerSecret(
     AdminModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2816,7 +2817,7 @@ bool UPlayFabAdminInstanceAPI::SetPlayerSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPlayerSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2833,7 +2834,7 @@ void UPlayFabAdminInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetPublishedRevision(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetPublishedRevision(
     AdminModels::FSetPublishedRevisionRequest& request,
     const FSetPublishedRevisionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2846,7 +2847,7 @@ bool UPlayFabAdminInstanceAPI::SetPublishedRevision(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPublishedRevision"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetPublishedRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetPublishedRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublishedRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2863,7 +2864,7 @@ void UPlayFabAdminInstanceAPI::OnSetPublishedRevisionResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetPublisherData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetPublisherData(
     AdminModels::FSetPublisherDataRequest& request,
     const FSetPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2876,7 +2877,7 @@ bool UPlayFabAdminInstanceAPI::SetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2893,7 +2894,7 @@ void UPlayFabAdminInstanceAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetStoreItems(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetStoreItems(
     AdminModels::FUpdateStoreItemsRequest& request,
     const FSetStoreItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2906,7 +2907,7 @@ bool UPlayFabAdminInstanceAPI::SetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2923,7 +2924,7 @@ void UPlayFabAdminInstanceAPI::OnSetStoreItemsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetTitleData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetTitleData(
     AdminModels::FSetTitleDataRequest& request,
     const FSetTitleDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2936,7 +2937,7 @@ bool UPlayFabAdminInstanceAPI::SetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2953,7 +2954,7 @@ void UPlayFabAdminInstanceAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetTitleDataAndOverrides(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetTitleDataAndOverrides(
     AdminModels::FSetTitleDataAndOverridesRequest& request,
     const FSetTitleDataAndOverridesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2966,7 +2967,7 @@ bool UPlayFabAdminInstanceAPI::SetTitleDataAndOverrides(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleDataAndOverrides"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataAndOverridesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2983,7 +2984,7 @@ void UPlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetTitleInternalData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetTitleInternalData(
     AdminModels::FSetTitleDataRequest& request,
     const FSetTitleInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2996,7 +2997,7 @@ bool UPlayFabAdminInstanceAPI::SetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3013,7 +3014,7 @@ void UPlayFabAdminInstanceAPI::OnSetTitleInternalDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SetupPushNotification(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SetupPushNotification(
     AdminModels::FSetupPushNotificationRequest& request,
     const FSetupPushNotificationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3026,7 +3027,7 @@ bool UPlayFabAdminInstanceAPI::SetupPushNotification(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetupPushNotification"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetupPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetupPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetupPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3043,7 +3044,7 @@ void UPlayFabAdminInstanceAPI::OnSetupPushNotificationResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabAdminInstanceAPI::SubtractUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::SubtractUserVirtualCurrency(
     AdminModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3056,7 +3057,7 @@ bool UPlayFabAdminInstanceAPI::SubtractUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3073,7 +3074,7 @@ void UPlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestP
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateBans(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateBans(
     AdminModels::FUpdateBansRequest& request,
     const FUpdateBansDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3086,7 +3087,7 @@ bool UPlayFabAdminInstanceAPI::UpdateBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3103,7 +3104,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateCatalogItems(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateCatalogItems(
     AdminModels::FUpdateCatalogItemsRequest& request,
     const FUpdateCatalogItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3116,7 +3117,7 @@ bool UPlayFabAdminInstanceAPI::UpdateCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3133,7 +3134,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateCloudScript(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateCloudScript(
     AdminModels::FUpdateCloudScriptRequest& request,
     const FUpdateCloudScriptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3146,7 +3147,7 @@ bool UPlayFabAdminInstanceAPI::UpdateCloudScript(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateCloudScript"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3163,7 +3164,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateCloudScriptResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateOpenIdConnection(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateOpenIdConnection(
     AdminModels::FUpdateOpenIdConnectionRequest& request,
     const FUpdateOpenIdConnectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3176,7 +3177,7 @@ bool UPlayFabAdminInstanceAPI::UpdateOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3193,7 +3194,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdatePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdatePlayerCustomProperties(
     AdminModels::FUpdatePlayerCustomPropertiesRequest& request,
     const FUpdatePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3206,7 +3207,7 @@ bool UPlayFabAdminInstanceAPI::UpdatePlayerCustomProperties(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePlayerCustomProperties"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3223,7 +3224,7 @@ void UPlayFabAdminInstanceAPI::OnUpdatePlayerCustomPropertiesResult(FHttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdatePlayerSharedSecret(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdatePlayerSharedSecret(
     AdminModels::FUpdatePlayerSharedSecretRequest& request,
     const FUpdatePlayerSharedSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3236,7 +3237,7 @@ bool UPlayFabAdminInstanceAPI::UpdatePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3253,7 +3254,7 @@ void UPlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdatePlayerStatisticDefinition(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdatePlayerStatisticDefinition(
     AdminModels::FUpdatePlayerStatisticDefinitionRequest& request,
     const FUpdatePlayerStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3266,7 +3267,7 @@ bool UPlayFabAdminInstanceAPI::UpdatePlayerStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3283,7 +3284,7 @@ void UPlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult(FHttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdatePolicy(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdatePolicy(
     AdminModels::FUpdatePolicyRequest& request,
     const FUpdatePolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3296,7 +3297,7 @@ bool UPlayFabAdminInstanceAPI::UpdatePolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePolicy"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3313,7 +3314,7 @@ void UPlayFabAdminInstanceAPI::OnUpdatePolicyResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateRandomResultTables(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateRandomResultTables(
     AdminModels::FUpdateRandomResultTablesRequest& request,
     const FUpdateRandomResultTablesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3326,7 +3327,7 @@ bool UPlayFabAdminInstanceAPI::UpdateRandomResultTables(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3343,7 +3344,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateSegment(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateSegment(
     AdminModels::FUpdateSegmentRequest& request,
     const FUpdateSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3356,7 +3357,7 @@ bool UPlayFabAdminInstanceAPI::UpdateSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3373,7 +3374,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateSegmentResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateStoreItems(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateStoreItems(
     AdminModels::FUpdateStoreItemsRequest& request,
     const FUpdateStoreItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3386,7 +3387,7 @@ bool UPlayFabAdminInstanceAPI::UpdateStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3403,7 +3404,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateStoreItemsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateTask(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateTask(
     AdminModels::FUpdateTaskRequest& request,
     const FUpdateTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3416,7 +3417,7 @@ bool UPlayFabAdminInstanceAPI::UpdateTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3433,7 +3434,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateTaskResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateUserData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateUserData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3446,7 +3447,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3463,7 +3464,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateUserInternalData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateUserInternalData(
     AdminModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3476,7 +3477,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3493,7 +3494,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateUserPublisherData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateUserPublisherData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3506,7 +3507,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3523,7 +3524,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateUserPublisherInternalData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateUserPublisherInternalData(
     AdminModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserPublisherInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3536,7 +3537,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3553,7 +3554,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateUserPublisherReadOnlyData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateUserPublisherReadOnlyData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3566,7 +3567,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3583,7 +3584,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequ
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateUserReadOnlyData(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateUserReadOnlyData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3596,7 +3597,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3613,7 +3614,7 @@ void UPlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabAdminInstanceAPI::UpdateUserTitleDisplayName(
+FPlayFabRequestHandle UPlayFabAdminInstanceAPI::UpdateUserTitleDisplayName(
     AdminModels::FUpdateUserTitleDisplayNameRequest& request,
     const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3626,7 +3627,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserTitleDisplayName(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3642,3 +3643,5 @@ void UPlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPt
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_ADMIN_API
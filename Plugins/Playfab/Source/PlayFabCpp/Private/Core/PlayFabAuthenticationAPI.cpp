@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_AUTHENTICATION_API
 #include "Core/PlayFabAuthenticationAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabAuthenticationAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabAuthenticationAPI::AuthenticateGameServerWithCustomId(
+FPlayFabRequestHandle UPlayFabAuthenticationAPI::AuthenticateGameServerWithCustomId(
     AuthenticationModels::FAuthenticateCustomIdRequest& request,
     const FAuthenticateGameServerWithCustomIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabAuthenticationAPI::AuthenticateGameServerWithCustomId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/GameServerIdentity/AuthenticateGameServerWithCustomId"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationAPI::OnAuthenticateGameServerWithCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAuthenticationAPI::OnAuthenticateGameServerWithCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAuthenticateGameServerWithCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -59,7 +60,7 @@ void UPlayFabAuthenticationAPI::OnAuthenticateGameServerWithCustomIdResult(FHttp
     }
 }
 
-bool UPlayFabAuthenticationAPI::Delete(
+FPlayFabRequestHandle UPlayFabAuthenticationAPI::Delete(
     AuthenticationModels::FDeleteRequest& request,
     const FDeleteDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -72,7 +73,7 @@ bool UPlayFabAuthenticationAPI::Delete(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/GameServerIdentity/Delete"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationAPI::OnDeleteResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAuthenticationAPI::OnDeleteResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -89,7 +90,7 @@ void UPlayFabAuthenticationAPI::OnDeleteResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabAuthenticationAPI::GetEntityToken(
+FPlayFabRequestHandle UPlayFabAuthenticationAPI::GetEntityToken(
     AuthenticationModels::FGetEntityTokenRequest& request,
     const FGetEntityTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -110,7 +111,7 @@ bool UPlayFabAuthenticationAPI::GetEntityToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Authentication/GetEntityToken"), request.toJSONString(), authKey, authValue);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationAPI::OnGetEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAuthenticationAPI::OnGetEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -129,7 +130,7 @@ void UPlayFabAuthenticationAPI::OnGetEntityTokenResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAuthenticationAPI::ValidateEntityToken(
+FPlayFabRequestHandle UPlayFabAuthenticationAPI::ValidateEntityToken(
     AuthenticationModels::FValidateEntityTokenRequest& request,
     const FValidateEntityTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -142,7 +143,7 @@ bool UPlayFabAuthenticationAPI::ValidateEntityToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Authentication/ValidateEntityToken"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationAPI::OnValidateEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAuthenticationAPI::OnValidateEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -158,3 +159,5 @@ void UPlayFabAuthenticationAPI::OnValidateEntityTokenResult(FHttpRequestPtr Http
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_AUTHENTICATION_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_AUTHENTICATION_API
 
 #include "Core/PlayFabAuthenticationDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -58,6 +59,7 @@ bool PlayFab::AuthenticationModels::FAuthenticateCustomIdRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -83,7 +85,7 @@ void PlayFab::AuthenticationModels::FEntityKey::writeJSON(JsonWriter& writer) co
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -247,6 +249,7 @@ bool PlayFab::AuthenticationModels::FDeleteRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -293,7 +296,7 @@ void PlayFab::AuthenticationModels::FEntityLineage::writeJSON(JsonWriter& writer
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (GroupId.IsEmpty() == false)
@@ -415,6 +418,7 @@ bool PlayFab::AuthenticationModels::FGetEntityTokenRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -511,22 +515,22 @@ AuthenticationModels::IdentifiedDeviceType PlayFab::AuthenticationModels::readId
 
 AuthenticationModels::IdentifiedDeviceType PlayFab::AuthenticationModels::readIdentifiedDeviceTypeFromValue(const FString& value)
 {
-    static TMap<FString, IdentifiedDeviceType> _IdentifiedDeviceTypeMap;
-    if (_IdentifiedDeviceTypeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _IdentifiedDeviceTypeMap.Add(TEXT("Unknown"), IdentifiedDeviceTypeUnknown);
-        _IdentifiedDeviceTypeMap.Add(TEXT("XboxOne"), IdentifiedDeviceTypeXboxOne);
-        _IdentifiedDeviceTypeMap.Add(TEXT("Scarlett"), IdentifiedDeviceTypeScarlett);
-        _IdentifiedDeviceTypeMap.Add(TEXT("WindowsOneCore"), IdentifiedDeviceTypeWindowsOneCore);
-        _IdentifiedDeviceTypeMap.Add(TEXT("WindowsOneCoreMobile"), IdentifiedDeviceTypeWindowsOneCoreMobile);
-        _IdentifiedDeviceTypeMap.Add(TEXT("Win32"), IdentifiedDeviceTypeWin32);
-        _IdentifiedDeviceTypeMap.Add(TEXT("android"), IdentifiedDeviceTypeandroid);
-        _IdentifiedDeviceTypeMap.Add(TEXT("iOS"), IdentifiedDeviceTypeiOS);
-        _IdentifiedDeviceTypeMap.Add(TEXT("PlayStation"), IdentifiedDeviceTypePlayStation);
-        _IdentifiedDeviceTypeMap.Add(TEXT("Nintendo"), IdentifiedDeviceTypeNintendo);
-
-    }
+    static const TMap<FString, IdentifiedDeviceType> _IdentifiedDeviceTypeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, IdentifiedDeviceType> Map;
+        Map.Add(TEXT("Unknown"), IdentifiedDeviceTypeUnknown);
+        Map.Add(TEXT("XboxOne"), IdentifiedDeviceTypeXboxOne);
+        Map.Add(TEXT("Scarlett"), IdentifiedDeviceTypeScarlett);
+        Map.Add(TEXT("WindowsOneCore"), IdentifiedDeviceTypeWindowsOneCore);
+        Map.Add(TEXT("WindowsOneCoreMobile"), IdentifiedDeviceTypeWindowsOneCoreMobile);
+        Map.Add(TEXT("Win32"), IdentifiedDeviceTypeWin32);
+        Map.Add(TEXT("android"), IdentifiedDeviceTypeandroid);
+        Map.Add(TEXT("iOS"), IdentifiedDeviceTypeiOS);
+        Map.Add(TEXT("PlayStation"), IdentifiedDeviceTypePlayStation);
+        Map.Add(TEXT("Nintendo"), IdentifiedDeviceTypeNintendo);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -577,36 +581,36 @@ AuthenticationModels::LoginIdentityProvider PlayFab::AuthenticationModels::readL
 
 AuthenticationModels::LoginIdentityProvider PlayFab::AuthenticationModels::readLoginIdentityProviderFromValue(const FString& value)
 {
-    static TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap;
-    if (_LoginIdentityProviderMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _LoginIdentityProviderMap.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
-        _LoginIdentityProviderMap.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
-        _LoginIdentityProviderMap.Add(TEXT("Custom"), LoginIdentityProviderCustom);
-        _LoginIdentityProviderMap.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
-        _LoginIdentityProviderMap.Add(TEXT("Steam"), LoginIdentityProviderSteam);
-        _LoginIdentityProviderMap.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
-        _LoginIdentityProviderMap.Add(TEXT("PSN"), LoginIdentityProviderPSN);
-        _LoginIdentityProviderMap.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
-        _LoginIdentityProviderMap.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
-        _LoginIdentityProviderMap.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
-        _LoginIdentityProviderMap.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
-        _LoginIdentityProviderMap.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
-        _LoginIdentityProviderMap.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
-        _LoginIdentityProviderMap.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
-        _LoginIdentityProviderMap.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
-        _LoginIdentityProviderMap.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
-        _LoginIdentityProviderMap.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
-        _LoginIdentityProviderMap.Add(TEXT("Apple"), LoginIdentityProviderApple);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
-        _LoginIdentityProviderMap.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
-        _LoginIdentityProviderMap.Add(TEXT("King"), LoginIdentityProviderKing);
-
-    }
+    static const TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, LoginIdentityProvider> Map;
+        Map.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
+        Map.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
+        Map.Add(TEXT("Custom"), LoginIdentityProviderCustom);
+        Map.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
+        Map.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
+        Map.Add(TEXT("Steam"), LoginIdentityProviderSteam);
+        Map.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
+        Map.Add(TEXT("PSN"), LoginIdentityProviderPSN);
+        Map.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
+        Map.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
+        Map.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
+        Map.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
+        Map.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
+        Map.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
+        Map.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
+        Map.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
+        Map.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
+        Map.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
+        Map.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
+        Map.Add(TEXT("Apple"), LoginIdentityProviderApple);
+        Map.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
+        Map.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
+        Map.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
+        Map.Add(TEXT("King"), LoginIdentityProviderKing);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -658,6 +662,7 @@ bool PlayFab::AuthenticationModels::FValidateEntityTokenRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -748,3 +753,5 @@ bool PlayFab::AuthenticationModels::FValidateEntityTokenResponse::readFromValue(
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_AUTHENTICATION_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_AUTHENTICATION_API
 #include "Core/PlayFabAuthenticationInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabAuthenticationInstanceAPI::Get
     return this->authContext;
 }
 
-bool UPlayFabAuthenticationInstanceAPI::AuthenticateGameServerWithCustomId(
+FPlayFabRequestHandle UPlayFabAuthenticationInstanceAPI::AuthenticateGameServerWithCustomId(
     AuthenticationModels::FAuthenticateCustomIdRequest& request,
     const FAuthenticateGameServerWithCustomIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabAuthenticationInstanceAPI::AuthenticateGameServerWithCustomId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/GameServerIdentity/AuthenticateGameServerWithCustomId"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationInstanceAPI::OnAuthenticateGameServerWithCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAuthenticationInstanceAPI::OnAuthenticateGameServerWithCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAuthenticateGameServerWithCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -109,7 +110,7 @@ void UPlayFabAuthenticationInstanceAPI::OnAuthenticateGameServerWithCustomIdResu
     }
 }
 
-bool UPlayFabAuthenticationInstanceAPI::Delete(
+FPlayFabRequestHandle UPlayFabAuthenticationInstanceAPI::Delete(
     AuthenticationModels::FDeleteRequest& request,
     const FDeleteDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -122,7 +123,7 @@ bool UPlayFabAuthenticationInstanceAPI::Delete(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/GameServerIdentity/Delete"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationInstanceAPI::OnDeleteResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAuthenticationInstanceAPI::OnDeleteResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -139,7 +140,7 @@ void UPlayFabAuthenticationInstanceAPI::OnDeleteResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabAuthenticationInstanceAPI::GetEntityToken(
+FPlayFabRequestHandle UPlayFabAuthenticationInstanceAPI::GetEntityToken(
     AuthenticationModels::FGetEntityTokenRequest& request,
     const FGetEntityTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -161,7 +162,7 @@ bool UPlayFabAuthenticationInstanceAPI::GetEntityToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Authentication/GetEntityToken"), request.toJSONString(), authKey, authValue);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -180,7 +181,7 @@ void UPlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabAuthenticationInstanceAPI::ValidateEntityToken(
+FPlayFabRequestHandle UPlayFabAuthenticationInstanceAPI::ValidateEntityToken(
     AuthenticationModels::FValidateEntityTokenRequest& request,
     const FValidateEntityTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -193,7 +194,7 @@ bool UPlayFabAuthenticationInstanceAPI::ValidateEntityToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Authentication/ValidateEntityToken"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -209,3 +210,5 @@ void UPlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult(FHttpRequest
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_AUTHENTICATION_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_CLIENT_API
 #include "Core/PlayFabClientAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -33,7 +34,7 @@ bool UPlayFabClientAPI::IsClientLoggedIn() const
 
 
 
-bool UPlayFabClientAPI::AcceptTrade(
+FPlayFabRequestHandle UPlayFabClientAPI::AcceptTrade(
     ClientModels::FAcceptTradeRequest& request,
     const FAcceptTradeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -41,13 +42,13 @@ bool UPlayFabClientAPI::AcceptTrade(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AcceptTrade"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAcceptTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnAcceptTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -64,7 +65,7 @@ void UPlayFabClientAPI::OnAcceptTradeResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabClientAPI::AddFriend(
+FPlayFabRequestHandle UPlayFabClientAPI::AddFriend(
     ClientModels::FAddFriendRequest& request,
     const FAddFriendDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -72,13 +73,13 @@ bool UPlayFabClientAPI::AddFriend(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddFriend"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -95,7 +96,7 @@ void UPlayFabClientAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, FHttpResp
     }
 }
 
-bool UPlayFabClientAPI::AddGenericID(
+FPlayFabRequestHandle UPlayFabClientAPI::AddGenericID(
     ClientModels::FAddGenericIDRequest& request,
     const FAddGenericIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -103,13 +104,13 @@ bool UPlayFabClientAPI::AddGenericID(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddGenericID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -126,7 +127,7 @@ void UPlayFabClientAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::AddOrUpdateContactEmail(
+FPlayFabRequestHandle UPlayFabClientAPI::AddOrUpdateContactEmail(
     ClientModels::FAddOrUpdateContactEmailRequest& request,
     const FAddOrUpdateContactEmailDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -134,13 +135,13 @@ bool UPlayFabClientAPI::AddOrUpdateContactEmail(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddOrUpdateContactEmail"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddOrUpdateContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnAddOrUpdateContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddOrUpdateContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -157,7 +158,7 @@ void UPlayFabClientAPI::OnAddOrUpdateContactEmailResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientAPI::AddSharedGroupMembers(
+FPlayFabRequestHandle UPlayFabClientAPI::AddSharedGroupMembers(
     ClientModels::FAddSharedGroupMembersRequest& request,
     const FAddSharedGroupMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -165,13 +166,13 @@ bool UPlayFabClientAPI::AddSharedGroupMembers(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -188,7 +189,7 @@ void UPlayFabClientAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::AddUsernamePassword(
+FPlayFabRequestHandle UPlayFabClientAPI::AddUsernamePassword(
     ClientModels::FAddUsernamePasswordRequest& request,
     const FAddUsernamePasswordDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -196,13 +197,13 @@ bool UPlayFabClientAPI::AddUsernamePassword(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddUsernamePassword"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddUsernamePasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnAddUsernamePasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUsernamePasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -219,7 +220,7 @@ void UPlayFabClientAPI::OnAddUsernamePasswordResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::AddUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabClientAPI::AddUserVirtualCurrency(
     ClientModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -227,13 +228,13 @@ bool UPlayFabClientAPI::AddUserVirtualCurrency(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -250,7 +251,7 @@ void UPlayFabClientAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
+FPlayFabRequestHandle UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     ClientModels::FAndroidDevicePushNotificationRegistrationRequest& request,
     const FAndroidDevicePushNotificationRegistrationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -258,13 +259,13 @@ bool UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AndroidDevicePushNotificationRegistration"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAndroidDevicePushNotificationRegistrationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -281,7 +282,7 @@ void UPlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult(FHttpR
     }
 }
 
-bool UPlayFabClientAPI::AttributeInstall(
+FPlayFabRequestHandle UPlayFabClientAPI::AttributeInstall(
     ClientModels::FAttributeInstallRequest& request,
     const FAttributeInstallDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -289,13 +290,13 @@ bool UPlayFabClientAPI::AttributeInstall(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AttributeInstall"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAttributeInstallResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnAttributeInstallResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAttributeInstallDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -312,7 +313,7 @@ void UPlayFabClientAPI::OnAttributeInstallResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::CancelTrade(
+FPlayFabRequestHandle UPlayFabClientAPI::CancelTrade(
     ClientModels::FCancelTradeRequest& request,
     const FCancelTradeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -320,13 +321,13 @@ bool UPlayFabClientAPI::CancelTrade(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/CancelTrade"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnCancelTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnCancelTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -343,7 +344,7 @@ void UPlayFabClientAPI::OnCancelTradeResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabClientAPI::ConfirmPurchase(
+FPlayFabRequestHandle UPlayFabClientAPI::ConfirmPurchase(
     ClientModels::FConfirmPurchaseRequest& request,
     const FConfirmPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -351,13 +352,13 @@ bool UPlayFabClientAPI::ConfirmPurchase(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConfirmPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConfirmPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnConfirmPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConfirmPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -374,7 +375,7 @@ void UPlayFabClientAPI::OnConfirmPurchaseResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::ConsumeItem(
+FPlayFabRequestHandle UPlayFabClientAPI::ConsumeItem(
     ClientModels::FConsumeItemRequest& request,
     const FConsumeItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -382,13 +383,13 @@ bool UPlayFabClientAPI::ConsumeItem(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeItem"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -405,7 +406,7 @@ void UPlayFabClientAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(
+FPlayFabRequestHandle UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(
     ClientModels::FConsumeMicrosoftStoreEntitlementsRequest& request,
     const FConsumeMicrosoftStoreEntitlementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -413,13 +414,13 @@ bool UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeMicrosoftStoreEntitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumeMicrosoftStoreEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnConsumeMicrosoftStoreEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeMicrosoftStoreEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -436,7 +437,7 @@ void UPlayFabClientAPI::OnConsumeMicrosoftStoreEntitlementsResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabClientAPI::ConsumePS5Entitlements(
+FPlayFabRequestHandle UPlayFabClientAPI::ConsumePS5Entitlements(
     ClientModels::FConsumePS5EntitlementsRequest& request,
     const FConsumePS5EntitlementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -444,13 +445,13 @@ bool UPlayFabClientAPI::ConsumePS5Entitlements(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumePS5Entitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumePS5EntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnConsumePS5EntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePS5EntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -467,7 +468,7 @@ void UPlayFabClientAPI::OnConsumePS5EntitlementsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientAPI::ConsumePSNEntitlements(
+FPlayFabRequestHandle UPlayFabClientAPI::ConsumePSNEntitlements(
     ClientModels::FConsumePSNEntitlementsRequest& request,
     const FConsumePSNEntitlementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -475,13 +476,13 @@ bool UPlayFabClientAPI::ConsumePSNEntitlements(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumePSNEntitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumePSNEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnConsumePSNEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePSNEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -498,7 +499,7 @@ void UPlayFabClientAPI::OnConsumePSNEntitlementsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientAPI::ConsumeXboxEntitlements(
+FPlayFabRequestHandle UPlayFabClientAPI::ConsumeXboxEntitlements(
     ClientModels::FConsumeXboxEntitlementsRequest& request,
     const FConsumeXboxEntitlementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -506,13 +507,13 @@ bool UPlayFabClientAPI::ConsumeXboxEntitlements(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeXboxEntitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumeXboxEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnConsumeXboxEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeXboxEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -529,7 +530,7 @@ void UPlayFabClientAPI::OnConsumeXboxEntitlementsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientAPI::CreateSharedGroup(
+FPlayFabRequestHandle UPlayFabClientAPI::CreateSharedGroup(
     ClientModels::FCreateSharedGroupRequest& request,
     const FCreateSharedGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -537,13 +538,13 @@ bool UPlayFabClientAPI::CreateSharedGroup(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/CreateSharedGroup"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -560,7 +561,7 @@ void UPlayFabClientAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientAPI::DeletePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabClientAPI::DeletePlayerCustomProperties(
     ClientModels::FDeletePlayerCustomPropertiesRequest& request,
     const FDeletePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -568,13 +569,13 @@ bool UPlayFabClientAPI::DeletePlayerCustomProperties(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/DeletePlayerCustomProperties"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnDeletePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnDeletePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -591,7 +592,7 @@ void UPlayFabClientAPI::OnDeletePlayerCustomPropertiesResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientAPI::ExecuteCloudScript(
+FPlayFabRequestHandle UPlayFabClientAPI::ExecuteCloudScript(
     ClientModels::FExecuteCloudScriptRequest& request,
     const FExecuteCloudScriptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -599,13 +600,13 @@ bool UPlayFabClientAPI::ExecuteCloudScript(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ExecuteCloudScript"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -622,7 +623,7 @@ void UPlayFabClientAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::GetAccountInfo(
+FPlayFabRequestHandle UPlayFabClientAPI::GetAccountInfo(
     ClientModels::FGetAccountInfoRequest& request,
     const FGetAccountInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -630,13 +631,13 @@ bool UPlayFabClientAPI::GetAccountInfo(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAccountInfo"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -653,7 +654,7 @@ void UPlayFabClientAPI::OnGetAccountInfoResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::GetAdPlacements(
+FPlayFabRequestHandle UPlayFabClientAPI::GetAdPlacements(
     ClientModels::FGetAdPlacementsRequest& request,
     const FGetAdPlacementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -661,13 +662,13 @@ bool UPlayFabClientAPI::GetAdPlacements(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAdPlacements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetAdPlacementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetAdPlacementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAdPlacementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -684,7 +685,7 @@ void UPlayFabClientAPI::OnGetAdPlacementsResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::GetAllUsersCharacters(
+FPlayFabRequestHandle UPlayFabClientAPI::GetAllUsersCharacters(
     ClientModels::FListUsersCharactersRequest& request,
     const FGetAllUsersCharactersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -692,13 +693,13 @@ bool UPlayFabClientAPI::GetAllUsersCharacters(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAllUsersCharacters"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllUsersCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -715,7 +716,7 @@ void UPlayFabClientAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::GetCatalogItems(
+FPlayFabRequestHandle UPlayFabClientAPI::GetCatalogItems(
     ClientModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -723,13 +724,13 @@ bool UPlayFabClientAPI::GetCatalogItems(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCatalogItems"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -746,7 +747,7 @@ void UPlayFabClientAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::GetCharacterData(
+FPlayFabRequestHandle UPlayFabClientAPI::GetCharacterData(
     ClientModels::FGetCharacterDataRequest& request,
     const FGetCharacterDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -754,13 +755,13 @@ bool UPlayFabClientAPI::GetCharacterData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -777,7 +778,7 @@ void UPlayFabClientAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::GetCharacterInventory(
+FPlayFabRequestHandle UPlayFabClientAPI::GetCharacterInventory(
     ClientModels::FGetCharacterInventoryRequest& request,
     const FGetCharacterInventoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -785,13 +786,13 @@ bool UPlayFabClientAPI::GetCharacterInventory(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterInventory"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetCharacterInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -808,7 +809,7 @@ void UPlayFabClientAPI::OnGetCharacterInventoryResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::GetCharacterLeaderboard(
+FPlayFabRequestHandle UPlayFabClientAPI::GetCharacterLeaderboard(
     ClientModels::FGetCharacterLeaderboardRequest& request,
     const FGetCharacterLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -816,13 +817,13 @@ bool UPlayFabClientAPI::GetCharacterLeaderboard(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -839,7 +840,7 @@ void UPlayFabClientAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientAPI::GetCharacterReadOnlyData(
+FPlayFabRequestHandle UPlayFabClientAPI::GetCharacterReadOnlyData(
     ClientModels::FGetCharacterDataRequest& request,
     const FGetCharacterReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -847,13 +848,13 @@ bool UPlayFabClientAPI::GetCharacterReadOnlyData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -870,7 +871,7 @@ void UPlayFabClientAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientAPI::GetCharacterStatistics(
+FPlayFabRequestHandle UPlayFabClientAPI::GetCharacterStatistics(
     ClientModels::FGetCharacterStatisticsRequest& request,
     const FGetCharacterStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -878,13 +879,13 @@ bool UPlayFabClientAPI::GetCharacterStatistics(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -901,7 +902,7 @@ void UPlayFabClientAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientAPI::GetContentDownloadUrl(
+FPlayFabRequestHandle UPlayFabClientAPI::GetContentDownloadUrl(
     ClientModels::FGetContentDownloadUrlRequest& request,
     const FGetContentDownloadUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -909,13 +910,13 @@ bool UPlayFabClientAPI::GetContentDownloadUrl(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetContentDownloadUrl"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -932,7 +933,7 @@ void UPlayFabClientAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::GetFriendLeaderboard(
+FPlayFabRequestHandle UPlayFabClientAPI::GetFriendLeaderboard(
     ClientModels::FGetFriendLeaderboardRequest& request,
     const FGetFriendLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -940,13 +941,13 @@ bool UPlayFabClientAPI::GetFriendLeaderboard(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -963,7 +964,7 @@ void UPlayFabClientAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
+FPlayFabRequestHandle UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
     ClientModels::FGetFriendLeaderboardAroundPlayerRequest& request,
     const FGetFriendLeaderboardAroundPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -971,13 +972,13 @@ bool UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -994,7 +995,7 @@ void UPlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientAPI::GetFriendsList(
+FPlayFabRequestHandle UPlayFabClientAPI::GetFriendsList(
     ClientModels::FGetFriendsListRequest& request,
     const FGetFriendsListDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1002,13 +1003,13 @@ bool UPlayFabClientAPI::GetFriendsList(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendsList"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetFriendsListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendsListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1025,7 +1026,7 @@ void UPlayFabClientAPI::OnGetFriendsListResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::GetLeaderboard(
+FPlayFabRequestHandle UPlayFabClientAPI::GetLeaderboard(
     ClientModels::FGetLeaderboardRequest& request,
     const FGetLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1033,13 +1034,13 @@ bool UPlayFabClientAPI::GetLeaderboard(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1056,7 +1057,7 @@ void UPlayFabClientAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::GetLeaderboardAroundCharacter(
+FPlayFabRequestHandle UPlayFabClientAPI::GetLeaderboardAroundCharacter(
     ClientModels::FGetLeaderboardAroundCharacterRequest& request,
     const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1064,13 +1065,13 @@ bool UPlayFabClientAPI::GetLeaderboardAroundCharacter(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardAroundCharacter"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardAroundCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1087,7 +1088,7 @@ void UPlayFabClientAPI::OnGetLeaderboardAroundCharacterResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientAPI::GetLeaderboardAroundPlayer(
+FPlayFabRequestHandle UPlayFabClientAPI::GetLeaderboardAroundPlayer(
     ClientModels::FGetLeaderboardAroundPlayerRequest& request,
     const FGetLeaderboardAroundPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1095,13 +1096,13 @@ bool UPlayFabClientAPI::GetLeaderboardAroundPlayer(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1118,7 +1119,7 @@ void UPlayFabClientAPI::OnGetLeaderboardAroundPlayerResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::GetLeaderboardForUserCharacters(
+FPlayFabRequestHandle UPlayFabClientAPI::GetLeaderboardForUserCharacters(
     ClientModels::FGetLeaderboardForUsersCharactersRequest& request,
     const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1126,13 +1127,13 @@ bool UPlayFabClientAPI::GetLeaderboardForUserCharacters(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardForUserCharacters"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardForUserCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForUserCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1149,7 +1150,7 @@ void UPlayFabClientAPI::OnGetLeaderboardForUserCharactersResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientAPI::GetPaymentToken(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPaymentToken(
     ClientModels::FGetPaymentTokenRequest& request,
     const FGetPaymentTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1157,13 +1158,13 @@ bool UPlayFabClientAPI::GetPaymentToken(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPaymentToken"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPaymentTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPaymentTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPaymentTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1180,7 +1181,7 @@ void UPlayFabClientAPI::OnGetPaymentTokenResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::GetPhotonAuthenticationToken(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPhotonAuthenticationToken(
     ClientModels::FGetPhotonAuthenticationTokenRequest& request,
     const FGetPhotonAuthenticationTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1188,13 +1189,13 @@ bool UPlayFabClientAPI::GetPhotonAuthenticationToken(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPhotonAuthenticationToken"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPhotonAuthenticationTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPhotonAuthenticationTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPhotonAuthenticationTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1211,7 +1212,7 @@ void UPlayFabClientAPI::OnGetPhotonAuthenticationTokenResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientAPI::GetPlayerCombinedInfo(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayerCombinedInfo(
     ClientModels::FGetPlayerCombinedInfoRequest& request,
     const FGetPlayerCombinedInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1219,13 +1220,13 @@ bool UPlayFabClientAPI::GetPlayerCombinedInfo(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerCombinedInfo"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCombinedInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1242,7 +1243,7 @@ void UPlayFabClientAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::GetPlayerCustomProperty(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayerCustomProperty(
     ClientModels::FGetPlayerCustomPropertyRequest& request,
     const FGetPlayerCustomPropertyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1250,13 +1251,13 @@ bool UPlayFabClientAPI::GetPlayerCustomProperty(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerCustomProperty"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerCustomPropertyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCustomPropertyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1273,7 +1274,7 @@ void UPlayFabClientAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientAPI::GetPlayerProfile(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayerProfile(
     ClientModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1281,13 +1282,13 @@ bool UPlayFabClientAPI::GetPlayerProfile(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerProfile"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1304,7 +1305,7 @@ void UPlayFabClientAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::GetPlayerSegments(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayerSegments(
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -1312,7 +1313,7 @@ bool UPlayFabClientAPI::GetPlayerSegments(
     return UPlayFabClientAPI::GetPlayerSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabClientAPI::GetPlayerSegments(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayerSegments(
     ClientModels::FGetPlayerSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1320,13 +1321,13 @@ bool UPlayFabClientAPI::GetPlayerSegments(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerSegments"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1343,7 +1344,7 @@ void UPlayFabClientAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientAPI::GetPlayerStatistics(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayerStatistics(
     ClientModels::FGetPlayerStatisticsRequest& request,
     const FGetPlayerStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1351,13 +1352,13 @@ bool UPlayFabClientAPI::GetPlayerStatistics(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1374,7 +1375,7 @@ void UPlayFabClientAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::GetPlayerStatisticVersions(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayerStatisticVersions(
     ClientModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1382,13 +1383,13 @@ bool UPlayFabClientAPI::GetPlayerStatisticVersions(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1405,7 +1406,7 @@ void UPlayFabClientAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::GetPlayerTags(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayerTags(
     ClientModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1413,13 +1414,13 @@ bool UPlayFabClientAPI::GetPlayerTags(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerTags"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1436,7 +1437,7 @@ void UPlayFabClientAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabClientAPI::GetPlayerTrades(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayerTrades(
     ClientModels::FGetPlayerTradesRequest& request,
     const FGetPlayerTradesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1444,13 +1445,13 @@ bool UPlayFabClientAPI::GetPlayerTrades(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerTrades"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerTradesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayerTradesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTradesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1467,7 +1468,7 @@ void UPlayFabClientAPI::OnGetPlayerTradesResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
     ClientModels::FGetPlayFabIDsFromFacebookIDsRequest& request,
     const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1475,13 +1476,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromFacebookIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1498,7 +1499,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request,
     const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1506,13 +1507,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1529,7 +1530,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(FHttpRe
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
     ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest& request,
     const FGetPlayFabIDsFromGameCenterIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1537,13 +1538,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGameCenterIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGameCenterIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1560,7 +1561,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
     ClientModels::FGetPlayFabIDsFromGenericIDsRequest& request,
     const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1568,13 +1569,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGenericIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGenericIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1591,7 +1592,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
     ClientModels::FGetPlayFabIDsFromGoogleIDsRequest& request,
     const FGetPlayFabIDsFromGoogleIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1599,13 +1600,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGoogleIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGoogleIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1622,7 +1623,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromGooglePlayGamesPlayerIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromGooglePlayGamesPlayerIDs(
     ClientModels::FGetPlayFabIDsFromGooglePlayGamesPlayerIDsRequest& request,
     const FGetPlayFabIDsFromGooglePlayGamesPlayerIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1630,13 +1631,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGooglePlayGamesPlayerIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGooglePlayGamesPlayerIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGooglePlayGamesPlayerIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGooglePlayGamesPlayerIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGooglePlayGamesPlayerIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1653,7 +1654,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromGooglePlayGamesPlayerIDsResult(FHttpR
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
     ClientModels::FGetPlayFabIDsFromKongregateIDsRequest& request,
     const FGetPlayFabIDsFromKongregateIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1661,13 +1662,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromKongregateIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromKongregateIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1684,7 +1685,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
     ClientModels::FGetPlayFabIDsFromNintendoServiceAccountIdsRequest& request,
     const FGetPlayFabIDsFromNintendoServiceAccountIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1692,13 +1693,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromNintendoServiceAccountIds"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoServiceAccountIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1715,7 +1716,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResult(FHttp
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request,
     const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1723,13 +1724,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1746,7 +1747,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FHttpRe
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(
     ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request,
     const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1754,13 +1755,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNAccountIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1777,7 +1778,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromPSNOnlineIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromPSNOnlineIDs(
     ClientModels::FGetPlayFabIDsFromPSNOnlineIDsRequest& request,
     const FGetPlayFabIDsFromPSNOnlineIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1785,13 +1786,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromPSNOnlineIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromPSNOnlineIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromPSNOnlineIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromPSNOnlineIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNOnlineIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1808,7 +1809,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromPSNOnlineIDsResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
     ClientModels::FGetPlayFabIDsFromSteamIDsRequest& request,
     const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1816,13 +1817,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromSteamIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1839,7 +1840,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromSteamNames(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromSteamNames(
     ClientModels::FGetPlayFabIDsFromSteamNamesRequest& request,
     const FGetPlayFabIDsFromSteamNamesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1847,13 +1848,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromSteamNames(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromSteamNames"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromSteamNamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromSteamNamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamNamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1870,7 +1871,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromSteamNamesResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
     ClientModels::FGetPlayFabIDsFromTwitchIDsRequest& request,
     const FGetPlayFabIDsFromTwitchIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1878,13 +1879,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromTwitchIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromTwitchIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1901,7 +1902,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(
     ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request,
     const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1909,13 +1910,13 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1932,7 +1933,7 @@ void UPlayFabClientAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientAPI::GetPublisherData(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPublisherData(
     ClientModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1940,13 +1941,13 @@ bool UPlayFabClientAPI::GetPublisherData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPublisherData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1963,7 +1964,7 @@ void UPlayFabClientAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::GetPurchase(
+FPlayFabRequestHandle UPlayFabClientAPI::GetPurchase(
     ClientModels::FGetPurchaseRequest& request,
     const FGetPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1971,13 +1972,13 @@ bool UPlayFabClientAPI::GetPurchase(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1994,7 +1995,7 @@ void UPlayFabClientAPI::OnGetPurchaseResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabClientAPI::GetSharedGroupData(
+FPlayFabRequestHandle UPlayFabClientAPI::GetSharedGroupData(
     ClientModels::FGetSharedGroupDataRequest& request,
     const FGetSharedGroupDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2002,13 +2003,13 @@ bool UPlayFabClientAPI::GetSharedGroupData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2025,7 +2026,7 @@ void UPlayFabClientAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::GetStoreItems(
+FPlayFabRequestHandle UPlayFabClientAPI::GetStoreItems(
     ClientModels::FGetStoreItemsRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2033,13 +2034,13 @@ bool UPlayFabClientAPI::GetStoreItems(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetStoreItems"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2056,7 +2057,7 @@ void UPlayFabClientAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabClientAPI::GetTime(
+FPlayFabRequestHandle UPlayFabClientAPI::GetTime(
     const FGetTimeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -2064,7 +2065,7 @@ bool UPlayFabClientAPI::GetTime(
     return UPlayFabClientAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabClientAPI::GetTime(
+FPlayFabRequestHandle UPlayFabClientAPI::GetTime(
     ClientModels::FGetTimeRequest& request,
     const FGetTimeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2072,13 +2073,13 @@ bool UPlayFabClientAPI::GetTime(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTime"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTimeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2095,7 +2096,7 @@ void UPlayFabClientAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHttpRespon
     }
 }
 
-bool UPlayFabClientAPI::GetTitleData(
+FPlayFabRequestHandle UPlayFabClientAPI::GetTitleData(
     ClientModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2103,13 +2104,13 @@ bool UPlayFabClientAPI::GetTitleData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitleData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2126,7 +2127,7 @@ void UPlayFabClientAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::GetTitleNews(
+FPlayFabRequestHandle UPlayFabClientAPI::GetTitleNews(
     ClientModels::FGetTitleNewsRequest& request,
     const FGetTitleNewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2134,13 +2135,13 @@ bool UPlayFabClientAPI::GetTitleNews(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitleNews"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2157,7 +2158,7 @@ void UPlayFabClientAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::GetTitlePublicKey(
+FPlayFabRequestHandle UPlayFabClientAPI::GetTitlePublicKey(
     ClientModels::FGetTitlePublicKeyRequest& request,
     const FGetTitlePublicKeyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2166,7 +2167,7 @@ bool UPlayFabClientAPI::GetTitlePublicKey(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitlePublicKey"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTitlePublicKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetTitlePublicKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePublicKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2183,7 +2184,7 @@ void UPlayFabClientAPI::OnGetTitlePublicKeyResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientAPI::GetTradeStatus(
+FPlayFabRequestHandle UPlayFabClientAPI::GetTradeStatus(
     ClientModels::FGetTradeStatusRequest& request,
     const FGetTradeStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2191,13 +2192,13 @@ bool UPlayFabClientAPI::GetTradeStatus(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTradeStatus"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTradeStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetTradeStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTradeStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2214,7 +2215,7 @@ void UPlayFabClientAPI::OnGetTradeStatusResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::GetUserData(
+FPlayFabRequestHandle UPlayFabClientAPI::GetUserData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2222,13 +2223,13 @@ bool UPlayFabClientAPI::GetUserData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2245,7 +2246,7 @@ void UPlayFabClientAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabClientAPI::GetUserInventory(
+FPlayFabRequestHandle UPlayFabClientAPI::GetUserInventory(
     ClientModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2253,13 +2254,13 @@ bool UPlayFabClientAPI::GetUserInventory(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserInventory"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2276,7 +2277,7 @@ void UPlayFabClientAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::GetUserPublisherData(
+FPlayFabRequestHandle UPlayFabClientAPI::GetUserPublisherData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2284,13 +2285,13 @@ bool UPlayFabClientAPI::GetUserPublisherData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2307,7 +2308,7 @@ void UPlayFabClientAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientAPI::GetUserPublisherReadOnlyData(
+FPlayFabRequestHandle UPlayFabClientAPI::GetUserPublisherReadOnlyData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2315,13 +2316,13 @@ bool UPlayFabClientAPI::GetUserPublisherReadOnlyData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2338,7 +2339,7 @@ void UPlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientAPI::GetUserReadOnlyData(
+FPlayFabRequestHandle UPlayFabClientAPI::GetUserReadOnlyData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2346,13 +2347,13 @@ bool UPlayFabClientAPI::GetUserReadOnlyData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2369,7 +2370,7 @@ void UPlayFabClientAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::GrantCharacterToUser(
+FPlayFabRequestHandle UPlayFabClientAPI::GrantCharacterToUser(
     ClientModels::FGrantCharacterToUserRequest& request,
     const FGrantCharacterToUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2377,13 +2378,13 @@ bool UPlayFabClientAPI::GrantCharacterToUser(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GrantCharacterToUser"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnGrantCharacterToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantCharacterToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2400,7 +2401,7 @@ void UPlayFabClientAPI::OnGrantCharacterToUserResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientAPI::LinkAndroidDeviceID(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkAndroidDeviceID(
     ClientModels::FLinkAndroidDeviceIDRequest& request,
     const FLinkAndroidDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2408,13 +2409,13 @@ bool UPlayFabClientAPI::LinkAndroidDeviceID(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2431,7 +2432,7 @@ void UPlayFabClientAPI::OnLinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::LinkApple(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkApple(
     ClientModels::FLinkAppleRequest& request,
     const FLinkAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2439,13 +2440,13 @@ bool UPlayFabClientAPI::LinkApple(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkApple"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2462,7 +2463,7 @@ void UPlayFabClientAPI::OnLinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResp
     }
 }
 
-bool UPlayFabClientAPI::LinkCustomID(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkCustomID(
     ClientModels::FLinkCustomIDRequest& request,
     const FLinkCustomIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2470,13 +2471,13 @@ bool UPlayFabClientAPI::LinkCustomID(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2493,7 +2494,7 @@ void UPlayFabClientAPI::OnLinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::LinkFacebookAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkFacebookAccount(
     ClientModels::FLinkFacebookAccountRequest& request,
     const FLinkFacebookAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2501,13 +2502,13 @@ bool UPlayFabClientAPI::LinkFacebookAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2524,7 +2525,7 @@ void UPlayFabClientAPI::OnLinkFacebookAccountResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::LinkFacebookInstantGamesId(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkFacebookInstantGamesId(
     ClientModels::FLinkFacebookInstantGamesIdRequest& request,
     const FLinkFacebookInstantGamesIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2532,13 +2533,13 @@ bool UPlayFabClientAPI::LinkFacebookInstantGamesId(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2555,7 +2556,7 @@ void UPlayFabClientAPI::OnLinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::LinkGameCenterAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkGameCenterAccount(
     ClientModels::FLinkGameCenterAccountRequest& request,
     const FLinkGameCenterAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2563,13 +2564,13 @@ bool UPlayFabClientAPI::LinkGameCenterAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2586,7 +2587,7 @@ void UPlayFabClientAPI::OnLinkGameCenterAccountResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::LinkGoogleAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkGoogleAccount(
     ClientModels::FLinkGoogleAccountRequest& request,
     const FLinkGoogleAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2594,13 +2595,13 @@ bool UPlayFabClientAPI::LinkGoogleAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2617,7 +2618,7 @@ void UPlayFabClientAPI::OnLinkGoogleAccountResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientAPI::LinkGooglePlayGamesServicesAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkGooglePlayGamesServicesAccount(
     ClientModels::FLinkGooglePlayGamesServicesAccountRequest& request,
     const FLinkGooglePlayGamesServicesAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2625,13 +2626,13 @@ bool UPlayFabClientAPI::LinkGooglePlayGamesServicesAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkGooglePlayGamesServicesAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkGooglePlayGamesServicesAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkGooglePlayGamesServicesAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGooglePlayGamesServicesAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2648,7 +2649,7 @@ void UPlayFabClientAPI::OnLinkGooglePlayGamesServicesAccountResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientAPI::LinkIOSDeviceID(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkIOSDeviceID(
     ClientModels::FLinkIOSDeviceIDRequest& request,
     const FLinkIOSDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2656,13 +2657,13 @@ bool UPlayFabClientAPI::LinkIOSDeviceID(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2679,7 +2680,7 @@ void UPlayFabClientAPI::OnLinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::LinkKongregate(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkKongregate(
     ClientModels::FLinkKongregateAccountRequest& request,
     const FLinkKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2687,13 +2688,13 @@ bool UPlayFabClientAPI::LinkKongregate(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2710,7 +2711,7 @@ void UPlayFabClientAPI::OnLinkKongregateResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::LinkNintendoServiceAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkNintendoServiceAccount(
     ClientModels::FLinkNintendoServiceAccountRequest& request,
     const FLinkNintendoServiceAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2718,13 +2719,13 @@ bool UPlayFabClientAPI::LinkNintendoServiceAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2741,7 +2742,7 @@ void UPlayFabClientAPI::OnLinkNintendoServiceAccountResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::LinkNintendoSwitchDeviceId(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkNintendoSwitchDeviceId(
     ClientModels::FLinkNintendoSwitchDeviceIdRequest& request,
     const FLinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2749,13 +2750,13 @@ bool UPlayFabClientAPI::LinkNintendoSwitchDeviceId(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2772,7 +2773,7 @@ void UPlayFabClientAPI::OnLinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::LinkOpenIdConnect(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkOpenIdConnect(
     ClientModels::FLinkOpenIdConnectRequest& request,
     const FLinkOpenIdConnectDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2780,13 +2781,13 @@ bool UPlayFabClientAPI::LinkOpenIdConnect(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2803,7 +2804,7 @@ void UPlayFabClientAPI::OnLinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientAPI::LinkPSNAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkPSNAccount(
     ClientModels::FLinkPSNAccountRequest& request,
     const FLinkPSNAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2811,13 +2812,13 @@ bool UPlayFabClientAPI::LinkPSNAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2834,7 +2835,7 @@ void UPlayFabClientAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::LinkSteamAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkSteamAccount(
     ClientModels::FLinkSteamAccountRequest& request,
     const FLinkSteamAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2842,13 +2843,13 @@ bool UPlayFabClientAPI::LinkSteamAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2865,7 +2866,7 @@ void UPlayFabClientAPI::OnLinkSteamAccountResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::LinkTwitch(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkTwitch(
     ClientModels::FLinkTwitchAccountRequest& request,
     const FLinkTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2873,13 +2874,13 @@ bool UPlayFabClientAPI::LinkTwitch(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2896,7 +2897,7 @@ void UPlayFabClientAPI::OnLinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabClientAPI::LinkXboxAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LinkXboxAccount(
     ClientModels::FLinkXboxAccountRequest& request,
     const FLinkXboxAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2904,13 +2905,13 @@ bool UPlayFabClientAPI::LinkXboxAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2927,7 +2928,7 @@ void UPlayFabClientAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::ListPlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabClientAPI::ListPlayerCustomProperties(
     const FListPlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 {
@@ -2935,7 +2936,7 @@ bool UPlayFabClientAPI::ListPlayerCustomProperties(
     return UPlayFabClientAPI::ListPlayerCustomProperties(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabClientAPI::ListPlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabClientAPI::ListPlayerCustomProperties(
     ClientModels::FListPlayerCustomPropertiesRequest& request,
     const FListPlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2943,13 +2944,13 @@ bool UPlayFabClientAPI::ListPlayerCustomProperties(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ListPlayerCustomProperties"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnListPlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnListPlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListPlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2966,7 +2967,7 @@ void UPlayFabClientAPI::OnListPlayerCustomPropertiesResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::LoginWithAndroidDeviceID(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithAndroidDeviceID(
     ClientModels::FLoginWithAndroidDeviceIDRequest& request,
     const FLoginWithAndroidDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2977,7 +2978,7 @@ bool UPlayFabClientAPI::LoginWithAndroidDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithAndroidDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2995,8 +2996,8 @@ void UPlayFabClientAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr HttpReq
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3008,7 +3009,7 @@ void UPlayFabClientAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientAPI::LoginWithApple(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithApple(
     ClientModels::FLoginWithAppleRequest& request,
     const FLoginWithAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3019,7 +3020,7 @@ bool UPlayFabClientAPI::LoginWithApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithApple"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3037,8 +3038,8 @@ void UPlayFabClientAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpRequest, FHtt
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3050,7 +3051,7 @@ void UPlayFabClientAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::LoginWithCustomID(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithCustomID(
     ClientModels::FLoginWithCustomIDRequest& request,
     const FLoginWithCustomIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3061,7 +3062,7 @@ bool UPlayFabClientAPI::LoginWithCustomID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithCustomID"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3079,8 +3080,8 @@ void UPlayFabClientAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRequest, F
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3092,7 +3093,7 @@ void UPlayFabClientAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientAPI::LoginWithEmailAddress(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithEmailAddress(
     ClientModels::FLoginWithEmailAddressRequest& request,
     const FLoginWithEmailAddressDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3103,7 +3104,7 @@ bool UPlayFabClientAPI::LoginWithEmailAddress(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithEmailAddress"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithEmailAddressResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithEmailAddressDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3121,8 +3122,8 @@ void UPlayFabClientAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr HttpReques
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3134,7 +3135,7 @@ void UPlayFabClientAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::LoginWithFacebook(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithFacebook(
     ClientModels::FLoginWithFacebookRequest& request,
     const FLoginWithFacebookDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3145,7 +3146,7 @@ bool UPlayFabClientAPI::LoginWithFacebook(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithFacebook"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3163,8 +3164,8 @@ void UPlayFabClientAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRequest, F
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3176,7 +3177,7 @@ void UPlayFabClientAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientAPI::LoginWithFacebookInstantGamesId(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithFacebookInstantGamesId(
     ClientModels::FLoginWithFacebookInstantGamesIdRequest& request,
     const FLoginWithFacebookInstantGamesIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3187,7 +3188,7 @@ bool UPlayFabClientAPI::LoginWithFacebookInstantGamesId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithFacebookInstantGamesId"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3205,8 +3206,8 @@ void UPlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpRequestPtr
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3218,7 +3219,7 @@ void UPlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientAPI::LoginWithGameCenter(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithGameCenter(
     ClientModels::FLoginWithGameCenterRequest& request,
     const FLoginWithGameCenterDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3229,7 +3230,7 @@ bool UPlayFabClientAPI::LoginWithGameCenter(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithGameCenter"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithGameCenterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithGameCenterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGameCenterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3247,8 +3248,8 @@ void UPlayFabClientAPI::OnLoginWithGameCenterResult(FHttpRequestPtr HttpRequest,
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3260,7 +3261,7 @@ void UPlayFabClientAPI::OnLoginWithGameCenterResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::LoginWithGoogleAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithGoogleAccount(
     ClientModels::FLoginWithGoogleAccountRequest& request,
     const FLoginWithGoogleAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3271,7 +3272,7 @@ bool UPlayFabClientAPI::LoginWithGoogleAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithGoogleAccount"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3289,8 +3290,8 @@ void UPlayFabClientAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr HttpReque
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3302,7 +3303,7 @@ void UPlayFabClientAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientAPI::LoginWithGooglePlayGamesServices(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithGooglePlayGamesServices(
     ClientModels::FLoginWithGooglePlayGamesServicesRequest& request,
     const FLoginWithGooglePlayGamesServicesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3313,7 +3314,7 @@ bool UPlayFabClientAPI::LoginWithGooglePlayGamesServices(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithGooglePlayGamesServices"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithGooglePlayGamesServicesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithGooglePlayGamesServicesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGooglePlayGamesServicesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3331,8 +3332,8 @@ void UPlayFabClientAPI::OnLoginWithGooglePlayGamesServicesResult(FHttpRequestPtr
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3344,7 +3345,7 @@ void UPlayFabClientAPI::OnLoginWithGooglePlayGamesServicesResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientAPI::LoginWithIOSDeviceID(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithIOSDeviceID(
     ClientModels::FLoginWithIOSDeviceIDRequest& request,
     const FLoginWithIOSDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3355,7 +3356,7 @@ bool UPlayFabClientAPI::LoginWithIOSDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithIOSDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3373,8 +3374,8 @@ void UPlayFabClientAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr HttpRequest
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3386,7 +3387,7 @@ void UPlayFabClientAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientAPI::LoginWithKongregate(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithKongregate(
     ClientModels::FLoginWithKongregateRequest& request,
     const FLoginWithKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3397,7 +3398,7 @@ bool UPlayFabClientAPI::LoginWithKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithKongregate"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3415,8 +3416,8 @@ void UPlayFabClientAPI::OnLoginWithKongregateResult(FHttpRequestPtr HttpRequest,
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3428,7 +3429,7 @@ void UPlayFabClientAPI::OnLoginWithKongregateResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::LoginWithNintendoServiceAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithNintendoServiceAccount(
     ClientModels::FLoginWithNintendoServiceAccountRequest& request,
     const FLoginWithNintendoServiceAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3439,7 +3440,7 @@ bool UPlayFabClientAPI::LoginWithNintendoServiceAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithNintendoServiceAccount"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3457,8 +3458,8 @@ void UPlayFabClientAPI::OnLoginWithNintendoServiceAccountResult(FHttpRequestPtr
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3470,7 +3471,7 @@ void UPlayFabClientAPI::OnLoginWithNintendoServiceAccountResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientAPI::LoginWithNintendoSwitchDeviceId(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithNintendoSwitchDeviceId(
     ClientModels::FLoginWithNintendoSwitchDeviceIdRequest& request,
     const FLoginWithNintendoSwitchDeviceIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3481,7 +3482,7 @@ bool UPlayFabClientAPI::LoginWithNintendoSwitchDeviceId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithNintendoSwitchDeviceId"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3499,8 +3500,8 @@ void UPlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpRequestPtr
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3512,7 +3513,7 @@ void UPlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientAPI::LoginWithOpenIdConnect(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithOpenIdConnect(
     ClientModels::FLoginWithOpenIdConnectRequest& request,
     const FLoginWithOpenIdConnectDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3523,7 +3524,7 @@ bool UPlayFabClientAPI::LoginWithOpenIdConnect(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithOpenIdConnect"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3541,8 +3542,8 @@ void UPlayFabClientAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr HttpReque
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3554,7 +3555,7 @@ void UPlayFabClientAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientAPI::LoginWithPlayFab(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithPlayFab(
     ClientModels::FLoginWithPlayFabRequest& request,
     const FLoginWithPlayFabDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3565,7 +3566,7 @@ bool UPlayFabClientAPI::LoginWithPlayFab(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithPlayFab"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithPlayFabResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPlayFabDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3583,8 +3584,8 @@ void UPlayFabClientAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpRequest, FH
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3596,7 +3597,7 @@ void UPlayFabClientAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::LoginWithPSN(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithPSN(
     ClientModels::FLoginWithPSNRequest& request,
     const FLoginWithPSNDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3607,7 +3608,7 @@ bool UPlayFabClientAPI::LoginWithPSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithPSN"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithPSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3625,8 +3626,8 @@ void UPlayFabClientAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest, FHttpR
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3638,7 +3639,7 @@ void UPlayFabClientAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::LoginWithSteam(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithSteam(
     ClientModels::FLoginWithSteamRequest& request,
     const FLoginWithSteamDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3649,7 +3650,7 @@ bool UPlayFabClientAPI::LoginWithSteam(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithSteam"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3667,8 +3668,8 @@ void UPlayFabClientAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpRequest, FHtt
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3680,7 +3681,7 @@ void UPlayFabClientAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::LoginWithTwitch(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithTwitch(
     ClientModels::FLoginWithTwitchRequest& request,
     const FLoginWithTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3691,7 +3692,7 @@ bool UPlayFabClientAPI::LoginWithTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithTwitch"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3709,8 +3710,8 @@ void UPlayFabClientAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequest, FHt
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3722,7 +3723,7 @@ void UPlayFabClientAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::LoginWithXbox(
+FPlayFabRequestHandle UPlayFabClientAPI::LoginWithXbox(
     ClientModels::FLoginWithXboxRequest& request,
     const FLoginWithXboxDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3733,7 +3734,7 @@ bool UPlayFabClientAPI::LoginWithXbox(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithXbox"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3751,8 +3752,8 @@ void UPlayFabClientAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttp
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3764,7 +3765,7 @@ void UPlayFabClientAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabClientAPI::OpenTrade(
+FPlayFabRequestHandle UPlayFabClientAPI::OpenTrade(
     ClientModels::FOpenTradeRequest& request,
     const FOpenTradeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3772,13 +3773,13 @@ bool UPlayFabClientAPI::OpenTrade(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/OpenTrade"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnOpenTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnOpenTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FOpenTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3795,7 +3796,7 @@ void UPlayFabClientAPI::OnOpenTradeResult(FHttpRequestPtr HttpRequest, FHttpResp
     }
 }
 
-bool UPlayFabClientAPI::PayForPurchase(
+FPlayFabRequestHandle UPlayFabClientAPI::PayForPurchase(
     ClientModels::FPayForPurchaseRequest& request,
     const FPayForPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3803,13 +3804,13 @@ bool UPlayFabClientAPI::PayForPurchase(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/PayForPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnPayForPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnPayForPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPayForPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3826,7 +3827,7 @@ void UPlayFabClientAPI::OnPayForPurchaseResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::PurchaseItem(
+FPlayFabRequestHandle UPlayFabClientAPI::PurchaseItem(
     ClientModels::FPurchaseItemRequest& request,
     const FPurchaseItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3834,13 +3835,13 @@ bool UPlayFabClientAPI::PurchaseItem(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/PurchaseItem"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnPurchaseItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnPurchaseItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPurchaseItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3857,7 +3858,7 @@ void UPlayFabClientAPI::OnPurchaseItemResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::RedeemCoupon(
+FPlayFabRequestHandle UPlayFabClientAPI::RedeemCoupon(
     ClientModels::FRedeemCouponRequest& request,
     const FRedeemCouponDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3865,13 +3866,13 @@ bool UPlayFabClientAPI::RedeemCoupon(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RedeemCoupon"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemCouponDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3888,7 +3889,7 @@ void UPlayFabClientAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::RefreshPSNAuthToken(
+FPlayFabRequestHandle UPlayFabClientAPI::RefreshPSNAuthToken(
     ClientModels::FRefreshPSNAuthTokenRequest& request,
     const FRefreshPSNAuthTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3896,13 +3897,13 @@ bool UPlayFabClientAPI::RefreshPSNAuthToken(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RefreshPSNAuthToken"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRefreshPSNAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRefreshPSNAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefreshPSNAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3919,7 +3920,7 @@ void UPlayFabClientAPI::OnRefreshPSNAuthTokenResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::RegisterForIOSPushNotification(
+FPlayFabRequestHandle UPlayFabClientAPI::RegisterForIOSPushNotification(
     ClientModels::FRegisterForIOSPushNotificationRequest& request,
     const FRegisterForIOSPushNotificationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3927,13 +3928,13 @@ bool UPlayFabClientAPI::RegisterForIOSPushNotification(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterForIOSPushNotification"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRegisterForIOSPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRegisterForIOSPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterForIOSPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3950,7 +3951,7 @@ void UPlayFabClientAPI::OnRegisterForIOSPushNotificationResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientAPI::RegisterPlayFabUser(
+FPlayFabRequestHandle UPlayFabClientAPI::RegisterPlayFabUser(
     ClientModels::FRegisterPlayFabUserRequest& request,
     const FRegisterPlayFabUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3961,7 +3962,7 @@ bool UPlayFabClientAPI::RegisterPlayFabUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterPlayFabUser"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRegisterPlayFabUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRegisterPlayFabUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterPlayFabUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3979,8 +3980,8 @@ void UPlayFabClientAPI::OnRegisterPlayFabUserResult(FHttpRequestPtr HttpRequest,
             PlayFabSettings::SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3992,7 +3993,7 @@ void UPlayFabClientAPI::OnRegisterPlayFabUserResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::RemoveContactEmail(
+FPlayFabRequestHandle UPlayFabClientAPI::RemoveContactEmail(
     ClientModels::FRemoveContactEmailRequest& request,
     const FRemoveContactEmailDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4000,13 +4001,13 @@ bool UPlayFabClientAPI::RemoveContactEmail(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveContactEmail"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRemoveContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4023,7 +4024,7 @@ void UPlayFabClientAPI::OnRemoveContactEmailResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::RemoveFriend(
+FPlayFabRequestHandle UPlayFabClientAPI::RemoveFriend(
     ClientModels::FRemoveFriendRequest& request,
     const FRemoveFriendDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4031,13 +4032,13 @@ bool UPlayFabClientAPI::RemoveFriend(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveFriend"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4054,7 +4055,7 @@ void UPlayFabClientAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::RemoveGenericID(
+FPlayFabRequestHandle UPlayFabClientAPI::RemoveGenericID(
     ClientModels::FRemoveGenericIDRequest& request,
     const FRemoveGenericIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4062,13 +4063,13 @@ bool UPlayFabClientAPI::RemoveGenericID(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveGenericID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4085,7 +4086,7 @@ void UPlayFabClientAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::RemoveSharedGroupMembers(
+FPlayFabRequestHandle UPlayFabClientAPI::RemoveSharedGroupMembers(
     ClientModels::FRemoveSharedGroupMembersRequest& request,
     const FRemoveSharedGroupMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4093,13 +4094,13 @@ bool UPlayFabClientAPI::RemoveSharedGroupMembers(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4116,7 +4117,7 @@ void UPlayFabClientAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientAPI::ReportAdActivity(
+FPlayFabRequestHandle UPlayFabClientAPI::ReportAdActivity(
     ClientModels::FReportAdActivityRequest& request,
     const FReportAdActivityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4124,13 +4125,13 @@ bool UPlayFabClientAPI::ReportAdActivity(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportAdActivity"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnReportAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnReportAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4147,7 +4148,7 @@ void UPlayFabClientAPI::OnReportAdActivityResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::ReportDeviceInfo(
+FPlayFabRequestHandle UPlayFabClientAPI::ReportDeviceInfo(
     ClientModels::FDeviceInfoRequest& request,
     const FReportDeviceInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4155,13 +4156,13 @@ bool UPlayFabClientAPI::ReportDeviceInfo(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportDeviceInfo"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnReportDeviceInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnReportDeviceInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportDeviceInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4178,7 +4179,7 @@ void UPlayFabClientAPI::OnReportDeviceInfoResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::ReportPlayer(
+FPlayFabRequestHandle UPlayFabClientAPI::ReportPlayer(
     ClientModels::FReportPlayerClientRequest& request,
     const FReportPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4186,13 +4187,13 @@ bool UPlayFabClientAPI::ReportPlayer(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportPlayer"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4209,7 +4210,7 @@ void UPlayFabClientAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::RestoreIOSPurchases(
+FPlayFabRequestHandle UPlayFabClientAPI::RestoreIOSPurchases(
     ClientModels::FRestoreIOSPurchasesRequest& request,
     const FRestoreIOSPurchasesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4217,13 +4218,13 @@ bool UPlayFabClientAPI::RestoreIOSPurchases(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RestoreIOSPurchases"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRestoreIOSPurchasesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRestoreIOSPurchasesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRestoreIOSPurchasesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4240,7 +4241,7 @@ void UPlayFabClientAPI::OnRestoreIOSPurchasesResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::RewardAdActivity(
+FPlayFabRequestHandle UPlayFabClientAPI::RewardAdActivity(
     ClientModels::FRewardAdActivityRequest& request,
     const FRewardAdActivityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4248,13 +4249,13 @@ bool UPlayFabClientAPI::RewardAdActivity(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RewardAdActivity"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRewardAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnRewardAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRewardAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4271,7 +4272,7 @@ void UPlayFabClientAPI::OnRewardAdActivityResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::SendAccountRecoveryEmail(
+FPlayFabRequestHandle UPlayFabClientAPI::SendAccountRecoveryEmail(
     ClientModels::FSendAccountRecoveryEmailRequest& request,
     const FSendAccountRecoveryEmailDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4280,7 +4281,7 @@ bool UPlayFabClientAPI::SendAccountRecoveryEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SendAccountRecoveryEmail"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4297,7 +4298,7 @@ void UPlayFabClientAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientAPI::SetFriendTags(
+FPlayFabRequestHandle UPlayFabClientAPI::SetFriendTags(
     ClientModels::FSetFriendTagsRequest& request,
     const FSetFriendTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4305,13 +4306,13 @@ bool UPlayFabClientAPI::SetFriendTags(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SetFriendTags"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetFriendTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4328,7 +4329,7 @@ void UPlayFabClientAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabClientAPI::SetPlayerSecret(
+FPlayFabRequestHandle UPlayFabClientAPI::SetPlayerSecret(
     ClientModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4336,13 +4337,13 @@ bool UPlayFabClientAPI::SetPlayerSecret(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SetPlayerSecret"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4359,7 +4360,7 @@ void UPlayFabClientAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::StartPurchase(
+FPlayFabRequestHandle UPlayFabClientAPI::StartPurchase(
     ClientModels::FStartPurchaseRequest& request,
     const FStartPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4367,13 +4368,13 @@ bool UPlayFabClientAPI::StartPurchase(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/StartPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnStartPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnStartPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4390,7 +4391,7 @@ void UPlayFabClientAPI::OnStartPurchaseResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabClientAPI::SubtractUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabClientAPI::SubtractUserVirtualCurrency(
     ClientModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4398,13 +4399,13 @@ bool UPlayFabClientAPI::SubtractUserVirtualCurrency(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4421,7 +4422,7 @@ void UPlayFabClientAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientAPI::UnlinkAndroidDeviceID(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkAndroidDeviceID(
     ClientModels::FUnlinkAndroidDeviceIDRequest& request,
     const FUnlinkAndroidDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4429,13 +4430,13 @@ bool UPlayFabClientAPI::UnlinkAndroidDeviceID(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4452,7 +4453,7 @@ void UPlayFabClientAPI::OnUnlinkAndroidDeviceIDResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::UnlinkApple(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkApple(
     ClientModels::FUnlinkAppleRequest& request,
     const FUnlinkAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4460,13 +4461,13 @@ bool UPlayFabClientAPI::UnlinkApple(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkApple"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4483,7 +4484,7 @@ void UPlayFabClientAPI::OnUnlinkAppleResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabClientAPI::UnlinkCustomID(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkCustomID(
     ClientModels::FUnlinkCustomIDRequest& request,
     const FUnlinkCustomIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4491,13 +4492,13 @@ bool UPlayFabClientAPI::UnlinkCustomID(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4514,7 +4515,7 @@ void UPlayFabClientAPI::OnUnlinkCustomIDResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::UnlinkFacebookAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkFacebookAccount(
     ClientModels::FUnlinkFacebookAccountRequest& request,
     const FUnlinkFacebookAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4522,13 +4523,13 @@ bool UPlayFabClientAPI::UnlinkFacebookAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4545,7 +4546,7 @@ void UPlayFabClientAPI::OnUnlinkFacebookAccountResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::UnlinkFacebookInstantGamesId(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkFacebookInstantGamesId(
     ClientModels::FUnlinkFacebookInstantGamesIdRequest& request,
     const FUnlinkFacebookInstantGamesIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4553,13 +4554,13 @@ bool UPlayFabClientAPI::UnlinkFacebookInstantGamesId(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4576,7 +4577,7 @@ void UPlayFabClientAPI::OnUnlinkFacebookInstantGamesIdResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientAPI::UnlinkGameCenterAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkGameCenterAccount(
     ClientModels::FUnlinkGameCenterAccountRequest& request,
     const FUnlinkGameCenterAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4584,13 +4585,13 @@ bool UPlayFabClientAPI::UnlinkGameCenterAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4607,7 +4608,7 @@ void UPlayFabClientAPI::OnUnlinkGameCenterAccountResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientAPI::UnlinkGoogleAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkGoogleAccount(
     ClientModels::FUnlinkGoogleAccountRequest& request,
     const FUnlinkGoogleAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4615,13 +4616,13 @@ bool UPlayFabClientAPI::UnlinkGoogleAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4638,7 +4639,7 @@ void UPlayFabClientAPI::OnUnlinkGoogleAccountResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::UnlinkGooglePlayGamesServicesAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkGooglePlayGamesServicesAccount(
     ClientModels::FUnlinkGooglePlayGamesServicesAccountRequest& request,
     const FUnlinkGooglePlayGamesServicesAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4646,13 +4647,13 @@ bool UPlayFabClientAPI::UnlinkGooglePlayGamesServicesAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkGooglePlayGamesServicesAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkGooglePlayGamesServicesAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkGooglePlayGamesServicesAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGooglePlayGamesServicesAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4669,7 +4670,7 @@ void UPlayFabClientAPI::OnUnlinkGooglePlayGamesServicesAccountResult(FHttpReques
     }
 }
 
-bool UPlayFabClientAPI::UnlinkIOSDeviceID(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkIOSDeviceID(
     ClientModels::FUnlinkIOSDeviceIDRequest& request,
     const FUnlinkIOSDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4677,13 +4678,13 @@ bool UPlayFabClientAPI::UnlinkIOSDeviceID(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4700,7 +4701,7 @@ void UPlayFabClientAPI::OnUnlinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientAPI::UnlinkKongregate(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkKongregate(
     ClientModels::FUnlinkKongregateAccountRequest& request,
     const FUnlinkKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4708,13 +4709,13 @@ bool UPlayFabClientAPI::UnlinkKongregate(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4731,7 +4732,7 @@ void UPlayFabClientAPI::OnUnlinkKongregateResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::UnlinkNintendoServiceAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkNintendoServiceAccount(
     ClientModels::FUnlinkNintendoServiceAccountRequest& request,
     const FUnlinkNintendoServiceAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4739,13 +4740,13 @@ bool UPlayFabClientAPI::UnlinkNintendoServiceAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4762,7 +4763,7 @@ void UPlayFabClientAPI::OnUnlinkNintendoServiceAccountResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(
     ClientModels::FUnlinkNintendoSwitchDeviceIdRequest& request,
     const FUnlinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4770,13 +4771,13 @@ bool UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4793,7 +4794,7 @@ void UPlayFabClientAPI::OnUnlinkNintendoSwitchDeviceIdResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientAPI::UnlinkOpenIdConnect(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkOpenIdConnect(
     ClientModels::FUnlinkOpenIdConnectRequest& request,
     const FUnlinkOpenIdConnectDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4801,13 +4802,13 @@ bool UPlayFabClientAPI::UnlinkOpenIdConnect(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4824,7 +4825,7 @@ void UPlayFabClientAPI::OnUnlinkOpenIdConnectResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::UnlinkPSNAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkPSNAccount(
     ClientModels::FUnlinkPSNAccountRequest& request,
     const FUnlinkPSNAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4832,13 +4833,13 @@ bool UPlayFabClientAPI::UnlinkPSNAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4855,7 +4856,7 @@ void UPlayFabClientAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::UnlinkSteamAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkSteamAccount(
     ClientModels::FUnlinkSteamAccountRequest& request,
     const FUnlinkSteamAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4863,13 +4864,13 @@ bool UPlayFabClientAPI::UnlinkSteamAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4886,7 +4887,7 @@ void UPlayFabClientAPI::OnUnlinkSteamAccountResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::UnlinkTwitch(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkTwitch(
     ClientModels::FUnlinkTwitchAccountRequest& request,
     const FUnlinkTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4894,13 +4895,13 @@ bool UPlayFabClientAPI::UnlinkTwitch(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4917,7 +4918,7 @@ void UPlayFabClientAPI::OnUnlinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabClientAPI::UnlinkXboxAccount(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlinkXboxAccount(
     ClientModels::FUnlinkXboxAccountRequest& request,
     const FUnlinkXboxAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4925,13 +4926,13 @@ bool UPlayFabClientAPI::UnlinkXboxAccount(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4948,7 +4949,7 @@ void UPlayFabClientAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientAPI::UnlockContainerInstance(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlockContainerInstance(
     ClientModels::FUnlockContainerInstanceRequest& request,
     const FUnlockContainerInstanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4956,13 +4957,13 @@ bool UPlayFabClientAPI::UnlockContainerInstance(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlockContainerInstance"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4979,7 +4980,7 @@ void UPlayFabClientAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientAPI::UnlockContainerItem(
+FPlayFabRequestHandle UPlayFabClientAPI::UnlockContainerItem(
     ClientModels::FUnlockContainerItemRequest& request,
     const FUnlockContainerItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4987,13 +4988,13 @@ bool UPlayFabClientAPI::UnlockContainerItem(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlockContainerItem"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUnlockContainerItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5010,7 +5011,7 @@ void UPlayFabClientAPI::OnUnlockContainerItemResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::UpdateAvatarUrl(
+FPlayFabRequestHandle UPlayFabClientAPI::UpdateAvatarUrl(
     ClientModels::FUpdateAvatarUrlRequest& request,
     const FUpdateAvatarUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5018,13 +5019,13 @@ bool UPlayFabClientAPI::UpdateAvatarUrl(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateAvatarUrl"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateAvatarUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5041,7 +5042,7 @@ void UPlayFabClientAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientAPI::UpdateCharacterData(
+FPlayFabRequestHandle UPlayFabClientAPI::UpdateCharacterData(
     ClientModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5049,13 +5050,13 @@ bool UPlayFabClientAPI::UpdateCharacterData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateCharacterData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUpdateCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5072,7 +5073,7 @@ void UPlayFabClientAPI::OnUpdateCharacterDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::UpdateCharacterStatistics(
+FPlayFabRequestHandle UPlayFabClientAPI::UpdateCharacterStatistics(
     ClientModels::FUpdateCharacterStatisticsRequest& request,
     const FUpdateCharacterStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5080,13 +5081,13 @@ bool UPlayFabClientAPI::UpdateCharacterStatistics(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5103,7 +5104,7 @@ void UPlayFabClientAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientAPI::UpdatePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabClientAPI::UpdatePlayerCustomProperties(
     ClientModels::FUpdatePlayerCustomPropertiesRequest& request,
     const FUpdatePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5111,13 +5112,13 @@ bool UPlayFabClientAPI::UpdatePlayerCustomProperties(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdatePlayerCustomProperties"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdatePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUpdatePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5134,7 +5135,7 @@ void UPlayFabClientAPI::OnUpdatePlayerCustomPropertiesResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientAPI::UpdatePlayerStatistics(
+FPlayFabRequestHandle UPlayFabClientAPI::UpdatePlayerStatistics(
     ClientModels::FUpdatePlayerStatisticsRequest& request,
     const FUpdatePlayerStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5142,13 +5143,13 @@ bool UPlayFabClientAPI::UpdatePlayerStatistics(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdatePlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5165,7 +5166,7 @@ void UPlayFabClientAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientAPI::UpdateSharedGroupData(
+FPlayFabRequestHandle UPlayFabClientAPI::UpdateSharedGroupData(
     ClientModels::FUpdateSharedGroupDataRequest& request,
     const FUpdateSharedGroupDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5173,13 +5174,13 @@ bool UPlayFabClientAPI::UpdateSharedGroupData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5196,7 +5197,7 @@ void UPlayFabClientAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientAPI::UpdateUserData(
+FPlayFabRequestHandle UPlayFabClientAPI::UpdateUserData(
     ClientModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5204,13 +5205,13 @@ bool UPlayFabClientAPI::UpdateUserData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5227,7 +5228,7 @@ void UPlayFabClientAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabClientAPI::UpdateUserPublisherData(
+FPlayFabRequestHandle UPlayFabClientAPI::UpdateUserPublisherData(
     ClientModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5235,13 +5236,13 @@ bool UPlayFabClientAPI::UpdateUserPublisherData(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5258,7 +5259,7 @@ void UPlayFabClientAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientAPI::UpdateUserTitleDisplayName(
+FPlayFabRequestHandle UPlayFabClientAPI::UpdateUserTitleDisplayName(
     ClientModels::FUpdateUserTitleDisplayNameRequest& request,
     const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5266,13 +5267,13 @@ bool UPlayFabClientAPI::UpdateUserTitleDisplayName(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5289,7 +5290,7 @@ void UPlayFabClientAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::ValidateAmazonIAPReceipt(
+FPlayFabRequestHandle UPlayFabClientAPI::ValidateAmazonIAPReceipt(
     ClientModels::FValidateAmazonReceiptRequest& request,
     const FValidateAmazonIAPReceiptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5297,13 +5298,13 @@ bool UPlayFabClientAPI::ValidateAmazonIAPReceipt(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateAmazonIAPReceipt"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateAmazonIAPReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnValidateAmazonIAPReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateAmazonIAPReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5320,7 +5321,7 @@ void UPlayFabClientAPI::OnValidateAmazonIAPReceiptResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientAPI::ValidateGooglePlayPurchase(
+FPlayFabRequestHandle UPlayFabClientAPI::ValidateGooglePlayPurchase(
     ClientModels::FValidateGooglePlayPurchaseRequest& request,
     const FValidateGooglePlayPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5328,13 +5329,13 @@ bool UPlayFabClientAPI::ValidateGooglePlayPurchase(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateGooglePlayPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateGooglePlayPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnValidateGooglePlayPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateGooglePlayPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5351,7 +5352,7 @@ void UPlayFabClientAPI::OnValidateGooglePlayPurchaseResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientAPI::ValidateIOSReceipt(
+FPlayFabRequestHandle UPlayFabClientAPI::ValidateIOSReceipt(
     ClientModels::FValidateIOSReceiptRequest& request,
     const FValidateIOSReceiptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5359,13 +5360,13 @@ bool UPlayFabClientAPI::ValidateIOSReceipt(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateIOSReceipt"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateIOSReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnValidateIOSReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateIOSReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5382,7 +5383,7 @@ void UPlayFabClientAPI::OnValidateIOSReceiptResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::ValidateWindowsStoreReceipt(
+FPlayFabRequestHandle UPlayFabClientAPI::ValidateWindowsStoreReceipt(
     ClientModels::FValidateWindowsReceiptRequest& request,
     const FValidateWindowsStoreReceiptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5390,13 +5391,13 @@ bool UPlayFabClientAPI::ValidateWindowsStoreReceipt(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateWindowsStoreReceipt"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateWindowsStoreReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnValidateWindowsStoreReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateWindowsStoreReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5413,7 +5414,7 @@ void UPlayFabClientAPI::OnValidateWindowsStoreReceiptResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientAPI::WriteCharacterEvent(
+FPlayFabRequestHandle UPlayFabClientAPI::WriteCharacterEvent(
     ClientModels::FWriteClientCharacterEventRequest& request,
     const FWriteCharacterEventDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5421,13 +5422,13 @@ bool UPlayFabClientAPI::WriteCharacterEvent(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WriteCharacterEvent"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnWriteCharacterEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteCharacterEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5444,7 +5445,7 @@ void UPlayFabClientAPI::OnWriteCharacterEventResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientAPI::WritePlayerEvent(
+FPlayFabRequestHandle UPlayFabClientAPI::WritePlayerEvent(
     ClientModels::FWriteClientPlayerEventRequest& request,
     const FWritePlayerEventDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5452,13 +5453,13 @@ bool UPlayFabClientAPI::WritePlayerEvent(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WritePlayerEvent"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWritePlayerEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5475,7 +5476,7 @@ void UPlayFabClientAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabClientAPI::WriteTitleEvent(
+FPlayFabRequestHandle UPlayFabClientAPI::WriteTitleEvent(
     ClientModels::FWriteTitleEventRequest& request,
     const FWriteTitleEventDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5483,13 +5484,13 @@ bool UPlayFabClientAPI::WriteTitleEvent(
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WriteTitleEvent"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTitleEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5505,3 +5506,5 @@ void UPlayFabClientAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequest, FHt
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_CLIENT_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_CLIENT_API
 
 #include "Core/PlayFabClientDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -97,19 +98,19 @@ ClientModels::TradeStatus PlayFab::ClientModels::readTradeStatusFromValue(const
 
 ClientModels::TradeStatus PlayFab::ClientModels::readTradeStatusFromValue(const FString& value)
 {
-    static TMap<FString, TradeStatus> _TradeStatusMap;
-    if (_TradeStatusMap.Num() == 0)
+    static const TMap<FString, TradeStatus> _TradeStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _TradeStatusMap.Add(TEXT("Invalid"), TradeStatusInvalid);
-        _TradeStatusMap.Add(TEXT("Opening"), TradeStatusOpening);
-        _TradeStatusMap.Add(TEXT("Open"), TradeStatusOpen);
-        _TradeStatusMap.Add(TEXT("Accepting"), TradeStatusAccepting);
-        _TradeStatusMap.Add(TEXT("Accepted"), TradeStatusAccepted);
-        _TradeStatusMap.Add(TEXT("Filled"), TradeStatusFilled);
-        _TradeStatusMap.Add(TEXT("Cancelled"), TradeStatusCancelled);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, TradeStatus> Map;
+        Map.Add(TEXT("Invalid"), TradeStatusInvalid);
+        Map.Add(TEXT("Opening"), TradeStatusOpening);
+        Map.Add(TEXT("Open"), TradeStatusOpen);
+        Map.Add(TEXT("Accepting"), TradeStatusAccepting);
+        Map.Add(TEXT("Accepted"), TradeStatusAccepted);
+        Map.Add(TEXT("Filled"), TradeStatusFilled);
+        Map.Add(TEXT("Cancelled"), TradeStatusCancelled);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -337,16 +338,16 @@ ClientModels::AdActivity PlayFab::ClientModels::readAdActivityFromValue(const TS
 
 ClientModels::AdActivity PlayFab::ClientModels::readAdActivityFromValue(const FString& value)
 {
-    static TMap<FString, AdActivity> _AdActivityMap;
-    if (_AdActivityMap.Num() == 0)
+    static const TMap<FString, AdActivity> _AdActivityMap = []()
     {
-        // Auto-generate the map on the first use
-        _AdActivityMap.Add(TEXT("Opened"), AdActivityOpened);
-        _AdActivityMap.Add(TEXT("Closed"), AdActivityClosed);
-        _AdActivityMap.Add(TEXT("Start"), AdActivityStart);
-        _AdActivityMap.Add(TEXT("End"), AdActivityEnd);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, AdActivity> Map;
+        Map.Add(TEXT("Opened"), AdActivityOpened);
+        Map.Add(TEXT("Closed"), AdActivityClosed);
+        Map.Add(TEXT("Start"), AdActivityStart);
+        Map.Add(TEXT("End"), AdActivityEnd);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -429,7 +430,7 @@ void PlayFab::ClientModels::FAddFriendRequest::writeJSON(JsonWriter& writer) con
     if (FriendPlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("FriendPlayFabId"));
-        writer->WriteValue(FriendPlayFabId);
+        writer->WriteValue(FriendPlayFabId.ToString());
     }
 
     if (FriendTitleDisplayName.IsEmpty() == false)
@@ -651,6 +652,7 @@ bool PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -809,6 +811,7 @@ bool PlayFab::ClientModels::FAddUsernamePasswordRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -921,6 +924,7 @@ bool PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1179,11 +1183,7 @@ bool PlayFab::ClientModels::FAdRewardResults::readFromValue(const TSharedPtr<FJs
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&GrantedItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GrantedItems"));
-    for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FAdRewardItemGranted(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GrantedItemsArray, GrantedItems);
 
 
     const TSharedPtr<FJsonObject>* GrantedVirtualCurrenciesObject;
@@ -1458,7 +1458,7 @@ void PlayFab::ClientModels::FCartItem::writeJSON(JsonWriter& writer) const
     if (ItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (RealCurrencyPrices.Num() != 0)
@@ -2094,7 +2094,7 @@ void PlayFab::ClientModels::FItemInstance::writeJSON(JsonWriter& writer) const
     if (ItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (PurchaseDate.notNull())
@@ -2157,6 +2157,7 @@ bool PlayFab::ClientModels::FItemInstance::readFromValue(const TSharedPtr<FJsonO
     const TSharedPtr<FJsonObject>* CustomDataObject;
     if (obj->TryGetObjectField(TEXT("CustomData"), CustomDataObject))
     {
+        CustomData.Reserve((*CustomDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
             CustomData.Add(It.Key(), It.Value()->AsString());
@@ -2244,7 +2245,7 @@ void PlayFab::ClientModels::FCharacterInventory::writeJSON(JsonWriter& writer) c
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (Inventory.Num() != 0)
@@ -2271,11 +2272,7 @@ bool PlayFab::ClientModels::FCharacterInventory::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&InventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Inventory"));
-    for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(InventoryArray, Inventory);
 
 
     return HasSucceeded;
@@ -2293,7 +2290,7 @@ void PlayFab::ClientModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& wr
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CharacterName.IsEmpty() == false)
@@ -2317,7 +2314,7 @@ void PlayFab::ClientModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& wr
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("Position"));
@@ -2397,7 +2394,7 @@ void PlayFab::ClientModels::FCharacterResult::writeJSON(JsonWriter& writer) cons
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CharacterName.IsEmpty() == false)
@@ -2461,15 +2458,15 @@ ClientModels::CloudScriptRevisionOption PlayFab::ClientModels::readCloudScriptRe
 
 ClientModels::CloudScriptRevisionOption PlayFab::ClientModels::readCloudScriptRevisionOptionFromValue(const FString& value)
 {
-    static TMap<FString, CloudScriptRevisionOption> _CloudScriptRevisionOptionMap;
-    if (_CloudScriptRevisionOptionMap.Num() == 0)
+    static const TMap<FString, CloudScriptRevisionOption> _CloudScriptRevisionOptionMap = []()
     {
-        // Auto-generate the map on the first use
-        _CloudScriptRevisionOptionMap.Add(TEXT("Live"), CloudScriptRevisionOptionLive);
-        _CloudScriptRevisionOptionMap.Add(TEXT("Latest"), CloudScriptRevisionOptionLatest);
-        _CloudScriptRevisionOptionMap.Add(TEXT("Specific"), CloudScriptRevisionOptionSpecific);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, CloudScriptRevisionOption> Map;
+        Map.Add(TEXT("Live"), CloudScriptRevisionOptionLive);
+        Map.Add(TEXT("Latest"), CloudScriptRevisionOptionLatest);
+        Map.Add(TEXT("Specific"), CloudScriptRevisionOptionSpecific);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2521,6 +2518,7 @@ bool PlayFab::ClientModels::FConfirmPurchaseRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2572,11 +2570,7 @@ bool PlayFab::ClientModels::FConfirmPurchaseResult::readFromValue(const TSharedP
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     const TSharedPtr<FJsonValue> OrderIdValue = obj->TryGetField(TEXT("OrderId"));
@@ -2606,7 +2600,7 @@ void PlayFab::ClientModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) c
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("ConsumeCount"));
@@ -2630,7 +2624,7 @@ void PlayFab::ClientModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -2657,6 +2651,7 @@ bool PlayFab::ClientModels::FConsumeItemRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2685,7 +2680,7 @@ void PlayFab::ClientModels::FConsumeItemResult::writeJSON(JsonWriter& writer) co
     if (ItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("RemainingUses"));
@@ -2819,6 +2814,7 @@ bool PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::readFromV
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2860,11 +2856,7 @@ bool PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::readFrom
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -2959,6 +2951,7 @@ bool PlayFab::ClientModels::FConsumePS5EntitlementsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3000,11 +2993,7 @@ bool PlayFab::ClientModels::FConsumePS5EntitlementsResult::readFromValue(const T
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -3056,6 +3045,7 @@ bool PlayFab::ClientModels::FConsumePSNEntitlementsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3098,11 +3088,7 @@ bool PlayFab::ClientModels::FConsumePSNEntitlementsResult::readFromValue(const T
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsGrantedArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ItemsGranted"));
-    for (int32 Idx = 0; Idx < ItemsGrantedArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsGrantedArray[Idx];
-        ItemsGranted.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsGrantedArray, ItemsGranted);
 
 
     return HasSucceeded;
@@ -3161,6 +3147,7 @@ bool PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3203,11 +3190,7 @@ bool PlayFab::ClientModels::FConsumeXboxEntitlementsResult::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -3231,15 +3214,15 @@ ClientModels::EmailVerificationStatus PlayFab::ClientModels::readEmailVerificati
 
 ClientModels::EmailVerificationStatus PlayFab::ClientModels::readEmailVerificationStatusFromValue(const FString& value)
 {
-    static TMap<FString, EmailVerificationStatus> _EmailVerificationStatusMap;
-    if (_EmailVerificationStatusMap.Num() == 0)
+    static const TMap<FString, EmailVerificationStatus> _EmailVerificationStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _EmailVerificationStatusMap.Add(TEXT("Unverified"), EmailVerificationStatusUnverified);
-        _EmailVerificationStatusMap.Add(TEXT("Pending"), EmailVerificationStatusPending);
-        _EmailVerificationStatusMap.Add(TEXT("Confirmed"), EmailVerificationStatusConfirmed);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, EmailVerificationStatus> Map;
+        Map.Add(TEXT("Unverified"), EmailVerificationStatusUnverified);
+        Map.Add(TEXT("Pending"), EmailVerificationStatusPending);
+        Map.Add(TEXT("Confirmed"), EmailVerificationStatusConfirmed);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -3327,20 +3310,20 @@ ClientModels::ContinentCode PlayFab::ClientModels::readContinentCodeFromValue(co
 
 ClientModels::ContinentCode PlayFab::ClientModels::readContinentCodeFromValue(const FString& value)
 {
-    static TMap<FString, ContinentCode> _ContinentCodeMap;
-    if (_ContinentCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _ContinentCodeMap.Add(TEXT("AF"), ContinentCodeAF);
-        _ContinentCodeMap.Add(TEXT("AN"), ContinentCodeAN);
-        _ContinentCodeMap.Add(TEXT("AS"), ContinentCodeAS);
-        _ContinentCodeMap.Add(TEXT("EU"), ContinentCodeEU);
-        _ContinentCodeMap.Add(TEXT("NA"), ContinentCodeNA);
-        _ContinentCodeMap.Add(TEXT("OC"), ContinentCodeOC);
-        _ContinentCodeMap.Add(TEXT("SA"), ContinentCodeSA);
-        _ContinentCodeMap.Add(TEXT("Unknown"), ContinentCodeUnknown);
-
-    }
+    static const TMap<FString, ContinentCode> _ContinentCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ContinentCode> Map;
+        Map.Add(TEXT("AF"), ContinentCodeAF);
+        Map.Add(TEXT("AN"), ContinentCodeAN);
+        Map.Add(TEXT("AS"), ContinentCodeAS);
+        Map.Add(TEXT("EU"), ContinentCodeEU);
+        Map.Add(TEXT("NA"), ContinentCodeNA);
+        Map.Add(TEXT("OC"), ContinentCodeOC);
+        Map.Add(TEXT("SA"), ContinentCodeSA);
+        Map.Add(TEXT("Unknown"), ContinentCodeUnknown);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -3617,262 +3600,262 @@ ClientModels::CountryCode PlayFab::ClientModels::readCountryCodeFromValue(const
 
 ClientModels::CountryCode PlayFab::ClientModels::readCountryCodeFromValue(const FString& value)
 {
-    static TMap<FString, CountryCode> _CountryCodeMap;
-    if (_CountryCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _CountryCodeMap.Add(TEXT("AF"), CountryCodeAF);
-        _CountryCodeMap.Add(TEXT("AX"), CountryCodeAX);
-        _CountryCodeMap.Add(TEXT("AL"), CountryCodeAL);
-        _CountryCodeMap.Add(TEXT("DZ"), CountryCodeDZ);
-        _CountryCodeMap.Add(TEXT("AS"), CountryCodeAS);
-        _CountryCodeMap.Add(TEXT("AD"), CountryCodeAD);
-        _CountryCodeMap.Add(TEXT("AO"), CountryCodeAO);
-        _CountryCodeMap.Add(TEXT("AI"), CountryCodeAI);
-        _CountryCodeMap.Add(TEXT("AQ"), CountryCodeAQ);
-        _CountryCodeMap.Add(TEXT("AG"), CountryCodeAG);
-        _CountryCodeMap.Add(TEXT("AR"), CountryCodeAR);
-        _CountryCodeMap.Add(TEXT("AM"), CountryCodeAM);
-        _CountryCodeMap.Add(TEXT("AW"), CountryCodeAW);
-        _CountryCodeMap.Add(TEXT("AU"), CountryCodeAU);
-        _CountryCodeMap.Add(TEXT("AT"), CountryCodeAT);
-        _CountryCodeMap.Add(TEXT("AZ"), CountryCodeAZ);
-        _CountryCodeMap.Add(TEXT("BS"), CountryCodeBS);
-        _CountryCodeMap.Add(TEXT("BH"), CountryCodeBH);
-        _CountryCodeMap.Add(TEXT("BD"), CountryCodeBD);
-        _CountryCodeMap.Add(TEXT("BB"), CountryCodeBB);
-        _CountryCodeMap.Add(TEXT("BY"), CountryCodeBY);
-        _CountryCodeMap.Add(TEXT("BE"), CountryCodeBE);
-        _CountryCodeMap.Add(TEXT("BZ"), CountryCodeBZ);
-        _CountryCodeMap.Add(TEXT("BJ"), CountryCodeBJ);
-        _CountryCodeMap.Add(TEXT("BM"), CountryCodeBM);
-        _CountryCodeMap.Add(TEXT("BT"), CountryCodeBT);
-        _CountryCodeMap.Add(TEXT("BO"), CountryCodeBO);
-        _CountryCodeMap.Add(TEXT("BQ"), CountryCodeBQ);
-        _CountryCodeMap.Add(TEXT("BA"), CountryCodeBA);
-        _CountryCodeMap.Add(TEXT("BW"), CountryCodeBW);
-        _CountryCodeMap.Add(TEXT("BV"), CountryCodeBV);
-        _CountryCodeMap.Add(TEXT("BR"), CountryCodeBR);
-        _CountryCodeMap.Add(TEXT("IO"), CountryCodeIO);
-        _CountryCodeMap.Add(TEXT("BN"), CountryCodeBN);
-        _CountryCodeMap.Add(TEXT("BG"), CountryCodeBG);
-        _CountryCodeMap.Add(TEXT("BF"), CountryCodeBF);
-        _CountryCodeMap.Add(TEXT("BI"), CountryCodeBI);
-        _CountryCodeMap.Add(TEXT("KH"), CountryCodeKH);
-        _CountryCodeMap.Add(TEXT("CM"), CountryCodeCM);
-        _CountryCodeMap.Add(TEXT("CA"), CountryCodeCA);
-        _CountryCodeMap.Add(TEXT("CV"), CountryCodeCV);
-        _CountryCodeMap.Add(TEXT("KY"), CountryCodeKY);
-        _CountryCodeMap.Add(TEXT("CF"), CountryCodeCF);
-        _CountryCodeMap.Add(TEXT("TD"), CountryCodeTD);
-        _CountryCodeMap.Add(TEXT("CL"), CountryCodeCL);
-        _CountryCodeMap.Add(TEXT("CN"), CountryCodeCN);
-        _CountryCodeMap.Add(TEXT("CX"), CountryCodeCX);
-        _CountryCodeMap.Add(TEXT("CC"), CountryCodeCC);
-        _CountryCodeMap.Add(TEXT("CO"), CountryCodeCO);
-        _CountryCodeMap.Add(TEXT("KM"), CountryCodeKM);
-        _CountryCodeMap.Add(TEXT("CG"), CountryCodeCG);
-        _CountryCodeMap.Add(TEXT("CD"), CountryCodeCD);
-        _CountryCodeMap.Add(TEXT("CK"), CountryCodeCK);
-        _CountryCodeMap.Add(TEXT("CR"), CountryCodeCR);
-        _CountryCodeMap.Add(TEXT("CI"), CountryCodeCI);
-        _CountryCodeMap.Add(TEXT("HR"), CountryCodeHR);
-        _CountryCodeMap.Add(TEXT("CU"), CountryCodeCU);
-        _CountryCodeMap.Add(TEXT("CW"), CountryCodeCW);
-        _CountryCodeMap.Add(TEXT("CY"), CountryCodeCY);
-        _CountryCodeMap.Add(TEXT("CZ"), CountryCodeCZ);
-        _CountryCodeMap.Add(TEXT("DK"), CountryCodeDK);
-        _CountryCodeMap.Add(TEXT("DJ"), CountryCodeDJ);
-        _CountryCodeMap.Add(TEXT("DM"), CountryCodeDM);
-        _CountryCodeMap.Add(TEXT("DO"), CountryCodeDO);
-        _CountryCodeMap.Add(TEXT("EC"), CountryCodeEC);
-        _CountryCodeMap.Add(TEXT("EG"), CountryCodeEG);
-        _CountryCodeMap.Add(TEXT("SV"), CountryCodeSV);
-        _CountryCodeMap.Add(TEXT("GQ"), CountryCodeGQ);
-        _CountryCodeMap.Add(TEXT("ER"), CountryCodeER);
-        _CountryCodeMap.Add(TEXT("EE"), CountryCodeEE);
-        _CountryCodeMap.Add(TEXT("ET"), CountryCodeET);
-        _CountryCodeMap.Add(TEXT("FK"), CountryCodeFK);
-        _CountryCodeMap.Add(TEXT("FO"), CountryCodeFO);
-        _CountryCodeMap.Add(TEXT("FJ"), CountryCodeFJ);
-        _CountryCodeMap.Add(TEXT("FI"), CountryCodeFI);
-        _CountryCodeMap.Add(TEXT("FR"), CountryCodeFR);
-        _CountryCodeMap.Add(TEXT("GF"), CountryCodeGF);
-        _CountryCodeMap.Add(TEXT("PF"), CountryCodePF);
-        _CountryCodeMap.Add(TEXT("TF"), CountryCodeTF);
-        _CountryCodeMap.Add(TEXT("GA"), CountryCodeGA);
-        _CountryCodeMap.Add(TEXT("GM"), CountryCodeGM);
-        _CountryCodeMap.Add(TEXT("GE"), CountryCodeGE);
-        _CountryCodeMap.Add(TEXT("DE"), CountryCodeDE);
-        _CountryCodeMap.Add(TEXT("GH"), CountryCodeGH);
-        _CountryCodeMap.Add(TEXT("GI"), CountryCodeGI);
-        _CountryCodeMap.Add(TEXT("GR"), CountryCodeGR);
-        _CountryCodeMap.Add(TEXT("GL"), CountryCodeGL);
-        _CountryCodeMap.Add(TEXT("GD"), CountryCodeGD);
-        _CountryCodeMap.Add(TEXT("GP"), CountryCodeGP);
-        _CountryCodeMap.Add(TEXT("GU"), CountryCodeGU);
-        _CountryCodeMap.Add(TEXT("GT"), CountryCodeGT);
-        _CountryCodeMap.Add(TEXT("GG"), CountryCodeGG);
-        _CountryCodeMap.Add(TEXT("GN"), CountryCodeGN);
-        _CountryCodeMap.Add(TEXT("GW"), CountryCodeGW);
-        _CountryCodeMap.Add(TEXT("GY"), CountryCodeGY);
-        _CountryCodeMap.Add(TEXT("HT"), CountryCodeHT);
-        _CountryCodeMap.Add(TEXT("HM"), CountryCodeHM);
-        _CountryCodeMap.Add(TEXT("VA"), CountryCodeVA);
-        _CountryCodeMap.Add(TEXT("HN"), CountryCodeHN);
-        _CountryCodeMap.Add(TEXT("HK"), CountryCodeHK);
-        _CountryCodeMap.Add(TEXT("HU"), CountryCodeHU);
-        _CountryCodeMap.Add(TEXT("IS"), CountryCodeIS);
-        _CountryCodeMap.Add(TEXT("IN"), CountryCodeIN);
-        _CountryCodeMap.Add(TEXT("ID"), CountryCodeID);
-        _CountryCodeMap.Add(TEXT("IR"), CountryCodeIR);
-        _CountryCodeMap.Add(TEXT("IQ"), CountryCodeIQ);
-        _CountryCodeMap.Add(TEXT("IE"), CountryCodeIE);
-        _CountryCodeMap.Add(TEXT("IM"), CountryCodeIM);
-        _CountryCodeMap.Add(TEXT("IL"), CountryCodeIL);
-        _CountryCodeMap.Add(TEXT("IT"), CountryCodeIT);
-        _CountryCodeMap.Add(TEXT("JM"), CountryCodeJM);
-        _CountryCodeMap.Add(TEXT("JP"), CountryCodeJP);
-        _CountryCodeMap.Add(TEXT("JE"), CountryCodeJE);
-        _CountryCodeMap.Add(TEXT("JO"), CountryCodeJO);
-        _CountryCodeMap.Add(TEXT("KZ"), CountryCodeKZ);
-        _CountryCodeMap.Add(TEXT("KE"), CountryCodeKE);
-        _CountryCodeMap.Add(TEXT("KI"), CountryCodeKI);
-        _CountryCodeMap.Add(TEXT("KP"), CountryCodeKP);
-        _CountryCodeMap.Add(TEXT("KR"), CountryCodeKR);
-        _CountryCodeMap.Add(TEXT("KW"), CountryCodeKW);
-        _CountryCodeMap.Add(TEXT("KG"), CountryCodeKG);
-        _CountryCodeMap.Add(TEXT("LA"), CountryCodeLA);
-        _CountryCodeMap.Add(TEXT("LV"), CountryCodeLV);
-        _CountryCodeMap.Add(TEXT("LB"), CountryCodeLB);
-        _CountryCodeMap.Add(TEXT("LS"), CountryCodeLS);
-        _CountryCodeMap.Add(TEXT("LR"), CountryCodeLR);
-        _CountryCodeMap.Add(TEXT("LY"), CountryCodeLY);
-        _CountryCodeMap.Add(TEXT("LI"), CountryCodeLI);
-        _CountryCodeMap.Add(TEXT("LT"), CountryCodeLT);
-        _CountryCodeMap.Add(TEXT("LU"), CountryCodeLU);
-        _CountryCodeMap.Add(TEXT("MO"), CountryCodeMO);
-        _CountryCodeMap.Add(TEXT("MK"), CountryCodeMK);
-        _CountryCodeMap.Add(TEXT("MG"), CountryCodeMG);
-        _CountryCodeMap.Add(TEXT("MW"), CountryCodeMW);
-        _CountryCodeMap.Add(TEXT("MY"), CountryCodeMY);
-        _CountryCodeMap.Add(TEXT("MV"), CountryCodeMV);
-        _CountryCodeMap.Add(TEXT("ML"), CountryCodeML);
-        _CountryCodeMap.Add(TEXT("MT"), CountryCodeMT);
-        _CountryCodeMap.Add(TEXT("MH"), CountryCodeMH);
-        _CountryCodeMap.Add(TEXT("MQ"), CountryCodeMQ);
-        _CountryCodeMap.Add(TEXT("MR"), CountryCodeMR);
-        _CountryCodeMap.Add(TEXT("MU"), CountryCodeMU);
-        _CountryCodeMap.Add(TEXT("YT"), CountryCodeYT);
-        _CountryCodeMap.Add(TEXT("MX"), CountryCodeMX);
-        _CountryCodeMap.Add(TEXT("FM"), CountryCodeFM);
-        _CountryCodeMap.Add(TEXT("MD"), CountryCodeMD);
-        _CountryCodeMap.Add(TEXT("MC"), CountryCodeMC);
-        _CountryCodeMap.Add(TEXT("MN"), CountryCodeMN);
-        _CountryCodeMap.Add(TEXT("ME"), CountryCodeME);
-        _CountryCodeMap.Add(TEXT("MS"), CountryCodeMS);
-        _CountryCodeMap.Add(TEXT("MA"), CountryCodeMA);
-        _CountryCodeMap.Add(TEXT("MZ"), CountryCodeMZ);
-        _CountryCodeMap.Add(TEXT("MM"), CountryCodeMM);
-        _CountryCodeMap.Add(TEXT("NA"), CountryCodeNA);
-        _CountryCodeMap.Add(TEXT("NR"), CountryCodeNR);
-        _CountryCodeMap.Add(TEXT("NP"), CountryCodeNP);
-        _CountryCodeMap.Add(TEXT("NL"), CountryCodeNL);
-        _CountryCodeMap.Add(TEXT("NC"), CountryCodeNC);
-        _CountryCodeMap.Add(TEXT("NZ"), CountryCodeNZ);
-        _CountryCodeMap.Add(TEXT("NI"), CountryCodeNI);
-        _CountryCodeMap.Add(TEXT("NE"), CountryCodeNE);
-        _CountryCodeMap.Add(TEXT("NG"), CountryCodeNG);
-        _CountryCodeMap.Add(TEXT("NU"), CountryCodeNU);
-        _CountryCodeMap.Add(TEXT("NF"), CountryCodeNF);
-        _CountryCodeMap.Add(TEXT("MP"), CountryCodeMP);
-        _CountryCodeMap.Add(TEXT("NO"), CountryCodeNO);
-        _CountryCodeMap.Add(TEXT("OM"), CountryCodeOM);
-        _CountryCodeMap.Add(TEXT("PK"), CountryCodePK);
-        _CountryCodeMap.Add(TEXT("PW"), CountryCodePW);
-        _CountryCodeMap.Add(TEXT("PS"), CountryCodePS);
-        _CountryCodeMap.Add(TEXT("PA"), CountryCodePA);
-        _CountryCodeMap.Add(TEXT("PG"), CountryCodePG);
-        _CountryCodeMap.Add(TEXT("PY"), CountryCodePY);
-        _CountryCodeMap.Add(TEXT("PE"), CountryCodePE);
-        _CountryCodeMap.Add(TEXT("PH"), CountryCodePH);
-        _CountryCodeMap.Add(TEXT("PN"), CountryCodePN);
-        _CountryCodeMap.Add(TEXT("PL"), CountryCodePL);
-        _CountryCodeMap.Add(TEXT("PT"), CountryCodePT);
-        _CountryCodeMap.Add(TEXT("PR"), CountryCodePR);
-        _CountryCodeMap.Add(TEXT("QA"), CountryCodeQA);
-        _CountryCodeMap.Add(TEXT("RE"), CountryCodeRE);
-        _CountryCodeMap.Add(TEXT("RO"), CountryCodeRO);
-        _CountryCodeMap.Add(TEXT("RU"), CountryCodeRU);
-        _CountryCodeMap.Add(TEXT("RW"), CountryCodeRW);
-        _CountryCodeMap.Add(TEXT("BL"), CountryCodeBL);
-        _CountryCodeMap.Add(TEXT("SH"), CountryCodeSH);
-        _CountryCodeMap.Add(TEXT("KN"), CountryCodeKN);
-        _CountryCodeMap.Add(TEXT("LC"), CountryCodeLC);
-        _CountryCodeMap.Add(TEXT("MF"), CountryCodeMF);
-        _CountryCodeMap.Add(TEXT("PM"), CountryCodePM);
-        _CountryCodeMap.Add(TEXT("VC"), CountryCodeVC);
-        _CountryCodeMap.Add(TEXT("WS"), CountryCodeWS);
-        _CountryCodeMap.Add(TEXT("SM"), CountryCodeSM);
-        _CountryCodeMap.Add(TEXT("ST"), CountryCodeST);
-        _CountryCodeMap.Add(TEXT("SA"), CountryCodeSA);
-        _CountryCodeMap.Add(TEXT("SN"), CountryCodeSN);
-        _CountryCodeMap.Add(TEXT("RS"), CountryCodeRS);
-        _CountryCodeMap.Add(TEXT("SC"), CountryCodeSC);
-        _CountryCodeMap.Add(TEXT("SL"), CountryCodeSL);
-        _CountryCodeMap.Add(TEXT("SG"), CountryCodeSG);
-        _CountryCodeMap.Add(TEXT("SX"), CountryCodeSX);
-        _CountryCodeMap.Add(TEXT("SK"), CountryCodeSK);
-        _CountryCodeMap.Add(TEXT("SI"), CountryCodeSI);
-        _CountryCodeMap.Add(TEXT("SB"), CountryCodeSB);
-        _CountryCodeMap.Add(TEXT("SO"), CountryCodeSO);
-        _CountryCodeMap.Add(TEXT("ZA"), CountryCodeZA);
-        _CountryCodeMap.Add(TEXT("GS"), CountryCodeGS);
-        _CountryCodeMap.Add(TEXT("SS"), CountryCodeSS);
-        _CountryCodeMap.Add(TEXT("ES"), CountryCodeES);
-        _CountryCodeMap.Add(TEXT("LK"), CountryCodeLK);
-        _CountryCodeMap.Add(TEXT("SD"), CountryCodeSD);
-        _CountryCodeMap.Add(TEXT("SR"), CountryCodeSR);
-        _CountryCodeMap.Add(TEXT("SJ"), CountryCodeSJ);
-        _CountryCodeMap.Add(TEXT("SZ"), CountryCodeSZ);
-        _CountryCodeMap.Add(TEXT("SE"), CountryCodeSE);
-        _CountryCodeMap.Add(TEXT("CH"), CountryCodeCH);
-        _CountryCodeMap.Add(TEXT("SY"), CountryCodeSY);
-        _CountryCodeMap.Add(TEXT("TW"), CountryCodeTW);
-        _CountryCodeMap.Add(TEXT("TJ"), CountryCodeTJ);
-        _CountryCodeMap.Add(TEXT("TZ"), CountryCodeTZ);
-        _CountryCodeMap.Add(TEXT("TH"), CountryCodeTH);
-        _CountryCodeMap.Add(TEXT("TL"), CountryCodeTL);
-        _CountryCodeMap.Add(TEXT("TG"), CountryCodeTG);
-        _CountryCodeMap.Add(TEXT("TK"), CountryCodeTK);
-        _CountryCodeMap.Add(TEXT("TO"), CountryCodeTO);
-        _CountryCodeMap.Add(TEXT("TT"), CountryCodeTT);
-        _CountryCodeMap.Add(TEXT("TN"), CountryCodeTN);
-        _CountryCodeMap.Add(TEXT("TR"), CountryCodeTR);
-        _CountryCodeMap.Add(TEXT("TM"), CountryCodeTM);
-        _CountryCodeMap.Add(TEXT("TC"), CountryCodeTC);
-        _CountryCodeMap.Add(TEXT("TV"), CountryCodeTV);
-        _CountryCodeMap.Add(TEXT("UG"), CountryCodeUG);
-        _CountryCodeMap.Add(TEXT("UA"), CountryCodeUA);
-        _CountryCodeMap.Add(TEXT("AE"), CountryCodeAE);
-        _CountryCodeMap.Add(TEXT("GB"), CountryCodeGB);
-        _CountryCodeMap.Add(TEXT("US"), CountryCodeUS);
-        _CountryCodeMap.Add(TEXT("UM"), CountryCodeUM);
-        _CountryCodeMap.Add(TEXT("UY"), CountryCodeUY);
-        _CountryCodeMap.Add(TEXT("UZ"), CountryCodeUZ);
-        _CountryCodeMap.Add(TEXT("VU"), CountryCodeVU);
-        _CountryCodeMap.Add(TEXT("VE"), CountryCodeVE);
-        _CountryCodeMap.Add(TEXT("VN"), CountryCodeVN);
-        _CountryCodeMap.Add(TEXT("VG"), CountryCodeVG);
-        _CountryCodeMap.Add(TEXT("VI"), CountryCodeVI);
-        _CountryCodeMap.Add(TEXT("WF"), CountryCodeWF);
-        _CountryCodeMap.Add(TEXT("EH"), CountryCodeEH);
-        _CountryCodeMap.Add(TEXT("YE"), CountryCodeYE);
-        _CountryCodeMap.Add(TEXT("ZM"), CountryCodeZM);
-        _CountryCodeMap.Add(TEXT("ZW"), CountryCodeZW);
-        _CountryCodeMap.Add(TEXT("Unknown"), CountryCodeUnknown);
-
-    }
+    static const TMap<FString, CountryCode> _CountryCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, CountryCode> Map;
+        Map.Add(TEXT("AF"), CountryCodeAF);
+        Map.Add(TEXT("AX"), CountryCodeAX);
+        Map.Add(TEXT("AL"), CountryCodeAL);
+        Map.Add(TEXT("DZ"), CountryCodeDZ);
+        Map.Add(TEXT("AS"), CountryCodeAS);
+        Map.Add(TEXT("AD"), CountryCodeAD);
+        Map.Add(TEXT("AO"), CountryCodeAO);
+        Map.Add(TEXT("AI"), CountryCodeAI);
+        Map.Add(TEXT("AQ"), CountryCodeAQ);
+        Map.Add(TEXT("AG"), CountryCodeAG);
+        Map.Add(TEXT("AR"), CountryCodeAR);
+        Map.Add(TEXT("AM"), CountryCodeAM);
+        Map.Add(TEXT("AW"), CountryCodeAW);
+        Map.Add(TEXT("AU"), CountryCodeAU);
+        Map.Add(TEXT("AT"), CountryCodeAT);
+        Map.Add(TEXT("AZ"), CountryCodeAZ);
+        Map.Add(TEXT("BS"), CountryCodeBS);
+        Map.Add(TEXT("BH"), CountryCodeBH);
+        Map.Add(TEXT("BD"), CountryCodeBD);
+        Map.Add(TEXT("BB"), CountryCodeBB);
+        Map.Add(TEXT("BY"), CountryCodeBY);
+        Map.Add(TEXT("BE"), CountryCodeBE);
+        Map.Add(TEXT("BZ"), CountryCodeBZ);
+        Map.Add(TEXT("BJ"), CountryCodeBJ);
+        Map.Add(TEXT("BM"), CountryCodeBM);
+        Map.Add(TEXT("BT"), CountryCodeBT);
+        Map.Add(TEXT("BO"), CountryCodeBO);
+        Map.Add(TEXT("BQ"), CountryCodeBQ);
+        Map.Add(TEXT("BA"), CountryCodeBA);
+        Map.Add(TEXT("BW"), CountryCodeBW);
+        Map.Add(TEXT("BV"), CountryCodeBV);
+        Map.Add(TEXT("BR"), CountryCodeBR);
+        Map.Add(TEXT("IO"), CountryCodeIO);
+        Map.Add(TEXT("BN"), CountryCodeBN);
+        Map.Add(TEXT("BG"), CountryCodeBG);
+        Map.Add(TEXT("BF"), CountryCodeBF);
+        Map.Add(TEXT("BI"), CountryCodeBI);
+        Map.Add(TEXT("KH"), CountryCodeKH);
+        Map.Add(TEXT("CM"), CountryCodeCM);
+        Map.Add(TEXT("CA"), CountryCodeCA);
+        Map.Add(TEXT("CV"), CountryCodeCV);
+        Map.Add(TEXT("KY"), CountryCodeKY);
+        Map.Add(TEXT("CF"), CountryCodeCF);
+        Map.Add(TEXT("TD"), CountryCodeTD);
+        Map.Add(TEXT("CL"), CountryCodeCL);
+        Map.Add(TEXT("CN"), CountryCodeCN);
+        Map.Add(TEXT("CX"), CountryCodeCX);
+        Map.Add(TEXT("CC"), CountryCodeCC);
+        Map.Add(TEXT("CO"), CountryCodeCO);
+        Map.Add(TEXT("KM"), CountryCodeKM);
+        Map.Add(TEXT("CG"), CountryCodeCG);
+        Map.Add(TEXT("CD"), CountryCodeCD);
+        Map.Add(TEXT("CK"), CountryCodeCK);
+        Map.Add(TEXT("CR"), CountryCodeCR);
+        Map.Add(TEXT("CI"), CountryCodeCI);
+        Map.Add(TEXT("HR"), CountryCodeHR);
+        Map.Add(TEXT("CU"), CountryCodeCU);
+        Map.Add(TEXT("CW"), CountryCodeCW);
+        Map.Add(TEXT("CY"), CountryCodeCY);
+        Map.Add(TEXT("CZ"), CountryCodeCZ);
+        Map.Add(TEXT("DK"), CountryCodeDK);
+        Map.Add(TEXT("DJ"), CountryCodeDJ);
+        Map.Add(TEXT("DM"), CountryCodeDM);
+        Map.Add(TEXT("DO"), CountryCodeDO);
+        Map.Add(TEXT("EC"), CountryCodeEC);
+        Map.Add(TEXT("EG"), CountryCodeEG);
+        Map.Add(TEXT("SV"), CountryCodeSV);
+        Map.Add(TEXT("GQ"), CountryCodeGQ);
+        Map.Add(TEXT("ER"), CountryCodeER);
+        Map.Add(TEXT("EE"), CountryCodeEE);
+        Map.Add(TEXT("ET"), CountryCodeET);
+        Map.Add(TEXT("FK"), CountryCodeFK);
+        Map.Add(TEXT("FO"), CountryCodeFO);
+        Map.Add(TEXT("FJ"), CountryCodeFJ);
+        Map.Add(TEXT("FI"), CountryCodeFI);
+        Map.Add(TEXT("FR"), CountryCodeFR);
+        Map.Add(TEXT("GF"), CountryCodeGF);
+        Map.Add(TEXT("PF"), CountryCodePF);
+        Map.Add(TEXT("TF"), CountryCodeTF);
+        Map.Add(TEXT("GA"), CountryCodeGA);
+        Map.Add(TEXT("GM"), CountryCodeGM);
+        Map.Add(TEXT("GE"), CountryCodeGE);
+        Map.Add(TEXT("DE"), CountryCodeDE);
+        Map.Add(TEXT("GH"), CountryCodeGH);
+        Map.Add(TEXT("GI"), CountryCodeGI);
+        Map.Add(TEXT("GR"), CountryCodeGR);
+        Map.Add(TEXT("GL"), CountryCodeGL);
+        Map.Add(TEXT("GD"), CountryCodeGD);
+        Map.Add(TEXT("GP"), CountryCodeGP);
+        Map.Add(TEXT("GU"), CountryCodeGU);
+        Map.Add(TEXT("GT"), CountryCodeGT);
+        Map.Add(TEXT("GG"), CountryCodeGG);
+        Map.Add(TEXT("GN"), CountryCodeGN);
+        Map.Add(TEXT("GW"), CountryCodeGW);
+        Map.Add(TEXT("GY"), CountryCodeGY);
+        Map.Add(TEXT("HT"), CountryCodeHT);
+        Map.Add(TEXT("HM"), CountryCodeHM);
+        Map.Add(TEXT("VA"), CountryCodeVA);
+        Map.Add(TEXT("HN"), CountryCodeHN);
+        Map.Add(TEXT("HK"), CountryCodeHK);
+        Map.Add(TEXT("HU"), CountryCodeHU);
+        Map.Add(TEXT("IS"), CountryCodeIS);
+        Map.Add(TEXT("IN"), CountryCodeIN);
+        Map.Add(TEXT("ID"), CountryCodeID);
+        Map.Add(TEXT("IR"), CountryCodeIR);
+        Map.Add(TEXT("IQ"), CountryCodeIQ);
+        Map.Add(TEXT("IE"), CountryCodeIE);
+        Map.Add(TEXT("IM"), CountryCodeIM);
+        Map.Add(TEXT("IL"), CountryCodeIL);
+        Map.Add(TEXT("IT"), CountryCodeIT);
+        Map.Add(TEXT("JM"), CountryCodeJM);
+        Map.Add(TEXT("JP"), CountryCodeJP);
+        Map.Add(TEXT("JE"), CountryCodeJE);
+        Map.Add(TEXT("JO"), CountryCodeJO);
+        Map.Add(TEXT("KZ"), CountryCodeKZ);
+        Map.Add(TEXT("KE"), CountryCodeKE);
+        Map.Add(TEXT("KI"), CountryCodeKI);
+        Map.Add(TEXT("KP"), CountryCodeKP);
+        Map.Add(TEXT("KR"), CountryCodeKR);
+        Map.Add(TEXT("KW"), CountryCodeKW);
+        Map.Add(TEXT("KG"), CountryCodeKG);
+        Map.Add(TEXT("LA"), CountryCodeLA);
+        Map.Add(TEXT("LV"), CountryCodeLV);
+        Map.Add(TEXT("LB"), CountryCodeLB);
+        Map.Add(TEXT("LS"), CountryCodeLS);
+        Map.Add(TEXT("LR"), CountryCodeLR);
+        Map.Add(TEXT("LY"), CountryCodeLY);
+        Map.Add(TEXT("LI"), CountryCodeLI);
+        Map.Add(TEXT("LT"), CountryCodeLT);
+        Map.Add(TEXT("LU"), CountryCodeLU);
+        Map.Add(TEXT("MO"), CountryCodeMO);
+        Map.Add(TEXT("MK"), CountryCodeMK);
+        Map.Add(TEXT("MG"), CountryCodeMG);
+        Map.Add(TEXT("MW"), CountryCodeMW);
+        Map.Add(TEXT("MY"), CountryCodeMY);
+        Map.Add(TEXT("MV"), CountryCodeMV);
+        Map.Add(TEXT("ML"), CountryCodeML);
+        Map.Add(TEXT("MT"), CountryCodeMT);
+        Map.Add(TEXT("MH"), CountryCodeMH);
+        Map.Add(TEXT("MQ"), CountryCodeMQ);
+        Map.Add(TEXT("MR"), CountryCodeMR);
+        Map.Add(TEXT("MU"), CountryCodeMU);
+        Map.Add(TEXT("YT"), CountryCodeYT);
+        Map.Add(TEXT("MX"), CountryCodeMX);
+        Map.Add(TEXT("FM"), CountryCodeFM);
+        Map.Add(TEXT("MD"), CountryCodeMD);
+        Map.Add(TEXT("MC"), CountryCodeMC);
+        Map.Add(TEXT("MN"), CountryCodeMN);
+        Map.Add(TEXT("ME"), CountryCodeME);
+        Map.Add(TEXT("MS"), CountryCodeMS);
+        Map.Add(TEXT("MA"), CountryCodeMA);
+        Map.Add(TEXT("MZ"), CountryCodeMZ);
+        Map.Add(TEXT("MM"), CountryCodeMM);
+        Map.Add(TEXT("NA"), CountryCodeNA);
+        Map.Add(TEXT("NR"), CountryCodeNR);
+        Map.Add(TEXT("NP"), CountryCodeNP);
+        Map.Add(TEXT("NL"), CountryCodeNL);
+        Map.Add(TEXT("NC"), CountryCodeNC);
+        Map.Add(TEXT("NZ"), CountryCodeNZ);
+        Map.Add(TEXT("NI"), CountryCodeNI);
+        Map.Add(TEXT("NE"), CountryCodeNE);
+        Map.Add(TEXT("NG"), CountryCodeNG);
+        Map.Add(TEXT("NU"), CountryCodeNU);
+        Map.Add(TEXT("NF"), CountryCodeNF);
+        Map.Add(TEXT("MP"), CountryCodeMP);
+        Map.Add(TEXT("NO"), CountryCodeNO);
+        Map.Add(TEXT("OM"), CountryCodeOM);
+        Map.Add(TEXT("PK"), CountryCodePK);
+        Map.Add(TEXT("PW"), CountryCodePW);
+        Map.Add(TEXT("PS"), CountryCodePS);
+        Map.Add(TEXT("PA"), CountryCodePA);
+        Map.Add(TEXT("PG"), CountryCodePG);
+        Map.Add(TEXT("PY"), CountryCodePY);
+        Map.Add(TEXT("PE"), CountryCodePE);
+        Map.Add(TEXT("PH"), CountryCodePH);
+        Map.Add(TEXT("PN"), CountryCodePN);
+        Map.Add(TEXT("PL"), CountryCodePL);
+        Map.Add(TEXT("PT"), CountryCodePT);
+        Map.Add(TEXT("PR"), CountryCodePR);
+        Map.Add(TEXT("QA"), CountryCodeQA);
+        Map.Add(TEXT("RE"), CountryCodeRE);
+        Map.Add(TEXT("RO"), CountryCodeRO);
+        Map.Add(TEXT("RU"), CountryCodeRU);
+        Map.Add(TEXT("RW"), CountryCodeRW);
+        Map.Add(TEXT("BL"), CountryCodeBL);
+        Map.Add(TEXT("SH"), CountryCodeSH);
+        Map.Add(TEXT("KN"), CountryCodeKN);
+        Map.Add(TEXT("LC"), CountryCodeLC);
+        Map.Add(TEXT("MF"), CountryCodeMF);
+        Map.Add(TEXT("PM"), CountryCodePM);
+        Map.Add(TEXT("VC"), CountryCodeVC);
+        Map.Add(TEXT("WS"), CountryCodeWS);
+        Map.Add(TEXT("SM"), CountryCodeSM);
+        Map.Add(TEXT("ST"), CountryCodeST);
+        Map.Add(TEXT("SA"), CountryCodeSA);
+        Map.Add(TEXT("SN"), CountryCodeSN);
+        Map.Add(TEXT("RS"), CountryCodeRS);
+        Map.Add(TEXT("SC"), CountryCodeSC);
+        Map.Add(TEXT("SL"), CountryCodeSL);
+        Map.Add(TEXT("SG"), CountryCodeSG);
+        Map.Add(TEXT("SX"), CountryCodeSX);
+        Map.Add(TEXT("SK"), CountryCodeSK);
+        Map.Add(TEXT("SI"), CountryCodeSI);
+        Map.Add(TEXT("SB"), CountryCodeSB);
+        Map.Add(TEXT("SO"), CountryCodeSO);
+        Map.Add(TEXT("ZA"), CountryCodeZA);
+        Map.Add(TEXT("GS"), CountryCodeGS);
+        Map.Add(TEXT("SS"), CountryCodeSS);
+        Map.Add(TEXT("ES"), CountryCodeES);
+        Map.Add(TEXT("LK"), CountryCodeLK);
+        Map.Add(TEXT("SD"), CountryCodeSD);
+        Map.Add(TEXT("SR"), CountryCodeSR);
+        Map.Add(TEXT("SJ"), CountryCodeSJ);
+        Map.Add(TEXT("SZ"), CountryCodeSZ);
+        Map.Add(TEXT("SE"), CountryCodeSE);
+        Map.Add(TEXT("CH"), CountryCodeCH);
+        Map.Add(TEXT("SY"), CountryCodeSY);
+        Map.Add(TEXT("TW"), CountryCodeTW);
+        Map.Add(TEXT("TJ"), CountryCodeTJ);
+        Map.Add(TEXT("TZ"), CountryCodeTZ);
+        Map.Add(TEXT("TH"), CountryCodeTH);
+        Map.Add(TEXT("TL"), CountryCodeTL);
+        Map.Add(TEXT("TG"), CountryCodeTG);
+        Map.Add(TEXT("TK"), CountryCodeTK);
+        Map.Add(TEXT("TO"), CountryCodeTO);
+        Map.Add(TEXT("TT"), CountryCodeTT);
+        Map.Add(TEXT("TN"), CountryCodeTN);
+        Map.Add(TEXT("TR"), CountryCodeTR);
+        Map.Add(TEXT("TM"), CountryCodeTM);
+        Map.Add(TEXT("TC"), CountryCodeTC);
+        Map.Add(TEXT("TV"), CountryCodeTV);
+        Map.Add(TEXT("UG"), CountryCodeUG);
+        Map.Add(TEXT("UA"), CountryCodeUA);
+        Map.Add(TEXT("AE"), CountryCodeAE);
+        Map.Add(TEXT("GB"), CountryCodeGB);
+        Map.Add(TEXT("US"), CountryCodeUS);
+        Map.Add(TEXT("UM"), CountryCodeUM);
+        Map.Add(TEXT("UY"), CountryCodeUY);
+        Map.Add(TEXT("UZ"), CountryCodeUZ);
+        Map.Add(TEXT("VU"), CountryCodeVU);
+        Map.Add(TEXT("VE"), CountryCodeVE);
+        Map.Add(TEXT("VN"), CountryCodeVN);
+        Map.Add(TEXT("VG"), CountryCodeVG);
+        Map.Add(TEXT("VI"), CountryCodeVI);
+        Map.Add(TEXT("WF"), CountryCodeWF);
+        Map.Add(TEXT("EH"), CountryCodeEH);
+        Map.Add(TEXT("YE"), CountryCodeYE);
+        Map.Add(TEXT("ZM"), CountryCodeZM);
+        Map.Add(TEXT("ZW"), CountryCodeZW);
+        Map.Add(TEXT("Unknown"), CountryCodeUnknown);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -4125,174 +4108,174 @@ ClientModels::Currency PlayFab::ClientModels::readCurrencyFromValue(const TShare
 
 ClientModels::Currency PlayFab::ClientModels::readCurrencyFromValue(const FString& value)
 {
-    static TMap<FString, Currency> _CurrencyMap;
-    if (_CurrencyMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _CurrencyMap.Add(TEXT("AED"), CurrencyAED);
-        _CurrencyMap.Add(TEXT("AFN"), CurrencyAFN);
-        _CurrencyMap.Add(TEXT("ALL"), CurrencyALL);
-        _CurrencyMap.Add(TEXT("AMD"), CurrencyAMD);
-        _CurrencyMap.Add(TEXT("ANG"), CurrencyANG);
-        _CurrencyMap.Add(TEXT("AOA"), CurrencyAOA);
-        _CurrencyMap.Add(TEXT("ARS"), CurrencyARS);
-        _CurrencyMap.Add(TEXT("AUD"), CurrencyAUD);
-        _CurrencyMap.Add(TEXT("AWG"), CurrencyAWG);
-        _CurrencyMap.Add(TEXT("AZN"), CurrencyAZN);
-        _CurrencyMap.Add(TEXT("BAM"), CurrencyBAM);
-        _CurrencyMap.Add(TEXT("BBD"), CurrencyBBD);
-        _CurrencyMap.Add(TEXT("BDT"), CurrencyBDT);
-        _CurrencyMap.Add(TEXT("BGN"), CurrencyBGN);
-        _CurrencyMap.Add(TEXT("BHD"), CurrencyBHD);
-        _CurrencyMap.Add(TEXT("BIF"), CurrencyBIF);
-        _CurrencyMap.Add(TEXT("BMD"), CurrencyBMD);
-        _CurrencyMap.Add(TEXT("BND"), CurrencyBND);
-        _CurrencyMap.Add(TEXT("BOB"), CurrencyBOB);
-        _CurrencyMap.Add(TEXT("BRL"), CurrencyBRL);
-        _CurrencyMap.Add(TEXT("BSD"), CurrencyBSD);
-        _CurrencyMap.Add(TEXT("BTN"), CurrencyBTN);
-        _CurrencyMap.Add(TEXT("BWP"), CurrencyBWP);
-        _CurrencyMap.Add(TEXT("BYR"), CurrencyBYR);
-        _CurrencyMap.Add(TEXT("BZD"), CurrencyBZD);
-        _CurrencyMap.Add(TEXT("CAD"), CurrencyCAD);
-        _CurrencyMap.Add(TEXT("CDF"), CurrencyCDF);
-        _CurrencyMap.Add(TEXT("CHF"), CurrencyCHF);
-        _CurrencyMap.Add(TEXT("CLP"), CurrencyCLP);
-        _CurrencyMap.Add(TEXT("CNY"), CurrencyCNY);
-        _CurrencyMap.Add(TEXT("COP"), CurrencyCOP);
-        _CurrencyMap.Add(TEXT("CRC"), CurrencyCRC);
-        _CurrencyMap.Add(TEXT("CUC"), CurrencyCUC);
-        _CurrencyMap.Add(TEXT("CUP"), CurrencyCUP);
-        _CurrencyMap.Add(TEXT("CVE"), CurrencyCVE);
-        _CurrencyMap.Add(TEXT("CZK"), CurrencyCZK);
-        _CurrencyMap.Add(TEXT("DJF"), CurrencyDJF);
-        _CurrencyMap.Add(TEXT("DKK"), CurrencyDKK);
-        _CurrencyMap.Add(TEXT("DOP"), CurrencyDOP);
-        _CurrencyMap.Add(TEXT("DZD"), CurrencyDZD);
-        _CurrencyMap.Add(TEXT("EGP"), CurrencyEGP);
-        _CurrencyMap.Add(TEXT("ERN"), CurrencyERN);
-        _CurrencyMap.Add(TEXT("ETB"), CurrencyETB);
-        _CurrencyMap.Add(TEXT("EUR"), CurrencyEUR);
-        _CurrencyMap.Add(TEXT("FJD"), CurrencyFJD);
-        _CurrencyMap.Add(TEXT("FKP"), CurrencyFKP);
-        _CurrencyMap.Add(TEXT("GBP"), CurrencyGBP);
-        _CurrencyMap.Add(TEXT("GEL"), CurrencyGEL);
-        _CurrencyMap.Add(TEXT("GGP"), CurrencyGGP);
-        _CurrencyMap.Add(TEXT("GHS"), CurrencyGHS);
-        _CurrencyMap.Add(TEXT("GIP"), CurrencyGIP);
-        _CurrencyMap.Add(TEXT("GMD"), CurrencyGMD);
-        _CurrencyMap.Add(TEXT("GNF"), CurrencyGNF);
-        _CurrencyMap.Add(TEXT("GTQ"), CurrencyGTQ);
-        _CurrencyMap.Add(TEXT("GYD"), CurrencyGYD);
-        _CurrencyMap.Add(TEXT("HKD"), CurrencyHKD);
-        _CurrencyMap.Add(TEXT("HNL"), CurrencyHNL);
-        _CurrencyMap.Add(TEXT("HRK"), CurrencyHRK);
-        _CurrencyMap.Add(TEXT("HTG"), CurrencyHTG);
-        _CurrencyMap.Add(TEXT("HUF"), CurrencyHUF);
-        _CurrencyMap.Add(TEXT("IDR"), CurrencyIDR);
-        _CurrencyMap.Add(TEXT("ILS"), CurrencyILS);
-        _CurrencyMap.Add(TEXT("IMP"), CurrencyIMP);
-        _CurrencyMap.Add(TEXT("INR"), CurrencyINR);
-        _CurrencyMap.Add(TEXT("IQD"), CurrencyIQD);
-        _CurrencyMap.Add(TEXT("IRR"), CurrencyIRR);
-        _CurrencyMap.Add(TEXT("ISK"), CurrencyISK);
-        _CurrencyMap.Add(TEXT("JEP"), CurrencyJEP);
-        _CurrencyMap.Add(TEXT("JMD"), CurrencyJMD);
-        _CurrencyMap.Add(TEXT("JOD"), CurrencyJOD);
-        _CurrencyMap.Add(TEXT("JPY"), CurrencyJPY);
-        _CurrencyMap.Add(TEXT("KES"), CurrencyKES);
-        _CurrencyMap.Add(TEXT("KGS"), CurrencyKGS);
-        _CurrencyMap.Add(TEXT("KHR"), CurrencyKHR);
-        _CurrencyMap.Add(TEXT("KMF"), CurrencyKMF);
-        _CurrencyMap.Add(TEXT("KPW"), CurrencyKPW);
-        _CurrencyMap.Add(TEXT("KRW"), CurrencyKRW);
-        _CurrencyMap.Add(TEXT("KWD"), CurrencyKWD);
-        _CurrencyMap.Add(TEXT("KYD"), CurrencyKYD);
-        _CurrencyMap.Add(TEXT("KZT"), CurrencyKZT);
-        _CurrencyMap.Add(TEXT("LAK"), CurrencyLAK);
-        _CurrencyMap.Add(TEXT("LBP"), CurrencyLBP);
-        _CurrencyMap.Add(TEXT("LKR"), CurrencyLKR);
-        _CurrencyMap.Add(TEXT("LRD"), CurrencyLRD);
-        _CurrencyMap.Add(TEXT("LSL"), CurrencyLSL);
-        _CurrencyMap.Add(TEXT("LYD"), CurrencyLYD);
-        _CurrencyMap.Add(TEXT("MAD"), CurrencyMAD);
-        _CurrencyMap.Add(TEXT("MDL"), CurrencyMDL);
-        _CurrencyMap.Add(TEXT("MGA"), CurrencyMGA);
-        _CurrencyMap.Add(TEXT("MKD"), CurrencyMKD);
-        _CurrencyMap.Add(TEXT("MMK"), CurrencyMMK);
-        _CurrencyMap.Add(TEXT("MNT"), CurrencyMNT);
-        _CurrencyMap.Add(TEXT("MOP"), CurrencyMOP);
-        _CurrencyMap.Add(TEXT("MRO"), CurrencyMRO);
-        _CurrencyMap.Add(TEXT("MUR"), CurrencyMUR);
-        _CurrencyMap.Add(TEXT("MVR"), CurrencyMVR);
-        _CurrencyMap.Add(TEXT("MWK"), CurrencyMWK);
-        _CurrencyMap.Add(TEXT("MXN"), CurrencyMXN);
-        _CurrencyMap.Add(TEXT("MYR"), CurrencyMYR);
-        _CurrencyMap.Add(TEXT("MZN"), CurrencyMZN);
-        _CurrencyMap.Add(TEXT("NAD"), CurrencyNAD);
-        _CurrencyMap.Add(TEXT("NGN"), CurrencyNGN);
-        _CurrencyMap.Add(TEXT("NIO"), CurrencyNIO);
-        _CurrencyMap.Add(TEXT("NOK"), CurrencyNOK);
-        _CurrencyMap.Add(TEXT("NPR"), CurrencyNPR);
-        _CurrencyMap.Add(TEXT("NZD"), CurrencyNZD);
-        _CurrencyMap.Add(TEXT("OMR"), CurrencyOMR);
-        _CurrencyMap.Add(TEXT("PAB"), CurrencyPAB);
-        _CurrencyMap.Add(TEXT("PEN"), CurrencyPEN);
-        _CurrencyMap.Add(TEXT("PGK"), CurrencyPGK);
-        _CurrencyMap.Add(TEXT("PHP"), CurrencyPHP);
-        _CurrencyMap.Add(TEXT("PKR"), CurrencyPKR);
-        _CurrencyMap.Add(TEXT("PLN"), CurrencyPLN);
-        _CurrencyMap.Add(TEXT("PYG"), CurrencyPYG);
-        _CurrencyMap.Add(TEXT("QAR"), CurrencyQAR);
-        _CurrencyMap.Add(TEXT("RON"), CurrencyRON);
-        _CurrencyMap.Add(TEXT("RSD"), CurrencyRSD);
-        _CurrencyMap.Add(TEXT("RUB"), CurrencyRUB);
-        _CurrencyMap.Add(TEXT("RWF"), CurrencyRWF);
-        _CurrencyMap.Add(TEXT("SAR"), CurrencySAR);
-        _CurrencyMap.Add(TEXT("SBD"), CurrencySBD);
-        _CurrencyMap.Add(TEXT("SCR"), CurrencySCR);
-        _CurrencyMap.Add(TEXT("SDG"), CurrencySDG);
-        _CurrencyMap.Add(TEXT("SEK"), CurrencySEK);
-        _CurrencyMap.Add(TEXT("SGD"), CurrencySGD);
-        _CurrencyMap.Add(TEXT("SHP"), CurrencySHP);
-        _CurrencyMap.Add(TEXT("SLL"), CurrencySLL);
-        _CurrencyMap.Add(TEXT("SOS"), CurrencySOS);
-        _CurrencyMap.Add(TEXT("SPL"), CurrencySPL);
-        _CurrencyMap.Add(TEXT("SRD"), CurrencySRD);
-        _CurrencyMap.Add(TEXT("STD"), CurrencySTD);
-        _CurrencyMap.Add(TEXT("SVC"), CurrencySVC);
-        _CurrencyMap.Add(TEXT("SYP"), CurrencySYP);
-        _CurrencyMap.Add(TEXT("SZL"), CurrencySZL);
-        _CurrencyMap.Add(TEXT("THB"), CurrencyTHB);
-        _CurrencyMap.Add(TEXT("TJS"), CurrencyTJS);
-        _CurrencyMap.Add(TEXT("TMT"), CurrencyTMT);
-        _CurrencyMap.Add(TEXT("TND"), CurrencyTND);
-        _CurrencyMap.Add(TEXT("TOP"), CurrencyTOP);
-        _CurrencyMap.Add(TEXT("TRY"), CurrencyTRY);
-        _CurrencyMap.Add(TEXT("TTD"), CurrencyTTD);
-        _CurrencyMap.Add(TEXT("TVD"), CurrencyTVD);
-        _CurrencyMap.Add(TEXT("TWD"), CurrencyTWD);
-        _CurrencyMap.Add(TEXT("TZS"), CurrencyTZS);
-        _CurrencyMap.Add(TEXT("UAH"), CurrencyUAH);
-        _CurrencyMap.Add(TEXT("UGX"), CurrencyUGX);
-        _CurrencyMap.Add(TEXT("USD"), CurrencyUSD);
-        _CurrencyMap.Add(TEXT("UYU"), CurrencyUYU);
-        _CurrencyMap.Add(TEXT("UZS"), CurrencyUZS);
-        _CurrencyMap.Add(TEXT("VEF"), CurrencyVEF);
-        _CurrencyMap.Add(TEXT("VND"), CurrencyVND);
-        _CurrencyMap.Add(TEXT("VUV"), CurrencyVUV);
-        _CurrencyMap.Add(TEXT("WST"), CurrencyWST);
-        _CurrencyMap.Add(TEXT("XAF"), CurrencyXAF);
-        _CurrencyMap.Add(TEXT("XCD"), CurrencyXCD);
-        _CurrencyMap.Add(TEXT("XDR"), CurrencyXDR);
-        _CurrencyMap.Add(TEXT("XOF"), CurrencyXOF);
-        _CurrencyMap.Add(TEXT("XPF"), CurrencyXPF);
-        _CurrencyMap.Add(TEXT("YER"), CurrencyYER);
-        _CurrencyMap.Add(TEXT("ZAR"), CurrencyZAR);
-        _CurrencyMap.Add(TEXT("ZMW"), CurrencyZMW);
-        _CurrencyMap.Add(TEXT("ZWD"), CurrencyZWD);
-
-    }
+    static const TMap<FString, Currency> _CurrencyMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, Currency> Map;
+        Map.Add(TEXT("AED"), CurrencyAED);
+        Map.Add(TEXT("AFN"), CurrencyAFN);
+        Map.Add(TEXT("ALL"), CurrencyALL);
+        Map.Add(TEXT("AMD"), CurrencyAMD);
+        Map.Add(TEXT("ANG"), CurrencyANG);
+        Map.Add(TEXT("AOA"), CurrencyAOA);
+        Map.Add(TEXT("ARS"), CurrencyARS);
+        Map.Add(TEXT("AUD"), CurrencyAUD);
+        Map.Add(TEXT("AWG"), CurrencyAWG);
+        Map.Add(TEXT("AZN"), CurrencyAZN);
+        Map.Add(TEXT("BAM"), CurrencyBAM);
+        Map.Add(TEXT("BBD"), CurrencyBBD);
+        Map.Add(TEXT("BDT"), CurrencyBDT);
+        Map.Add(TEXT("BGN"), CurrencyBGN);
+        Map.Add(TEXT("BHD"), CurrencyBHD);
+        Map.Add(TEXT("BIF"), CurrencyBIF);
+        Map.Add(TEXT("BMD"), CurrencyBMD);
+        Map.Add(TEXT("BND"), CurrencyBND);
+        Map.Add(TEXT("BOB"), CurrencyBOB);
+        Map.Add(TEXT("BRL"), CurrencyBRL);
+        Map.Add(TEXT("BSD"), CurrencyBSD);
+        Map.Add(TEXT("BTN"), CurrencyBTN);
+        Map.Add(TEXT("BWP"), CurrencyBWP);
+        Map.Add(TEXT("BYR"), CurrencyBYR);
+        Map.Add(TEXT("BZD"), CurrencyBZD);
+        Map.Add(TEXT("CAD"), CurrencyCAD);
+        Map.Add(TEXT("CDF"), CurrencyCDF);
+        Map.Add(TEXT("CHF"), CurrencyCHF);
+        Map.Add(TEXT("CLP"), CurrencyCLP);
+        Map.Add(TEXT("CNY"), CurrencyCNY);
+        Map.Add(TEXT("COP"), CurrencyCOP);
+        Map.Add(TEXT("CRC"), CurrencyCRC);
+        Map.Add(TEXT("CUC"), CurrencyCUC);
+        Map.Add(TEXT("CUP"), CurrencyCUP);
+        Map.Add(TEXT("CVE"), CurrencyCVE);
+        Map.Add(TEXT("CZK"), CurrencyCZK);
+        Map.Add(TEXT("DJF"), CurrencyDJF);
+        Map.Add(TEXT("DKK"), CurrencyDKK);
+        Map.Add(TEXT("DOP"), CurrencyDOP);
+        Map.Add(TEXT("DZD"), CurrencyDZD);
+        Map.Add(TEXT("EGP"), CurrencyEGP);
+        Map.Add(TEXT("ERN"), CurrencyERN);
+        Map.Add(TEXT("ETB"), CurrencyETB);
+        Map.Add(TEXT("EUR"), CurrencyEUR);
+        Map.Add(TEXT("FJD"), CurrencyFJD);
+        Map.Add(TEXT("FKP"), CurrencyFKP);
+        Map.Add(TEXT("GBP"), CurrencyGBP);
+        Map.Add(TEXT("GEL"), CurrencyGEL);
+        Map.Add(TEXT("GGP"), CurrencyGGP);
+        Map.Add(TEXT("GHS"), CurrencyGHS);
+        Map.Add(TEXT("GIP"), CurrencyGIP);
+        Map.Add(TEXT("GMD"), CurrencyGMD);
+        Map.Add(TEXT("GNF"), CurrencyGNF);
+        Map.Add(TEXT("GTQ"), CurrencyGTQ);
+        Map.Add(TEXT("GYD"), CurrencyGYD);
+        Map.Add(TEXT("HKD"), CurrencyHKD);
+        Map.Add(TEXT("HNL"), CurrencyHNL);
+        Map.Add(TEXT("HRK"), CurrencyHRK);
+        Map.Add(TEXT("HTG"), CurrencyHTG);
+        Map.Add(TEXT("HUF"), CurrencyHUF);
+        Map.Add(TEXT("IDR"), CurrencyIDR);
+        Map.Add(TEXT("ILS"), CurrencyILS);
+        Map.Add(TEXT("IMP"), CurrencyIMP);
+        Map.Add(TEXT("INR"), CurrencyINR);
+        Map.Add(TEXT("IQD"), CurrencyIQD);
+        Map.Add(TEXT("IRR"), CurrencyIRR);
+        Map.Add(TEXT("ISK"), CurrencyISK);
+        Map.Add(TEXT("JEP"), CurrencyJEP);
+        Map.Add(TEXT("JMD"), CurrencyJMD);
+        Map.Add(TEXT("JOD"), CurrencyJOD);
+        Map.Add(TEXT("JPY"), CurrencyJPY);
+        Map.Add(TEXT("KES"), CurrencyKES);
+        Map.Add(TEXT("KGS"), CurrencyKGS);
+        Map.Add(TEXT("KHR"), CurrencyKHR);
+        Map.Add(TEXT("KMF"), CurrencyKMF);
+        Map.Add(TEXT("KPW"), CurrencyKPW);
+        Map.Add(TEXT("KRW"), CurrencyKRW);
+        Map.Add(TEXT("KWD"), CurrencyKWD);
+        Map.Add(TEXT("KYD"), CurrencyKYD);
+        Map.Add(TEXT("KZT"), CurrencyKZT);
+        Map.Add(TEXT("LAK"), CurrencyLAK);
+        Map.Add(TEXT("LBP"), CurrencyLBP);
+        Map.Add(TEXT("LKR"), CurrencyLKR);
+        Map.Add(TEXT("LRD"), CurrencyLRD);
+        Map.Add(TEXT("LSL"), CurrencyLSL);
+        Map.Add(TEXT("LYD"), CurrencyLYD);
+        Map.Add(TEXT("MAD"), CurrencyMAD);
+        Map.Add(TEXT("MDL"), CurrencyMDL);
+        Map.Add(TEXT("MGA"), CurrencyMGA);
+        Map.Add(TEXT("MKD"), CurrencyMKD);
+        Map.Add(TEXT("MMK"), CurrencyMMK);
+        Map.Add(TEXT("MNT"), CurrencyMNT);
+        Map.Add(TEXT("MOP"), CurrencyMOP);
+        Map.Add(TEXT("MRO"), CurrencyMRO);
+        Map.Add(TEXT("MUR"), CurrencyMUR);
+        Map.Add(TEXT("MVR"), CurrencyMVR);
+        Map.Add(TEXT("MWK"), CurrencyMWK);
+        Map.Add(TEXT("MXN"), CurrencyMXN);
+        Map.Add(TEXT("MYR"), CurrencyMYR);
+        Map.Add(TEXT("MZN"), CurrencyMZN);
+        Map.Add(TEXT("NAD"), CurrencyNAD);
+        Map.Add(TEXT("NGN"), CurrencyNGN);
+        Map.Add(TEXT("NIO"), CurrencyNIO);
+        Map.Add(TEXT("NOK"), CurrencyNOK);
+        Map.Add(TEXT("NPR"), CurrencyNPR);
+        Map.Add(TEXT("NZD"), CurrencyNZD);
+        Map.Add(TEXT("OMR"), CurrencyOMR);
+        Map.Add(TEXT("PAB"), CurrencyPAB);
+        Map.Add(TEXT("PEN"), CurrencyPEN);
+        Map.Add(TEXT("PGK"), CurrencyPGK);
+        Map.Add(TEXT("PHP"), CurrencyPHP);
+        Map.Add(TEXT("PKR"), CurrencyPKR);
+        Map.Add(TEXT("PLN"), CurrencyPLN);
+        Map.Add(TEXT("PYG"), CurrencyPYG);
+        Map.Add(TEXT("QAR"), CurrencyQAR);
+        Map.Add(TEXT("RON"), CurrencyRON);
+        Map.Add(TEXT("RSD"), CurrencyRSD);
+        Map.Add(TEXT("RUB"), CurrencyRUB);
+        Map.Add(TEXT("RWF"), CurrencyRWF);
+        Map.Add(TEXT("SAR"), CurrencySAR);
+        Map.Add(TEXT("SBD"), CurrencySBD);
+        Map.Add(TEXT("SCR"), CurrencySCR);
+        Map.Add(TEXT("SDG"), CurrencySDG);
+        Map.Add(TEXT("SEK"), CurrencySEK);
+        Map.Add(TEXT("SGD"), CurrencySGD);
+        Map.Add(TEXT("SHP"), CurrencySHP);
+        Map.Add(TEXT("SLL"), CurrencySLL);
+        Map.Add(TEXT("SOS"), CurrencySOS);
+        Map.Add(TEXT("SPL"), CurrencySPL);
+        Map.Add(TEXT("SRD"), CurrencySRD);
+        Map.Add(TEXT("STD"), CurrencySTD);
+        Map.Add(TEXT("SVC"), CurrencySVC);
+        Map.Add(TEXT("SYP"), CurrencySYP);
+        Map.Add(TEXT("SZL"), CurrencySZL);
+        Map.Add(TEXT("THB"), CurrencyTHB);
+        Map.Add(TEXT("TJS"), CurrencyTJS);
+        Map.Add(TEXT("TMT"), CurrencyTMT);
+        Map.Add(TEXT("TND"), CurrencyTND);
+        Map.Add(TEXT("TOP"), CurrencyTOP);
+        Map.Add(TEXT("TRY"), CurrencyTRY);
+        Map.Add(TEXT("TTD"), CurrencyTTD);
+        Map.Add(TEXT("TVD"), CurrencyTVD);
+        Map.Add(TEXT("TWD"), CurrencyTWD);
+        Map.Add(TEXT("TZS"), CurrencyTZS);
+        Map.Add(TEXT("UAH"), CurrencyUAH);
+        Map.Add(TEXT("UGX"), CurrencyUGX);
+        Map.Add(TEXT("USD"), CurrencyUSD);
+        Map.Add(TEXT("UYU"), CurrencyUYU);
+        Map.Add(TEXT("UZS"), CurrencyUZS);
+        Map.Add(TEXT("VEF"), CurrencyVEF);
+        Map.Add(TEXT("VND"), CurrencyVND);
+        Map.Add(TEXT("VUV"), CurrencyVUV);
+        Map.Add(TEXT("WST"), CurrencyWST);
+        Map.Add(TEXT("XAF"), CurrencyXAF);
+        Map.Add(TEXT("XCD"), CurrencyXCD);
+        Map.Add(TEXT("XDR"), CurrencyXDR);
+        Map.Add(TEXT("XOF"), CurrencyXOF);
+        Map.Add(TEXT("XPF"), CurrencyXPF);
+        Map.Add(TEXT("YER"), CurrencyYER);
+        Map.Add(TEXT("ZAR"), CurrencyZAR);
+        Map.Add(TEXT("ZMW"), CurrencyZMW);
+        Map.Add(TEXT("ZWD"), CurrencyZWD);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -4432,6 +4415,7 @@ bool PlayFab::ClientModels::FDeletePlayerCustomPropertiesRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4479,11 +4463,7 @@ bool PlayFab::ClientModels::FDeletePlayerCustomPropertiesResult::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DeletedPropertiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("DeletedProperties"));
-    for (int32 Idx = 0; Idx < DeletedPropertiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DeletedPropertiesArray[Idx];
-        DeletedProperties.Add(FDeletedPropertyDetails(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DeletedPropertiesArray, DeletedProperties);
 
 
     const TSharedPtr<FJsonValue> PropertiesVersionValue = obj->TryGetField(TEXT("PropertiesVersion"));
@@ -4526,6 +4506,7 @@ bool PlayFab::ClientModels::FDeviceInfoRequest::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* InfoObject;
     if (obj->TryGetObjectField(TEXT("Info"), InfoObject))
     {
+        Info.Reserve((*InfoObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*InfoObject)->Values); It; ++It)
         {
             Info.Add(It.Key(), FJsonKeeper(It.Value()));
@@ -4589,7 +4570,7 @@ void PlayFab::ClientModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -4742,6 +4723,7 @@ bool PlayFab::ClientModels::FExecuteCloudScriptRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5017,11 +4999,7 @@ bool PlayFab::ClientModels::FExecuteCloudScriptResult::readFromValue(const TShar
     }
 
     const TArray<TSharedPtr<FJsonValue>>&LogsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Logs"));
-    for (int32 Idx = 0; Idx < LogsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LogsArray[Idx];
-        Logs.Add(FLogStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LogsArray, Logs);
 
 
     const TSharedPtr<FJsonValue> LogsTooLargeValue = obj->TryGetField(TEXT("LogsTooLarge"));
@@ -5076,18 +5054,18 @@ ClientModels::ExternalFriendSources PlayFab::ClientModels::readExternalFriendSou
 
 ClientModels::ExternalFriendSources PlayFab::ClientModels::readExternalFriendSourcesFromValue(const FString& value)
 {
-    static TMap<FString, ExternalFriendSources> _ExternalFriendSourcesMap;
-    if (_ExternalFriendSourcesMap.Num() == 0)
+    static const TMap<FString, ExternalFriendSources> _ExternalFriendSourcesMap = []()
     {
-        // Auto-generate the map on the first use
-        _ExternalFriendSourcesMap.Add(TEXT("None"), ExternalFriendSourcesNone);
-        _ExternalFriendSourcesMap.Add(TEXT("Steam"), ExternalFriendSourcesSteam);
-        _ExternalFriendSourcesMap.Add(TEXT("Facebook"), ExternalFriendSourcesFacebook);
-        _ExternalFriendSourcesMap.Add(TEXT("Xbox"), ExternalFriendSourcesXbox);
-        _ExternalFriendSourcesMap.Add(TEXT("Psn"), ExternalFriendSourcesPsn);
-        _ExternalFriendSourcesMap.Add(TEXT("All"), ExternalFriendSourcesAll);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ExternalFriendSources> Map;
+        Map.Add(TEXT("None"), ExternalFriendSourcesNone);
+        Map.Add(TEXT("Steam"), ExternalFriendSourcesSteam);
+        Map.Add(TEXT("Facebook"), ExternalFriendSourcesFacebook);
+        Map.Add(TEXT("Xbox"), ExternalFriendSourcesXbox);
+        Map.Add(TEXT("Psn"), ExternalFriendSourcesPsn);
+        Map.Add(TEXT("All"), ExternalFriendSourcesAll);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -5117,7 +5095,7 @@ void PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonWr
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -5162,7 +5140,7 @@ void PlayFab::ClientModels::FFacebookPlayFabIdPair::writeJSON(JsonWriter& writer
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -5305,36 +5283,36 @@ ClientModels::LoginIdentityProvider PlayFab::ClientModels::readLoginIdentityProv
 
 ClientModels::LoginIdentityProvider PlayFab::ClientModels::readLoginIdentityProviderFromValue(const FString& value)
 {
-    static TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap;
-    if (_LoginIdentityProviderMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _LoginIdentityProviderMap.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
-        _LoginIdentityProviderMap.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
-        _LoginIdentityProviderMap.Add(TEXT("Custom"), LoginIdentityProviderCustom);
-        _LoginIdentityProviderMap.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
-        _LoginIdentityProviderMap.Add(TEXT("Steam"), LoginIdentityProviderSteam);
-        _LoginIdentityProviderMap.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
-        _LoginIdentityProviderMap.Add(TEXT("PSN"), LoginIdentityProviderPSN);
-        _LoginIdentityProviderMap.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
-        _LoginIdentityProviderMap.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
-        _LoginIdentityProviderMap.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
-        _LoginIdentityProviderMap.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
-        _LoginIdentityProviderMap.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
-        _LoginIdentityProviderMap.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
-        _LoginIdentityProviderMap.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
-        _LoginIdentityProviderMap.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
-        _LoginIdentityProviderMap.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
-        _LoginIdentityProviderMap.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
-        _LoginIdentityProviderMap.Add(TEXT("Apple"), LoginIdentityProviderApple);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
-        _LoginIdentityProviderMap.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
-        _LoginIdentityProviderMap.Add(TEXT("King"), LoginIdentityProviderKing);
-
-    }
+    static const TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, LoginIdentityProvider> Map;
+        Map.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
+        Map.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
+        Map.Add(TEXT("Custom"), LoginIdentityProviderCustom);
+        Map.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
+        Map.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
+        Map.Add(TEXT("Steam"), LoginIdentityProviderSteam);
+        Map.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
+        Map.Add(TEXT("PSN"), LoginIdentityProviderPSN);
+        Map.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
+        Map.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
+        Map.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
+        Map.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
+        Map.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
+        Map.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
+        Map.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
+        Map.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
+        Map.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
+        Map.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
+        Map.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
+        Map.Add(TEXT("Apple"), LoginIdentityProviderApple);
+        Map.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
+        Map.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
+        Map.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
+        Map.Add(TEXT("King"), LoginIdentityProviderKing);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -5509,20 +5487,20 @@ ClientModels::SubscriptionProviderStatus PlayFab::ClientModels::readSubscription
 
 ClientModels::SubscriptionProviderStatus PlayFab::ClientModels::readSubscriptionProviderStatusFromValue(const FString& value)
 {
-    static TMap<FString, SubscriptionProviderStatus> _SubscriptionProviderStatusMap;
-    if (_SubscriptionProviderStatusMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _SubscriptionProviderStatusMap.Add(TEXT("NoError"), SubscriptionProviderStatusNoError);
-        _SubscriptionProviderStatusMap.Add(TEXT("Cancelled"), SubscriptionProviderStatusCancelled);
-        _SubscriptionProviderStatusMap.Add(TEXT("UnknownError"), SubscriptionProviderStatusUnknownError);
-        _SubscriptionProviderStatusMap.Add(TEXT("BillingError"), SubscriptionProviderStatusBillingError);
-        _SubscriptionProviderStatusMap.Add(TEXT("ProductUnavailable"), SubscriptionProviderStatusProductUnavailable);
-        _SubscriptionProviderStatusMap.Add(TEXT("CustomerDidNotAcceptPriceChange"), SubscriptionProviderStatusCustomerDidNotAcceptPriceChange);
-        _SubscriptionProviderStatusMap.Add(TEXT("FreeTrial"), SubscriptionProviderStatusFreeTrial);
-        _SubscriptionProviderStatusMap.Add(TEXT("PaymentPending"), SubscriptionProviderStatusPaymentPending);
-
-    }
+    static const TMap<FString, SubscriptionProviderStatus> _SubscriptionProviderStatusMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SubscriptionProviderStatus> Map;
+        Map.Add(TEXT("NoError"), SubscriptionProviderStatusNoError);
+        Map.Add(TEXT("Cancelled"), SubscriptionProviderStatusCancelled);
+        Map.Add(TEXT("UnknownError"), SubscriptionProviderStatusUnknownError);
+        Map.Add(TEXT("BillingError"), SubscriptionProviderStatusBillingError);
+        Map.Add(TEXT("ProductUnavailable"), SubscriptionProviderStatusProductUnavailable);
+        Map.Add(TEXT("CustomerDidNotAcceptPriceChange"), SubscriptionProviderStatusCustomerDidNotAcceptPriceChange);
+        Map.Add(TEXT("FreeTrial"), SubscriptionProviderStatusFreeTrial);
+        Map.Add(TEXT("PaymentPending"), SubscriptionProviderStatusPaymentPending);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -5707,11 +5685,7 @@ bool PlayFab::ClientModels::FMembershipModel::readFromValue(const TSharedPtr<FJs
     }
 
     const TArray<TSharedPtr<FJsonValue>>&SubscriptionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Subscriptions"));
-    for (int32 Idx = 0; Idx < SubscriptionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SubscriptionsArray[Idx];
-        Subscriptions.Add(FSubscriptionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SubscriptionsArray, Subscriptions);
 
 
     return HasSucceeded;
@@ -5734,14 +5708,14 @@ ClientModels::PushNotificationPlatform PlayFab::ClientModels::readPushNotificati
 
 ClientModels::PushNotificationPlatform PlayFab::ClientModels::readPushNotificationPlatformFromValue(const FString& value)
 {
-    static TMap<FString, PushNotificationPlatform> _PushNotificationPlatformMap;
-    if (_PushNotificationPlatformMap.Num() == 0)
+    static const TMap<FString, PushNotificationPlatform> _PushNotificationPlatformMap = []()
     {
-        // Auto-generate the map on the first use
-        _PushNotificationPlatformMap.Add(TEXT("ApplePushNotificationService"), PushNotificationPlatformApplePushNotificationService);
-        _PushNotificationPlatformMap.Add(TEXT("GoogleCloudMessaging"), PushNotificationPlatformGoogleCloudMessaging);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, PushNotificationPlatform> Map;
+        Map.Add(TEXT("ApplePushNotificationService"), PushNotificationPlatformApplePushNotificationService);
+        Map.Add(TEXT("GoogleCloudMessaging"), PushNotificationPlatformGoogleCloudMessaging);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6099,11 +6073,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AdCampaignAttributionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AdCampaignAttributions"));
-    for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttributionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AdCampaignAttributionsArray, AdCampaignAttributions);
 
 
     const TSharedPtr<FJsonValue> AvatarUrlValue = obj->TryGetField(TEXT("AvatarUrl"));
@@ -6119,11 +6089,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
 
 
     const TArray<TSharedPtr<FJsonValue>>&ContactEmailAddressesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ContactEmailAddresses"));
-    for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfoModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContactEmailAddressesArray, ContactEmailAddresses);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -6146,27 +6112,15 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
 
 
     const TArray<TSharedPtr<FJsonValue>>&LinkedAccountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("LinkedAccounts"));
-    for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FLinkedPlatformAccountModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LinkedAccountsArray, LinkedAccounts);
 
 
     const TArray<TSharedPtr<FJsonValue>>&LocationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Locations"));
-    for (int32 Idx = 0; Idx < LocationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LocationsArray[Idx];
-        Locations.Add(FLocationModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LocationsArray, Locations);
 
 
     const TArray<TSharedPtr<FJsonValue>>&MembershipsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Memberships"));
-    for (int32 Idx = 0; Idx < MembershipsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembershipsArray[Idx];
-        Memberships.Add(FMembershipModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembershipsArray, Memberships);
 
 
     Origination = readLoginIdentityProviderFromValue(obj->TryGetField(TEXT("Origination")));
@@ -6186,27 +6140,15 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PushNotificationRegistrationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PushNotificationRegistrations"));
-    for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistrationModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PushNotificationRegistrationsArray, PushNotificationRegistrations);
 
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     const TArray<TSharedPtr<FJsonValue>>&TagsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Tags"));
-    for (int32 Idx = 0; Idx < TagsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = TagsArray[Idx];
-        Tags.Add(FTagModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(TagsArray, Tags);
 
 
     const TSharedPtr<FJsonValue> TitleIdValue = obj->TryGetField(TEXT("TitleId"));
@@ -6224,11 +6166,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ValuesToDateArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ValuesToDate"));
-    for (int32 Idx = 0; Idx < ValuesToDateArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ValuesToDateArray[Idx];
-        ValuesToDate.Add(FValueToDateModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ValuesToDateArray, ValuesToDate);
 
 
     return HasSucceeded;
@@ -6299,17 +6237,17 @@ ClientModels::TitleActivationStatus PlayFab::ClientModels::readTitleActivationSt
 
 ClientModels::TitleActivationStatus PlayFab::ClientModels::readTitleActivationStatusFromValue(const FString& value)
 {
-    static TMap<FString, TitleActivationStatus> _TitleActivationStatusMap;
-    if (_TitleActivationStatusMap.Num() == 0)
+    static const TMap<FString, TitleActivationStatus> _TitleActivationStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _TitleActivationStatusMap.Add(TEXT("None"), TitleActivationStatusNone);
-        _TitleActivationStatusMap.Add(TEXT("ActivatedTitleKey"), TitleActivationStatusActivatedTitleKey);
-        _TitleActivationStatusMap.Add(TEXT("PendingSteam"), TitleActivationStatusPendingSteam);
-        _TitleActivationStatusMap.Add(TEXT("ActivatedSteam"), TitleActivationStatusActivatedSteam);
-        _TitleActivationStatusMap.Add(TEXT("RevokedSteam"), TitleActivationStatusRevokedSteam);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, TitleActivationStatus> Map;
+        Map.Add(TEXT("None"), TitleActivationStatusNone);
+        Map.Add(TEXT("ActivatedTitleKey"), TitleActivationStatusActivatedTitleKey);
+        Map.Add(TEXT("PendingSteam"), TitleActivationStatusPendingSteam);
+        Map.Add(TEXT("ActivatedSteam"), TitleActivationStatusActivatedSteam);
+        Map.Add(TEXT("RevokedSteam"), TitleActivationStatusRevokedSteam);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6464,7 +6402,7 @@ void PlayFab::ClientModels::FFriendInfo::writeJSON(JsonWriter& writer) const
     if (FriendPlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("FriendPlayFabId"));
-        writer->WriteValue(FriendPlayFabId);
+        writer->WriteValue(FriendPlayFabId.ToString());
     }
 
     if (GameCenterInfo.IsValid())
@@ -6605,7 +6543,7 @@ void PlayFab::ClientModels::FGameCenterPlayFabIdPair::writeJSON(JsonWriter& writ
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -6651,7 +6589,7 @@ void PlayFab::ClientModels::FGenericPlayFabIdPair::writeJSON(JsonWriter& writer)
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -6695,7 +6633,7 @@ void PlayFab::ClientModels::FGetAccountInfoRequest::writeJSON(JsonWriter& writer
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (TitleDisplayName.IsEmpty() == false)
@@ -7323,39 +7261,39 @@ ClientModels::UserOrigination PlayFab::ClientModels::readUserOriginationFromValu
 
 ClientModels::UserOrigination PlayFab::ClientModels::readUserOriginationFromValue(const FString& value)
 {
-    static TMap<FString, UserOrigination> _UserOriginationMap;
-    if (_UserOriginationMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _UserOriginationMap.Add(TEXT("Organic"), UserOriginationOrganic);
-        _UserOriginationMap.Add(TEXT("Steam"), UserOriginationSteam);
-        _UserOriginationMap.Add(TEXT("Google"), UserOriginationGoogle);
-        _UserOriginationMap.Add(TEXT("Amazon"), UserOriginationAmazon);
-        _UserOriginationMap.Add(TEXT("Facebook"), UserOriginationFacebook);
-        _UserOriginationMap.Add(TEXT("Kongregate"), UserOriginationKongregate);
-        _UserOriginationMap.Add(TEXT("GamersFirst"), UserOriginationGamersFirst);
-        _UserOriginationMap.Add(TEXT("Unknown"), UserOriginationUnknown);
-        _UserOriginationMap.Add(TEXT("IOS"), UserOriginationIOS);
-        _UserOriginationMap.Add(TEXT("LoadTest"), UserOriginationLoadTest);
-        _UserOriginationMap.Add(TEXT("Android"), UserOriginationAndroid);
-        _UserOriginationMap.Add(TEXT("PSN"), UserOriginationPSN);
-        _UserOriginationMap.Add(TEXT("GameCenter"), UserOriginationGameCenter);
-        _UserOriginationMap.Add(TEXT("CustomId"), UserOriginationCustomId);
-        _UserOriginationMap.Add(TEXT("XboxLive"), UserOriginationXboxLive);
-        _UserOriginationMap.Add(TEXT("Parse"), UserOriginationParse);
-        _UserOriginationMap.Add(TEXT("Twitch"), UserOriginationTwitch);
-        _UserOriginationMap.Add(TEXT("ServerCustomId"), UserOriginationServerCustomId);
-        _UserOriginationMap.Add(TEXT("NintendoSwitchDeviceId"), UserOriginationNintendoSwitchDeviceId);
-        _UserOriginationMap.Add(TEXT("FacebookInstantGamesId"), UserOriginationFacebookInstantGamesId);
-        _UserOriginationMap.Add(TEXT("OpenIdConnect"), UserOriginationOpenIdConnect);
-        _UserOriginationMap.Add(TEXT("Apple"), UserOriginationApple);
-        _UserOriginationMap.Add(TEXT("NintendoSwitchAccount"), UserOriginationNintendoSwitchAccount);
-        _UserOriginationMap.Add(TEXT("GooglePlayGames"), UserOriginationGooglePlayGames);
-        _UserOriginationMap.Add(TEXT("XboxMobileStore"), UserOriginationXboxMobileStore);
-        _UserOriginationMap.Add(TEXT("King"), UserOriginationKing);
-        _UserOriginationMap.Add(TEXT("BattleNet"), UserOriginationBattleNet);
-
-    }
+    static const TMap<FString, UserOrigination> _UserOriginationMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, UserOrigination> Map;
+        Map.Add(TEXT("Organic"), UserOriginationOrganic);
+        Map.Add(TEXT("Steam"), UserOriginationSteam);
+        Map.Add(TEXT("Google"), UserOriginationGoogle);
+        Map.Add(TEXT("Amazon"), UserOriginationAmazon);
+        Map.Add(TEXT("Facebook"), UserOriginationFacebook);
+        Map.Add(TEXT("Kongregate"), UserOriginationKongregate);
+        Map.Add(TEXT("GamersFirst"), UserOriginationGamersFirst);
+        Map.Add(TEXT("Unknown"), UserOriginationUnknown);
+        Map.Add(TEXT("IOS"), UserOriginationIOS);
+        Map.Add(TEXT("LoadTest"), UserOriginationLoadTest);
+        Map.Add(TEXT("Android"), UserOriginationAndroid);
+        Map.Add(TEXT("PSN"), UserOriginationPSN);
+        Map.Add(TEXT("GameCenter"), UserOriginationGameCenter);
+        Map.Add(TEXT("CustomId"), UserOriginationCustomId);
+        Map.Add(TEXT("XboxLive"), UserOriginationXboxLive);
+        Map.Add(TEXT("Parse"), UserOriginationParse);
+        Map.Add(TEXT("Twitch"), UserOriginationTwitch);
+        Map.Add(TEXT("ServerCustomId"), UserOriginationServerCustomId);
+        Map.Add(TEXT("NintendoSwitchDeviceId"), UserOriginationNintendoSwitchDeviceId);
+        Map.Add(TEXT("FacebookInstantGamesId"), UserOriginationFacebookInstantGamesId);
+        Map.Add(TEXT("OpenIdConnect"), UserOriginationOpenIdConnect);
+        Map.Add(TEXT("Apple"), UserOriginationApple);
+        Map.Add(TEXT("NintendoSwitchAccount"), UserOriginationNintendoSwitchAccount);
+        Map.Add(TEXT("GooglePlayGames"), UserOriginationGooglePlayGames);
+        Map.Add(TEXT("XboxMobileStore"), UserOriginationXboxMobileStore);
+        Map.Add(TEXT("King"), UserOriginationKing);
+        Map.Add(TEXT("BattleNet"), UserOriginationBattleNet);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -7636,7 +7574,7 @@ void PlayFab::ClientModels::FUserAccountInfo::writeJSON(JsonWriter& writer) cons
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (PrivateInfo.IsValid())
@@ -7772,11 +7710,7 @@ bool PlayFab::ClientModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     }
 
     const TArray<TSharedPtr<FJsonValue>>&OpenIdInfoArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("OpenIdInfo"));
-    for (int32 Idx = 0; Idx < OpenIdInfoArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = OpenIdInfoArray[Idx];
-        OpenIdInfo.Add(FUserOpenIdInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(OpenIdInfoArray, OpenIdInfo);
 
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -7990,11 +7924,7 @@ bool PlayFab::ClientModels::FGetAdPlacementsResult::readFromValue(const TSharedP
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AdPlacementsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AdPlacements"));
-    for (int32 Idx = 0; Idx < AdPlacementsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AdPlacementsArray[Idx];
-        AdPlacements.Add(FAdPlacementDetails(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AdPlacementsArray, AdPlacements);
 
 
     return HasSucceeded;
@@ -8058,11 +7988,7 @@ bool PlayFab::ClientModels::FGetCatalogItemsResult::readFromValue(const TSharedP
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&CatalogArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Catalog"));
-    for (int32 Idx = 0; Idx < CatalogArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CatalogArray[Idx];
-        Catalog.Add(FCatalogItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CatalogArray, Catalog);
 
 
     return HasSucceeded;
@@ -8084,7 +8010,7 @@ void PlayFab::ClientModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writ
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (IfChangedFromDataVersion.notNull())
@@ -8105,7 +8031,7 @@ void PlayFab::ClientModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writ
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -8158,14 +8084,14 @@ ClientModels::UserDataPermission PlayFab::ClientModels::readUserDataPermissionFr
 
 ClientModels::UserDataPermission PlayFab::ClientModels::readUserDataPermissionFromValue(const FString& value)
 {
-    static TMap<FString, UserDataPermission> _UserDataPermissionMap;
-    if (_UserDataPermissionMap.Num() == 0)
+    static const TMap<FString, UserDataPermission> _UserDataPermissionMap = []()
     {
-        // Auto-generate the map on the first use
-        _UserDataPermissionMap.Add(TEXT("Private"), UserDataPermissionPrivate);
-        _UserDataPermissionMap.Add(TEXT("Public"), UserDataPermissionPublic);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, UserDataPermission> Map;
+        Map.Add(TEXT("Private"), UserDataPermissionPrivate);
+        Map.Add(TEXT("Public"), UserDataPermissionPublic);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -8237,7 +8163,7 @@ void PlayFab::ClientModels::FGetCharacterDataResult::writeJSON(JsonWriter& write
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (Data.Num() != 0)
@@ -8271,6 +8197,7 @@ bool PlayFab::ClientModels::FGetCharacterDataResult::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
@@ -8309,7 +8236,7 @@ void PlayFab::ClientModels::FGetCharacterInventoryRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -8347,6 +8274,7 @@ bool PlayFab::ClientModels::FGetCharacterInventoryRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8415,7 +8343,7 @@ void PlayFab::ClientModels::FGetCharacterInventoryResult::writeJSON(JsonWriter&
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (Inventory.Num() != 0)
@@ -8464,11 +8392,7 @@ bool PlayFab::ClientModels::FGetCharacterInventoryResult::readFromValue(const TS
     }
 
     const TArray<TSharedPtr<FJsonValue>>&InventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Inventory"));
-    for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(InventoryArray, Inventory);
 
 
     const TSharedPtr<FJsonObject>* VirtualCurrencyObject;
@@ -8484,6 +8408,7 @@ bool PlayFab::ClientModels::FGetCharacterInventoryResult::readFromValue(const TS
     const TSharedPtr<FJsonObject>* VirtualCurrencyRechargeTimesObject;
     if (obj->TryGetObjectField(TEXT("VirtualCurrencyRechargeTimes"), VirtualCurrencyRechargeTimesObject))
     {
+        VirtualCurrencyRechargeTimes.Reserve((*VirtualCurrencyRechargeTimesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
             VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
@@ -8578,11 +8503,7 @@ bool PlayFab::ClientModels::FGetCharacterLeaderboardResult::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     return HasSucceeded;
@@ -8604,7 +8525,7 @@ void PlayFab::ClientModels::FGetCharacterStatisticsRequest::writeJSON(JsonWriter
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -8983,7 +8904,7 @@ void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::writeJSON(
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (ProfileConstraints.IsValid())
@@ -9030,6 +8951,7 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9108,7 +9030,7 @@ void PlayFab::ClientModels::FPlayerLeaderboardEntry::writeJSON(JsonWriter& write
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("Position"));
@@ -9202,11 +9124,7 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::readFromVal
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     const TSharedPtr<FJsonValue> NextResetValue = obj->TryGetField(TEXT("NextReset"));
@@ -9304,6 +9222,7 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9412,6 +9331,7 @@ bool PlayFab::ClientModels::FGetFriendsListRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9462,11 +9382,7 @@ bool PlayFab::ClientModels::FGetFriendsListResult::readFromValue(const TSharedPt
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FriendsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Friends"));
-    for (int32 Idx = 0; Idx < FriendsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FriendsArray[Idx];
-        Friends.Add(FFriendInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FriendsArray, Friends);
 
 
     return HasSucceeded;
@@ -9488,7 +9404,7 @@ void PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::writeJSON(Jso
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (MaxResultsCount.notNull())
@@ -9564,11 +9480,7 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::readFromValue(
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     return HasSucceeded;
@@ -9604,7 +9516,7 @@ void PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::writeJSON(JsonWr
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (ProfileConstraints.IsValid())
@@ -9645,6 +9557,7 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9730,11 +9643,7 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     const TSharedPtr<FJsonValue> NextResetValue = obj->TryGetField(TEXT("NextReset"));
@@ -9814,11 +9723,7 @@ bool PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::readFromVal
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     return HasSucceeded;
@@ -9892,6 +9797,7 @@ bool PlayFab::ClientModels::FGetLeaderboardRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9977,11 +9883,7 @@ bool PlayFab::ClientModels::FGetLeaderboardResult::readFromValue(const TSharedPt
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     const TSharedPtr<FJsonValue> NextResetValue = obj->TryGetField(TEXT("NextReset"));
@@ -10350,7 +10252,7 @@ void PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -10363,6 +10265,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10571,19 +10474,11 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     }
 
     const TArray<TSharedPtr<FJsonValue>>&CharacterInventoriesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("CharacterInventories"));
-    for (int32 Idx = 0; Idx < CharacterInventoriesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CharacterInventoriesArray[Idx];
-        CharacterInventories.Add(FCharacterInventory(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CharacterInventoriesArray, CharacterInventories);
 
 
     const TArray<TSharedPtr<FJsonValue>>&CharacterListArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("CharacterList"));
-    for (int32 Idx = 0; Idx < CharacterListArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CharacterListArray[Idx];
-        CharacterList.Add(FCharacterResult(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CharacterListArray, CharacterList);
 
 
     const TSharedPtr<FJsonValue> PlayerProfileValue = obj->TryGetField(TEXT("PlayerProfile"));
@@ -10593,16 +10488,13 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PlayerStatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PlayerStatistics"));
-    for (int32 Idx = 0; Idx < PlayerStatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PlayerStatisticsArray[Idx];
-        PlayerStatistics.Add(FStatisticValue(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PlayerStatisticsArray, PlayerStatistics);
 
 
     const TSharedPtr<FJsonObject>* TitleDataObject;
     if (obj->TryGetObjectField(TEXT("TitleData"), TitleDataObject))
     {
+        TitleData.Reserve((*TitleDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TitleDataObject)->Values); It; ++It)
         {
             TitleData.Add(It.Key(), It.Value()->AsString());
@@ -10612,6 +10504,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     const TSharedPtr<FJsonObject>* UserDataObject;
     if (obj->TryGetObjectField(TEXT("UserData"), UserDataObject))
     {
+        UserData.Reserve((*UserDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserDataObject)->Values); It; ++It)
         {
             UserData.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
@@ -10626,16 +10519,13 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     }
 
     const TArray<TSharedPtr<FJsonValue>>&UserInventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("UserInventory"));
-    for (int32 Idx = 0; Idx < UserInventoryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = UserInventoryArray[Idx];
-        UserInventory.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(UserInventoryArray, UserInventory);
 
 
     const TSharedPtr<FJsonObject>* UserReadOnlyDataObject;
     if (obj->TryGetObjectField(TEXT("UserReadOnlyData"), UserReadOnlyDataObject))
     {
+        UserReadOnlyData.Reserve((*UserReadOnlyDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserReadOnlyDataObject)->Values); It; ++It)
         {
             UserReadOnlyData.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
@@ -10662,6 +10552,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     const TSharedPtr<FJsonObject>* UserVirtualCurrencyRechargeTimesObject;
     if (obj->TryGetObjectField(TEXT("UserVirtualCurrencyRechargeTimes"), UserVirtualCurrencyRechargeTimesObject))
     {
+        UserVirtualCurrencyRechargeTimes.Reserve((*UserVirtualCurrencyRechargeTimesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserVirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
             UserVirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
@@ -10690,7 +10581,7 @@ void PlayFab::ClientModels::FGetPlayerCombinedInfoResult::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -10818,7 +10709,7 @@ void PlayFab::ClientModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writ
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (ProfileConstraints.IsValid())
@@ -10837,6 +10728,7 @@ bool PlayFab::ClientModels::FGetPlayerProfileRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10998,11 +10890,7 @@ bool PlayFab::ClientModels::FGetPlayerSegmentsResult::readFromValue(const TShare
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&SegmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Segments"));
-    for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SegmentsArray, Segments);
 
 
     return HasSucceeded;
@@ -11102,6 +10990,7 @@ bool PlayFab::ClientModels::FGetPlayerStatisticsRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11111,11 +11000,7 @@ bool PlayFab::ClientModels::FGetPlayerStatisticsRequest::readFromValue(const TSh
     obj->TryGetStringArrayField(TEXT("StatisticNames"), StatisticNames);
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticNameVersionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("StatisticNameVersions"));
-    for (int32 Idx = 0; Idx < StatisticNameVersionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticNameVersionsArray[Idx];
-        StatisticNameVersions.Add(FStatisticNameVersion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticNameVersionsArray, StatisticNameVersions);
 
 
     return HasSucceeded;
@@ -11147,11 +11032,7 @@ bool PlayFab::ClientModels::FGetPlayerStatisticsResult::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticValue(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     return HasSucceeded;
@@ -11193,6 +11074,7 @@ bool PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11318,11 +11200,7 @@ bool PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticVersionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("StatisticVersions"));
-    for (int32 Idx = 0; Idx < StatisticVersionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticVersionsArray[Idx];
-        StatisticVersions.Add(FPlayerStatisticVersion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticVersionsArray, StatisticVersions);
 
 
     return HasSucceeded;
@@ -11361,7 +11239,7 @@ void PlayFab::ClientModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -11374,6 +11252,7 @@ bool PlayFab::ClientModels::FGetPlayerTagsRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11413,7 +11292,7 @@ void PlayFab::ClientModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("Tags"));
@@ -11503,19 +11382,11 @@ bool PlayFab::ClientModels::FGetPlayerTradesResponse::readFromValue(const TShare
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AcceptedTradesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AcceptedTrades"));
-    for (int32 Idx = 0; Idx < AcceptedTradesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AcceptedTradesArray[Idx];
-        AcceptedTrades.Add(FTradeInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AcceptedTradesArray, AcceptedTrades);
 
 
     const TArray<TSharedPtr<FJsonValue>>&OpenedTradesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("OpenedTrades"));
-    for (int32 Idx = 0; Idx < OpenedTradesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = OpenedTradesArray[Idx];
-        OpenedTrades.Add(FTradeInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(OpenedTradesArray, OpenedTrades);
 
 
     return HasSucceeded;
@@ -11574,11 +11445,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FFacebookPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11637,11 +11504,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::rea
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FFacebookInstantGamesPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11700,11 +11563,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::readFromValue
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FGameCenterPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11733,11 +11592,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&GenericIDsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GenericIDs"));
-    for (int32 Idx = 0; Idx < GenericIDsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GenericIDsArray[Idx];
-        GenericIDs.Add(FGenericServiceId(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GenericIDsArray, GenericIDs);
 
 
     return HasSucceeded;
@@ -11769,11 +11624,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::readFromValue(co
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FGenericPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11824,7 +11675,7 @@ void PlayFab::ClientModels::FGooglePlayFabIdPair::writeJSON(JsonWriter& writer)
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -11877,11 +11728,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FGooglePlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11932,7 +11779,7 @@ void PlayFab::ClientModels::FGooglePlayGamesPlayFabIdPair::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -11985,11 +11832,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGooglePlayGamesPlayerIDsResult::re
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FGooglePlayGamesPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12040,7 +11883,7 @@ void PlayFab::ClientModels::FKongregatePlayFabIdPair::writeJSON(JsonWriter& writ
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -12093,11 +11936,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::readFromValue
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FKongregatePlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12148,7 +11987,7 @@ void PlayFab::ClientModels::FNintendoServiceAccountPlayFabIdPair::writeJSON(Json
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -12201,11 +12040,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromNintendoServiceAccountIdsResult::r
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FNintendoServiceAccountPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12256,7 +12091,7 @@ void PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -12309,11 +12144,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::rea
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FNintendoSwitchPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12371,7 +12202,7 @@ void PlayFab::ClientModels::FPSNAccountPlayFabIdPair::writeJSON(JsonWriter& writ
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (PSNAccountId.IsEmpty() == false)
@@ -12430,11 +12261,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::readFromValue
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FPSNAccountPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12492,7 +12319,7 @@ void PlayFab::ClientModels::FPSNOnlinePlayFabIdPair::writeJSON(JsonWriter& write
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (PSNOnlineId.IsEmpty() == false)
@@ -12551,11 +12378,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromPSNOnlineIDsResult::readFromValue(
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FPSNOnlinePlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12603,7 +12426,7 @@ void PlayFab::ClientModels::FSteamPlayFabIdPair::writeJSON(JsonWriter& writer) c
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (SteamStringId.IsEmpty() == false)
@@ -12662,11 +12485,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::readFromValue(cons
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FSteamPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12711,7 +12530,7 @@ void PlayFab::ClientModels::FSteamNamePlayFabIdPair::writeJSON(JsonWriter& write
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (SteamName.IsEmpty() == false)
@@ -12770,11 +12589,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromSteamNamesResult::readFromValue(co
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FSteamNamePlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12819,7 +12634,7 @@ void PlayFab::ClientModels::FTwitchPlayFabIdPair::writeJSON(JsonWriter& writer)
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (TwitchId.IsEmpty() == false)
@@ -12878,11 +12693,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FTwitchPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12940,7 +12751,7 @@ void PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (XboxLiveAccountId.IsEmpty() == false)
@@ -12999,11 +12810,7 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FXboxLiveAccountPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -13066,6 +12873,7 @@ bool PlayFab::ClientModels::FGetPublisherDataResult::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -13350,6 +13158,7 @@ bool PlayFab::ClientModels::FGetSharedGroupDataResult::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), FSharedGroupDataRecord(It.Value()->AsObject()));
@@ -13489,19 +13298,19 @@ ClientModels::SourceType PlayFab::ClientModels::readSourceTypeFromValue(const TS
 
 ClientModels::SourceType PlayFab::ClientModels::readSourceTypeFromValue(const FString& value)
 {
-    static TMap<FString, SourceType> _SourceTypeMap;
-    if (_SourceTypeMap.Num() == 0)
+    static const TMap<FString, SourceType> _SourceTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _SourceTypeMap.Add(TEXT("Admin"), SourceTypeAdmin);
-        _SourceTypeMap.Add(TEXT("BackEnd"), SourceTypeBackEnd);
-        _SourceTypeMap.Add(TEXT("GameClient"), SourceTypeGameClient);
-        _SourceTypeMap.Add(TEXT("GameServer"), SourceTypeGameServer);
-        _SourceTypeMap.Add(TEXT("Partner"), SourceTypePartner);
-        _SourceTypeMap.Add(TEXT("Custom"), SourceTypeCustom);
-        _SourceTypeMap.Add(TEXT("API"), SourceTypeAPI);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SourceType> Map;
+        Map.Add(TEXT("Admin"), SourceTypeAdmin);
+        Map.Add(TEXT("BackEnd"), SourceTypeBackEnd);
+        Map.Add(TEXT("GameClient"), SourceTypeGameClient);
+        Map.Add(TEXT("GameServer"), SourceTypeGameServer);
+        Map.Add(TEXT("Partner"), SourceTypePartner);
+        Map.Add(TEXT("Custom"), SourceTypeCustom);
+        Map.Add(TEXT("API"), SourceTypeAPI);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -13682,11 +13491,7 @@ bool PlayFab::ClientModels::FGetStoreItemsResult::readFromValue(const TSharedPtr
     Source = readSourceTypeFromValue(obj->TryGetField(TEXT("Source")));
 
     const TArray<TSharedPtr<FJsonValue>>&StoreArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Store"));
-    for (int32 Idx = 0; Idx < StoreArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StoreArray[Idx];
-        Store.Add(FStoreItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StoreArray, Store);
 
 
     const TSharedPtr<FJsonValue> StoreIdValue = obj->TryGetField(TEXT("StoreId"));
@@ -13818,6 +13623,7 @@ bool PlayFab::ClientModels::FGetTitleDataResult::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -13951,11 +13757,7 @@ bool PlayFab::ClientModels::FGetTitleNewsResult::readFromValue(const TSharedPtr<
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&NewsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("News"));
-    for (int32 Idx = 0; Idx < NewsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = NewsArray[Idx];
-        News.Add(FTitleNewsItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(NewsArray, News);
 
 
     return HasSucceeded;
@@ -14158,7 +13960,7 @@ void PlayFab::ClientModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) c
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -14220,6 +14022,7 @@ bool PlayFab::ClientModels::FGetUserDataResult::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
@@ -14266,6 +14069,7 @@ bool PlayFab::ClientModels::FGetUserInventoryRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14323,11 +14127,7 @@ bool PlayFab::ClientModels::FGetUserInventoryResult::readFromValue(const TShared
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&InventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Inventory"));
-    for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(InventoryArray, Inventory);
 
 
     const TSharedPtr<FJsonObject>* VirtualCurrencyObject;
@@ -14343,6 +14143,7 @@ bool PlayFab::ClientModels::FGetUserInventoryResult::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* VirtualCurrencyRechargeTimesObject;
     if (obj->TryGetObjectField(TEXT("VirtualCurrencyRechargeTimes"), VirtualCurrencyRechargeTimesObject))
     {
+        VirtualCurrencyRechargeTimes.Reserve((*VirtualCurrencyRechargeTimesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
             VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
@@ -14422,6 +14223,7 @@ bool PlayFab::ClientModels::FGrantCharacterToUserRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14450,7 +14252,7 @@ void PlayFab::ClientModels::FGrantCharacterToUserResult::writeJSON(JsonWriter& w
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CharacterType.IsEmpty() == false)
@@ -14635,6 +14437,7 @@ bool PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14723,6 +14526,7 @@ bool PlayFab::ClientModels::FLinkAppleRequest::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14799,6 +14603,7 @@ bool PlayFab::ClientModels::FLinkCustomIDRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14887,6 +14692,7 @@ bool PlayFab::ClientModels::FLinkFacebookAccountRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14968,6 +14774,7 @@ bool PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15080,6 +14887,7 @@ bool PlayFab::ClientModels::FLinkGameCenterAccountRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15192,6 +15000,7 @@ bool PlayFab::ClientModels::FLinkGoogleAccountRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15280,6 +15089,7 @@ bool PlayFab::ClientModels::FLinkGooglePlayGamesServicesAccountRequest::readFrom
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15380,6 +15190,7 @@ bool PlayFab::ClientModels::FLinkIOSDeviceIDRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15499,6 +15310,7 @@ bool PlayFab::ClientModels::FLinkKongregateAccountRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15587,6 +15399,7 @@ bool PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15656,6 +15469,7 @@ bool PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15761,6 +15575,7 @@ bool PlayFab::ClientModels::FLinkOpenIdConnectRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15853,6 +15668,7 @@ bool PlayFab::ClientModels::FLinkPSNAccountRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15954,6 +15770,7 @@ bool PlayFab::ClientModels::FLinkSteamAccountRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16056,6 +15873,7 @@ bool PlayFab::ClientModels::FLinkTwitchAccountRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16137,6 +15955,7 @@ bool PlayFab::ClientModels::FLinkXboxAccountRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16227,11 +16046,7 @@ bool PlayFab::ClientModels::FListPlayerCustomPropertiesResult::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&PropertiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Properties"));
-    for (int32 Idx = 0; Idx < PropertiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PropertiesArray[Idx];
-        Properties.Add(FCustomPropertyDetails(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PropertiesArray, Properties);
 
 
     const TSharedPtr<FJsonValue> PropertiesVersionValue = obj->TryGetField(TEXT("PropertiesVersion"));
@@ -16256,7 +16071,7 @@ void PlayFab::ClientModels::FListUsersCharactersRequest::writeJSON(JsonWriter& w
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -16302,11 +16117,7 @@ bool PlayFab::ClientModels::FListUsersCharactersResult::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&CharactersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Characters"));
-    for (int32 Idx = 0; Idx < CharactersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CharactersArray[Idx];
-        Characters.Add(FCharacterResult(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CharactersArray, Characters);
 
 
     return HasSucceeded;
@@ -16445,11 +16256,7 @@ bool PlayFab::ClientModels::FTreatmentAssignment::readFromValue(const TSharedPtr
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&VariablesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Variables"));
-    for (int32 Idx = 0; Idx < VariablesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VariablesArray[Idx];
-        Variables.Add(FVariable(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VariablesArray, Variables);
 
 
     obj->TryGetStringArrayField(TEXT("Variants"), Variants);
@@ -16494,7 +16301,7 @@ void PlayFab::ClientModels::FLoginResult::writeJSON(JsonWriter& writer) const
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (SessionTicket.IsEmpty() == false)
@@ -16679,6 +16486,7 @@ bool PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16804,6 +16612,7 @@ bool PlayFab::ClientModels::FLoginWithAppleRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16932,6 +16741,7 @@ bool PlayFab::ClientModels::FLoginWithCustomIDRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17035,6 +16845,7 @@ bool PlayFab::ClientModels::FLoginWithEmailAddressRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17153,6 +16964,7 @@ bool PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17294,6 +17106,7 @@ bool PlayFab::ClientModels::FLoginWithFacebookRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17432,6 +17245,7 @@ bool PlayFab::ClientModels::FLoginWithGameCenterRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17587,6 +17401,7 @@ bool PlayFab::ClientModels::FLoginWithGoogleAccountRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17715,6 +17530,7 @@ bool PlayFab::ClientModels::FLoginWithGooglePlayGamesServicesRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17848,6 +17664,7 @@ bool PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17996,6 +17813,7 @@ bool PlayFab::ClientModels::FLoginWithKongregateRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18121,6 +17939,7 @@ bool PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18242,6 +18061,7 @@ bool PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18384,6 +18204,7 @@ bool PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18494,6 +18315,7 @@ bool PlayFab::ClientModels::FLoginWithPlayFabRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18627,6 +18449,7 @@ bool PlayFab::ClientModels::FLoginWithPSNRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18761,6 +18584,7 @@ bool PlayFab::ClientModels::FLoginWithSteamRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18896,6 +18720,7 @@ bool PlayFab::ClientModels::FLoginWithTwitchRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19010,6 +18835,7 @@ bool PlayFab::ClientModels::FLoginWithXboxRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19071,7 +18897,7 @@ void PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWrit
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (VirtualCurrency.IsEmpty() == false)
@@ -19275,6 +19101,7 @@ bool PlayFab::ClientModels::FPayForPurchaseRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19340,32 +19167,32 @@ ClientModels::TransactionStatus PlayFab::ClientModels::readTransactionStatusFrom
 
 ClientModels::TransactionStatus PlayFab::ClientModels::readTransactionStatusFromValue(const FString& value)
 {
-    static TMap<FString, TransactionStatus> _TransactionStatusMap;
-    if (_TransactionStatusMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _TransactionStatusMap.Add(TEXT("CreateCart"), TransactionStatusCreateCart);
-        _TransactionStatusMap.Add(TEXT("Init"), TransactionStatusInit);
-        _TransactionStatusMap.Add(TEXT("Approved"), TransactionStatusApproved);
-        _TransactionStatusMap.Add(TEXT("Succeeded"), TransactionStatusSucceeded);
-        _TransactionStatusMap.Add(TEXT("FailedByProvider"), TransactionStatusFailedByProvider);
-        _TransactionStatusMap.Add(TEXT("DisputePending"), TransactionStatusDisputePending);
-        _TransactionStatusMap.Add(TEXT("RefundPending"), TransactionStatusRefundPending);
-        _TransactionStatusMap.Add(TEXT("Refunded"), TransactionStatusRefunded);
-        _TransactionStatusMap.Add(TEXT("RefundFailed"), TransactionStatusRefundFailed);
-        _TransactionStatusMap.Add(TEXT("ChargedBack"), TransactionStatusChargedBack);
-        _TransactionStatusMap.Add(TEXT("FailedByUber"), TransactionStatusFailedByUber);
-        _TransactionStatusMap.Add(TEXT("FailedByPlayFab"), TransactionStatusFailedByPlayFab);
-        _TransactionStatusMap.Add(TEXT("Revoked"), TransactionStatusRevoked);
-        _TransactionStatusMap.Add(TEXT("TradePending"), TransactionStatusTradePending);
-        _TransactionStatusMap.Add(TEXT("Traded"), TransactionStatusTraded);
-        _TransactionStatusMap.Add(TEXT("Upgraded"), TransactionStatusUpgraded);
-        _TransactionStatusMap.Add(TEXT("StackPending"), TransactionStatusStackPending);
-        _TransactionStatusMap.Add(TEXT("Stacked"), TransactionStatusStacked);
-        _TransactionStatusMap.Add(TEXT("Other"), TransactionStatusOther);
-        _TransactionStatusMap.Add(TEXT("Failed"), TransactionStatusFailed);
-
-    }
+    static const TMap<FString, TransactionStatus> _TransactionStatusMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, TransactionStatus> Map;
+        Map.Add(TEXT("CreateCart"), TransactionStatusCreateCart);
+        Map.Add(TEXT("Init"), TransactionStatusInit);
+        Map.Add(TEXT("Approved"), TransactionStatusApproved);
+        Map.Add(TEXT("Succeeded"), TransactionStatusSucceeded);
+        Map.Add(TEXT("FailedByProvider"), TransactionStatusFailedByProvider);
+        Map.Add(TEXT("DisputePending"), TransactionStatusDisputePending);
+        Map.Add(TEXT("RefundPending"), TransactionStatusRefundPending);
+        Map.Add(TEXT("Refunded"), TransactionStatusRefunded);
+        Map.Add(TEXT("RefundFailed"), TransactionStatusRefundFailed);
+        Map.Add(TEXT("ChargedBack"), TransactionStatusChargedBack);
+        Map.Add(TEXT("FailedByUber"), TransactionStatusFailedByUber);
+        Map.Add(TEXT("FailedByPlayFab"), TransactionStatusFailedByPlayFab);
+        Map.Add(TEXT("Revoked"), TransactionStatusRevoked);
+        Map.Add(TEXT("TradePending"), TransactionStatusTradePending);
+        Map.Add(TEXT("Traded"), TransactionStatusTraded);
+        Map.Add(TEXT("Upgraded"), TransactionStatusUpgraded);
+        Map.Add(TEXT("StackPending"), TransactionStatusStackPending);
+        Map.Add(TEXT("Stacked"), TransactionStatusStacked);
+        Map.Add(TEXT("Other"), TransactionStatusOther);
+        Map.Add(TEXT("Failed"), TransactionStatusFailed);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -19614,7 +19441,7 @@ void PlayFab::ClientModels::FPurchaseItemRequest::writeJSON(JsonWriter& writer)
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -19681,6 +19508,7 @@ bool PlayFab::ClientModels::FPurchaseItemRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19744,11 +19572,7 @@ bool PlayFab::ClientModels::FPurchaseItemResult::readFromValue(const TSharedPtr<
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -19798,11 +19622,7 @@ bool PlayFab::ClientModels::FPurchaseReceiptFulfillment::readFromValue(const TSh
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FulfilledItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("FulfilledItems"));
-    for (int32 Idx = 0; Idx < FulfilledItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FulfilledItemsArray[Idx];
-        FulfilledItems.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FulfilledItemsArray, FulfilledItems);
 
 
     const TSharedPtr<FJsonValue> RecordedPriceSourceValue = obj->TryGetField(TEXT("RecordedPriceSource"));
@@ -19847,7 +19667,7 @@ void PlayFab::ClientModels::FRedeemCouponRequest::writeJSON(JsonWriter& writer)
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!CouponCode.IsEmpty() == false)
@@ -19902,6 +19722,7 @@ bool PlayFab::ClientModels::FRedeemCouponRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19937,11 +19758,7 @@ bool PlayFab::ClientModels::FRedeemCouponResult::readFromValue(const TSharedPtr<
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&GrantedItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GrantedItems"));
-    for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GrantedItemsArray, GrantedItems);
 
 
     return HasSucceeded;
@@ -20183,6 +20000,7 @@ bool PlayFab::ClientModels::FRegisterPlayFabUserRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20274,7 +20092,7 @@ void PlayFab::ClientModels::FRegisterPlayFabUserResult::writeJSON(JsonWriter& wr
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (SessionTicket.IsEmpty() == false)
@@ -20368,6 +20186,7 @@ bool PlayFab::ClientModels::FRemoveContactEmailRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20412,7 +20231,7 @@ void PlayFab::ClientModels::FRemoveFriendRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("FriendPlayFabId"));
-        writer->WriteValue(FriendPlayFabId);
+        writer->WriteValue(FriendPlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -20616,6 +20435,7 @@ bool PlayFab::ClientModels::FReportAdActivityRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20711,6 +20531,7 @@ bool PlayFab::ClientModels::FReportPlayerClientRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20809,6 +20630,7 @@ bool PlayFab::ClientModels::FRestoreIOSPurchasesRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20851,11 +20673,7 @@ bool PlayFab::ClientModels::FRestoreIOSPurchasesResult::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FulfillmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Fulfillments"));
-    for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FulfillmentsArray, Fulfillments);
 
 
     return HasSucceeded;
@@ -20911,6 +20729,7 @@ bool PlayFab::ClientModels::FRewardAdActivityRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21098,6 +20917,7 @@ bool PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21163,7 +20983,7 @@ void PlayFab::ClientModels::FSetFriendTagsRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("FriendPlayFabId"));
-        writer->WriteValue(FriendPlayFabId);
+        writer->WriteValue(FriendPlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("Tags"));
@@ -21329,6 +21149,7 @@ bool PlayFab::ClientModels::FStartPurchaseRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21336,11 +21157,7 @@ bool PlayFab::ClientModels::FStartPurchaseRequest::readFromValue(const TSharedPt
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemPurchaseRequest(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     const TSharedPtr<FJsonValue> StoreIdValue = obj->TryGetField(TEXT("StoreId"));
@@ -21405,11 +21222,7 @@ bool PlayFab::ClientModels::FStartPurchaseResult::readFromValue(const TSharedPtr
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ContentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Contents"));
-    for (int32 Idx = 0; Idx < ContentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContentsArray[Idx];
-        Contents.Add(FCartItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContentsArray, Contents);
 
 
     const TSharedPtr<FJsonValue> OrderIdValue = obj->TryGetField(TEXT("OrderId"));
@@ -21420,11 +21233,7 @@ bool PlayFab::ClientModels::FStartPurchaseResult::readFromValue(const TSharedPtr
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PaymentOptionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PaymentOptions"));
-    for (int32 Idx = 0; Idx < PaymentOptionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PaymentOptionsArray[Idx];
-        PaymentOptions.Add(FPaymentOption(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PaymentOptionsArray, PaymentOptions);
 
 
     const TSharedPtr<FJsonObject>* VirtualCurrencyBalancesObject;
@@ -21549,6 +21358,7 @@ bool PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21608,6 +21418,7 @@ bool PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21666,6 +21477,7 @@ bool PlayFab::ClientModels::FUnlinkAppleRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21718,6 +21530,7 @@ bool PlayFab::ClientModels::FUnlinkCustomIDRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21776,6 +21589,7 @@ bool PlayFab::ClientModels::FUnlinkFacebookAccountRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21840,6 +21654,7 @@ bool PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21905,6 +21720,7 @@ bool PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21963,6 +21779,7 @@ bool PlayFab::ClientModels::FUnlinkGoogleAccountRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22021,6 +21838,7 @@ bool PlayFab::ClientModels::FUnlinkGooglePlayGamesServicesAccountRequest::readFr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22085,6 +21903,7 @@ bool PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22150,6 +21969,7 @@ bool PlayFab::ClientModels::FUnlinkKongregateAccountRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22208,6 +22028,7 @@ bool PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22253,6 +22074,7 @@ bool PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22335,6 +22157,7 @@ bool PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22374,6 +22197,7 @@ bool PlayFab::ClientModels::FUnlinkPSNAccountRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22432,6 +22256,7 @@ bool PlayFab::ClientModels::FUnlinkSteamAccountRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22503,6 +22328,7 @@ bool PlayFab::ClientModels::FUnlinkTwitchAccountRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22561,6 +22387,7 @@ bool PlayFab::ClientModels::FUnlinkXboxAccountRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22607,7 +22434,7 @@ void PlayFab::ClientModels::FUnlockContainerInstanceRequest::writeJSON(JsonWrite
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ContainerItemInstanceId.IsEmpty() == false)
@@ -22617,7 +22444,7 @@ void PlayFab::ClientModels::FUnlockContainerInstanceRequest::writeJSON(JsonWrite
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ContainerItemInstanceId"));
-        writer->WriteValue(ContainerItemInstanceId);
+        writer->WriteValue(ContainerItemInstanceId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -22634,7 +22461,7 @@ void PlayFab::ClientModels::FUnlockContainerInstanceRequest::writeJSON(JsonWrite
     if (KeyItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("KeyItemInstanceId"));
-        writer->WriteValue(KeyItemInstanceId);
+        writer->WriteValue(KeyItemInstanceId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -22668,6 +22495,7 @@ bool PlayFab::ClientModels::FUnlockContainerInstanceRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22702,7 +22530,7 @@ void PlayFab::ClientModels::FUnlockContainerItemRequest::writeJSON(JsonWriter& w
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ContainerItemId.IsEmpty() == false)
@@ -22757,6 +22585,7 @@ bool PlayFab::ClientModels::FUnlockContainerItemRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22787,13 +22616,13 @@ void PlayFab::ClientModels::FUnlockContainerItemResult::writeJSON(JsonWriter& wr
     if (UnlockedItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("UnlockedItemInstanceId"));
-        writer->WriteValue(UnlockedItemInstanceId);
+        writer->WriteValue(UnlockedItemInstanceId.ToString());
     }
 
     if (UnlockedWithItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("UnlockedWithItemInstanceId"));
-        writer->WriteValue(UnlockedWithItemInstanceId);
+        writer->WriteValue(UnlockedWithItemInstanceId.ToString());
     }
 
     if (VirtualCurrency.Num() != 0)
@@ -22815,11 +22644,7 @@ bool PlayFab::ClientModels::FUnlockContainerItemResult::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&GrantedItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GrantedItems"));
-    for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GrantedItemsArray, GrantedItems);
 
 
     const TSharedPtr<FJsonValue> UnlockedItemInstanceIdValue = obj->TryGetField(TEXT("UnlockedItemInstanceId"));
@@ -22901,7 +22726,7 @@ void PlayFab::ClientModels::FUpdateCharacterDataRequest::writeJSON(JsonWriter& w
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -22958,6 +22783,7 @@ bool PlayFab::ClientModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -22967,6 +22793,7 @@ bool PlayFab::ClientModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -23025,7 +22852,7 @@ void PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonWri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CharacterStatistics.Num() != 0)
@@ -23077,6 +22904,7 @@ bool PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -23192,6 +23020,7 @@ bool PlayFab::ClientModels::FUpdatePlayerCustomPropertiesRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -23206,11 +23035,7 @@ bool PlayFab::ClientModels::FUpdatePlayerCustomPropertiesRequest::readFromValue(
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PropertiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Properties"));
-    for (int32 Idx = 0; Idx < PropertiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PropertiesArray[Idx];
-        Properties.Add(FUpdateProperty(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PropertiesArray, Properties);
 
 
     return HasSucceeded;
@@ -23281,6 +23106,7 @@ bool PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -23288,11 +23114,7 @@ bool PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::readFromValue(const
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticUpdate(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     return HasSucceeded;
@@ -23383,6 +23205,7 @@ bool PlayFab::ClientModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -23392,6 +23215,7 @@ bool PlayFab::ClientModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -23487,6 +23311,7 @@ bool PlayFab::ClientModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -23496,6 +23321,7 @@ bool PlayFab::ClientModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -23578,6 +23404,7 @@ bool PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -23705,6 +23532,7 @@ bool PlayFab::ClientModels::FValidateAmazonReceiptRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -23761,11 +23589,7 @@ bool PlayFab::ClientModels::FValidateAmazonReceiptResult::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FulfillmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Fulfillments"));
-    for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FulfillmentsArray, Fulfillments);
 
 
     return HasSucceeded;
@@ -23853,6 +23677,7 @@ bool PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -23909,11 +23734,7 @@ bool PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FulfillmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Fulfillments"));
-    for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FulfillmentsArray, Fulfillments);
 
 
     return HasSucceeded;
@@ -23988,6 +23809,7 @@ bool PlayFab::ClientModels::FValidateIOSReceiptRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -24037,11 +23859,7 @@ bool PlayFab::ClientModels::FValidateIOSReceiptResult::readFromValue(const TShar
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FulfillmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Fulfillments"));
-    for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FulfillmentsArray, Fulfillments);
 
 
     return HasSucceeded;
@@ -24120,6 +23938,7 @@ bool PlayFab::ClientModels::FValidateWindowsReceiptRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -24169,11 +23988,7 @@ bool PlayFab::ClientModels::FValidateWindowsReceiptResult::readFromValue(const T
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FulfillmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Fulfillments"));
-    for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FulfillmentsArray, Fulfillments);
 
 
     return HasSucceeded;
@@ -24206,7 +24021,7 @@ void PlayFab::ClientModels::FWriteClientCharacterEventRequest::writeJSON(JsonWri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -24246,6 +24061,7 @@ bool PlayFab::ClientModels::FWriteClientCharacterEventRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* BodyObject;
     if (obj->TryGetObjectField(TEXT("Body"), BodyObject))
     {
+        Body.Reserve((*BodyObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
             Body.Add(It.Key(), FJsonKeeper(It.Value()));
@@ -24262,6 +24078,7 @@ bool PlayFab::ClientModels::FWriteClientCharacterEventRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -24340,6 +24157,7 @@ bool PlayFab::ClientModels::FWriteClientPlayerEventRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* BodyObject;
     if (obj->TryGetObjectField(TEXT("Body"), BodyObject))
     {
+        Body.Reserve((*BodyObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
             Body.Add(It.Key(), FJsonKeeper(It.Value()));
@@ -24349,6 +24167,7 @@ bool PlayFab::ClientModels::FWriteClientPlayerEventRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -24459,6 +24278,7 @@ bool PlayFab::ClientModels::FWriteTitleEventRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* BodyObject;
     if (obj->TryGetObjectField(TEXT("Body"), BodyObject))
     {
+        Body.Reserve((*BodyObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
             Body.Add(It.Key(), FJsonKeeper(It.Value()));
@@ -24468,6 +24288,7 @@ bool PlayFab::ClientModels::FWriteTitleEventRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -24489,3 +24310,5 @@ bool PlayFab::ClientModels::FWriteTitleEventRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_CLIENT_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_CLIENT_API
 #include "Core/PlayFabClientInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -82,7 +83,7 @@ bool UPlayFabClientInstanceAPI::IsClientLoggedIn()
     return !this->GetOrCreateAuthenticationContext()->GetClientSessionTicket().IsEmpty();
 }
 
-bool UPlayFabClientInstanceAPI::AcceptTrade(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::AcceptTrade(
     ClientModels::FAcceptTradeRequest& request,
     const FAcceptTradeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,13 +91,13 @@ bool UPlayFabClientInstanceAPI::AcceptTrade(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AcceptTrade"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAcceptTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnAcceptTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -113,7 +114,7 @@ void UPlayFabClientInstanceAPI::OnAcceptTradeResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientInstanceAPI::AddFriend(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::AddFriend(
     ClientModels::FAddFriendRequest& request,
     const FAddFriendDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -121,13 +122,13 @@ bool UPlayFabClientInstanceAPI::AddFriend(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddFriend"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -144,7 +145,7 @@ void UPlayFabClientInstanceAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientInstanceAPI::AddGenericID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::AddGenericID(
     ClientModels::FAddGenericIDRequest& request,
     const FAddGenericIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -152,13 +153,13 @@ bool UPlayFabClientInstanceAPI::AddGenericID(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddGenericID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -175,7 +176,7 @@ void UPlayFabClientInstanceAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::AddOrUpdateContactEmail(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::AddOrUpdateContactEmail(
     ClientModels::FAddOrUpdateContactEmailRequest& request,
     const FAddOrUpdateContactEmailDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -183,13 +184,13 @@ bool UPlayFabClientInstanceAPI::AddOrUpdateContactEmail(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddOrUpdateContactEmail"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddOrUpdateContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnAddOrUpdateContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddOrUpdateContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -206,7 +207,7 @@ void UPlayFabClientInstanceAPI::OnAddOrUpdateContactEmailResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::AddSharedGroupMembers(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::AddSharedGroupMembers(
     ClientModels::FAddSharedGroupMembersRequest& request,
     const FAddSharedGroupMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -214,13 +215,13 @@ bool UPlayFabClientInstanceAPI::AddSharedGroupMembers(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -237,7 +238,7 @@ void UPlayFabClientInstanceAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::AddUsernamePassword(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::AddUsernamePassword(
     ClientModels::FAddUsernamePasswordRequest& request,
     const FAddUsernamePasswordDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -245,13 +246,13 @@ bool UPlayFabClientInstanceAPI::AddUsernamePassword(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddUsernamePassword"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddUsernamePasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnAddUsernamePasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUsernamePasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -268,7 +269,7 @@ void UPlayFabClientInstanceAPI::OnAddUsernamePasswordResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::AddUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::AddUserVirtualCurrency(
     ClientModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -276,13 +277,13 @@ bool UPlayFabClientInstanceAPI::AddUserVirtualCurrency(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -299,7 +300,7 @@ void UPlayFabClientInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientInstanceAPI::AndroidDevicePushNotificationRegistration(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::AndroidDevicePushNotificationRegistration(
     ClientModels::FAndroidDevicePushNotificationRegistrationRequest& request,
     const FAndroidDevicePushNotificationRegistrationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -307,13 +308,13 @@ bool UPlayFabClientInstanceAPI::AndroidDevicePushNotificationRegistration(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AndroidDevicePushNotificationRegistration"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAndroidDevicePushNotificationRegistrationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnAndroidDevicePushNotificationRegistrationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAndroidDevicePushNotificationRegistrationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -330,7 +331,7 @@ void UPlayFabClientInstanceAPI::OnAndroidDevicePushNotificationRegistrationResul
     }
 }
 
-bool UPlayFabClientInstanceAPI::AttributeInstall(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::AttributeInstall(
     ClientModels::FAttributeInstallRequest& request,
     const FAttributeInstallDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -338,13 +339,13 @@ bool UPlayFabClientInstanceAPI::AttributeInstall(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AttributeInstall"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAttributeInstallResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnAttributeInstallResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAttributeInstallDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -361,7 +362,7 @@ void UPlayFabClientInstanceAPI::OnAttributeInstallResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::CancelTrade(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::CancelTrade(
     ClientModels::FCancelTradeRequest& request,
     const FCancelTradeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -369,13 +370,13 @@ bool UPlayFabClientInstanceAPI::CancelTrade(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/CancelTrade"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnCancelTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnCancelTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -392,7 +393,7 @@ void UPlayFabClientInstanceAPI::OnCancelTradeResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientInstanceAPI::ConfirmPurchase(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ConfirmPurchase(
     ClientModels::FConfirmPurchaseRequest& request,
     const FConfirmPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -400,13 +401,13 @@ bool UPlayFabClientInstanceAPI::ConfirmPurchase(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConfirmPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConfirmPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnConfirmPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConfirmPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -423,7 +424,7 @@ void UPlayFabClientInstanceAPI::OnConfirmPurchaseResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::ConsumeItem(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ConsumeItem(
     ClientModels::FConsumeItemRequest& request,
     const FConsumeItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -431,13 +432,13 @@ bool UPlayFabClientInstanceAPI::ConsumeItem(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumeItem"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -454,7 +455,7 @@ void UPlayFabClientInstanceAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientInstanceAPI::ConsumeMicrosoftStoreEntitlements(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ConsumeMicrosoftStoreEntitlements(
     ClientModels::FConsumeMicrosoftStoreEntitlementsRequest& request,
     const FConsumeMicrosoftStoreEntitlementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -462,13 +463,13 @@ bool UPlayFabClientInstanceAPI::ConsumeMicrosoftStoreEntitlements(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumeMicrosoftStoreEntitlements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumeMicrosoftStoreEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnConsumeMicrosoftStoreEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeMicrosoftStoreEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -485,7 +486,7 @@ void UPlayFabClientInstanceAPI::OnConsumeMicrosoftStoreEntitlementsResult(FHttpR
     }
 }
 
-bool UPlayFabClientInstanceAPI::ConsumePS5Entitlements(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ConsumePS5Entitlements(
     ClientModels::FConsumePS5EntitlementsRequest& request,
     const FConsumePS5EntitlementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -493,13 +494,13 @@ bool UPlayFabClientInstanceAPI::ConsumePS5Entitlements(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumePS5Entitlements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumePS5EntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnConsumePS5EntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePS5EntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -516,7 +517,7 @@ void UPlayFabClientInstanceAPI::OnConsumePS5EntitlementsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientInstanceAPI::ConsumePSNEntitlements(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ConsumePSNEntitlements(
     ClientModels::FConsumePSNEntitlementsRequest& request,
     const FConsumePSNEntitlementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -524,13 +525,13 @@ bool UPlayFabClientInstanceAPI::ConsumePSNEntitlements(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumePSNEntitlements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumePSNEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnConsumePSNEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePSNEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -547,7 +548,7 @@ void UPlayFabClientInstanceAPI::OnConsumePSNEntitlementsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientInstanceAPI::ConsumeXboxEntitlements(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ConsumeXboxEntitlements(
     ClientModels::FConsumeXboxEntitlementsRequest& request,
     const FConsumeXboxEntitlementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -555,13 +556,13 @@ bool UPlayFabClientInstanceAPI::ConsumeXboxEntitlements(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumeXboxEntitlements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumeXboxEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnConsumeXboxEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeXboxEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -578,7 +579,7 @@ void UPlayFabClientInstanceAPI::OnConsumeXboxEntitlementsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::CreateSharedGroup(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::CreateSharedGroup(
     ClientModels::FCreateSharedGroupRequest& request,
     const FCreateSharedGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -586,13 +587,13 @@ bool UPlayFabClientInstanceAPI::CreateSharedGroup(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/CreateSharedGroup"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -609,7 +610,7 @@ void UPlayFabClientInstanceAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::DeletePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::DeletePlayerCustomProperties(
     ClientModels::FDeletePlayerCustomPropertiesRequest& request,
     const FDeletePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -617,13 +618,13 @@ bool UPlayFabClientInstanceAPI::DeletePlayerCustomProperties(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/DeletePlayerCustomProperties"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnDeletePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnDeletePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -640,7 +641,7 @@ void UPlayFabClientInstanceAPI::OnDeletePlayerCustomPropertiesResult(FHttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::ExecuteCloudScript(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ExecuteCloudScript(
     ClientModels::FExecuteCloudScriptRequest& request,
     const FExecuteCloudScriptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -648,13 +649,13 @@ bool UPlayFabClientInstanceAPI::ExecuteCloudScript(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ExecuteCloudScript"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -671,7 +672,7 @@ void UPlayFabClientInstanceAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetAccountInfo(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetAccountInfo(
     ClientModels::FGetAccountInfoRequest& request,
     const FGetAccountInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -679,13 +680,13 @@ bool UPlayFabClientInstanceAPI::GetAccountInfo(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetAccountInfo"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -702,7 +703,7 @@ void UPlayFabClientInstanceAPI::OnGetAccountInfoResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetAdPlacements(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetAdPlacements(
     ClientModels::FGetAdPlacementsRequest& request,
     const FGetAdPlacementsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -710,13 +711,13 @@ bool UPlayFabClientInstanceAPI::GetAdPlacements(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetAdPlacements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetAdPlacementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetAdPlacementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAdPlacementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -733,7 +734,7 @@ void UPlayFabClientInstanceAPI::OnGetAdPlacementsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetAllUsersCharacters(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetAllUsersCharacters(
     ClientModels::FListUsersCharactersRequest& request,
     const FGetAllUsersCharactersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -741,13 +742,13 @@ bool UPlayFabClientInstanceAPI::GetAllUsersCharacters(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetAllUsersCharacters"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllUsersCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -764,7 +765,7 @@ void UPlayFabClientInstanceAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetCatalogItems(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetCatalogItems(
     ClientModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -772,13 +773,13 @@ bool UPlayFabClientInstanceAPI::GetCatalogItems(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCatalogItems"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -795,7 +796,7 @@ void UPlayFabClientInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetCharacterData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetCharacterData(
     ClientModels::FGetCharacterDataRequest& request,
     const FGetCharacterDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -803,13 +804,13 @@ bool UPlayFabClientInstanceAPI::GetCharacterData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -826,7 +827,7 @@ void UPlayFabClientInstanceAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetCharacterInventory(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetCharacterInventory(
     ClientModels::FGetCharacterInventoryRequest& request,
     const FGetCharacterInventoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -834,13 +835,13 @@ bool UPlayFabClientInstanceAPI::GetCharacterInventory(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterInventory"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -857,7 +858,7 @@ void UPlayFabClientInstanceAPI::OnGetCharacterInventoryResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetCharacterLeaderboard(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetCharacterLeaderboard(
     ClientModels::FGetCharacterLeaderboardRequest& request,
     const FGetCharacterLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -865,13 +866,13 @@ bool UPlayFabClientInstanceAPI::GetCharacterLeaderboard(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -888,7 +889,7 @@ void UPlayFabClientInstanceAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetCharacterReadOnlyData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetCharacterReadOnlyData(
     ClientModels::FGetCharacterDataRequest& request,
     const FGetCharacterReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -896,13 +897,13 @@ bool UPlayFabClientInstanceAPI::GetCharacterReadOnlyData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -919,7 +920,7 @@ void UPlayFabClientInstanceAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetCharacterStatistics(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetCharacterStatistics(
     ClientModels::FGetCharacterStatisticsRequest& request,
     const FGetCharacterStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -927,13 +928,13 @@ bool UPlayFabClientInstanceAPI::GetCharacterStatistics(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -950,7 +951,7 @@ void UPlayFabClientInstanceAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetContentDownloadUrl(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetContentDownloadUrl(
     ClientModels::FGetContentDownloadUrlRequest& request,
     const FGetContentDownloadUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -958,13 +959,13 @@ bool UPlayFabClientInstanceAPI::GetContentDownloadUrl(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetContentDownloadUrl"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -981,7 +982,7 @@ void UPlayFabClientInstanceAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetFriendLeaderboard(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetFriendLeaderboard(
     ClientModels::FGetFriendLeaderboardRequest& request,
     const FGetFriendLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -989,13 +990,13 @@ bool UPlayFabClientInstanceAPI::GetFriendLeaderboard(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetFriendLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1012,7 +1013,7 @@ void UPlayFabClientInstanceAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetFriendLeaderboardAroundPlayer(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetFriendLeaderboardAroundPlayer(
     ClientModels::FGetFriendLeaderboardAroundPlayerRequest& request,
     const FGetFriendLeaderboardAroundPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1020,13 +1021,13 @@ bool UPlayFabClientInstanceAPI::GetFriendLeaderboardAroundPlayer(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetFriendLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetFriendLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetFriendLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1043,7 +1044,7 @@ void UPlayFabClientInstanceAPI::OnGetFriendLeaderboardAroundPlayerResult(FHttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetFriendsList(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetFriendsList(
     ClientModels::FGetFriendsListRequest& request,
     const FGetFriendsListDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1051,13 +1052,13 @@ bool UPlayFabClientInstanceAPI::GetFriendsList(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetFriendsList"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetFriendsListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendsListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1074,7 +1075,7 @@ void UPlayFabClientInstanceAPI::OnGetFriendsListResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetLeaderboard(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetLeaderboard(
     ClientModels::FGetLeaderboardRequest& request,
     const FGetLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1082,13 +1083,13 @@ bool UPlayFabClientInstanceAPI::GetLeaderboard(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1105,7 +1106,7 @@ void UPlayFabClientInstanceAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetLeaderboardAroundCharacter(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetLeaderboardAroundCharacter(
     ClientModels::FGetLeaderboardAroundCharacterRequest& request,
     const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1113,13 +1114,13 @@ bool UPlayFabClientInstanceAPI::GetLeaderboardAroundCharacter(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboardAroundCharacter"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetLeaderboardAroundCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1136,7 +1137,7 @@ void UPlayFabClientInstanceAPI::OnGetLeaderboardAroundCharacterResult(FHttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetLeaderboardAroundPlayer(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetLeaderboardAroundPlayer(
     ClientModels::FGetLeaderboardAroundPlayerRequest& request,
     const FGetLeaderboardAroundPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1144,13 +1145,13 @@ bool UPlayFabClientInstanceAPI::GetLeaderboardAroundPlayer(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1167,7 +1168,7 @@ void UPlayFabClientInstanceAPI::OnGetLeaderboardAroundPlayerResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetLeaderboardForUserCharacters(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetLeaderboardForUserCharacters(
     ClientModels::FGetLeaderboardForUsersCharactersRequest& request,
     const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1175,13 +1176,13 @@ bool UPlayFabClientInstanceAPI::GetLeaderboardForUserCharacters(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboardForUserCharacters"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetLeaderboardForUserCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForUserCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1198,7 +1199,7 @@ void UPlayFabClientInstanceAPI::OnGetLeaderboardForUserCharactersResult(FHttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPaymentToken(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPaymentToken(
     ClientModels::FGetPaymentTokenRequest& request,
     const FGetPaymentTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1206,13 +1207,13 @@ bool UPlayFabClientInstanceAPI::GetPaymentToken(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPaymentToken"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPaymentTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPaymentTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPaymentTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1229,7 +1230,7 @@ void UPlayFabClientInstanceAPI::OnGetPaymentTokenResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPhotonAuthenticationToken(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPhotonAuthenticationToken(
     ClientModels::FGetPhotonAuthenticationTokenRequest& request,
     const FGetPhotonAuthenticationTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1237,13 +1238,13 @@ bool UPlayFabClientInstanceAPI::GetPhotonAuthenticationToken(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPhotonAuthenticationToken"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPhotonAuthenticationTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPhotonAuthenticationTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPhotonAuthenticationTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1260,7 +1261,7 @@ void UPlayFabClientInstanceAPI::OnGetPhotonAuthenticationTokenResult(FHttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayerCombinedInfo(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayerCombinedInfo(
     ClientModels::FGetPlayerCombinedInfoRequest& request,
     const FGetPlayerCombinedInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1268,13 +1269,13 @@ bool UPlayFabClientInstanceAPI::GetPlayerCombinedInfo(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerCombinedInfo"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCombinedInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1291,7 +1292,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayerCustomProperty(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayerCustomProperty(
     ClientModels::FGetPlayerCustomPropertyRequest& request,
     const FGetPlayerCustomPropertyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1299,13 +1300,13 @@ bool UPlayFabClientInstanceAPI::GetPlayerCustomProperty(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerCustomProperty"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerCustomPropertyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCustomPropertyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1322,7 +1323,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayerProfile(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayerProfile(
     ClientModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1330,13 +1331,13 @@ bool UPlayFabClientInstanceAPI::GetPlayerProfile(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerProfile"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1353,7 +1354,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayerSegments(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayerSegments(
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -1361,7 +1362,7 @@ bool UPlayFabClientInstanceAPI::GetPlayerSegments(
     return UPlayFabClientInstanceAPI::GetPlayerSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayerSegments(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayerSegments(
     ClientModels::FGetPlayerSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1369,13 +1370,13 @@ bool UPlayFabClientInstanceAPI::GetPlayerSegments(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerSegments"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1392,7 +1393,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayerStatistics(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayerStatistics(
     ClientModels::FGetPlayerStatisticsRequest& request,
     const FGetPlayerStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1400,13 +1401,13 @@ bool UPlayFabClientInstanceAPI::GetPlayerStatistics(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1423,7 +1424,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayerStatisticVersions(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayerStatisticVersions(
     ClientModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1431,13 +1432,13 @@ bool UPlayFabClientInstanceAPI::GetPlayerStatisticVersions(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1454,7 +1455,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayerTags(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayerTags(
     ClientModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1462,13 +1463,13 @@ bool UPlayFabClientInstanceAPI::GetPlayerTags(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerTags"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1485,7 +1486,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayerTrades(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayerTrades(
     ClientModels::FGetPlayerTradesRequest& request,
     const FGetPlayerTradesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1493,13 +1494,13 @@ bool UPlayFabClientInstanceAPI::GetPlayerTrades(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerTrades"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerTradesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerTradesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTradesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1516,7 +1517,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayerTradesResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookIDs(
     ClientModels::FGetPlayFabIDsFromFacebookIDsRequest& request,
     const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1524,13 +1525,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromFacebookIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1547,7 +1548,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request,
     const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1555,13 +1556,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1578,7 +1579,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGameCenterIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromGameCenterIDs(
     ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest& request,
     const FGetPlayFabIDsFromGameCenterIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1586,13 +1587,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGameCenterIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGameCenterIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGameCenterIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGameCenterIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGameCenterIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1609,7 +1610,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGameCenterIDsResult(FHttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGenericIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromGenericIDs(
     ClientModels::FGetPlayFabIDsFromGenericIDsRequest& request,
     const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1617,13 +1618,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGenericIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGenericIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGenericIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1640,7 +1641,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGoogleIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromGoogleIDs(
     ClientModels::FGetPlayFabIDsFromGoogleIDsRequest& request,
     const FGetPlayFabIDsFromGoogleIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1648,13 +1649,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGoogleIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGoogleIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGoogleIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGoogleIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGoogleIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1671,7 +1672,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGoogleIDsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGooglePlayGamesPlayerIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromGooglePlayGamesPlayerIDs(
     ClientModels::FGetPlayFabIDsFromGooglePlayGamesPlayerIDsRequest& request,
     const FGetPlayFabIDsFromGooglePlayGamesPlayerIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1679,13 +1680,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGooglePlayGamesPlayerIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGooglePlayGamesPlayerIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGooglePlayGamesPlayerIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGooglePlayGamesPlayerIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGooglePlayGamesPlayerIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1702,7 +1703,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGooglePlayGamesPlayerIDsResul
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromKongregateIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromKongregateIDs(
     ClientModels::FGetPlayFabIDsFromKongregateIDsRequest& request,
     const FGetPlayFabIDsFromKongregateIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1710,13 +1711,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromKongregateIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromKongregateIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromKongregateIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromKongregateIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromKongregateIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1733,7 +1734,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromKongregateIDsResult(FHttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
     ClientModels::FGetPlayFabIDsFromNintendoServiceAccountIdsRequest& request,
     const FGetPlayFabIDsFromNintendoServiceAccountIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1741,13 +1742,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromNintendoServiceAccountIds"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoServiceAccountIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1764,7 +1765,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResu
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request,
     const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1772,13 +1773,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1795,7 +1796,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
     ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request,
     const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1803,13 +1804,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNAccountIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1826,7 +1827,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNOnlineIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNOnlineIDs(
     ClientModels::FGetPlayFabIDsFromPSNOnlineIDsRequest& request,
     const FGetPlayFabIDsFromPSNOnlineIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1834,13 +1835,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNOnlineIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromPSNOnlineIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromPSNOnlineIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromPSNOnlineIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNOnlineIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1857,7 +1858,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromPSNOnlineIDsResult(FHttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamIDs(
     ClientModels::FGetPlayFabIDsFromSteamIDsRequest& request,
     const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1865,13 +1866,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromSteamIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1888,7 +1889,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamNames(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamNames(
     ClientModels::FGetPlayFabIDsFromSteamNamesRequest& request,
     const FGetPlayFabIDsFromSteamNamesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1896,13 +1897,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamNames(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromSteamNames"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromSteamNamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromSteamNamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamNamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1919,7 +1920,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromSteamNamesResult(FHttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromTwitchIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromTwitchIDs(
     ClientModels::FGetPlayFabIDsFromTwitchIDsRequest& request,
     const FGetPlayFabIDsFromTwitchIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1927,13 +1928,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromTwitchIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromTwitchIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromTwitchIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromTwitchIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromTwitchIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1950,7 +1951,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromTwitchIDsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
     ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request,
     const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1958,13 +1959,13 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1981,7 +1982,7 @@ void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPublisherData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPublisherData(
     ClientModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1989,13 +1990,13 @@ bool UPlayFabClientInstanceAPI::GetPublisherData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPublisherData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2012,7 +2013,7 @@ void UPlayFabClientInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetPurchase(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetPurchase(
     ClientModels::FGetPurchaseRequest& request,
     const FGetPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2020,13 +2021,13 @@ bool UPlayFabClientInstanceAPI::GetPurchase(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2043,7 +2044,7 @@ void UPlayFabClientInstanceAPI::OnGetPurchaseResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetSharedGroupData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetSharedGroupData(
     ClientModels::FGetSharedGroupDataRequest& request,
     const FGetSharedGroupDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2051,13 +2052,13 @@ bool UPlayFabClientInstanceAPI::GetSharedGroupData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2074,7 +2075,7 @@ void UPlayFabClientInstanceAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetStoreItems(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetStoreItems(
     ClientModels::FGetStoreItemsRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2082,13 +2083,13 @@ bool UPlayFabClientInstanceAPI::GetStoreItems(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetStoreItems"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2105,7 +2106,7 @@ void UPlayFabClientInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetTime(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetTime(
     const FGetTimeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -2113,7 +2114,7 @@ bool UPlayFabClientInstanceAPI::GetTime(
     return UPlayFabClientInstanceAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabClientInstanceAPI::GetTime(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetTime(
     ClientModels::FGetTimeRequest& request,
     const FGetTimeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2121,13 +2122,13 @@ bool UPlayFabClientInstanceAPI::GetTime(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTime"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTimeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2144,7 +2145,7 @@ void UPlayFabClientInstanceAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetTitleData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetTitleData(
     ClientModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2152,13 +2153,13 @@ bool UPlayFabClientInstanceAPI::GetTitleData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTitleData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2175,7 +2176,7 @@ void UPlayFabClientInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetTitleNews(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetTitleNews(
     ClientModels::FGetTitleNewsRequest& request,
     const FGetTitleNewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2183,13 +2184,13 @@ bool UPlayFabClientInstanceAPI::GetTitleNews(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTitleNews"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2206,7 +2207,7 @@ void UPlayFabClientInstanceAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetTitlePublicKey(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetTitlePublicKey(
     ClientModels::FGetTitlePublicKeyRequest& request,
     const FGetTitlePublicKeyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2216,7 +2217,7 @@ bool UPlayFabClientInstanceAPI::GetTitlePublicKey(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTitlePublicKey"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTitlePublicKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetTitlePublicKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePublicKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2233,7 +2234,7 @@ void UPlayFabClientInstanceAPI::OnGetTitlePublicKeyResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetTradeStatus(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetTradeStatus(
     ClientModels::FGetTradeStatusRequest& request,
     const FGetTradeStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2241,13 +2242,13 @@ bool UPlayFabClientInstanceAPI::GetTradeStatus(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTradeStatus"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTradeStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetTradeStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTradeStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2264,7 +2265,7 @@ void UPlayFabClientInstanceAPI::OnGetTradeStatusResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetUserData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetUserData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2272,13 +2273,13 @@ bool UPlayFabClientInstanceAPI::GetUserData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2295,7 +2296,7 @@ void UPlayFabClientInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetUserInventory(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetUserInventory(
     ClientModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2303,13 +2304,13 @@ bool UPlayFabClientInstanceAPI::GetUserInventory(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserInventory"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2326,7 +2327,7 @@ void UPlayFabClientInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetUserPublisherData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetUserPublisherData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2334,13 +2335,13 @@ bool UPlayFabClientInstanceAPI::GetUserPublisherData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2357,7 +2358,7 @@ void UPlayFabClientInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetUserPublisherReadOnlyData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetUserPublisherReadOnlyData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2365,13 +2366,13 @@ bool UPlayFabClientInstanceAPI::GetUserPublisherReadOnlyData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2388,7 +2389,7 @@ void UPlayFabClientInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::GetUserReadOnlyData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GetUserReadOnlyData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2396,13 +2397,13 @@ bool UPlayFabClientInstanceAPI::GetUserReadOnlyData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2419,7 +2420,7 @@ void UPlayFabClientInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::GrantCharacterToUser(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::GrantCharacterToUser(
     ClientModels::FGrantCharacterToUserRequest& request,
     const FGrantCharacterToUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2427,13 +2428,13 @@ bool UPlayFabClientInstanceAPI::GrantCharacterToUser(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GrantCharacterToUser"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnGrantCharacterToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantCharacterToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2450,7 +2451,7 @@ void UPlayFabClientInstanceAPI::OnGrantCharacterToUserResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkAndroidDeviceID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkAndroidDeviceID(
     ClientModels::FLinkAndroidDeviceIDRequest& request,
     const FLinkAndroidDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2458,13 +2459,13 @@ bool UPlayFabClientInstanceAPI::LinkAndroidDeviceID(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2481,7 +2482,7 @@ void UPlayFabClientInstanceAPI::OnLinkAndroidDeviceIDResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkApple(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkApple(
     ClientModels::FLinkAppleRequest& request,
     const FLinkAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2489,13 +2490,13 @@ bool UPlayFabClientInstanceAPI::LinkApple(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkApple"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2512,7 +2513,7 @@ void UPlayFabClientInstanceAPI::OnLinkAppleResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkCustomID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkCustomID(
     ClientModels::FLinkCustomIDRequest& request,
     const FLinkCustomIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2520,13 +2521,13 @@ bool UPlayFabClientInstanceAPI::LinkCustomID(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2543,7 +2544,7 @@ void UPlayFabClientInstanceAPI::OnLinkCustomIDResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkFacebookAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkFacebookAccount(
     ClientModels::FLinkFacebookAccountRequest& request,
     const FLinkFacebookAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2551,13 +2552,13 @@ bool UPlayFabClientInstanceAPI::LinkFacebookAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2574,7 +2575,7 @@ void UPlayFabClientInstanceAPI::OnLinkFacebookAccountResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkFacebookInstantGamesId(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkFacebookInstantGamesId(
     ClientModels::FLinkFacebookInstantGamesIdRequest& request,
     const FLinkFacebookInstantGamesIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2582,13 +2583,13 @@ bool UPlayFabClientInstanceAPI::LinkFacebookInstantGamesId(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2605,7 +2606,7 @@ void UPlayFabClientInstanceAPI::OnLinkFacebookInstantGamesIdResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkGameCenterAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkGameCenterAccount(
     ClientModels::FLinkGameCenterAccountRequest& request,
     const FLinkGameCenterAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2613,13 +2614,13 @@ bool UPlayFabClientInstanceAPI::LinkGameCenterAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2636,7 +2637,7 @@ void UPlayFabClientInstanceAPI::OnLinkGameCenterAccountResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkGoogleAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkGoogleAccount(
     ClientModels::FLinkGoogleAccountRequest& request,
     const FLinkGoogleAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2644,13 +2645,13 @@ bool UPlayFabClientInstanceAPI::LinkGoogleAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2667,7 +2668,7 @@ void UPlayFabClientInstanceAPI::OnLinkGoogleAccountResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkGooglePlayGamesServicesAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkGooglePlayGamesServicesAccount(
     ClientModels::FLinkGooglePlayGamesServicesAccountRequest& request,
     const FLinkGooglePlayGamesServicesAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2675,13 +2676,13 @@ bool UPlayFabClientInstanceAPI::LinkGooglePlayGamesServicesAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkGooglePlayGamesServicesAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkGooglePlayGamesServicesAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkGooglePlayGamesServicesAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGooglePlayGamesServicesAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2698,7 +2699,7 @@ void UPlayFabClientInstanceAPI::OnLinkGooglePlayGamesServicesAccountResult(FHttp
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkIOSDeviceID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkIOSDeviceID(
     ClientModels::FLinkIOSDeviceIDRequest& request,
     const FLinkIOSDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2706,13 +2707,13 @@ bool UPlayFabClientInstanceAPI::LinkIOSDeviceID(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2729,7 +2730,7 @@ void UPlayFabClientInstanceAPI::OnLinkIOSDeviceIDResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkKongregate(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkKongregate(
     ClientModels::FLinkKongregateAccountRequest& request,
     const FLinkKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2737,13 +2738,13 @@ bool UPlayFabClientInstanceAPI::LinkKongregate(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2760,7 +2761,7 @@ void UPlayFabClientInstanceAPI::OnLinkKongregateResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkNintendoServiceAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkNintendoServiceAccount(
     ClientModels::FLinkNintendoServiceAccountRequest& request,
     const FLinkNintendoServiceAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2768,13 +2769,13 @@ bool UPlayFabClientInstanceAPI::LinkNintendoServiceAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2791,7 +2792,7 @@ void UPlayFabClientInstanceAPI::OnLinkNintendoServiceAccountResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkNintendoSwitchDeviceId(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkNintendoSwitchDeviceId(
     ClientModels::FLinkNintendoSwitchDeviceIdRequest& request,
     const FLinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2799,13 +2800,13 @@ bool UPlayFabClientInstanceAPI::LinkNintendoSwitchDeviceId(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2822,7 +2823,7 @@ void UPlayFabClientInstanceAPI::OnLinkNintendoSwitchDeviceIdResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkOpenIdConnect(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkOpenIdConnect(
     ClientModels::FLinkOpenIdConnectRequest& request,
     const FLinkOpenIdConnectDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2830,13 +2831,13 @@ bool UPlayFabClientInstanceAPI::LinkOpenIdConnect(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2853,7 +2854,7 @@ void UPlayFabClientInstanceAPI::OnLinkOpenIdConnectResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkPSNAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkPSNAccount(
     ClientModels::FLinkPSNAccountRequest& request,
     const FLinkPSNAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2861,13 +2862,13 @@ bool UPlayFabClientInstanceAPI::LinkPSNAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2884,7 +2885,7 @@ void UPlayFabClientInstanceAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkSteamAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkSteamAccount(
     ClientModels::FLinkSteamAccountRequest& request,
     const FLinkSteamAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2892,13 +2893,13 @@ bool UPlayFabClientInstanceAPI::LinkSteamAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2915,7 +2916,7 @@ void UPlayFabClientInstanceAPI::OnLinkSteamAccountResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkTwitch(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkTwitch(
     ClientModels::FLinkTwitchAccountRequest& request,
     const FLinkTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2923,13 +2924,13 @@ bool UPlayFabClientInstanceAPI::LinkTwitch(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2946,7 +2947,7 @@ void UPlayFabClientInstanceAPI::OnLinkTwitchResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientInstanceAPI::LinkXboxAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LinkXboxAccount(
     ClientModels::FLinkXboxAccountRequest& request,
     const FLinkXboxAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2954,13 +2955,13 @@ bool UPlayFabClientInstanceAPI::LinkXboxAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2977,7 +2978,7 @@ void UPlayFabClientInstanceAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::ListPlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ListPlayerCustomProperties(
     const FListPlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -2985,7 +2986,7 @@ bool UPlayFabClientInstanceAPI::ListPlayerCustomProperties(
     return UPlayFabClientInstanceAPI::ListPlayerCustomProperties(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabClientInstanceAPI::ListPlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ListPlayerCustomProperties(
     ClientModels::FListPlayerCustomPropertiesRequest& request,
     const FListPlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2993,13 +2994,13 @@ bool UPlayFabClientInstanceAPI::ListPlayerCustomProperties(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ListPlayerCustomProperties"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnListPlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnListPlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListPlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3016,7 +3017,7 @@ void UPlayFabClientInstanceAPI::OnListPlayerCustomPropertiesResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithAndroidDeviceID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithAndroidDeviceID(
     ClientModels::FLoginWithAndroidDeviceIDRequest& request,
     const FLoginWithAndroidDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3028,7 +3029,7 @@ bool UPlayFabClientInstanceAPI::LoginWithAndroidDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithAndroidDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3046,9 +3047,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3060,7 +3061,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithApple(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithApple(
     ClientModels::FLoginWithAppleRequest& request,
     const FLoginWithAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3072,7 +3073,7 @@ bool UPlayFabClientInstanceAPI::LoginWithApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithApple"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3090,9 +3091,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpReque
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3104,7 +3105,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithCustomID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithCustomID(
     ClientModels::FLoginWithCustomIDRequest& request,
     const FLoginWithCustomIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3116,7 +3117,7 @@ bool UPlayFabClientInstanceAPI::LoginWithCustomID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithCustomID"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3134,9 +3135,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRe
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3148,7 +3149,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithEmailAddress(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithEmailAddress(
     ClientModels::FLoginWithEmailAddressRequest& request,
     const FLoginWithEmailAddressDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3160,7 +3161,7 @@ bool UPlayFabClientInstanceAPI::LoginWithEmailAddress(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithEmailAddress"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithEmailAddressResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithEmailAddressDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3178,9 +3179,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr Ht
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3192,7 +3193,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithFacebook(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithFacebook(
     ClientModels::FLoginWithFacebookRequest& request,
     const FLoginWithFacebookDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3204,7 +3205,7 @@ bool UPlayFabClientInstanceAPI::LoginWithFacebook(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithFacebook"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3222,9 +3223,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRe
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3236,7 +3237,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithFacebookInstantGamesId(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithFacebookInstantGamesId(
     ClientModels::FLoginWithFacebookInstantGamesIdRequest& request,
     const FLoginWithFacebookInstantGamesIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3248,7 +3249,7 @@ bool UPlayFabClientInstanceAPI::LoginWithFacebookInstantGamesId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithFacebookInstantGamesId"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3266,9 +3267,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpReq
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3280,7 +3281,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithGameCenter(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithGameCenter(
     ClientModels::FLoginWithGameCenterRequest& request,
     const FLoginWithGameCenterDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3292,7 +3293,7 @@ bool UPlayFabClientInstanceAPI::LoginWithGameCenter(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithGameCenter"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithGameCenterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithGameCenterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGameCenterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3310,9 +3311,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithGameCenterResult(FHttpRequestPtr Http
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3324,7 +3325,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithGameCenterResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithGoogleAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithGoogleAccount(
     ClientModels::FLoginWithGoogleAccountRequest& request,
     const FLoginWithGoogleAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3336,7 +3337,7 @@ bool UPlayFabClientInstanceAPI::LoginWithGoogleAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithGoogleAccount"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3354,9 +3355,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr H
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3368,7 +3369,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithGooglePlayGamesServices(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithGooglePlayGamesServices(
     ClientModels::FLoginWithGooglePlayGamesServicesRequest& request,
     const FLoginWithGooglePlayGamesServicesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3380,7 +3381,7 @@ bool UPlayFabClientInstanceAPI::LoginWithGooglePlayGamesServices(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithGooglePlayGamesServices"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithGooglePlayGamesServicesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithGooglePlayGamesServicesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGooglePlayGamesServicesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3398,9 +3399,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithGooglePlayGamesServicesResult(FHttpRe
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3412,7 +3413,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithGooglePlayGamesServicesResult(FHttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithIOSDeviceID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithIOSDeviceID(
     ClientModels::FLoginWithIOSDeviceIDRequest& request,
     const FLoginWithIOSDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3424,7 +3425,7 @@ bool UPlayFabClientInstanceAPI::LoginWithIOSDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithIOSDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3442,9 +3443,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr Htt
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3456,7 +3457,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithKongregate(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithKongregate(
     ClientModels::FLoginWithKongregateRequest& request,
     const FLoginWithKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3468,7 +3469,7 @@ bool UPlayFabClientInstanceAPI::LoginWithKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithKongregate"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3486,9 +3487,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithKongregateResult(FHttpRequestPtr Http
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3500,7 +3501,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithKongregateResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithNintendoServiceAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithNintendoServiceAccount(
     ClientModels::FLoginWithNintendoServiceAccountRequest& request,
     const FLoginWithNintendoServiceAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3512,7 +3513,7 @@ bool UPlayFabClientInstanceAPI::LoginWithNintendoServiceAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithNintendoServiceAccount"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3530,9 +3531,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithNintendoServiceAccountResult(FHttpReq
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3544,7 +3545,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithNintendoServiceAccountResult(FHttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithNintendoSwitchDeviceId(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithNintendoSwitchDeviceId(
     ClientModels::FLoginWithNintendoSwitchDeviceIdRequest& request,
     const FLoginWithNintendoSwitchDeviceIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3556,7 +3557,7 @@ bool UPlayFabClientInstanceAPI::LoginWithNintendoSwitchDeviceId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithNintendoSwitchDeviceId"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3574,9 +3575,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpReq
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3588,7 +3589,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithOpenIdConnect(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithOpenIdConnect(
     ClientModels::FLoginWithOpenIdConnectRequest& request,
     const FLoginWithOpenIdConnectDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3600,7 +3601,7 @@ bool UPlayFabClientInstanceAPI::LoginWithOpenIdConnect(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithOpenIdConnect"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3618,9 +3619,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr H
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3632,7 +3633,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithPlayFab(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithPlayFab(
     ClientModels::FLoginWithPlayFabRequest& request,
     const FLoginWithPlayFabDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3644,7 +3645,7 @@ bool UPlayFabClientInstanceAPI::LoginWithPlayFab(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithPlayFab"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithPlayFabResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPlayFabDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3662,9 +3663,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpReq
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3676,7 +3677,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithPSN(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithPSN(
     ClientModels::FLoginWithPSNRequest& request,
     const FLoginWithPSNDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3688,7 +3689,7 @@ bool UPlayFabClientInstanceAPI::LoginWithPSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithPSN"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithPSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3706,9 +3707,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3720,7 +3721,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithSteam(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithSteam(
     ClientModels::FLoginWithSteamRequest& request,
     const FLoginWithSteamDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3732,7 +3733,7 @@ bool UPlayFabClientInstanceAPI::LoginWithSteam(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithSteam"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3750,9 +3751,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpReque
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3764,7 +3765,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithTwitch(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithTwitch(
     ClientModels::FLoginWithTwitchRequest& request,
     const FLoginWithTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3776,7 +3777,7 @@ bool UPlayFabClientInstanceAPI::LoginWithTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithTwitch"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3794,9 +3795,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequ
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3808,7 +3809,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::LoginWithXbox(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::LoginWithXbox(
     ClientModels::FLoginWithXboxRequest& request,
     const FLoginWithXboxDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3820,7 +3821,7 @@ bool UPlayFabClientInstanceAPI::LoginWithXbox(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithXbox"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3838,9 +3839,9 @@ void UPlayFabClientInstanceAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpReques
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -3852,7 +3853,7 @@ void UPlayFabClientInstanceAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::OpenTrade(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::OpenTrade(
     ClientModels::FOpenTradeRequest& request,
     const FOpenTradeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3860,13 +3861,13 @@ bool UPlayFabClientInstanceAPI::OpenTrade(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/OpenTrade"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnOpenTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnOpenTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FOpenTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3883,7 +3884,7 @@ void UPlayFabClientInstanceAPI::OnOpenTradeResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabClientInstanceAPI::PayForPurchase(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::PayForPurchase(
     ClientModels::FPayForPurchaseRequest& request,
     const FPayForPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3891,13 +3892,13 @@ bool UPlayFabClientInstanceAPI::PayForPurchase(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/PayForPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnPayForPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnPayForPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPayForPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3914,7 +3915,7 @@ void UPlayFabClientInstanceAPI::OnPayForPurchaseResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::PurchaseItem(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::PurchaseItem(
     ClientModels::FPurchaseItemRequest& request,
     const FPurchaseItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3922,13 +3923,13 @@ bool UPlayFabClientInstanceAPI::PurchaseItem(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/PurchaseItem"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnPurchaseItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnPurchaseItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPurchaseItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3945,7 +3946,7 @@ void UPlayFabClientInstanceAPI::OnPurchaseItemResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::RedeemCoupon(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RedeemCoupon(
     ClientModels::FRedeemCouponRequest& request,
     const FRedeemCouponDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3953,13 +3954,13 @@ bool UPlayFabClientInstanceAPI::RedeemCoupon(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RedeemCoupon"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemCouponDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3976,7 +3977,7 @@ void UPlayFabClientInstanceAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::RefreshPSNAuthToken(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RefreshPSNAuthToken(
     ClientModels::FRefreshPSNAuthTokenRequest& request,
     const FRefreshPSNAuthTokenDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3984,13 +3985,13 @@ bool UPlayFabClientInstanceAPI::RefreshPSNAuthToken(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RefreshPSNAuthToken"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRefreshPSNAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRefreshPSNAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefreshPSNAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4007,7 +4008,7 @@ void UPlayFabClientInstanceAPI::OnRefreshPSNAuthTokenResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::RegisterForIOSPushNotification(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RegisterForIOSPushNotification(
     ClientModels::FRegisterForIOSPushNotificationRequest& request,
     const FRegisterForIOSPushNotificationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4015,13 +4016,13 @@ bool UPlayFabClientInstanceAPI::RegisterForIOSPushNotification(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RegisterForIOSPushNotification"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRegisterForIOSPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRegisterForIOSPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterForIOSPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4038,7 +4039,7 @@ void UPlayFabClientInstanceAPI::OnRegisterForIOSPushNotificationResult(FHttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::RegisterPlayFabUser(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RegisterPlayFabUser(
     ClientModels::FRegisterPlayFabUserRequest& request,
     const FRegisterPlayFabUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4050,7 +4051,7 @@ bool UPlayFabClientInstanceAPI::RegisterPlayFabUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RegisterPlayFabUser"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRegisterPlayFabUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRegisterPlayFabUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterPlayFabUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4068,9 +4069,9 @@ void UPlayFabClientInstanceAPI::OnRegisterPlayFabUserResult(FHttpRequestPtr Http
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken->EntityToken);
             outResult.AuthenticationContext->SetEntityToken(outResult.EntityToken->EntityToken);
         }
-        if (outResult.PlayFabId.Len() > 0) {
-            this->authContext->SetPlayFabId(outResult.PlayFabId);
-            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
+        if (!outResult.PlayFabId.IsEmpty()) {
+            this->authContext->SetPlayFabId(outResult.PlayFabId.ToString());
+            outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId.ToString());
         }
         
 
@@ -4082,7 +4083,7 @@ void UPlayFabClientInstanceAPI::OnRegisterPlayFabUserResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::RemoveContactEmail(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RemoveContactEmail(
     ClientModels::FRemoveContactEmailRequest& request,
     const FRemoveContactEmailDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4090,13 +4091,13 @@ bool UPlayFabClientInstanceAPI::RemoveContactEmail(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveContactEmail"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRemoveContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRemoveContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4113,7 +4114,7 @@ void UPlayFabClientInstanceAPI::OnRemoveContactEmailResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientInstanceAPI::RemoveFriend(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RemoveFriend(
     ClientModels::FRemoveFriendRequest& request,
     const FRemoveFriendDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4121,13 +4122,13 @@ bool UPlayFabClientInstanceAPI::RemoveFriend(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveFriend"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4144,7 +4145,7 @@ void UPlayFabClientInstanceAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::RemoveGenericID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RemoveGenericID(
     ClientModels::FRemoveGenericIDRequest& request,
     const FRemoveGenericIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4152,13 +4153,13 @@ bool UPlayFabClientInstanceAPI::RemoveGenericID(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveGenericID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4175,7 +4176,7 @@ void UPlayFabClientInstanceAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::RemoveSharedGroupMembers(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RemoveSharedGroupMembers(
     ClientModels::FRemoveSharedGroupMembersRequest& request,
     const FRemoveSharedGroupMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4183,13 +4184,13 @@ bool UPlayFabClientInstanceAPI::RemoveSharedGroupMembers(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4206,7 +4207,7 @@ void UPlayFabClientInstanceAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::ReportAdActivity(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ReportAdActivity(
     ClientModels::FReportAdActivityRequest& request,
     const FReportAdActivityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4214,13 +4215,13 @@ bool UPlayFabClientInstanceAPI::ReportAdActivity(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ReportAdActivity"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnReportAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnReportAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4237,7 +4238,7 @@ void UPlayFabClientInstanceAPI::OnReportAdActivityResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::ReportDeviceInfo(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ReportDeviceInfo(
     ClientModels::FDeviceInfoRequest& request,
     const FReportDeviceInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4245,13 +4246,13 @@ bool UPlayFabClientInstanceAPI::ReportDeviceInfo(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ReportDeviceInfo"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnReportDeviceInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnReportDeviceInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportDeviceInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4268,7 +4269,7 @@ void UPlayFabClientInstanceAPI::OnReportDeviceInfoResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::ReportPlayer(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ReportPlayer(
     ClientModels::FReportPlayerClientRequest& request,
     const FReportPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4276,13 +4277,13 @@ bool UPlayFabClientInstanceAPI::ReportPlayer(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ReportPlayer"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4299,7 +4300,7 @@ void UPlayFabClientInstanceAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::RestoreIOSPurchases(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RestoreIOSPurchases(
     ClientModels::FRestoreIOSPurchasesRequest& request,
     const FRestoreIOSPurchasesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4307,13 +4308,13 @@ bool UPlayFabClientInstanceAPI::RestoreIOSPurchases(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RestoreIOSPurchases"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRestoreIOSPurchasesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRestoreIOSPurchasesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRestoreIOSPurchasesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4330,7 +4331,7 @@ void UPlayFabClientInstanceAPI::OnRestoreIOSPurchasesResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::RewardAdActivity(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::RewardAdActivity(
     ClientModels::FRewardAdActivityRequest& request,
     const FRewardAdActivityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4338,13 +4339,13 @@ bool UPlayFabClientInstanceAPI::RewardAdActivity(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RewardAdActivity"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRewardAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnRewardAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRewardAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4361,7 +4362,7 @@ void UPlayFabClientInstanceAPI::OnRewardAdActivityResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::SendAccountRecoveryEmail(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::SendAccountRecoveryEmail(
     ClientModels::FSendAccountRecoveryEmailRequest& request,
     const FSendAccountRecoveryEmailDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4371,7 +4372,7 @@ bool UPlayFabClientInstanceAPI::SendAccountRecoveryEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SendAccountRecoveryEmail"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4388,7 +4389,7 @@ void UPlayFabClientInstanceAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::SetFriendTags(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::SetFriendTags(
     ClientModels::FSetFriendTagsRequest& request,
     const FSetFriendTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4396,13 +4397,13 @@ bool UPlayFabClientInstanceAPI::SetFriendTags(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SetFriendTags"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetFriendTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4419,7 +4420,7 @@ void UPlayFabClientInstanceAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::SetPlayerSecret(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::SetPlayerSecret(
     ClientModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4427,13 +4428,13 @@ bool UPlayFabClientInstanceAPI::SetPlayerSecret(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SetPlayerSecret"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4450,7 +4451,7 @@ void UPlayFabClientInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::StartPurchase(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::StartPurchase(
     ClientModels::FStartPurchaseRequest& request,
     const FStartPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4458,13 +4459,13 @@ bool UPlayFabClientInstanceAPI::StartPurchase(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/StartPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnStartPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnStartPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4481,7 +4482,7 @@ void UPlayFabClientInstanceAPI::OnStartPurchaseResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::SubtractUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::SubtractUserVirtualCurrency(
     ClientModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4489,13 +4490,13 @@ bool UPlayFabClientInstanceAPI::SubtractUserVirtualCurrency(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4512,7 +4513,7 @@ void UPlayFabClientInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkAndroidDeviceID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkAndroidDeviceID(
     ClientModels::FUnlinkAndroidDeviceIDRequest& request,
     const FUnlinkAndroidDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4520,13 +4521,13 @@ bool UPlayFabClientInstanceAPI::UnlinkAndroidDeviceID(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4543,7 +4544,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkAndroidDeviceIDResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkApple(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkApple(
     ClientModels::FUnlinkAppleRequest& request,
     const FUnlinkAppleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4551,13 +4552,13 @@ bool UPlayFabClientInstanceAPI::UnlinkApple(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkApple"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4574,7 +4575,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkAppleResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkCustomID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkCustomID(
     ClientModels::FUnlinkCustomIDRequest& request,
     const FUnlinkCustomIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4582,13 +4583,13 @@ bool UPlayFabClientInstanceAPI::UnlinkCustomID(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4605,7 +4606,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkCustomIDResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkFacebookAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkFacebookAccount(
     ClientModels::FUnlinkFacebookAccountRequest& request,
     const FUnlinkFacebookAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4613,13 +4614,13 @@ bool UPlayFabClientInstanceAPI::UnlinkFacebookAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4636,7 +4637,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkFacebookAccountResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkFacebookInstantGamesId(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkFacebookInstantGamesId(
     ClientModels::FUnlinkFacebookInstantGamesIdRequest& request,
     const FUnlinkFacebookInstantGamesIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4644,13 +4645,13 @@ bool UPlayFabClientInstanceAPI::UnlinkFacebookInstantGamesId(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4667,7 +4668,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkFacebookInstantGamesIdResult(FHttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkGameCenterAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkGameCenterAccount(
     ClientModels::FUnlinkGameCenterAccountRequest& request,
     const FUnlinkGameCenterAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4675,13 +4676,13 @@ bool UPlayFabClientInstanceAPI::UnlinkGameCenterAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4698,7 +4699,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkGameCenterAccountResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkGoogleAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkGoogleAccount(
     ClientModels::FUnlinkGoogleAccountRequest& request,
     const FUnlinkGoogleAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4706,13 +4707,13 @@ bool UPlayFabClientInstanceAPI::UnlinkGoogleAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4729,7 +4730,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkGoogleAccountResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkGooglePlayGamesServicesAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkGooglePlayGamesServicesAccount(
     ClientModels::FUnlinkGooglePlayGamesServicesAccountRequest& request,
     const FUnlinkGooglePlayGamesServicesAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4737,13 +4738,13 @@ bool UPlayFabClientInstanceAPI::UnlinkGooglePlayGamesServicesAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkGooglePlayGamesServicesAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkGooglePlayGamesServicesAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkGooglePlayGamesServicesAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGooglePlayGamesServicesAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4760,7 +4761,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkGooglePlayGamesServicesAccountResult(FHt
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkIOSDeviceID(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkIOSDeviceID(
     ClientModels::FUnlinkIOSDeviceIDRequest& request,
     const FUnlinkIOSDeviceIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4768,13 +4769,13 @@ bool UPlayFabClientInstanceAPI::UnlinkIOSDeviceID(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4791,7 +4792,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkIOSDeviceIDResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkKongregate(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkKongregate(
     ClientModels::FUnlinkKongregateAccountRequest& request,
     const FUnlinkKongregateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4799,13 +4800,13 @@ bool UPlayFabClientInstanceAPI::UnlinkKongregate(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4822,7 +4823,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkKongregateResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkNintendoServiceAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkNintendoServiceAccount(
     ClientModels::FUnlinkNintendoServiceAccountRequest& request,
     const FUnlinkNintendoServiceAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4830,13 +4831,13 @@ bool UPlayFabClientInstanceAPI::UnlinkNintendoServiceAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4853,7 +4854,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkNintendoServiceAccountResult(FHttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkNintendoSwitchDeviceId(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkNintendoSwitchDeviceId(
     ClientModels::FUnlinkNintendoSwitchDeviceIdRequest& request,
     const FUnlinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4861,13 +4862,13 @@ bool UPlayFabClientInstanceAPI::UnlinkNintendoSwitchDeviceId(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4884,7 +4885,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkNintendoSwitchDeviceIdResult(FHttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkOpenIdConnect(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkOpenIdConnect(
     ClientModels::FUnlinkOpenIdConnectRequest& request,
     const FUnlinkOpenIdConnectDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4892,13 +4893,13 @@ bool UPlayFabClientInstanceAPI::UnlinkOpenIdConnect(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4915,7 +4916,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkOpenIdConnectResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkPSNAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkPSNAccount(
     ClientModels::FUnlinkPSNAccountRequest& request,
     const FUnlinkPSNAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4923,13 +4924,13 @@ bool UPlayFabClientInstanceAPI::UnlinkPSNAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4946,7 +4947,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkSteamAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkSteamAccount(
     ClientModels::FUnlinkSteamAccountRequest& request,
     const FUnlinkSteamAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4954,13 +4955,13 @@ bool UPlayFabClientInstanceAPI::UnlinkSteamAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4977,7 +4978,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkSteamAccountResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkTwitch(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkTwitch(
     ClientModels::FUnlinkTwitchAccountRequest& request,
     const FUnlinkTwitchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4985,13 +4986,13 @@ bool UPlayFabClientInstanceAPI::UnlinkTwitch(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5008,7 +5009,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkTwitchResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlinkXboxAccount(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlinkXboxAccount(
     ClientModels::FUnlinkXboxAccountRequest& request,
     const FUnlinkXboxAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5016,13 +5017,13 @@ bool UPlayFabClientInstanceAPI::UnlinkXboxAccount(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5039,7 +5040,7 @@ void UPlayFabClientInstanceAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlockContainerInstance(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlockContainerInstance(
     ClientModels::FUnlockContainerInstanceRequest& request,
     const FUnlockContainerInstanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5047,13 +5048,13 @@ bool UPlayFabClientInstanceAPI::UnlockContainerInstance(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlockContainerInstance"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5070,7 +5071,7 @@ void UPlayFabClientInstanceAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::UnlockContainerItem(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UnlockContainerItem(
     ClientModels::FUnlockContainerItemRequest& request,
     const FUnlockContainerItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5078,13 +5079,13 @@ bool UPlayFabClientInstanceAPI::UnlockContainerItem(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlockContainerItem"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUnlockContainerItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5101,7 +5102,7 @@ void UPlayFabClientInstanceAPI::OnUnlockContainerItemResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::UpdateAvatarUrl(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UpdateAvatarUrl(
     ClientModels::FUpdateAvatarUrlRequest& request,
     const FUpdateAvatarUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5109,13 +5110,13 @@ bool UPlayFabClientInstanceAPI::UpdateAvatarUrl(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateAvatarUrl"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateAvatarUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5132,7 +5133,7 @@ void UPlayFabClientInstanceAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabClientInstanceAPI::UpdateCharacterData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UpdateCharacterData(
     ClientModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5140,13 +5141,13 @@ bool UPlayFabClientInstanceAPI::UpdateCharacterData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateCharacterData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5163,7 +5164,7 @@ void UPlayFabClientInstanceAPI::OnUpdateCharacterDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::UpdateCharacterStatistics(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UpdateCharacterStatistics(
     ClientModels::FUpdateCharacterStatisticsRequest& request,
     const FUpdateCharacterStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5171,13 +5172,13 @@ bool UPlayFabClientInstanceAPI::UpdateCharacterStatistics(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5194,7 +5195,7 @@ void UPlayFabClientInstanceAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabClientInstanceAPI::UpdatePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UpdatePlayerCustomProperties(
     ClientModels::FUpdatePlayerCustomPropertiesRequest& request,
     const FUpdatePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5202,13 +5203,13 @@ bool UPlayFabClientInstanceAPI::UpdatePlayerCustomProperties(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdatePlayerCustomProperties"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdatePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUpdatePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5225,7 +5226,7 @@ void UPlayFabClientInstanceAPI::OnUpdatePlayerCustomPropertiesResult(FHttpReques
     }
 }
 
-bool UPlayFabClientInstanceAPI::UpdatePlayerStatistics(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UpdatePlayerStatistics(
     ClientModels::FUpdatePlayerStatisticsRequest& request,
     const FUpdatePlayerStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5233,13 +5234,13 @@ bool UPlayFabClientInstanceAPI::UpdatePlayerStatistics(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdatePlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5256,7 +5257,7 @@ void UPlayFabClientInstanceAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabClientInstanceAPI::UpdateSharedGroupData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UpdateSharedGroupData(
     ClientModels::FUpdateSharedGroupDataRequest& request,
     const FUpdateSharedGroupDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5264,13 +5265,13 @@ bool UPlayFabClientInstanceAPI::UpdateSharedGroupData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5287,7 +5288,7 @@ void UPlayFabClientInstanceAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabClientInstanceAPI::UpdateUserData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UpdateUserData(
     ClientModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5295,13 +5296,13 @@ bool UPlayFabClientInstanceAPI::UpdateUserData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateUserData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5318,7 +5319,7 @@ void UPlayFabClientInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabClientInstanceAPI::UpdateUserPublisherData(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UpdateUserPublisherData(
     ClientModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5326,13 +5327,13 @@ bool UPlayFabClientInstanceAPI::UpdateUserPublisherData(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5349,7 +5350,7 @@ void UPlayFabClientInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::UpdateUserTitleDisplayName(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::UpdateUserTitleDisplayName(
     ClientModels::FUpdateUserTitleDisplayNameRequest& request,
     const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5357,13 +5358,13 @@ bool UPlayFabClientInstanceAPI::UpdateUserTitleDisplayName(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5380,7 +5381,7 @@ void UPlayFabClientInstanceAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::ValidateAmazonIAPReceipt(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ValidateAmazonIAPReceipt(
     ClientModels::FValidateAmazonReceiptRequest& request,
     const FValidateAmazonIAPReceiptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5388,13 +5389,13 @@ bool UPlayFabClientInstanceAPI::ValidateAmazonIAPReceipt(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateAmazonIAPReceipt"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnValidateAmazonIAPReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnValidateAmazonIAPReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateAmazonIAPReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5411,7 +5412,7 @@ void UPlayFabClientInstanceAPI::OnValidateAmazonIAPReceiptResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabClientInstanceAPI::ValidateGooglePlayPurchase(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ValidateGooglePlayPurchase(
     ClientModels::FValidateGooglePlayPurchaseRequest& request,
     const FValidateGooglePlayPurchaseDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5419,13 +5420,13 @@ bool UPlayFabClientInstanceAPI::ValidateGooglePlayPurchase(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateGooglePlayPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnValidateGooglePlayPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnValidateGooglePlayPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateGooglePlayPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5442,7 +5443,7 @@ void UPlayFabClientInstanceAPI::OnValidateGooglePlayPurchaseResult(FHttpRequestP
     }
 }
 
-bool UPlayFabClientInstanceAPI::ValidateIOSReceipt(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ValidateIOSReceipt(
     ClientModels::FValidateIOSReceiptRequest& request,
     const FValidateIOSReceiptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5450,13 +5451,13 @@ bool UPlayFabClientInstanceAPI::ValidateIOSReceipt(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateIOSReceipt"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnValidateIOSReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnValidateIOSReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateIOSReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5473,7 +5474,7 @@ void UPlayFabClientInstanceAPI::OnValidateIOSReceiptResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabClientInstanceAPI::ValidateWindowsStoreReceipt(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::ValidateWindowsStoreReceipt(
     ClientModels::FValidateWindowsReceiptRequest& request,
     const FValidateWindowsStoreReceiptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5481,13 +5482,13 @@ bool UPlayFabClientInstanceAPI::ValidateWindowsStoreReceipt(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateWindowsStoreReceipt"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnValidateWindowsStoreReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnValidateWindowsStoreReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateWindowsStoreReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5504,7 +5505,7 @@ void UPlayFabClientInstanceAPI::OnValidateWindowsStoreReceiptResult(FHttpRequest
     }
 }
 
-bool UPlayFabClientInstanceAPI::WriteCharacterEvent(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::WriteCharacterEvent(
     ClientModels::FWriteClientCharacterEventRequest& request,
     const FWriteCharacterEventDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5512,13 +5513,13 @@ bool UPlayFabClientInstanceAPI::WriteCharacterEvent(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/WriteCharacterEvent"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnWriteCharacterEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteCharacterEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5535,7 +5536,7 @@ void UPlayFabClientInstanceAPI::OnWriteCharacterEventResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabClientInstanceAPI::WritePlayerEvent(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::WritePlayerEvent(
     ClientModels::FWriteClientPlayerEventRequest& request,
     const FWritePlayerEventDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5543,13 +5544,13 @@ bool UPlayFabClientInstanceAPI::WritePlayerEvent(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/WritePlayerEvent"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWritePlayerEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5566,7 +5567,7 @@ void UPlayFabClientInstanceAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabClientInstanceAPI::WriteTitleEvent(
+FPlayFabRequestHandle UPlayFabClientInstanceAPI::WriteTitleEvent(
     ClientModels::FWriteTitleEventRequest& request,
     const FWriteTitleEventDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -5574,13 +5575,13 @@ bool UPlayFabClientInstanceAPI::WriteTitleEvent(
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must log in before calling this function"));
-        return false;
+        return FPlayFabRequestHandle();
     }
 
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/WriteTitleEvent"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabClientInstanceAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTitleEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5596,3 +5597,5 @@ void UPlayFabClientInstanceAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequ
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_CLIENT_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_CLOUDSCRIPT_API
 #include "Core/PlayFabCloudScriptAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabCloudScriptAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabCloudScriptAPI::ExecuteEntityCloudScript(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::ExecuteEntityCloudScript(
     CloudScriptModels::FExecuteEntityCloudScriptRequest& request,
     const FExecuteEntityCloudScriptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,14 +41,14 @@ bool UPlayFabCloudScriptAPI::ExecuteEntityCloudScript(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/ExecuteEntityCloudScript"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnExecuteEntityCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnExecuteEntityCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteEntityCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
     CloudScriptModels::FExecuteCloudScriptResult outResult;
     FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult, TEXT("FunctionResult"), outResult.FunctionResult))
     {
         SuccessDelegate.ExecuteIfBound(outResult);
     }
@@ -57,7 +58,7 @@ void UPlayFabCloudScriptAPI::OnExecuteEntityCloudScriptResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabCloudScriptAPI::ExecuteFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::ExecuteFunction(
     CloudScriptModels::FExecuteFunctionRequest& request,
     const FExecuteFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -74,19 +75,19 @@ bool UPlayFabCloudScriptAPI::ExecuteFunction(
         endpoint.RemoveFromStart(TEXT("/"));
         auto HttpRequest = PlayFabRequestHandler::SendFullUrlRequest(localApiServer + endpoint, request.toJSONString(), TEXT("X-EntityToken"), entityToken);
         HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnExecuteFunctionResult, SuccessDelegate, ErrorDelegate);
-        return HttpRequest->ProcessRequest();
+        return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
     }
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/ExecuteFunction"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnExecuteFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnExecuteFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
     CloudScriptModels::FExecuteFunctionResult outResult;
     FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult, TEXT("FunctionResult"), outResult.FunctionResult))
     {
         SuccessDelegate.ExecuteIfBound(outResult);
     }
@@ -96,7 +97,7 @@ void UPlayFabCloudScriptAPI::OnExecuteFunctionResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabCloudScriptAPI::GetFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::GetFunction(
     CloudScriptModels::FGetFunctionRequest& request,
     const FGetFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -109,7 +110,7 @@ bool UPlayFabCloudScriptAPI::GetFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/GetFunction"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnGetFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnGetFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -126,7 +127,7 @@ void UPlayFabCloudScriptAPI::OnGetFunctionResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabCloudScriptAPI::ListEventHubFunctions(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::ListEventHubFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListEventHubFunctionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -139,7 +140,7 @@ bool UPlayFabCloudScriptAPI::ListEventHubFunctions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/ListEventHubFunctions"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnListEventHubFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnListEventHubFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListEventHubFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -156,7 +157,7 @@ void UPlayFabCloudScriptAPI::OnListEventHubFunctionsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabCloudScriptAPI::ListFunctions(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::ListFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListFunctionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -169,7 +170,7 @@ bool UPlayFabCloudScriptAPI::ListFunctions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/ListFunctions"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnListFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnListFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -186,7 +187,7 @@ void UPlayFabCloudScriptAPI::OnListFunctionsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabCloudScriptAPI::ListHttpFunctions(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::ListHttpFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListHttpFunctionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -199,7 +200,7 @@ bool UPlayFabCloudScriptAPI::ListHttpFunctions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/ListHttpFunctions"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnListHttpFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnListHttpFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListHttpFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -216,7 +217,7 @@ void UPlayFabCloudScriptAPI::OnListHttpFunctionsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabCloudScriptAPI::ListQueuedFunctions(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::ListQueuedFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListQueuedFunctionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -229,7 +230,7 @@ bool UPlayFabCloudScriptAPI::ListQueuedFunctions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/ListQueuedFunctions"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnListQueuedFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnListQueuedFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListQueuedFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -246,7 +247,7 @@ void UPlayFabCloudScriptAPI::OnListQueuedFunctionsResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabCloudScriptAPI::PostFunctionResultForEntityTriggeredAction(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::PostFunctionResultForEntityTriggeredAction(
     CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest& request,
     const FPostFunctionResultForEntityTriggeredActionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -259,7 +260,7 @@ bool UPlayFabCloudScriptAPI::PostFunctionResultForEntityTriggeredAction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/PostFunctionResultForEntityTriggeredAction"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnPostFunctionResultForEntityTriggeredActionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnPostFunctionResultForEntityTriggeredActionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForEntityTriggeredActionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -276,7 +277,7 @@ void UPlayFabCloudScriptAPI::OnPostFunctionResultForEntityTriggeredActionResult(
     }
 }
 
-bool UPlayFabCloudScriptAPI::PostFunctionResultForFunctionExecution(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::PostFunctionResultForFunctionExecution(
     CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest& request,
     const FPostFunctionResultForFunctionExecutionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -289,7 +290,7 @@ bool UPlayFabCloudScriptAPI::PostFunctionResultForFunctionExecution(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/PostFunctionResultForFunctionExecution"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnPostFunctionResultForFunctionExecutionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnPostFunctionResultForFunctionExecutionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForFunctionExecutionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -306,7 +307,7 @@ void UPlayFabCloudScriptAPI::OnPostFunctionResultForFunctionExecutionResult(FHtt
     }
 }
 
-bool UPlayFabCloudScriptAPI::PostFunctionResultForPlayerTriggeredAction(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::PostFunctionResultForPlayerTriggeredAction(
     CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest& request,
     const FPostFunctionResultForPlayerTriggeredActionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -319,7 +320,7 @@ bool UPlayFabCloudScriptAPI::PostFunctionResultForPlayerTriggeredAction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/PostFunctionResultForPlayerTriggeredAction"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnPostFunctionResultForPlayerTriggeredActionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnPostFunctionResultForPlayerTriggeredActionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForPlayerTriggeredActionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -336,7 +337,7 @@ void UPlayFabCloudScriptAPI::OnPostFunctionResultForPlayerTriggeredActionResult(
     }
 }
 
-bool UPlayFabCloudScriptAPI::PostFunctionResultForScheduledTask(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::PostFunctionResultForScheduledTask(
     CloudScriptModels::FPostFunctionResultForScheduledTaskRequest& request,
     const FPostFunctionResultForScheduledTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -349,7 +350,7 @@ bool UPlayFabCloudScriptAPI::PostFunctionResultForScheduledTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/PostFunctionResultForScheduledTask"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnPostFunctionResultForScheduledTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnPostFunctionResultForScheduledTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForScheduledTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -366,7 +367,7 @@ void UPlayFabCloudScriptAPI::OnPostFunctionResultForScheduledTaskResult(FHttpReq
     }
 }
 
-bool UPlayFabCloudScriptAPI::RegisterEventHubFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::RegisterEventHubFunction(
     CloudScriptModels::FRegisterEventHubFunctionRequest& request,
     const FRegisterEventHubFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -379,7 +380,7 @@ bool UPlayFabCloudScriptAPI::RegisterEventHubFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/RegisterEventHubFunction"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnRegisterEventHubFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnRegisterEventHubFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterEventHubFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -396,7 +397,7 @@ void UPlayFabCloudScriptAPI::OnRegisterEventHubFunctionResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabCloudScriptAPI::RegisterHttpFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::RegisterHttpFunction(
     CloudScriptModels::FRegisterHttpFunctionRequest& request,
     const FRegisterHttpFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -409,7 +410,7 @@ bool UPlayFabCloudScriptAPI::RegisterHttpFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/RegisterHttpFunction"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnRegisterHttpFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnRegisterHttpFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterHttpFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -426,7 +427,7 @@ void UPlayFabCloudScriptAPI::OnRegisterHttpFunctionResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabCloudScriptAPI::RegisterQueuedFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::RegisterQueuedFunction(
     CloudScriptModels::FRegisterQueuedFunctionRequest& request,
     const FRegisterQueuedFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -439,7 +440,7 @@ bool UPlayFabCloudScriptAPI::RegisterQueuedFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/RegisterQueuedFunction"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnRegisterQueuedFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnRegisterQueuedFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterQueuedFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -456,7 +457,7 @@ void UPlayFabCloudScriptAPI::OnRegisterQueuedFunctionResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabCloudScriptAPI::UnregisterFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptAPI::UnregisterFunction(
     CloudScriptModels::FUnregisterFunctionRequest& request,
     const FUnregisterFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -469,7 +470,7 @@ bool UPlayFabCloudScriptAPI::UnregisterFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/CloudScript/UnregisterFunction"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptAPI::OnUnregisterFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptAPI::OnUnregisterFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnregisterFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -485,3 +486,5 @@ void UPlayFabCloudScriptAPI::OnUnregisterFunctionResult(FHttpRequestPtr HttpRequ
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_CLOUDSCRIPT_API
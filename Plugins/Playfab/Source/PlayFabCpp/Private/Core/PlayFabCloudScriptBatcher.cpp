@@ -0,0 +1,228 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#if WITH_PLAYFAB_CLOUDSCRIPT_API
+#include "Core/PlayFabCloudScriptBatcher.h"
+#include "Dom/JsonObject.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+using namespace PlayFab::CloudScriptModels;
+
+namespace
+{
+    bool CanBatch(const FExecuteFunctionRequest& request)
+    {
+        return !request.AuthenticationContext.IsValid() && !request.Entity.IsValid() && request.GeneratePlayStreamEvent.isNull();
+    }
+
+    FPlayFabCppError MakeMissingResultError(const PlayFabCloudScriptBatcher::FCall& Call)
+    {
+        FPlayFabCppError errorResult;
+        errorResult.HttpCode = 500;
+        errorResult.ErrorCode = PlayFabErrorUnknownError;
+        errorResult.ErrorName = errorResult.HttpStatus = TEXT("Batched CloudScript call failed");
+        errorResult.ErrorMessage = FString::Printf(TEXT("The dispatcher returned no result for %s (call %d)"), *Call.Request.FunctionName, Call.Id);
+        return errorResult;
+    }
+}
+
+PlayFabCloudScriptBatcher::PlayFabCloudScriptBatcher(const FString& InDispatcherFunction, PlayFabCloudScriptPtr InCloudScriptAPI)
+    : DispatcherFunction(InDispatcherFunction)
+    , CloudScriptAPI(InCloudScriptAPI)
+{
+}
+
+PlayFabCloudScriptBatcher::~PlayFabCloudScriptBatcher()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(WindowHandle);
+
+    // Nothing can come back to this object any more; the calls still waiting go out one by one
+    for (FCall& Call : Pending)
+    {
+        GetCloudScriptAPI()->ExecuteFunction(Call.Request, Call.SuccessDelegate, Call.ErrorDelegate);
+    }
+}
+
+FPlayFabRequestHandle PlayFabCloudScriptBatcher::ExecuteFunction(FExecuteFunctionRequest& request, const UPlayFabCloudScriptAPI::FExecuteFunctionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    if (!CanBatch(request))
+    {
+        return GetCloudScriptAPI()->ExecuteFunction(request, SuccessDelegate, ErrorDelegate);
+    }
+
+    bool bFull = false;
+    {
+        FScopeLock ScopeLock(&Lock);
+        FCall& Call = Pending.AddDefaulted_GetRef();
+        Call.Id = NextId++;
+        Call.Request = request;
+        Call.SuccessDelegate = SuccessDelegate;
+        Call.ErrorDelegate = ErrorDelegate;
+
+        bFull = Pending.Num() >= MaxCallsPerBatch;
+        if (!bFull && Pending.Num() == 1)
+        {
+            WindowHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &PlayFabCloudScriptBatcher::OnWindowElapsed), WindowSeconds);
+        }
+    }
+
+    if (bFull)
+    {
+        Flush();
+    }
+    return FPlayFabRequestHandle(true);
+}
+
+void PlayFabCloudScriptBatcher::Flush()
+{
+    TArray<FCall> Calls;
+    {
+        FScopeLock ScopeLock(&Lock);
+        FTSTicker::GetCoreTicker().RemoveTicker(WindowHandle);
+        WindowHandle.Reset();
+        Calls = MoveTemp(Pending);
+        Pending.Reset();
+    }
+
+    // Only calls with the same deadline share an envelope, the tightest one would cut the others short
+    while (Calls.Num() > 0)
+    {
+        const float TimeoutSeconds = Calls[0].Request.TimeoutSeconds;
+        TSharedRef<TArray<FCall> > Batch = MakeShared<TArray<FCall> >();
+        TArray<FCall> Rest;
+        for (FCall& Call : Calls)
+        {
+            (Call.Request.TimeoutSeconds == TimeoutSeconds ? *Batch : Rest).Add(MoveTemp(Call));
+        }
+        Calls = MoveTemp(Rest);
+        SendBatch(Batch, TimeoutSeconds);
+    }
+}
+
+void PlayFabCloudScriptBatcher::SendBatch(TSharedRef<TArray<FCall> > Calls, float TimeoutSeconds)
+{
+    // A lone call gains nothing from the envelope
+    if (Calls->Num() == 1)
+    {
+        FCall& Call = (*Calls)[0];
+        GetCloudScriptAPI()->ExecuteFunction(Call.Request, Call.SuccessDelegate, Call.ErrorDelegate);
+        return;
+    }
+
+    FExecuteFunctionRequest request;
+    request.FunctionName = DispatcherFunction;
+    request.TimeoutSeconds = TimeoutSeconds;
+    WriteEnvelope(*Calls, request.FunctionParameter);
+
+    // The fan-out only needs the calls, so every caller hears back even if the batcher is gone by then
+    GetCloudScriptAPI()->ExecuteFunction(request,
+        UPlayFabCloudScriptAPI::FExecuteFunctionDelegate::CreateStatic(&PlayFabCloudScriptBatcher::OnBatchResult, Calls, DispatcherFunction),
+        FPlayFabErrorDelegate::CreateStatic(&PlayFabCloudScriptBatcher::OnBatchError, Calls));
+}
+
+bool PlayFabCloudScriptBatcher::OnWindowElapsed(float DeltaTime)
+{
+    Flush();
+    return false;
+}
+
+void PlayFabCloudScriptBatcher::OnBatchResult(const FExecuteFunctionResult& result, TSharedRef<TArray<FCall> > Calls, FString DispatcherFunction)
+{
+    TMap<int32, FExecuteFunctionResult> Results;
+    if (result.Error.IsValid() || !ReadResults(result.FunctionResult, Results))
+    {
+        // The dispatcher itself failed: every call reports its error, the way a failed function would
+        for (const FCall& Call : *Calls)
+        {
+            FExecuteFunctionResult callResult = result;
+            callResult.FunctionName = Call.Request.FunctionName;
+            callResult.FunctionResult = FJsonKeeper();
+            if (!callResult.Error.IsValid())
+            {
+                callResult.Error = MakeShareable(new FFunctionExecutionError());
+                callResult.Error->Error = TEXT("BatchDispatcherInvalidReply");
+                callResult.Error->Message = FString::Printf(TEXT("%s did not return a Results envelope"), *DispatcherFunction);
+            }
+            Call.SuccessDelegate.ExecuteIfBound(callResult);
+        }
+        return;
+    }
+
+    for (const FCall& Call : *Calls)
+    {
+        if (const FExecuteFunctionResult* callResult = Results.Find(Call.Id))
+        {
+            Call.SuccessDelegate.ExecuteIfBound(*callResult);
+        }
+        else
+        {
+            Call.ErrorDelegate.ExecuteIfBound(MakeMissingResultError(Call));
+        }
+    }
+}
+
+void PlayFabCloudScriptBatcher::OnBatchError(const FPlayFabCppError& error, TSharedRef<TArray<FCall> > Calls)
+{
+    for (const FCall& Call : *Calls)
+    {
+        Call.ErrorDelegate.ExecuteIfBound(error);
+    }
+}
+
+void PlayFabCloudScriptBatcher::WriteEnvelope(const TArray<FCall>& Calls, FJsonKeeper& OutFunctionParameter)
+{
+    FString Envelope;
+    JsonWriter writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR> >::Create(&Envelope);
+    writer->WriteObjectStart();
+    writer->WriteArrayStart(TEXT("Calls"));
+    for (const FCall& Call : Calls)
+    {
+        writer->WriteObjectStart();
+        writer->WriteValue(TEXT("Id"), Call.Id);
+        writer->WriteValue(TEXT("FunctionName"), Call.Request.FunctionName);
+        if (Call.Request.FunctionParameter.notNull())
+        {
+            writer->WriteIdentifierPrefix(TEXT("FunctionParameter"));
+            Call.Request.FunctionParameter.writeJSON(writer);
+        }
+        writer->WriteObjectEnd();
+    }
+    writer->WriteArrayEnd();
+    writer->WriteObjectEnd();
+    writer->Close();
+
+    OutFunctionParameter.SetRawJson(Envelope);
+}
+
+bool PlayFabCloudScriptBatcher::ReadResults(const FJsonKeeper& FunctionResult, TMap<int32, FExecuteFunctionResult>& OutResults)
+{
+    const TSharedPtr<FJsonValue> Value = FunctionResult.GetJsonValue();
+    const TSharedPtr<FJsonObject>* Envelope;
+    const TArray<TSharedPtr<FJsonValue> >* Entries;
+    if (!Value.IsValid() || !Value->TryGetObject(Envelope) || !(*Envelope)->TryGetArrayField(TEXT("Results"), Entries))
+    {
+        return false;
+    }
+
+    OutResults.Reserve(Entries->Num());
+    for (const TSharedPtr<FJsonValue>& Entry : *Entries)
+    {
+        const TSharedPtr<FJsonObject>* EntryObject;
+        int32 Id;
+        if (Entry.IsValid() && Entry->TryGetObject(EntryObject) && (*EntryObject)->TryGetNumberField(TEXT("Id"), Id))
+        {
+            OutResults.Emplace(Id, FExecuteFunctionResult(*EntryObject));
+        }
+    }
+    return true;
+}
+
+PlayFabCloudScriptPtr PlayFabCloudScriptBatcher::GetCloudScriptAPI() const
+{
+    return CloudScriptAPI.IsValid() ? CloudScriptAPI : IPlayFabModuleInterface::Get().GetCloudScriptAPI();
+}
+
+#endif // WITH_PLAYFAB_CLOUDSCRIPT_API
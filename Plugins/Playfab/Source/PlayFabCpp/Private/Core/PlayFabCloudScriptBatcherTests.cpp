@@ -0,0 +1,147 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+// Automation test PlayFab.CloudScript.BatchContract, run with: Automation RunTests PlayFab.CloudScript
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_PLAYFAB_CLOUDSCRIPT_API
+#include "Core/PlayFabCloudScriptBatcher.h"
+#include "Dom/JsonObject.h"
+
+using namespace PlayFab;
+using namespace PlayFab::CloudScriptModels;
+
+namespace
+{
+    // What reached the delegates of each call, by call Id
+    struct FDeliveries
+    {
+        TMap<int32, FExecuteFunctionResult> Results;
+        TMap<int32, FPlayFabCppError> Errors;
+    };
+
+    TSharedRef<TArray<PlayFabCloudScriptBatcher::FCall> > MakeCalls(const TArray<FString>& FunctionNames, FDeliveries& Deliveries)
+    {
+        TSharedRef<TArray<PlayFabCloudScriptBatcher::FCall> > Calls = MakeShared<TArray<PlayFabCloudScriptBatcher::FCall> >();
+        for (int32 Index = 0; Index < FunctionNames.Num(); ++Index)
+        {
+            PlayFabCloudScriptBatcher::FCall& Call = Calls->AddDefaulted_GetRef();
+            const int32 Id = Index + 1;
+            Call.Id = Id;
+            Call.Request.FunctionName = FunctionNames[Index];
+            Call.SuccessDelegate.BindLambda([&Deliveries, Id](const FExecuteFunctionResult& result) { Deliveries.Results.Add(Id, result); });
+            Call.ErrorDelegate.BindLambda([&Deliveries, Id](const FPlayFabCppError& error) { Deliveries.Errors.Add(Id, error); });
+        }
+        return Calls;
+    }
+
+    FExecuteFunctionResult MakeReply(const FString& RawFunctionResult)
+    {
+        FExecuteFunctionResult reply;
+        reply.FunctionName = TEXT("BatchDispatch");
+        reply.FunctionResult.SetRawJson(RawFunctionResult);
+        return reply;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlayFabCloudScriptBatchContractTest, "PlayFab.CloudScript.BatchContract", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FPlayFabCloudScriptBatchContractTest::RunTest(const FString& Parameters)
+{
+    // The envelope the dispatcher receives: every call with its Id and name, FunctionParameter only when the call has one
+    {
+        FDeliveries Deliveries;
+        TSharedRef<TArray<PlayFabCloudScriptBatcher::FCall> > Calls = MakeCalls({ TEXT("GrantReward"), TEXT("Ping") }, Deliveries);
+        (*Calls)[0].Request.FunctionParameter.SetRawJson(FString(TEXT("{\"amount\":5,\"note\":\"say \\\"hi\\\"\"}")));
+
+        FJsonKeeper FunctionParameter;
+        PlayFabCloudScriptBatcher::WriteEnvelope(*Calls, FunctionParameter);
+        const TSharedPtr<FJsonValue> Envelope = FunctionParameter.GetJsonValue();
+        const TSharedPtr<FJsonObject>* EnvelopeObject;
+        const TArray<TSharedPtr<FJsonValue> >* Entries;
+        if (!TestTrue(TEXT("the envelope has a Calls array"), Envelope.IsValid() && Envelope->TryGetObject(EnvelopeObject) && (*EnvelopeObject)->TryGetArrayField(TEXT("Calls"), Entries)))
+        {
+            return false;
+        }
+        if (!TestEqual(TEXT("every call is in the envelope"), Entries->Num(), 2))
+        {
+            return false;
+        }
+        const TSharedPtr<FJsonObject> First = (*Entries)[0]->AsObject();
+        const TSharedPtr<FJsonObject> Second = (*Entries)[1]->AsObject();
+        TestEqual(TEXT("first Id"), (int32)First->GetNumberField(TEXT("Id")), 1);
+        TestEqual(TEXT("first FunctionName"), First->GetStringField(TEXT("FunctionName")), FString(TEXT("GrantReward")));
+        TestEqual(TEXT("first FunctionParameter number"), (int32)First->GetObjectField(TEXT("FunctionParameter"))->GetNumberField(TEXT("amount")), 5);
+        TestEqual(TEXT("first FunctionParameter escaped text"), First->GetObjectField(TEXT("FunctionParameter"))->GetStringField(TEXT("note")), FString(TEXT("say \"hi\"")));
+        TestEqual(TEXT("second Id"), (int32)Second->GetNumberField(TEXT("Id")), 2);
+        TestFalse(TEXT("a call without FunctionParameter leaves it out"), Second->HasField(TEXT("FunctionParameter")));
+    }
+
+    // A reply out of order, with an entry without Id, an entry for an unknown Id, an entry with Error set, and a call left out
+    {
+        FDeliveries Deliveries;
+        TSharedRef<TArray<PlayFabCloudScriptBatcher::FCall> > Calls = MakeCalls({ TEXT("First"), TEXT("Second"), TEXT("Third") }, Deliveries);
+        const FExecuteFunctionResult reply = MakeReply(TEXT("{\"Results\":["
+            "{\"Id\":2,\"FunctionName\":\"Second\",\"Error\":{\"Error\":\"JavascriptException\",\"Message\":\"boom\"}},"
+            "{\"FunctionName\":\"NoId\"},"
+            "{\"Id\":99,\"FunctionName\":\"Unknown\"},"
+            "{\"Id\":1,\"FunctionName\":\"First\",\"FunctionResult\":{\"ok\":true},\"ExecutionTimeMilliseconds\":12}"
+            "]}"));
+
+        TMap<int32, FExecuteFunctionResult> Results;
+        TestTrue(TEXT("the reply is a Results envelope"), PlayFabCloudScriptBatcher::ReadResults(reply.FunctionResult, Results));
+        TestEqual(TEXT("the entry without Id is skipped"), Results.Num(), 3);
+
+        PlayFabCloudScriptBatcher::OnBatchResult(reply, Calls, TEXT("BatchDispatch"));
+        TestEqual(TEXT("every call hears back exactly once, the unknown Id reaches no one"), Deliveries.Results.Num() + Deliveries.Errors.Num(), 3);
+
+        const FExecuteFunctionResult* First = Deliveries.Results.Find(1);
+        if (TestNotNull(TEXT("the call answered last gets its result"), First))
+        {
+            TestEqual(TEXT("first FunctionName"), First->FunctionName, FString(TEXT("First")));
+            TestEqual(TEXT("first ExecutionTimeMilliseconds"), First->ExecutionTimeMilliseconds, 12);
+            TestTrue(TEXT("first FunctionResult"), First->FunctionResult.GetJsonValue().IsValid() && First->FunctionResult.GetJsonValue()->AsObject()->GetBoolField(TEXT("ok")));
+        }
+        const FExecuteFunctionResult* Second = Deliveries.Results.Find(2);
+        if (TestNotNull(TEXT("a call whose function failed reaches the success delegate"), Second))
+        {
+            TestTrue(TEXT("the function error is passed on"), Second->Error.IsValid() && Second->Error->Error == TEXT("JavascriptException") && Second->Error->Message == TEXT("boom"));
+        }
+        TestTrue(TEXT("a call left out of the reply fails"), Deliveries.Errors.Contains(3));
+    }
+
+    // A reply that isn't a Results envelope: every call reports the dispatcher's mistake
+    {
+        FDeliveries Deliveries;
+        TSharedRef<TArray<PlayFabCloudScriptBatcher::FCall> > Calls = MakeCalls({ TEXT("First"), TEXT("Second") }, Deliveries);
+        PlayFabCloudScriptBatcher::OnBatchResult(MakeReply(TEXT("{\"ok\":true}")), Calls, TEXT("BatchDispatch"));
+        TestEqual(TEXT("every call reaches its success delegate"), Deliveries.Results.Num(), 2);
+        for (const TPair<int32, FExecuteFunctionResult>& Delivery : Deliveries.Results)
+        {
+            TestTrue(TEXT("the call reports the invalid reply"), Delivery.Value.Error.IsValid() && Delivery.Value.Error->Error == TEXT("BatchDispatcherInvalidReply"));
+            TestEqual(TEXT("the call keeps its own name"), Delivery.Value.FunctionName, (*Calls)[Delivery.Key - 1].Request.FunctionName);
+        }
+    }
+
+    // The dispatcher itself failed: every call gets its error
+    {
+        FDeliveries Deliveries;
+        TSharedRef<TArray<PlayFabCloudScriptBatcher::FCall> > Calls = MakeCalls({ TEXT("First"), TEXT("Second") }, Deliveries);
+        FExecuteFunctionResult reply = MakeReply(TEXT("null"));
+        reply.Error = MakeShareable(new FFunctionExecutionError());
+        reply.Error->Error = TEXT("CloudScriptAzureFunctionsExecutionTimeLimitExceeded");
+        PlayFabCloudScriptBatcher::OnBatchResult(reply, Calls, TEXT("BatchDispatch"));
+        TestEqual(TEXT("every call reaches its success delegate"), Deliveries.Results.Num(), 2);
+        for (const TPair<int32, FExecuteFunctionResult>& Delivery : Deliveries.Results)
+        {
+            TestTrue(TEXT("the call reports the dispatcher error"), Delivery.Value.Error.IsValid() && Delivery.Value.Error->Error == TEXT("CloudScriptAzureFunctionsExecutionTimeLimitExceeded"));
+        }
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_PLAYFAB_CLOUDSCRIPT_API
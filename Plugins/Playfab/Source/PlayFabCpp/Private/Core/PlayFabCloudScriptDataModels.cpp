@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_CLOUDSCRIPT_API
 
 #include "Core/PlayFabCloudScriptDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -82,15 +83,15 @@ CloudScriptModels::CloudScriptRevisionOption PlayFab::CloudScriptModels::readClo
 
 CloudScriptModels::CloudScriptRevisionOption PlayFab::CloudScriptModels::readCloudScriptRevisionOptionFromValue(const FString& value)
 {
-    static TMap<FString, CloudScriptRevisionOption> _CloudScriptRevisionOptionMap;
-    if (_CloudScriptRevisionOptionMap.Num() == 0)
+    static const TMap<FString, CloudScriptRevisionOption> _CloudScriptRevisionOptionMap = []()
     {
-        // Auto-generate the map on the first use
-        _CloudScriptRevisionOptionMap.Add(TEXT("Live"), CloudScriptRevisionOptionLive);
-        _CloudScriptRevisionOptionMap.Add(TEXT("Latest"), CloudScriptRevisionOptionLatest);
-        _CloudScriptRevisionOptionMap.Add(TEXT("Specific"), CloudScriptRevisionOptionSpecific);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, CloudScriptRevisionOption> Map;
+        Map.Add(TEXT("Live"), CloudScriptRevisionOptionLive);
+        Map.Add(TEXT("Latest"), CloudScriptRevisionOptionLatest);
+        Map.Add(TEXT("Specific"), CloudScriptRevisionOptionSpecific);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -120,15 +121,15 @@ CloudScriptModels::EmailVerificationStatus PlayFab::CloudScriptModels::readEmail
 
 CloudScriptModels::EmailVerificationStatus PlayFab::CloudScriptModels::readEmailVerificationStatusFromValue(const FString& value)
 {
-    static TMap<FString, EmailVerificationStatus> _EmailVerificationStatusMap;
-    if (_EmailVerificationStatusMap.Num() == 0)
+    static const TMap<FString, EmailVerificationStatus> _EmailVerificationStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _EmailVerificationStatusMap.Add(TEXT("Unverified"), EmailVerificationStatusUnverified);
-        _EmailVerificationStatusMap.Add(TEXT("Pending"), EmailVerificationStatusPending);
-        _EmailVerificationStatusMap.Add(TEXT("Confirmed"), EmailVerificationStatusConfirmed);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, EmailVerificationStatus> Map;
+        Map.Add(TEXT("Unverified"), EmailVerificationStatusUnverified);
+        Map.Add(TEXT("Pending"), EmailVerificationStatusPending);
+        Map.Add(TEXT("Confirmed"), EmailVerificationStatusConfirmed);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -216,20 +217,20 @@ CloudScriptModels::ContinentCode PlayFab::CloudScriptModels::readContinentCodeFr
 
 CloudScriptModels::ContinentCode PlayFab::CloudScriptModels::readContinentCodeFromValue(const FString& value)
 {
-    static TMap<FString, ContinentCode> _ContinentCodeMap;
-    if (_ContinentCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _ContinentCodeMap.Add(TEXT("AF"), ContinentCodeAF);
-        _ContinentCodeMap.Add(TEXT("AN"), ContinentCodeAN);
-        _ContinentCodeMap.Add(TEXT("AS"), ContinentCodeAS);
-        _ContinentCodeMap.Add(TEXT("EU"), ContinentCodeEU);
-        _ContinentCodeMap.Add(TEXT("NA"), ContinentCodeNA);
-        _ContinentCodeMap.Add(TEXT("OC"), ContinentCodeOC);
-        _ContinentCodeMap.Add(TEXT("SA"), ContinentCodeSA);
-        _ContinentCodeMap.Add(TEXT("Unknown"), ContinentCodeUnknown);
-
-    }
+    static const TMap<FString, ContinentCode> _ContinentCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ContinentCode> Map;
+        Map.Add(TEXT("AF"), ContinentCodeAF);
+        Map.Add(TEXT("AN"), ContinentCodeAN);
+        Map.Add(TEXT("AS"), ContinentCodeAS);
+        Map.Add(TEXT("EU"), ContinentCodeEU);
+        Map.Add(TEXT("NA"), ContinentCodeNA);
+        Map.Add(TEXT("OC"), ContinentCodeOC);
+        Map.Add(TEXT("SA"), ContinentCodeSA);
+        Map.Add(TEXT("Unknown"), ContinentCodeUnknown);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -506,262 +507,262 @@ CloudScriptModels::CountryCode PlayFab::CloudScriptModels::readCountryCodeFromVa
 
 CloudScriptModels::CountryCode PlayFab::CloudScriptModels::readCountryCodeFromValue(const FString& value)
 {
-    static TMap<FString, CountryCode> _CountryCodeMap;
-    if (_CountryCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _CountryCodeMap.Add(TEXT("AF"), CountryCodeAF);
-        _CountryCodeMap.Add(TEXT("AX"), CountryCodeAX);
-        _CountryCodeMap.Add(TEXT("AL"), CountryCodeAL);
-        _CountryCodeMap.Add(TEXT("DZ"), CountryCodeDZ);
-        _CountryCodeMap.Add(TEXT("AS"), CountryCodeAS);
-        _CountryCodeMap.Add(TEXT("AD"), CountryCodeAD);
-        _CountryCodeMap.Add(TEXT("AO"), CountryCodeAO);
-        _CountryCodeMap.Add(TEXT("AI"), CountryCodeAI);
-        _CountryCodeMap.Add(TEXT("AQ"), CountryCodeAQ);
-        _CountryCodeMap.Add(TEXT("AG"), CountryCodeAG);
-        _CountryCodeMap.Add(TEXT("AR"), CountryCodeAR);
-        _CountryCodeMap.Add(TEXT("AM"), CountryCodeAM);
-        _CountryCodeMap.Add(TEXT("AW"), CountryCodeAW);
-        _CountryCodeMap.Add(TEXT("AU"), CountryCodeAU);
-        _CountryCodeMap.Add(TEXT("AT"), CountryCodeAT);
-        _CountryCodeMap.Add(TEXT("AZ"), CountryCodeAZ);
-        _CountryCodeMap.Add(TEXT("BS"), CountryCodeBS);
-        _CountryCodeMap.Add(TEXT("BH"), CountryCodeBH);
-        _CountryCodeMap.Add(TEXT("BD"), CountryCodeBD);
-        _CountryCodeMap.Add(TEXT("BB"), CountryCodeBB);
-        _CountryCodeMap.Add(TEXT("BY"), CountryCodeBY);
-        _CountryCodeMap.Add(TEXT("BE"), CountryCodeBE);
-        _CountryCodeMap.Add(TEXT("BZ"), CountryCodeBZ);
-        _CountryCodeMap.Add(TEXT("BJ"), CountryCodeBJ);
-        _CountryCodeMap.Add(TEXT("BM"), CountryCodeBM);
-        _CountryCodeMap.Add(TEXT("BT"), CountryCodeBT);
-        _CountryCodeMap.Add(TEXT("BO"), CountryCodeBO);
-        _CountryCodeMap.Add(TEXT("BQ"), CountryCodeBQ);
-        _CountryCodeMap.Add(TEXT("BA"), CountryCodeBA);
-        _CountryCodeMap.Add(TEXT("BW"), CountryCodeBW);
-        _CountryCodeMap.Add(TEXT("BV"), CountryCodeBV);
-        _CountryCodeMap.Add(TEXT("BR"), CountryCodeBR);
-        _CountryCodeMap.Add(TEXT("IO"), CountryCodeIO);
-        _CountryCodeMap.Add(TEXT("BN"), CountryCodeBN);
-        _CountryCodeMap.Add(TEXT("BG"), CountryCodeBG);
-        _CountryCodeMap.Add(TEXT("BF"), CountryCodeBF);
-        _CountryCodeMap.Add(TEXT("BI"), CountryCodeBI);
-        _CountryCodeMap.Add(TEXT("KH"), CountryCodeKH);
-        _CountryCodeMap.Add(TEXT("CM"), CountryCodeCM);
-        _CountryCodeMap.Add(TEXT("CA"), CountryCodeCA);
-        _CountryCodeMap.Add(TEXT("CV"), CountryCodeCV);
-        _CountryCodeMap.Add(TEXT("KY"), CountryCodeKY);
-        _CountryCodeMap.Add(TEXT("CF"), CountryCodeCF);
-        _CountryCodeMap.Add(TEXT("TD"), CountryCodeTD);
-        _CountryCodeMap.Add(TEXT("CL"), CountryCodeCL);
-        _CountryCodeMap.Add(TEXT("CN"), CountryCodeCN);
-        _CountryCodeMap.Add(TEXT("CX"), CountryCodeCX);
-        _CountryCodeMap.Add(TEXT("CC"), CountryCodeCC);
-        _CountryCodeMap.Add(TEXT("CO"), CountryCodeCO);
-        _CountryCodeMap.Add(TEXT("KM"), CountryCodeKM);
-        _CountryCodeMap.Add(TEXT("CG"), CountryCodeCG);
-        _CountryCodeMap.Add(TEXT("CD"), CountryCodeCD);
-        _CountryCodeMap.Add(TEXT("CK"), CountryCodeCK);
-        _CountryCodeMap.Add(TEXT("CR"), CountryCodeCR);
-        _CountryCodeMap.Add(TEXT("CI"), CountryCodeCI);
-        _CountryCodeMap.Add(TEXT("HR"), CountryCodeHR);
-        _CountryCodeMap.Add(TEXT("CU"), CountryCodeCU);
-        _CountryCodeMap.Add(TEXT("CW"), CountryCodeCW);
-        _CountryCodeMap.Add(TEXT("CY"), CountryCodeCY);
-        _CountryCodeMap.Add(TEXT("CZ"), CountryCodeCZ);
-        _CountryCodeMap.Add(TEXT("DK"), CountryCodeDK);
-        _CountryCodeMap.Add(TEXT("DJ"), CountryCodeDJ);
-        _CountryCodeMap.Add(TEXT("DM"), CountryCodeDM);
-        _CountryCodeMap.Add(TEXT("DO"), CountryCodeDO);
-        _CountryCodeMap.Add(TEXT("EC"), CountryCodeEC);
-        _CountryCodeMap.Add(TEXT("EG"), CountryCodeEG);
-        _CountryCodeMap.Add(TEXT("SV"), CountryCodeSV);
-        _CountryCodeMap.Add(TEXT("GQ"), CountryCodeGQ);
-        _CountryCodeMap.Add(TEXT("ER"), CountryCodeER);
-        _CountryCodeMap.Add(TEXT("EE"), CountryCodeEE);
-        _CountryCodeMap.Add(TEXT("ET"), CountryCodeET);
-        _CountryCodeMap.Add(TEXT("FK"), CountryCodeFK);
-        _CountryCodeMap.Add(TEXT("FO"), CountryCodeFO);
-        _CountryCodeMap.Add(TEXT("FJ"), CountryCodeFJ);
-        _CountryCodeMap.Add(TEXT("FI"), CountryCodeFI);
-        _CountryCodeMap.Add(TEXT("FR"), CountryCodeFR);
-        _CountryCodeMap.Add(TEXT("GF"), CountryCodeGF);
-        _CountryCodeMap.Add(TEXT("PF"), CountryCodePF);
-        _CountryCodeMap.Add(TEXT("TF"), CountryCodeTF);
-        _CountryCodeMap.Add(TEXT("GA"), CountryCodeGA);
-        _CountryCodeMap.Add(TEXT("GM"), CountryCodeGM);
-        _CountryCodeMap.Add(TEXT("GE"), CountryCodeGE);
-        _CountryCodeMap.Add(TEXT("DE"), CountryCodeDE);
-        _CountryCodeMap.Add(TEXT("GH"), CountryCodeGH);
-        _CountryCodeMap.Add(TEXT("GI"), CountryCodeGI);
-        _CountryCodeMap.Add(TEXT("GR"), CountryCodeGR);
-        _CountryCodeMap.Add(TEXT("GL"), CountryCodeGL);
-        _CountryCodeMap.Add(TEXT("GD"), CountryCodeGD);
-        _CountryCodeMap.Add(TEXT("GP"), CountryCodeGP);
-        _CountryCodeMap.Add(TEXT("GU"), CountryCodeGU);
-        _CountryCodeMap.Add(TEXT("GT"), CountryCodeGT);
-        _CountryCodeMap.Add(TEXT("GG"), CountryCodeGG);
-        _CountryCodeMap.Add(TEXT("GN"), CountryCodeGN);
-        _CountryCodeMap.Add(TEXT("GW"), CountryCodeGW);
-        _CountryCodeMap.Add(TEXT("GY"), CountryCodeGY);
-        _CountryCodeMap.Add(TEXT("HT"), CountryCodeHT);
-        _CountryCodeMap.Add(TEXT("HM"), CountryCodeHM);
-        _CountryCodeMap.Add(TEXT("VA"), CountryCodeVA);
-        _CountryCodeMap.Add(TEXT("HN"), CountryCodeHN);
-        _CountryCodeMap.Add(TEXT("HK"), CountryCodeHK);
-        _CountryCodeMap.Add(TEXT("HU"), CountryCodeHU);
-        _CountryCodeMap.Add(TEXT("IS"), CountryCodeIS);
-        _CountryCodeMap.Add(TEXT("IN"), CountryCodeIN);
-        _CountryCodeMap.Add(TEXT("ID"), CountryCodeID);
-        _CountryCodeMap.Add(TEXT("IR"), CountryCodeIR);
-        _CountryCodeMap.Add(TEXT("IQ"), CountryCodeIQ);
-        _CountryCodeMap.Add(TEXT("IE"), CountryCodeIE);
-        _CountryCodeMap.Add(TEXT("IM"), CountryCodeIM);
-        _CountryCodeMap.Add(TEXT("IL"), CountryCodeIL);
-        _CountryCodeMap.Add(TEXT("IT"), CountryCodeIT);
-        _CountryCodeMap.Add(TEXT("JM"), CountryCodeJM);
-        _CountryCodeMap.Add(TEXT("JP"), CountryCodeJP);
-        _CountryCodeMap.Add(TEXT("JE"), CountryCodeJE);
-        _CountryCodeMap.Add(TEXT("JO"), CountryCodeJO);
-        _CountryCodeMap.Add(TEXT("KZ"), CountryCodeKZ);
-        _CountryCodeMap.Add(TEXT("KE"), CountryCodeKE);
-        _CountryCodeMap.Add(TEXT("KI"), CountryCodeKI);
-        _CountryCodeMap.Add(TEXT("KP"), CountryCodeKP);
-        _CountryCodeMap.Add(TEXT("KR"), CountryCodeKR);
-        _CountryCodeMap.Add(TEXT("KW"), CountryCodeKW);
-        _CountryCodeMap.Add(TEXT("KG"), CountryCodeKG);
-        _CountryCodeMap.Add(TEXT("LA"), CountryCodeLA);
-        _CountryCodeMap.Add(TEXT("LV"), CountryCodeLV);
-        _CountryCodeMap.Add(TEXT("LB"), CountryCodeLB);
-        _CountryCodeMap.Add(TEXT("LS"), CountryCodeLS);
-        _CountryCodeMap.Add(TEXT("LR"), CountryCodeLR);
-        _CountryCodeMap.Add(TEXT("LY"), CountryCodeLY);
-        _CountryCodeMap.Add(TEXT("LI"), CountryCodeLI);
-        _CountryCodeMap.Add(TEXT("LT"), CountryCodeLT);
-        _CountryCodeMap.Add(TEXT("LU"), CountryCodeLU);
-        _CountryCodeMap.Add(TEXT("MO"), CountryCodeMO);
-        _CountryCodeMap.Add(TEXT("MK"), CountryCodeMK);
-        _CountryCodeMap.Add(TEXT("MG"), CountryCodeMG);
-        _CountryCodeMap.Add(TEXT("MW"), CountryCodeMW);
-        _CountryCodeMap.Add(TEXT("MY"), CountryCodeMY);
-        _CountryCodeMap.Add(TEXT("MV"), CountryCodeMV);
-        _CountryCodeMap.Add(TEXT("ML"), CountryCodeML);
-        _CountryCodeMap.Add(TEXT("MT"), CountryCodeMT);
-        _CountryCodeMap.Add(TEXT("MH"), CountryCodeMH);
-        _CountryCodeMap.Add(TEXT("MQ"), CountryCodeMQ);
-        _CountryCodeMap.Add(TEXT("MR"), CountryCodeMR);
-        _CountryCodeMap.Add(TEXT("MU"), CountryCodeMU);
-        _CountryCodeMap.Add(TEXT("YT"), CountryCodeYT);
-        _CountryCodeMap.Add(TEXT("MX"), CountryCodeMX);
-        _CountryCodeMap.Add(TEXT("FM"), CountryCodeFM);
-        _CountryCodeMap.Add(TEXT("MD"), CountryCodeMD);
-        _CountryCodeMap.Add(TEXT("MC"), CountryCodeMC);
-        _CountryCodeMap.Add(TEXT("MN"), CountryCodeMN);
-        _CountryCodeMap.Add(TEXT("ME"), CountryCodeME);
-        _CountryCodeMap.Add(TEXT("MS"), CountryCodeMS);
-        _CountryCodeMap.Add(TEXT("MA"), CountryCodeMA);
-        _CountryCodeMap.Add(TEXT("MZ"), CountryCodeMZ);
-        _CountryCodeMap.Add(TEXT("MM"), CountryCodeMM);
-        _CountryCodeMap.Add(TEXT("NA"), CountryCodeNA);
-        _CountryCodeMap.Add(TEXT("NR"), CountryCodeNR);
-        _CountryCodeMap.Add(TEXT("NP"), CountryCodeNP);
-        _CountryCodeMap.Add(TEXT("NL"), CountryCodeNL);
-        _CountryCodeMap.Add(TEXT("NC"), CountryCodeNC);
-        _CountryCodeMap.Add(TEXT("NZ"), CountryCodeNZ);
-        _CountryCodeMap.Add(TEXT("NI"), CountryCodeNI);
-        _CountryCodeMap.Add(TEXT("NE"), CountryCodeNE);
-        _CountryCodeMap.Add(TEXT("NG"), CountryCodeNG);
-        _CountryCodeMap.Add(TEXT("NU"), CountryCodeNU);
-        _CountryCodeMap.Add(TEXT("NF"), CountryCodeNF);
-        _CountryCodeMap.Add(TEXT("MP"), CountryCodeMP);
-        _CountryCodeMap.Add(TEXT("NO"), CountryCodeNO);
-        _CountryCodeMap.Add(TEXT("OM"), CountryCodeOM);
-        _CountryCodeMap.Add(TEXT("PK"), CountryCodePK);
-        _CountryCodeMap.Add(TEXT("PW"), CountryCodePW);
-        _CountryCodeMap.Add(TEXT("PS"), CountryCodePS);
-        _CountryCodeMap.Add(TEXT("PA"), CountryCodePA);
-        _CountryCodeMap.Add(TEXT("PG"), CountryCodePG);
-        _CountryCodeMap.Add(TEXT("PY"), CountryCodePY);
-        _CountryCodeMap.Add(TEXT("PE"), CountryCodePE);
-        _CountryCodeMap.Add(TEXT("PH"), CountryCodePH);
-        _CountryCodeMap.Add(TEXT("PN"), CountryCodePN);
-        _CountryCodeMap.Add(TEXT("PL"), CountryCodePL);
-        _CountryCodeMap.Add(TEXT("PT"), CountryCodePT);
-        _CountryCodeMap.Add(TEXT("PR"), CountryCodePR);
-        _CountryCodeMap.Add(TEXT("QA"), CountryCodeQA);
-        _CountryCodeMap.Add(TEXT("RE"), CountryCodeRE);
-        _CountryCodeMap.Add(TEXT("RO"), CountryCodeRO);
-        _CountryCodeMap.Add(TEXT("RU"), CountryCodeRU);
-        _CountryCodeMap.Add(TEXT("RW"), CountryCodeRW);
-        _CountryCodeMap.Add(TEXT("BL"), CountryCodeBL);
-        _CountryCodeMap.Add(TEXT("SH"), CountryCodeSH);
-        _CountryCodeMap.Add(TEXT("KN"), CountryCodeKN);
-        _CountryCodeMap.Add(TEXT("LC"), CountryCodeLC);
-        _CountryCodeMap.Add(TEXT("MF"), CountryCodeMF);
-        _CountryCodeMap.Add(TEXT("PM"), CountryCodePM);
-        _CountryCodeMap.Add(TEXT("VC"), CountryCodeVC);
-        _CountryCodeMap.Add(TEXT("WS"), CountryCodeWS);
-        _CountryCodeMap.Add(TEXT("SM"), CountryCodeSM);
-        _CountryCodeMap.Add(TEXT("ST"), CountryCodeST);
-        _CountryCodeMap.Add(TEXT("SA"), CountryCodeSA);
-        _CountryCodeMap.Add(TEXT("SN"), CountryCodeSN);
-        _CountryCodeMap.Add(TEXT("RS"), CountryCodeRS);
-        _CountryCodeMap.Add(TEXT("SC"), CountryCodeSC);
-        _CountryCodeMap.Add(TEXT("SL"), CountryCodeSL);
-        _CountryCodeMap.Add(TEXT("SG"), CountryCodeSG);
-        _CountryCodeMap.Add(TEXT("SX"), CountryCodeSX);
-        _CountryCodeMap.Add(TEXT("SK"), CountryCodeSK);
-        _CountryCodeMap.Add(TEXT("SI"), CountryCodeSI);
-        _CountryCodeMap.Add(TEXT("SB"), CountryCodeSB);
-        _CountryCodeMap.Add(TEXT("SO"), CountryCodeSO);
-        _CountryCodeMap.Add(TEXT("ZA"), CountryCodeZA);
-        _CountryCodeMap.Add(TEXT("GS"), CountryCodeGS);
-        _CountryCodeMap.Add(TEXT("SS"), CountryCodeSS);
-        _CountryCodeMap.Add(TEXT("ES"), CountryCodeES);
-        _CountryCodeMap.Add(TEXT("LK"), CountryCodeLK);
-        _CountryCodeMap.Add(TEXT("SD"), CountryCodeSD);
-        _CountryCodeMap.Add(TEXT("SR"), CountryCodeSR);
-        _CountryCodeMap.Add(TEXT("SJ"), CountryCodeSJ);
-        _CountryCodeMap.Add(TEXT("SZ"), CountryCodeSZ);
-        _CountryCodeMap.Add(TEXT("SE"), CountryCodeSE);
-        _CountryCodeMap.Add(TEXT("CH"), CountryCodeCH);
-        _CountryCodeMap.Add(TEXT("SY"), CountryCodeSY);
-        _CountryCodeMap.Add(TEXT("TW"), CountryCodeTW);
-        _CountryCodeMap.Add(TEXT("TJ"), CountryCodeTJ);
-        _CountryCodeMap.Add(TEXT("TZ"), CountryCodeTZ);
-        _CountryCodeMap.Add(TEXT("TH"), CountryCodeTH);
-        _CountryCodeMap.Add(TEXT("TL"), CountryCodeTL);
-        _CountryCodeMap.Add(TEXT("TG"), CountryCodeTG);
-        _CountryCodeMap.Add(TEXT("TK"), CountryCodeTK);
-        _CountryCodeMap.Add(TEXT("TO"), CountryCodeTO);
-        _CountryCodeMap.Add(TEXT("TT"), CountryCodeTT);
-        _CountryCodeMap.Add(TEXT("TN"), CountryCodeTN);
-        _CountryCodeMap.Add(TEXT("TR"), CountryCodeTR);
-        _CountryCodeMap.Add(TEXT("TM"), CountryCodeTM);
-        _CountryCodeMap.Add(TEXT("TC"), CountryCodeTC);
-        _CountryCodeMap.Add(TEXT("TV"), CountryCodeTV);
-        _CountryCodeMap.Add(TEXT("UG"), CountryCodeUG);
-        _CountryCodeMap.Add(TEXT("UA"), CountryCodeUA);
-        _CountryCodeMap.Add(TEXT("AE"), CountryCodeAE);
-        _CountryCodeMap.Add(TEXT("GB"), CountryCodeGB);
-        _CountryCodeMap.Add(TEXT("US"), CountryCodeUS);
-        _CountryCodeMap.Add(TEXT("UM"), CountryCodeUM);
-        _CountryCodeMap.Add(TEXT("UY"), CountryCodeUY);
-        _CountryCodeMap.Add(TEXT("UZ"), CountryCodeUZ);
-        _CountryCodeMap.Add(TEXT("VU"), CountryCodeVU);
-        _CountryCodeMap.Add(TEXT("VE"), CountryCodeVE);
-        _CountryCodeMap.Add(TEXT("VN"), CountryCodeVN);
-        _CountryCodeMap.Add(TEXT("VG"), CountryCodeVG);
-        _CountryCodeMap.Add(TEXT("VI"), CountryCodeVI);
-        _CountryCodeMap.Add(TEXT("WF"), CountryCodeWF);
-        _CountryCodeMap.Add(TEXT("EH"), CountryCodeEH);
-        _CountryCodeMap.Add(TEXT("YE"), CountryCodeYE);
-        _CountryCodeMap.Add(TEXT("ZM"), CountryCodeZM);
-        _CountryCodeMap.Add(TEXT("ZW"), CountryCodeZW);
-        _CountryCodeMap.Add(TEXT("Unknown"), CountryCodeUnknown);
-
-    }
+    static const TMap<FString, CountryCode> _CountryCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, CountryCode> Map;
+        Map.Add(TEXT("AF"), CountryCodeAF);
+        Map.Add(TEXT("AX"), CountryCodeAX);
+        Map.Add(TEXT("AL"), CountryCodeAL);
+        Map.Add(TEXT("DZ"), CountryCodeDZ);
+        Map.Add(TEXT("AS"), CountryCodeAS);
+        Map.Add(TEXT("AD"), CountryCodeAD);
+        Map.Add(TEXT("AO"), CountryCodeAO);
+        Map.Add(TEXT("AI"), CountryCodeAI);
+        Map.Add(TEXT("AQ"), CountryCodeAQ);
+        Map.Add(TEXT("AG"), CountryCodeAG);
+        Map.Add(TEXT("AR"), CountryCodeAR);
+        Map.Add(TEXT("AM"), CountryCodeAM);
+        Map.Add(TEXT("AW"), CountryCodeAW);
+        Map.Add(TEXT("AU"), CountryCodeAU);
+        Map.Add(TEXT("AT"), CountryCodeAT);
+        Map.Add(TEXT("AZ"), CountryCodeAZ);
+        Map.Add(TEXT("BS"), CountryCodeBS);
+        Map.Add(TEXT("BH"), CountryCodeBH);
+        Map.Add(TEXT("BD"), CountryCodeBD);
+        Map.Add(TEXT("BB"), CountryCodeBB);
+        Map.Add(TEXT("BY"), CountryCodeBY);
+        Map.Add(TEXT("BE"), CountryCodeBE);
+        Map.Add(TEXT("BZ"), CountryCodeBZ);
+        Map.Add(TEXT("BJ"), CountryCodeBJ);
+        Map.Add(TEXT("BM"), CountryCodeBM);
+        Map.Add(TEXT("BT"), CountryCodeBT);
+        Map.Add(TEXT("BO"), CountryCodeBO);
+        Map.Add(TEXT("BQ"), CountryCodeBQ);
+        Map.Add(TEXT("BA"), CountryCodeBA);
+        Map.Add(TEXT("BW"), CountryCodeBW);
+        Map.Add(TEXT("BV"), CountryCodeBV);
+        Map.Add(TEXT("BR"), CountryCodeBR);
+        Map.Add(TEXT("IO"), CountryCodeIO);
+        Map.Add(TEXT("BN"), CountryCodeBN);
+        Map.Add(TEXT("BG"), CountryCodeBG);
+        Map.Add(TEXT("BF"), CountryCodeBF);
+        Map.Add(TEXT("BI"), CountryCodeBI);
+        Map.Add(TEXT("KH"), CountryCodeKH);
+        Map.Add(TEXT("CM"), CountryCodeCM);
+        Map.Add(TEXT("CA"), CountryCodeCA);
+        Map.Add(TEXT("CV"), CountryCodeCV);
+        Map.Add(TEXT("KY"), CountryCodeKY);
+        Map.Add(TEXT("CF"), CountryCodeCF);
+        Map.Add(TEXT("TD"), CountryCodeTD);
+        Map.Add(TEXT("CL"), CountryCodeCL);
+        Map.Add(TEXT("CN"), CountryCodeCN);
+        Map.Add(TEXT("CX"), CountryCodeCX);
+        Map.Add(TEXT("CC"), CountryCodeCC);
+        Map.Add(TEXT("CO"), CountryCodeCO);
+        Map.Add(TEXT("KM"), CountryCodeKM);
+        Map.Add(TEXT("CG"), CountryCodeCG);
+        Map.Add(TEXT("CD"), CountryCodeCD);
+        Map.Add(TEXT("CK"), CountryCodeCK);
+        Map.Add(TEXT("CR"), CountryCodeCR);
+        Map.Add(TEXT("CI"), CountryCodeCI);
+        Map.Add(TEXT("HR"), CountryCodeHR);
+        Map.Add(TEXT("CU"), CountryCodeCU);
+        Map.Add(TEXT("CW"), CountryCodeCW);
+        Map.Add(TEXT("CY"), CountryCodeCY);
+        Map.Add(TEXT("CZ"), CountryCodeCZ);
+        Map.Add(TEXT("DK"), CountryCodeDK);
+        Map.Add(TEXT("DJ"), CountryCodeDJ);
+        Map.Add(TEXT("DM"), CountryCodeDM);
+        Map.Add(TEXT("DO"), CountryCodeDO);
+        Map.Add(TEXT("EC"), CountryCodeEC);
+        Map.Add(TEXT("EG"), CountryCodeEG);
+        Map.Add(TEXT("SV"), CountryCodeSV);
+        Map.Add(TEXT("GQ"), CountryCodeGQ);
+        Map.Add(TEXT("ER"), CountryCodeER);
+        Map.Add(TEXT("EE"), CountryCodeEE);
+        Map.Add(TEXT("ET"), CountryCodeET);
+        Map.Add(TEXT("FK"), CountryCodeFK);
+        Map.Add(TEXT("FO"), CountryCodeFO);
+        Map.Add(TEXT("FJ"), CountryCodeFJ);
+        Map.Add(TEXT("FI"), CountryCodeFI);
+        Map.Add(TEXT("FR"), CountryCodeFR);
+        Map.Add(TEXT("GF"), CountryCodeGF);
+        Map.Add(TEXT("PF"), CountryCodePF);
+        Map.Add(TEXT("TF"), CountryCodeTF);
+        Map.Add(TEXT("GA"), CountryCodeGA);
+        Map.Add(TEXT("GM"), CountryCodeGM);
+        Map.Add(TEXT("GE"), CountryCodeGE);
+        Map.Add(TEXT("DE"), CountryCodeDE);
+        Map.Add(TEXT("GH"), CountryCodeGH);
+        Map.Add(TEXT("GI"), CountryCodeGI);
+        Map.Add(TEXT("GR"), CountryCodeGR);
+        Map.Add(TEXT("GL"), CountryCodeGL);
+        Map.Add(TEXT("GD"), CountryCodeGD);
+        Map.Add(TEXT("GP"), CountryCodeGP);
+        Map.Add(TEXT("GU"), CountryCodeGU);
+        Map.Add(TEXT("GT"), CountryCodeGT);
+        Map.Add(TEXT("GG"), CountryCodeGG);
+        Map.Add(TEXT("GN"), CountryCodeGN);
+        Map.Add(TEXT("GW"), CountryCodeGW);
+        Map.Add(TEXT("GY"), CountryCodeGY);
+        Map.Add(TEXT("HT"), CountryCodeHT);
+        Map.Add(TEXT("HM"), CountryCodeHM);
+        Map.Add(TEXT("VA"), CountryCodeVA);
+        Map.Add(TEXT("HN"), CountryCodeHN);
+        Map.Add(TEXT("HK"), CountryCodeHK);
+        Map.Add(TEXT("HU"), CountryCodeHU);
+        Map.Add(TEXT("IS"), CountryCodeIS);
+        Map.Add(TEXT("IN"), CountryCodeIN);
+        Map.Add(TEXT("ID"), CountryCodeID);
+        Map.Add(TEXT("IR"), CountryCodeIR);
+        Map.Add(TEXT("IQ"), CountryCodeIQ);
+        Map.Add(TEXT("IE"), CountryCodeIE);
+        Map.Add(TEXT("IM"), CountryCodeIM);
+        Map.Add(TEXT("IL"), CountryCodeIL);
+        Map.Add(TEXT("IT"), CountryCodeIT);
+        Map.Add(TEXT("JM"), CountryCodeJM);
+        Map.Add(TEXT("JP"), CountryCodeJP);
+        Map.Add(TEXT("JE"), CountryCodeJE);
+        Map.Add(TEXT("JO"), CountryCodeJO);
+        Map.Add(TEXT("KZ"), CountryCodeKZ);
+        Map.Add(TEXT("KE"), CountryCodeKE);
+        Map.Add(TEXT("KI"), CountryCodeKI);
+        Map.Add(TEXT("KP"), CountryCodeKP);
+        Map.Add(TEXT("KR"), CountryCodeKR);
+        Map.Add(TEXT("KW"), CountryCodeKW);
+        Map.Add(TEXT("KG"), CountryCodeKG);
+        Map.Add(TEXT("LA"), CountryCodeLA);
+        Map.Add(TEXT("LV"), CountryCodeLV);
+        Map.Add(TEXT("LB"), CountryCodeLB);
+        Map.Add(TEXT("LS"), CountryCodeLS);
+        Map.Add(TEXT("LR"), CountryCodeLR);
+        Map.Add(TEXT("LY"), CountryCodeLY);
+        Map.Add(TEXT("LI"), CountryCodeLI);
+        Map.Add(TEXT("LT"), CountryCodeLT);
+        Map.Add(TEXT("LU"), CountryCodeLU);
+        Map.Add(TEXT("MO"), CountryCodeMO);
+        Map.Add(TEXT("MK"), CountryCodeMK);
+        Map.Add(TEXT("MG"), CountryCodeMG);
+        Map.Add(TEXT("MW"), CountryCodeMW);
+        Map.Add(TEXT("MY"), CountryCodeMY);
+        Map.Add(TEXT("MV"), CountryCodeMV);
+        Map.Add(TEXT("ML"), CountryCodeML);
+        Map.Add(TEXT("MT"), CountryCodeMT);
+        Map.Add(TEXT("MH"), CountryCodeMH);
+        Map.Add(TEXT("MQ"), CountryCodeMQ);
+        Map.Add(TEXT("MR"), CountryCodeMR);
+        Map.Add(TEXT("MU"), CountryCodeMU);
+        Map.Add(TEXT("YT"), CountryCodeYT);
+        Map.Add(TEXT("MX"), CountryCodeMX);
+        Map.Add(TEXT("FM"), CountryCodeFM);
+        Map.Add(TEXT("MD"), CountryCodeMD);
+        Map.Add(TEXT("MC"), CountryCodeMC);
+        Map.Add(TEXT("MN"), CountryCodeMN);
+        Map.Add(TEXT("ME"), CountryCodeME);
+        Map.Add(TEXT("MS"), CountryCodeMS);
+        Map.Add(TEXT("MA"), CountryCodeMA);
+        Map.Add(TEXT("MZ"), CountryCodeMZ);
+        Map.Add(TEXT("MM"), CountryCodeMM);
+        Map.Add(TEXT("NA"), CountryCodeNA);
+        Map.Add(TEXT("NR"), CountryCodeNR);
+        Map.Add(TEXT("NP"), CountryCodeNP);
+        Map.Add(TEXT("NL"), CountryCodeNL);
+        Map.Add(TEXT("NC"), CountryCodeNC);
+        Map.Add(TEXT("NZ"), CountryCodeNZ);
+        Map.Add(TEXT("NI"), CountryCodeNI);
+        Map.Add(TEXT("NE"), CountryCodeNE);
+        Map.Add(TEXT("NG"), CountryCodeNG);
+        Map.Add(TEXT("NU"), CountryCodeNU);
+        Map.Add(TEXT("NF"), CountryCodeNF);
+        Map.Add(TEXT("MP"), CountryCodeMP);
+        Map.Add(TEXT("NO"), CountryCodeNO);
+        Map.Add(TEXT("OM"), CountryCodeOM);
+        Map.Add(TEXT("PK"), CountryCodePK);
+        Map.Add(TEXT("PW"), CountryCodePW);
+        Map.Add(TEXT("PS"), CountryCodePS);
+        Map.Add(TEXT("PA"), CountryCodePA);
+        Map.Add(TEXT("PG"), CountryCodePG);
+        Map.Add(TEXT("PY"), CountryCodePY);
+        Map.Add(TEXT("PE"), CountryCodePE);
+        Map.Add(TEXT("PH"), CountryCodePH);
+        Map.Add(TEXT("PN"), CountryCodePN);
+        Map.Add(TEXT("PL"), CountryCodePL);
+        Map.Add(TEXT("PT"), CountryCodePT);
+        Map.Add(TEXT("PR"), CountryCodePR);
+        Map.Add(TEXT("QA"), CountryCodeQA);
+        Map.Add(TEXT("RE"), CountryCodeRE);
+        Map.Add(TEXT("RO"), CountryCodeRO);
+        Map.Add(TEXT("RU"), CountryCodeRU);
+        Map.Add(TEXT("RW"), CountryCodeRW);
+        Map.Add(TEXT("BL"), CountryCodeBL);
+        Map.Add(TEXT("SH"), CountryCodeSH);
+        Map.Add(TEXT("KN"), CountryCodeKN);
+        Map.Add(TEXT("LC"), CountryCodeLC);
+        Map.Add(TEXT("MF"), CountryCodeMF);
+        Map.Add(TEXT("PM"), CountryCodePM);
+        Map.Add(TEXT("VC"), CountryCodeVC);
+        Map.Add(TEXT("WS"), CountryCodeWS);
+        Map.Add(TEXT("SM"), CountryCodeSM);
+        Map.Add(TEXT("ST"), CountryCodeST);
+        Map.Add(TEXT("SA"), CountryCodeSA);
+        Map.Add(TEXT("SN"), CountryCodeSN);
+        Map.Add(TEXT("RS"), CountryCodeRS);
+        Map.Add(TEXT("SC"), CountryCodeSC);
+        Map.Add(TEXT("SL"), CountryCodeSL);
+        Map.Add(TEXT("SG"), CountryCodeSG);
+        Map.Add(TEXT("SX"), CountryCodeSX);
+        Map.Add(TEXT("SK"), CountryCodeSK);
+        Map.Add(TEXT("SI"), CountryCodeSI);
+        Map.Add(TEXT("SB"), CountryCodeSB);
+        Map.Add(TEXT("SO"), CountryCodeSO);
+        Map.Add(TEXT("ZA"), CountryCodeZA);
+        Map.Add(TEXT("GS"), CountryCodeGS);
+        Map.Add(TEXT("SS"), CountryCodeSS);
+        Map.Add(TEXT("ES"), CountryCodeES);
+        Map.Add(TEXT("LK"), CountryCodeLK);
+        Map.Add(TEXT("SD"), CountryCodeSD);
+        Map.Add(TEXT("SR"), CountryCodeSR);
+        Map.Add(TEXT("SJ"), CountryCodeSJ);
+        Map.Add(TEXT("SZ"), CountryCodeSZ);
+        Map.Add(TEXT("SE"), CountryCodeSE);
+        Map.Add(TEXT("CH"), CountryCodeCH);
+        Map.Add(TEXT("SY"), CountryCodeSY);
+        Map.Add(TEXT("TW"), CountryCodeTW);
+        Map.Add(TEXT("TJ"), CountryCodeTJ);
+        Map.Add(TEXT("TZ"), CountryCodeTZ);
+        Map.Add(TEXT("TH"), CountryCodeTH);
+        Map.Add(TEXT("TL"), CountryCodeTL);
+        Map.Add(TEXT("TG"), CountryCodeTG);
+        Map.Add(TEXT("TK"), CountryCodeTK);
+        Map.Add(TEXT("TO"), CountryCodeTO);
+        Map.Add(TEXT("TT"), CountryCodeTT);
+        Map.Add(TEXT("TN"), CountryCodeTN);
+        Map.Add(TEXT("TR"), CountryCodeTR);
+        Map.Add(TEXT("TM"), CountryCodeTM);
+        Map.Add(TEXT("TC"), CountryCodeTC);
+        Map.Add(TEXT("TV"), CountryCodeTV);
+        Map.Add(TEXT("UG"), CountryCodeUG);
+        Map.Add(TEXT("UA"), CountryCodeUA);
+        Map.Add(TEXT("AE"), CountryCodeAE);
+        Map.Add(TEXT("GB"), CountryCodeGB);
+        Map.Add(TEXT("US"), CountryCodeUS);
+        Map.Add(TEXT("UM"), CountryCodeUM);
+        Map.Add(TEXT("UY"), CountryCodeUY);
+        Map.Add(TEXT("UZ"), CountryCodeUZ);
+        Map.Add(TEXT("VU"), CountryCodeVU);
+        Map.Add(TEXT("VE"), CountryCodeVE);
+        Map.Add(TEXT("VN"), CountryCodeVN);
+        Map.Add(TEXT("VG"), CountryCodeVG);
+        Map.Add(TEXT("VI"), CountryCodeVI);
+        Map.Add(TEXT("WF"), CountryCodeWF);
+        Map.Add(TEXT("EH"), CountryCodeEH);
+        Map.Add(TEXT("YE"), CountryCodeYE);
+        Map.Add(TEXT("ZM"), CountryCodeZM);
+        Map.Add(TEXT("ZW"), CountryCodeZW);
+        Map.Add(TEXT("Unknown"), CountryCodeUnknown);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -808,7 +809,7 @@ void PlayFab::CloudScriptModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -1136,11 +1137,7 @@ bool PlayFab::CloudScriptModels::FExecuteCloudScriptResult::readFromValue(const
     }
 
     const TArray<TSharedPtr<FJsonValue>>&LogsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Logs"));
-    for (int32 Idx = 0; Idx < LogsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LogsArray[Idx];
-        Logs.Add(FLogStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LogsArray, Logs);
 
 
     const TSharedPtr<FJsonValue> LogsTooLargeValue = obj->TryGetField(TEXT("LogsTooLarge"));
@@ -1245,6 +1242,7 @@ bool PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1348,6 +1346,7 @@ bool PlayFab::CloudScriptModels::FExecuteFunctionRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1619,6 +1618,7 @@ bool PlayFab::CloudScriptModels::FGetFunctionRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1790,36 +1790,36 @@ CloudScriptModels::LoginIdentityProvider PlayFab::CloudScriptModels::readLoginId
 
 CloudScriptModels::LoginIdentityProvider PlayFab::CloudScriptModels::readLoginIdentityProviderFromValue(const FString& value)
 {
-    static TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap;
-    if (_LoginIdentityProviderMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _LoginIdentityProviderMap.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
-        _LoginIdentityProviderMap.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
-        _LoginIdentityProviderMap.Add(TEXT("Custom"), LoginIdentityProviderCustom);
-        _LoginIdentityProviderMap.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
-        _LoginIdentityProviderMap.Add(TEXT("Steam"), LoginIdentityProviderSteam);
-        _LoginIdentityProviderMap.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
-        _LoginIdentityProviderMap.Add(TEXT("PSN"), LoginIdentityProviderPSN);
-        _LoginIdentityProviderMap.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
-        _LoginIdentityProviderMap.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
-        _LoginIdentityProviderMap.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
-        _LoginIdentityProviderMap.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
-        _LoginIdentityProviderMap.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
-        _LoginIdentityProviderMap.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
-        _LoginIdentityProviderMap.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
-        _LoginIdentityProviderMap.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
-        _LoginIdentityProviderMap.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
-        _LoginIdentityProviderMap.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
-        _LoginIdentityProviderMap.Add(TEXT("Apple"), LoginIdentityProviderApple);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
-        _LoginIdentityProviderMap.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
-        _LoginIdentityProviderMap.Add(TEXT("King"), LoginIdentityProviderKing);
-
-    }
+    static const TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, LoginIdentityProvider> Map;
+        Map.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
+        Map.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
+        Map.Add(TEXT("Custom"), LoginIdentityProviderCustom);
+        Map.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
+        Map.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
+        Map.Add(TEXT("Steam"), LoginIdentityProviderSteam);
+        Map.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
+        Map.Add(TEXT("PSN"), LoginIdentityProviderPSN);
+        Map.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
+        Map.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
+        Map.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
+        Map.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
+        Map.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
+        Map.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
+        Map.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
+        Map.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
+        Map.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
+        Map.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
+        Map.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
+        Map.Add(TEXT("Apple"), LoginIdentityProviderApple);
+        Map.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
+        Map.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
+        Map.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
+        Map.Add(TEXT("King"), LoginIdentityProviderKing);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1923,11 +1923,7 @@ bool PlayFab::CloudScriptModels::FListEventHubFunctionsResult::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FunctionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Functions"));
-    for (int32 Idx = 0; Idx < FunctionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FunctionsArray[Idx];
-        Functions.Add(FEventHubFunctionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FunctionsArray, Functions);
 
 
     return HasSucceeded;
@@ -1963,6 +1959,7 @@ bool PlayFab::CloudScriptModels::FListFunctionsRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1998,11 +1995,7 @@ bool PlayFab::CloudScriptModels::FListFunctionsResult::readFromValue(const TShar
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FunctionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Functions"));
-    for (int32 Idx = 0; Idx < FunctionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FunctionsArray[Idx];
-        Functions.Add(FFunctionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FunctionsArray, Functions);
 
 
     return HasSucceeded;
@@ -2034,11 +2027,7 @@ bool PlayFab::CloudScriptModels::FListHttpFunctionsResult::readFromValue(const T
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FunctionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Functions"));
-    for (int32 Idx = 0; Idx < FunctionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FunctionsArray[Idx];
-        Functions.Add(FHttpFunctionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FunctionsArray, Functions);
 
 
     return HasSucceeded;
@@ -2128,11 +2117,7 @@ bool PlayFab::CloudScriptModels::FListQueuedFunctionsResult::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FunctionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Functions"));
-    for (int32 Idx = 0; Idx < FunctionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FunctionsArray[Idx];
-        Functions.Add(FQueuedFunctionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FunctionsArray, Functions);
 
 
     return HasSucceeded;
@@ -2235,20 +2220,20 @@ CloudScriptModels::SubscriptionProviderStatus PlayFab::CloudScriptModels::readSu
 
 CloudScriptModels::SubscriptionProviderStatus PlayFab::CloudScriptModels::readSubscriptionProviderStatusFromValue(const FString& value)
 {
-    static TMap<FString, SubscriptionProviderStatus> _SubscriptionProviderStatusMap;
-    if (_SubscriptionProviderStatusMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _SubscriptionProviderStatusMap.Add(TEXT("NoError"), SubscriptionProviderStatusNoError);
-        _SubscriptionProviderStatusMap.Add(TEXT("Cancelled"), SubscriptionProviderStatusCancelled);
-        _SubscriptionProviderStatusMap.Add(TEXT("UnknownError"), SubscriptionProviderStatusUnknownError);
-        _SubscriptionProviderStatusMap.Add(TEXT("BillingError"), SubscriptionProviderStatusBillingError);
-        _SubscriptionProviderStatusMap.Add(TEXT("ProductUnavailable"), SubscriptionProviderStatusProductUnavailable);
-        _SubscriptionProviderStatusMap.Add(TEXT("CustomerDidNotAcceptPriceChange"), SubscriptionProviderStatusCustomerDidNotAcceptPriceChange);
-        _SubscriptionProviderStatusMap.Add(TEXT("FreeTrial"), SubscriptionProviderStatusFreeTrial);
-        _SubscriptionProviderStatusMap.Add(TEXT("PaymentPending"), SubscriptionProviderStatusPaymentPending);
-
-    }
+    static const TMap<FString, SubscriptionProviderStatus> _SubscriptionProviderStatusMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SubscriptionProviderStatus> Map;
+        Map.Add(TEXT("NoError"), SubscriptionProviderStatusNoError);
+        Map.Add(TEXT("Cancelled"), SubscriptionProviderStatusCancelled);
+        Map.Add(TEXT("UnknownError"), SubscriptionProviderStatusUnknownError);
+        Map.Add(TEXT("BillingError"), SubscriptionProviderStatusBillingError);
+        Map.Add(TEXT("ProductUnavailable"), SubscriptionProviderStatusProductUnavailable);
+        Map.Add(TEXT("CustomerDidNotAcceptPriceChange"), SubscriptionProviderStatusCustomerDidNotAcceptPriceChange);
+        Map.Add(TEXT("FreeTrial"), SubscriptionProviderStatusFreeTrial);
+        Map.Add(TEXT("PaymentPending"), SubscriptionProviderStatusPaymentPending);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2433,11 +2418,7 @@ bool PlayFab::CloudScriptModels::FMembershipModel::readFromValue(const TSharedPt
     }
 
     const TArray<TSharedPtr<FJsonValue>>&SubscriptionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Subscriptions"));
-    for (int32 Idx = 0; Idx < SubscriptionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SubscriptionsArray[Idx];
-        Subscriptions.Add(FSubscriptionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SubscriptionsArray, Subscriptions);
 
 
     return HasSucceeded;
@@ -2505,14 +2486,14 @@ CloudScriptModels::PushNotificationPlatform PlayFab::CloudScriptModels::readPush
 
 CloudScriptModels::PushNotificationPlatform PlayFab::CloudScriptModels::readPushNotificationPlatformFromValue(const FString& value)
 {
-    static TMap<FString, PushNotificationPlatform> _PushNotificationPlatformMap;
-    if (_PushNotificationPlatformMap.Num() == 0)
+    static const TMap<FString, PushNotificationPlatform> _PushNotificationPlatformMap = []()
     {
-        // Auto-generate the map on the first use
-        _PushNotificationPlatformMap.Add(TEXT("ApplePushNotificationService"), PushNotificationPlatformApplePushNotificationService);
-        _PushNotificationPlatformMap.Add(TEXT("GoogleCloudMessaging"), PushNotificationPlatformGoogleCloudMessaging);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, PushNotificationPlatform> Map;
+        Map.Add(TEXT("ApplePushNotificationService"), PushNotificationPlatformApplePushNotificationService);
+        Map.Add(TEXT("GoogleCloudMessaging"), PushNotificationPlatformGoogleCloudMessaging);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2870,11 +2851,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AdCampaignAttributionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AdCampaignAttributions"));
-    for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttributionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AdCampaignAttributionsArray, AdCampaignAttributions);
 
 
     const TSharedPtr<FJsonValue> AvatarUrlValue = obj->TryGetField(TEXT("AvatarUrl"));
@@ -2890,11 +2867,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
 
 
     const TArray<TSharedPtr<FJsonValue>>&ContactEmailAddressesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ContactEmailAddresses"));
-    for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfoModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContactEmailAddressesArray, ContactEmailAddresses);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -2917,27 +2890,15 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
 
 
     const TArray<TSharedPtr<FJsonValue>>&LinkedAccountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("LinkedAccounts"));
-    for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FLinkedPlatformAccountModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LinkedAccountsArray, LinkedAccounts);
 
 
     const TArray<TSharedPtr<FJsonValue>>&LocationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Locations"));
-    for (int32 Idx = 0; Idx < LocationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LocationsArray[Idx];
-        Locations.Add(FLocationModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LocationsArray, Locations);
 
 
     const TArray<TSharedPtr<FJsonValue>>&MembershipsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Memberships"));
-    for (int32 Idx = 0; Idx < MembershipsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembershipsArray[Idx];
-        Memberships.Add(FMembershipModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembershipsArray, Memberships);
 
 
     Origination = readLoginIdentityProviderFromValue(obj->TryGetField(TEXT("Origination")));
@@ -2957,27 +2918,15 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PushNotificationRegistrationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PushNotificationRegistrations"));
-    for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistrationModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PushNotificationRegistrationsArray, PushNotificationRegistrations);
 
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     const TArray<TSharedPtr<FJsonValue>>&TagsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Tags"));
-    for (int32 Idx = 0; Idx < TagsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = TagsArray[Idx];
-        Tags.Add(FTagModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(TagsArray, Tags);
 
 
     const TSharedPtr<FJsonValue> TitleIdValue = obj->TryGetField(TEXT("TitleId"));
@@ -2995,11 +2944,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ValuesToDateArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ValuesToDate"));
-    for (int32 Idx = 0; Idx < ValuesToDateArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ValuesToDateArray[Idx];
-        ValuesToDate.Add(FValueToDateModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ValuesToDateArray, ValuesToDate);
 
 
     return HasSucceeded;
@@ -3138,6 +3083,7 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequ
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3195,6 +3141,7 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest:
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3259,6 +3206,7 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequ
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3322,6 +3270,7 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::rea
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3410,6 +3359,7 @@ bool PlayFab::CloudScriptModels::FRegisterEventHubFunctionRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3483,6 +3433,7 @@ bool PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3573,6 +3524,7 @@ bool PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3614,15 +3566,15 @@ CloudScriptModels::TriggerType PlayFab::CloudScriptModels::readTriggerTypeFromVa
 
 CloudScriptModels::TriggerType PlayFab::CloudScriptModels::readTriggerTypeFromValue(const FString& value)
 {
-    static TMap<FString, TriggerType> _TriggerTypeMap;
-    if (_TriggerTypeMap.Num() == 0)
+    static const TMap<FString, TriggerType> _TriggerTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _TriggerTypeMap.Add(TEXT("HTTP"), TriggerTypeHTTP);
-        _TriggerTypeMap.Add(TEXT("Queue"), TriggerTypeQueue);
-        _TriggerTypeMap.Add(TEXT("EventHub"), TriggerTypeEventHub);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, TriggerType> Map;
+        Map.Add(TEXT("HTTP"), TriggerTypeHTTP);
+        Map.Add(TEXT("Queue"), TriggerTypeQueue);
+        Map.Add(TEXT("EventHub"), TriggerTypeEventHub);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -3674,6 +3626,7 @@ bool PlayFab::CloudScriptModels::FUnregisterFunctionRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3690,3 +3643,5 @@ bool PlayFab::CloudScriptModels::FUnregisterFunctionRequest::readFromValue(const
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_CLOUDSCRIPT_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_CLOUDSCRIPT_API
 #include "Core/PlayFabCloudScriptInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabCloudScriptInstanceAPI::GetOrC
     return this->authContext;
 }
 
-bool UPlayFabCloudScriptInstanceAPI::ExecuteEntityCloudScript(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::ExecuteEntityCloudScript(
     CloudScriptModels::FExecuteEntityCloudScriptRequest& request,
     const FExecuteEntityCloudScriptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,14 +91,14 @@ bool UPlayFabCloudScriptInstanceAPI::ExecuteEntityCloudScript(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ExecuteEntityCloudScript"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnExecuteEntityCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnExecuteEntityCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteEntityCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
     CloudScriptModels::FExecuteCloudScriptResult outResult;
     FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult, TEXT("FunctionResult"), outResult.FunctionResult))
     {
         SuccessDelegate.ExecuteIfBound(outResult);
     }
@@ -107,7 +108,7 @@ void UPlayFabCloudScriptInstanceAPI::OnExecuteEntityCloudScriptResult(FHttpReque
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::ExecuteFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::ExecuteFunction(
     CloudScriptModels::FExecuteFunctionRequest& request,
     const FExecuteFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,14 +121,14 @@ bool UPlayFabCloudScriptInstanceAPI::ExecuteFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ExecuteFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnExecuteFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnExecuteFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
     CloudScriptModels::FExecuteFunctionResult outResult;
     FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult, TEXT("FunctionResult"), outResult.FunctionResult))
     {
         SuccessDelegate.ExecuteIfBound(outResult);
     }
@@ -137,7 +138,7 @@ void UPlayFabCloudScriptInstanceAPI::OnExecuteFunctionResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::GetFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::GetFunction(
     CloudScriptModels::FGetFunctionRequest& request,
     const FGetFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabCloudScriptInstanceAPI::GetFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/GetFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnGetFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnGetFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabCloudScriptInstanceAPI::OnGetFunctionResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::ListEventHubFunctions(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::ListEventHubFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListEventHubFunctionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabCloudScriptInstanceAPI::ListEventHubFunctions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListEventHubFunctions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnListEventHubFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnListEventHubFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListEventHubFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabCloudScriptInstanceAPI::OnListEventHubFunctionsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::ListFunctions(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::ListFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListFunctionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabCloudScriptInstanceAPI::ListFunctions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListFunctions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnListFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnListFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabCloudScriptInstanceAPI::OnListFunctionsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::ListHttpFunctions(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::ListHttpFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListHttpFunctionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabCloudScriptInstanceAPI::ListHttpFunctions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListHttpFunctions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnListHttpFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnListHttpFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListHttpFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabCloudScriptInstanceAPI::OnListHttpFunctionsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::ListQueuedFunctions(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::ListQueuedFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListQueuedFunctionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabCloudScriptInstanceAPI::ListQueuedFunctions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListQueuedFunctions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnListQueuedFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnListQueuedFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListQueuedFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabCloudScriptInstanceAPI::OnListQueuedFunctionsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForEntityTriggeredAction(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::PostFunctionResultForEntityTriggeredAction(
     CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest& request,
     const FPostFunctionResultForEntityTriggeredActionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForEntityTriggeredAction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForEntityTriggeredAction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForEntityTriggeredActionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForEntityTriggeredActionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForEntityTriggeredActionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForEntityTriggeredActio
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForFunctionExecution(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::PostFunctionResultForFunctionExecution(
     CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest& request,
     const FPostFunctionResultForFunctionExecutionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForFunctionExecution(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForFunctionExecution"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForFunctionExecutionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForFunctionExecutionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForFunctionExecutionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -347,7 +348,7 @@ void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForFunctionExecutionRes
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForPlayerTriggeredAction(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::PostFunctionResultForPlayerTriggeredAction(
     CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest& request,
     const FPostFunctionResultForPlayerTriggeredActionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -360,7 +361,7 @@ bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForPlayerTriggeredAction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForPlayerTriggeredAction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForPlayerTriggeredActionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForPlayerTriggeredActionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForPlayerTriggeredActionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -377,7 +378,7 @@ void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForPlayerTriggeredActio
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForScheduledTask(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::PostFunctionResultForScheduledTask(
     CloudScriptModels::FPostFunctionResultForScheduledTaskRequest& request,
     const FPostFunctionResultForScheduledTaskDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -390,7 +391,7 @@ bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForScheduledTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForScheduledTask"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForScheduledTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForScheduledTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForScheduledTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -407,7 +408,7 @@ void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForScheduledTaskResult(
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::RegisterEventHubFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::RegisterEventHubFunction(
     CloudScriptModels::FRegisterEventHubFunctionRequest& request,
     const FRegisterEventHubFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -420,7 +421,7 @@ bool UPlayFabCloudScriptInstanceAPI::RegisterEventHubFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/RegisterEventHubFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnRegisterEventHubFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnRegisterEventHubFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterEventHubFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -437,7 +438,7 @@ void UPlayFabCloudScriptInstanceAPI::OnRegisterEventHubFunctionResult(FHttpReque
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::RegisterHttpFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::RegisterHttpFunction(
     CloudScriptModels::FRegisterHttpFunctionRequest& request,
     const FRegisterHttpFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -450,7 +451,7 @@ bool UPlayFabCloudScriptInstanceAPI::RegisterHttpFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/RegisterHttpFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnRegisterHttpFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnRegisterHttpFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterHttpFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -467,7 +468,7 @@ void UPlayFabCloudScriptInstanceAPI::OnRegisterHttpFunctionResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::RegisterQueuedFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::RegisterQueuedFunction(
     CloudScriptModels::FRegisterQueuedFunctionRequest& request,
     const FRegisterQueuedFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -480,7 +481,7 @@ bool UPlayFabCloudScriptInstanceAPI::RegisterQueuedFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/RegisterQueuedFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnRegisterQueuedFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnRegisterQueuedFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterQueuedFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -497,7 +498,7 @@ void UPlayFabCloudScriptInstanceAPI::OnRegisterQueuedFunctionResult(FHttpRequest
     }
 }
 
-bool UPlayFabCloudScriptInstanceAPI::UnregisterFunction(
+FPlayFabRequestHandle UPlayFabCloudScriptInstanceAPI::UnregisterFunction(
     CloudScriptModels::FUnregisterFunctionRequest& request,
     const FUnregisterFunctionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -510,7 +511,7 @@ bool UPlayFabCloudScriptInstanceAPI::UnregisterFunction(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/UnregisterFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnUnregisterFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnUnregisterFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnregisterFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -526,3 +527,5 @@ void UPlayFabCloudScriptInstanceAPI::OnUnregisterFunctionResult(FHttpRequestPtr
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_CLOUDSCRIPT_API
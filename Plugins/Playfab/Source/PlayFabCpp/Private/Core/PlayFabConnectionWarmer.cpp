@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "Core/PlayFabConnectionWarmer.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Http.h"
+#include "Misc/ScopeLock.h"
+#include "PlatformHttp.h"
+#include "PlayFab.h"
+
+using namespace PlayFab;
+
+static TAutoConsoleVariable<bool> CVarPrewarmConnection(
+    TEXT("PlayFab.PrewarmConnection"),
+    true,
+    TEXT("Open the connection to the PlayFab API host during idle windows such as the startup loading screen."));
+
+namespace
+{
+    enum class EWarmState : uint8
+    {
+        Warming,
+        Warm
+    };
+
+    FCriticalSection WarmLock;
+    TMap<FString, EWarmState> WarmedHosts; // By host name, guarded by WarmLock
+
+    FString GetWarmUrl(const TSharedPtr<UPlayFabAPISettings>& settings)
+    {
+        return settings.IsValid() ? settings->GeneratePfUrl(TEXT("/")) : UPlayFabAPISettings().GeneratePfUrl(TEXT("/"));
+    }
+}
+
+void PlayFabConnectionWarmer::Warm(TSharedPtr<UPlayFabAPISettings> settings)
+{
+    if (!CVarPrewarmConnection.GetValueOnAnyThread())
+    {
+        return;
+    }
+    if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() == 0 && !GetDefault<UPlayFabRuntimeSettings>()->ProductionEnvironmentURL.StartsWith(TEXT("https://")))
+    {
+        return; // No host to talk to yet
+    }
+
+    const FString Url = GetWarmUrl(settings);
+    const FString Host = FPlatformHttp::GetUrlDomain(Url);
+    {
+        FScopeLock ScopeLock(&WarmLock);
+        if (WarmedHosts.Contains(Host))
+        {
+            return;
+        }
+        WarmedHosts.Add(Host, EWarmState::Warming);
+    }
+
+    TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
+    HttpRequest->SetVerb(TEXT("HEAD"));
+    HttpRequest->SetURL(Url);
+    HttpRequest->SetHeader(TEXT("X-PlayFabSDK"), PlayFabSettings::versionString);
+    HttpRequest->SetTimeout(10.0f);
+
+    const double StartTime = FPlatformTime::Seconds();
+    HttpRequest->OnProcessRequestComplete().BindLambda([Host, StartTime](FHttpRequestPtr, FHttpResponsePtr HttpResponse, bool bSucceeded)
+    {
+        // Any answer means the connection is up, whatever the status code
+        const bool bConnected = bSucceeded && HttpResponse.IsValid();
+        UE_LOG(LogPlayFabCpp, Log, TEXT("PlayFab connection to %s %s after %.0f ms"), *Host, bConnected ? TEXT("warmed up") : TEXT("could not be warmed up"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+        FScopeLock ScopeLock(&WarmLock);
+        WarmedHosts.Add(Host, EWarmState::Warm);
+    });
+    HttpRequest->ProcessRequest();
+}
+
+bool PlayFabConnectionWarmer::IsWarm(TSharedPtr<UPlayFabAPISettings> settings)
+{
+    const FString Host = FPlatformHttp::GetUrlDomain(GetWarmUrl(settings));
+    FScopeLock ScopeLock(&WarmLock);
+    const EWarmState* State = WarmedHosts.Find(Host);
+    return State != nullptr && *State == EWarmState::Warm;
+}
@@ -5,20 +5,95 @@
 
 #include "PlayFabCppBaseModel.h"
 #include "PlayFab.h"
+#include "PlayFabTrace.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonSerializer.h"
 
 using namespace PlayFab;
 
 FString FPlayFabCppBaseModel::toJSONString() const
 {
+    uint64 TraceId;
+    return toJSONString(TraceId);
+}
+
+FString FPlayFabCppBaseModel::toJSONString(uint64& OutTraceId) const
+{
+    OutTraceId = PlayFabCommon::PlayFabTrace::BeginSerialize();
     FString JsonOutString;
     JsonWriter Json = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR> >::Create(&JsonOutString);
     writeJSON(Json);
     Json->Close();
+    PlayFabCommon::PlayFabTrace::EndSerialize(OutTraceId);
     return JsonOutString;
 }
 
+struct FJsonKeeper::FRawJson
+{
+    FString Text;
+    FCriticalSection Lock; // Guards the members below, copies of the keeper may be used on other threads
+    TSharedPtr<FJsonValue> Parsed;
+};
+
+void FJsonKeeper::SetRawJson(const FString& InRawJson)
+{
+    FString Trimmed = InRawJson.TrimStartAndEnd();
+    JsonValue = MakeShareable(new FJsonValueNull());
+    if (Trimmed.IsEmpty() || Trimmed == TEXT("null"))
+    {
+        RawJson.Reset();
+    }
+    else
+    {
+        RawJson = MakeShared<FRawJson>();
+        RawJson->Text = MoveTemp(Trimmed);
+    }
+}
+
+void FJsonKeeper::SetRawJson(FUtf8StringView InRawJson)
+{
+    SetRawJson(FString(InRawJson));
+}
+
+FString FJsonKeeper::GetRawJson() const
+{
+    if (RawJson.IsValid())
+    {
+        return RawJson->Text;
+    }
+    return toJSONString();
+}
+
+TSharedPtr<FJsonValue> FJsonKeeper::GetJsonValue() const
+{
+    if (!RawJson.IsValid())
+    {
+        return JsonValue;
+    }
+
+    FScopeLock ScopeLock(&RawJson->Lock);
+    if (!RawJson->Parsed.IsValid())
+    {
+        TSharedRef<TJsonReader<TCHAR> > Reader = TJsonReaderFactory<TCHAR>::Create(RawJson->Text);
+        if (!FJsonSerializer::Deserialize(Reader, RawJson->Parsed) || !RawJson->Parsed.IsValid())
+        {
+            UE_LOG(LogPlayFabCpp, Error, TEXT("FJsonKeeper - Unable to parse raw JSON: %s"), *RawJson->Text);
+            RawJson->Parsed = MakeShareable(new FJsonValueNull());
+        }
+    }
+    return RawJson->Parsed;
+}
+
 void FJsonKeeper::writeJSON(JsonWriter& writer) const
 {
+    if (RawJson.IsValid())
+    {
+        // Spliced in verbatim, no DOM round trip
+        writer->WriteRawJSONValue(RawJson->Text);
+        return;
+    }
+
     switch (JsonValue->Type)
     {
     case EJson::None:
@@ -82,6 +157,7 @@ bool FJsonKeeper::readFromValue(const TSharedPtr<FJsonValue>& value)
 {
     if (value.IsValid())
     {
+        RawJson.Reset();
         JsonValue = value.ToSharedRef();
     }
     return true;
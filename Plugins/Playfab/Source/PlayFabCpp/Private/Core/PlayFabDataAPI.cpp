@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_DATA_API
 #include "Core/PlayFabDataAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabDataAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabDataAPI::AbortFileUploads(
+FPlayFabRequestHandle UPlayFabDataAPI::AbortFileUploads(
     DataModels::FAbortFileUploadsRequest& request,
     const FAbortFileUploadsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabDataAPI::AbortFileUploads(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/AbortFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnAbortFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataAPI::OnAbortFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAbortFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabDataAPI::OnAbortFileUploadsResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabDataAPI::DeleteFiles(
+FPlayFabRequestHandle UPlayFabDataAPI::DeleteFiles(
     DataModels::FDeleteFilesRequest& request,
     const FDeleteFilesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabDataAPI::DeleteFiles(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/DeleteFiles"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnDeleteFilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataAPI::OnDeleteFilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteFilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabDataAPI::OnDeleteFilesResult(FHttpRequestPtr HttpRequest, FHttpResp
     }
 }
 
-bool UPlayFabDataAPI::FinalizeFileUploads(
+FPlayFabRequestHandle UPlayFabDataAPI::FinalizeFileUploads(
     DataModels::FFinalizeFileUploadsRequest& request,
     const FFinalizeFileUploadsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabDataAPI::FinalizeFileUploads(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/FinalizeFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnFinalizeFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataAPI::OnFinalizeFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FFinalizeFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabDataAPI::OnFinalizeFileUploadsResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabDataAPI::GetFiles(
+FPlayFabRequestHandle UPlayFabDataAPI::GetFiles(
     DataModels::FGetFilesRequest& request,
     const FGetFilesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabDataAPI::GetFiles(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/GetFiles"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnGetFilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataAPI::OnGetFilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabDataAPI::OnGetFilesResult(FHttpRequestPtr HttpRequest, FHttpRespons
     }
 }
 
-bool UPlayFabDataAPI::GetObjects(
+FPlayFabRequestHandle UPlayFabDataAPI::GetObjects(
     DataModels::FGetObjectsRequest& request,
     const FGetObjectsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabDataAPI::GetObjects(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Object/GetObjects"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnGetObjectsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataAPI::OnGetObjectsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetObjectsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabDataAPI::OnGetObjectsResult(FHttpRequestPtr HttpRequest, FHttpRespo
     }
 }
 
-bool UPlayFabDataAPI::InitiateFileUploads(
+FPlayFabRequestHandle UPlayFabDataAPI::InitiateFileUploads(
     DataModels::FInitiateFileUploadsRequest& request,
     const FInitiateFileUploadsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabDataAPI::InitiateFileUploads(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/InitiateFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnInitiateFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataAPI::OnInitiateFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInitiateFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabDataAPI::OnInitiateFileUploadsResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabDataAPI::SetObjects(
+FPlayFabRequestHandle UPlayFabDataAPI::SetObjects(
     DataModels::FSetObjectsRequest& request,
     const FSetObjectsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,7 +221,7 @@ bool UPlayFabDataAPI::SetObjects(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Object/SetObjects"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnSetObjectsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataAPI::OnSetObjectsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetObjectsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -236,3 +237,5 @@ void UPlayFabDataAPI::OnSetObjectsResult(FHttpRequestPtr HttpRequest, FHttpRespo
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_DATA_API
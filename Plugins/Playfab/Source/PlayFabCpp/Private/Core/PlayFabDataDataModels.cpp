@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_DATA_API
 
 #include "Core/PlayFabDataDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -27,7 +28,7 @@ void PlayFab::DataModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -105,6 +106,7 @@ bool PlayFab::DataModels::FAbortFileUploadsRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -216,6 +218,7 @@ bool PlayFab::DataModels::FDeleteFilesRequest::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -324,6 +327,7 @@ bool PlayFab::DataModels::FFinalizeFileUploadsRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -470,6 +474,7 @@ bool PlayFab::DataModels::FFinalizeFileUploadsResponse::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), FGetFileMetadata(It.Value()->AsObject()));
@@ -519,6 +524,7 @@ bool PlayFab::DataModels::FGetFilesRequest::readFromValue(const TSharedPtr<FJson
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -580,6 +586,7 @@ bool PlayFab::DataModels::FGetFilesResponse::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), FGetFileMetadata(It.Value()->AsObject()));
@@ -635,6 +642,7 @@ bool PlayFab::DataModels::FGetObjectsRequest::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -760,6 +768,7 @@ bool PlayFab::DataModels::FGetObjectsResponse::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonObject>* ObjectsObject;
     if (obj->TryGetObjectField(TEXT("Objects"), ObjectsObject))
     {
+        Objects.Reserve((*ObjectsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ObjectsObject)->Values); It; ++It)
         {
             Objects.Add(It.Key(), FObjectResult(It.Value()->AsObject()));
@@ -866,6 +875,7 @@ bool PlayFab::DataModels::FInitiateFileUploadsRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -939,11 +949,7 @@ bool PlayFab::DataModels::FInitiateFileUploadsResponse::readFromValue(const TSha
     }
 
     const TArray<TSharedPtr<FJsonValue>>&UploadDetailsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("UploadDetails"));
-    for (int32 Idx = 0; Idx < UploadDetailsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = UploadDetailsArray[Idx];
-        UploadDetails.Add(FInitiateFileUploadMetadata(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(UploadDetailsArray, UploadDetails);
 
 
     return HasSucceeded;
@@ -968,16 +974,16 @@ DataModels::OperationTypes PlayFab::DataModels::readOperationTypesFromValue(cons
 
 DataModels::OperationTypes PlayFab::DataModels::readOperationTypesFromValue(const FString& value)
 {
-    static TMap<FString, OperationTypes> _OperationTypesMap;
-    if (_OperationTypesMap.Num() == 0)
+    static const TMap<FString, OperationTypes> _OperationTypesMap = []()
     {
-        // Auto-generate the map on the first use
-        _OperationTypesMap.Add(TEXT("Created"), OperationTypesCreated);
-        _OperationTypesMap.Add(TEXT("Updated"), OperationTypesUpdated);
-        _OperationTypesMap.Add(TEXT("Deleted"), OperationTypesDeleted);
-        _OperationTypesMap.Add(TEXT("None"), OperationTypesNone);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, OperationTypes> Map;
+        Map.Add(TEXT("Created"), OperationTypesCreated);
+        Map.Add(TEXT("Updated"), OperationTypesUpdated);
+        Map.Add(TEXT("Deleted"), OperationTypesDeleted);
+        Map.Add(TEXT("None"), OperationTypesNone);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1161,6 +1167,7 @@ bool PlayFab::DataModels::FSetObjectsRequest::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1181,11 +1188,7 @@ bool PlayFab::DataModels::FSetObjectsRequest::readFromValue(const TSharedPtr<FJs
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ObjectsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Objects"));
-    for (int32 Idx = 0; Idx < ObjectsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ObjectsArray[Idx];
-        Objects.Add(FSetObject(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ObjectsArray, Objects);
 
 
     return HasSucceeded;
@@ -1227,13 +1230,11 @@ bool PlayFab::DataModels::FSetObjectsResponse::readFromValue(const TSharedPtr<FJ
     }
 
     const TArray<TSharedPtr<FJsonValue>>&SetResultsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("SetResults"));
-    for (int32 Idx = 0; Idx < SetResultsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SetResultsArray[Idx];
-        SetResults.Add(FSetObjectInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SetResultsArray, SetResults);
 
 
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_DATA_API
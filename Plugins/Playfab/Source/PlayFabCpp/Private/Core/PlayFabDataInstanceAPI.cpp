@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_DATA_API
 #include "Core/PlayFabDataInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabDataInstanceAPI::GetOrCreateAu
     return this->authContext;
 }
 
-bool UPlayFabDataInstanceAPI::AbortFileUploads(
+FPlayFabRequestHandle UPlayFabDataInstanceAPI::AbortFileUploads(
     DataModels::FAbortFileUploadsRequest& request,
     const FAbortFileUploadsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabDataInstanceAPI::AbortFileUploads(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/AbortFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnAbortFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataInstanceAPI::OnAbortFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAbortFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabDataInstanceAPI::OnAbortFileUploadsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabDataInstanceAPI::DeleteFiles(
+FPlayFabRequestHandle UPlayFabDataInstanceAPI::DeleteFiles(
     DataModels::FDeleteFilesRequest& request,
     const FDeleteFilesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabDataInstanceAPI::DeleteFiles(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/DeleteFiles"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnDeleteFilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataInstanceAPI::OnDeleteFilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteFilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabDataInstanceAPI::OnDeleteFilesResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabDataInstanceAPI::FinalizeFileUploads(
+FPlayFabRequestHandle UPlayFabDataInstanceAPI::FinalizeFileUploads(
     DataModels::FFinalizeFileUploadsRequest& request,
     const FFinalizeFileUploadsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabDataInstanceAPI::FinalizeFileUploads(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/FinalizeFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnFinalizeFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataInstanceAPI::OnFinalizeFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FFinalizeFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabDataInstanceAPI::OnFinalizeFileUploadsResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabDataInstanceAPI::GetFiles(
+FPlayFabRequestHandle UPlayFabDataInstanceAPI::GetFiles(
     DataModels::FGetFilesRequest& request,
     const FGetFilesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabDataInstanceAPI::GetFiles(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/GetFiles"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnGetFilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataInstanceAPI::OnGetFilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabDataInstanceAPI::OnGetFilesResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabDataInstanceAPI::GetObjects(
+FPlayFabRequestHandle UPlayFabDataInstanceAPI::GetObjects(
     DataModels::FGetObjectsRequest& request,
     const FGetObjectsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabDataInstanceAPI::GetObjects(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Object/GetObjects"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnGetObjectsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataInstanceAPI::OnGetObjectsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetObjectsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabDataInstanceAPI::OnGetObjectsResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabDataInstanceAPI::InitiateFileUploads(
+FPlayFabRequestHandle UPlayFabDataInstanceAPI::InitiateFileUploads(
     DataModels::FInitiateFileUploadsRequest& request,
     const FInitiateFileUploadsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabDataInstanceAPI::InitiateFileUploads(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/InitiateFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnInitiateFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataInstanceAPI::OnInitiateFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInitiateFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabDataInstanceAPI::OnInitiateFileUploadsResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabDataInstanceAPI::SetObjects(
+FPlayFabRequestHandle UPlayFabDataInstanceAPI::SetObjects(
     DataModels::FSetObjectsRequest& request,
     const FSetObjectsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabDataInstanceAPI::SetObjects(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Object/SetObjects"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnSetObjectsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabDataInstanceAPI::OnSetObjectsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetObjectsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -286,3 +287,5 @@ void UPlayFabDataInstanceAPI::OnSetObjectsResult(FHttpRequestPtr HttpRequest, FH
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_DATA_API
@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+// Console command PlayFab.BenchmarkArrayDecode [Iterations]
+// Decodes synthetic GetCatalogItems payloads of growing size serially and with ParallelFor,
+// checks that both produce the same models and logs the timings, to pick PlayFab.ParallelDecodeThreshold.
+
+#if !UE_BUILD_SHIPPING && WITH_PLAYFAB_CLIENT_API
+#include "Core/PlayFabClientDataModels.h"
+#include "Core/PlayFabJsonHelpers.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "PlayFab.h"
+
+using namespace PlayFab;
+using namespace PlayFab::ClientModels;
+
+namespace
+{
+    TSharedPtr<FJsonValue> MakeCatalogItem(int32 Index)
+    {
+        TSharedPtr<FJsonObject> Prices = MakeShareable(new FJsonObject());
+        Prices->SetNumberField(TEXT("GO"), 100 + Index);
+        Prices->SetNumberField(TEXT("GE"), Index % 7);
+
+        TArray<TSharedPtr<FJsonValue>> Tags;
+        Tags.Add(MakeShareable(new FJsonValueString(TEXT("ball"))));
+        Tags.Add(MakeShareable(new FJsonValueString(FString::Printf(TEXT("tier%d"), Index % 5))));
+
+        TSharedPtr<FJsonObject> Consumable = MakeShareable(new FJsonObject());
+        Consumable->SetNumberField(TEXT("UsageCount"), 1 + Index % 3);
+
+        TSharedPtr<FJsonObject> Item = MakeShareable(new FJsonObject());
+        Item->SetStringField(TEXT("ItemId"), FString::Printf(TEXT("item_%06d"), Index));
+        Item->SetStringField(TEXT("ItemClass"), TEXT("Cosmetic"));
+        Item->SetStringField(TEXT("CatalogVersion"), TEXT("Main"));
+        Item->SetStringField(TEXT("DisplayName"), FString::Printf(TEXT("Item %d"), Index));
+        Item->SetStringField(TEXT("Description"), TEXT("Synthetic catalog item used to benchmark response decoding"));
+        Item->SetStringField(TEXT("CustomData"), TEXT("{\"color\":\"red\",\"size\":3}"));
+        Item->SetBoolField(TEXT("IsStackable"), (Index & 1) != 0);
+        Item->SetBoolField(TEXT("IsTradable"), true);
+        Item->SetObjectField(TEXT("VirtualCurrencyPrices"), Prices);
+        Item->SetObjectField(TEXT("Consumable"), Consumable);
+        Item->SetArrayField(TEXT("Tags"), Tags);
+        return MakeShareable(new FJsonValueObject(Item));
+    }
+
+    double TimeDecode(const TArray<TSharedPtr<FJsonValue>>& Array, int32 Threshold, int32 Iterations, TArray<FCatalogItem>& OutItems)
+    {
+        double Best = TNumericLimits<double>::Max();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            OutItems.Reset();
+            const double Start = FPlatformTime::Seconds();
+            FPlayFabJsonHelpers::ReadObjectArray(Array, OutItems, Threshold);
+            Best = FMath::Min(Best, FPlatformTime::Seconds() - Start);
+        }
+        return Best * 1000.0;
+    }
+
+    void BenchmarkArrayDecode(const TArray<FString>& Args)
+    {
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 5;
+        static const int32 Sizes[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192 };
+
+        UE_LOG(LogPlayFabCpp, Display, TEXT("PlayFab array decode benchmark, best of %d runs"), Iterations);
+        UE_LOG(LogPlayFabCpp, Display, TEXT("%8s %12s %12s %8s"), TEXT("Items"), TEXT("Serial ms"), TEXT("Parallel ms"), TEXT("Speedup"));
+
+        int32 Crossover = 0;
+        for (int32 Size : Sizes)
+        {
+            TArray<TSharedPtr<FJsonValue>> Array;
+            Array.Reserve(Size);
+            for (int32 Index = 0; Index < Size; ++Index)
+            {
+                Array.Add(MakeCatalogItem(Index));
+            }
+
+            TArray<FCatalogItem> Serial, Parallel;
+            const double SerialMs = TimeDecode(Array, 0, Iterations, Serial);
+            const double ParallelMs = TimeDecode(Array, 1, Iterations, Parallel);
+
+            // Both paths must produce the same models, in the same order
+            for (int32 Index = 0; Index < Size; ++Index)
+            {
+                if (Serial[Index].toJSONString() != Parallel[Index].toJSONString())
+                {
+                    UE_LOG(LogPlayFabCpp, Error, TEXT("Parallel decode differs from serial decode at item %d of %d"), Index, Size);
+                    return;
+                }
+            }
+
+            if (Crossover == 0 && ParallelMs < SerialMs)
+            {
+                Crossover = Size;
+            }
+            UE_LOG(LogPlayFabCpp, Display, TEXT("%8d %12.3f %12.3f %7.2fx"), Size, SerialMs, ParallelMs, SerialMs / FMath::Max(ParallelMs, 1e-6));
+        }
+
+        if (Crossover > 0)
+        {
+            UE_LOG(LogPlayFabCpp, Display, TEXT("Parallel decoding wins from %d items (PlayFab.ParallelDecodeThreshold is %d)"), Crossover, FPlayFabJsonHelpers::GetParallelDecodeThreshold());
+        }
+        else
+        {
+            UE_LOG(LogPlayFabCpp, Display, TEXT("Parallel decoding never won; consider PlayFab.ParallelDecodeThreshold 0"));
+        }
+    }
+
+    FAutoConsoleCommand BenchmarkArrayDecodeCommand(
+        TEXT("PlayFab.BenchmarkArrayDecode"),
+        TEXT("Times serial against parallel decoding of large response arrays. Optional argument: runs per size."),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkArrayDecode));
+}
+
+#endif // !UE_BUILD_SHIPPING && WITH_PLAYFAB_CLIENT_API
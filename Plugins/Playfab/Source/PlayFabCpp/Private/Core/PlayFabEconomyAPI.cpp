@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_ECONOMY_API
 #include "Core/PlayFabEconomyAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabEconomyAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabEconomyAPI::AddInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::AddInventoryItems(
     EconomyModels::FAddInventoryItemsRequest& request,
     const FAddInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabEconomyAPI::AddInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/AddInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnAddInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnAddInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabEconomyAPI::OnAddInventoryItemsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabEconomyAPI::CreateDraftItem(
+FPlayFabRequestHandle UPlayFabEconomyAPI::CreateDraftItem(
     EconomyModels::FCreateDraftItemRequest& request,
     const FCreateDraftItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabEconomyAPI::CreateDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/CreateDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnCreateDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnCreateDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabEconomyAPI::OnCreateDraftItemResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabEconomyAPI::CreateUploadUrls(
+FPlayFabRequestHandle UPlayFabEconomyAPI::CreateUploadUrls(
     EconomyModels::FCreateUploadUrlsRequest& request,
     const FCreateUploadUrlsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabEconomyAPI::CreateUploadUrls(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/CreateUploadUrls"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnCreateUploadUrlsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnCreateUploadUrlsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateUploadUrlsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabEconomyAPI::OnCreateUploadUrlsResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabEconomyAPI::DeleteEntityItemReviews(
+FPlayFabRequestHandle UPlayFabEconomyAPI::DeleteEntityItemReviews(
     EconomyModels::FDeleteEntityItemReviewsRequest& request,
     const FDeleteEntityItemReviewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabEconomyAPI::DeleteEntityItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/DeleteEntityItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnDeleteEntityItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnDeleteEntityItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteEntityItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabEconomyAPI::OnDeleteEntityItemReviewsResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabEconomyAPI::DeleteInventoryCollection(
+FPlayFabRequestHandle UPlayFabEconomyAPI::DeleteInventoryCollection(
     EconomyModels::FDeleteInventoryCollectionRequest& request,
     const FDeleteInventoryCollectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabEconomyAPI::DeleteInventoryCollection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/DeleteInventoryCollection"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnDeleteInventoryCollectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnDeleteInventoryCollectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteInventoryCollectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabEconomyAPI::OnDeleteInventoryCollectionResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabEconomyAPI::DeleteInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::DeleteInventoryItems(
     EconomyModels::FDeleteInventoryItemsRequest& request,
     const FDeleteInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabEconomyAPI::DeleteInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/DeleteInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnDeleteInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnDeleteInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabEconomyAPI::OnDeleteInventoryItemsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabEconomyAPI::DeleteItem(
+FPlayFabRequestHandle UPlayFabEconomyAPI::DeleteItem(
     EconomyModels::FDeleteItemRequest& request,
     const FDeleteItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,7 +221,7 @@ bool UPlayFabEconomyAPI::DeleteItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/DeleteItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnDeleteItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnDeleteItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -237,7 +238,7 @@ void UPlayFabEconomyAPI::OnDeleteItemResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabEconomyAPI::ExecuteInventoryOperations(
+FPlayFabRequestHandle UPlayFabEconomyAPI::ExecuteInventoryOperations(
     EconomyModels::FExecuteInventoryOperationsRequest& request,
     const FExecuteInventoryOperationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -250,7 +251,7 @@ bool UPlayFabEconomyAPI::ExecuteInventoryOperations(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/ExecuteInventoryOperations"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnExecuteInventoryOperationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnExecuteInventoryOperationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteInventoryOperationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -267,7 +268,7 @@ void UPlayFabEconomyAPI::OnExecuteInventoryOperationsResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabEconomyAPI::ExecuteTransferOperations(
+FPlayFabRequestHandle UPlayFabEconomyAPI::ExecuteTransferOperations(
     EconomyModels::FExecuteTransferOperationsRequest& request,
     const FExecuteTransferOperationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -280,7 +281,7 @@ bool UPlayFabEconomyAPI::ExecuteTransferOperations(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/ExecuteTransferOperations"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnExecuteTransferOperationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnExecuteTransferOperationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteTransferOperationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -297,7 +298,7 @@ void UPlayFabEconomyAPI::OnExecuteTransferOperationsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabEconomyAPI::GetCatalogConfig(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetCatalogConfig(
     EconomyModels::FGetCatalogConfigRequest& request,
     const FGetCatalogConfigDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -310,7 +311,7 @@ bool UPlayFabEconomyAPI::GetCatalogConfig(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetCatalogConfig"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetCatalogConfigResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetCatalogConfigResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogConfigDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -327,7 +328,7 @@ void UPlayFabEconomyAPI::OnGetCatalogConfigResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabEconomyAPI::GetDraftItem(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetDraftItem(
     EconomyModels::FGetDraftItemRequest& request,
     const FGetDraftItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -340,7 +341,7 @@ bool UPlayFabEconomyAPI::GetDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -357,7 +358,7 @@ void UPlayFabEconomyAPI::OnGetDraftItemResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabEconomyAPI::GetDraftItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetDraftItems(
     EconomyModels::FGetDraftItemsRequest& request,
     const FGetDraftItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -370,7 +371,7 @@ bool UPlayFabEconomyAPI::GetDraftItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetDraftItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetDraftItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetDraftItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDraftItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -387,7 +388,7 @@ void UPlayFabEconomyAPI::OnGetDraftItemsResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabEconomyAPI::GetEntityDraftItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetEntityDraftItems(
     EconomyModels::FGetEntityDraftItemsRequest& request,
     const FGetEntityDraftItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -400,7 +401,7 @@ bool UPlayFabEconomyAPI::GetEntityDraftItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetEntityDraftItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetEntityDraftItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetEntityDraftItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityDraftItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -417,7 +418,7 @@ void UPlayFabEconomyAPI::OnGetEntityDraftItemsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabEconomyAPI::GetEntityItemReview(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetEntityItemReview(
     EconomyModels::FGetEntityItemReviewRequest& request,
     const FGetEntityItemReviewDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -430,7 +431,7 @@ bool UPlayFabEconomyAPI::GetEntityItemReview(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetEntityItemReview"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetEntityItemReviewResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetEntityItemReviewResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityItemReviewDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -447,7 +448,7 @@ void UPlayFabEconomyAPI::OnGetEntityItemReviewResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabEconomyAPI::GetInventoryCollectionIds(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetInventoryCollectionIds(
     EconomyModels::FGetInventoryCollectionIdsRequest& request,
     const FGetInventoryCollectionIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -460,7 +461,7 @@ bool UPlayFabEconomyAPI::GetInventoryCollectionIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/GetInventoryCollectionIds"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetInventoryCollectionIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetInventoryCollectionIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetInventoryCollectionIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -477,7 +478,7 @@ void UPlayFabEconomyAPI::OnGetInventoryCollectionIdsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabEconomyAPI::GetInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetInventoryItems(
     EconomyModels::FGetInventoryItemsRequest& request,
     const FGetInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -490,7 +491,7 @@ bool UPlayFabEconomyAPI::GetInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/GetInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -507,7 +508,7 @@ void UPlayFabEconomyAPI::OnGetInventoryItemsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabEconomyAPI::GetInventoryOperationStatus(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetInventoryOperationStatus(
     EconomyModels::FGetInventoryOperationStatusRequest& request,
     const FGetInventoryOperationStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -520,7 +521,7 @@ bool UPlayFabEconomyAPI::GetInventoryOperationStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/GetInventoryOperationStatus"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetInventoryOperationStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetInventoryOperationStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetInventoryOperationStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -537,7 +538,7 @@ void UPlayFabEconomyAPI::OnGetInventoryOperationStatusResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabEconomyAPI::GetItem(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetItem(
     EconomyModels::FGetItemRequest& request,
     const FGetItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -550,7 +551,7 @@ bool UPlayFabEconomyAPI::GetItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -567,7 +568,7 @@ void UPlayFabEconomyAPI::OnGetItemResult(FHttpRequestPtr HttpRequest, FHttpRespo
     }
 }
 
-bool UPlayFabEconomyAPI::GetItemContainers(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetItemContainers(
     EconomyModels::FGetItemContainersRequest& request,
     const FGetItemContainersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -580,7 +581,7 @@ bool UPlayFabEconomyAPI::GetItemContainers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItemContainers"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemContainersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetItemContainersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemContainersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -597,7 +598,7 @@ void UPlayFabEconomyAPI::OnGetItemContainersResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabEconomyAPI::GetItemModerationState(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetItemModerationState(
     EconomyModels::FGetItemModerationStateRequest& request,
     const FGetItemModerationStateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -610,7 +611,7 @@ bool UPlayFabEconomyAPI::GetItemModerationState(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItemModerationState"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemModerationStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetItemModerationStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemModerationStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -627,7 +628,7 @@ void UPlayFabEconomyAPI::OnGetItemModerationStateResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabEconomyAPI::GetItemPublishStatus(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetItemPublishStatus(
     EconomyModels::FGetItemPublishStatusRequest& request,
     const FGetItemPublishStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -640,7 +641,7 @@ bool UPlayFabEconomyAPI::GetItemPublishStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItemPublishStatus"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemPublishStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetItemPublishStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemPublishStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -657,7 +658,7 @@ void UPlayFabEconomyAPI::OnGetItemPublishStatusResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabEconomyAPI::GetItemReviews(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetItemReviews(
     EconomyModels::FGetItemReviewsRequest& request,
     const FGetItemReviewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -670,7 +671,7 @@ bool UPlayFabEconomyAPI::GetItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -687,7 +688,7 @@ void UPlayFabEconomyAPI::OnGetItemReviewsResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabEconomyAPI::GetItemReviewSummary(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetItemReviewSummary(
     EconomyModels::FGetItemReviewSummaryRequest& request,
     const FGetItemReviewSummaryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -700,7 +701,7 @@ bool UPlayFabEconomyAPI::GetItemReviewSummary(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItemReviewSummary"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemReviewSummaryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetItemReviewSummaryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemReviewSummaryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -717,7 +718,7 @@ void UPlayFabEconomyAPI::OnGetItemReviewSummaryResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabEconomyAPI::GetItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetItems(
     EconomyModels::FGetItemsRequest& request,
     const FGetItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -730,7 +731,7 @@ bool UPlayFabEconomyAPI::GetItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -747,7 +748,7 @@ void UPlayFabEconomyAPI::OnGetItemsResult(FHttpRequestPtr HttpRequest, FHttpResp
     }
 }
 
-bool UPlayFabEconomyAPI::GetMicrosoftStoreAccessTokens(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetMicrosoftStoreAccessTokens(
     EconomyModels::FGetMicrosoftStoreAccessTokensRequest& request,
     const FGetMicrosoftStoreAccessTokensDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -760,7 +761,7 @@ bool UPlayFabEconomyAPI::GetMicrosoftStoreAccessTokens(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/GetMicrosoftStoreAccessTokens"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetMicrosoftStoreAccessTokensResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetMicrosoftStoreAccessTokensResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMicrosoftStoreAccessTokensDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -777,7 +778,7 @@ void UPlayFabEconomyAPI::OnGetMicrosoftStoreAccessTokensResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabEconomyAPI::GetTransactionHistory(
+FPlayFabRequestHandle UPlayFabEconomyAPI::GetTransactionHistory(
     EconomyModels::FGetTransactionHistoryRequest& request,
     const FGetTransactionHistoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -790,7 +791,7 @@ bool UPlayFabEconomyAPI::GetTransactionHistory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/GetTransactionHistory"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetTransactionHistoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnGetTransactionHistoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTransactionHistoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -807,7 +808,7 @@ void UPlayFabEconomyAPI::OnGetTransactionHistoryResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabEconomyAPI::PublishDraftItem(
+FPlayFabRequestHandle UPlayFabEconomyAPI::PublishDraftItem(
     EconomyModels::FPublishDraftItemRequest& request,
     const FPublishDraftItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -820,7 +821,7 @@ bool UPlayFabEconomyAPI::PublishDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/PublishDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnPublishDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnPublishDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPublishDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -837,7 +838,7 @@ void UPlayFabEconomyAPI::OnPublishDraftItemResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabEconomyAPI::PurchaseInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::PurchaseInventoryItems(
     EconomyModels::FPurchaseInventoryItemsRequest& request,
     const FPurchaseInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -850,7 +851,7 @@ bool UPlayFabEconomyAPI::PurchaseInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/PurchaseInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnPurchaseInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnPurchaseInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPurchaseInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -867,7 +868,7 @@ void UPlayFabEconomyAPI::OnPurchaseInventoryItemsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabEconomyAPI::RedeemAppleAppStoreInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::RedeemAppleAppStoreInventoryItems(
     EconomyModels::FRedeemAppleAppStoreInventoryItemsRequest& request,
     const FRedeemAppleAppStoreInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -880,7 +881,7 @@ bool UPlayFabEconomyAPI::RedeemAppleAppStoreInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/RedeemAppleAppStoreInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnRedeemAppleAppStoreInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnRedeemAppleAppStoreInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemAppleAppStoreInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -897,7 +898,7 @@ void UPlayFabEconomyAPI::OnRedeemAppleAppStoreInventoryItemsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabEconomyAPI::RedeemGooglePlayInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::RedeemGooglePlayInventoryItems(
     EconomyModels::FRedeemGooglePlayInventoryItemsRequest& request,
     const FRedeemGooglePlayInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -910,7 +911,7 @@ bool UPlayFabEconomyAPI::RedeemGooglePlayInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/RedeemGooglePlayInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnRedeemGooglePlayInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnRedeemGooglePlayInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemGooglePlayInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -927,7 +928,7 @@ void UPlayFabEconomyAPI::OnRedeemGooglePlayInventoryItemsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabEconomyAPI::RedeemMicrosoftStoreInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::RedeemMicrosoftStoreInventoryItems(
     EconomyModels::FRedeemMicrosoftStoreInventoryItemsRequest& request,
     const FRedeemMicrosoftStoreInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -940,7 +941,7 @@ bool UPlayFabEconomyAPI::RedeemMicrosoftStoreInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/RedeemMicrosoftStoreInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnRedeemMicrosoftStoreInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnRedeemMicrosoftStoreInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemMicrosoftStoreInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -957,7 +958,7 @@ void UPlayFabEconomyAPI::OnRedeemMicrosoftStoreInventoryItemsResult(FHttpRequest
     }
 }
 
-bool UPlayFabEconomyAPI::RedeemNintendoEShopInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::RedeemNintendoEShopInventoryItems(
     EconomyModels::FRedeemNintendoEShopInventoryItemsRequest& request,
     const FRedeemNintendoEShopInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -970,7 +971,7 @@ bool UPlayFabEconomyAPI::RedeemNintendoEShopInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/RedeemNintendoEShopInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnRedeemNintendoEShopInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnRedeemNintendoEShopInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemNintendoEShopInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -987,7 +988,7 @@ void UPlayFabEconomyAPI::OnRedeemNintendoEShopInventoryItemsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabEconomyAPI::RedeemPlayStationStoreInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::RedeemPlayStationStoreInventoryItems(
     EconomyModels::FRedeemPlayStationStoreInventoryItemsRequest& request,
     const FRedeemPlayStationStoreInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1000,7 +1001,7 @@ bool UPlayFabEconomyAPI::RedeemPlayStationStoreInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/RedeemPlayStationStoreInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnRedeemPlayStationStoreInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnRedeemPlayStationStoreInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemPlayStationStoreInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1017,7 +1018,7 @@ void UPlayFabEconomyAPI::OnRedeemPlayStationStoreInventoryItemsResult(FHttpReque
     }
 }
 
-bool UPlayFabEconomyAPI::RedeemSteamInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::RedeemSteamInventoryItems(
     EconomyModels::FRedeemSteamInventoryItemsRequest& request,
     const FRedeemSteamInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1030,7 +1031,7 @@ bool UPlayFabEconomyAPI::RedeemSteamInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/RedeemSteamInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnRedeemSteamInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnRedeemSteamInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemSteamInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1047,7 +1048,7 @@ void UPlayFabEconomyAPI::OnRedeemSteamInventoryItemsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabEconomyAPI::ReportItem(
+FPlayFabRequestHandle UPlayFabEconomyAPI::ReportItem(
     EconomyModels::FReportItemRequest& request,
     const FReportItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1060,7 +1061,7 @@ bool UPlayFabEconomyAPI::ReportItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/ReportItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnReportItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnReportItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1077,7 +1078,7 @@ void UPlayFabEconomyAPI::OnReportItemResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabEconomyAPI::ReportItemReview(
+FPlayFabRequestHandle UPlayFabEconomyAPI::ReportItemReview(
     EconomyModels::FReportItemReviewRequest& request,
     const FReportItemReviewDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1090,7 +1091,7 @@ bool UPlayFabEconomyAPI::ReportItemReview(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/ReportItemReview"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnReportItemReviewResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnReportItemReviewResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportItemReviewDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1107,7 +1108,7 @@ void UPlayFabEconomyAPI::OnReportItemReviewResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabEconomyAPI::ReviewItem(
+FPlayFabRequestHandle UPlayFabEconomyAPI::ReviewItem(
     EconomyModels::FReviewItemRequest& request,
     const FReviewItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1120,7 +1121,7 @@ bool UPlayFabEconomyAPI::ReviewItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/ReviewItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnReviewItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnReviewItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReviewItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1137,7 +1138,7 @@ void UPlayFabEconomyAPI::OnReviewItemResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabEconomyAPI::SearchItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::SearchItems(
     EconomyModels::FSearchItemsRequest& request,
     const FSearchItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1150,7 +1151,7 @@ bool UPlayFabEconomyAPI::SearchItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/SearchItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnSearchItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnSearchItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSearchItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1167,7 +1168,7 @@ void UPlayFabEconomyAPI::OnSearchItemsResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabEconomyAPI::SetItemModerationState(
+FPlayFabRequestHandle UPlayFabEconomyAPI::SetItemModerationState(
     EconomyModels::FSetItemModerationStateRequest& request,
     const FSetItemModerationStateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1180,7 +1181,7 @@ bool UPlayFabEconomyAPI::SetItemModerationState(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/SetItemModerationState"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnSetItemModerationStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnSetItemModerationStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetItemModerationStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1197,7 +1198,7 @@ void UPlayFabEconomyAPI::OnSetItemModerationStateResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabEconomyAPI::SubmitItemReviewVote(
+FPlayFabRequestHandle UPlayFabEconomyAPI::SubmitItemReviewVote(
     EconomyModels::FSubmitItemReviewVoteRequest& request,
     const FSubmitItemReviewVoteDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1210,7 +1211,7 @@ bool UPlayFabEconomyAPI::SubmitItemReviewVote(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/SubmitItemReviewVote"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnSubmitItemReviewVoteResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnSubmitItemReviewVoteResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubmitItemReviewVoteDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1227,7 +1228,7 @@ void UPlayFabEconomyAPI::OnSubmitItemReviewVoteResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabEconomyAPI::SubtractInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::SubtractInventoryItems(
     EconomyModels::FSubtractInventoryItemsRequest& request,
     const FSubtractInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1240,7 +1241,7 @@ bool UPlayFabEconomyAPI::SubtractInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/SubtractInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnSubtractInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnSubtractInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1257,7 +1258,7 @@ void UPlayFabEconomyAPI::OnSubtractInventoryItemsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabEconomyAPI::TakedownItemReviews(
+FPlayFabRequestHandle UPlayFabEconomyAPI::TakedownItemReviews(
     EconomyModels::FTakedownItemReviewsRequest& request,
     const FTakedownItemReviewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1270,7 +1271,7 @@ bool UPlayFabEconomyAPI::TakedownItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/TakedownItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnTakedownItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnTakedownItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FTakedownItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1287,7 +1288,7 @@ void UPlayFabEconomyAPI::OnTakedownItemReviewsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabEconomyAPI::TransferInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::TransferInventoryItems(
     EconomyModels::FTransferInventoryItemsRequest& request,
     const FTransferInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1300,7 +1301,7 @@ bool UPlayFabEconomyAPI::TransferInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/TransferInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnTransferInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnTransferInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FTransferInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1317,7 +1318,7 @@ void UPlayFabEconomyAPI::OnTransferInventoryItemsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabEconomyAPI::UpdateCatalogConfig(
+FPlayFabRequestHandle UPlayFabEconomyAPI::UpdateCatalogConfig(
     EconomyModels::FUpdateCatalogConfigRequest& request,
     const FUpdateCatalogConfigDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1330,7 +1331,7 @@ bool UPlayFabEconomyAPI::UpdateCatalogConfig(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/UpdateCatalogConfig"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnUpdateCatalogConfigResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnUpdateCatalogConfigResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCatalogConfigDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1347,7 +1348,7 @@ void UPlayFabEconomyAPI::OnUpdateCatalogConfigResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabEconomyAPI::UpdateDraftItem(
+FPlayFabRequestHandle UPlayFabEconomyAPI::UpdateDraftItem(
     EconomyModels::FUpdateDraftItemRequest& request,
     const FUpdateDraftItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1360,7 +1361,7 @@ bool UPlayFabEconomyAPI::UpdateDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/UpdateDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnUpdateDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnUpdateDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1377,7 +1378,7 @@ void UPlayFabEconomyAPI::OnUpdateDraftItemResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabEconomyAPI::UpdateInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyAPI::UpdateInventoryItems(
     EconomyModels::FUpdateInventoryItemsRequest& request,
     const FUpdateInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1390,7 +1391,7 @@ bool UPlayFabEconomyAPI::UpdateInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Inventory/UpdateInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnUpdateInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyAPI::OnUpdateInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1406,3 +1407,5 @@ void UPlayFabEconomyAPI::OnUpdateInventoryItemsResult(FHttpRequestPtr HttpReques
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_ECONOMY_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_ECONOMY_API
 
 #include "Core/PlayFabEconomyDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -232,7 +233,7 @@ void PlayFab::EconomyModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -360,6 +361,7 @@ bool PlayFab::EconomyModels::FAddInventoryItemsRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -615,17 +617,17 @@ EconomyModels::DisplayPropertyType PlayFab::EconomyModels::readDisplayPropertyTy
 
 EconomyModels::DisplayPropertyType PlayFab::EconomyModels::readDisplayPropertyTypeFromValue(const FString& value)
 {
-    static TMap<FString, DisplayPropertyType> _DisplayPropertyTypeMap;
-    if (_DisplayPropertyTypeMap.Num() == 0)
+    static const TMap<FString, DisplayPropertyType> _DisplayPropertyTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _DisplayPropertyTypeMap.Add(TEXT("None"), DisplayPropertyTypeNone);
-        _DisplayPropertyTypeMap.Add(TEXT("QueryDateTime"), DisplayPropertyTypeQueryDateTime);
-        _DisplayPropertyTypeMap.Add(TEXT("QueryDouble"), DisplayPropertyTypeQueryDouble);
-        _DisplayPropertyTypeMap.Add(TEXT("QueryString"), DisplayPropertyTypeQueryString);
-        _DisplayPropertyTypeMap.Add(TEXT("SearchString"), DisplayPropertyTypeSearchString);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, DisplayPropertyType> Map;
+        Map.Add(TEXT("None"), DisplayPropertyTypeNone);
+        Map.Add(TEXT("QueryDateTime"), DisplayPropertyTypeQueryDateTime);
+        Map.Add(TEXT("QueryDouble"), DisplayPropertyTypeQueryDouble);
+        Map.Add(TEXT("QueryString"), DisplayPropertyTypeQueryString);
+        Map.Add(TEXT("SearchString"), DisplayPropertyTypeSearchString);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -806,11 +808,7 @@ bool PlayFab::EconomyModels::FReviewConfig::readFromValue(const TSharedPtr<FJson
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&CategoryRatingsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("CategoryRatings"));
-    for (int32 Idx = 0; Idx < CategoryRatingsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CategoryRatingsArray[Idx];
-        CategoryRatings.Add(FCategoryRatingConfig(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CategoryRatingsArray, CategoryRatings);
 
 
     return HasSucceeded;
@@ -957,11 +955,7 @@ bool PlayFab::EconomyModels::FCatalogConfig::readFromValue(const TSharedPtr<FJso
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AdminEntitiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AdminEntities"));
-    for (int32 Idx = 0; Idx < AdminEntitiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AdminEntitiesArray[Idx];
-        AdminEntities.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AdminEntitiesArray, AdminEntities);
 
 
     const TSharedPtr<FJsonValue> CatalogValue = obj->TryGetField(TEXT("Catalog"));
@@ -971,19 +965,11 @@ bool PlayFab::EconomyModels::FCatalogConfig::readFromValue(const TSharedPtr<FJso
     }
 
     const TArray<TSharedPtr<FJsonValue>>&DeepLinkFormatsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("DeepLinkFormats"));
-    for (int32 Idx = 0; Idx < DeepLinkFormatsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DeepLinkFormatsArray[Idx];
-        DeepLinkFormats.Add(FDeepLinkFormat(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DeepLinkFormatsArray, DeepLinkFormats);
 
 
     const TArray<TSharedPtr<FJsonValue>>&DisplayPropertyIndexInfosArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("DisplayPropertyIndexInfos"));
-    for (int32 Idx = 0; Idx < DisplayPropertyIndexInfosArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DisplayPropertyIndexInfosArray[Idx];
-        DisplayPropertyIndexInfos.Add(FDisplayPropertyIndexInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DisplayPropertyIndexInfosArray, DisplayPropertyIndexInfos);
 
 
     const TSharedPtr<FJsonValue> FileValue = obj->TryGetField(TEXT("File"));
@@ -1014,11 +1000,7 @@ bool PlayFab::EconomyModels::FCatalogConfig::readFromValue(const TSharedPtr<FJso
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ReviewerEntitiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ReviewerEntities"));
-    for (int32 Idx = 0; Idx < ReviewerEntitiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ReviewerEntitiesArray[Idx];
-        ReviewerEntities.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ReviewerEntitiesArray, ReviewerEntities);
 
 
     const TSharedPtr<FJsonValue> UserGeneratedContentValue = obj->TryGetField(TEXT("UserGeneratedContent"));
@@ -1321,11 +1303,7 @@ bool PlayFab::EconomyModels::FCatalogPrice::readFromValue(const TSharedPtr<FJson
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AmountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Amounts"));
-    for (int32 Idx = 0; Idx < AmountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AmountsArray[Idx];
-        Amounts.Add(FCatalogPriceAmount(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AmountsArray, Amounts);
 
 
     const TSharedPtr<FJsonValue> UnitAmountValue = obj->TryGetField(TEXT("UnitAmount"));
@@ -1371,11 +1349,7 @@ bool PlayFab::EconomyModels::FCatalogPriceOptions::readFromValue(const TSharedPt
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&PricesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Prices"));
-    for (int32 Idx = 0; Idx < PricesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PricesArray[Idx];
-        Prices.Add(FCatalogPrice(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PricesArray, Prices);
 
 
     return HasSucceeded;
@@ -1488,16 +1462,16 @@ EconomyModels::ModerationStatus PlayFab::EconomyModels::readModerationStatusFrom
 
 EconomyModels::ModerationStatus PlayFab::EconomyModels::readModerationStatusFromValue(const FString& value)
 {
-    static TMap<FString, ModerationStatus> _ModerationStatusMap;
-    if (_ModerationStatusMap.Num() == 0)
+    static const TMap<FString, ModerationStatus> _ModerationStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _ModerationStatusMap.Add(TEXT("Unknown"), ModerationStatusUnknown);
-        _ModerationStatusMap.Add(TEXT("AwaitingModeration"), ModerationStatusAwaitingModeration);
-        _ModerationStatusMap.Add(TEXT("Approved"), ModerationStatusApproved);
-        _ModerationStatusMap.Add(TEXT("Rejected"), ModerationStatusRejected);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ModerationStatus> Map;
+        Map.Add(TEXT("Unknown"), ModerationStatusUnknown);
+        Map.Add(TEXT("AwaitingModeration"), ModerationStatusAwaitingModeration);
+        Map.Add(TEXT("Approved"), ModerationStatusApproved);
+        Map.Add(TEXT("Rejected"), ModerationStatusRejected);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1974,11 +1948,7 @@ bool PlayFab::EconomyModels::FCatalogPriceOverride::readFromValue(const TSharedP
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AmountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Amounts"));
-    for (int32 Idx = 0; Idx < AmountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AmountsArray[Idx];
-        Amounts.Add(FCatalogPriceAmountOverride(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AmountsArray, Amounts);
 
 
     return HasSucceeded;
@@ -2010,11 +1980,7 @@ bool PlayFab::EconomyModels::FCatalogPriceOptionsOverride::readFromValue(const T
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&PricesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Prices"));
-    for (int32 Idx = 0; Idx < PricesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PricesArray[Idx];
-        Prices.Add(FCatalogPriceOverride(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PricesArray, Prices);
 
 
     return HasSucceeded;
@@ -2305,19 +2271,11 @@ bool PlayFab::EconomyModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonO
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AlternateIdsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AlternateIds"));
-    for (int32 Idx = 0; Idx < AlternateIdsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AlternateIdsArray[Idx];
-        AlternateIds.Add(FCatalogAlternateId(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AlternateIdsArray, AlternateIds);
 
 
     const TArray<TSharedPtr<FJsonValue>>&ContentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Contents"));
-    for (int32 Idx = 0; Idx < ContentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContentsArray[Idx];
-        Contents.Add(FContent(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContentsArray, Contents);
 
 
     const TSharedPtr<FJsonValue> ContentTypeValue = obj->TryGetField(TEXT("ContentType"));
@@ -2339,11 +2297,7 @@ bool PlayFab::EconomyModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonO
     }
 
     const TArray<TSharedPtr<FJsonValue>>&DeepLinksArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("DeepLinks"));
-    for (int32 Idx = 0; Idx < DeepLinksArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DeepLinksArray[Idx];
-        DeepLinks.Add(FDeepLink(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DeepLinksArray, DeepLinks);
 
 
     const TSharedPtr<FJsonValue> DefaultStackIdValue = obj->TryGetField(TEXT("DefaultStackId"));
@@ -2356,6 +2310,7 @@ bool PlayFab::EconomyModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonO
     const TSharedPtr<FJsonObject>* DescriptionObject;
     if (obj->TryGetObjectField(TEXT("Description"), DescriptionObject))
     {
+        Description.Reserve((*DescriptionObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DescriptionObject)->Values); It; ++It)
         {
             Description.Add(It.Key(), It.Value()->AsString());
@@ -2395,11 +2350,7 @@ bool PlayFab::EconomyModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonO
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ImagesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Images"));
-    for (int32 Idx = 0; Idx < ImagesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ImagesArray[Idx];
-        Images.Add(FImage(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ImagesArray, Images);
 
 
     const TSharedPtr<FJsonValue> IsHiddenValue = obj->TryGetField(TEXT("IsHidden"));
@@ -2410,16 +2361,13 @@ bool PlayFab::EconomyModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonO
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ItemReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ItemReferences"));
-    for (int32 Idx = 0; Idx < ItemReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemReferencesArray[Idx];
-        ItemReferences.Add(FCatalogItemReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemReferencesArray, ItemReferences);
 
 
     const TSharedPtr<FJsonObject>* KeywordsObject;
     if (obj->TryGetObjectField(TEXT("Keywords"), KeywordsObject))
     {
+        Keywords.Reserve((*KeywordsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*KeywordsObject)->Values); It; ++It)
         {
             Keywords.Add(It.Key(), FKeywordSet(It.Value()->AsObject()));
@@ -2473,6 +2421,7 @@ bool PlayFab::EconomyModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonO
     const TSharedPtr<FJsonObject>* TitleObject;
     if (obj->TryGetObjectField(TEXT("Title"), TitleObject))
     {
+        Title.Reserve((*TitleObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TitleObject)->Values); It; ++It)
         {
             Title.Add(It.Key(), It.Value()->AsString());
@@ -2514,22 +2463,22 @@ EconomyModels::ConcernCategory PlayFab::EconomyModels::readConcernCategoryFromVa
 
 EconomyModels::ConcernCategory PlayFab::EconomyModels::readConcernCategoryFromValue(const FString& value)
 {
-    static TMap<FString, ConcernCategory> _ConcernCategoryMap;
-    if (_ConcernCategoryMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _ConcernCategoryMap.Add(TEXT("None"), ConcernCategoryNone);
-        _ConcernCategoryMap.Add(TEXT("OffensiveContent"), ConcernCategoryOffensiveContent);
-        _ConcernCategoryMap.Add(TEXT("ChildExploitation"), ConcernCategoryChildExploitation);
-        _ConcernCategoryMap.Add(TEXT("MalwareOrVirus"), ConcernCategoryMalwareOrVirus);
-        _ConcernCategoryMap.Add(TEXT("PrivacyConcerns"), ConcernCategoryPrivacyConcerns);
-        _ConcernCategoryMap.Add(TEXT("MisleadingApp"), ConcernCategoryMisleadingApp);
-        _ConcernCategoryMap.Add(TEXT("PoorPerformance"), ConcernCategoryPoorPerformance);
-        _ConcernCategoryMap.Add(TEXT("ReviewResponse"), ConcernCategoryReviewResponse);
-        _ConcernCategoryMap.Add(TEXT("SpamAdvertising"), ConcernCategorySpamAdvertising);
-        _ConcernCategoryMap.Add(TEXT("Profanity"), ConcernCategoryProfanity);
-
-    }
+    static const TMap<FString, ConcernCategory> _ConcernCategoryMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ConcernCategory> Map;
+        Map.Add(TEXT("None"), ConcernCategoryNone);
+        Map.Add(TEXT("OffensiveContent"), ConcernCategoryOffensiveContent);
+        Map.Add(TEXT("ChildExploitation"), ConcernCategoryChildExploitation);
+        Map.Add(TEXT("MalwareOrVirus"), ConcernCategoryMalwareOrVirus);
+        Map.Add(TEXT("PrivacyConcerns"), ConcernCategoryPrivacyConcerns);
+        Map.Add(TEXT("MisleadingApp"), ConcernCategoryMisleadingApp);
+        Map.Add(TEXT("PoorPerformance"), ConcernCategoryPoorPerformance);
+        Map.Add(TEXT("ReviewResponse"), ConcernCategoryReviewResponse);
+        Map.Add(TEXT("SpamAdvertising"), ConcernCategorySpamAdvertising);
+        Map.Add(TEXT("Profanity"), ConcernCategoryProfanity);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2806,262 +2755,262 @@ EconomyModels::CountryCode PlayFab::EconomyModels::readCountryCodeFromValue(cons
 
 EconomyModels::CountryCode PlayFab::EconomyModels::readCountryCodeFromValue(const FString& value)
 {
-    static TMap<FString, CountryCode> _CountryCodeMap;
-    if (_CountryCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _CountryCodeMap.Add(TEXT("AF"), CountryCodeAF);
-        _CountryCodeMap.Add(TEXT("AX"), CountryCodeAX);
-        _CountryCodeMap.Add(TEXT("AL"), CountryCodeAL);
-        _CountryCodeMap.Add(TEXT("DZ"), CountryCodeDZ);
-        _CountryCodeMap.Add(TEXT("AS"), CountryCodeAS);
-        _CountryCodeMap.Add(TEXT("AD"), CountryCodeAD);
-        _CountryCodeMap.Add(TEXT("AO"), CountryCodeAO);
-        _CountryCodeMap.Add(TEXT("AI"), CountryCodeAI);
-        _CountryCodeMap.Add(TEXT("AQ"), CountryCodeAQ);
-        _CountryCodeMap.Add(TEXT("AG"), CountryCodeAG);
-        _CountryCodeMap.Add(TEXT("AR"), CountryCodeAR);
-        _CountryCodeMap.Add(TEXT("AM"), CountryCodeAM);
-        _CountryCodeMap.Add(TEXT("AW"), CountryCodeAW);
-        _CountryCodeMap.Add(TEXT("AU"), CountryCodeAU);
-        _CountryCodeMap.Add(TEXT("AT"), CountryCodeAT);
-        _CountryCodeMap.Add(TEXT("AZ"), CountryCodeAZ);
-        _CountryCodeMap.Add(TEXT("BS"), CountryCodeBS);
-        _CountryCodeMap.Add(TEXT("BH"), CountryCodeBH);
-        _CountryCodeMap.Add(TEXT("BD"), CountryCodeBD);
-        _CountryCodeMap.Add(TEXT("BB"), CountryCodeBB);
-        _CountryCodeMap.Add(TEXT("BY"), CountryCodeBY);
-        _CountryCodeMap.Add(TEXT("BE"), CountryCodeBE);
-        _CountryCodeMap.Add(TEXT("BZ"), CountryCodeBZ);
-        _CountryCodeMap.Add(TEXT("BJ"), CountryCodeBJ);
-        _CountryCodeMap.Add(TEXT("BM"), CountryCodeBM);
-        _CountryCodeMap.Add(TEXT("BT"), CountryCodeBT);
-        _CountryCodeMap.Add(TEXT("BO"), CountryCodeBO);
-        _CountryCodeMap.Add(TEXT("BQ"), CountryCodeBQ);
-        _CountryCodeMap.Add(TEXT("BA"), CountryCodeBA);
-        _CountryCodeMap.Add(TEXT("BW"), CountryCodeBW);
-        _CountryCodeMap.Add(TEXT("BV"), CountryCodeBV);
-        _CountryCodeMap.Add(TEXT("BR"), CountryCodeBR);
-        _CountryCodeMap.Add(TEXT("IO"), CountryCodeIO);
-        _CountryCodeMap.Add(TEXT("BN"), CountryCodeBN);
-        _CountryCodeMap.Add(TEXT("BG"), CountryCodeBG);
-        _CountryCodeMap.Add(TEXT("BF"), CountryCodeBF);
-        _CountryCodeMap.Add(TEXT("BI"), CountryCodeBI);
-        _CountryCodeMap.Add(TEXT("KH"), CountryCodeKH);
-        _CountryCodeMap.Add(TEXT("CM"), CountryCodeCM);
-        _CountryCodeMap.Add(TEXT("CA"), CountryCodeCA);
-        _CountryCodeMap.Add(TEXT("CV"), CountryCodeCV);
-        _CountryCodeMap.Add(TEXT("KY"), CountryCodeKY);
-        _CountryCodeMap.Add(TEXT("CF"), CountryCodeCF);
-        _CountryCodeMap.Add(TEXT("TD"), CountryCodeTD);
-        _CountryCodeMap.Add(TEXT("CL"), CountryCodeCL);
-        _CountryCodeMap.Add(TEXT("CN"), CountryCodeCN);
-        _CountryCodeMap.Add(TEXT("CX"), CountryCodeCX);
-        _CountryCodeMap.Add(TEXT("CC"), CountryCodeCC);
-        _CountryCodeMap.Add(TEXT("CO"), CountryCodeCO);
-        _CountryCodeMap.Add(TEXT("KM"), CountryCodeKM);
-        _CountryCodeMap.Add(TEXT("CG"), CountryCodeCG);
-        _CountryCodeMap.Add(TEXT("CD"), CountryCodeCD);
-        _CountryCodeMap.Add(TEXT("CK"), CountryCodeCK);
-        _CountryCodeMap.Add(TEXT("CR"), CountryCodeCR);
-        _CountryCodeMap.Add(TEXT("CI"), CountryCodeCI);
-        _CountryCodeMap.Add(TEXT("HR"), CountryCodeHR);
-        _CountryCodeMap.Add(TEXT("CU"), CountryCodeCU);
-        _CountryCodeMap.Add(TEXT("CW"), CountryCodeCW);
-        _CountryCodeMap.Add(TEXT("CY"), CountryCodeCY);
-        _CountryCodeMap.Add(TEXT("CZ"), CountryCodeCZ);
-        _CountryCodeMap.Add(TEXT("DK"), CountryCodeDK);
-        _CountryCodeMap.Add(TEXT("DJ"), CountryCodeDJ);
-        _CountryCodeMap.Add(TEXT("DM"), CountryCodeDM);
-        _CountryCodeMap.Add(TEXT("DO"), CountryCodeDO);
-        _CountryCodeMap.Add(TEXT("EC"), CountryCodeEC);
-        _CountryCodeMap.Add(TEXT("EG"), CountryCodeEG);
-        _CountryCodeMap.Add(TEXT("SV"), CountryCodeSV);
-        _CountryCodeMap.Add(TEXT("GQ"), CountryCodeGQ);
-        _CountryCodeMap.Add(TEXT("ER"), CountryCodeER);
-        _CountryCodeMap.Add(TEXT("EE"), CountryCodeEE);
-        _CountryCodeMap.Add(TEXT("ET"), CountryCodeET);
-        _CountryCodeMap.Add(TEXT("FK"), CountryCodeFK);
-        _CountryCodeMap.Add(TEXT("FO"), CountryCodeFO);
-        _CountryCodeMap.Add(TEXT("FJ"), CountryCodeFJ);
-        _CountryCodeMap.Add(TEXT("FI"), CountryCodeFI);
-        _CountryCodeMap.Add(TEXT("FR"), CountryCodeFR);
-        _CountryCodeMap.Add(TEXT("GF"), CountryCodeGF);
-        _CountryCodeMap.Add(TEXT("PF"), CountryCodePF);
-        _CountryCodeMap.Add(TEXT("TF"), CountryCodeTF);
-        _CountryCodeMap.Add(TEXT("GA"), CountryCodeGA);
-        _CountryCodeMap.Add(TEXT("GM"), CountryCodeGM);
-        _CountryCodeMap.Add(TEXT("GE"), CountryCodeGE);
-        _CountryCodeMap.Add(TEXT("DE"), CountryCodeDE);
-        _CountryCodeMap.Add(TEXT("GH"), CountryCodeGH);
-        _CountryCodeMap.Add(TEXT("GI"), CountryCodeGI);
-        _CountryCodeMap.Add(TEXT("GR"), CountryCodeGR);
-        _CountryCodeMap.Add(TEXT("GL"), CountryCodeGL);
-        _CountryCodeMap.Add(TEXT("GD"), CountryCodeGD);
-        _CountryCodeMap.Add(TEXT("GP"), CountryCodeGP);
-        _CountryCodeMap.Add(TEXT("GU"), CountryCodeGU);
-        _CountryCodeMap.Add(TEXT("GT"), CountryCodeGT);
-        _CountryCodeMap.Add(TEXT("GG"), CountryCodeGG);
-        _CountryCodeMap.Add(TEXT("GN"), CountryCodeGN);
-        _CountryCodeMap.Add(TEXT("GW"), CountryCodeGW);
-        _CountryCodeMap.Add(TEXT("GY"), CountryCodeGY);
-        _CountryCodeMap.Add(TEXT("HT"), CountryCodeHT);
-        _CountryCodeMap.Add(TEXT("HM"), CountryCodeHM);
-        _CountryCodeMap.Add(TEXT("VA"), CountryCodeVA);
-        _CountryCodeMap.Add(TEXT("HN"), CountryCodeHN);
-        _CountryCodeMap.Add(TEXT("HK"), CountryCodeHK);
-        _CountryCodeMap.Add(TEXT("HU"), CountryCodeHU);
-        _CountryCodeMap.Add(TEXT("IS"), CountryCodeIS);
-        _CountryCodeMap.Add(TEXT("IN"), CountryCodeIN);
-        _CountryCodeMap.Add(TEXT("ID"), CountryCodeID);
-        _CountryCodeMap.Add(TEXT("IR"), CountryCodeIR);
-        _CountryCodeMap.Add(TEXT("IQ"), CountryCodeIQ);
-        _CountryCodeMap.Add(TEXT("IE"), CountryCodeIE);
-        _CountryCodeMap.Add(TEXT("IM"), CountryCodeIM);
-        _CountryCodeMap.Add(TEXT("IL"), CountryCodeIL);
-        _CountryCodeMap.Add(TEXT("IT"), CountryCodeIT);
-        _CountryCodeMap.Add(TEXT("JM"), CountryCodeJM);
-        _CountryCodeMap.Add(TEXT("JP"), CountryCodeJP);
-        _CountryCodeMap.Add(TEXT("JE"), CountryCodeJE);
-        _CountryCodeMap.Add(TEXT("JO"), CountryCodeJO);
-        _CountryCodeMap.Add(TEXT("KZ"), CountryCodeKZ);
-        _CountryCodeMap.Add(TEXT("KE"), CountryCodeKE);
-        _CountryCodeMap.Add(TEXT("KI"), CountryCodeKI);
-        _CountryCodeMap.Add(TEXT("KP"), CountryCodeKP);
-        _CountryCodeMap.Add(TEXT("KR"), CountryCodeKR);
-        _CountryCodeMap.Add(TEXT("KW"), CountryCodeKW);
-        _CountryCodeMap.Add(TEXT("KG"), CountryCodeKG);
-        _CountryCodeMap.Add(TEXT("LA"), CountryCodeLA);
-        _CountryCodeMap.Add(TEXT("LV"), CountryCodeLV);
-        _CountryCodeMap.Add(TEXT("LB"), CountryCodeLB);
-        _CountryCodeMap.Add(TEXT("LS"), CountryCodeLS);
-        _CountryCodeMap.Add(TEXT("LR"), CountryCodeLR);
-        _CountryCodeMap.Add(TEXT("LY"), CountryCodeLY);
-        _CountryCodeMap.Add(TEXT("LI"), CountryCodeLI);
-        _CountryCodeMap.Add(TEXT("LT"), CountryCodeLT);
-        _CountryCodeMap.Add(TEXT("LU"), CountryCodeLU);
-        _CountryCodeMap.Add(TEXT("MO"), CountryCodeMO);
-        _CountryCodeMap.Add(TEXT("MK"), CountryCodeMK);
-        _CountryCodeMap.Add(TEXT("MG"), CountryCodeMG);
-        _CountryCodeMap.Add(TEXT("MW"), CountryCodeMW);
-        _CountryCodeMap.Add(TEXT("MY"), CountryCodeMY);
-        _CountryCodeMap.Add(TEXT("MV"), CountryCodeMV);
-        _CountryCodeMap.Add(TEXT("ML"), CountryCodeML);
-        _CountryCodeMap.Add(TEXT("MT"), CountryCodeMT);
-        _CountryCodeMap.Add(TEXT("MH"), CountryCodeMH);
-        _CountryCodeMap.Add(TEXT("MQ"), CountryCodeMQ);
-        _CountryCodeMap.Add(TEXT("MR"), CountryCodeMR);
-        _CountryCodeMap.Add(TEXT("MU"), CountryCodeMU);
-        _CountryCodeMap.Add(TEXT("YT"), CountryCodeYT);
-        _CountryCodeMap.Add(TEXT("MX"), CountryCodeMX);
-        _CountryCodeMap.Add(TEXT("FM"), CountryCodeFM);
-        _CountryCodeMap.Add(TEXT("MD"), CountryCodeMD);
-        _CountryCodeMap.Add(TEXT("MC"), CountryCodeMC);
-        _CountryCodeMap.Add(TEXT("MN"), CountryCodeMN);
-        _CountryCodeMap.Add(TEXT("ME"), CountryCodeME);
-        _CountryCodeMap.Add(TEXT("MS"), CountryCodeMS);
-        _CountryCodeMap.Add(TEXT("MA"), CountryCodeMA);
-        _CountryCodeMap.Add(TEXT("MZ"), CountryCodeMZ);
-        _CountryCodeMap.Add(TEXT("MM"), CountryCodeMM);
-        _CountryCodeMap.Add(TEXT("NA"), CountryCodeNA);
-        _CountryCodeMap.Add(TEXT("NR"), CountryCodeNR);
-        _CountryCodeMap.Add(TEXT("NP"), CountryCodeNP);
-        _CountryCodeMap.Add(TEXT("NL"), CountryCodeNL);
-        _CountryCodeMap.Add(TEXT("NC"), CountryCodeNC);
-        _CountryCodeMap.Add(TEXT("NZ"), CountryCodeNZ);
-        _CountryCodeMap.Add(TEXT("NI"), CountryCodeNI);
-        _CountryCodeMap.Add(TEXT("NE"), CountryCodeNE);
-        _CountryCodeMap.Add(TEXT("NG"), CountryCodeNG);
-        _CountryCodeMap.Add(TEXT("NU"), CountryCodeNU);
-        _CountryCodeMap.Add(TEXT("NF"), CountryCodeNF);
-        _CountryCodeMap.Add(TEXT("MP"), CountryCodeMP);
-        _CountryCodeMap.Add(TEXT("NO"), CountryCodeNO);
-        _CountryCodeMap.Add(TEXT("OM"), CountryCodeOM);
-        _CountryCodeMap.Add(TEXT("PK"), CountryCodePK);
-        _CountryCodeMap.Add(TEXT("PW"), CountryCodePW);
-        _CountryCodeMap.Add(TEXT("PS"), CountryCodePS);
-        _CountryCodeMap.Add(TEXT("PA"), CountryCodePA);
-        _CountryCodeMap.Add(TEXT("PG"), CountryCodePG);
-        _CountryCodeMap.Add(TEXT("PY"), CountryCodePY);
-        _CountryCodeMap.Add(TEXT("PE"), CountryCodePE);
-        _CountryCodeMap.Add(TEXT("PH"), CountryCodePH);
-        _CountryCodeMap.Add(TEXT("PN"), CountryCodePN);
-        _CountryCodeMap.Add(TEXT("PL"), CountryCodePL);
-        _CountryCodeMap.Add(TEXT("PT"), CountryCodePT);
-        _CountryCodeMap.Add(TEXT("PR"), CountryCodePR);
-        _CountryCodeMap.Add(TEXT("QA"), CountryCodeQA);
-        _CountryCodeMap.Add(TEXT("RE"), CountryCodeRE);
-        _CountryCodeMap.Add(TEXT("RO"), CountryCodeRO);
-        _CountryCodeMap.Add(TEXT("RU"), CountryCodeRU);
-        _CountryCodeMap.Add(TEXT("RW"), CountryCodeRW);
-        _CountryCodeMap.Add(TEXT("BL"), CountryCodeBL);
-        _CountryCodeMap.Add(TEXT("SH"), CountryCodeSH);
-        _CountryCodeMap.Add(TEXT("KN"), CountryCodeKN);
-        _CountryCodeMap.Add(TEXT("LC"), CountryCodeLC);
-        _CountryCodeMap.Add(TEXT("MF"), CountryCodeMF);
-        _CountryCodeMap.Add(TEXT("PM"), CountryCodePM);
-        _CountryCodeMap.Add(TEXT("VC"), CountryCodeVC);
-        _CountryCodeMap.Add(TEXT("WS"), CountryCodeWS);
-        _CountryCodeMap.Add(TEXT("SM"), CountryCodeSM);
-        _CountryCodeMap.Add(TEXT("ST"), CountryCodeST);
-        _CountryCodeMap.Add(TEXT("SA"), CountryCodeSA);
-        _CountryCodeMap.Add(TEXT("SN"), CountryCodeSN);
-        _CountryCodeMap.Add(TEXT("RS"), CountryCodeRS);
-        _CountryCodeMap.Add(TEXT("SC"), CountryCodeSC);
-        _CountryCodeMap.Add(TEXT("SL"), CountryCodeSL);
-        _CountryCodeMap.Add(TEXT("SG"), CountryCodeSG);
-        _CountryCodeMap.Add(TEXT("SX"), CountryCodeSX);
-        _CountryCodeMap.Add(TEXT("SK"), CountryCodeSK);
-        _CountryCodeMap.Add(TEXT("SI"), CountryCodeSI);
-        _CountryCodeMap.Add(TEXT("SB"), CountryCodeSB);
-        _CountryCodeMap.Add(TEXT("SO"), CountryCodeSO);
-        _CountryCodeMap.Add(TEXT("ZA"), CountryCodeZA);
-        _CountryCodeMap.Add(TEXT("GS"), CountryCodeGS);
-        _CountryCodeMap.Add(TEXT("SS"), CountryCodeSS);
-        _CountryCodeMap.Add(TEXT("ES"), CountryCodeES);
-        _CountryCodeMap.Add(TEXT("LK"), CountryCodeLK);
-        _CountryCodeMap.Add(TEXT("SD"), CountryCodeSD);
-        _CountryCodeMap.Add(TEXT("SR"), CountryCodeSR);
-        _CountryCodeMap.Add(TEXT("SJ"), CountryCodeSJ);
-        _CountryCodeMap.Add(TEXT("SZ"), CountryCodeSZ);
-        _CountryCodeMap.Add(TEXT("SE"), CountryCodeSE);
-        _CountryCodeMap.Add(TEXT("CH"), CountryCodeCH);
-        _CountryCodeMap.Add(TEXT("SY"), CountryCodeSY);
-        _CountryCodeMap.Add(TEXT("TW"), CountryCodeTW);
-        _CountryCodeMap.Add(TEXT("TJ"), CountryCodeTJ);
-        _CountryCodeMap.Add(TEXT("TZ"), CountryCodeTZ);
-        _CountryCodeMap.Add(TEXT("TH"), CountryCodeTH);
-        _CountryCodeMap.Add(TEXT("TL"), CountryCodeTL);
-        _CountryCodeMap.Add(TEXT("TG"), CountryCodeTG);
-        _CountryCodeMap.Add(TEXT("TK"), CountryCodeTK);
-        _CountryCodeMap.Add(TEXT("TO"), CountryCodeTO);
-        _CountryCodeMap.Add(TEXT("TT"), CountryCodeTT);
-        _CountryCodeMap.Add(TEXT("TN"), CountryCodeTN);
-        _CountryCodeMap.Add(TEXT("TR"), CountryCodeTR);
-        _CountryCodeMap.Add(TEXT("TM"), CountryCodeTM);
-        _CountryCodeMap.Add(TEXT("TC"), CountryCodeTC);
-        _CountryCodeMap.Add(TEXT("TV"), CountryCodeTV);
-        _CountryCodeMap.Add(TEXT("UG"), CountryCodeUG);
-        _CountryCodeMap.Add(TEXT("UA"), CountryCodeUA);
-        _CountryCodeMap.Add(TEXT("AE"), CountryCodeAE);
-        _CountryCodeMap.Add(TEXT("GB"), CountryCodeGB);
-        _CountryCodeMap.Add(TEXT("US"), CountryCodeUS);
-        _CountryCodeMap.Add(TEXT("UM"), CountryCodeUM);
-        _CountryCodeMap.Add(TEXT("UY"), CountryCodeUY);
-        _CountryCodeMap.Add(TEXT("UZ"), CountryCodeUZ);
-        _CountryCodeMap.Add(TEXT("VU"), CountryCodeVU);
-        _CountryCodeMap.Add(TEXT("VE"), CountryCodeVE);
-        _CountryCodeMap.Add(TEXT("VN"), CountryCodeVN);
-        _CountryCodeMap.Add(TEXT("VG"), CountryCodeVG);
-        _CountryCodeMap.Add(TEXT("VI"), CountryCodeVI);
-        _CountryCodeMap.Add(TEXT("WF"), CountryCodeWF);
-        _CountryCodeMap.Add(TEXT("EH"), CountryCodeEH);
-        _CountryCodeMap.Add(TEXT("YE"), CountryCodeYE);
-        _CountryCodeMap.Add(TEXT("ZM"), CountryCodeZM);
-        _CountryCodeMap.Add(TEXT("ZW"), CountryCodeZW);
-        _CountryCodeMap.Add(TEXT("Unknown"), CountryCodeUnknown);
-
-    }
+    static const TMap<FString, CountryCode> _CountryCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, CountryCode> Map;
+        Map.Add(TEXT("AF"), CountryCodeAF);
+        Map.Add(TEXT("AX"), CountryCodeAX);
+        Map.Add(TEXT("AL"), CountryCodeAL);
+        Map.Add(TEXT("DZ"), CountryCodeDZ);
+        Map.Add(TEXT("AS"), CountryCodeAS);
+        Map.Add(TEXT("AD"), CountryCodeAD);
+        Map.Add(TEXT("AO"), CountryCodeAO);
+        Map.Add(TEXT("AI"), CountryCodeAI);
+        Map.Add(TEXT("AQ"), CountryCodeAQ);
+        Map.Add(TEXT("AG"), CountryCodeAG);
+        Map.Add(TEXT("AR"), CountryCodeAR);
+        Map.Add(TEXT("AM"), CountryCodeAM);
+        Map.Add(TEXT("AW"), CountryCodeAW);
+        Map.Add(TEXT("AU"), CountryCodeAU);
+        Map.Add(TEXT("AT"), CountryCodeAT);
+        Map.Add(TEXT("AZ"), CountryCodeAZ);
+        Map.Add(TEXT("BS"), CountryCodeBS);
+        Map.Add(TEXT("BH"), CountryCodeBH);
+        Map.Add(TEXT("BD"), CountryCodeBD);
+        Map.Add(TEXT("BB"), CountryCodeBB);
+        Map.Add(TEXT("BY"), CountryCodeBY);
+        Map.Add(TEXT("BE"), CountryCodeBE);
+        Map.Add(TEXT("BZ"), CountryCodeBZ);
+        Map.Add(TEXT("BJ"), CountryCodeBJ);
+        Map.Add(TEXT("BM"), CountryCodeBM);
+        Map.Add(TEXT("BT"), CountryCodeBT);
+        Map.Add(TEXT("BO"), CountryCodeBO);
+        Map.Add(TEXT("BQ"), CountryCodeBQ);
+        Map.Add(TEXT("BA"), CountryCodeBA);
+        Map.Add(TEXT("BW"), CountryCodeBW);
+        Map.Add(TEXT("BV"), CountryCodeBV);
+        Map.Add(TEXT("BR"), CountryCodeBR);
+        Map.Add(TEXT("IO"), CountryCodeIO);
+        Map.Add(TEXT("BN"), CountryCodeBN);
+        Map.Add(TEXT("BG"), CountryCodeBG);
+        Map.Add(TEXT("BF"), CountryCodeBF);
+        Map.Add(TEXT("BI"), CountryCodeBI);
+        Map.Add(TEXT("KH"), CountryCodeKH);
+        Map.Add(TEXT("CM"), CountryCodeCM);
+        Map.Add(TEXT("CA"), CountryCodeCA);
+        Map.Add(TEXT("CV"), CountryCodeCV);
+        Map.Add(TEXT("KY"), CountryCodeKY);
+        Map.Add(TEXT("CF"), CountryCodeCF);
+        Map.Add(TEXT("TD"), CountryCodeTD);
+        Map.Add(TEXT("CL"), CountryCodeCL);
+        Map.Add(TEXT("CN"), CountryCodeCN);
+        Map.Add(TEXT("CX"), CountryCodeCX);
+        Map.Add(TEXT("CC"), CountryCodeCC);
+        Map.Add(TEXT("CO"), CountryCodeCO);
+        Map.Add(TEXT("KM"), CountryCodeKM);
+        Map.Add(TEXT("CG"), CountryCodeCG);
+        Map.Add(TEXT("CD"), CountryCodeCD);
+        Map.Add(TEXT("CK"), CountryCodeCK);
+        Map.Add(TEXT("CR"), CountryCodeCR);
+        Map.Add(TEXT("CI"), CountryCodeCI);
+        Map.Add(TEXT("HR"), CountryCodeHR);
+        Map.Add(TEXT("CU"), CountryCodeCU);
+        Map.Add(TEXT("CW"), CountryCodeCW);
+        Map.Add(TEXT("CY"), CountryCodeCY);
+        Map.Add(TEXT("CZ"), CountryCodeCZ);
+        Map.Add(TEXT("DK"), CountryCodeDK);
+        Map.Add(TEXT("DJ"), CountryCodeDJ);
+        Map.Add(TEXT("DM"), CountryCodeDM);
+        Map.Add(TEXT("DO"), CountryCodeDO);
+        Map.Add(TEXT("EC"), CountryCodeEC);
+        Map.Add(TEXT("EG"), CountryCodeEG);
+        Map.Add(TEXT("SV"), CountryCodeSV);
+        Map.Add(TEXT("GQ"), CountryCodeGQ);
+        Map.Add(TEXT("ER"), CountryCodeER);
+        Map.Add(TEXT("EE"), CountryCodeEE);
+        Map.Add(TEXT("ET"), CountryCodeET);
+        Map.Add(TEXT("FK"), CountryCodeFK);
+        Map.Add(TEXT("FO"), CountryCodeFO);
+        Map.Add(TEXT("FJ"), CountryCodeFJ);
+        Map.Add(TEXT("FI"), CountryCodeFI);
+        Map.Add(TEXT("FR"), CountryCodeFR);
+        Map.Add(TEXT("GF"), CountryCodeGF);
+        Map.Add(TEXT("PF"), CountryCodePF);
+        Map.Add(TEXT("TF"), CountryCodeTF);
+        Map.Add(TEXT("GA"), CountryCodeGA);
+        Map.Add(TEXT("GM"), CountryCodeGM);
+        Map.Add(TEXT("GE"), CountryCodeGE);
+        Map.Add(TEXT("DE"), CountryCodeDE);
+        Map.Add(TEXT("GH"), CountryCodeGH);
+        Map.Add(TEXT("GI"), CountryCodeGI);
+        Map.Add(TEXT("GR"), CountryCodeGR);
+        Map.Add(TEXT("GL"), CountryCodeGL);
+        Map.Add(TEXT("GD"), CountryCodeGD);
+        Map.Add(TEXT("GP"), CountryCodeGP);
+        Map.Add(TEXT("GU"), CountryCodeGU);
+        Map.Add(TEXT("GT"), CountryCodeGT);
+        Map.Add(TEXT("GG"), CountryCodeGG);
+        Map.Add(TEXT("GN"), CountryCodeGN);
+        Map.Add(TEXT("GW"), CountryCodeGW);
+        Map.Add(TEXT("GY"), CountryCodeGY);
+        Map.Add(TEXT("HT"), CountryCodeHT);
+        Map.Add(TEXT("HM"), CountryCodeHM);
+        Map.Add(TEXT("VA"), CountryCodeVA);
+        Map.Add(TEXT("HN"), CountryCodeHN);
+        Map.Add(TEXT("HK"), CountryCodeHK);
+        Map.Add(TEXT("HU"), CountryCodeHU);
+        Map.Add(TEXT("IS"), CountryCodeIS);
+        Map.Add(TEXT("IN"), CountryCodeIN);
+        Map.Add(TEXT("ID"), CountryCodeID);
+        Map.Add(TEXT("IR"), CountryCodeIR);
+        Map.Add(TEXT("IQ"), CountryCodeIQ);
+        Map.Add(TEXT("IE"), CountryCodeIE);
+        Map.Add(TEXT("IM"), CountryCodeIM);
+        Map.Add(TEXT("IL"), CountryCodeIL);
+        Map.Add(TEXT("IT"), CountryCodeIT);
+        Map.Add(TEXT("JM"), CountryCodeJM);
+        Map.Add(TEXT("JP"), CountryCodeJP);
+        Map.Add(TEXT("JE"), CountryCodeJE);
+        Map.Add(TEXT("JO"), CountryCodeJO);
+        Map.Add(TEXT("KZ"), CountryCodeKZ);
+        Map.Add(TEXT("KE"), CountryCodeKE);
+        Map.Add(TEXT("KI"), CountryCodeKI);
+        Map.Add(TEXT("KP"), CountryCodeKP);
+        Map.Add(TEXT("KR"), CountryCodeKR);
+        Map.Add(TEXT("KW"), CountryCodeKW);
+        Map.Add(TEXT("KG"), CountryCodeKG);
+        Map.Add(TEXT("LA"), CountryCodeLA);
+        Map.Add(TEXT("LV"), CountryCodeLV);
+        Map.Add(TEXT("LB"), CountryCodeLB);
+        Map.Add(TEXT("LS"), CountryCodeLS);
+        Map.Add(TEXT("LR"), CountryCodeLR);
+        Map.Add(TEXT("LY"), CountryCodeLY);
+        Map.Add(TEXT("LI"), CountryCodeLI);
+        Map.Add(TEXT("LT"), CountryCodeLT);
+        Map.Add(TEXT("LU"), CountryCodeLU);
+        Map.Add(TEXT("MO"), CountryCodeMO);
+        Map.Add(TEXT("MK"), CountryCodeMK);
+        Map.Add(TEXT("MG"), CountryCodeMG);
+        Map.Add(TEXT("MW"), CountryCodeMW);
+        Map.Add(TEXT("MY"), CountryCodeMY);
+        Map.Add(TEXT("MV"), CountryCodeMV);
+        Map.Add(TEXT("ML"), CountryCodeML);
+        Map.Add(TEXT("MT"), CountryCodeMT);
+        Map.Add(TEXT("MH"), CountryCodeMH);
+        Map.Add(TEXT("MQ"), CountryCodeMQ);
+        Map.Add(TEXT("MR"), CountryCodeMR);
+        Map.Add(TEXT("MU"), CountryCodeMU);
+        Map.Add(TEXT("YT"), CountryCodeYT);
+        Map.Add(TEXT("MX"), CountryCodeMX);
+        Map.Add(TEXT("FM"), CountryCodeFM);
+        Map.Add(TEXT("MD"), CountryCodeMD);
+        Map.Add(TEXT("MC"), CountryCodeMC);
+        Map.Add(TEXT("MN"), CountryCodeMN);
+        Map.Add(TEXT("ME"), CountryCodeME);
+        Map.Add(TEXT("MS"), CountryCodeMS);
+        Map.Add(TEXT("MA"), CountryCodeMA);
+        Map.Add(TEXT("MZ"), CountryCodeMZ);
+        Map.Add(TEXT("MM"), CountryCodeMM);
+        Map.Add(TEXT("NA"), CountryCodeNA);
+        Map.Add(TEXT("NR"), CountryCodeNR);
+        Map.Add(TEXT("NP"), CountryCodeNP);
+        Map.Add(TEXT("NL"), CountryCodeNL);
+        Map.Add(TEXT("NC"), CountryCodeNC);
+        Map.Add(TEXT("NZ"), CountryCodeNZ);
+        Map.Add(TEXT("NI"), CountryCodeNI);
+        Map.Add(TEXT("NE"), CountryCodeNE);
+        Map.Add(TEXT("NG"), CountryCodeNG);
+        Map.Add(TEXT("NU"), CountryCodeNU);
+        Map.Add(TEXT("NF"), CountryCodeNF);
+        Map.Add(TEXT("MP"), CountryCodeMP);
+        Map.Add(TEXT("NO"), CountryCodeNO);
+        Map.Add(TEXT("OM"), CountryCodeOM);
+        Map.Add(TEXT("PK"), CountryCodePK);
+        Map.Add(TEXT("PW"), CountryCodePW);
+        Map.Add(TEXT("PS"), CountryCodePS);
+        Map.Add(TEXT("PA"), CountryCodePA);
+        Map.Add(TEXT("PG"), CountryCodePG);
+        Map.Add(TEXT("PY"), CountryCodePY);
+        Map.Add(TEXT("PE"), CountryCodePE);
+        Map.Add(TEXT("PH"), CountryCodePH);
+        Map.Add(TEXT("PN"), CountryCodePN);
+        Map.Add(TEXT("PL"), CountryCodePL);
+        Map.Add(TEXT("PT"), CountryCodePT);
+        Map.Add(TEXT("PR"), CountryCodePR);
+        Map.Add(TEXT("QA"), CountryCodeQA);
+        Map.Add(TEXT("RE"), CountryCodeRE);
+        Map.Add(TEXT("RO"), CountryCodeRO);
+        Map.Add(TEXT("RU"), CountryCodeRU);
+        Map.Add(TEXT("RW"), CountryCodeRW);
+        Map.Add(TEXT("BL"), CountryCodeBL);
+        Map.Add(TEXT("SH"), CountryCodeSH);
+        Map.Add(TEXT("KN"), CountryCodeKN);
+        Map.Add(TEXT("LC"), CountryCodeLC);
+        Map.Add(TEXT("MF"), CountryCodeMF);
+        Map.Add(TEXT("PM"), CountryCodePM);
+        Map.Add(TEXT("VC"), CountryCodeVC);
+        Map.Add(TEXT("WS"), CountryCodeWS);
+        Map.Add(TEXT("SM"), CountryCodeSM);
+        Map.Add(TEXT("ST"), CountryCodeST);
+        Map.Add(TEXT("SA"), CountryCodeSA);
+        Map.Add(TEXT("SN"), CountryCodeSN);
+        Map.Add(TEXT("RS"), CountryCodeRS);
+        Map.Add(TEXT("SC"), CountryCodeSC);
+        Map.Add(TEXT("SL"), CountryCodeSL);
+        Map.Add(TEXT("SG"), CountryCodeSG);
+        Map.Add(TEXT("SX"), CountryCodeSX);
+        Map.Add(TEXT("SK"), CountryCodeSK);
+        Map.Add(TEXT("SI"), CountryCodeSI);
+        Map.Add(TEXT("SB"), CountryCodeSB);
+        Map.Add(TEXT("SO"), CountryCodeSO);
+        Map.Add(TEXT("ZA"), CountryCodeZA);
+        Map.Add(TEXT("GS"), CountryCodeGS);
+        Map.Add(TEXT("SS"), CountryCodeSS);
+        Map.Add(TEXT("ES"), CountryCodeES);
+        Map.Add(TEXT("LK"), CountryCodeLK);
+        Map.Add(TEXT("SD"), CountryCodeSD);
+        Map.Add(TEXT("SR"), CountryCodeSR);
+        Map.Add(TEXT("SJ"), CountryCodeSJ);
+        Map.Add(TEXT("SZ"), CountryCodeSZ);
+        Map.Add(TEXT("SE"), CountryCodeSE);
+        Map.Add(TEXT("CH"), CountryCodeCH);
+        Map.Add(TEXT("SY"), CountryCodeSY);
+        Map.Add(TEXT("TW"), CountryCodeTW);
+        Map.Add(TEXT("TJ"), CountryCodeTJ);
+        Map.Add(TEXT("TZ"), CountryCodeTZ);
+        Map.Add(TEXT("TH"), CountryCodeTH);
+        Map.Add(TEXT("TL"), CountryCodeTL);
+        Map.Add(TEXT("TG"), CountryCodeTG);
+        Map.Add(TEXT("TK"), CountryCodeTK);
+        Map.Add(TEXT("TO"), CountryCodeTO);
+        Map.Add(TEXT("TT"), CountryCodeTT);
+        Map.Add(TEXT("TN"), CountryCodeTN);
+        Map.Add(TEXT("TR"), CountryCodeTR);
+        Map.Add(TEXT("TM"), CountryCodeTM);
+        Map.Add(TEXT("TC"), CountryCodeTC);
+        Map.Add(TEXT("TV"), CountryCodeTV);
+        Map.Add(TEXT("UG"), CountryCodeUG);
+        Map.Add(TEXT("UA"), CountryCodeUA);
+        Map.Add(TEXT("AE"), CountryCodeAE);
+        Map.Add(TEXT("GB"), CountryCodeGB);
+        Map.Add(TEXT("US"), CountryCodeUS);
+        Map.Add(TEXT("UM"), CountryCodeUM);
+        Map.Add(TEXT("UY"), CountryCodeUY);
+        Map.Add(TEXT("UZ"), CountryCodeUZ);
+        Map.Add(TEXT("VU"), CountryCodeVU);
+        Map.Add(TEXT("VE"), CountryCodeVE);
+        Map.Add(TEXT("VN"), CountryCodeVN);
+        Map.Add(TEXT("VG"), CountryCodeVG);
+        Map.Add(TEXT("VI"), CountryCodeVI);
+        Map.Add(TEXT("WF"), CountryCodeWF);
+        Map.Add(TEXT("EH"), CountryCodeEH);
+        Map.Add(TEXT("YE"), CountryCodeYE);
+        Map.Add(TEXT("ZM"), CountryCodeZM);
+        Map.Add(TEXT("ZW"), CountryCodeZW);
+        Map.Add(TEXT("Unknown"), CountryCodeUnknown);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -3113,6 +3062,7 @@ bool PlayFab::EconomyModels::FCreateDraftItemRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3238,6 +3188,7 @@ bool PlayFab::EconomyModels::FCreateUploadUrlsRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3245,11 +3196,7 @@ bool PlayFab::EconomyModels::FCreateUploadUrlsRequest::readFromValue(const TShar
     }
 
     const TArray<TSharedPtr<FJsonValue>>&FilesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Files"));
-    for (int32 Idx = 0; Idx < FilesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FilesArray[Idx];
-        Files.Add(FUploadInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FilesArray, Files);
 
 
     return HasSucceeded;
@@ -3339,11 +3286,7 @@ bool PlayFab::EconomyModels::FCreateUploadUrlsResponse::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&UploadUrlsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("UploadUrls"));
-    for (int32 Idx = 0; Idx < UploadUrlsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = UploadUrlsArray[Idx];
-        UploadUrls.Add(FUploadUrlMetadata(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(UploadUrlsArray, UploadUrls);
 
 
     return HasSucceeded;
@@ -3386,6 +3329,7 @@ bool PlayFab::EconomyModels::FDeleteEntityItemReviewsRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3476,6 +3420,7 @@ bool PlayFab::EconomyModels::FDeleteInventoryCollectionRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3618,6 +3563,7 @@ bool PlayFab::EconomyModels::FDeleteInventoryItemsRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3765,6 +3711,7 @@ bool PlayFab::EconomyModels::FDeleteItemRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3955,11 +3902,7 @@ bool PlayFab::EconomyModels::FPurchaseInventoryItemsOperation::readFromValue(con
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PriceAmountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PriceAmounts"));
-    for (int32 Idx = 0; Idx < PriceAmountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PriceAmountsArray[Idx];
-        PriceAmounts.Add(FPurchasePriceAmount(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PriceAmountsArray, PriceAmounts);
 
 
     const TSharedPtr<FJsonValue> StoreIdValue = obj->TryGetField(TEXT("StoreId"));
@@ -4415,6 +4358,7 @@ bool PlayFab::EconomyModels::FExecuteInventoryOperationsRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4442,11 +4386,7 @@ bool PlayFab::EconomyModels::FExecuteInventoryOperationsRequest::readFromValue(c
     }
 
     const TArray<TSharedPtr<FJsonValue>>&OperationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Operations"));
-    for (int32 Idx = 0; Idx < OperationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = OperationsArray[Idx];
-        Operations.Add(FInventoryOperation(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(OperationsArray, Operations);
 
 
     return HasSucceeded;
@@ -4585,6 +4525,7 @@ bool PlayFab::EconomyModels::FExecuteTransferOperationsRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4619,11 +4560,7 @@ bool PlayFab::EconomyModels::FExecuteTransferOperationsRequest::readFromValue(co
     }
 
     const TArray<TSharedPtr<FJsonValue>>&OperationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Operations"));
-    for (int32 Idx = 0; Idx < OperationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = OperationsArray[Idx];
-        Operations.Add(FTransferInventoryItemsOperation(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(OperationsArray, Operations);
 
 
     const TSharedPtr<FJsonValue> ReceivingCollectionIdValue = obj->TryGetField(TEXT("ReceivingCollectionId"));
@@ -4778,6 +4715,7 @@ bool PlayFab::EconomyModels::FGetCatalogConfigRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4875,6 +4813,7 @@ bool PlayFab::EconomyModels::FGetDraftItemRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4982,16 +4921,13 @@ bool PlayFab::EconomyModels::FGetDraftItemsRequest::readFromValue(const TSharedP
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AlternateIdsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AlternateIds"));
-    for (int32 Idx = 0; Idx < AlternateIdsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AlternateIdsArray[Idx];
-        AlternateIds.Add(FCatalogAlternateId(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AlternateIdsArray, AlternateIds);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5048,11 +4984,7 @@ bool PlayFab::EconomyModels::FGetDraftItemsResponse::readFromValue(const TShared
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FCatalogItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -5124,6 +5056,7 @@ bool PlayFab::EconomyModels::FGetEntityDraftItemsRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5185,11 +5118,7 @@ bool PlayFab::EconomyModels::FGetEntityDraftItemsResponse::readFromValue(const T
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FCatalogItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -5251,6 +5180,7 @@ bool PlayFab::EconomyModels::FGetEntityItemReviewRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5544,6 +5474,7 @@ bool PlayFab::EconomyModels::FGetInventoryCollectionIdsRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5681,6 +5612,7 @@ bool PlayFab::EconomyModels::FGetInventoryItemsRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5755,11 +5687,7 @@ bool PlayFab::EconomyModels::FGetInventoryItemsResponse::readFromValue(const TSh
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FInventoryItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -5815,6 +5743,7 @@ bool PlayFab::EconomyModels::FGetInventoryOperationStatusRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5941,6 +5870,7 @@ bool PlayFab::EconomyModels::FGetItemContainersRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5995,11 +5925,7 @@ bool PlayFab::EconomyModels::FGetItemContainersResponse::readFromValue(const TSh
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ContainersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Containers"));
-    for (int32 Idx = 0; Idx < ContainersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContainersArray[Idx];
-        Containers.Add(FCatalogItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContainersArray, Containers);
 
 
     const TSharedPtr<FJsonValue> ContinuationTokenValue = obj->TryGetField(TEXT("ContinuationToken"));
@@ -6061,6 +5987,7 @@ bool PlayFab::EconomyModels::FGetItemModerationStateRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6165,6 +6092,7 @@ bool PlayFab::EconomyModels::FGetItemPublishStatusRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6207,17 +6135,17 @@ EconomyModels::PublishResult PlayFab::EconomyModels::readPublishResultFromValue(
 
 EconomyModels::PublishResult PlayFab::EconomyModels::readPublishResultFromValue(const FString& value)
 {
-    static TMap<FString, PublishResult> _PublishResultMap;
-    if (_PublishResultMap.Num() == 0)
+    static const TMap<FString, PublishResult> _PublishResultMap = []()
     {
-        // Auto-generate the map on the first use
-        _PublishResultMap.Add(TEXT("Unknown"), PublishResultUnknown);
-        _PublishResultMap.Add(TEXT("Pending"), PublishResultPending);
-        _PublishResultMap.Add(TEXT("Succeeded"), PublishResultSucceeded);
-        _PublishResultMap.Add(TEXT("Failed"), PublishResultFailed);
-        _PublishResultMap.Add(TEXT("Canceled"), PublishResultCanceled);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, PublishResult> Map;
+        Map.Add(TEXT("Unknown"), PublishResultUnknown);
+        Map.Add(TEXT("Pending"), PublishResultPending);
+        Map.Add(TEXT("Succeeded"), PublishResultSucceeded);
+        Map.Add(TEXT("Failed"), PublishResultFailed);
+        Map.Add(TEXT("Canceled"), PublishResultCanceled);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6325,6 +6253,7 @@ bool PlayFab::EconomyModels::FGetItemRequest::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6457,6 +6386,7 @@ bool PlayFab::EconomyModels::FGetItemReviewsRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6519,11 +6449,7 @@ bool PlayFab::EconomyModels::FGetItemReviewsResponse::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ReviewsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Reviews"));
-    for (int32 Idx = 0; Idx < ReviewsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ReviewsArray[Idx];
-        Reviews.Add(FReview(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ReviewsArray, Reviews);
 
 
     return HasSucceeded;
@@ -6578,6 +6504,7 @@ bool PlayFab::EconomyModels::FGetItemReviewSummaryRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6715,16 +6642,13 @@ bool PlayFab::EconomyModels::FGetItemsRequest::readFromValue(const TSharedPtr<FJ
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AlternateIdsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AlternateIds"));
-    for (int32 Idx = 0; Idx < AlternateIdsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AlternateIdsArray[Idx];
-        AlternateIds.Add(FCatalogAlternateId(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AlternateIdsArray, AlternateIds);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6768,11 +6692,7 @@ bool PlayFab::EconomyModels::FGetItemsResponse::readFromValue(const TSharedPtr<F
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FCatalogItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -6808,6 +6728,7 @@ bool PlayFab::EconomyModels::FGetMicrosoftStoreAccessTokensRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6942,6 +6863,7 @@ bool PlayFab::EconomyModels::FGetTransactionHistoryRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -7356,11 +7278,7 @@ bool PlayFab::EconomyModels::FTransaction::readFromValue(const TSharedPtr<FJsonO
     }
 
     const TArray<TSharedPtr<FJsonValue>>&OperationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Operations"));
-    for (int32 Idx = 0; Idx < OperationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = OperationsArray[Idx];
-        Operations.Add(FTransactionOperation(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(OperationsArray, Operations);
 
 
     const TSharedPtr<FJsonValue> OperationTypeValue = obj->TryGetField(TEXT("OperationType"));
@@ -7442,11 +7360,7 @@ bool PlayFab::EconomyModels::FGetTransactionHistoryResponse::readFromValue(const
     }
 
     const TArray<TSharedPtr<FJsonValue>>&TransactionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Transactions"));
-    for (int32 Idx = 0; Idx < TransactionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = TransactionsArray[Idx];
-        Transactions.Add(FTransaction(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(TransactionsArray, Transactions);
 
 
     return HasSucceeded;
@@ -7515,15 +7429,15 @@ EconomyModels::HelpfulnessVote PlayFab::EconomyModels::readHelpfulnessVoteFromVa
 
 EconomyModels::HelpfulnessVote PlayFab::EconomyModels::readHelpfulnessVoteFromValue(const FString& value)
 {
-    static TMap<FString, HelpfulnessVote> _HelpfulnessVoteMap;
-    if (_HelpfulnessVoteMap.Num() == 0)
+    static const TMap<FString, HelpfulnessVote> _HelpfulnessVoteMap = []()
     {
-        // Auto-generate the map on the first use
-        _HelpfulnessVoteMap.Add(TEXT("None"), HelpfulnessVoteNone);
-        _HelpfulnessVoteMap.Add(TEXT("UnHelpful"), HelpfulnessVoteUnHelpful);
-        _HelpfulnessVoteMap.Add(TEXT("Helpful"), HelpfulnessVoteHelpful);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, HelpfulnessVote> Map;
+        Map.Add(TEXT("None"), HelpfulnessVoteNone);
+        Map.Add(TEXT("UnHelpful"), HelpfulnessVoteUnHelpful);
+        Map.Add(TEXT("Helpful"), HelpfulnessVoteHelpful);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -7597,6 +7511,7 @@ bool PlayFab::EconomyModels::FPublishDraftItemRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -7758,6 +7673,7 @@ bool PlayFab::EconomyModels::FPurchaseInventoryItemsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -7811,11 +7727,7 @@ bool PlayFab::EconomyModels::FPurchaseInventoryItemsRequest::readFromValue(const
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PriceAmountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PriceAmounts"));
-    for (int32 Idx = 0; Idx < PriceAmountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PriceAmountsArray[Idx];
-        PriceAmounts.Add(FPurchasePriceAmount(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PriceAmountsArray, PriceAmounts);
 
 
     const TSharedPtr<FJsonValue> StoreIdValue = obj->TryGetField(TEXT("StoreId"));
@@ -7959,6 +7871,7 @@ bool PlayFab::EconomyModels::FRedeemAppleAppStoreInventoryItemsRequest::readFrom
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8149,19 +8062,11 @@ bool PlayFab::EconomyModels::FRedeemAppleAppStoreInventoryItemsResponse::readFro
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FailedArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Failed"));
-    for (int32 Idx = 0; Idx < FailedArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FailedArray[Idx];
-        Failed.Add(FRedemptionFailure(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FailedArray, Failed);
 
 
     const TArray<TSharedPtr<FJsonValue>>&SucceededArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Succeeded"));
-    for (int32 Idx = 0; Idx < SucceededArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SucceededArray[Idx];
-        Succeeded.Add(FRedemptionSuccess(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SucceededArray, Succeeded);
 
 
     obj->TryGetStringArrayField(TEXT("TransactionIds"), TransactionIds);
@@ -8228,6 +8133,7 @@ bool PlayFab::EconomyModels::FRedeemGooglePlayInventoryItemsRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8241,11 +8147,7 @@ bool PlayFab::EconomyModels::FRedeemGooglePlayInventoryItemsRequest::readFromVal
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PurchasesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Purchases"));
-    for (int32 Idx = 0; Idx < PurchasesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PurchasesArray[Idx];
-        Purchases.Add(FGooglePlayProductPurchase(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PurchasesArray, Purchases);
 
 
     return HasSucceeded;
@@ -8295,19 +8197,11 @@ bool PlayFab::EconomyModels::FRedeemGooglePlayInventoryItemsResponse::readFromVa
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FailedArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Failed"));
-    for (int32 Idx = 0; Idx < FailedArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FailedArray[Idx];
-        Failed.Add(FRedemptionFailure(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FailedArray, Failed);
 
 
     const TArray<TSharedPtr<FJsonValue>>&SucceededArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Succeeded"));
-    for (int32 Idx = 0; Idx < SucceededArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SucceededArray[Idx];
-        Succeeded.Add(FRedemptionSuccess(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SucceededArray, Succeeded);
 
 
     obj->TryGetStringArrayField(TEXT("TransactionIds"), TransactionIds);
@@ -8384,6 +8278,7 @@ bool PlayFab::EconomyModels::FRedeemMicrosoftStoreInventoryItemsRequest::readFro
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8450,19 +8345,11 @@ bool PlayFab::EconomyModels::FRedeemMicrosoftStoreInventoryItemsResponse::readFr
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FailedArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Failed"));
-    for (int32 Idx = 0; Idx < FailedArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FailedArray[Idx];
-        Failed.Add(FRedemptionFailure(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FailedArray, Failed);
 
 
     const TArray<TSharedPtr<FJsonValue>>&SucceededArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Succeeded"));
-    for (int32 Idx = 0; Idx < SucceededArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SucceededArray[Idx];
-        Succeeded.Add(FRedemptionSuccess(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SucceededArray, Succeeded);
 
 
     obj->TryGetStringArrayField(TEXT("TransactionIds"), TransactionIds);
@@ -8526,6 +8413,7 @@ bool PlayFab::EconomyModels::FRedeemNintendoEShopInventoryItemsRequest::readFrom
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8592,19 +8480,11 @@ bool PlayFab::EconomyModels::FRedeemNintendoEShopInventoryItemsResponse::readFro
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FailedArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Failed"));
-    for (int32 Idx = 0; Idx < FailedArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FailedArray[Idx];
-        Failed.Add(FRedemptionFailure(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FailedArray, Failed);
 
 
     const TArray<TSharedPtr<FJsonValue>>&SucceededArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Succeeded"));
-    for (int32 Idx = 0; Idx < SucceededArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SucceededArray[Idx];
-        Succeeded.Add(FRedemptionSuccess(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SucceededArray, Succeeded);
 
 
     obj->TryGetStringArrayField(TEXT("TransactionIds"), TransactionIds);
@@ -8687,6 +8567,7 @@ bool PlayFab::EconomyModels::FRedeemPlayStationStoreInventoryItemsRequest::readF
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8760,19 +8641,11 @@ bool PlayFab::EconomyModels::FRedeemPlayStationStoreInventoryItemsResponse::read
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FailedArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Failed"));
-    for (int32 Idx = 0; Idx < FailedArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FailedArray[Idx];
-        Failed.Add(FRedemptionFailure(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FailedArray, Failed);
 
 
     const TArray<TSharedPtr<FJsonValue>>&SucceededArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Succeeded"));
-    for (int32 Idx = 0; Idx < SucceededArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SucceededArray[Idx];
-        Succeeded.Add(FRedemptionSuccess(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SucceededArray, Succeeded);
 
 
     obj->TryGetStringArrayField(TEXT("TransactionIds"), TransactionIds);
@@ -8830,6 +8703,7 @@ bool PlayFab::EconomyModels::FRedeemSteamInventoryItemsRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8889,19 +8763,11 @@ bool PlayFab::EconomyModels::FRedeemSteamInventoryItemsResponse::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FailedArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Failed"));
-    for (int32 Idx = 0; Idx < FailedArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FailedArray[Idx];
-        Failed.Add(FRedemptionFailure(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FailedArray, Failed);
 
 
     const TArray<TSharedPtr<FJsonValue>>&SucceededArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Succeeded"));
-    for (int32 Idx = 0; Idx < SucceededArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SucceededArray[Idx];
-        Succeeded.Add(FRedemptionSuccess(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SucceededArray, Succeeded);
 
 
     obj->TryGetStringArrayField(TEXT("TransactionIds"), TransactionIds);
@@ -8979,6 +8845,7 @@ bool PlayFab::EconomyModels::FReportItemRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9103,6 +8970,7 @@ bool PlayFab::EconomyModels::FReportItemReviewRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9221,6 +9089,7 @@ bool PlayFab::EconomyModels::FReviewItemRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9468,6 +9337,7 @@ bool PlayFab::EconomyModels::FSearchItemsRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9563,11 +9433,7 @@ bool PlayFab::EconomyModels::FSearchItemsResponse::readFromValue(const TSharedPt
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FCatalogItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -9634,6 +9500,7 @@ bool PlayFab::EconomyModels::FSetItemModerationStateRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9746,6 +9613,7 @@ bool PlayFab::EconomyModels::FSubmitItemReviewVoteRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9887,6 +9755,7 @@ bool PlayFab::EconomyModels::FSubtractInventoryItemsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10031,6 +9900,7 @@ bool PlayFab::EconomyModels::FTakedownItemReviewsRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10038,11 +9908,7 @@ bool PlayFab::EconomyModels::FTakedownItemReviewsRequest::readFromValue(const TS
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ReviewsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Reviews"));
-    for (int32 Idx = 0; Idx < ReviewsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ReviewsArray[Idx];
-        Reviews.Add(FReviewTakedown(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ReviewsArray, Reviews);
 
 
     return HasSucceeded;
@@ -10172,6 +10038,7 @@ bool PlayFab::EconomyModels::FTransferInventoryItemsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10382,6 +10249,7 @@ bool PlayFab::EconomyModels::FUpdateCatalogConfigRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10450,6 +10318,7 @@ bool PlayFab::EconomyModels::FUpdateDraftItemRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10573,6 +10442,7 @@ bool PlayFab::EconomyModels::FUpdateInventoryItemsRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10664,3 +10534,5 @@ bool PlayFab::EconomyModels::FUpdateInventoryItemsResponse::readFromValue(const
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_ECONOMY_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_ECONOMY_API
 #include "Core/PlayFabEconomyInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabEconomyInstanceAPI::GetOrCreat
     return this->authContext;
 }
 
-bool UPlayFabEconomyInstanceAPI::AddInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::AddInventoryItems(
     EconomyModels::FAddInventoryItemsRequest& request,
     const FAddInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabEconomyInstanceAPI::AddInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/AddInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnAddInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnAddInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabEconomyInstanceAPI::OnAddInventoryItemsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::CreateDraftItem(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::CreateDraftItem(
     EconomyModels::FCreateDraftItemRequest& request,
     const FCreateDraftItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabEconomyInstanceAPI::CreateDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/CreateDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnCreateDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnCreateDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabEconomyInstanceAPI::OnCreateDraftItemResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::CreateUploadUrls(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::CreateUploadUrls(
     EconomyModels::FCreateUploadUrlsRequest& request,
     const FCreateUploadUrlsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabEconomyInstanceAPI::CreateUploadUrls(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/CreateUploadUrls"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnCreateUploadUrlsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnCreateUploadUrlsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateUploadUrlsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabEconomyInstanceAPI::OnCreateUploadUrlsResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::DeleteEntityItemReviews(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::DeleteEntityItemReviews(
     EconomyModels::FDeleteEntityItemReviewsRequest& request,
     const FDeleteEntityItemReviewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabEconomyInstanceAPI::DeleteEntityItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/DeleteEntityItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnDeleteEntityItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnDeleteEntityItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteEntityItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabEconomyInstanceAPI::OnDeleteEntityItemReviewsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::DeleteInventoryCollection(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::DeleteInventoryCollection(
     EconomyModels::FDeleteInventoryCollectionRequest& request,
     const FDeleteInventoryCollectionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabEconomyInstanceAPI::DeleteInventoryCollection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/DeleteInventoryCollection"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnDeleteInventoryCollectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnDeleteInventoryCollectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteInventoryCollectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabEconomyInstanceAPI::OnDeleteInventoryCollectionResult(FHttpRequestP
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::DeleteInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::DeleteInventoryItems(
     EconomyModels::FDeleteInventoryItemsRequest& request,
     const FDeleteInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabEconomyInstanceAPI::DeleteInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/DeleteInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnDeleteInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnDeleteInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabEconomyInstanceAPI::OnDeleteInventoryItemsResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::DeleteItem(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::DeleteItem(
     EconomyModels::FDeleteItemRequest& request,
     const FDeleteItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabEconomyInstanceAPI::DeleteItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/DeleteItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnDeleteItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnDeleteItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabEconomyInstanceAPI::OnDeleteItemResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::ExecuteInventoryOperations(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::ExecuteInventoryOperations(
     EconomyModels::FExecuteInventoryOperationsRequest& request,
     const FExecuteInventoryOperationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabEconomyInstanceAPI::ExecuteInventoryOperations(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/ExecuteInventoryOperations"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnExecuteInventoryOperationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnExecuteInventoryOperationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteInventoryOperationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabEconomyInstanceAPI::OnExecuteInventoryOperationsResult(FHttpRequest
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::ExecuteTransferOperations(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::ExecuteTransferOperations(
     EconomyModels::FExecuteTransferOperationsRequest& request,
     const FExecuteTransferOperationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabEconomyInstanceAPI::ExecuteTransferOperations(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/ExecuteTransferOperations"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnExecuteTransferOperationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnExecuteTransferOperationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteTransferOperationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -347,7 +348,7 @@ void UPlayFabEconomyInstanceAPI::OnExecuteTransferOperationsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetCatalogConfig(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetCatalogConfig(
     EconomyModels::FGetCatalogConfigRequest& request,
     const FGetCatalogConfigDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -360,7 +361,7 @@ bool UPlayFabEconomyInstanceAPI::GetCatalogConfig(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetCatalogConfig"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetCatalogConfigResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetCatalogConfigResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogConfigDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -377,7 +378,7 @@ void UPlayFabEconomyInstanceAPI::OnGetCatalogConfigResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetDraftItem(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetDraftItem(
     EconomyModels::FGetDraftItemRequest& request,
     const FGetDraftItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -390,7 +391,7 @@ bool UPlayFabEconomyInstanceAPI::GetDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -407,7 +408,7 @@ void UPlayFabEconomyInstanceAPI::OnGetDraftItemResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetDraftItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetDraftItems(
     EconomyModels::FGetDraftItemsRequest& request,
     const FGetDraftItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -420,7 +421,7 @@ bool UPlayFabEconomyInstanceAPI::GetDraftItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetDraftItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetDraftItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetDraftItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDraftItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -437,7 +438,7 @@ void UPlayFabEconomyInstanceAPI::OnGetDraftItemsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetEntityDraftItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetEntityDraftItems(
     EconomyModels::FGetEntityDraftItemsRequest& request,
     const FGetEntityDraftItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -450,7 +451,7 @@ bool UPlayFabEconomyInstanceAPI::GetEntityDraftItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetEntityDraftItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetEntityDraftItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetEntityDraftItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityDraftItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -467,7 +468,7 @@ void UPlayFabEconomyInstanceAPI::OnGetEntityDraftItemsResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetEntityItemReview(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetEntityItemReview(
     EconomyModels::FGetEntityItemReviewRequest& request,
     const FGetEntityItemReviewDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -480,7 +481,7 @@ bool UPlayFabEconomyInstanceAPI::GetEntityItemReview(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetEntityItemReview"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetEntityItemReviewResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetEntityItemReviewResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityItemReviewDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -497,7 +498,7 @@ void UPlayFabEconomyInstanceAPI::OnGetEntityItemReviewResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetInventoryCollectionIds(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetInventoryCollectionIds(
     EconomyModels::FGetInventoryCollectionIdsRequest& request,
     const FGetInventoryCollectionIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -510,7 +511,7 @@ bool UPlayFabEconomyInstanceAPI::GetInventoryCollectionIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/GetInventoryCollectionIds"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetInventoryCollectionIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetInventoryCollectionIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetInventoryCollectionIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -527,7 +528,7 @@ void UPlayFabEconomyInstanceAPI::OnGetInventoryCollectionIdsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetInventoryItems(
     EconomyModels::FGetInventoryItemsRequest& request,
     const FGetInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -540,7 +541,7 @@ bool UPlayFabEconomyInstanceAPI::GetInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/GetInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -557,7 +558,7 @@ void UPlayFabEconomyInstanceAPI::OnGetInventoryItemsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetInventoryOperationStatus(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetInventoryOperationStatus(
     EconomyModels::FGetInventoryOperationStatusRequest& request,
     const FGetInventoryOperationStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -570,7 +571,7 @@ bool UPlayFabEconomyInstanceAPI::GetInventoryOperationStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/GetInventoryOperationStatus"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetInventoryOperationStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetInventoryOperationStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetInventoryOperationStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -587,7 +588,7 @@ void UPlayFabEconomyInstanceAPI::OnGetInventoryOperationStatusResult(FHttpReques
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetItem(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetItem(
     EconomyModels::FGetItemRequest& request,
     const FGetItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -600,7 +601,7 @@ bool UPlayFabEconomyInstanceAPI::GetItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -617,7 +618,7 @@ void UPlayFabEconomyInstanceAPI::OnGetItemResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetItemContainers(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetItemContainers(
     EconomyModels::FGetItemContainersRequest& request,
     const FGetItemContainersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -630,7 +631,7 @@ bool UPlayFabEconomyInstanceAPI::GetItemContainers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItemContainers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemContainersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemContainersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemContainersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -647,7 +648,7 @@ void UPlayFabEconomyInstanceAPI::OnGetItemContainersResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetItemModerationState(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetItemModerationState(
     EconomyModels::FGetItemModerationStateRequest& request,
     const FGetItemModerationStateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -660,7 +661,7 @@ bool UPlayFabEconomyInstanceAPI::GetItemModerationState(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItemModerationState"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemModerationStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemModerationStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemModerationStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -677,7 +678,7 @@ void UPlayFabEconomyInstanceAPI::OnGetItemModerationStateResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetItemPublishStatus(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetItemPublishStatus(
     EconomyModels::FGetItemPublishStatusRequest& request,
     const FGetItemPublishStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -690,7 +691,7 @@ bool UPlayFabEconomyInstanceAPI::GetItemPublishStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItemPublishStatus"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemPublishStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemPublishStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemPublishStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -707,7 +708,7 @@ void UPlayFabEconomyInstanceAPI::OnGetItemPublishStatusResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetItemReviews(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetItemReviews(
     EconomyModels::FGetItemReviewsRequest& request,
     const FGetItemReviewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -720,7 +721,7 @@ bool UPlayFabEconomyInstanceAPI::GetItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -737,7 +738,7 @@ void UPlayFabEconomyInstanceAPI::OnGetItemReviewsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetItemReviewSummary(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetItemReviewSummary(
     EconomyModels::FGetItemReviewSummaryRequest& request,
     const FGetItemReviewSummaryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -750,7 +751,7 @@ bool UPlayFabEconomyInstanceAPI::GetItemReviewSummary(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItemReviewSummary"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemReviewSummaryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemReviewSummaryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemReviewSummaryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -767,7 +768,7 @@ void UPlayFabEconomyInstanceAPI::OnGetItemReviewSummaryResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetItems(
     EconomyModels::FGetItemsRequest& request,
     const FGetItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -780,7 +781,7 @@ bool UPlayFabEconomyInstanceAPI::GetItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -797,7 +798,7 @@ void UPlayFabEconomyInstanceAPI::OnGetItemsResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetMicrosoftStoreAccessTokens(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetMicrosoftStoreAccessTokens(
     EconomyModels::FGetMicrosoftStoreAccessTokensRequest& request,
     const FGetMicrosoftStoreAccessTokensDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -810,7 +811,7 @@ bool UPlayFabEconomyInstanceAPI::GetMicrosoftStoreAccessTokens(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/GetMicrosoftStoreAccessTokens"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetMicrosoftStoreAccessTokensResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetMicrosoftStoreAccessTokensResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMicrosoftStoreAccessTokensDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -827,7 +828,7 @@ void UPlayFabEconomyInstanceAPI::OnGetMicrosoftStoreAccessTokensResult(FHttpRequ
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::GetTransactionHistory(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::GetTransactionHistory(
     EconomyModels::FGetTransactionHistoryRequest& request,
     const FGetTransactionHistoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -840,7 +841,7 @@ bool UPlayFabEconomyInstanceAPI::GetTransactionHistory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/GetTransactionHistory"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetTransactionHistoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetTransactionHistoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTransactionHistoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -857,7 +858,7 @@ void UPlayFabEconomyInstanceAPI::OnGetTransactionHistoryResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::PublishDraftItem(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::PublishDraftItem(
     EconomyModels::FPublishDraftItemRequest& request,
     const FPublishDraftItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -870,7 +871,7 @@ bool UPlayFabEconomyInstanceAPI::PublishDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/PublishDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnPublishDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnPublishDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPublishDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -887,7 +888,7 @@ void UPlayFabEconomyInstanceAPI::OnPublishDraftItemResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::PurchaseInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::PurchaseInventoryItems(
     EconomyModels::FPurchaseInventoryItemsRequest& request,
     const FPurchaseInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -900,7 +901,7 @@ bool UPlayFabEconomyInstanceAPI::PurchaseInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/PurchaseInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnPurchaseInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnPurchaseInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPurchaseInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -917,7 +918,7 @@ void UPlayFabEconomyInstanceAPI::OnPurchaseInventoryItemsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::RedeemAppleAppStoreInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::RedeemAppleAppStoreInventoryItems(
     EconomyModels::FRedeemAppleAppStoreInventoryItemsRequest& request,
     const FRedeemAppleAppStoreInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -930,7 +931,7 @@ bool UPlayFabEconomyInstanceAPI::RedeemAppleAppStoreInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/RedeemAppleAppStoreInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnRedeemAppleAppStoreInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnRedeemAppleAppStoreInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemAppleAppStoreInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -947,7 +948,7 @@ void UPlayFabEconomyInstanceAPI::OnRedeemAppleAppStoreInventoryItemsResult(FHttp
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::RedeemGooglePlayInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::RedeemGooglePlayInventoryItems(
     EconomyModels::FRedeemGooglePlayInventoryItemsRequest& request,
     const FRedeemGooglePlayInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -960,7 +961,7 @@ bool UPlayFabEconomyInstanceAPI::RedeemGooglePlayInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/RedeemGooglePlayInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnRedeemGooglePlayInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnRedeemGooglePlayInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemGooglePlayInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -977,7 +978,7 @@ void UPlayFabEconomyInstanceAPI::OnRedeemGooglePlayInventoryItemsResult(FHttpReq
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::RedeemMicrosoftStoreInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::RedeemMicrosoftStoreInventoryItems(
     EconomyModels::FRedeemMicrosoftStoreInventoryItemsRequest& request,
     const FRedeemMicrosoftStoreInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -990,7 +991,7 @@ bool UPlayFabEconomyInstanceAPI::RedeemMicrosoftStoreInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/RedeemMicrosoftStoreInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnRedeemMicrosoftStoreInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnRedeemMicrosoftStoreInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemMicrosoftStoreInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1007,7 +1008,7 @@ void UPlayFabEconomyInstanceAPI::OnRedeemMicrosoftStoreInventoryItemsResult(FHtt
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::RedeemNintendoEShopInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::RedeemNintendoEShopInventoryItems(
     EconomyModels::FRedeemNintendoEShopInventoryItemsRequest& request,
     const FRedeemNintendoEShopInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1020,7 +1021,7 @@ bool UPlayFabEconomyInstanceAPI::RedeemNintendoEShopInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/RedeemNintendoEShopInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnRedeemNintendoEShopInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnRedeemNintendoEShopInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemNintendoEShopInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1037,7 +1038,7 @@ void UPlayFabEconomyInstanceAPI::OnRedeemNintendoEShopInventoryItemsResult(FHttp
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::RedeemPlayStationStoreInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::RedeemPlayStationStoreInventoryItems(
     EconomyModels::FRedeemPlayStationStoreInventoryItemsRequest& request,
     const FRedeemPlayStationStoreInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1050,7 +1051,7 @@ bool UPlayFabEconomyInstanceAPI::RedeemPlayStationStoreInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/RedeemPlayStationStoreInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnRedeemPlayStationStoreInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnRedeemPlayStationStoreInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemPlayStationStoreInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1067,7 +1068,7 @@ void UPlayFabEconomyInstanceAPI::OnRedeemPlayStationStoreInventoryItemsResult(FH
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::RedeemSteamInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::RedeemSteamInventoryItems(
     EconomyModels::FRedeemSteamInventoryItemsRequest& request,
     const FRedeemSteamInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1080,7 +1081,7 @@ bool UPlayFabEconomyInstanceAPI::RedeemSteamInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/RedeemSteamInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnRedeemSteamInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnRedeemSteamInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemSteamInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1097,7 +1098,7 @@ void UPlayFabEconomyInstanceAPI::OnRedeemSteamInventoryItemsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::ReportItem(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::ReportItem(
     EconomyModels::FReportItemRequest& request,
     const FReportItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1110,7 +1111,7 @@ bool UPlayFabEconomyInstanceAPI::ReportItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/ReportItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnReportItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnReportItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1127,7 +1128,7 @@ void UPlayFabEconomyInstanceAPI::OnReportItemResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::ReportItemReview(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::ReportItemReview(
     EconomyModels::FReportItemReviewRequest& request,
     const FReportItemReviewDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1140,7 +1141,7 @@ bool UPlayFabEconomyInstanceAPI::ReportItemReview(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/ReportItemReview"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnReportItemReviewResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnReportItemReviewResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportItemReviewDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1157,7 +1158,7 @@ void UPlayFabEconomyInstanceAPI::OnReportItemReviewResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::ReviewItem(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::ReviewItem(
     EconomyModels::FReviewItemRequest& request,
     const FReviewItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1170,7 +1171,7 @@ bool UPlayFabEconomyInstanceAPI::ReviewItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/ReviewItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnReviewItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnReviewItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReviewItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1187,7 +1188,7 @@ void UPlayFabEconomyInstanceAPI::OnReviewItemResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::SearchItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::SearchItems(
     EconomyModels::FSearchItemsRequest& request,
     const FSearchItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1200,7 +1201,7 @@ bool UPlayFabEconomyInstanceAPI::SearchItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/SearchItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnSearchItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnSearchItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSearchItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1217,7 +1218,7 @@ void UPlayFabEconomyInstanceAPI::OnSearchItemsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::SetItemModerationState(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::SetItemModerationState(
     EconomyModels::FSetItemModerationStateRequest& request,
     const FSetItemModerationStateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1230,7 +1231,7 @@ bool UPlayFabEconomyInstanceAPI::SetItemModerationState(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/SetItemModerationState"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnSetItemModerationStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnSetItemModerationStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetItemModerationStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1247,7 +1248,7 @@ void UPlayFabEconomyInstanceAPI::OnSetItemModerationStateResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::SubmitItemReviewVote(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::SubmitItemReviewVote(
     EconomyModels::FSubmitItemReviewVoteRequest& request,
     const FSubmitItemReviewVoteDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1260,7 +1261,7 @@ bool UPlayFabEconomyInstanceAPI::SubmitItemReviewVote(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/SubmitItemReviewVote"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnSubmitItemReviewVoteResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnSubmitItemReviewVoteResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubmitItemReviewVoteDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1277,7 +1278,7 @@ void UPlayFabEconomyInstanceAPI::OnSubmitItemReviewVoteResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::SubtractInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::SubtractInventoryItems(
     EconomyModels::FSubtractInventoryItemsRequest& request,
     const FSubtractInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1290,7 +1291,7 @@ bool UPlayFabEconomyInstanceAPI::SubtractInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/SubtractInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnSubtractInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnSubtractInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1307,7 +1308,7 @@ void UPlayFabEconomyInstanceAPI::OnSubtractInventoryItemsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::TakedownItemReviews(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::TakedownItemReviews(
     EconomyModels::FTakedownItemReviewsRequest& request,
     const FTakedownItemReviewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1320,7 +1321,7 @@ bool UPlayFabEconomyInstanceAPI::TakedownItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/TakedownItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnTakedownItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnTakedownItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FTakedownItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1337,7 +1338,7 @@ void UPlayFabEconomyInstanceAPI::OnTakedownItemReviewsResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::TransferInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::TransferInventoryItems(
     EconomyModels::FTransferInventoryItemsRequest& request,
     const FTransferInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1350,7 +1351,7 @@ bool UPlayFabEconomyInstanceAPI::TransferInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/TransferInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnTransferInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnTransferInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FTransferInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1367,7 +1368,7 @@ void UPlayFabEconomyInstanceAPI::OnTransferInventoryItemsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::UpdateCatalogConfig(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::UpdateCatalogConfig(
     EconomyModels::FUpdateCatalogConfigRequest& request,
     const FUpdateCatalogConfigDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1380,7 +1381,7 @@ bool UPlayFabEconomyInstanceAPI::UpdateCatalogConfig(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/UpdateCatalogConfig"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnUpdateCatalogConfigResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnUpdateCatalogConfigResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCatalogConfigDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1397,7 +1398,7 @@ void UPlayFabEconomyInstanceAPI::OnUpdateCatalogConfigResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::UpdateDraftItem(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::UpdateDraftItem(
     EconomyModels::FUpdateDraftItemRequest& request,
     const FUpdateDraftItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1410,7 +1411,7 @@ bool UPlayFabEconomyInstanceAPI::UpdateDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/UpdateDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnUpdateDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnUpdateDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1427,7 +1428,7 @@ void UPlayFabEconomyInstanceAPI::OnUpdateDraftItemResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabEconomyInstanceAPI::UpdateInventoryItems(
+FPlayFabRequestHandle UPlayFabEconomyInstanceAPI::UpdateInventoryItems(
     EconomyModels::FUpdateInventoryItemsRequest& request,
     const FUpdateInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1440,7 +1441,7 @@ bool UPlayFabEconomyInstanceAPI::UpdateInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Inventory/UpdateInventoryItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnUpdateInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEconomyInstanceAPI::OnUpdateInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1456,3 +1457,5 @@ void UPlayFabEconomyInstanceAPI::OnUpdateInventoryItemsResult(FHttpRequestPtr Ht
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_ECONOMY_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_EVENTS_API
 #include "Core/PlayFabEventsAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabEventsAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabEventsAPI::CreateTelemetryKey(
+FPlayFabRequestHandle UPlayFabEventsAPI::CreateTelemetryKey(
     EventsModels::FCreateTelemetryKeyRequest& request,
     const FCreateTelemetryKeyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabEventsAPI::CreateTelemetryKey(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/CreateTelemetryKey"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnCreateTelemetryKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsAPI::OnCreateTelemetryKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateTelemetryKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabEventsAPI::OnCreateTelemetryKeyResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabEventsAPI::DeleteTelemetryKey(
+FPlayFabRequestHandle UPlayFabEventsAPI::DeleteTelemetryKey(
     EventsModels::FDeleteTelemetryKeyRequest& request,
     const FDeleteTelemetryKeyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabEventsAPI::DeleteTelemetryKey(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/DeleteTelemetryKey"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnDeleteTelemetryKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsAPI::OnDeleteTelemetryKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTelemetryKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabEventsAPI::OnDeleteTelemetryKeyResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabEventsAPI::GetTelemetryKey(
+FPlayFabRequestHandle UPlayFabEventsAPI::GetTelemetryKey(
     EventsModels::FGetTelemetryKeyRequest& request,
     const FGetTelemetryKeyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabEventsAPI::GetTelemetryKey(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/GetTelemetryKey"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnGetTelemetryKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsAPI::OnGetTelemetryKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTelemetryKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabEventsAPI::OnGetTelemetryKeyResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabEventsAPI::ListTelemetryKeys(
+FPlayFabRequestHandle UPlayFabEventsAPI::ListTelemetryKeys(
     EventsModels::FListTelemetryKeysRequest& request,
     const FListTelemetryKeysDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabEventsAPI::ListTelemetryKeys(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/ListTelemetryKeys"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnListTelemetryKeysResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsAPI::OnListTelemetryKeysResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListTelemetryKeysDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabEventsAPI::OnListTelemetryKeysResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabEventsAPI::SetTelemetryKeyActive(
+FPlayFabRequestHandle UPlayFabEventsAPI::SetTelemetryKeyActive(
     EventsModels::FSetTelemetryKeyActiveRequest& request,
     const FSetTelemetryKeyActiveDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabEventsAPI::SetTelemetryKeyActive(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/SetTelemetryKeyActive"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnSetTelemetryKeyActiveResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsAPI::OnSetTelemetryKeyActiveResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTelemetryKeyActiveDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabEventsAPI::OnSetTelemetryKeyActiveResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabEventsAPI::WriteEvents(
+FPlayFabRequestHandle UPlayFabEventsAPI::WriteEvents(
     EventsModels::FWriteEventsRequest& request,
     const FWriteEventsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabEventsAPI::WriteEvents(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/WriteEvents"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnWriteEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsAPI::OnWriteEventsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteEventsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabEventsAPI::OnWriteEventsResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabEventsAPI::WriteTelemetryEvents(
+FPlayFabRequestHandle UPlayFabEventsAPI::WriteTelemetryEvents(
     EventsModels::FWriteEventsRequest& request,
     const FWriteTelemetryEventsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,10 +221,10 @@ bool UPlayFabEventsAPI::WriteTelemetryEvents(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/WriteTelemetryEvents"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnWriteTelemetryEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
-bool UPlayFabEventsAPI::WriteTelemetryEvents(
+FPlayFabRequestHandle UPlayFabEventsAPI::WriteTelemetryEvents(
     EventsModels::FWriteEventsRequest& request,
     FString telemetryKey,
     const FWriteTelemetryEventsDelegate& SuccessDelegate,
@@ -231,7 +232,7 @@ bool UPlayFabEventsAPI::WriteTelemetryEvents(
 {
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/WriteTelemetryEvents"), request.toJSONString(), TEXT("X-TelemetryKey"), telemetryKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnWriteTelemetryEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsAPI::OnWriteTelemetryEventsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTelemetryEventsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -247,3 +248,5 @@ void UPlayFabEventsAPI::OnWriteTelemetryEventsResult(FHttpRequestPtr HttpRequest
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_EVENTS_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_EVENTS_API
 
 #include "Core/PlayFabEventsDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -27,7 +28,7 @@ void PlayFab::EventsModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -107,6 +108,7 @@ bool PlayFab::EventsModels::FCreateTelemetryKeyRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -279,6 +281,7 @@ bool PlayFab::EventsModels::FDeleteTelemetryKeyRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -411,6 +414,7 @@ bool PlayFab::EventsModels::FEventContents::readFromValue(const TSharedPtr<FJson
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -512,6 +516,7 @@ bool PlayFab::EventsModels::FGetTelemetryKeyRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -603,6 +608,7 @@ bool PlayFab::EventsModels::FListTelemetryKeysRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -644,11 +650,7 @@ bool PlayFab::EventsModels::FListTelemetryKeysResponse::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&KeyDetailsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("KeyDetails"));
-    for (int32 Idx = 0; Idx < KeyDetailsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = KeyDetailsArray[Idx];
-        KeyDetails.Add(FTelemetryKeyDetails(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(KeyDetailsArray, KeyDetails);
 
 
     return HasSucceeded;
@@ -711,6 +713,7 @@ bool PlayFab::EventsModels::FSetTelemetryKeyActiveRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -811,6 +814,7 @@ bool PlayFab::EventsModels::FWriteEventsRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -818,11 +822,7 @@ bool PlayFab::EventsModels::FWriteEventsRequest::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&EventsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Events"));
-    for (int32 Idx = 0; Idx < EventsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = EventsArray[Idx];
-        Events.Add(FEventContents(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(EventsArray, Events);
 
 
     return HasSucceeded;
@@ -858,3 +858,5 @@ bool PlayFab::EventsModels::FWriteEventsResponse::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_EVENTS_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_EVENTS_API
 #include "Core/PlayFabEventsInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabEventsInstanceAPI::GetOrCreate
     return this->authContext;
 }
 
-bool UPlayFabEventsInstanceAPI::CreateTelemetryKey(
+FPlayFabRequestHandle UPlayFabEventsInstanceAPI::CreateTelemetryKey(
     EventsModels::FCreateTelemetryKeyRequest& request,
     const FCreateTelemetryKeyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabEventsInstanceAPI::CreateTelemetryKey(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/CreateTelemetryKey"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnCreateTelemetryKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsInstanceAPI::OnCreateTelemetryKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateTelemetryKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabEventsInstanceAPI::OnCreateTelemetryKeyResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabEventsInstanceAPI::DeleteTelemetryKey(
+FPlayFabRequestHandle UPlayFabEventsInstanceAPI::DeleteTelemetryKey(
     EventsModels::FDeleteTelemetryKeyRequest& request,
     const FDeleteTelemetryKeyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabEventsInstanceAPI::DeleteTelemetryKey(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/DeleteTelemetryKey"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnDeleteTelemetryKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsInstanceAPI::OnDeleteTelemetryKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTelemetryKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabEventsInstanceAPI::OnDeleteTelemetryKeyResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabEventsInstanceAPI::GetTelemetryKey(
+FPlayFabRequestHandle UPlayFabEventsInstanceAPI::GetTelemetryKey(
     EventsModels::FGetTelemetryKeyRequest& request,
     const FGetTelemetryKeyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabEventsInstanceAPI::GetTelemetryKey(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/GetTelemetryKey"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnGetTelemetryKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsInstanceAPI::OnGetTelemetryKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTelemetryKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabEventsInstanceAPI::OnGetTelemetryKeyResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabEventsInstanceAPI::ListTelemetryKeys(
+FPlayFabRequestHandle UPlayFabEventsInstanceAPI::ListTelemetryKeys(
     EventsModels::FListTelemetryKeysRequest& request,
     const FListTelemetryKeysDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabEventsInstanceAPI::ListTelemetryKeys(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/ListTelemetryKeys"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnListTelemetryKeysResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsInstanceAPI::OnListTelemetryKeysResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListTelemetryKeysDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabEventsInstanceAPI::OnListTelemetryKeysResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabEventsInstanceAPI::SetTelemetryKeyActive(
+FPlayFabRequestHandle UPlayFabEventsInstanceAPI::SetTelemetryKeyActive(
     EventsModels::FSetTelemetryKeyActiveRequest& request,
     const FSetTelemetryKeyActiveDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabEventsInstanceAPI::SetTelemetryKeyActive(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/SetTelemetryKeyActive"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnSetTelemetryKeyActiveResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsInstanceAPI::OnSetTelemetryKeyActiveResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTelemetryKeyActiveDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabEventsInstanceAPI::OnSetTelemetryKeyActiveResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabEventsInstanceAPI::WriteEvents(
+FPlayFabRequestHandle UPlayFabEventsInstanceAPI::WriteEvents(
     EventsModels::FWriteEventsRequest& request,
     const FWriteEventsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabEventsInstanceAPI::WriteEvents(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/WriteEvents"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnWriteEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsInstanceAPI::OnWriteEventsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteEventsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabEventsInstanceAPI::OnWriteEventsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabEventsInstanceAPI::WriteTelemetryEvents(
+FPlayFabRequestHandle UPlayFabEventsInstanceAPI::WriteTelemetryEvents(
     EventsModels::FWriteEventsRequest& request,
     const FWriteTelemetryEventsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,10 +271,10 @@ bool UPlayFabEventsInstanceAPI::WriteTelemetryEvents(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/WriteTelemetryEvents"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnWriteTelemetryEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
-bool UPlayFabEventsInstanceAPI::WriteTelemetryEvents(
+FPlayFabRequestHandle UPlayFabEventsInstanceAPI::WriteTelemetryEvents(
     EventsModels::FWriteEventsRequest& request,
     FString telemetryKey,
     const FWriteTelemetryEventsDelegate& SuccessDelegate,
@@ -281,7 +282,7 @@ bool UPlayFabEventsInstanceAPI::WriteTelemetryEvents(
 {
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/WriteTelemetryEvents"), request.toJSONString(), TEXT("X-TelemetryKey"), telemetryKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnWriteTelemetryEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabEventsInstanceAPI::OnWriteTelemetryEventsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTelemetryEventsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -297,3 +298,5 @@ void UPlayFabEventsInstanceAPI::OnWriteTelemetryEventsResult(FHttpRequestPtr Htt
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_EVENTS_API
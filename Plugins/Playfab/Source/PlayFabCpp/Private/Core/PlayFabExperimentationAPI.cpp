@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_EXPERIMENTATION_API
 #include "Core/PlayFabExperimentationAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabExperimentationAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabExperimentationAPI::CreateExclusionGroup(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::CreateExclusionGroup(
     ExperimentationModels::FCreateExclusionGroupRequest& request,
     const FCreateExclusionGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabExperimentationAPI::CreateExclusionGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/CreateExclusionGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnCreateExclusionGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnCreateExclusionGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateExclusionGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabExperimentationAPI::OnCreateExclusionGroupResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabExperimentationAPI::CreateExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::CreateExperiment(
     ExperimentationModels::FCreateExperimentRequest& request,
     const FCreateExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabExperimentationAPI::CreateExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/CreateExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnCreateExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnCreateExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabExperimentationAPI::OnCreateExperimentResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabExperimentationAPI::DeleteExclusionGroup(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::DeleteExclusionGroup(
     ExperimentationModels::FDeleteExclusionGroupRequest& request,
     const FDeleteExclusionGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabExperimentationAPI::DeleteExclusionGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/DeleteExclusionGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnDeleteExclusionGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnDeleteExclusionGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteExclusionGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabExperimentationAPI::OnDeleteExclusionGroupResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabExperimentationAPI::DeleteExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::DeleteExperiment(
     ExperimentationModels::FDeleteExperimentRequest& request,
     const FDeleteExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabExperimentationAPI::DeleteExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/DeleteExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnDeleteExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnDeleteExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabExperimentationAPI::OnDeleteExperimentResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabExperimentationAPI::GetExclusionGroups(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::GetExclusionGroups(
     ExperimentationModels::FGetExclusionGroupsRequest& request,
     const FGetExclusionGroupsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabExperimentationAPI::GetExclusionGroups(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetExclusionGroups"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetExclusionGroupsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnGetExclusionGroupsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetExclusionGroupsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabExperimentationAPI::OnGetExclusionGroupsResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabExperimentationAPI::GetExclusionGroupTraffic(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::GetExclusionGroupTraffic(
     ExperimentationModels::FGetExclusionGroupTrafficRequest& request,
     const FGetExclusionGroupTrafficDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabExperimentationAPI::GetExclusionGroupTraffic(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetExclusionGroupTraffic"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetExclusionGroupTrafficResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnGetExclusionGroupTrafficResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetExclusionGroupTrafficDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabExperimentationAPI::OnGetExclusionGroupTrafficResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabExperimentationAPI::GetExperiments(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::GetExperiments(
     ExperimentationModels::FGetExperimentsRequest& request,
     const FGetExperimentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,7 +221,7 @@ bool UPlayFabExperimentationAPI::GetExperiments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetExperiments"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetExperimentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnGetExperimentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetExperimentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -237,7 +238,7 @@ void UPlayFabExperimentationAPI::OnGetExperimentsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabExperimentationAPI::GetLatestScorecard(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::GetLatestScorecard(
     ExperimentationModels::FGetLatestScorecardRequest& request,
     const FGetLatestScorecardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -250,7 +251,7 @@ bool UPlayFabExperimentationAPI::GetLatestScorecard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetLatestScorecard"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetLatestScorecardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnGetLatestScorecardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLatestScorecardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -267,7 +268,7 @@ void UPlayFabExperimentationAPI::OnGetLatestScorecardResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabExperimentationAPI::GetTreatmentAssignment(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::GetTreatmentAssignment(
     ExperimentationModels::FGetTreatmentAssignmentRequest& request,
     const FGetTreatmentAssignmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -280,7 +281,7 @@ bool UPlayFabExperimentationAPI::GetTreatmentAssignment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetTreatmentAssignment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetTreatmentAssignmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnGetTreatmentAssignmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTreatmentAssignmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -297,7 +298,7 @@ void UPlayFabExperimentationAPI::OnGetTreatmentAssignmentResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabExperimentationAPI::StartExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::StartExperiment(
     ExperimentationModels::FStartExperimentRequest& request,
     const FStartExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -310,7 +311,7 @@ bool UPlayFabExperimentationAPI::StartExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/StartExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnStartExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnStartExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -327,7 +328,7 @@ void UPlayFabExperimentationAPI::OnStartExperimentResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabExperimentationAPI::StopExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::StopExperiment(
     ExperimentationModels::FStopExperimentRequest& request,
     const FStopExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -340,7 +341,7 @@ bool UPlayFabExperimentationAPI::StopExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/StopExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnStopExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnStopExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStopExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -357,7 +358,7 @@ void UPlayFabExperimentationAPI::OnStopExperimentResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabExperimentationAPI::UpdateExclusionGroup(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::UpdateExclusionGroup(
     ExperimentationModels::FUpdateExclusionGroupRequest& request,
     const FUpdateExclusionGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -370,7 +371,7 @@ bool UPlayFabExperimentationAPI::UpdateExclusionGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/UpdateExclusionGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnUpdateExclusionGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnUpdateExclusionGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateExclusionGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -387,7 +388,7 @@ void UPlayFabExperimentationAPI::OnUpdateExclusionGroupResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabExperimentationAPI::UpdateExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationAPI::UpdateExperiment(
     ExperimentationModels::FUpdateExperimentRequest& request,
     const FUpdateExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -400,7 +401,7 @@ bool UPlayFabExperimentationAPI::UpdateExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/UpdateExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnUpdateExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationAPI::OnUpdateExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -416,3 +417,5 @@ void UPlayFabExperimentationAPI::OnUpdateExperimentResult(FHttpRequestPtr HttpRe
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_EXPERIMENTATION_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_EXPERIMENTATION_API
 
 #include "Core/PlayFabExperimentationDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -33,19 +34,19 @@ ExperimentationModels::AnalysisTaskState PlayFab::ExperimentationModels::readAna
 
 ExperimentationModels::AnalysisTaskState PlayFab::ExperimentationModels::readAnalysisTaskStateFromValue(const FString& value)
 {
-    static TMap<FString, AnalysisTaskState> _AnalysisTaskStateMap;
-    if (_AnalysisTaskStateMap.Num() == 0)
+    static const TMap<FString, AnalysisTaskState> _AnalysisTaskStateMap = []()
     {
-        // Auto-generate the map on the first use
-        _AnalysisTaskStateMap.Add(TEXT("Waiting"), AnalysisTaskStateWaiting);
-        _AnalysisTaskStateMap.Add(TEXT("ReadyForSubmission"), AnalysisTaskStateReadyForSubmission);
-        _AnalysisTaskStateMap.Add(TEXT("SubmittingToPipeline"), AnalysisTaskStateSubmittingToPipeline);
-        _AnalysisTaskStateMap.Add(TEXT("Running"), AnalysisTaskStateRunning);
-        _AnalysisTaskStateMap.Add(TEXT("Completed"), AnalysisTaskStateCompleted);
-        _AnalysisTaskStateMap.Add(TEXT("Failed"), AnalysisTaskStateFailed);
-        _AnalysisTaskStateMap.Add(TEXT("Canceled"), AnalysisTaskStateCanceled);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, AnalysisTaskState> Map;
+        Map.Add(TEXT("Waiting"), AnalysisTaskStateWaiting);
+        Map.Add(TEXT("ReadyForSubmission"), AnalysisTaskStateReadyForSubmission);
+        Map.Add(TEXT("SubmittingToPipeline"), AnalysisTaskStateSubmittingToPipeline);
+        Map.Add(TEXT("Running"), AnalysisTaskStateRunning);
+        Map.Add(TEXT("Completed"), AnalysisTaskStateCompleted);
+        Map.Add(TEXT("Failed"), AnalysisTaskStateFailed);
+        Map.Add(TEXT("Canceled"), AnalysisTaskStateCanceled);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -103,6 +104,7 @@ bool PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -175,14 +177,14 @@ ExperimentationModels::ExperimentType PlayFab::ExperimentationModels::readExperi
 
 ExperimentationModels::ExperimentType PlayFab::ExperimentationModels::readExperimentTypeFromValue(const FString& value)
 {
-    static TMap<FString, ExperimentType> _ExperimentTypeMap;
-    if (_ExperimentTypeMap.Num() == 0)
+    static const TMap<FString, ExperimentType> _ExperimentTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _ExperimentTypeMap.Add(TEXT("Active"), ExperimentTypeActive);
-        _ExperimentTypeMap.Add(TEXT("Snapshot"), ExperimentTypeSnapshot);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ExperimentType> Map;
+        Map.Add(TEXT("Active"), ExperimentTypeActive);
+        Map.Add(TEXT("Snapshot"), ExperimentTypeSnapshot);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -345,11 +347,7 @@ bool PlayFab::ExperimentationModels::FVariant::readFromValue(const TSharedPtr<FJ
     }
 
     const TArray<TSharedPtr<FJsonValue>>&VariablesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Variables"));
-    for (int32 Idx = 0; Idx < VariablesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VariablesArray[Idx];
-        Variables.Add(FVariable(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VariablesArray, Variables);
 
 
     return HasSucceeded;
@@ -449,6 +447,7 @@ bool PlayFab::ExperimentationModels::FCreateExperimentRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -505,11 +504,7 @@ bool PlayFab::ExperimentationModels::FCreateExperimentRequest::readFromValue(con
     obj->TryGetStringArrayField(TEXT("TitlePlayerAccountTestIds"), TitlePlayerAccountTestIds);
 
     const TArray<TSharedPtr<FJsonValue>>&VariantsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Variants"));
-    for (int32 Idx = 0; Idx < VariantsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VariantsArray[Idx];
-        Variants.Add(FVariant(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VariantsArray, Variants);
 
 
     return HasSucceeded;
@@ -587,6 +582,7 @@ bool PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -643,6 +639,7 @@ bool PlayFab::ExperimentationModels::FDeleteExperimentRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -694,7 +691,7 @@ void PlayFab::ExperimentationModels::FEntityKey::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -788,16 +785,16 @@ ExperimentationModels::ExperimentState PlayFab::ExperimentationModels::readExper
 
 ExperimentationModels::ExperimentState PlayFab::ExperimentationModels::readExperimentStateFromValue(const FString& value)
 {
-    static TMap<FString, ExperimentState> _ExperimentStateMap;
-    if (_ExperimentStateMap.Num() == 0)
+    static const TMap<FString, ExperimentState> _ExperimentStateMap = []()
     {
-        // Auto-generate the map on the first use
-        _ExperimentStateMap.Add(TEXT("New"), ExperimentStateNew);
-        _ExperimentStateMap.Add(TEXT("Started"), ExperimentStateStarted);
-        _ExperimentStateMap.Add(TEXT("Stopped"), ExperimentStateStopped);
-        _ExperimentStateMap.Add(TEXT("Deleted"), ExperimentStateDeleted);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ExperimentState> Map;
+        Map.Add(TEXT("New"), ExperimentStateNew);
+        Map.Add(TEXT("Started"), ExperimentStateStarted);
+        Map.Add(TEXT("Stopped"), ExperimentStateStopped);
+        Map.Add(TEXT("Deleted"), ExperimentStateDeleted);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -959,11 +956,7 @@ bool PlayFab::ExperimentationModels::FExperiment::readFromValue(const TSharedPtr
     obj->TryGetStringArrayField(TEXT("TitlePlayerAccountTestIds"), TitlePlayerAccountTestIds);
 
     const TArray<TSharedPtr<FJsonValue>>&VariantsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Variants"));
-    for (int32 Idx = 0; Idx < VariantsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VariantsArray[Idx];
-        Variants.Add(FVariant(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VariantsArray, Variants);
 
 
     return HasSucceeded;
@@ -1057,6 +1050,7 @@ bool PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1092,11 +1086,7 @@ bool PlayFab::ExperimentationModels::FGetExclusionGroupsResult::readFromValue(co
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ExclusionGroupsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ExclusionGroups"));
-    for (int32 Idx = 0; Idx < ExclusionGroupsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ExclusionGroupsArray[Idx];
-        ExclusionGroups.Add(FExperimentExclusionGroup(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ExclusionGroupsArray, ExclusionGroups);
 
 
     return HasSucceeded;
@@ -1142,6 +1132,7 @@ bool PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::readFromV
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1184,11 +1175,7 @@ bool PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::readFromVa
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&TrafficAllocationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("TrafficAllocations"));
-    for (int32 Idx = 0; Idx < TrafficAllocationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = TrafficAllocationsArray[Idx];
-        TrafficAllocations.Add(FExclusionGroupTrafficAllocation(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(TrafficAllocationsArray, TrafficAllocations);
 
 
     return HasSucceeded;
@@ -1224,6 +1211,7 @@ bool PlayFab::ExperimentationModels::FGetExperimentsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1259,11 +1247,7 @@ bool PlayFab::ExperimentationModels::FGetExperimentsResult::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ExperimentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Experiments"));
-    for (int32 Idx = 0; Idx < ExperimentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ExperimentsArray[Idx];
-        Experiments.Add(FExperiment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ExperimentsArray, Experiments);
 
 
     return HasSucceeded;
@@ -1305,6 +1289,7 @@ bool PlayFab::ExperimentationModels::FGetLatestScorecardRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1531,6 +1516,7 @@ bool PlayFab::ExperimentationModels::FScorecardDataRow::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* MetricDataRowsObject;
     if (obj->TryGetObjectField(TEXT("MetricDataRows"), MetricDataRowsObject))
     {
+        MetricDataRows.Reserve((*MetricDataRowsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetricDataRowsObject)->Values); It; ++It)
         {
             MetricDataRows.Add(It.Key(), FMetricData(It.Value()->AsObject()));
@@ -1660,11 +1646,7 @@ bool PlayFab::ExperimentationModels::FScorecard::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ScorecardDataRowsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ScorecardDataRows"));
-    for (int32 Idx = 0; Idx < ScorecardDataRowsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ScorecardDataRowsArray[Idx];
-        ScorecardDataRows.Add(FScorecardDataRow(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ScorecardDataRowsArray, ScorecardDataRows);
 
 
     return HasSucceeded;
@@ -1739,6 +1721,7 @@ bool PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1789,11 +1772,7 @@ bool PlayFab::ExperimentationModels::FTreatmentAssignment::readFromValue(const T
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&VariablesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Variables"));
-    for (int32 Idx = 0; Idx < VariablesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VariablesArray[Idx];
-        Variables.Add(FVariable(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VariablesArray, Variables);
 
 
     obj->TryGetStringArrayField(TEXT("Variants"), Variants);
@@ -1873,6 +1852,7 @@ bool PlayFab::ExperimentationModels::FStartExperimentRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1929,6 +1909,7 @@ bool PlayFab::ExperimentationModels::FStopExperimentRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2001,6 +1982,7 @@ bool PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2135,6 +2117,7 @@ bool PlayFab::ExperimentationModels::FUpdateExperimentRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2198,13 +2181,11 @@ bool PlayFab::ExperimentationModels::FUpdateExperimentRequest::readFromValue(con
     obj->TryGetStringArrayField(TEXT("TitlePlayerAccountTestIds"), TitlePlayerAccountTestIds);
 
     const TArray<TSharedPtr<FJsonValue>>&VariantsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Variants"));
-    for (int32 Idx = 0; Idx < VariantsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VariantsArray[Idx];
-        Variants.Add(FVariant(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VariantsArray, Variants);
 
 
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_EXPERIMENTATION_API
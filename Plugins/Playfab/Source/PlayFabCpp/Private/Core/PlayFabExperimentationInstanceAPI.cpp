@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_EXPERIMENTATION_API
 #include "Core/PlayFabExperimentationInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabExperimentationInstanceAPI::Ge
     return this->authContext;
 }
 
-bool UPlayFabExperimentationInstanceAPI::CreateExclusionGroup(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::CreateExclusionGroup(
     ExperimentationModels::FCreateExclusionGroupRequest& request,
     const FCreateExclusionGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabExperimentationInstanceAPI::CreateExclusionGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/CreateExclusionGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnCreateExclusionGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnCreateExclusionGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateExclusionGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabExperimentationInstanceAPI::OnCreateExclusionGroupResult(FHttpReque
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::CreateExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::CreateExperiment(
     ExperimentationModels::FCreateExperimentRequest& request,
     const FCreateExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabExperimentationInstanceAPI::CreateExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/CreateExperiment"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnCreateExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnCreateExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabExperimentationInstanceAPI::OnCreateExperimentResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::DeleteExclusionGroup(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::DeleteExclusionGroup(
     ExperimentationModels::FDeleteExclusionGroupRequest& request,
     const FDeleteExclusionGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabExperimentationInstanceAPI::DeleteExclusionGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/DeleteExclusionGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnDeleteExclusionGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnDeleteExclusionGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteExclusionGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabExperimentationInstanceAPI::OnDeleteExclusionGroupResult(FHttpReque
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::DeleteExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::DeleteExperiment(
     ExperimentationModels::FDeleteExperimentRequest& request,
     const FDeleteExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabExperimentationInstanceAPI::DeleteExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/DeleteExperiment"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnDeleteExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnDeleteExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabExperimentationInstanceAPI::OnDeleteExperimentResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::GetExclusionGroups(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::GetExclusionGroups(
     ExperimentationModels::FGetExclusionGroupsRequest& request,
     const FGetExclusionGroupsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabExperimentationInstanceAPI::GetExclusionGroups(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/GetExclusionGroups"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnGetExclusionGroupsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnGetExclusionGroupsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetExclusionGroupsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabExperimentationInstanceAPI::OnGetExclusionGroupsResult(FHttpRequest
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::GetExclusionGroupTraffic(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::GetExclusionGroupTraffic(
     ExperimentationModels::FGetExclusionGroupTrafficRequest& request,
     const FGetExclusionGroupTrafficDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabExperimentationInstanceAPI::GetExclusionGroupTraffic(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/GetExclusionGroupTraffic"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnGetExclusionGroupTrafficResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnGetExclusionGroupTrafficResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetExclusionGroupTrafficDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabExperimentationInstanceAPI::OnGetExclusionGroupTrafficResult(FHttpR
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::GetExperiments(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::GetExperiments(
     ExperimentationModels::FGetExperimentsRequest& request,
     const FGetExperimentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabExperimentationInstanceAPI::GetExperiments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/GetExperiments"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnGetExperimentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnGetExperimentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetExperimentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabExperimentationInstanceAPI::OnGetExperimentsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::GetLatestScorecard(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::GetLatestScorecard(
     ExperimentationModels::FGetLatestScorecardRequest& request,
     const FGetLatestScorecardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabExperimentationInstanceAPI::GetLatestScorecard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/GetLatestScorecard"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnGetLatestScorecardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnGetLatestScorecardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLatestScorecardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabExperimentationInstanceAPI::OnGetLatestScorecardResult(FHttpRequest
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::GetTreatmentAssignment(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::GetTreatmentAssignment(
     ExperimentationModels::FGetTreatmentAssignmentRequest& request,
     const FGetTreatmentAssignmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabExperimentationInstanceAPI::GetTreatmentAssignment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/GetTreatmentAssignment"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnGetTreatmentAssignmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnGetTreatmentAssignmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTreatmentAssignmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -347,7 +348,7 @@ void UPlayFabExperimentationInstanceAPI::OnGetTreatmentAssignmentResult(FHttpReq
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::StartExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::StartExperiment(
     ExperimentationModels::FStartExperimentRequest& request,
     const FStartExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -360,7 +361,7 @@ bool UPlayFabExperimentationInstanceAPI::StartExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/StartExperiment"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnStartExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnStartExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -377,7 +378,7 @@ void UPlayFabExperimentationInstanceAPI::OnStartExperimentResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::StopExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::StopExperiment(
     ExperimentationModels::FStopExperimentRequest& request,
     const FStopExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -390,7 +391,7 @@ bool UPlayFabExperimentationInstanceAPI::StopExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/StopExperiment"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnStopExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnStopExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStopExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -407,7 +408,7 @@ void UPlayFabExperimentationInstanceAPI::OnStopExperimentResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::UpdateExclusionGroup(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::UpdateExclusionGroup(
     ExperimentationModels::FUpdateExclusionGroupRequest& request,
     const FUpdateExclusionGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -420,7 +421,7 @@ bool UPlayFabExperimentationInstanceAPI::UpdateExclusionGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/UpdateExclusionGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnUpdateExclusionGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnUpdateExclusionGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateExclusionGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -437,7 +438,7 @@ void UPlayFabExperimentationInstanceAPI::OnUpdateExclusionGroupResult(FHttpReque
     }
 }
 
-bool UPlayFabExperimentationInstanceAPI::UpdateExperiment(
+FPlayFabRequestHandle UPlayFabExperimentationInstanceAPI::UpdateExperiment(
     ExperimentationModels::FUpdateExperimentRequest& request,
     const FUpdateExperimentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -450,7 +451,7 @@ bool UPlayFabExperimentationInstanceAPI::UpdateExperiment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Experimentation/UpdateExperiment"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationInstanceAPI::OnUpdateExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabExperimentationInstanceAPI::OnUpdateExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -466,3 +467,5 @@ void UPlayFabExperimentationInstanceAPI::OnUpdateExperimentResult(FHttpRequestPt
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_EXPERIMENTATION_API
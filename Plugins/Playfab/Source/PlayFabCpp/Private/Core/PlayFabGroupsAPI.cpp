@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_GROUPS_API
 #include "Core/PlayFabGroupsAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabGroupsAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabGroupsAPI::AcceptGroupApplication(
+FPlayFabRequestHandle UPlayFabGroupsAPI::AcceptGroupApplication(
     GroupsModels::FAcceptGroupApplicationRequest& request,
     const FAcceptGroupApplicationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabGroupsAPI::AcceptGroupApplication(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/AcceptGroupApplication"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnAcceptGroupApplicationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnAcceptGroupApplicationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptGroupApplicationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabGroupsAPI::OnAcceptGroupApplicationResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabGroupsAPI::AcceptGroupInvitation(
+FPlayFabRequestHandle UPlayFabGroupsAPI::AcceptGroupInvitation(
     GroupsModels::FAcceptGroupInvitationRequest& request,
     const FAcceptGroupInvitationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabGroupsAPI::AcceptGroupInvitation(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/AcceptGroupInvitation"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnAcceptGroupInvitationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnAcceptGroupInvitationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptGroupInvitationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabGroupsAPI::OnAcceptGroupInvitationResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabGroupsAPI::AddMembers(
+FPlayFabRequestHandle UPlayFabGroupsAPI::AddMembers(
     GroupsModels::FAddMembersRequest& request,
     const FAddMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabGroupsAPI::AddMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/AddMembers"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnAddMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnAddMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabGroupsAPI::OnAddMembersResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabGroupsAPI::ApplyToGroup(
+FPlayFabRequestHandle UPlayFabGroupsAPI::ApplyToGroup(
     GroupsModels::FApplyToGroupRequest& request,
     const FApplyToGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabGroupsAPI::ApplyToGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ApplyToGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnApplyToGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnApplyToGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FApplyToGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabGroupsAPI::OnApplyToGroupResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabGroupsAPI::BlockEntity(
+FPlayFabRequestHandle UPlayFabGroupsAPI::BlockEntity(
     GroupsModels::FBlockEntityRequest& request,
     const FBlockEntityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabGroupsAPI::BlockEntity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/BlockEntity"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnBlockEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnBlockEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBlockEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabGroupsAPI::OnBlockEntityResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabGroupsAPI::ChangeMemberRole(
+FPlayFabRequestHandle UPlayFabGroupsAPI::ChangeMemberRole(
     GroupsModels::FChangeMemberRoleRequest& request,
     const FChangeMemberRoleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabGroupsAPI::ChangeMemberRole(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ChangeMemberRole"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnChangeMemberRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnChangeMemberRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FChangeMemberRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabGroupsAPI::OnChangeMemberRoleResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabGroupsAPI::CreateGroup(
+FPlayFabRequestHandle UPlayFabGroupsAPI::CreateGroup(
     GroupsModels::FCreateGroupRequest& request,
     const FCreateGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,7 +221,7 @@ bool UPlayFabGroupsAPI::CreateGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/CreateGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnCreateGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnCreateGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -237,7 +238,7 @@ void UPlayFabGroupsAPI::OnCreateGroupResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabGroupsAPI::CreateRole(
+FPlayFabRequestHandle UPlayFabGroupsAPI::CreateRole(
     GroupsModels::FCreateGroupRoleRequest& request,
     const FCreateRoleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -250,7 +251,7 @@ bool UPlayFabGroupsAPI::CreateRole(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/CreateRole"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnCreateRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnCreateRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -267,7 +268,7 @@ void UPlayFabGroupsAPI::OnCreateRoleResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabGroupsAPI::DeleteGroup(
+FPlayFabRequestHandle UPlayFabGroupsAPI::DeleteGroup(
     GroupsModels::FDeleteGroupRequest& request,
     const FDeleteGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -280,7 +281,7 @@ bool UPlayFabGroupsAPI::DeleteGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/DeleteGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnDeleteGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnDeleteGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -297,7 +298,7 @@ void UPlayFabGroupsAPI::OnDeleteGroupResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabGroupsAPI::DeleteRole(
+FPlayFabRequestHandle UPlayFabGroupsAPI::DeleteRole(
     GroupsModels::FDeleteRoleRequest& request,
     const FDeleteRoleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -310,7 +311,7 @@ bool UPlayFabGroupsAPI::DeleteRole(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/DeleteRole"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnDeleteRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnDeleteRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -327,7 +328,7 @@ void UPlayFabGroupsAPI::OnDeleteRoleResult(FHttpRequestPtr HttpRequest, FHttpRes
     }
 }
 
-bool UPlayFabGroupsAPI::GetGroup(
+FPlayFabRequestHandle UPlayFabGroupsAPI::GetGroup(
     GroupsModels::FGetGroupRequest& request,
     const FGetGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -340,7 +341,7 @@ bool UPlayFabGroupsAPI::GetGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/GetGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnGetGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnGetGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -357,7 +358,7 @@ void UPlayFabGroupsAPI::OnGetGroupResult(FHttpRequestPtr HttpRequest, FHttpRespo
     }
 }
 
-bool UPlayFabGroupsAPI::InviteToGroup(
+FPlayFabRequestHandle UPlayFabGroupsAPI::InviteToGroup(
     GroupsModels::FInviteToGroupRequest& request,
     const FInviteToGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -370,7 +371,7 @@ bool UPlayFabGroupsAPI::InviteToGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/InviteToGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnInviteToGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnInviteToGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInviteToGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -387,7 +388,7 @@ void UPlayFabGroupsAPI::OnInviteToGroupResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabGroupsAPI::IsMember(
+FPlayFabRequestHandle UPlayFabGroupsAPI::IsMember(
     GroupsModels::FIsMemberRequest& request,
     const FIsMemberDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -400,7 +401,7 @@ bool UPlayFabGroupsAPI::IsMember(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/IsMember"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnIsMemberResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnIsMemberResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIsMemberDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -417,7 +418,7 @@ void UPlayFabGroupsAPI::OnIsMemberResult(FHttpRequestPtr HttpRequest, FHttpRespo
     }
 }
 
-bool UPlayFabGroupsAPI::ListGroupApplications(
+FPlayFabRequestHandle UPlayFabGroupsAPI::ListGroupApplications(
     GroupsModels::FListGroupApplicationsRequest& request,
     const FListGroupApplicationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -430,7 +431,7 @@ bool UPlayFabGroupsAPI::ListGroupApplications(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupApplications"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListGroupApplicationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnListGroupApplicationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupApplicationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -447,7 +448,7 @@ void UPlayFabGroupsAPI::OnListGroupApplicationsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabGroupsAPI::ListGroupBlocks(
+FPlayFabRequestHandle UPlayFabGroupsAPI::ListGroupBlocks(
     GroupsModels::FListGroupBlocksRequest& request,
     const FListGroupBlocksDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -460,7 +461,7 @@ bool UPlayFabGroupsAPI::ListGroupBlocks(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupBlocks"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListGroupBlocksResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnListGroupBlocksResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupBlocksDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -477,7 +478,7 @@ void UPlayFabGroupsAPI::OnListGroupBlocksResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabGroupsAPI::ListGroupInvitations(
+FPlayFabRequestHandle UPlayFabGroupsAPI::ListGroupInvitations(
     GroupsModels::FListGroupInvitationsRequest& request,
     const FListGroupInvitationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -490,7 +491,7 @@ bool UPlayFabGroupsAPI::ListGroupInvitations(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupInvitations"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListGroupInvitationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnListGroupInvitationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupInvitationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -507,7 +508,7 @@ void UPlayFabGroupsAPI::OnListGroupInvitationsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabGroupsAPI::ListGroupMembers(
+FPlayFabRequestHandle UPlayFabGroupsAPI::ListGroupMembers(
     GroupsModels::FListGroupMembersRequest& request,
     const FListGroupMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -520,7 +521,7 @@ bool UPlayFabGroupsAPI::ListGroupMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupMembers"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnListGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -537,7 +538,7 @@ void UPlayFabGroupsAPI::OnListGroupMembersResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabGroupsAPI::ListMembership(
+FPlayFabRequestHandle UPlayFabGroupsAPI::ListMembership(
     GroupsModels::FListMembershipRequest& request,
     const FListMembershipDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -550,7 +551,7 @@ bool UPlayFabGroupsAPI::ListMembership(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListMembership"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListMembershipResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnListMembershipResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMembershipDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -567,7 +568,7 @@ void UPlayFabGroupsAPI::OnListMembershipResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabGroupsAPI::ListMembershipOpportunities(
+FPlayFabRequestHandle UPlayFabGroupsAPI::ListMembershipOpportunities(
     GroupsModels::FListMembershipOpportunitiesRequest& request,
     const FListMembershipOpportunitiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -580,7 +581,7 @@ bool UPlayFabGroupsAPI::ListMembershipOpportunities(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListMembershipOpportunities"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListMembershipOpportunitiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnListMembershipOpportunitiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMembershipOpportunitiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -597,7 +598,7 @@ void UPlayFabGroupsAPI::OnListMembershipOpportunitiesResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabGroupsAPI::RemoveGroupApplication(
+FPlayFabRequestHandle UPlayFabGroupsAPI::RemoveGroupApplication(
     GroupsModels::FRemoveGroupApplicationRequest& request,
     const FRemoveGroupApplicationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -610,7 +611,7 @@ bool UPlayFabGroupsAPI::RemoveGroupApplication(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/RemoveGroupApplication"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnRemoveGroupApplicationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnRemoveGroupApplicationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGroupApplicationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -627,7 +628,7 @@ void UPlayFabGroupsAPI::OnRemoveGroupApplicationResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabGroupsAPI::RemoveGroupInvitation(
+FPlayFabRequestHandle UPlayFabGroupsAPI::RemoveGroupInvitation(
     GroupsModels::FRemoveGroupInvitationRequest& request,
     const FRemoveGroupInvitationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -640,7 +641,7 @@ bool UPlayFabGroupsAPI::RemoveGroupInvitation(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/RemoveGroupInvitation"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnRemoveGroupInvitationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnRemoveGroupInvitationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGroupInvitationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -657,7 +658,7 @@ void UPlayFabGroupsAPI::OnRemoveGroupInvitationResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabGroupsAPI::RemoveMembers(
+FPlayFabRequestHandle UPlayFabGroupsAPI::RemoveMembers(
     GroupsModels::FRemoveMembersRequest& request,
     const FRemoveMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -670,7 +671,7 @@ bool UPlayFabGroupsAPI::RemoveMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/RemoveMembers"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnRemoveMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnRemoveMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -687,7 +688,7 @@ void UPlayFabGroupsAPI::OnRemoveMembersResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabGroupsAPI::UnblockEntity(
+FPlayFabRequestHandle UPlayFabGroupsAPI::UnblockEntity(
     GroupsModels::FUnblockEntityRequest& request,
     const FUnblockEntityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -700,7 +701,7 @@ bool UPlayFabGroupsAPI::UnblockEntity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/UnblockEntity"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnUnblockEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnUnblockEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnblockEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -717,7 +718,7 @@ void UPlayFabGroupsAPI::OnUnblockEntityResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabGroupsAPI::UpdateGroup(
+FPlayFabRequestHandle UPlayFabGroupsAPI::UpdateGroup(
     GroupsModels::FUpdateGroupRequest& request,
     const FUpdateGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -730,7 +731,7 @@ bool UPlayFabGroupsAPI::UpdateGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/UpdateGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnUpdateGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnUpdateGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -747,7 +748,7 @@ void UPlayFabGroupsAPI::OnUpdateGroupResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabGroupsAPI::UpdateRole(
+FPlayFabRequestHandle UPlayFabGroupsAPI::UpdateRole(
     GroupsModels::FUpdateGroupRoleRequest& request,
     const FUpdateRoleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -760,7 +761,7 @@ bool UPlayFabGroupsAPI::UpdateRole(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/UpdateRole"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnUpdateRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsAPI::OnUpdateRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -776,3 +777,5 @@ void UPlayFabGroupsAPI::OnUpdateRoleResult(FHttpRequestPtr HttpRequest, FHttpRes
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_GROUPS_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_GROUPS_API
 
 #include "Core/PlayFabGroupsDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -27,7 +28,7 @@ void PlayFab::GroupsModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -96,6 +97,7 @@ bool PlayFab::GroupsModels::FAcceptGroupApplicationRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -157,6 +159,7 @@ bool PlayFab::GroupsModels::FAcceptGroupInvitationRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -223,6 +226,7 @@ bool PlayFab::GroupsModels::FAddMembersRequest::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -236,11 +240,7 @@ bool PlayFab::GroupsModels::FAddMembersRequest::readFromValue(const TSharedPtr<F
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     const TSharedPtr<FJsonValue> RoleIdValue = obj->TryGetField(TEXT("RoleId"));
@@ -306,6 +306,7 @@ bool PlayFab::GroupsModels::FApplyToGroupRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -370,6 +371,7 @@ bool PlayFab::GroupsModels::FEntityWithLineage::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* LineageObject;
     if (obj->TryGetObjectField(TEXT("Lineage"), LineageObject))
     {
+        Lineage.Reserve((*LineageObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LineageObject)->Values); It; ++It)
         {
             Lineage.Add(It.Key(), FEntityKey(It.Value()->AsObject()));
@@ -468,6 +470,7 @@ bool PlayFab::GroupsModels::FBlockEntityRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -544,6 +547,7 @@ bool PlayFab::GroupsModels::FChangeMemberRoleRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -564,11 +568,7 @@ bool PlayFab::GroupsModels::FChangeMemberRoleRequest::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     const TSharedPtr<FJsonValue> OriginRoleIdValue = obj->TryGetField(TEXT("OriginRoleId"));
@@ -628,6 +628,7 @@ bool PlayFab::GroupsModels::FCreateGroupRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -746,6 +747,7 @@ bool PlayFab::GroupsModels::FCreateGroupResponse::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* RolesObject;
     if (obj->TryGetObjectField(TEXT("Roles"), RolesObject))
     {
+        Roles.Reserve((*RolesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RolesObject)->Values); It; ++It)
         {
             Roles.Add(It.Key(), It.Value()->AsString());
@@ -808,6 +810,7 @@ bool PlayFab::GroupsModels::FCreateGroupRoleRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -925,6 +928,7 @@ bool PlayFab::GroupsModels::FDeleteGroupRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -979,6 +983,7 @@ bool PlayFab::GroupsModels::FDeleteRoleRequest::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1058,11 +1063,7 @@ bool PlayFab::GroupsModels::FEntityMemberRole::readFromValue(const TSharedPtr<FJ
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityWithLineage(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     const TSharedPtr<FJsonValue> RoleIdValue = obj->TryGetField(TEXT("RoleId"));
@@ -1125,6 +1126,7 @@ bool PlayFab::GroupsModels::FGetGroupRequest::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1243,6 +1245,7 @@ bool PlayFab::GroupsModels::FGetGroupResponse::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonObject>* RolesObject;
     if (obj->TryGetObjectField(TEXT("Roles"), RolesObject))
     {
+        Roles.Reserve((*RolesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RolesObject)->Values); It; ++It)
         {
             Roles.Add(It.Key(), It.Value()->AsString());
@@ -1532,11 +1535,7 @@ bool PlayFab::GroupsModels::FGroupWithRoles::readFromValue(const TSharedPtr<FJso
     }
 
     const TArray<TSharedPtr<FJsonValue>>&RolesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Roles"));
-    for (int32 Idx = 0; Idx < RolesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RolesArray[Idx];
-        Roles.Add(FGroupRole(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RolesArray, Roles);
 
 
     return HasSucceeded;
@@ -1597,6 +1596,7 @@ bool PlayFab::GroupsModels::FInviteToGroupRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1746,6 +1746,7 @@ bool PlayFab::GroupsModels::FIsMemberRequest::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1836,6 +1837,7 @@ bool PlayFab::GroupsModels::FListGroupApplicationsRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1877,11 +1879,7 @@ bool PlayFab::GroupsModels::FListGroupApplicationsResponse::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ApplicationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Applications"));
-    for (int32 Idx = 0; Idx < ApplicationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ApplicationsArray[Idx];
-        Applications.Add(FGroupApplication(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ApplicationsArray, Applications);
 
 
     return HasSucceeded;
@@ -1920,6 +1918,7 @@ bool PlayFab::GroupsModels::FListGroupBlocksRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1961,11 +1960,7 @@ bool PlayFab::GroupsModels::FListGroupBlocksResponse::readFromValue(const TShare
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BlockedEntitiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BlockedEntities"));
-    for (int32 Idx = 0; Idx < BlockedEntitiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BlockedEntitiesArray[Idx];
-        BlockedEntities.Add(FGroupBlock(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BlockedEntitiesArray, BlockedEntities);
 
 
     return HasSucceeded;
@@ -2004,6 +1999,7 @@ bool PlayFab::GroupsModels::FListGroupInvitationsRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2045,11 +2041,7 @@ bool PlayFab::GroupsModels::FListGroupInvitationsResponse::readFromValue(const T
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&InvitationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Invitations"));
-    for (int32 Idx = 0; Idx < InvitationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = InvitationsArray[Idx];
-        Invitations.Add(FGroupInvitation(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(InvitationsArray, Invitations);
 
 
     return HasSucceeded;
@@ -2088,6 +2080,7 @@ bool PlayFab::GroupsModels::FListGroupMembersRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2129,11 +2122,7 @@ bool PlayFab::GroupsModels::FListGroupMembersResponse::readFromValue(const TShar
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityMemberRole(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     return HasSucceeded;
@@ -2176,6 +2165,7 @@ bool PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2226,19 +2216,11 @@ bool PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::readFromValue(
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ApplicationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Applications"));
-    for (int32 Idx = 0; Idx < ApplicationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ApplicationsArray[Idx];
-        Applications.Add(FGroupApplication(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ApplicationsArray, Applications);
 
 
     const TArray<TSharedPtr<FJsonValue>>&InvitationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Invitations"));
-    for (int32 Idx = 0; Idx < InvitationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = InvitationsArray[Idx];
-        Invitations.Add(FGroupInvitation(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(InvitationsArray, Invitations);
 
 
     return HasSucceeded;
@@ -2281,6 +2263,7 @@ bool PlayFab::GroupsModels::FListMembershipRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2322,11 +2305,7 @@ bool PlayFab::GroupsModels::FListMembershipResponse::readFromValue(const TShared
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&GroupsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Groups"));
-    for (int32 Idx = 0; Idx < GroupsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GroupsArray[Idx];
-        Groups.Add(FGroupWithRoles(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GroupsArray, Groups);
 
 
     return HasSucceeded;
@@ -2351,16 +2330,16 @@ GroupsModels::OperationTypes PlayFab::GroupsModels::readOperationTypesFromValue(
 
 GroupsModels::OperationTypes PlayFab::GroupsModels::readOperationTypesFromValue(const FString& value)
 {
-    static TMap<FString, OperationTypes> _OperationTypesMap;
-    if (_OperationTypesMap.Num() == 0)
+    static const TMap<FString, OperationTypes> _OperationTypesMap = []()
     {
-        // Auto-generate the map on the first use
-        _OperationTypesMap.Add(TEXT("Created"), OperationTypesCreated);
-        _OperationTypesMap.Add(TEXT("Updated"), OperationTypesUpdated);
-        _OperationTypesMap.Add(TEXT("Deleted"), OperationTypesDeleted);
-        _OperationTypesMap.Add(TEXT("None"), OperationTypesNone);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, OperationTypes> Map;
+        Map.Add(TEXT("Created"), OperationTypesCreated);
+        Map.Add(TEXT("Updated"), OperationTypesUpdated);
+        Map.Add(TEXT("Deleted"), OperationTypesDeleted);
+        Map.Add(TEXT("None"), OperationTypesNone);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2408,6 +2387,7 @@ bool PlayFab::GroupsModels::FRemoveGroupApplicationRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2465,6 +2445,7 @@ bool PlayFab::GroupsModels::FRemoveGroupInvitationRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2531,6 +2512,7 @@ bool PlayFab::GroupsModels::FRemoveMembersRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2544,11 +2526,7 @@ bool PlayFab::GroupsModels::FRemoveMembersRequest::readFromValue(const TSharedPt
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     const TSharedPtr<FJsonValue> RoleIdValue = obj->TryGetField(TEXT("RoleId"));
@@ -2597,6 +2575,7 @@ bool PlayFab::GroupsModels::FUnblockEntityRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2682,6 +2661,7 @@ bool PlayFab::GroupsModels::FUpdateGroupRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2823,6 +2803,7 @@ bool PlayFab::GroupsModels::FUpdateGroupRoleRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2909,3 +2890,5 @@ bool PlayFab::GroupsModels::FUpdateGroupRoleResponse::readFromValue(const TShare
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_GROUPS_API
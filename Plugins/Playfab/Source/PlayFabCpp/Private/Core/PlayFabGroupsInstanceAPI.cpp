@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_GROUPS_API
 #include "Core/PlayFabGroupsInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabGroupsInstanceAPI::GetOrCreate
     return this->authContext;
 }
 
-bool UPlayFabGroupsInstanceAPI::AcceptGroupApplication(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::AcceptGroupApplication(
     GroupsModels::FAcceptGroupApplicationRequest& request,
     const FAcceptGroupApplicationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabGroupsInstanceAPI::AcceptGroupApplication(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/AcceptGroupApplication"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnAcceptGroupApplicationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnAcceptGroupApplicationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptGroupApplicationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabGroupsInstanceAPI::OnAcceptGroupApplicationResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::AcceptGroupInvitation(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::AcceptGroupInvitation(
     GroupsModels::FAcceptGroupInvitationRequest& request,
     const FAcceptGroupInvitationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabGroupsInstanceAPI::AcceptGroupInvitation(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/AcceptGroupInvitation"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnAcceptGroupInvitationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnAcceptGroupInvitationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptGroupInvitationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabGroupsInstanceAPI::OnAcceptGroupInvitationResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::AddMembers(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::AddMembers(
     GroupsModels::FAddMembersRequest& request,
     const FAddMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabGroupsInstanceAPI::AddMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/AddMembers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnAddMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnAddMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabGroupsInstanceAPI::OnAddMembersResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::ApplyToGroup(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::ApplyToGroup(
     GroupsModels::FApplyToGroupRequest& request,
     const FApplyToGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabGroupsInstanceAPI::ApplyToGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ApplyToGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnApplyToGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnApplyToGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FApplyToGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabGroupsInstanceAPI::OnApplyToGroupResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::BlockEntity(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::BlockEntity(
     GroupsModels::FBlockEntityRequest& request,
     const FBlockEntityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabGroupsInstanceAPI::BlockEntity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/BlockEntity"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnBlockEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnBlockEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBlockEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabGroupsInstanceAPI::OnBlockEntityResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::ChangeMemberRole(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::ChangeMemberRole(
     GroupsModels::FChangeMemberRoleRequest& request,
     const FChangeMemberRoleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabGroupsInstanceAPI::ChangeMemberRole(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ChangeMemberRole"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnChangeMemberRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnChangeMemberRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FChangeMemberRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabGroupsInstanceAPI::OnChangeMemberRoleResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::CreateGroup(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::CreateGroup(
     GroupsModels::FCreateGroupRequest& request,
     const FCreateGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabGroupsInstanceAPI::CreateGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/CreateGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnCreateGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnCreateGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabGroupsInstanceAPI::OnCreateGroupResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::CreateRole(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::CreateRole(
     GroupsModels::FCreateGroupRoleRequest& request,
     const FCreateRoleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabGroupsInstanceAPI::CreateRole(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/CreateRole"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnCreateRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnCreateRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabGroupsInstanceAPI::OnCreateRoleResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::DeleteGroup(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::DeleteGroup(
     GroupsModels::FDeleteGroupRequest& request,
     const FDeleteGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabGroupsInstanceAPI::DeleteGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/DeleteGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnDeleteGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnDeleteGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -347,7 +348,7 @@ void UPlayFabGroupsInstanceAPI::OnDeleteGroupResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::DeleteRole(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::DeleteRole(
     GroupsModels::FDeleteRoleRequest& request,
     const FDeleteRoleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -360,7 +361,7 @@ bool UPlayFabGroupsInstanceAPI::DeleteRole(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/DeleteRole"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnDeleteRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnDeleteRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -377,7 +378,7 @@ void UPlayFabGroupsInstanceAPI::OnDeleteRoleResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::GetGroup(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::GetGroup(
     GroupsModels::FGetGroupRequest& request,
     const FGetGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -390,7 +391,7 @@ bool UPlayFabGroupsInstanceAPI::GetGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/GetGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnGetGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnGetGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -407,7 +408,7 @@ void UPlayFabGroupsInstanceAPI::OnGetGroupResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::InviteToGroup(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::InviteToGroup(
     GroupsModels::FInviteToGroupRequest& request,
     const FInviteToGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -420,7 +421,7 @@ bool UPlayFabGroupsInstanceAPI::InviteToGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/InviteToGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnInviteToGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnInviteToGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInviteToGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -437,7 +438,7 @@ void UPlayFabGroupsInstanceAPI::OnInviteToGroupResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::IsMember(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::IsMember(
     GroupsModels::FIsMemberRequest& request,
     const FIsMemberDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -450,7 +451,7 @@ bool UPlayFabGroupsInstanceAPI::IsMember(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/IsMember"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnIsMemberResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnIsMemberResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIsMemberDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -467,7 +468,7 @@ void UPlayFabGroupsInstanceAPI::OnIsMemberResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::ListGroupApplications(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::ListGroupApplications(
     GroupsModels::FListGroupApplicationsRequest& request,
     const FListGroupApplicationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -480,7 +481,7 @@ bool UPlayFabGroupsInstanceAPI::ListGroupApplications(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupApplications"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListGroupApplicationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnListGroupApplicationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupApplicationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -497,7 +498,7 @@ void UPlayFabGroupsInstanceAPI::OnListGroupApplicationsResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::ListGroupBlocks(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::ListGroupBlocks(
     GroupsModels::FListGroupBlocksRequest& request,
     const FListGroupBlocksDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -510,7 +511,7 @@ bool UPlayFabGroupsInstanceAPI::ListGroupBlocks(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupBlocks"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListGroupBlocksResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnListGroupBlocksResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupBlocksDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -527,7 +528,7 @@ void UPlayFabGroupsInstanceAPI::OnListGroupBlocksResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::ListGroupInvitations(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::ListGroupInvitations(
     GroupsModels::FListGroupInvitationsRequest& request,
     const FListGroupInvitationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -540,7 +541,7 @@ bool UPlayFabGroupsInstanceAPI::ListGroupInvitations(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupInvitations"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListGroupInvitationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnListGroupInvitationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupInvitationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -557,7 +558,7 @@ void UPlayFabGroupsInstanceAPI::OnListGroupInvitationsResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::ListGroupMembers(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::ListGroupMembers(
     GroupsModels::FListGroupMembersRequest& request,
     const FListGroupMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -570,7 +571,7 @@ bool UPlayFabGroupsInstanceAPI::ListGroupMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupMembers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnListGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -587,7 +588,7 @@ void UPlayFabGroupsInstanceAPI::OnListGroupMembersResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::ListMembership(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::ListMembership(
     GroupsModels::FListMembershipRequest& request,
     const FListMembershipDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -600,7 +601,7 @@ bool UPlayFabGroupsInstanceAPI::ListMembership(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListMembership"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListMembershipResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnListMembershipResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMembershipDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -617,7 +618,7 @@ void UPlayFabGroupsInstanceAPI::OnListMembershipResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::ListMembershipOpportunities(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::ListMembershipOpportunities(
     GroupsModels::FListMembershipOpportunitiesRequest& request,
     const FListMembershipOpportunitiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -630,7 +631,7 @@ bool UPlayFabGroupsInstanceAPI::ListMembershipOpportunities(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListMembershipOpportunities"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListMembershipOpportunitiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnListMembershipOpportunitiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMembershipOpportunitiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -647,7 +648,7 @@ void UPlayFabGroupsInstanceAPI::OnListMembershipOpportunitiesResult(FHttpRequest
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::RemoveGroupApplication(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::RemoveGroupApplication(
     GroupsModels::FRemoveGroupApplicationRequest& request,
     const FRemoveGroupApplicationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -660,7 +661,7 @@ bool UPlayFabGroupsInstanceAPI::RemoveGroupApplication(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/RemoveGroupApplication"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnRemoveGroupApplicationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnRemoveGroupApplicationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGroupApplicationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -677,7 +678,7 @@ void UPlayFabGroupsInstanceAPI::OnRemoveGroupApplicationResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::RemoveGroupInvitation(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::RemoveGroupInvitation(
     GroupsModels::FRemoveGroupInvitationRequest& request,
     const FRemoveGroupInvitationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -690,7 +691,7 @@ bool UPlayFabGroupsInstanceAPI::RemoveGroupInvitation(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/RemoveGroupInvitation"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnRemoveGroupInvitationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnRemoveGroupInvitationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGroupInvitationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -707,7 +708,7 @@ void UPlayFabGroupsInstanceAPI::OnRemoveGroupInvitationResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::RemoveMembers(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::RemoveMembers(
     GroupsModels::FRemoveMembersRequest& request,
     const FRemoveMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -720,7 +721,7 @@ bool UPlayFabGroupsInstanceAPI::RemoveMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/RemoveMembers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnRemoveMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnRemoveMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -737,7 +738,7 @@ void UPlayFabGroupsInstanceAPI::OnRemoveMembersResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::UnblockEntity(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::UnblockEntity(
     GroupsModels::FUnblockEntityRequest& request,
     const FUnblockEntityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -750,7 +751,7 @@ bool UPlayFabGroupsInstanceAPI::UnblockEntity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/UnblockEntity"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnUnblockEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnUnblockEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnblockEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -767,7 +768,7 @@ void UPlayFabGroupsInstanceAPI::OnUnblockEntityResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::UpdateGroup(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::UpdateGroup(
     GroupsModels::FUpdateGroupRequest& request,
     const FUpdateGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -780,7 +781,7 @@ bool UPlayFabGroupsInstanceAPI::UpdateGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/UpdateGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnUpdateGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnUpdateGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -797,7 +798,7 @@ void UPlayFabGroupsInstanceAPI::OnUpdateGroupResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabGroupsInstanceAPI::UpdateRole(
+FPlayFabRequestHandle UPlayFabGroupsInstanceAPI::UpdateRole(
     GroupsModels::FUpdateGroupRoleRequest& request,
     const FUpdateRoleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -810,7 +811,7 @@ bool UPlayFabGroupsInstanceAPI::UpdateRole(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/UpdateRole"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnUpdateRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabGroupsInstanceAPI::OnUpdateRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -826,3 +827,5 @@ void UPlayFabGroupsInstanceAPI::OnUpdateRoleResult(FHttpRequestPtr HttpRequest,
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_GROUPS_API
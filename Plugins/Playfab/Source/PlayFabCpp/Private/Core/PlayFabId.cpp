@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabId.h"
+#include "Misc/ScopeRWLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    constexpr int32 HexIdLength = 16;
+
+    // The default FString key funcs ignore case, ids that only differ in case are different ids
+    struct FCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, uint32, false>
+    {
+        static bool Matches(const FString& A, const FString& B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static uint32 GetKeyHash(const FString& Key)
+        {
+            return FCrc::StrCrc32(*Key);
+        }
+    };
+
+    // Ids that are not in the packed form, split into shards by hash so decoding threads interning different ids rarely share a lock.
+    // An interned id packs the shard generation, the shard and the index in the shard. ResetInternTable empties every shard and bumps
+    // its generation, so ids from before the reset never match an index handed out after it.
+    constexpr int32 NumInternShards = 16;
+    constexpr int32 InternShardShift = 32;
+    constexpr int32 InternGenerationShift = 40;
+
+    struct FPlayFabIdInternShard
+    {
+        FRWLock Lock;
+        TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> Indices;
+        TArray<FString> Strings;
+        uint16 Generation = 0;
+    };
+
+    struct FPlayFabIdInternTable
+    {
+        FPlayFabIdInternShard Shards[NumInternShards];
+
+        static FPlayFabIdInternTable& Get()
+        {
+            static FPlayFabIdInternTable Table;
+            return Table;
+        }
+    };
+
+    uint64 PackInterned(const FPlayFabIdInternShard& Shard, int32 ShardIdx, uint32 Index)
+    {
+        return ((uint64)Shard.Generation << InternGenerationShift) | ((uint64)ShardIdx << InternShardShift) | Index;
+    }
+
+    int32 HexDigitValue(TCHAR Char)
+    {
+        if (Char >= TEXT('0') && Char <= TEXT('9'))
+        {
+            return Char - TEXT('0');
+        }
+        if (Char >= TEXT('A') && Char <= TEXT('F'))
+        {
+            return Char - TEXT('A') + 10;
+        }
+        return -1; // Lower case hex is interned as text (case-sensitive), so ToString gives back the same text
+    }
+}
+
+FPlayFabId::FPlayFabId(const FString& Id)
+    : Value(0), Kind(EKind::Empty)
+{
+    if (Id.IsEmpty())
+    {
+        return;
+    }
+
+    if (Id.Len() == HexIdLength)
+    {
+        uint64 Packed = 0;
+        int32 Idx = 0;
+        for (; Idx < HexIdLength; ++Idx)
+        {
+            const int32 Digit = HexDigitValue(Id[Idx]);
+            if (Digit < 0)
+            {
+                break;
+            }
+            Packed = (Packed << 4) | (uint64)Digit;
+        }
+        if (Idx == HexIdLength)
+        {
+            Value = Packed;
+            Kind = EKind::Hex;
+            return;
+        }
+    }
+
+    // The high bits pick the shard, the low bits stay spread out for the buckets of the shard's map
+    const uint32 Hash = FCaseSensitiveKeyFuncs::GetKeyHash(Id);
+    const int32 ShardIdx = (int32)(Hash >> 28) % NumInternShards;
+    FPlayFabIdInternShard& Shard = FPlayFabIdInternTable::Get().Shards[ShardIdx];
+    Kind = EKind::Interned;
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        if (const uint32* Index = Shard.Indices.FindByHash(Hash, Id))
+        {
+            Value = PackInterned(Shard, ShardIdx, *Index);
+            return;
+        }
+    }
+
+    FWriteScopeLock WriteLock(Shard.Lock);
+    // Another thread may have added it between the two locks
+    uint32 Index = (uint32)Shard.Strings.Num();
+    if (const uint32* Existing = Shard.Indices.FindByHash(Hash, Id))
+    {
+        Index = *Existing;
+    }
+    else
+    {
+        Shard.Indices.AddByHash(Hash, Id, Index);
+        Shard.Strings.Add(Id);
+    }
+    Value = PackInterned(Shard, ShardIdx, Index);
+}
+
+void FPlayFabId::ResetInternTable()
+{
+    for (FPlayFabIdInternShard& Shard : FPlayFabIdInternTable::Get().Shards)
+    {
+        FWriteScopeLock WriteLock(Shard.Lock);
+        Shard.Indices.Empty();
+        Shard.Strings.Empty();
+        Shard.Generation += 1;
+    }
+}
+
+int32 FPlayFabId::GetInternedCount()
+{
+    int32 Count = 0;
+    for (FPlayFabIdInternShard& Shard : FPlayFabIdInternTable::Get().Shards)
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        Count += Shard.Strings.Num();
+    }
+    return Count;
+}
+
+FString FPlayFabId::ToString() const
+{
+    switch (Kind)
+    {
+    case EKind::Hex:
+    {
+        static const TCHAR Digits[] = TEXT("0123456789ABCDEF");
+        TCHAR Text[HexIdLength + 1];
+        for (int32 Idx = 0; Idx < HexIdLength; ++Idx)
+        {
+            Text[Idx] = Digits[(Value >> ((HexIdLength - 1 - Idx) * 4)) & 0xF];
+        }
+        Text[HexIdLength] = TEXT('\0');
+        return FString(Text);
+    }
+    case EKind::Interned:
+    {
+        FPlayFabIdInternShard& Shard = FPlayFabIdInternTable::Get().Shards[(Value >> InternShardShift) & 0xFF];
+        FReadScopeLock ReadLock(Shard.Lock);
+        if ((uint16)(Value >> InternGenerationShift) != Shard.Generation)
+        {
+            return FString(); // Interned before the last ResetInternTable
+        }
+        return Shard.Strings[(int32)(uint32)Value];
+    }
+    default:
+        return FString();
+    }
+}
@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+// Automation test PlayFab.Core.PlayFabId, run with: Automation RunTests PlayFab.Core
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Core/PlayFabId.h"
+
+using namespace PlayFab;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlayFabIdTest, "PlayFab.Core.PlayFabId", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FPlayFabIdTest::RunTest(const FString& Parameters)
+{
+    // Interned ids that only differ in case stay distinct, and each gives back its own text
+    const FPlayFabId Lower(TEXT("abc"));
+    const FPlayFabId Upper(TEXT("ABC"));
+    TestTrue(TEXT("abc and ABC are different ids"), Lower != Upper);
+    TestEqual(TEXT("abc round-trips"), Lower.ToString(), FString(TEXT("abc")));
+    TestEqual(TEXT("ABC round-trips"), Upper.ToString(), FString(TEXT("ABC")));
+    TestTrue(TEXT("abc interns to the same id twice"), FPlayFabId(TEXT("abc")) == Lower);
+    TestNotEqual(TEXT("abc and ABC hash differently"), GetTypeHash(Lower), GetTypeHash(Upper));
+
+    // Packed hex ids: lower case hex is not packed, so it must not match the upper case form either
+    const FPlayFabId Hex(TEXT("0123456789ABCDEF"));
+    const FPlayFabId LowerHex(TEXT("0123456789abcdef"));
+    TestTrue(TEXT("upper and lower case hex are different ids"), Hex != LowerHex);
+    TestEqual(TEXT("hex round-trips"), Hex.ToString(), FString(TEXT("0123456789ABCDEF")));
+    TestEqual(TEXT("lower case hex round-trips"), LowerHex.ToString(), FString(TEXT("0123456789abcdef")));
+
+    TestTrue(TEXT("empty text is the empty id"), FPlayFabId(FString()).IsEmpty());
+
+    // After a reset the table is empty, and ids from before never match the ids handed out after it
+    FPlayFabId::ResetInternTable();
+    TestEqual(TEXT("the reset empties the table"), FPlayFabId::GetInternedCount(), 0);
+    TestEqual(TEXT("an id from before the reset has no text"), Lower.ToString(), FString());
+    TestTrue(TEXT("an id from before the reset still equals its copies"), Lower == FPlayFabId(Lower));
+    const FPlayFabId Other(TEXT("xyz"));
+    TestTrue(TEXT("the first id after the reset differs from the first one before it"), Other != Lower);
+    TestTrue(TEXT("the same text after the reset is a new id"), FPlayFabId(TEXT("abc")) != Lower);
+    TestEqual(TEXT("ids after the reset round-trip"), Other.ToString(), FString(TEXT("xyz")));
+    TestEqual(TEXT("hex ids are not affected by the reset"), Hex.ToString(), FString(TEXT("0123456789ABCDEF")));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_INSIGHTS_API
 #include "Core/PlayFabInsightsAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabInsightsAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabInsightsAPI::GetDetails(
+FPlayFabRequestHandle UPlayFabInsightsAPI::GetDetails(
     InsightsModels::FInsightsEmptyRequest& request,
     const FGetDetailsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabInsightsAPI::GetDetails(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetDetails"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnGetDetailsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsAPI::OnGetDetailsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDetailsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabInsightsAPI::OnGetDetailsResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabInsightsAPI::GetLimits(
+FPlayFabRequestHandle UPlayFabInsightsAPI::GetLimits(
     InsightsModels::FInsightsEmptyRequest& request,
     const FGetLimitsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabInsightsAPI::GetLimits(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetLimits"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnGetLimitsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsAPI::OnGetLimitsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLimitsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabInsightsAPI::OnGetLimitsResult(FHttpRequestPtr HttpRequest, FHttpRe
     }
 }
 
-bool UPlayFabInsightsAPI::GetOperationStatus(
+FPlayFabRequestHandle UPlayFabInsightsAPI::GetOperationStatus(
     InsightsModels::FInsightsGetOperationStatusRequest& request,
     const FGetOperationStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabInsightsAPI::GetOperationStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetOperationStatus"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnGetOperationStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsAPI::OnGetOperationStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetOperationStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabInsightsAPI::OnGetOperationStatusResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabInsightsAPI::GetPendingOperations(
+FPlayFabRequestHandle UPlayFabInsightsAPI::GetPendingOperations(
     InsightsModels::FInsightsGetPendingOperationsRequest& request,
     const FGetPendingOperationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabInsightsAPI::GetPendingOperations(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetPendingOperations"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnGetPendingOperationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsAPI::OnGetPendingOperationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPendingOperationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabInsightsAPI::OnGetPendingOperationsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabInsightsAPI::SetPerformance(
+FPlayFabRequestHandle UPlayFabInsightsAPI::SetPerformance(
     InsightsModels::FInsightsSetPerformanceRequest& request,
     const FSetPerformanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabInsightsAPI::SetPerformance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/SetPerformance"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnSetPerformanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsAPI::OnSetPerformanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPerformanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabInsightsAPI::OnSetPerformanceResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabInsightsAPI::SetStorageRetention(
+FPlayFabRequestHandle UPlayFabInsightsAPI::SetStorageRetention(
     InsightsModels::FInsightsSetStorageRetentionRequest& request,
     const FSetStorageRetentionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabInsightsAPI::SetStorageRetention(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/SetStorageRetention"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnSetStorageRetentionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsAPI::OnSetStorageRetentionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetStorageRetentionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -206,3 +207,5 @@ void UPlayFabInsightsAPI::OnSetStorageRetentionResult(FHttpRequestPtr HttpReques
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_INSIGHTS_API
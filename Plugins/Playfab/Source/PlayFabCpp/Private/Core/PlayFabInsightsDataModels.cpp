@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_INSIGHTS_API
 
 #include "Core/PlayFabInsightsDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -41,6 +42,7 @@ bool PlayFab::InsightsModels::FInsightsEmptyRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -215,11 +217,7 @@ bool PlayFab::InsightsModels::FInsightsGetLimitsResponse::readFromValue(const TS
     }
 
     const TArray<TSharedPtr<FJsonValue>>&SubMetersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("SubMeters"));
-    for (int32 Idx = 0; Idx < SubMetersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SubMetersArray[Idx];
-        SubMeters.Add(FInsightsPerformanceLevel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SubMetersArray, SubMeters);
 
 
     return HasSucceeded;
@@ -398,11 +396,7 @@ bool PlayFab::InsightsModels::FInsightsGetDetailsResponse::readFromValue(const T
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PendingOperationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PendingOperations"));
-    for (int32 Idx = 0; Idx < PendingOperationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PendingOperationsArray[Idx];
-        PendingOperations.Add(FInsightsGetOperationStatusResponse(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PendingOperationsArray, PendingOperations);
 
 
     const TSharedPtr<FJsonValue> PerformanceLevelValue = obj->TryGetField(TEXT("PerformanceLevel"));
@@ -458,6 +452,7 @@ bool PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -510,6 +505,7 @@ bool PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -552,11 +548,7 @@ bool PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::readFromVal
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&PendingOperationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PendingOperations"));
-    for (int32 Idx = 0; Idx < PendingOperationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PendingOperationsArray[Idx];
-        PendingOperations.Add(FInsightsGetOperationStatusResponse(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PendingOperationsArray, PendingOperations);
 
 
     return HasSucceeded;
@@ -653,6 +645,7 @@ bool PlayFab::InsightsModels::FInsightsSetPerformanceRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -702,6 +695,7 @@ bool PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -718,3 +712,5 @@ bool PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::readFromValue
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_INSIGHTS_API
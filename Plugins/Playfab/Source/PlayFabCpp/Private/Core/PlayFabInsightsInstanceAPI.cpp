@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_INSIGHTS_API
 #include "Core/PlayFabInsightsInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabInsightsInstanceAPI::GetOrCrea
     return this->authContext;
 }
 
-bool UPlayFabInsightsInstanceAPI::GetDetails(
+FPlayFabRequestHandle UPlayFabInsightsInstanceAPI::GetDetails(
     InsightsModels::FInsightsEmptyRequest& request,
     const FGetDetailsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabInsightsInstanceAPI::GetDetails(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetDetails"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnGetDetailsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsInstanceAPI::OnGetDetailsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDetailsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabInsightsInstanceAPI::OnGetDetailsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabInsightsInstanceAPI::GetLimits(
+FPlayFabRequestHandle UPlayFabInsightsInstanceAPI::GetLimits(
     InsightsModels::FInsightsEmptyRequest& request,
     const FGetLimitsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabInsightsInstanceAPI::GetLimits(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetLimits"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnGetLimitsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsInstanceAPI::OnGetLimitsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLimitsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabInsightsInstanceAPI::OnGetLimitsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabInsightsInstanceAPI::GetOperationStatus(
+FPlayFabRequestHandle UPlayFabInsightsInstanceAPI::GetOperationStatus(
     InsightsModels::FInsightsGetOperationStatusRequest& request,
     const FGetOperationStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabInsightsInstanceAPI::GetOperationStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetOperationStatus"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnGetOperationStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsInstanceAPI::OnGetOperationStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetOperationStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabInsightsInstanceAPI::OnGetOperationStatusResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabInsightsInstanceAPI::GetPendingOperations(
+FPlayFabRequestHandle UPlayFabInsightsInstanceAPI::GetPendingOperations(
     InsightsModels::FInsightsGetPendingOperationsRequest& request,
     const FGetPendingOperationsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabInsightsInstanceAPI::GetPendingOperations(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetPendingOperations"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnGetPendingOperationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsInstanceAPI::OnGetPendingOperationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPendingOperationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabInsightsInstanceAPI::OnGetPendingOperationsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabInsightsInstanceAPI::SetPerformance(
+FPlayFabRequestHandle UPlayFabInsightsInstanceAPI::SetPerformance(
     InsightsModels::FInsightsSetPerformanceRequest& request,
     const FSetPerformanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabInsightsInstanceAPI::SetPerformance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/SetPerformance"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnSetPerformanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsInstanceAPI::OnSetPerformanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPerformanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabInsightsInstanceAPI::OnSetPerformanceResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabInsightsInstanceAPI::SetStorageRetention(
+FPlayFabRequestHandle UPlayFabInsightsInstanceAPI::SetStorageRetention(
     InsightsModels::FInsightsSetStorageRetentionRequest& request,
     const FSetStorageRetentionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabInsightsInstanceAPI::SetStorageRetention(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/SetStorageRetention"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnSetStorageRetentionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabInsightsInstanceAPI::OnSetStorageRetentionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetStorageRetentionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -256,3 +257,5 @@ void UPlayFabInsightsInstanceAPI::OnSetStorageRetentionResult(FHttpRequestPtr Ht
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_INSIGHTS_API
@@ -0,0 +1,498 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#if WITH_PLAYFAB_ECONOMY_API
+#include "Core/PlayFabInventoryMirror.h"
+
+using namespace PlayFab;
+using namespace PlayFab::EconomyModels;
+
+namespace
+{
+    const TCHAR* DefaultId = TEXT("default");
+
+    // Item references by alternate id cannot be resolved locally
+    bool IsLocalReference(const TSharedPtr<FInventoryItemReference>& Item)
+    {
+        return Item.IsValid() && !Item->Id.IsEmpty();
+    }
+
+    bool IsConflict(const FPlayFabCppError& error)
+    {
+        return error.HttpCode == 409 || error.HttpCode == 412 || error.ErrorCode == PlayFabErrorConcurrentEditError;
+    }
+
+    void AddDuration(FInventoryItem& Item, const Boxed<double>& DurationInSeconds)
+    {
+        if (DurationInSeconds.notNull())
+        {
+            const FDateTime From = Item.ExpirationDate.notNull() ? Item.ExpirationDate.mValue : FDateTime::UtcNow();
+            Item.ExpirationDate = From + FTimespan::FromSeconds(DurationInSeconds);
+        }
+    }
+
+    template <typename OperationType>
+    TArray<FInventoryOperation> MakeOperations(TSharedPtr<OperationType> FInventoryOperation::* Member, const TSharedPtr<OperationType>& Operation)
+    {
+        TArray<FInventoryOperation> Operations;
+        Operations.AddDefaulted_GetRef().*Member = Operation;
+        return Operations;
+    }
+}
+
+PlayFabInventoryMirror::PlayFabInventoryMirror(PlayFabEconomyPtr InEconomyAPI)
+    : EconomyAPI(InEconomyAPI)
+{
+}
+
+FPlayFabRequestHandle PlayFabInventoryMirror::Refresh(const FString& CollectionId, const FCollectionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    const FString Id = NormalizeCollectionId(CollectionId);
+    Collections.FindOrAdd(Id).bRefreshing = true;
+    return RequestPage(Id, FString(), MakeShared<TArray<FInventoryItem> >(), SuccessDelegate, ErrorDelegate);
+}
+
+bool PlayFabInventoryMirror::IsMirrored(const FString& CollectionId) const
+{
+    const FCollection* Collection = Collections.Find(NormalizeCollectionId(CollectionId));
+    return Collection != nullptr && Collection->bLoaded;
+}
+
+void PlayFabInventoryMirror::Forget(const FString& CollectionId)
+{
+    Collections.Remove(NormalizeCollectionId(CollectionId));
+}
+
+FPlayFabRequestHandle PlayFabInventoryMirror::AddInventoryItems(FAddInventoryItemsRequest& request, const UPlayFabEconomyAPI::FAddInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    TSharedPtr<FAddInventoryItemsOperation> Operation = MakeShareable(new FAddInventoryItemsOperation());
+    Operation->Amount = request.Amount;
+    Operation->DurationInSeconds = request.DurationInSeconds;
+    Operation->Item = request.Item;
+    Operation->NewStackValues = request.NewStackValues;
+    return Write<FAddInventoryItemsResponse>(request, MakeOperations(&FInventoryOperation::Add, Operation), &UPlayFabEconomyAPI::AddInventoryItems, SuccessDelegate, ErrorDelegate);
+}
+
+FPlayFabRequestHandle PlayFabInventoryMirror::SubtractInventoryItems(FSubtractInventoryItemsRequest& request, const UPlayFabEconomyAPI::FSubtractInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    TSharedPtr<FSubtractInventoryItemsOperation> Operation = MakeShareable(new FSubtractInventoryItemsOperation());
+    Operation->Amount = request.Amount;
+    Operation->DeleteEmptyStacks = request.DeleteEmptyStacks;
+    Operation->DurationInSeconds = request.DurationInSeconds;
+    Operation->Item = request.Item;
+    return Write<FSubtractInventoryItemsResponse>(request, MakeOperations(&FInventoryOperation::Subtract, Operation), &UPlayFabEconomyAPI::SubtractInventoryItems, SuccessDelegate, ErrorDelegate);
+}
+
+FPlayFabRequestHandle PlayFabInventoryMirror::UpdateInventoryItems(FUpdateInventoryItemsRequest& request, const UPlayFabEconomyAPI::FUpdateInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    TSharedPtr<FUpdateInventoryItemsOperation> Operation = MakeShareable(new FUpdateInventoryItemsOperation());
+    Operation->Item = request.Item;
+    return Write<FUpdateInventoryItemsResponse>(request, MakeOperations(&FInventoryOperation::Update, Operation), &UPlayFabEconomyAPI::UpdateInventoryItems, SuccessDelegate, ErrorDelegate);
+}
+
+FPlayFabRequestHandle PlayFabInventoryMirror::DeleteInventoryItems(FDeleteInventoryItemsRequest& request, const UPlayFabEconomyAPI::FDeleteInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    TSharedPtr<FDeleteInventoryItemsOperation> Operation = MakeShareable(new FDeleteInventoryItemsOperation());
+    Operation->Item = request.Item;
+    return Write<FDeleteInventoryItemsResponse>(request, MakeOperations(&FInventoryOperation::Delete, Operation), &UPlayFabEconomyAPI::DeleteInventoryItems, SuccessDelegate, ErrorDelegate);
+}
+
+FPlayFabRequestHandle PlayFabInventoryMirror::PurchaseInventoryItems(FPurchaseInventoryItemsRequest& request, const UPlayFabEconomyAPI::FPurchaseInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    TSharedPtr<FPurchaseInventoryItemsOperation> Operation = MakeShareable(new FPurchaseInventoryItemsOperation());
+    Operation->Amount = request.Amount;
+    Operation->DeleteEmptyStacks = request.DeleteEmptyStacks;
+    Operation->DurationInSeconds = request.DurationInSeconds;
+    Operation->Item = request.Item;
+    Operation->NewStackValues = request.NewStackValues;
+    Operation->PriceAmounts = request.PriceAmounts;
+    Operation->StoreId = request.StoreId;
+    return Write<FPurchaseInventoryItemsResponse>(request, MakeOperations(&FInventoryOperation::Purchase, Operation), &UPlayFabEconomyAPI::PurchaseInventoryItems, SuccessDelegate, ErrorDelegate);
+}
+
+FPlayFabRequestHandle PlayFabInventoryMirror::ExecuteInventoryOperations(FExecuteInventoryOperationsRequest& request, const UPlayFabEconomyAPI::FExecuteInventoryOperationsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    return Write<FExecuteInventoryOperationsResponse>(request, request.Operations, &UPlayFabEconomyAPI::ExecuteInventoryOperations, SuccessDelegate, ErrorDelegate);
+}
+
+const FInventoryItem* PlayFabInventoryMirror::FindItem(const FString& CollectionId, const FString& ItemId, const FString& StackId) const
+{
+    const FCollection* Collection = Collections.Find(NormalizeCollectionId(CollectionId));
+    const TMap<FString, FInventoryItem>* Stacks = Collection != nullptr ? Collection->Items.Find(ItemId) : nullptr;
+    return Stacks != nullptr ? Stacks->Find(NormalizeStackId(StackId)) : nullptr;
+}
+
+TArray<const FInventoryItem*> PlayFabInventoryMirror::FindStacks(const FString& CollectionId, const FString& ItemId) const
+{
+    TArray<const FInventoryItem*> Result;
+    const FCollection* Collection = Collections.Find(NormalizeCollectionId(CollectionId));
+    if (const TMap<FString, FInventoryItem>* Stacks = Collection != nullptr ? Collection->Items.Find(ItemId) : nullptr)
+    {
+        Result.Reserve(Stacks->Num());
+        for (const TPair<FString, FInventoryItem>& Stack : *Stacks)
+        {
+            Result.Add(&Stack.Value);
+        }
+    }
+    return Result;
+}
+
+int32 PlayFabInventoryMirror::GetTotalAmount(const FString& CollectionId, const FString& ItemId) const
+{
+    int32 Total = 0;
+    for (const FInventoryItem* Stack : FindStacks(CollectionId, ItemId))
+    {
+        Total += Stack->Amount;
+    }
+    return Total;
+}
+
+TArray<FInventoryItem> PlayFabInventoryMirror::GetItems(const FString& CollectionId) const
+{
+    TArray<FInventoryItem> Result;
+    if (const FCollection* Collection = Collections.Find(NormalizeCollectionId(CollectionId)))
+    {
+        for (const TPair<FString, TMap<FString, FInventoryItem> >& Item : Collection->Items)
+        {
+            for (const TPair<FString, FInventoryItem>& Stack : Item.Value)
+            {
+                Result.Add(Stack.Value);
+            }
+        }
+    }
+    return Result;
+}
+
+FString PlayFabInventoryMirror::GetETag(const FString& CollectionId) const
+{
+    const FCollection* Collection = Collections.Find(NormalizeCollectionId(CollectionId));
+    return Collection != nullptr ? Collection->ETag : FString();
+}
+
+TArray<FString> PlayFabInventoryMirror::GetTransactionIds(const FString& CollectionId) const
+{
+    const FCollection* Collection = Collections.Find(NormalizeCollectionId(CollectionId));
+    return Collection != nullptr ? Collection->TransactionIds : TArray<FString>();
+}
+
+FPlayFabRequestHandle PlayFabInventoryMirror::RequestPage(const FString& CollectionId, const FString& ContinuationToken, TSharedRef<TArray<FInventoryItem> > Loaded, const FCollectionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    FGetInventoryItemsRequest request;
+    request.CollectionId = CollectionId;
+    request.ContinuationToken = ContinuationToken;
+    request.Count = 50; // Largest page the service allows
+    request.Entity = Entity;
+    return GetEconomyAPI()->GetInventoryItems(request,
+        UPlayFabEconomyAPI::FGetInventoryItemsDelegate::CreateSP(this, &PlayFabInventoryMirror::OnRefreshPage, CollectionId, Loaded, SuccessDelegate, ErrorDelegate),
+        FPlayFabErrorDelegate::CreateSP(this, &PlayFabInventoryMirror::OnRefreshError, CollectionId, ErrorDelegate));
+}
+
+void PlayFabInventoryMirror::OnRefreshPage(const FGetInventoryItemsResponse& result, FString CollectionId, TSharedRef<TArray<FInventoryItem> > Loaded, FCollectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
+{
+    Loaded->Append(result.Items);
+    if (!result.ContinuationToken.IsEmpty())
+    {
+        RequestPage(CollectionId, result.ContinuationToken, Loaded, SuccessDelegate, ErrorDelegate);
+        return;
+    }
+
+    FCollection& Collection = Collections.FindOrAdd(CollectionId);
+    Collection.Items.Reset();
+    for (const FInventoryItem& Item : *Loaded)
+    {
+        Collection.Items.FindOrAdd(Item.Id).Add(NormalizeStackId(Item.StackId), Item);
+    }
+    Collection.ETag = result.ETag;
+    Collection.TransactionIds.Reset();
+    Collection.bLoaded = true;
+    Collection.bRefreshing = false;
+
+    // A write that finished while the pages came in may or may not be part of them
+    if (Collection.bUnappliedWrite && Collection.PendingWrites == 0)
+    {
+        Collection.bUnappliedWrite = false;
+        Refetch(CollectionId);
+    }
+
+    OnCollectionChanged.ExecuteIfBound(CollectionId);
+    SuccessDelegate.ExecuteIfBound(CollectionId);
+}
+
+void PlayFabInventoryMirror::OnRefreshError(const FPlayFabCppError& error, FString CollectionId, FPlayFabErrorDelegate ErrorDelegate)
+{
+    if (FCollection* Collection = Collections.Find(CollectionId))
+    {
+        Collection->bRefreshing = false;
+    }
+    ErrorDelegate.ExecuteIfBound(error);
+}
+
+bool PlayFabInventoryMirror::BeginWrite(const FString& CollectionId, FString& RequestETag)
+{
+    FCollection* Collection = Collections.Find(CollectionId);
+    if (Collection == nullptr || !Collection->bLoaded)
+    {
+        return false; // Nothing mirrored to keep current
+    }
+
+    Collection->PendingWrites += 1;
+
+    // With another write or a refresh in flight the local copy is about to change under this one, so it cannot be applied on top of it
+    const bool bCurrent = !Collection->bRefreshing && Collection->PendingWrites == 1;
+    if (bCurrent && bSendLocalETag && RequestETag.IsEmpty())
+    {
+        RequestETag = Collection->ETag;
+    }
+
+    // A write without an ETag stays unconditional and is applied optimistically; one checked against another ETag started from another state
+    const bool bApplicable = bCurrent && (RequestETag.IsEmpty() || RequestETag == Collection->ETag);
+    if (!bApplicable)
+    {
+        Collection->bUnappliedWrite = true;
+    }
+    return bApplicable;
+}
+
+void PlayFabInventoryMirror::EndWrite(const FString& CollectionId, const TArray<FInventoryOperation>& Operations, const FString& ETag, const TArray<FString>& TransactionIds, bool bApplicable)
+{
+    FCollection* Collection = Collections.Find(CollectionId);
+    if (Collection == nullptr || !Collection->bLoaded)
+    {
+        return;
+    }
+    Collection->PendingWrites = FMath::Max(0, Collection->PendingWrites - 1);
+
+    if (bApplicable && Collection->bRefreshing)
+    {
+        // The pages of the refresh in flight may have been read before this write, the download after it covers that
+        Collection->bUnappliedWrite = true;
+    }
+    else if (bApplicable)
+    {
+        bool bApplied = true;
+        for (const FInventoryOperation& Operation : Operations)
+        {
+            bApplied = bApplied && ApplyOperation(*Collection, Operation);
+        }
+        if (bApplied)
+        {
+            Collection->ETag = ETag;
+            Collection->TransactionIds.Append(TransactionIds);
+            Applied += 1;
+            OnCollectionChanged.ExecuteIfBound(CollectionId);
+            return;
+        }
+        Collection->bUnappliedWrite = true;
+    }
+
+    // Only the last of overlapping writes triggers the download
+    if (Collection->bUnappliedWrite && Collection->PendingWrites == 0 && !Collection->bRefreshing)
+    {
+        Collection->bUnappliedWrite = false;
+        Refetch(CollectionId);
+    }
+}
+
+void PlayFabInventoryMirror::OnWriteError(const FPlayFabCppError& error, FPlayFabErrorDelegate ErrorDelegate, FString CollectionId)
+{
+    if (FCollection* Collection = Collections.Find(CollectionId))
+    {
+        Collection->PendingWrites = FMath::Max(0, Collection->PendingWrites - 1);
+        if (Collection->bLoaded && (IsConflict(error) || (Collection->bUnappliedWrite && Collection->PendingWrites == 0)) && !Collection->bRefreshing)
+        {
+            Collection->bUnappliedWrite = false;
+            Refetch(CollectionId);
+        }
+    }
+    ErrorDelegate.ExecuteIfBound(error);
+}
+
+bool PlayFabInventoryMirror::ApplyOperation(FCollection& Collection, const FInventoryOperation& Operation) const
+{
+    // Both return nullptr for references the local copy cannot resolve
+    auto FindStack = [&Collection](const TSharedPtr<FInventoryItemReference>& Item) -> FInventoryItem*
+    {
+        TMap<FString, FInventoryItem>* Stacks = IsLocalReference(Item) ? Collection.Items.Find(Item->Id) : nullptr;
+        return Stacks != nullptr ? Stacks->Find(NormalizeStackId(Item->StackId)) : nullptr;
+    };
+    auto FindOrAddStack = [&Collection](const TSharedPtr<FInventoryItemReference>& Item, const TSharedPtr<FInitialValues>& NewStackValues) -> FInventoryItem*
+    {
+        if (!IsLocalReference(Item))
+        {
+            return nullptr;
+        }
+        TMap<FString, FInventoryItem>& Stacks = Collection.Items.FindOrAdd(Item->Id);
+        const FString StackId = NormalizeStackId(Item->StackId);
+        if (FInventoryItem* Existing = Stacks.Find(StackId))
+        {
+            return Existing;
+        }
+
+        FInventoryItem NewStack;
+        NewStack.Id = Item->Id;
+        NewStack.StackId = StackId;
+        NewStack.Amount = 0;
+        for (const TPair<FString, FInventoryItem>& Other : Stacks)
+        {
+            NewStack.Type = Other.Value.Type;
+            break;
+        }
+        if (NewStackValues.IsValid())
+        {
+            NewStack.DisplayProperties = NewStackValues->DisplayProperties;
+        }
+        return &Stacks.Add(StackId, NewStack);
+    };
+    auto RemoveStack = [&Collection](const FInventoryItem& Stack)
+    {
+        const FString Id = Stack.Id;
+        TMap<FString, FInventoryItem>& Stacks = Collection.Items.FindChecked(Id);
+        Stacks.Remove(NormalizeStackId(Stack.StackId));
+        if (Stacks.Num() == 0)
+        {
+            Collection.Items.Remove(Id);
+        }
+    };
+    auto Subtract = [&RemoveStack](FInventoryItem& Stack, int32 Amount, bool bDeleteEmptyStacks)
+    {
+        if (Stack.Amount.mValue < Amount)
+        {
+            return false; // The service would have refused; the copy is behind
+        }
+        Stack.Amount = Stack.Amount.mValue - Amount;
+        if (Stack.Amount.mValue == 0 && bDeleteEmptyStacks)
+        {
+            RemoveStack(Stack);
+        }
+        return true;
+    };
+
+    if (const FAddInventoryItemsOperation* Add = Operation.Add.Get())
+    {
+        FInventoryItem* Stack = Add->Amount.notNull() ? FindOrAddStack(Add->Item, Add->NewStackValues) : nullptr;
+        if (Stack == nullptr)
+        {
+            return false;
+        }
+        Stack->Amount = Stack->Amount.mValue + Add->Amount.mValue;
+        AddDuration(*Stack, Add->DurationInSeconds);
+        return true;
+    }
+    if (const FSubtractInventoryItemsOperation* Sub = Operation.Subtract.Get())
+    {
+        FInventoryItem* Stack = Sub->Amount.notNull() ? FindStack(Sub->Item) : nullptr;
+        if (Stack == nullptr)
+        {
+            return false;
+        }
+        if (Sub->DurationInSeconds.notNull() && Stack->ExpirationDate.notNull())
+        {
+            Stack->ExpirationDate = Stack->ExpirationDate.mValue - FTimespan::FromSeconds(Sub->DurationInSeconds);
+        }
+        return Subtract(*Stack, Sub->Amount, Sub->DeleteEmptyStacks);
+    }
+    if (const FUpdateInventoryItemsOperation* Update = Operation.Update.Get())
+    {
+        if (!Update->Item.IsValid() || Update->Item->Id.IsEmpty())
+        {
+            return false;
+        }
+        FInventoryItem& Stack = Collection.Items.FindOrAdd(Update->Item->Id).FindOrAdd(NormalizeStackId(Update->Item->StackId));
+        const FString Type = Stack.Type;
+        Stack = *Update->Item;
+        Stack.StackId = NormalizeStackId(Stack.StackId);
+        if (Stack.Type.IsEmpty())
+        {
+            Stack.Type = Type;
+        }
+        return true;
+    }
+    if (const FDeleteInventoryItemsOperation* Delete = Operation.Delete.Get())
+    {
+        FInventoryItem* Stack = FindStack(Delete->Item);
+        if (Stack == nullptr)
+        {
+            return false;
+        }
+        RemoveStack(*Stack);
+        return true;
+    }
+    if (const FPurchaseInventoryItemsOperation* Purchase = Operation.Purchase.Get())
+    {
+        // Without PriceAmounts the price comes from the catalog or store, which the copy does not know
+        if (Purchase->Amount.isNull() || Purchase->PriceAmounts.Num() == 0)
+        {
+            return false;
+        }
+        for (const FPurchasePriceAmount& Price : Purchase->PriceAmounts)
+        {
+            TSharedPtr<FInventoryItemReference> PriceItem = MakeShareable(new FInventoryItemReference());
+            PriceItem->Id = Price.ItemId;
+            PriceItem->StackId = Price.StackId;
+            FInventoryItem* Currency = FindStack(PriceItem);
+            if (Currency == nullptr || !Subtract(*Currency, Price.Amount * Purchase->Amount.mValue, Purchase->DeleteEmptyStacks))
+            {
+                return false;
+            }
+        }
+        FInventoryItem* Stack = FindOrAddStack(Purchase->Item, Purchase->NewStackValues);
+        if (Stack == nullptr)
+        {
+            return false;
+        }
+        Stack->Amount = Stack->Amount.mValue + Purchase->Amount.mValue;
+        AddDuration(*Stack, Purchase->DurationInSeconds);
+        return true;
+    }
+    if (const FTransferInventoryItemsOperation* Transfer = Operation.Transfer.Get())
+    {
+        FInventoryItem* Giving = Transfer->Amount.notNull() ? FindStack(Transfer->GivingItem) : nullptr;
+        if (Giving == nullptr)
+        {
+            return false;
+        }
+        const FInventoryItem GivingCopy = *Giving;
+        if (!Subtract(*Giving, Transfer->Amount, Transfer->DeleteEmptyStacks))
+        {
+            return false;
+        }
+        FInventoryItem* Receiving = FindOrAddStack(Transfer->ReceivingItem, Transfer->NewStackValues);
+        if (Receiving == nullptr)
+        {
+            return false;
+        }
+        if (Receiving->Amount.mValue == 0 && Receiving->ExpirationDate.isNull())
+        {
+            Receiving->ExpirationDate = GivingCopy.ExpirationDate;
+        }
+        Receiving->Amount = Receiving->Amount.mValue + Transfer->Amount.mValue;
+        return true;
+    }
+    return false;
+}
+
+void PlayFabInventoryMirror::Refetch(const FString& CollectionId)
+{
+    UE_LOG(LogPlayFabCpp, Verbose, TEXT("PlayFabInventoryMirror: local copy of collection %s is out of date, downloading it again"), *CollectionId);
+    Refetches += 1;
+    Refresh(CollectionId);
+}
+
+FString PlayFabInventoryMirror::NormalizeCollectionId(const FString& CollectionId)
+{
+    return CollectionId.IsEmpty() ? FString(DefaultId) : CollectionId;
+}
+
+FString PlayFabInventoryMirror::NormalizeStackId(const FString& StackId)
+{
+    return StackId.IsEmpty() ? FString(DefaultId) : StackId;
+}
+
+PlayFabEconomyPtr PlayFabInventoryMirror::GetEconomyAPI() const
+{
+    return EconomyAPI.IsValid() ? EconomyAPI : IPlayFabModuleInterface::Get().GetEconomyAPI();
+}
+
+#endif // WITH_PLAYFAB_ECONOMY_API
@@ -5,11 +5,23 @@
 
 #include "PlayFabJsonHelpers.h"
 #include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
 
 using namespace PlayFab;
 
 static TArray< TSharedPtr<FJsonValue> > EmptyArray;
 
+// Small arrays stay serial, where the task overhead outweighs the gain. PlayFab.BenchmarkArrayDecode shows the crossover on the current machine.
+static TAutoConsoleVariable<int32> CVarParallelDecodeThreshold(
+    TEXT("PlayFab.ParallelDecodeThreshold"),
+    256,
+    TEXT("Response arrays with at least this many objects are decoded in parallel. 0 disables parallel decoding."));
+
+int32 FPlayFabJsonHelpers::GetParallelDecodeThreshold()
+{
+    return CVarParallelDecodeThreshold.GetValueOnAnyThread();
+}
+
 const TArray< TSharedPtr<FJsonValue> >& FPlayFabJsonHelpers::ReadArray(TSharedPtr<class FJsonObject> Item, const FString& Key)
 {
     if (Item->HasTypedField<EJson::Array>(Key))
@@ -80,6 +92,168 @@ bool FPlayFabJsonHelpers::ReadValue(const TSharedPtr<FJsonObject>& obj, const FS
     return obj->TryGetNumberField(FieldName, OutNumber);
 }
 
+namespace
+{
+    // The scanners below run on the TCHAR text of a response as well as on its raw UTF-8 bytes
+    template <typename CharType>
+    bool IsJsonWhitespace(CharType Char)
+    {
+        return Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r';
+    }
+
+    template <typename CharType>
+    void SkipWhitespace(const CharType* Chars, int32 Len, int32& Pos)
+    {
+        while (Pos < Len && IsJsonWhitespace(Chars[Pos]))
+        {
+            ++Pos;
+        }
+    }
+
+    // Pos is on the opening quote; leaves Pos after the closing one
+    template <typename CharType>
+    bool SkipString(const CharType* Chars, int32 Len, int32& Pos)
+    {
+        for (++Pos; Pos < Len; ++Pos)
+        {
+            if (Chars[Pos] == '\\')
+            {
+                ++Pos;
+            }
+            else if (Chars[Pos] == '"')
+            {
+                ++Pos;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename CharType>
+    bool SkipValue(const CharType* Chars, int32 Len, int32& Pos)
+    {
+        if (Pos >= Len)
+        {
+            return false;
+        }
+        if (Chars[Pos] == '"')
+        {
+            return SkipString(Chars, Len, Pos);
+        }
+        if (Chars[Pos] == '{' || Chars[Pos] == '[')
+        {
+            int32 Depth = 0;
+            while (Pos < Len)
+            {
+                const CharType Char = Chars[Pos];
+                if (Char == '"')
+                {
+                    if (!SkipString(Chars, Len, Pos))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                if (Char == '{' || Char == '[')
+                {
+                    ++Depth;
+                }
+                else if ((Char == '}' || Char == ']') && --Depth == 0)
+                {
+                    ++Pos;
+                    return true;
+                }
+                ++Pos;
+            }
+            return false;
+        }
+
+        // Number, true, false or null
+        const int32 Start = Pos;
+        while (Pos < Len && Chars[Pos] != ',' && Chars[Pos] != '}' && Chars[Pos] != ']' && !IsJsonWhitespace(Chars[Pos]))
+        {
+            ++Pos;
+        }
+        return Pos > Start;
+    }
+
+    template <typename CharType>
+    bool FindRawValueImpl(const CharType* Chars, int32 Len, const TArray<FString>& Path, int32& OutStart, int32& OutEnd)
+    {
+        int32 Pos = 0;
+
+        for (int32 Level = 0; Level < Path.Num(); ++Level)
+        {
+            SkipWhitespace(Chars, Len, Pos);
+            if (Pos >= Len || Chars[Pos] != '{')
+            {
+                return false;
+            }
+            ++Pos;
+
+            const auto Key = StringCast<CharType>(*Path[Level]);
+            bool bFound = false;
+            while (!bFound)
+            {
+                SkipWhitespace(Chars, Len, Pos);
+                if (Pos >= Len || Chars[Pos] != '"')
+                {
+                    return false; // End of the object (or malformed): the member is missing
+                }
+                const int32 KeyStart = Pos + 1;
+                if (!SkipString(Chars, Len, Pos))
+                {
+                    return false;
+                }
+                const int32 KeyLen = Pos - 1 - KeyStart;
+
+                SkipWhitespace(Chars, Len, Pos);
+                if (Pos >= Len || Chars[Pos] != ':')
+                {
+                    return false;
+                }
+                ++Pos;
+                SkipWhitespace(Chars, Len, Pos);
+
+                if (KeyLen == Key.Length() && FMemory::Memcmp(Chars + KeyStart, Key.Get(), KeyLen * sizeof(CharType)) == 0)
+                {
+                    bFound = true;
+                    continue;
+                }
+
+                if (!SkipValue(Chars, Len, Pos))
+                {
+                    return false;
+                }
+                SkipWhitespace(Chars, Len, Pos);
+                if (Pos >= Len || Chars[Pos] != ',')
+                {
+                    return false;
+                }
+                ++Pos;
+            }
+        }
+
+        OutStart = Pos;
+        if (!SkipValue(Chars, Len, Pos))
+        {
+            return false;
+        }
+        OutEnd = Pos;
+        return true;
+    }
+}
+
+bool FPlayFabJsonHelpers::FindRawValue(const FString& Json, const TArray<FString>& Path, int32& OutStart, int32& OutEnd)
+{
+    return FindRawValueImpl(*Json, Json.Len(), Path, OutStart, OutEnd);
+}
+
+bool FPlayFabJsonHelpers::FindRawValue(FUtf8StringView Json, const TArray<FString>& Path, int32& OutStart, int32& OutEnd)
+{
+    return FindRawValueImpl(Json.GetData(), Json.Len(), Path, OutStart, OutEnd);
+}
+
 // bool FPlayFabJsonHelpers::ReadValue(const TSharedPtr<FJsonObject>& obj, const FString& FieldName, OptionalBool& OutNumber)
 // {
 //     bool tmp;
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_LOCALIZATION_API
 
 #include "Core/PlayFabLocalizationDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -41,6 +42,7 @@ bool PlayFab::LocalizationModels::FGetLanguageListRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -80,3 +82,5 @@ bool PlayFab::LocalizationModels::FGetLanguageListResponse::readFromValue(const
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_LOCALIZATION_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_MULTIPLAYER_API
 #include "Core/PlayFabMultiplayerAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabMultiplayerAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabMultiplayerAPI::CancelAllMatchmakingTicketsForPlayer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CancelAllMatchmakingTicketsForPlayer(
     MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest& request,
     const FCancelAllMatchmakingTicketsForPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabMultiplayerAPI::CancelAllMatchmakingTicketsForPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/CancelAllMatchmakingTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCancelAllMatchmakingTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCancelAllMatchmakingTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelAllMatchmakingTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabMultiplayerAPI::OnCancelAllMatchmakingTicketsForPlayerResult(FHttpR
     }
 }
 
-bool UPlayFabMultiplayerAPI::CancelAllServerBackfillTicketsForPlayer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CancelAllServerBackfillTicketsForPlayer(
     MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest& request,
     const FCancelAllServerBackfillTicketsForPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabMultiplayerAPI::CancelAllServerBackfillTicketsForPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/CancelAllServerBackfillTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCancelAllServerBackfillTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCancelAllServerBackfillTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelAllServerBackfillTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabMultiplayerAPI::OnCancelAllServerBackfillTicketsForPlayerResult(FHt
     }
 }
 
-bool UPlayFabMultiplayerAPI::CancelMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CancelMatchmakingTicket(
     MultiplayerModels::FCancelMatchmakingTicketRequest& request,
     const FCancelMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabMultiplayerAPI::CancelMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/CancelMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCancelMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCancelMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabMultiplayerAPI::OnCancelMatchmakingTicketResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabMultiplayerAPI::CancelServerBackfillTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CancelServerBackfillTicket(
     MultiplayerModels::FCancelServerBackfillTicketRequest& request,
     const FCancelServerBackfillTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabMultiplayerAPI::CancelServerBackfillTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/CancelServerBackfillTicket"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCancelServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCancelServerBackfillTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelServerBackfillTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabMultiplayerAPI::OnCancelServerBackfillTicketResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateBuildAlias(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateBuildAlias(
     MultiplayerModels::FCreateBuildAliasRequest& request,
     const FCreateBuildAliasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabMultiplayerAPI::CreateBuildAlias(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/CreateBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabMultiplayerAPI::OnCreateBuildAliasResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateBuildWithCustomContainer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateBuildWithCustomContainer(
     MultiplayerModels::FCreateBuildWithCustomContainerRequest& request,
     const FCreateBuildWithCustomContainerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabMultiplayerAPI::CreateBuildWithCustomContainer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/CreateBuildWithCustomContainer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateBuildWithCustomContainerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateBuildWithCustomContainerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildWithCustomContainerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabMultiplayerAPI::OnCreateBuildWithCustomContainerResult(FHttpRequest
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateBuildWithManagedContainer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateBuildWithManagedContainer(
     MultiplayerModels::FCreateBuildWithManagedContainerRequest& request,
     const FCreateBuildWithManagedContainerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,7 +221,7 @@ bool UPlayFabMultiplayerAPI::CreateBuildWithManagedContainer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/CreateBuildWithManagedContainer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateBuildWithManagedContainerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateBuildWithManagedContainerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildWithManagedContainerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -237,7 +238,7 @@ void UPlayFabMultiplayerAPI::OnCreateBuildWithManagedContainerResult(FHttpReques
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateBuildWithProcessBasedServer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateBuildWithProcessBasedServer(
     MultiplayerModels::FCreateBuildWithProcessBasedServerRequest& request,
     const FCreateBuildWithProcessBasedServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -250,7 +251,7 @@ bool UPlayFabMultiplayerAPI::CreateBuildWithProcessBasedServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/CreateBuildWithProcessBasedServer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateBuildWithProcessBasedServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateBuildWithProcessBasedServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildWithProcessBasedServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -267,7 +268,7 @@ void UPlayFabMultiplayerAPI::OnCreateBuildWithProcessBasedServerResult(FHttpRequ
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateLobby(
     MultiplayerModels::FCreateLobbyRequest& request,
     const FCreateLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -280,7 +281,7 @@ bool UPlayFabMultiplayerAPI::CreateLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/CreateLobby"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -297,7 +298,7 @@ void UPlayFabMultiplayerAPI::OnCreateLobbyResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateMatchmakingTicket(
     MultiplayerModels::FCreateMatchmakingTicketRequest& request,
     const FCreateMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -310,7 +311,7 @@ bool UPlayFabMultiplayerAPI::CreateMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/CreateMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -327,7 +328,7 @@ void UPlayFabMultiplayerAPI::OnCreateMatchmakingTicketResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateRemoteUser(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateRemoteUser(
     MultiplayerModels::FCreateRemoteUserRequest& request,
     const FCreateRemoteUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -340,7 +341,7 @@ bool UPlayFabMultiplayerAPI::CreateRemoteUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/CreateRemoteUser"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateRemoteUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateRemoteUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateRemoteUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -357,7 +358,7 @@ void UPlayFabMultiplayerAPI::OnCreateRemoteUserResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateServerBackfillTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateServerBackfillTicket(
     MultiplayerModels::FCreateServerBackfillTicketRequest& request,
     const FCreateServerBackfillTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -370,7 +371,7 @@ bool UPlayFabMultiplayerAPI::CreateServerBackfillTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/CreateServerBackfillTicket"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateServerBackfillTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateServerBackfillTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -387,7 +388,7 @@ void UPlayFabMultiplayerAPI::OnCreateServerBackfillTicketResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateServerMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateServerMatchmakingTicket(
     MultiplayerModels::FCreateServerMatchmakingTicketRequest& request,
     const FCreateServerMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -400,7 +401,7 @@ bool UPlayFabMultiplayerAPI::CreateServerMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/CreateServerMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateServerMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateServerMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateServerMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -417,7 +418,7 @@ void UPlayFabMultiplayerAPI::OnCreateServerMatchmakingTicketResult(FHttpRequestP
     }
 }
 
-bool UPlayFabMultiplayerAPI::CreateTitleMultiplayerServersQuotaChange(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::CreateTitleMultiplayerServersQuotaChange(
     MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest& request,
     const FCreateTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -430,7 +431,7 @@ bool UPlayFabMultiplayerAPI::CreateTitleMultiplayerServersQuotaChange(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/CreateTitleMultiplayerServersQuotaChange"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnCreateTitleMultiplayerServersQuotaChangeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnCreateTitleMultiplayerServersQuotaChangeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateTitleMultiplayerServersQuotaChangeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -447,7 +448,7 @@ void UPlayFabMultiplayerAPI::OnCreateTitleMultiplayerServersQuotaChangeResult(FH
     }
 }
 
-bool UPlayFabMultiplayerAPI::DeleteAsset(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::DeleteAsset(
     MultiplayerModels::FDeleteAssetRequest& request,
     const FDeleteAssetDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -460,7 +461,7 @@ bool UPlayFabMultiplayerAPI::DeleteAsset(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/DeleteAsset"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnDeleteAssetResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnDeleteAssetResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteAssetDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -477,7 +478,7 @@ void UPlayFabMultiplayerAPI::OnDeleteAssetResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabMultiplayerAPI::DeleteBuild(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::DeleteBuild(
     MultiplayerModels::FDeleteBuildRequest& request,
     const FDeleteBuildDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -490,7 +491,7 @@ bool UPlayFabMultiplayerAPI::DeleteBuild(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/DeleteBuild"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnDeleteBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnDeleteBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -507,7 +508,7 @@ void UPlayFabMultiplayerAPI::OnDeleteBuildResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabMultiplayerAPI::DeleteBuildAlias(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::DeleteBuildAlias(
     MultiplayerModels::FDeleteBuildAliasRequest& request,
     const FDeleteBuildAliasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -520,7 +521,7 @@ bool UPlayFabMultiplayerAPI::DeleteBuildAlias(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/DeleteBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnDeleteBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnDeleteBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -537,7 +538,7 @@ void UPlayFabMultiplayerAPI::OnDeleteBuildAliasResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabMultiplayerAPI::DeleteBuildRegion(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::DeleteBuildRegion(
     MultiplayerModels::FDeleteBuildRegionRequest& request,
     const FDeleteBuildRegionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -550,7 +551,7 @@ bool UPlayFabMultiplayerAPI::DeleteBuildRegion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/DeleteBuildRegion"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnDeleteBuildRegionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnDeleteBuildRegionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteBuildRegionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -567,7 +568,7 @@ void UPlayFabMultiplayerAPI::OnDeleteBuildRegionResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::DeleteCertificate(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::DeleteCertificate(
     MultiplayerModels::FDeleteCertificateRequest& request,
     const FDeleteCertificateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -580,7 +581,7 @@ bool UPlayFabMultiplayerAPI::DeleteCertificate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/DeleteCertificate"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnDeleteCertificateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnDeleteCertificateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteCertificateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -597,7 +598,7 @@ void UPlayFabMultiplayerAPI::OnDeleteCertificateResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::DeleteContainerImageRepository(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::DeleteContainerImageRepository(
     MultiplayerModels::FDeleteContainerImageRequest& request,
     const FDeleteContainerImageRepositoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -610,7 +611,7 @@ bool UPlayFabMultiplayerAPI::DeleteContainerImageRepository(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/DeleteContainerImageRepository"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnDeleteContainerImageRepositoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnDeleteContainerImageRepositoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteContainerImageRepositoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -627,7 +628,7 @@ void UPlayFabMultiplayerAPI::OnDeleteContainerImageRepositoryResult(FHttpRequest
     }
 }
 
-bool UPlayFabMultiplayerAPI::DeleteLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::DeleteLobby(
     MultiplayerModels::FDeleteLobbyRequest& request,
     const FDeleteLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -640,7 +641,7 @@ bool UPlayFabMultiplayerAPI::DeleteLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/DeleteLobby"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnDeleteLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnDeleteLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -657,7 +658,7 @@ void UPlayFabMultiplayerAPI::OnDeleteLobbyResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabMultiplayerAPI::DeleteRemoteUser(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::DeleteRemoteUser(
     MultiplayerModels::FDeleteRemoteUserRequest& request,
     const FDeleteRemoteUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -670,7 +671,7 @@ bool UPlayFabMultiplayerAPI::DeleteRemoteUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/DeleteRemoteUser"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnDeleteRemoteUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnDeleteRemoteUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteRemoteUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -687,7 +688,7 @@ void UPlayFabMultiplayerAPI::OnDeleteRemoteUserResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabMultiplayerAPI::DeleteSecret(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::DeleteSecret(
     MultiplayerModels::FDeleteSecretRequest& request,
     const FDeleteSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -700,7 +701,7 @@ bool UPlayFabMultiplayerAPI::DeleteSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/DeleteSecret"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnDeleteSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnDeleteSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -717,7 +718,7 @@ void UPlayFabMultiplayerAPI::OnDeleteSecretResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabMultiplayerAPI::EnableMultiplayerServersForTitle(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::EnableMultiplayerServersForTitle(
     MultiplayerModels::FEnableMultiplayerServersForTitleRequest& request,
     const FEnableMultiplayerServersForTitleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -730,7 +731,7 @@ bool UPlayFabMultiplayerAPI::EnableMultiplayerServersForTitle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/EnableMultiplayerServersForTitle"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnEnableMultiplayerServersForTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnEnableMultiplayerServersForTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FEnableMultiplayerServersForTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -747,7 +748,7 @@ void UPlayFabMultiplayerAPI::OnEnableMultiplayerServersForTitleResult(FHttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::FindFriendLobbies(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::FindFriendLobbies(
     MultiplayerModels::FFindFriendLobbiesRequest& request,
     const FFindFriendLobbiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -760,7 +761,7 @@ bool UPlayFabMultiplayerAPI::FindFriendLobbies(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/FindFriendLobbies"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnFindFriendLobbiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnFindFriendLobbiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FFindFriendLobbiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -777,7 +778,7 @@ void UPlayFabMultiplayerAPI::OnFindFriendLobbiesResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::FindLobbies(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::FindLobbies(
     MultiplayerModels::FFindLobbiesRequest& request,
     const FFindLobbiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -790,7 +791,7 @@ bool UPlayFabMultiplayerAPI::FindLobbies(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/FindLobbies"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnFindLobbiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnFindLobbiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FFindLobbiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -807,7 +808,7 @@ void UPlayFabMultiplayerAPI::OnFindLobbiesResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetAssetDownloadUrl(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetAssetDownloadUrl(
     MultiplayerModels::FGetAssetDownloadUrlRequest& request,
     const FGetAssetDownloadUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -820,7 +821,7 @@ bool UPlayFabMultiplayerAPI::GetAssetDownloadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetAssetDownloadUrl"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetAssetDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetAssetDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAssetDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -837,7 +838,7 @@ void UPlayFabMultiplayerAPI::OnGetAssetDownloadUrlResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetAssetUploadUrl(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetAssetUploadUrl(
     MultiplayerModels::FGetAssetUploadUrlRequest& request,
     const FGetAssetUploadUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -850,7 +851,7 @@ bool UPlayFabMultiplayerAPI::GetAssetUploadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetAssetUploadUrl"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetAssetUploadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetAssetUploadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAssetUploadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -867,7 +868,7 @@ void UPlayFabMultiplayerAPI::OnGetAssetUploadUrlResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetBuild(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetBuild(
     MultiplayerModels::FGetBuildRequest& request,
     const FGetBuildDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -880,7 +881,7 @@ bool UPlayFabMultiplayerAPI::GetBuild(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetBuild"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -897,7 +898,7 @@ void UPlayFabMultiplayerAPI::OnGetBuildResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetBuildAlias(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetBuildAlias(
     MultiplayerModels::FGetBuildAliasRequest& request,
     const FGetBuildAliasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -910,7 +911,7 @@ bool UPlayFabMultiplayerAPI::GetBuildAlias(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -927,7 +928,7 @@ void UPlayFabMultiplayerAPI::OnGetBuildAliasResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetContainerRegistryCredentials(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetContainerRegistryCredentials(
     MultiplayerModels::FGetContainerRegistryCredentialsRequest& request,
     const FGetContainerRegistryCredentialsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -940,7 +941,7 @@ bool UPlayFabMultiplayerAPI::GetContainerRegistryCredentials(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetContainerRegistryCredentials"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetContainerRegistryCredentialsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetContainerRegistryCredentialsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContainerRegistryCredentialsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -957,7 +958,7 @@ void UPlayFabMultiplayerAPI::OnGetContainerRegistryCredentialsResult(FHttpReques
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetLobby(
     MultiplayerModels::FGetLobbyRequest& request,
     const FGetLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -970,7 +971,7 @@ bool UPlayFabMultiplayerAPI::GetLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/GetLobby"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -987,7 +988,7 @@ void UPlayFabMultiplayerAPI::OnGetLobbyResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetMatch(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetMatch(
     MultiplayerModels::FGetMatchRequest& request,
     const FGetMatchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1000,7 +1001,7 @@ bool UPlayFabMultiplayerAPI::GetMatch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/GetMatch"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetMatchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetMatchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1017,7 +1018,7 @@ void UPlayFabMultiplayerAPI::OnGetMatchResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetMatchmakingTicket(
     MultiplayerModels::FGetMatchmakingTicketRequest& request,
     const FGetMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1030,7 +1031,7 @@ bool UPlayFabMultiplayerAPI::GetMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/GetMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1047,7 +1048,7 @@ void UPlayFabMultiplayerAPI::OnGetMatchmakingTicketResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetMultiplayerServerDetails(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetMultiplayerServerDetails(
     MultiplayerModels::FGetMultiplayerServerDetailsRequest& request,
     const FGetMultiplayerServerDetailsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1060,7 +1061,7 @@ bool UPlayFabMultiplayerAPI::GetMultiplayerServerDetails(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetMultiplayerServerDetails"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetMultiplayerServerDetailsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetMultiplayerServerDetailsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMultiplayerServerDetailsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1077,7 +1078,7 @@ void UPlayFabMultiplayerAPI::OnGetMultiplayerServerDetailsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetMultiplayerServerLogs(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetMultiplayerServerLogs(
     MultiplayerModels::FGetMultiplayerServerLogsRequest& request,
     const FGetMultiplayerServerLogsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1090,7 +1091,7 @@ bool UPlayFabMultiplayerAPI::GetMultiplayerServerLogs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetMultiplayerServerLogs"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetMultiplayerServerLogsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetMultiplayerServerLogsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMultiplayerServerLogsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1107,7 +1108,7 @@ void UPlayFabMultiplayerAPI::OnGetMultiplayerServerLogsResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetMultiplayerSessionLogsBySessionId(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetMultiplayerSessionLogsBySessionId(
     MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest& request,
     const FGetMultiplayerSessionLogsBySessionIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1120,7 +1121,7 @@ bool UPlayFabMultiplayerAPI::GetMultiplayerSessionLogsBySessionId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetMultiplayerSessionLogsBySessionId"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetMultiplayerSessionLogsBySessionIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetMultiplayerSessionLogsBySessionIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMultiplayerSessionLogsBySessionIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1137,7 +1138,7 @@ void UPlayFabMultiplayerAPI::OnGetMultiplayerSessionLogsBySessionIdResult(FHttpR
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetQueueStatistics(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetQueueStatistics(
     MultiplayerModels::FGetQueueStatisticsRequest& request,
     const FGetQueueStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1150,7 +1151,7 @@ bool UPlayFabMultiplayerAPI::GetQueueStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/GetQueueStatistics"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetQueueStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetQueueStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetQueueStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1167,7 +1168,7 @@ void UPlayFabMultiplayerAPI::OnGetQueueStatisticsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetRemoteLoginEndpoint(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetRemoteLoginEndpoint(
     MultiplayerModels::FGetRemoteLoginEndpointRequest& request,
     const FGetRemoteLoginEndpointDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1180,7 +1181,7 @@ bool UPlayFabMultiplayerAPI::GetRemoteLoginEndpoint(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetRemoteLoginEndpoint"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetRemoteLoginEndpointResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetRemoteLoginEndpointResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRemoteLoginEndpointDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1197,7 +1198,7 @@ void UPlayFabMultiplayerAPI::OnGetRemoteLoginEndpointResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetServerBackfillTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetServerBackfillTicket(
     MultiplayerModels::FGetServerBackfillTicketRequest& request,
     const FGetServerBackfillTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1210,7 +1211,7 @@ bool UPlayFabMultiplayerAPI::GetServerBackfillTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/GetServerBackfillTicket"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetServerBackfillTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetServerBackfillTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1227,7 +1228,7 @@ void UPlayFabMultiplayerAPI::OnGetServerBackfillTicketResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetTitleEnabledForMultiplayerServersStatus(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetTitleEnabledForMultiplayerServersStatus(
     MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest& request,
     const FGetTitleEnabledForMultiplayerServersStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1240,7 +1241,7 @@ bool UPlayFabMultiplayerAPI::GetTitleEnabledForMultiplayerServersStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetTitleEnabledForMultiplayerServersStatus"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetTitleEnabledForMultiplayerServersStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetTitleEnabledForMultiplayerServersStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleEnabledForMultiplayerServersStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1257,7 +1258,7 @@ void UPlayFabMultiplayerAPI::OnGetTitleEnabledForMultiplayerServersStatusResult(
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotaChange(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotaChange(
     MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest& request,
     const FGetTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1270,7 +1271,7 @@ bool UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotaChange(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetTitleMultiplayerServersQuotaChange"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetTitleMultiplayerServersQuotaChangeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetTitleMultiplayerServersQuotaChangeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleMultiplayerServersQuotaChangeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1287,7 +1288,7 @@ void UPlayFabMultiplayerAPI::OnGetTitleMultiplayerServersQuotaChangeResult(FHttp
     }
 }
 
-bool UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotas(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotas(
     MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest& request,
     const FGetTitleMultiplayerServersQuotasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1300,7 +1301,7 @@ bool UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotas(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/GetTitleMultiplayerServersQuotas"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnGetTitleMultiplayerServersQuotasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnGetTitleMultiplayerServersQuotasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleMultiplayerServersQuotasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1317,7 +1318,7 @@ void UPlayFabMultiplayerAPI::OnGetTitleMultiplayerServersQuotasResult(FHttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::InviteToLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::InviteToLobby(
     MultiplayerModels::FInviteToLobbyRequest& request,
     const FInviteToLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1330,7 +1331,7 @@ bool UPlayFabMultiplayerAPI::InviteToLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/InviteToLobby"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnInviteToLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnInviteToLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInviteToLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1347,7 +1348,7 @@ void UPlayFabMultiplayerAPI::OnInviteToLobbyResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabMultiplayerAPI::JoinArrangedLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::JoinArrangedLobby(
     MultiplayerModels::FJoinArrangedLobbyRequest& request,
     const FJoinArrangedLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1360,7 +1361,7 @@ bool UPlayFabMultiplayerAPI::JoinArrangedLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/JoinArrangedLobby"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnJoinArrangedLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnJoinArrangedLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FJoinArrangedLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1377,7 +1378,7 @@ void UPlayFabMultiplayerAPI::OnJoinArrangedLobbyResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::JoinLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::JoinLobby(
     MultiplayerModels::FJoinLobbyRequest& request,
     const FJoinLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1390,7 +1391,7 @@ bool UPlayFabMultiplayerAPI::JoinLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/JoinLobby"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnJoinLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnJoinLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FJoinLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1407,7 +1408,7 @@ void UPlayFabMultiplayerAPI::OnJoinLobbyResult(FHttpRequestPtr HttpRequest, FHtt
     }
 }
 
-bool UPlayFabMultiplayerAPI::JoinLobbyAsServer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::JoinLobbyAsServer(
     MultiplayerModels::FJoinLobbyAsServerRequest& request,
     const FJoinLobbyAsServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1420,7 +1421,7 @@ bool UPlayFabMultiplayerAPI::JoinLobbyAsServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/JoinLobbyAsServer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnJoinLobbyAsServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnJoinLobbyAsServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FJoinLobbyAsServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1437,7 +1438,7 @@ void UPlayFabMultiplayerAPI::OnJoinLobbyAsServerResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::JoinMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::JoinMatchmakingTicket(
     MultiplayerModels::FJoinMatchmakingTicketRequest& request,
     const FJoinMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1450,7 +1451,7 @@ bool UPlayFabMultiplayerAPI::JoinMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/JoinMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnJoinMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnJoinMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FJoinMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1467,7 +1468,7 @@ void UPlayFabMultiplayerAPI::OnJoinMatchmakingTicketResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabMultiplayerAPI::LeaveLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::LeaveLobby(
     MultiplayerModels::FLeaveLobbyRequest& request,
     const FLeaveLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1480,7 +1481,7 @@ bool UPlayFabMultiplayerAPI::LeaveLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/LeaveLobby"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnLeaveLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnLeaveLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLeaveLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1497,7 +1498,7 @@ void UPlayFabMultiplayerAPI::OnLeaveLobbyResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabMultiplayerAPI::LeaveLobbyAsServer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::LeaveLobbyAsServer(
     MultiplayerModels::FLeaveLobbyAsServerRequest& request,
     const FLeaveLobbyAsServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1510,7 +1511,7 @@ bool UPlayFabMultiplayerAPI::LeaveLobbyAsServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/LeaveLobbyAsServer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnLeaveLobbyAsServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnLeaveLobbyAsServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLeaveLobbyAsServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1527,7 +1528,7 @@ void UPlayFabMultiplayerAPI::OnLeaveLobbyAsServerResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListArchivedMultiplayerServers(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListArchivedMultiplayerServers(
     MultiplayerModels::FListMultiplayerServersRequest& request,
     const FListArchivedMultiplayerServersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1540,7 +1541,7 @@ bool UPlayFabMultiplayerAPI::ListArchivedMultiplayerServers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListArchivedMultiplayerServers"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListArchivedMultiplayerServersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListArchivedMultiplayerServersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListArchivedMultiplayerServersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1557,7 +1558,7 @@ void UPlayFabMultiplayerAPI::OnListArchivedMultiplayerServersResult(FHttpRequest
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListAssetSummaries(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListAssetSummaries(
     MultiplayerModels::FListAssetSummariesRequest& request,
     const FListAssetSummariesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1570,7 +1571,7 @@ bool UPlayFabMultiplayerAPI::ListAssetSummaries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListAssetSummaries"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListAssetSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListAssetSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListAssetSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1587,7 +1588,7 @@ void UPlayFabMultiplayerAPI::OnListAssetSummariesResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListBuildAliases(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListBuildAliases(
     MultiplayerModels::FListBuildAliasesRequest& request,
     const FListBuildAliasesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1600,7 +1601,7 @@ bool UPlayFabMultiplayerAPI::ListBuildAliases(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListBuildAliases"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListBuildAliasesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListBuildAliasesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListBuildAliasesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1617,7 +1618,7 @@ void UPlayFabMultiplayerAPI::OnListBuildAliasesResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListBuildSummariesV2(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListBuildSummariesV2(
     MultiplayerModels::FListBuildSummariesRequest& request,
     const FListBuildSummariesV2Delegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1630,7 +1631,7 @@ bool UPlayFabMultiplayerAPI::ListBuildSummariesV2(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListBuildSummariesV2"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListBuildSummariesV2Result, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListBuildSummariesV2Result(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListBuildSummariesV2Delegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1647,7 +1648,7 @@ void UPlayFabMultiplayerAPI::OnListBuildSummariesV2Result(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListCertificateSummaries(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListCertificateSummaries(
     MultiplayerModels::FListCertificateSummariesRequest& request,
     const FListCertificateSummariesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1660,7 +1661,7 @@ bool UPlayFabMultiplayerAPI::ListCertificateSummaries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListCertificateSummaries"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListCertificateSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListCertificateSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListCertificateSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1677,7 +1678,7 @@ void UPlayFabMultiplayerAPI::OnListCertificateSummariesResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListContainerImages(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListContainerImages(
     MultiplayerModels::FListContainerImagesRequest& request,
     const FListContainerImagesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1690,7 +1691,7 @@ bool UPlayFabMultiplayerAPI::ListContainerImages(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListContainerImages"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListContainerImagesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListContainerImagesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListContainerImagesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1707,7 +1708,7 @@ void UPlayFabMultiplayerAPI::OnListContainerImagesResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListContainerImageTags(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListContainerImageTags(
     MultiplayerModels::FListContainerImageTagsRequest& request,
     const FListContainerImageTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1720,7 +1721,7 @@ bool UPlayFabMultiplayerAPI::ListContainerImageTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListContainerImageTags"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListContainerImageTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListContainerImageTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListContainerImageTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1737,7 +1738,7 @@ void UPlayFabMultiplayerAPI::OnListContainerImageTagsResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListMatchmakingTicketsForPlayer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListMatchmakingTicketsForPlayer(
     MultiplayerModels::FListMatchmakingTicketsForPlayerRequest& request,
     const FListMatchmakingTicketsForPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1750,7 +1751,7 @@ bool UPlayFabMultiplayerAPI::ListMatchmakingTicketsForPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/ListMatchmakingTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListMatchmakingTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListMatchmakingTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMatchmakingTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1767,7 +1768,7 @@ void UPlayFabMultiplayerAPI::OnListMatchmakingTicketsForPlayerResult(FHttpReques
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListMultiplayerServers(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListMultiplayerServers(
     MultiplayerModels::FListMultiplayerServersRequest& request,
     const FListMultiplayerServersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1780,7 +1781,7 @@ bool UPlayFabMultiplayerAPI::ListMultiplayerServers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListMultiplayerServers"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListMultiplayerServersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListMultiplayerServersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMultiplayerServersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1797,7 +1798,7 @@ void UPlayFabMultiplayerAPI::OnListMultiplayerServersResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListPartyQosServers(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListPartyQosServers(
     MultiplayerModels::FListPartyQosServersRequest& request,
     const FListPartyQosServersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1806,7 +1807,7 @@ bool UPlayFabMultiplayerAPI::ListPartyQosServers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListPartyQosServers"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListPartyQosServersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListPartyQosServersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListPartyQosServersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1823,7 +1824,7 @@ void UPlayFabMultiplayerAPI::OnListPartyQosServersResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListQosServersForTitle(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListQosServersForTitle(
     MultiplayerModels::FListQosServersForTitleRequest& request,
     const FListQosServersForTitleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1836,7 +1837,7 @@ bool UPlayFabMultiplayerAPI::ListQosServersForTitle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListQosServersForTitle"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListQosServersForTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListQosServersForTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListQosServersForTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1853,7 +1854,7 @@ void UPlayFabMultiplayerAPI::OnListQosServersForTitleResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListSecretSummaries(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListSecretSummaries(
     MultiplayerModels::FListSecretSummariesRequest& request,
     const FListSecretSummariesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1866,7 +1867,7 @@ bool UPlayFabMultiplayerAPI::ListSecretSummaries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListSecretSummaries"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListSecretSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListSecretSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListSecretSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1883,7 +1884,7 @@ void UPlayFabMultiplayerAPI::OnListSecretSummariesResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListServerBackfillTicketsForPlayer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListServerBackfillTicketsForPlayer(
     MultiplayerModels::FListServerBackfillTicketsForPlayerRequest& request,
     const FListServerBackfillTicketsForPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1896,7 +1897,7 @@ bool UPlayFabMultiplayerAPI::ListServerBackfillTicketsForPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Match/ListServerBackfillTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListServerBackfillTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListServerBackfillTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListServerBackfillTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1913,7 +1914,7 @@ void UPlayFabMultiplayerAPI::OnListServerBackfillTicketsForPlayerResult(FHttpReq
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListTitleMultiplayerServersQuotaChanges(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListTitleMultiplayerServersQuotaChanges(
     MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest& request,
     const FListTitleMultiplayerServersQuotaChangesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1926,7 +1927,7 @@ bool UPlayFabMultiplayerAPI::ListTitleMultiplayerServersQuotaChanges(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListTitleMultiplayerServersQuotaChanges"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListTitleMultiplayerServersQuotaChangesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListTitleMultiplayerServersQuotaChangesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListTitleMultiplayerServersQuotaChangesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1943,7 +1944,7 @@ void UPlayFabMultiplayerAPI::OnListTitleMultiplayerServersQuotaChangesResult(FHt
     }
 }
 
-bool UPlayFabMultiplayerAPI::ListVirtualMachineSummaries(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ListVirtualMachineSummaries(
     MultiplayerModels::FListVirtualMachineSummariesRequest& request,
     const FListVirtualMachineSummariesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1956,7 +1957,7 @@ bool UPlayFabMultiplayerAPI::ListVirtualMachineSummaries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ListVirtualMachineSummaries"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnListVirtualMachineSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnListVirtualMachineSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListVirtualMachineSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1973,7 +1974,7 @@ void UPlayFabMultiplayerAPI::OnListVirtualMachineSummariesResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerAPI::RemoveMember(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::RemoveMember(
     MultiplayerModels::FRemoveMemberFromLobbyRequest& request,
     const FRemoveMemberDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1986,7 +1987,7 @@ bool UPlayFabMultiplayerAPI::RemoveMember(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/RemoveMember"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnRemoveMemberResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnRemoveMemberResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveMemberDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2003,7 +2004,7 @@ void UPlayFabMultiplayerAPI::OnRemoveMemberResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabMultiplayerAPI::RequestMultiplayerServer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::RequestMultiplayerServer(
     MultiplayerModels::FRequestMultiplayerServerRequest& request,
     const FRequestMultiplayerServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2016,7 +2017,7 @@ bool UPlayFabMultiplayerAPI::RequestMultiplayerServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/RequestMultiplayerServer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnRequestMultiplayerServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnRequestMultiplayerServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRequestMultiplayerServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2033,7 +2034,7 @@ void UPlayFabMultiplayerAPI::OnRequestMultiplayerServerResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerAPI::RequestPartyService(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::RequestPartyService(
     MultiplayerModels::FRequestPartyServiceRequest& request,
     const FRequestPartyServiceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2046,7 +2047,7 @@ bool UPlayFabMultiplayerAPI::RequestPartyService(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Party/RequestPartyService"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnRequestPartyServiceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnRequestPartyServiceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRequestPartyServiceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2063,7 +2064,7 @@ void UPlayFabMultiplayerAPI::OnRequestPartyServiceResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerAPI::RolloverContainerRegistryCredentials(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::RolloverContainerRegistryCredentials(
     MultiplayerModels::FRolloverContainerRegistryCredentialsRequest& request,
     const FRolloverContainerRegistryCredentialsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2076,7 +2077,7 @@ bool UPlayFabMultiplayerAPI::RolloverContainerRegistryCredentials(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/RolloverContainerRegistryCredentials"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnRolloverContainerRegistryCredentialsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnRolloverContainerRegistryCredentialsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRolloverContainerRegistryCredentialsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2093,7 +2094,7 @@ void UPlayFabMultiplayerAPI::OnRolloverContainerRegistryCredentialsResult(FHttpR
     }
 }
 
-bool UPlayFabMultiplayerAPI::ShutdownMultiplayerServer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::ShutdownMultiplayerServer(
     MultiplayerModels::FShutdownMultiplayerServerRequest& request,
     const FShutdownMultiplayerServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2106,7 +2107,7 @@ bool UPlayFabMultiplayerAPI::ShutdownMultiplayerServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/ShutdownMultiplayerServer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnShutdownMultiplayerServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnShutdownMultiplayerServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FShutdownMultiplayerServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2123,7 +2124,7 @@ void UPlayFabMultiplayerAPI::OnShutdownMultiplayerServerResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabMultiplayerAPI::SubscribeToLobbyResource(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::SubscribeToLobbyResource(
     MultiplayerModels::FSubscribeToLobbyResourceRequest& request,
     const FSubscribeToLobbyResourceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2136,7 +2137,7 @@ bool UPlayFabMultiplayerAPI::SubscribeToLobbyResource(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/SubscribeToLobbyResource"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnSubscribeToLobbyResourceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnSubscribeToLobbyResourceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubscribeToLobbyResourceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2153,7 +2154,7 @@ void UPlayFabMultiplayerAPI::OnSubscribeToLobbyResourceResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerAPI::UnsubscribeFromLobbyResource(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UnsubscribeFromLobbyResource(
     MultiplayerModels::FUnsubscribeFromLobbyResourceRequest& request,
     const FUnsubscribeFromLobbyResourceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2166,7 +2167,7 @@ bool UPlayFabMultiplayerAPI::UnsubscribeFromLobbyResource(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/UnsubscribeFromLobbyResource"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUnsubscribeFromLobbyResourceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUnsubscribeFromLobbyResourceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnsubscribeFromLobbyResourceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2183,7 +2184,7 @@ void UPlayFabMultiplayerAPI::OnUnsubscribeFromLobbyResourceResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabMultiplayerAPI::UntagContainerImage(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UntagContainerImage(
     MultiplayerModels::FUntagContainerImageRequest& request,
     const FUntagContainerImageDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2196,7 +2197,7 @@ bool UPlayFabMultiplayerAPI::UntagContainerImage(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/UntagContainerImage"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUntagContainerImageResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUntagContainerImageResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUntagContainerImageDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2213,7 +2214,7 @@ void UPlayFabMultiplayerAPI::OnUntagContainerImageResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerAPI::UpdateBuildAlias(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UpdateBuildAlias(
     MultiplayerModels::FUpdateBuildAliasRequest& request,
     const FUpdateBuildAliasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2226,7 +2227,7 @@ bool UPlayFabMultiplayerAPI::UpdateBuildAlias(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/UpdateBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUpdateBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUpdateBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2243,7 +2244,7 @@ void UPlayFabMultiplayerAPI::OnUpdateBuildAliasResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabMultiplayerAPI::UpdateBuildName(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UpdateBuildName(
     MultiplayerModels::FUpdateBuildNameRequest& request,
     const FUpdateBuildNameDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2256,7 +2257,7 @@ bool UPlayFabMultiplayerAPI::UpdateBuildName(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/UpdateBuildName"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUpdateBuildNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUpdateBuildNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2273,7 +2274,7 @@ void UPlayFabMultiplayerAPI::OnUpdateBuildNameResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabMultiplayerAPI::UpdateBuildRegion(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UpdateBuildRegion(
     MultiplayerModels::FUpdateBuildRegionRequest& request,
     const FUpdateBuildRegionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2286,7 +2287,7 @@ bool UPlayFabMultiplayerAPI::UpdateBuildRegion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/UpdateBuildRegion"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUpdateBuildRegionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUpdateBuildRegionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildRegionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2303,7 +2304,7 @@ void UPlayFabMultiplayerAPI::OnUpdateBuildRegionResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::UpdateBuildRegions(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UpdateBuildRegions(
     MultiplayerModels::FUpdateBuildRegionsRequest& request,
     const FUpdateBuildRegionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2316,7 +2317,7 @@ bool UPlayFabMultiplayerAPI::UpdateBuildRegions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/UpdateBuildRegions"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUpdateBuildRegionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUpdateBuildRegionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildRegionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2333,7 +2334,7 @@ void UPlayFabMultiplayerAPI::OnUpdateBuildRegionsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabMultiplayerAPI::UpdateLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UpdateLobby(
     MultiplayerModels::FUpdateLobbyRequest& request,
     const FUpdateLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2346,7 +2347,7 @@ bool UPlayFabMultiplayerAPI::UpdateLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/UpdateLobby"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUpdateLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUpdateLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2363,7 +2364,7 @@ void UPlayFabMultiplayerAPI::OnUpdateLobbyResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabMultiplayerAPI::UpdateLobbyAsServer(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UpdateLobbyAsServer(
     MultiplayerModels::FUpdateLobbyAsServerRequest& request,
     const FUpdateLobbyAsServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2376,7 +2377,7 @@ bool UPlayFabMultiplayerAPI::UpdateLobbyAsServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Lobby/UpdateLobbyAsServer"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUpdateLobbyAsServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUpdateLobbyAsServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateLobbyAsServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2393,7 +2394,7 @@ void UPlayFabMultiplayerAPI::OnUpdateLobbyAsServerResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerAPI::UploadCertificate(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UploadCertificate(
     MultiplayerModels::FUploadCertificateRequest& request,
     const FUploadCertificateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2406,7 +2407,7 @@ bool UPlayFabMultiplayerAPI::UploadCertificate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/UploadCertificate"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUploadCertificateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUploadCertificateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUploadCertificateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2423,7 +2424,7 @@ void UPlayFabMultiplayerAPI::OnUploadCertificateResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabMultiplayerAPI::UploadSecret(
+FPlayFabRequestHandle UPlayFabMultiplayerAPI::UploadSecret(
     MultiplayerModels::FUploadSecretRequest& request,
     const FUploadSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2436,7 +2437,7 @@ bool UPlayFabMultiplayerAPI::UploadSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/MultiplayerServer/UploadSecret"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerAPI::OnUploadSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerAPI::OnUploadSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUploadSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2452,3 +2453,5 @@ void UPlayFabMultiplayerAPI::OnUploadSecretResult(FHttpRequestPtr HttpRequest, F
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_MULTIPLAYER_API
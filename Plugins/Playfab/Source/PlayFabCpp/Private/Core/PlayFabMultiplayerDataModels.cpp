@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_MULTIPLAYER_API
 
 #include "Core/PlayFabMultiplayerDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -29,15 +30,15 @@ MultiplayerModels::AccessPolicy PlayFab::MultiplayerModels::readAccessPolicyFrom
 
 MultiplayerModels::AccessPolicy PlayFab::MultiplayerModels::readAccessPolicyFromValue(const FString& value)
 {
-    static TMap<FString, AccessPolicy> _AccessPolicyMap;
-    if (_AccessPolicyMap.Num() == 0)
+    static const TMap<FString, AccessPolicy> _AccessPolicyMap = []()
     {
-        // Auto-generate the map on the first use
-        _AccessPolicyMap.Add(TEXT("Public"), AccessPolicyPublic);
-        _AccessPolicyMap.Add(TEXT("Friends"), AccessPolicyFriends);
-        _AccessPolicyMap.Add(TEXT("Private"), AccessPolicyPrivate);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, AccessPolicy> Map;
+        Map.Add(TEXT("Public"), AccessPolicyPublic);
+        Map.Add(TEXT("Friends"), AccessPolicyFriends);
+        Map.Add(TEXT("Private"), AccessPolicyPrivate);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -186,6 +187,7 @@ bool PlayFab::MultiplayerModels::FAssetSummary::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), It.Value()->AsString());
@@ -236,38 +238,38 @@ MultiplayerModels::AzureRegion PlayFab::MultiplayerModels::readAzureRegionFromVa
 
 MultiplayerModels::AzureRegion PlayFab::MultiplayerModels::readAzureRegionFromValue(const FString& value)
 {
-    static TMap<FString, AzureRegion> _AzureRegionMap;
-    if (_AzureRegionMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _AzureRegionMap.Add(TEXT("AustraliaEast"), AzureRegionAustraliaEast);
-        _AzureRegionMap.Add(TEXT("AustraliaSoutheast"), AzureRegionAustraliaSoutheast);
-        _AzureRegionMap.Add(TEXT("BrazilSouth"), AzureRegionBrazilSouth);
-        _AzureRegionMap.Add(TEXT("CentralUs"), AzureRegionCentralUs);
-        _AzureRegionMap.Add(TEXT("EastAsia"), AzureRegionEastAsia);
-        _AzureRegionMap.Add(TEXT("EastUs"), AzureRegionEastUs);
-        _AzureRegionMap.Add(TEXT("EastUs2"), AzureRegionEastUs2);
-        _AzureRegionMap.Add(TEXT("JapanEast"), AzureRegionJapanEast);
-        _AzureRegionMap.Add(TEXT("JapanWest"), AzureRegionJapanWest);
-        _AzureRegionMap.Add(TEXT("NorthCentralUs"), AzureRegionNorthCentralUs);
-        _AzureRegionMap.Add(TEXT("NorthEurope"), AzureRegionNorthEurope);
-        _AzureRegionMap.Add(TEXT("SouthCentralUs"), AzureRegionSouthCentralUs);
-        _AzureRegionMap.Add(TEXT("SoutheastAsia"), AzureRegionSoutheastAsia);
-        _AzureRegionMap.Add(TEXT("WestEurope"), AzureRegionWestEurope);
-        _AzureRegionMap.Add(TEXT("WestUs"), AzureRegionWestUs);
-        _AzureRegionMap.Add(TEXT("SouthAfricaNorth"), AzureRegionSouthAfricaNorth);
-        _AzureRegionMap.Add(TEXT("WestCentralUs"), AzureRegionWestCentralUs);
-        _AzureRegionMap.Add(TEXT("KoreaCentral"), AzureRegionKoreaCentral);
-        _AzureRegionMap.Add(TEXT("FranceCentral"), AzureRegionFranceCentral);
-        _AzureRegionMap.Add(TEXT("WestUs2"), AzureRegionWestUs2);
-        _AzureRegionMap.Add(TEXT("CentralIndia"), AzureRegionCentralIndia);
-        _AzureRegionMap.Add(TEXT("UaeNorth"), AzureRegionUaeNorth);
-        _AzureRegionMap.Add(TEXT("UkSouth"), AzureRegionUkSouth);
-        _AzureRegionMap.Add(TEXT("SwedenCentral"), AzureRegionSwedenCentral);
-        _AzureRegionMap.Add(TEXT("CanadaCentral"), AzureRegionCanadaCentral);
-        _AzureRegionMap.Add(TEXT("MexicoCentral"), AzureRegionMexicoCentral);
-
-    }
+    static const TMap<FString, AzureRegion> _AzureRegionMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, AzureRegion> Map;
+        Map.Add(TEXT("AustraliaEast"), AzureRegionAustraliaEast);
+        Map.Add(TEXT("AustraliaSoutheast"), AzureRegionAustraliaSoutheast);
+        Map.Add(TEXT("BrazilSouth"), AzureRegionBrazilSouth);
+        Map.Add(TEXT("CentralUs"), AzureRegionCentralUs);
+        Map.Add(TEXT("EastAsia"), AzureRegionEastAsia);
+        Map.Add(TEXT("EastUs"), AzureRegionEastUs);
+        Map.Add(TEXT("EastUs2"), AzureRegionEastUs2);
+        Map.Add(TEXT("JapanEast"), AzureRegionJapanEast);
+        Map.Add(TEXT("JapanWest"), AzureRegionJapanWest);
+        Map.Add(TEXT("NorthCentralUs"), AzureRegionNorthCentralUs);
+        Map.Add(TEXT("NorthEurope"), AzureRegionNorthEurope);
+        Map.Add(TEXT("SouthCentralUs"), AzureRegionSouthCentralUs);
+        Map.Add(TEXT("SoutheastAsia"), AzureRegionSoutheastAsia);
+        Map.Add(TEXT("WestEurope"), AzureRegionWestEurope);
+        Map.Add(TEXT("WestUs"), AzureRegionWestUs);
+        Map.Add(TEXT("SouthAfricaNorth"), AzureRegionSouthAfricaNorth);
+        Map.Add(TEXT("WestCentralUs"), AzureRegionWestCentralUs);
+        Map.Add(TEXT("KoreaCentral"), AzureRegionKoreaCentral);
+        Map.Add(TEXT("FranceCentral"), AzureRegionFranceCentral);
+        Map.Add(TEXT("WestUs2"), AzureRegionWestUs2);
+        Map.Add(TEXT("CentralIndia"), AzureRegionCentralIndia);
+        Map.Add(TEXT("UaeNorth"), AzureRegionUaeNorth);
+        Map.Add(TEXT("UkSouth"), AzureRegionUkSouth);
+        Map.Add(TEXT("SwedenCentral"), AzureRegionSwedenCentral);
+        Map.Add(TEXT("CanadaCentral"), AzureRegionCanadaCentral);
+        Map.Add(TEXT("MexicoCentral"), AzureRegionMexicoCentral);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -315,33 +317,33 @@ MultiplayerModels::AzureVmFamily PlayFab::MultiplayerModels::readAzureVmFamilyFr
 
 MultiplayerModels::AzureVmFamily PlayFab::MultiplayerModels::readAzureVmFamilyFromValue(const FString& value)
 {
-    static TMap<FString, AzureVmFamily> _AzureVmFamilyMap;
-    if (_AzureVmFamilyMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _AzureVmFamilyMap.Add(TEXT("A"), AzureVmFamilyA);
-        _AzureVmFamilyMap.Add(TEXT("Av2"), AzureVmFamilyAv2);
-        _AzureVmFamilyMap.Add(TEXT("Dv2"), AzureVmFamilyDv2);
-        _AzureVmFamilyMap.Add(TEXT("Dv3"), AzureVmFamilyDv3);
-        _AzureVmFamilyMap.Add(TEXT("F"), AzureVmFamilyF);
-        _AzureVmFamilyMap.Add(TEXT("Fsv2"), AzureVmFamilyFsv2);
-        _AzureVmFamilyMap.Add(TEXT("Dasv4"), AzureVmFamilyDasv4);
-        _AzureVmFamilyMap.Add(TEXT("Dav4"), AzureVmFamilyDav4);
-        _AzureVmFamilyMap.Add(TEXT("Dadsv5"), AzureVmFamilyDadsv5);
-        _AzureVmFamilyMap.Add(TEXT("Eav4"), AzureVmFamilyEav4);
-        _AzureVmFamilyMap.Add(TEXT("Easv4"), AzureVmFamilyEasv4);
-        _AzureVmFamilyMap.Add(TEXT("Ev4"), AzureVmFamilyEv4);
-        _AzureVmFamilyMap.Add(TEXT("Esv4"), AzureVmFamilyEsv4);
-        _AzureVmFamilyMap.Add(TEXT("Dsv3"), AzureVmFamilyDsv3);
-        _AzureVmFamilyMap.Add(TEXT("Dsv2"), AzureVmFamilyDsv2);
-        _AzureVmFamilyMap.Add(TEXT("NCasT4_v3"), AzureVmFamilyNCasT4_v3);
-        _AzureVmFamilyMap.Add(TEXT("Ddv4"), AzureVmFamilyDdv4);
-        _AzureVmFamilyMap.Add(TEXT("Ddsv4"), AzureVmFamilyDdsv4);
-        _AzureVmFamilyMap.Add(TEXT("HBv3"), AzureVmFamilyHBv3);
-        _AzureVmFamilyMap.Add(TEXT("Ddv5"), AzureVmFamilyDdv5);
-        _AzureVmFamilyMap.Add(TEXT("Ddsv5"), AzureVmFamilyDdsv5);
-
-    }
+    static const TMap<FString, AzureVmFamily> _AzureVmFamilyMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, AzureVmFamily> Map;
+        Map.Add(TEXT("A"), AzureVmFamilyA);
+        Map.Add(TEXT("Av2"), AzureVmFamilyAv2);
+        Map.Add(TEXT("Dv2"), AzureVmFamilyDv2);
+        Map.Add(TEXT("Dv3"), AzureVmFamilyDv3);
+        Map.Add(TEXT("F"), AzureVmFamilyF);
+        Map.Add(TEXT("Fsv2"), AzureVmFamilyFsv2);
+        Map.Add(TEXT("Dasv4"), AzureVmFamilyDasv4);
+        Map.Add(TEXT("Dav4"), AzureVmFamilyDav4);
+        Map.Add(TEXT("Dadsv5"), AzureVmFamilyDadsv5);
+        Map.Add(TEXT("Eav4"), AzureVmFamilyEav4);
+        Map.Add(TEXT("Easv4"), AzureVmFamilyEasv4);
+        Map.Add(TEXT("Ev4"), AzureVmFamilyEv4);
+        Map.Add(TEXT("Esv4"), AzureVmFamilyEsv4);
+        Map.Add(TEXT("Dsv3"), AzureVmFamilyDsv3);
+        Map.Add(TEXT("Dsv2"), AzureVmFamilyDsv2);
+        Map.Add(TEXT("NCasT4_v3"), AzureVmFamilyNCasT4_v3);
+        Map.Add(TEXT("Ddv4"), AzureVmFamilyDdv4);
+        Map.Add(TEXT("Ddsv4"), AzureVmFamilyDdsv4);
+        Map.Add(TEXT("HBv3"), AzureVmFamilyHBv3);
+        Map.Add(TEXT("Ddv5"), AzureVmFamilyDdv5);
+        Map.Add(TEXT("Ddsv5"), AzureVmFamilyDdsv5);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -447,91 +449,91 @@ MultiplayerModels::AzureVmSize PlayFab::MultiplayerModels::readAzureVmSizeFromVa
 
 MultiplayerModels::AzureVmSize PlayFab::MultiplayerModels::readAzureVmSizeFromValue(const FString& value)
 {
-    static TMap<FString, AzureVmSize> _AzureVmSizeMap;
-    if (_AzureVmSizeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _AzureVmSizeMap.Add(TEXT("Standard_A1"), AzureVmSizeStandard_A1);
-        _AzureVmSizeMap.Add(TEXT("Standard_A2"), AzureVmSizeStandard_A2);
-        _AzureVmSizeMap.Add(TEXT("Standard_A3"), AzureVmSizeStandard_A3);
-        _AzureVmSizeMap.Add(TEXT("Standard_A4"), AzureVmSizeStandard_A4);
-        _AzureVmSizeMap.Add(TEXT("Standard_A1_v2"), AzureVmSizeStandard_A1_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_A2_v2"), AzureVmSizeStandard_A2_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_A4_v2"), AzureVmSizeStandard_A4_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_A8_v2"), AzureVmSizeStandard_A8_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_D1_v2"), AzureVmSizeStandard_D1_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2_v2"), AzureVmSizeStandard_D2_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_D3_v2"), AzureVmSizeStandard_D3_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4_v2"), AzureVmSizeStandard_D4_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_D5_v2"), AzureVmSizeStandard_D5_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2_v3"), AzureVmSizeStandard_D2_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4_v3"), AzureVmSizeStandard_D4_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_D8_v3"), AzureVmSizeStandard_D8_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_D16_v3"), AzureVmSizeStandard_D16_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_F1"), AzureVmSizeStandard_F1);
-        _AzureVmSizeMap.Add(TEXT("Standard_F2"), AzureVmSizeStandard_F2);
-        _AzureVmSizeMap.Add(TEXT("Standard_F4"), AzureVmSizeStandard_F4);
-        _AzureVmSizeMap.Add(TEXT("Standard_F8"), AzureVmSizeStandard_F8);
-        _AzureVmSizeMap.Add(TEXT("Standard_F16"), AzureVmSizeStandard_F16);
-        _AzureVmSizeMap.Add(TEXT("Standard_F2s_v2"), AzureVmSizeStandard_F2s_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_F4s_v2"), AzureVmSizeStandard_F4s_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_F8s_v2"), AzureVmSizeStandard_F8s_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_F16s_v2"), AzureVmSizeStandard_F16s_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2as_v4"), AzureVmSizeStandard_D2as_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4as_v4"), AzureVmSizeStandard_D4as_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D8as_v4"), AzureVmSizeStandard_D8as_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D16as_v4"), AzureVmSizeStandard_D16as_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2a_v4"), AzureVmSizeStandard_D2a_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4a_v4"), AzureVmSizeStandard_D4a_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D8a_v4"), AzureVmSizeStandard_D8a_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D16a_v4"), AzureVmSizeStandard_D16a_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2ads_v5"), AzureVmSizeStandard_D2ads_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4ads_v5"), AzureVmSizeStandard_D4ads_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D8ads_v5"), AzureVmSizeStandard_D8ads_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D16ads_v5"), AzureVmSizeStandard_D16ads_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_E2a_v4"), AzureVmSizeStandard_E2a_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_E4a_v4"), AzureVmSizeStandard_E4a_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_E8a_v4"), AzureVmSizeStandard_E8a_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_E16a_v4"), AzureVmSizeStandard_E16a_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_E2as_v4"), AzureVmSizeStandard_E2as_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_E4as_v4"), AzureVmSizeStandard_E4as_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_E8as_v4"), AzureVmSizeStandard_E8as_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_E16as_v4"), AzureVmSizeStandard_E16as_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2s_v3"), AzureVmSizeStandard_D2s_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4s_v3"), AzureVmSizeStandard_D4s_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_D8s_v3"), AzureVmSizeStandard_D8s_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_D16s_v3"), AzureVmSizeStandard_D16s_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_DS1_v2"), AzureVmSizeStandard_DS1_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_DS2_v2"), AzureVmSizeStandard_DS2_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_DS3_v2"), AzureVmSizeStandard_DS3_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_DS4_v2"), AzureVmSizeStandard_DS4_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_DS5_v2"), AzureVmSizeStandard_DS5_v2);
-        _AzureVmSizeMap.Add(TEXT("Standard_NC4as_T4_v3"), AzureVmSizeStandard_NC4as_T4_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2d_v4"), AzureVmSizeStandard_D2d_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4d_v4"), AzureVmSizeStandard_D4d_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D8d_v4"), AzureVmSizeStandard_D8d_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D16d_v4"), AzureVmSizeStandard_D16d_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2ds_v4"), AzureVmSizeStandard_D2ds_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4ds_v4"), AzureVmSizeStandard_D4ds_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D8ds_v4"), AzureVmSizeStandard_D8ds_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_D16ds_v4"), AzureVmSizeStandard_D16ds_v4);
-        _AzureVmSizeMap.Add(TEXT("Standard_HB120_16rs_v3"), AzureVmSizeStandard_HB120_16rs_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_HB120_32rs_v3"), AzureVmSizeStandard_HB120_32rs_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_HB120_64rs_v3"), AzureVmSizeStandard_HB120_64rs_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_HB120_96rs_v3"), AzureVmSizeStandard_HB120_96rs_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_HB120rs_v3"), AzureVmSizeStandard_HB120rs_v3);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2d_v5"), AzureVmSizeStandard_D2d_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4d_v5"), AzureVmSizeStandard_D4d_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D8d_v5"), AzureVmSizeStandard_D8d_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D16d_v5"), AzureVmSizeStandard_D16d_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D32d_v5"), AzureVmSizeStandard_D32d_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D2ds_v5"), AzureVmSizeStandard_D2ds_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D4ds_v5"), AzureVmSizeStandard_D4ds_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D8ds_v5"), AzureVmSizeStandard_D8ds_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D16ds_v5"), AzureVmSizeStandard_D16ds_v5);
-        _AzureVmSizeMap.Add(TEXT("Standard_D32ds_v5"), AzureVmSizeStandard_D32ds_v5);
-
-    }
+    static const TMap<FString, AzureVmSize> _AzureVmSizeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, AzureVmSize> Map;
+        Map.Add(TEXT("Standard_A1"), AzureVmSizeStandard_A1);
+        Map.Add(TEXT("Standard_A2"), AzureVmSizeStandard_A2);
+        Map.Add(TEXT("Standard_A3"), AzureVmSizeStandard_A3);
+        Map.Add(TEXT("Standard_A4"), AzureVmSizeStandard_A4);
+        Map.Add(TEXT("Standard_A1_v2"), AzureVmSizeStandard_A1_v2);
+        Map.Add(TEXT("Standard_A2_v2"), AzureVmSizeStandard_A2_v2);
+        Map.Add(TEXT("Standard_A4_v2"), AzureVmSizeStandard_A4_v2);
+        Map.Add(TEXT("Standard_A8_v2"), AzureVmSizeStandard_A8_v2);
+        Map.Add(TEXT("Standard_D1_v2"), AzureVmSizeStandard_D1_v2);
+        Map.Add(TEXT("Standard_D2_v2"), AzureVmSizeStandard_D2_v2);
+        Map.Add(TEXT("Standard_D3_v2"), AzureVmSizeStandard_D3_v2);
+        Map.Add(TEXT("Standard_D4_v2"), AzureVmSizeStandard_D4_v2);
+        Map.Add(TEXT("Standard_D5_v2"), AzureVmSizeStandard_D5_v2);
+        Map.Add(TEXT("Standard_D2_v3"), AzureVmSizeStandard_D2_v3);
+        Map.Add(TEXT("Standard_D4_v3"), AzureVmSizeStandard_D4_v3);
+        Map.Add(TEXT("Standard_D8_v3"), AzureVmSizeStandard_D8_v3);
+        Map.Add(TEXT("Standard_D16_v3"), AzureVmSizeStandard_D16_v3);
+        Map.Add(TEXT("Standard_F1"), AzureVmSizeStandard_F1);
+        Map.Add(TEXT("Standard_F2"), AzureVmSizeStandard_F2);
+        Map.Add(TEXT("Standard_F4"), AzureVmSizeStandard_F4);
+        Map.Add(TEXT("Standard_F8"), AzureVmSizeStandard_F8);
+        Map.Add(TEXT("Standard_F16"), AzureVmSizeStandard_F16);
+        Map.Add(TEXT("Standard_F2s_v2"), AzureVmSizeStandard_F2s_v2);
+        Map.Add(TEXT("Standard_F4s_v2"), AzureVmSizeStandard_F4s_v2);
+        Map.Add(TEXT("Standard_F8s_v2"), AzureVmSizeStandard_F8s_v2);
+        Map.Add(TEXT("Standard_F16s_v2"), AzureVmSizeStandard_F16s_v2);
+        Map.Add(TEXT("Standard_D2as_v4"), AzureVmSizeStandard_D2as_v4);
+        Map.Add(TEXT("Standard_D4as_v4"), AzureVmSizeStandard_D4as_v4);
+        Map.Add(TEXT("Standard_D8as_v4"), AzureVmSizeStandard_D8as_v4);
+        Map.Add(TEXT("Standard_D16as_v4"), AzureVmSizeStandard_D16as_v4);
+        Map.Add(TEXT("Standard_D2a_v4"), AzureVmSizeStandard_D2a_v4);
+        Map.Add(TEXT("Standard_D4a_v4"), AzureVmSizeStandard_D4a_v4);
+        Map.Add(TEXT("Standard_D8a_v4"), AzureVmSizeStandard_D8a_v4);
+        Map.Add(TEXT("Standard_D16a_v4"), AzureVmSizeStandard_D16a_v4);
+        Map.Add(TEXT("Standard_D2ads_v5"), AzureVmSizeStandard_D2ads_v5);
+        Map.Add(TEXT("Standard_D4ads_v5"), AzureVmSizeStandard_D4ads_v5);
+        Map.Add(TEXT("Standard_D8ads_v5"), AzureVmSizeStandard_D8ads_v5);
+        Map.Add(TEXT("Standard_D16ads_v5"), AzureVmSizeStandard_D16ads_v5);
+        Map.Add(TEXT("Standard_E2a_v4"), AzureVmSizeStandard_E2a_v4);
+        Map.Add(TEXT("Standard_E4a_v4"), AzureVmSizeStandard_E4a_v4);
+        Map.Add(TEXT("Standard_E8a_v4"), AzureVmSizeStandard_E8a_v4);
+        Map.Add(TEXT("Standard_E16a_v4"), AzureVmSizeStandard_E16a_v4);
+        Map.Add(TEXT("Standard_E2as_v4"), AzureVmSizeStandard_E2as_v4);
+        Map.Add(TEXT("Standard_E4as_v4"), AzureVmSizeStandard_E4as_v4);
+        Map.Add(TEXT("Standard_E8as_v4"), AzureVmSizeStandard_E8as_v4);
+        Map.Add(TEXT("Standard_E16as_v4"), AzureVmSizeStandard_E16as_v4);
+        Map.Add(TEXT("Standard_D2s_v3"), AzureVmSizeStandard_D2s_v3);
+        Map.Add(TEXT("Standard_D4s_v3"), AzureVmSizeStandard_D4s_v3);
+        Map.Add(TEXT("Standard_D8s_v3"), AzureVmSizeStandard_D8s_v3);
+        Map.Add(TEXT("Standard_D16s_v3"), AzureVmSizeStandard_D16s_v3);
+        Map.Add(TEXT("Standard_DS1_v2"), AzureVmSizeStandard_DS1_v2);
+        Map.Add(TEXT("Standard_DS2_v2"), AzureVmSizeStandard_DS2_v2);
+        Map.Add(TEXT("Standard_DS3_v2"), AzureVmSizeStandard_DS3_v2);
+        Map.Add(TEXT("Standard_DS4_v2"), AzureVmSizeStandard_DS4_v2);
+        Map.Add(TEXT("Standard_DS5_v2"), AzureVmSizeStandard_DS5_v2);
+        Map.Add(TEXT("Standard_NC4as_T4_v3"), AzureVmSizeStandard_NC4as_T4_v3);
+        Map.Add(TEXT("Standard_D2d_v4"), AzureVmSizeStandard_D2d_v4);
+        Map.Add(TEXT("Standard_D4d_v4"), AzureVmSizeStandard_D4d_v4);
+        Map.Add(TEXT("Standard_D8d_v4"), AzureVmSizeStandard_D8d_v4);
+        Map.Add(TEXT("Standard_D16d_v4"), AzureVmSizeStandard_D16d_v4);
+        Map.Add(TEXT("Standard_D2ds_v4"), AzureVmSizeStandard_D2ds_v4);
+        Map.Add(TEXT("Standard_D4ds_v4"), AzureVmSizeStandard_D4ds_v4);
+        Map.Add(TEXT("Standard_D8ds_v4"), AzureVmSizeStandard_D8ds_v4);
+        Map.Add(TEXT("Standard_D16ds_v4"), AzureVmSizeStandard_D16ds_v4);
+        Map.Add(TEXT("Standard_HB120_16rs_v3"), AzureVmSizeStandard_HB120_16rs_v3);
+        Map.Add(TEXT("Standard_HB120_32rs_v3"), AzureVmSizeStandard_HB120_32rs_v3);
+        Map.Add(TEXT("Standard_HB120_64rs_v3"), AzureVmSizeStandard_HB120_64rs_v3);
+        Map.Add(TEXT("Standard_HB120_96rs_v3"), AzureVmSizeStandard_HB120_96rs_v3);
+        Map.Add(TEXT("Standard_HB120rs_v3"), AzureVmSizeStandard_HB120rs_v3);
+        Map.Add(TEXT("Standard_D2d_v5"), AzureVmSizeStandard_D2d_v5);
+        Map.Add(TEXT("Standard_D4d_v5"), AzureVmSizeStandard_D4d_v5);
+        Map.Add(TEXT("Standard_D8d_v5"), AzureVmSizeStandard_D8d_v5);
+        Map.Add(TEXT("Standard_D16d_v5"), AzureVmSizeStandard_D16d_v5);
+        Map.Add(TEXT("Standard_D32d_v5"), AzureVmSizeStandard_D32d_v5);
+        Map.Add(TEXT("Standard_D2ds_v5"), AzureVmSizeStandard_D2ds_v5);
+        Map.Add(TEXT("Standard_D4ds_v5"), AzureVmSizeStandard_D4ds_v5);
+        Map.Add(TEXT("Standard_D8ds_v5"), AzureVmSizeStandard_D8ds_v5);
+        Map.Add(TEXT("Standard_D16ds_v5"), AzureVmSizeStandard_D16ds_v5);
+        Map.Add(TEXT("Standard_D32ds_v5"), AzureVmSizeStandard_D32ds_v5);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -635,11 +637,7 @@ bool PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::readFromValue(const
     }
 
     const TArray<TSharedPtr<FJsonValue>>&BuildSelectionCriteriaArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BuildSelectionCriteria"));
-    for (int32 Idx = 0; Idx < BuildSelectionCriteriaArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BuildSelectionCriteriaArray[Idx];
-        BuildSelectionCriteria.Add(FBuildSelectionCriterion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BuildSelectionCriteriaArray, BuildSelectionCriteria);
 
 
     return HasSucceeded;
@@ -814,11 +812,7 @@ bool PlayFab::MultiplayerModels::FDynamicStandbySettings::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DynamicFloorMultiplierThresholdsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("DynamicFloorMultiplierThresholds"));
-    for (int32 Idx = 0; Idx < DynamicFloorMultiplierThresholdsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DynamicFloorMultiplierThresholdsArray[Idx];
-        DynamicFloorMultiplierThresholds.Add(FDynamicStandbyThreshold(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DynamicFloorMultiplierThresholdsArray, DynamicFloorMultiplierThresholds);
 
 
     const TSharedPtr<FJsonValue> IsEnabledValue = obj->TryGetField(TEXT("IsEnabled"));
@@ -952,11 +946,7 @@ bool PlayFab::MultiplayerModels::FScheduledStandbySettings::readFromValue(const
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ScheduleListArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ScheduleList"));
-    for (int32 Idx = 0; Idx < ScheduleListArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ScheduleListArray[Idx];
-        ScheduleList.Add(FSchedule(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ScheduleListArray, ScheduleList);
 
 
     return HasSucceeded;
@@ -1276,6 +1266,7 @@ bool PlayFab::MultiplayerModels::FBuildSummary::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), It.Value()->AsString());
@@ -1283,11 +1274,7 @@ bool PlayFab::MultiplayerModels::FBuildSummary::readFromValue(const TSharedPtr<F
     }
 
     const TArray<TSharedPtr<FJsonValue>>&RegionConfigurationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("RegionConfigurations"));
-    for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RegionConfigurationsArray, RegionConfigurations);
 
 
     return HasSucceeded;
@@ -1309,7 +1296,7 @@ void PlayFab::MultiplayerModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -1389,6 +1376,7 @@ bool PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::r
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1473,6 +1461,7 @@ bool PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1532,15 +1521,15 @@ MultiplayerModels::CancellationReason PlayFab::MultiplayerModels::readCancellati
 
 MultiplayerModels::CancellationReason PlayFab::MultiplayerModels::readCancellationReasonFromValue(const FString& value)
 {
-    static TMap<FString, CancellationReason> _CancellationReasonMap;
-    if (_CancellationReasonMap.Num() == 0)
+    static const TMap<FString, CancellationReason> _CancellationReasonMap = []()
     {
-        // Auto-generate the map on the first use
-        _CancellationReasonMap.Add(TEXT("Requested"), CancellationReasonRequested);
-        _CancellationReasonMap.Add(TEXT("Internal"), CancellationReasonInternal);
-        _CancellationReasonMap.Add(TEXT("Timeout"), CancellationReasonTimeout);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, CancellationReason> Map;
+        Map.Add(TEXT("Requested"), CancellationReasonRequested);
+        Map.Add(TEXT("Internal"), CancellationReasonInternal);
+        Map.Add(TEXT("Timeout"), CancellationReasonTimeout);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1602,6 +1591,7 @@ bool PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1694,6 +1684,7 @@ bool PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1898,16 +1889,16 @@ MultiplayerModels::ContainerFlavor PlayFab::MultiplayerModels::readContainerFlav
 
 MultiplayerModels::ContainerFlavor PlayFab::MultiplayerModels::readContainerFlavorFromValue(const FString& value)
 {
-    static TMap<FString, ContainerFlavor> _ContainerFlavorMap;
-    if (_ContainerFlavorMap.Num() == 0)
+    static const TMap<FString, ContainerFlavor> _ContainerFlavorMap = []()
     {
-        // Auto-generate the map on the first use
-        _ContainerFlavorMap.Add(TEXT("ManagedWindowsServerCore"), ContainerFlavorManagedWindowsServerCore);
-        _ContainerFlavorMap.Add(TEXT("CustomLinux"), ContainerFlavorCustomLinux);
-        _ContainerFlavorMap.Add(TEXT("ManagedWindowsServerCorePreview"), ContainerFlavorManagedWindowsServerCorePreview);
-        _ContainerFlavorMap.Add(TEXT("Invalid"), ContainerFlavorInvalid);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ContainerFlavor> Map;
+        Map.Add(TEXT("ManagedWindowsServerCore"), ContainerFlavorManagedWindowsServerCore);
+        Map.Add(TEXT("CustomLinux"), ContainerFlavorCustomLinux);
+        Map.Add(TEXT("ManagedWindowsServerCorePreview"), ContainerFlavorManagedWindowsServerCorePreview);
+        Map.Add(TEXT("Invalid"), ContainerFlavorInvalid);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2133,16 +2124,13 @@ bool PlayFab::MultiplayerModels::FCreateBuildAliasRequest::readFromValue(const T
     }
 
     const TArray<TSharedPtr<FJsonValue>>&BuildSelectionCriteriaArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BuildSelectionCriteria"));
-    for (int32 Idx = 0; Idx < BuildSelectionCriteriaArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BuildSelectionCriteriaArray[Idx];
-        BuildSelectionCriteria.Add(FBuildSelectionCriterion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BuildSelectionCriteriaArray, BuildSelectionCriteria);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2358,14 +2346,14 @@ MultiplayerModels::ProtocolType PlayFab::MultiplayerModels::readProtocolTypeFrom
 
 MultiplayerModels::ProtocolType PlayFab::MultiplayerModels::readProtocolTypeFromValue(const FString& value)
 {
-    static TMap<FString, ProtocolType> _ProtocolTypeMap;
-    if (_ProtocolTypeMap.Num() == 0)
+    static const TMap<FString, ProtocolType> _ProtocolTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _ProtocolTypeMap.Add(TEXT("TCP"), ProtocolTypeTCP);
-        _ProtocolTypeMap.Add(TEXT("UDP"), ProtocolTypeUDP);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ProtocolType> Map;
+        Map.Add(TEXT("TCP"), ProtocolTypeTCP);
+        Map.Add(TEXT("UDP"), ProtocolTypeUDP);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2537,11 +2525,7 @@ bool PlayFab::MultiplayerModels::FVmStartupScriptParams::readFromValue(const TSh
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&PortRequestsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PortRequests"));
-    for (int32 Idx = 0; Idx < PortRequestsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortRequestsArray[Idx];
-        PortRequests.Add(FVmStartupScriptPortRequestParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortRequestsArray, PortRequests);
 
 
     const TSharedPtr<FJsonValue> VmStartupScriptAssetReferenceValue = obj->TryGetField(TEXT("VmStartupScriptAssetReference"));
@@ -2734,6 +2718,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2741,27 +2726,15 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     }
 
     const TArray<TSharedPtr<FJsonValue>>&GameAssetReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameAssetReferences"));
-    for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReferenceParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameAssetReferencesArray, GameAssetReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameCertificateReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameCertificateReferences"));
-    for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReferenceParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameCertificateReferencesArray, GameCertificateReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameSecretReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameSecretReferences"));
-    for (int32 Idx = 0; Idx < GameSecretReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameSecretReferencesArray[Idx];
-        GameSecretReferences.Add(FGameSecretReferenceParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameSecretReferencesArray, GameSecretReferences);
 
 
     const TSharedPtr<FJsonValue> LinuxInstrumentationConfigurationValue = obj->TryGetField(TEXT("LinuxInstrumentationConfiguration"));
@@ -2773,6 +2746,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), It.Value()->AsString());
@@ -2793,19 +2767,11 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TArray<TSharedPtr<FJsonValue>>&RegionConfigurationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("RegionConfigurations"));
-    for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegionParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RegionConfigurationsArray, RegionConfigurations);
 
 
     const TSharedPtr<FJsonValue> ServerResourceConstraintsValue = obj->TryGetField(TEXT("ServerResourceConstraints"));
@@ -3043,11 +3009,7 @@ bool PlayFab::MultiplayerModels::FVmStartupScriptConfiguration::readFromValue(co
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&PortRequestsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PortRequests"));
-    for (int32 Idx = 0; Idx < PortRequestsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortRequestsArray[Idx];
-        PortRequests.Add(FVmStartupScriptPortRequest(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortRequestsArray, PortRequests);
 
 
     const TSharedPtr<FJsonValue> VmStartupScriptAssetReferenceValue = obj->TryGetField(TEXT("VmStartupScriptAssetReference"));
@@ -3271,27 +3233,15 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFr
     }
 
     const TArray<TSharedPtr<FJsonValue>>&GameAssetReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameAssetReferences"));
-    for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameAssetReferencesArray, GameAssetReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameCertificateReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameCertificateReferences"));
-    for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameCertificateReferencesArray, GameCertificateReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameSecretReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameSecretReferences"));
-    for (int32 Idx = 0; Idx < GameSecretReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameSecretReferencesArray[Idx];
-        GameSecretReferences.Add(FGameSecretReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameSecretReferencesArray, GameSecretReferences);
 
 
     const TSharedPtr<FJsonValue> LinuxInstrumentationConfigurationValue = obj->TryGetField(TEXT("LinuxInstrumentationConfiguration"));
@@ -3303,6 +3253,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFr
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), It.Value()->AsString());
@@ -3330,19 +3281,11 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFr
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TArray<TSharedPtr<FJsonValue>>&RegionConfigurationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("RegionConfigurations"));
-    for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RegionConfigurationsArray, RegionConfigurations);
 
 
     const TSharedPtr<FJsonValue> ServerResourceConstraintsValue = obj->TryGetField(TEXT("ServerResourceConstraints"));
@@ -3649,6 +3592,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3656,27 +3600,15 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     }
 
     const TArray<TSharedPtr<FJsonValue>>&GameAssetReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameAssetReferences"));
-    for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReferenceParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameAssetReferencesArray, GameAssetReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameCertificateReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameCertificateReferences"));
-    for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReferenceParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameCertificateReferencesArray, GameCertificateReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameSecretReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameSecretReferences"));
-    for (int32 Idx = 0; Idx < GameSecretReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameSecretReferencesArray[Idx];
-        GameSecretReferences.Add(FGameSecretReferenceParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameSecretReferencesArray, GameSecretReferences);
 
 
     const TSharedPtr<FJsonValue> GameWorkingDirectoryValue = obj->TryGetField(TEXT("GameWorkingDirectory"));
@@ -3695,6 +3627,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), It.Value()->AsString());
@@ -3715,19 +3648,11 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TArray<TSharedPtr<FJsonValue>>&RegionConfigurationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("RegionConfigurations"));
-    for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegionParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RegionConfigurationsArray, RegionConfigurations);
 
 
     const TSharedPtr<FJsonValue> ServerResourceConstraintsValue = obj->TryGetField(TEXT("ServerResourceConstraints"));
@@ -3958,27 +3883,15 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameAssetReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameAssetReferences"));
-    for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameAssetReferencesArray, GameAssetReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameCertificateReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameCertificateReferences"));
-    for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameCertificateReferencesArray, GameCertificateReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameSecretReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameSecretReferences"));
-    for (int32 Idx = 0; Idx < GameSecretReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameSecretReferencesArray[Idx];
-        GameSecretReferences.Add(FGameSecretReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameSecretReferencesArray, GameSecretReferences);
 
 
     const TSharedPtr<FJsonValue> GameWorkingDirectoryValue = obj->TryGetField(TEXT("GameWorkingDirectory"));
@@ -3997,6 +3910,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), It.Value()->AsString());
@@ -4024,19 +3938,11 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TArray<TSharedPtr<FJsonValue>>&RegionConfigurationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("RegionConfigurations"));
-    for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RegionConfigurationsArray, RegionConfigurations);
 
 
     const TSharedPtr<FJsonValue> ServerResourceConstraintsValue = obj->TryGetField(TEXT("ServerResourceConstraints"));
@@ -4249,6 +4155,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4256,27 +4163,15 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     }
 
     const TArray<TSharedPtr<FJsonValue>>&GameAssetReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameAssetReferences"));
-    for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReferenceParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameAssetReferencesArray, GameAssetReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameCertificateReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameCertificateReferences"));
-    for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReferenceParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameCertificateReferencesArray, GameCertificateReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameSecretReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameSecretReferences"));
-    for (int32 Idx = 0; Idx < GameSecretReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameSecretReferencesArray[Idx];
-        GameSecretReferences.Add(FGameSecretReferenceParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameSecretReferencesArray, GameSecretReferences);
 
 
     const TSharedPtr<FJsonValue> GameWorkingDirectoryValue = obj->TryGetField(TEXT("GameWorkingDirectory"));
@@ -4308,6 +4203,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), It.Value()->AsString());
@@ -4335,19 +4231,11 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TArray<TSharedPtr<FJsonValue>>&RegionConfigurationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("RegionConfigurations"));
-    for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegionParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RegionConfigurationsArray, RegionConfigurations);
 
 
     const TSharedPtr<FJsonValue> StartMultiplayerServerCommandValue = obj->TryGetField(TEXT("StartMultiplayerServerCommand"));
@@ -4572,27 +4460,15 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameAssetReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameAssetReferences"));
-    for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameAssetReferencesArray, GameAssetReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameCertificateReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameCertificateReferences"));
-    for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameCertificateReferencesArray, GameCertificateReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameSecretReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameSecretReferences"));
-    for (int32 Idx = 0; Idx < GameSecretReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameSecretReferencesArray[Idx];
-        GameSecretReferences.Add(FGameSecretReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameSecretReferencesArray, GameSecretReferences);
 
 
     const TSharedPtr<FJsonValue> GameWorkingDirectoryValue = obj->TryGetField(TEXT("GameWorkingDirectory"));
@@ -4624,6 +4500,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), It.Value()->AsString());
@@ -4651,19 +4528,11 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TArray<TSharedPtr<FJsonValue>>&RegionConfigurationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("RegionConfigurations"));
-    for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RegionConfigurationsArray, RegionConfigurations);
 
 
     const TSharedPtr<FJsonValue> ServerTypeValue = obj->TryGetField(TEXT("ServerType"));
@@ -4741,6 +4610,7 @@ bool PlayFab::MultiplayerModels::FMember::readFromValue(const TSharedPtr<FJsonOb
     const TSharedPtr<FJsonObject>* MemberDataObject;
     if (obj->TryGetObjectField(TEXT("MemberData"), MemberDataObject))
     {
+        MemberData.Reserve((*MemberDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MemberDataObject)->Values); It; ++It)
         {
             MemberData.Add(It.Key(), It.Value()->AsString());
@@ -4782,16 +4652,16 @@ MultiplayerModels::OwnerMigrationPolicy PlayFab::MultiplayerModels::readOwnerMig
 
 MultiplayerModels::OwnerMigrationPolicy PlayFab::MultiplayerModels::readOwnerMigrationPolicyFromValue(const FString& value)
 {
-    static TMap<FString, OwnerMigrationPolicy> _OwnerMigrationPolicyMap;
-    if (_OwnerMigrationPolicyMap.Num() == 0)
+    static const TMap<FString, OwnerMigrationPolicy> _OwnerMigrationPolicyMap = []()
     {
-        // Auto-generate the map on the first use
-        _OwnerMigrationPolicyMap.Add(TEXT("None"), OwnerMigrationPolicyNone);
-        _OwnerMigrationPolicyMap.Add(TEXT("Automatic"), OwnerMigrationPolicyAutomatic);
-        _OwnerMigrationPolicyMap.Add(TEXT("Manual"), OwnerMigrationPolicyManual);
-        _OwnerMigrationPolicyMap.Add(TEXT("Server"), OwnerMigrationPolicyServer);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, OwnerMigrationPolicy> Map;
+        Map.Add(TEXT("None"), OwnerMigrationPolicyNone);
+        Map.Add(TEXT("Automatic"), OwnerMigrationPolicyAutomatic);
+        Map.Add(TEXT("Manual"), OwnerMigrationPolicyManual);
+        Map.Add(TEXT("Server"), OwnerMigrationPolicyServer);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -4887,6 +4757,7 @@ bool PlayFab::MultiplayerModels::FCreateLobbyRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4896,6 +4767,7 @@ bool PlayFab::MultiplayerModels::FCreateLobbyRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* LobbyDataObject;
     if (obj->TryGetObjectField(TEXT("LobbyData"), LobbyDataObject))
     {
+        LobbyData.Reserve((*LobbyDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LobbyDataObject)->Values); It; ++It)
         {
             LobbyData.Add(It.Key(), It.Value()->AsString());
@@ -4910,11 +4782,7 @@ bool PlayFab::MultiplayerModels::FCreateLobbyRequest::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMember(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     const TSharedPtr<FJsonValue> OwnerValue = obj->TryGetField(TEXT("Owner"));
@@ -4928,6 +4796,7 @@ bool PlayFab::MultiplayerModels::FCreateLobbyRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* SearchDataObject;
     if (obj->TryGetObjectField(TEXT("SearchData"), SearchDataObject))
     {
+        SearchData.Reserve((*SearchDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*SearchDataObject)->Values); It; ++It)
         {
             SearchData.Add(It.Key(), It.Value()->AsString());
@@ -5143,6 +5012,7 @@ bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5157,11 +5027,7 @@ bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::readFromValue(
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersToMatchWithArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("MembersToMatchWith"));
-    for (int32 Idx = 0; Idx < MembersToMatchWithArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersToMatchWithArray[Idx];
-        MembersToMatchWith.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersToMatchWithArray, MembersToMatchWith);
 
 
     const TSharedPtr<FJsonValue> QueueNameValue = obj->TryGetField(TEXT("QueueName"));
@@ -5293,6 +5159,7 @@ bool PlayFab::MultiplayerModels::FCreateRemoteUserRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5502,11 +5369,7 @@ bool PlayFab::MultiplayerModels::FServerDetails::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TSharedPtr<FJsonValue> RegionValue = obj->TryGetField(TEXT("Region"));
@@ -5582,6 +5445,7 @@ bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5596,11 +5460,7 @@ bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::readFromVal
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayerWithTeamAssignment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     const TSharedPtr<FJsonValue> QueueNameValue = obj->TryGetField(TEXT("QueueName"));
@@ -5704,6 +5564,7 @@ bool PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::readFrom
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5718,11 +5579,7 @@ bool PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::readFrom
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayer(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     const TSharedPtr<FJsonValue> QueueNameValue = obj->TryGetField(TEXT("QueueName"));
@@ -5800,11 +5657,7 @@ bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeReques
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ChangesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Changes"));
-    for (int32 Idx = 0; Idx < ChangesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ChangesArray[Idx];
-        Changes.Add(FCoreCapacityChange(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ChangesArray, Changes);
 
 
     const TSharedPtr<FJsonValue> ContactEmailValue = obj->TryGetField(TEXT("ContactEmail"));
@@ -5817,6 +5670,7 @@ bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeReques
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5920,6 +5774,7 @@ bool PlayFab::MultiplayerModels::FDeleteAssetRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5983,6 +5838,7 @@ bool PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6049,6 +5905,7 @@ bool PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6112,6 +5969,7 @@ bool PlayFab::MultiplayerModels::FDeleteBuildRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6161,6 +6019,7 @@ bool PlayFab::MultiplayerModels::FDeleteCertificateRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6213,6 +6072,7 @@ bool PlayFab::MultiplayerModels::FDeleteContainerImageRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6265,6 +6125,7 @@ bool PlayFab::MultiplayerModels::FDeleteLobbyRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6358,6 +6219,7 @@ bool PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6428,6 +6290,7 @@ bool PlayFab::MultiplayerModels::FDeleteSecretRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6468,21 +6331,21 @@ MultiplayerModels::DirectPeerConnectivityOptions PlayFab::MultiplayerModels::rea
 
 MultiplayerModels::DirectPeerConnectivityOptions PlayFab::MultiplayerModels::readDirectPeerConnectivityOptionsFromValue(const FString& value)
 {
-    static TMap<FString, DirectPeerConnectivityOptions> _DirectPeerConnectivityOptionsMap;
-    if (_DirectPeerConnectivityOptionsMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _DirectPeerConnectivityOptionsMap.Add(TEXT("None"), DirectPeerConnectivityOptionsNone);
-        _DirectPeerConnectivityOptionsMap.Add(TEXT("SamePlatformType"), DirectPeerConnectivityOptionsSamePlatformType);
-        _DirectPeerConnectivityOptionsMap.Add(TEXT("DifferentPlatformType"), DirectPeerConnectivityOptionsDifferentPlatformType);
-        _DirectPeerConnectivityOptionsMap.Add(TEXT("AnyPlatformType"), DirectPeerConnectivityOptionsAnyPlatformType);
-        _DirectPeerConnectivityOptionsMap.Add(TEXT("SameEntityLoginProvider"), DirectPeerConnectivityOptionsSameEntityLoginProvider);
-        _DirectPeerConnectivityOptionsMap.Add(TEXT("DifferentEntityLoginProvider"), DirectPeerConnectivityOptionsDifferentEntityLoginProvider);
-        _DirectPeerConnectivityOptionsMap.Add(TEXT("AnyEntityLoginProvider"), DirectPeerConnectivityOptionsAnyEntityLoginProvider);
-        _DirectPeerConnectivityOptionsMap.Add(TEXT("AnyPlatformTypeAndEntityLoginProvider"), DirectPeerConnectivityOptionsAnyPlatformTypeAndEntityLoginProvider);
-        _DirectPeerConnectivityOptionsMap.Add(TEXT("OnlyServers"), DirectPeerConnectivityOptionsOnlyServers);
-
-    }
+    static const TMap<FString, DirectPeerConnectivityOptions> _DirectPeerConnectivityOptionsMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, DirectPeerConnectivityOptions> Map;
+        Map.Add(TEXT("None"), DirectPeerConnectivityOptionsNone);
+        Map.Add(TEXT("SamePlatformType"), DirectPeerConnectivityOptionsSamePlatformType);
+        Map.Add(TEXT("DifferentPlatformType"), DirectPeerConnectivityOptionsDifferentPlatformType);
+        Map.Add(TEXT("AnyPlatformType"), DirectPeerConnectivityOptionsAnyPlatformType);
+        Map.Add(TEXT("SameEntityLoginProvider"), DirectPeerConnectivityOptionsSameEntityLoginProvider);
+        Map.Add(TEXT("DifferentEntityLoginProvider"), DirectPeerConnectivityOptionsDifferentEntityLoginProvider);
+        Map.Add(TEXT("AnyEntityLoginProvider"), DirectPeerConnectivityOptionsAnyEntityLoginProvider);
+        Map.Add(TEXT("AnyPlatformTypeAndEntityLoginProvider"), DirectPeerConnectivityOptionsAnyPlatformTypeAndEntityLoginProvider);
+        Map.Add(TEXT("OnlyServers"), DirectPeerConnectivityOptionsOnlyServers);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6543,6 +6406,7 @@ bool PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::readF
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6570,15 +6434,15 @@ MultiplayerModels::TitleMultiplayerServerEnabledStatus PlayFab::MultiplayerModel
 
 MultiplayerModels::TitleMultiplayerServerEnabledStatus PlayFab::MultiplayerModels::readTitleMultiplayerServerEnabledStatusFromValue(const FString& value)
 {
-    static TMap<FString, TitleMultiplayerServerEnabledStatus> _TitleMultiplayerServerEnabledStatusMap;
-    if (_TitleMultiplayerServerEnabledStatusMap.Num() == 0)
+    static const TMap<FString, TitleMultiplayerServerEnabledStatus> _TitleMultiplayerServerEnabledStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _TitleMultiplayerServerEnabledStatusMap.Add(TEXT("Initializing"), TitleMultiplayerServerEnabledStatusInitializing);
-        _TitleMultiplayerServerEnabledStatusMap.Add(TEXT("Enabled"), TitleMultiplayerServerEnabledStatusEnabled);
-        _TitleMultiplayerServerEnabledStatusMap.Add(TEXT("Disabled"), TitleMultiplayerServerEnabledStatusDisabled);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, TitleMultiplayerServerEnabledStatus> Map;
+        Map.Add(TEXT("Initializing"), TitleMultiplayerServerEnabledStatusInitializing);
+        Map.Add(TEXT("Enabled"), TitleMultiplayerServerEnabledStatusEnabled);
+        Map.Add(TEXT("Disabled"), TitleMultiplayerServerEnabledStatusDisabled);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6638,18 +6502,18 @@ MultiplayerModels::ExternalFriendSources PlayFab::MultiplayerModels::readExterna
 
 MultiplayerModels::ExternalFriendSources PlayFab::MultiplayerModels::readExternalFriendSourcesFromValue(const FString& value)
 {
-    static TMap<FString, ExternalFriendSources> _ExternalFriendSourcesMap;
-    if (_ExternalFriendSourcesMap.Num() == 0)
+    static const TMap<FString, ExternalFriendSources> _ExternalFriendSourcesMap = []()
     {
-        // Auto-generate the map on the first use
-        _ExternalFriendSourcesMap.Add(TEXT("None"), ExternalFriendSourcesNone);
-        _ExternalFriendSourcesMap.Add(TEXT("Steam"), ExternalFriendSourcesSteam);
-        _ExternalFriendSourcesMap.Add(TEXT("Facebook"), ExternalFriendSourcesFacebook);
-        _ExternalFriendSourcesMap.Add(TEXT("Xbox"), ExternalFriendSourcesXbox);
-        _ExternalFriendSourcesMap.Add(TEXT("Psn"), ExternalFriendSourcesPsn);
-        _ExternalFriendSourcesMap.Add(TEXT("All"), ExternalFriendSourcesAll);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ExternalFriendSources> Map;
+        Map.Add(TEXT("None"), ExternalFriendSourcesNone);
+        Map.Add(TEXT("Steam"), ExternalFriendSourcesSteam);
+        Map.Add(TEXT("Facebook"), ExternalFriendSourcesFacebook);
+        Map.Add(TEXT("Xbox"), ExternalFriendSourcesXbox);
+        Map.Add(TEXT("Psn"), ExternalFriendSourcesPsn);
+        Map.Add(TEXT("All"), ExternalFriendSourcesAll);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6767,6 +6631,7 @@ bool PlayFab::MultiplayerModels::FFindFriendLobbiesRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -6822,14 +6687,14 @@ MultiplayerModels::MembershipLock PlayFab::MultiplayerModels::readMembershipLock
 
 MultiplayerModels::MembershipLock PlayFab::MultiplayerModels::readMembershipLockFromValue(const FString& value)
 {
-    static TMap<FString, MembershipLock> _MembershipLockMap;
-    if (_MembershipLockMap.Num() == 0)
+    static const TMap<FString, MembershipLock> _MembershipLockMap = []()
     {
-        // Auto-generate the map on the first use
-        _MembershipLockMap.Add(TEXT("Unlocked"), MembershipLockUnlocked);
-        _MembershipLockMap.Add(TEXT("Locked"), MembershipLockLocked);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, MembershipLock> Map;
+        Map.Add(TEXT("Unlocked"), MembershipLockUnlocked);
+        Map.Add(TEXT("Locked"), MembershipLockLocked);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6927,11 +6792,7 @@ bool PlayFab::MultiplayerModels::FFriendLobbySummary::readFromValue(const TShare
     }
 
     const TArray<TSharedPtr<FJsonValue>>&FriendsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Friends"));
-    for (int32 Idx = 0; Idx < FriendsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FriendsArray[Idx];
-        Friends.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FriendsArray, Friends);
 
 
     const TSharedPtr<FJsonValue> LobbyIdValue = obj->TryGetField(TEXT("LobbyId"));
@@ -6959,6 +6820,7 @@ bool PlayFab::MultiplayerModels::FFriendLobbySummary::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* SearchDataObject;
     if (obj->TryGetObjectField(TEXT("SearchData"), SearchDataObject))
     {
+        SearchData.Reserve((*SearchDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*SearchDataObject)->Values); It; ++It)
         {
             SearchData.Add(It.Key(), It.Value()->AsString());
@@ -7039,11 +6901,7 @@ bool PlayFab::MultiplayerModels::FFindFriendLobbiesResult::readFromValue(const T
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LobbiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Lobbies"));
-    for (int32 Idx = 0; Idx < LobbiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LobbiesArray[Idx];
-        Lobbies.Add(FFriendLobbySummary(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LobbiesArray, Lobbies);
 
 
     const TSharedPtr<FJsonValue> PaginationValue = obj->TryGetField(TEXT("Pagination"));
@@ -7104,6 +6962,7 @@ bool PlayFab::MultiplayerModels::FFindLobbiesRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -7234,6 +7093,7 @@ bool PlayFab::MultiplayerModels::FLobbySummary::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* SearchDataObject;
     if (obj->TryGetObjectField(TEXT("SearchData"), SearchDataObject))
     {
+        SearchData.Reserve((*SearchDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*SearchDataObject)->Values); It; ++It)
         {
             SearchData.Add(It.Key(), It.Value()->AsString());
@@ -7269,11 +7129,7 @@ bool PlayFab::MultiplayerModels::FFindLobbiesResult::readFromValue(const TShared
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LobbiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Lobbies"));
-    for (int32 Idx = 0; Idx < LobbiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LobbiesArray[Idx];
-        Lobbies.Add(FLobbySummary(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LobbiesArray, Lobbies);
 
 
     const TSharedPtr<FJsonValue> PaginationValue = obj->TryGetField(TEXT("Pagination"));
@@ -7325,6 +7181,7 @@ bool PlayFab::MultiplayerModels::FGetAssetDownloadUrlRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -7426,6 +7283,7 @@ bool PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -7534,6 +7392,7 @@ bool PlayFab::MultiplayerModels::FGetBuildAliasRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -7590,6 +7449,7 @@ bool PlayFab::MultiplayerModels::FGetBuildRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -7808,19 +7668,11 @@ bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedP
     }
 
     const TArray<TSharedPtr<FJsonValue>>&GameAssetReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameAssetReferences"));
-    for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameAssetReferencesArray, GameAssetReferences);
 
 
     const TArray<TSharedPtr<FJsonValue>>&GameCertificateReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameCertificateReferences"));
-    for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReference(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GameCertificateReferencesArray, GameCertificateReferences);
 
 
     const TSharedPtr<FJsonValue> InstrumentationConfigurationValue = obj->TryGetField(TEXT("InstrumentationConfiguration"));
@@ -7832,6 +7684,7 @@ bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* MetadataObject;
     if (obj->TryGetObjectField(TEXT("Metadata"), MetadataObject))
     {
+        Metadata.Reserve((*MetadataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
             Metadata.Add(It.Key(), It.Value()->AsString());
@@ -7853,19 +7706,11 @@ bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedP
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TArray<TSharedPtr<FJsonValue>>&RegionConfigurationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("RegionConfigurations"));
-    for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RegionConfigurationsArray, RegionConfigurations);
 
 
     const TSharedPtr<FJsonValue> ServerResourceConstraintsValue = obj->TryGetField(TEXT("ServerResourceConstraints"));
@@ -7929,6 +7774,7 @@ bool PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::readFr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8032,6 +7878,7 @@ bool PlayFab::MultiplayerModels::FGetLobbyRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8098,6 +7945,7 @@ bool PlayFab::MultiplayerModels::FLobbyServer::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonObject>* ServerDataObject;
     if (obj->TryGetObjectField(TEXT("ServerData"), ServerDataObject))
     {
+        ServerData.Reserve((*ServerDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ServerDataObject)->Values); It; ++It)
         {
             ServerData.Add(It.Key(), It.Value()->AsString());
@@ -8240,6 +8088,7 @@ bool PlayFab::MultiplayerModels::FLobby::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonObject>* LobbyDataObject;
     if (obj->TryGetObjectField(TEXT("LobbyData"), LobbyDataObject))
     {
+        LobbyData.Reserve((*LobbyDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LobbyDataObject)->Values); It; ++It)
         {
             LobbyData.Add(It.Key(), It.Value()->AsString());
@@ -8261,11 +8110,7 @@ bool PlayFab::MultiplayerModels::FLobby::readFromValue(const TSharedPtr<FJsonObj
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMember(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     pfMembershipLock = readMembershipLockFromValue(obj->TryGetField(TEXT("MembershipLock")));
@@ -8288,6 +8133,7 @@ bool PlayFab::MultiplayerModels::FLobby::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonObject>* SearchDataObject;
     if (obj->TryGetObjectField(TEXT("SearchData"), SearchDataObject))
     {
+        SearchData.Reserve((*SearchDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*SearchDataObject)->Values); It; ++It)
         {
             SearchData.Add(It.Key(), It.Value()->AsString());
@@ -8391,6 +8237,7 @@ bool PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8549,19 +8396,11 @@ bool PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::readFromValue(cons
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayer(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     const TArray<TSharedPtr<FJsonValue>>&MembersToMatchWithArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("MembersToMatchWith"));
-    for (int32 Idx = 0; Idx < MembersToMatchWithArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersToMatchWithArray[Idx];
-        MembersToMatchWith.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersToMatchWithArray, MembersToMatchWith);
 
 
     const TSharedPtr<FJsonValue> QueueNameValue = obj->TryGetField(TEXT("QueueName"));
@@ -8644,6 +8483,7 @@ bool PlayFab::MultiplayerModels::FGetMatchRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8750,11 +8590,7 @@ bool PlayFab::MultiplayerModels::FGetMatchResult::readFromValue(const TSharedPtr
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayerWithTeamAssignment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     obj->TryGetStringArrayField(TEXT("RegionPreferences"), RegionPreferences);
@@ -8808,6 +8644,7 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8999,11 +8836,7 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::readFromV
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ConnectedPlayersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ConnectedPlayers"));
-    for (int32 Idx = 0; Idx < ConnectedPlayersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ConnectedPlayersArray[Idx];
-        ConnectedPlayers.Add(FConnectedPlayer(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ConnectedPlayersArray, ConnectedPlayers);
 
 
     const TSharedPtr<FJsonValue> FQDNValue = obj->TryGetField(TEXT("FQDN"));
@@ -9026,19 +8859,11 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::readFromV
 
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TArray<TSharedPtr<FJsonValue>>&PublicIPV4AddressesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PublicIPV4Addresses"));
-    for (int32 Idx = 0; Idx < PublicIPV4AddressesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PublicIPV4AddressesArray[Idx];
-        PublicIPV4Addresses.Add(FPublicIpAddress(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PublicIPV4AddressesArray, PublicIPV4Addresses);
 
 
     const TSharedPtr<FJsonValue> RegionValue = obj->TryGetField(TEXT("Region"));
@@ -9119,6 +8944,7 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9207,6 +9033,7 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::r
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9263,6 +9090,7 @@ bool PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9450,6 +9278,7 @@ bool PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9568,6 +9397,7 @@ bool PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9698,11 +9528,7 @@ bool PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::readFromValue(c
     }
 
     const TArray<TSharedPtr<FJsonValue>>&MembersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Members"));
-    for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayerWithTeamAssignment(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembersArray, Members);
 
 
     const TSharedPtr<FJsonValue> QueueNameValue = obj->TryGetField(TEXT("QueueName"));
@@ -9765,6 +9591,7 @@ bool PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequ
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9841,6 +9668,7 @@ bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9920,11 +9748,7 @@ bool PlayFab::MultiplayerModels::FQuotaChange::readFromValue(const TSharedPtr<FJ
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ChangesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Changes"));
-    for (int32 Idx = 0; Idx < ChangesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ChangesArray[Idx];
-        Changes.Add(FCoreCapacityChange(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ChangesArray, Changes);
 
 
     const TSharedPtr<FJsonValue> IsPendingReviewValue = obj->TryGetField(TEXT("IsPendingReview"));
@@ -10027,6 +9851,7 @@ bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::readF
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10062,11 +9887,7 @@ bool PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&CoreCapacitiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("CoreCapacities"));
-    for (int32 Idx = 0; Idx < CoreCapacitiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CoreCapacitiesArray[Idx];
-        CoreCapacities.Add(FCoreCapacity(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CoreCapacitiesArray, CoreCapacities);
 
 
     return HasSucceeded;
@@ -10154,6 +9975,7 @@ bool PlayFab::MultiplayerModels::FInviteToLobbyRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10263,6 +10085,7 @@ bool PlayFab::MultiplayerModels::FJoinArrangedLobbyRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10279,6 +10102,7 @@ bool PlayFab::MultiplayerModels::FJoinArrangedLobbyRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* MemberDataObject;
     if (obj->TryGetObjectField(TEXT("MemberData"), MemberDataObject))
     {
+        MemberData.Reserve((*MemberDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MemberDataObject)->Values); It; ++It)
         {
             MemberData.Add(It.Key(), It.Value()->AsString());
@@ -10364,6 +10188,7 @@ bool PlayFab::MultiplayerModels::FJoinLobbyAsServerRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10373,6 +10198,7 @@ bool PlayFab::MultiplayerModels::FJoinLobbyAsServerRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* ServerDataObject;
     if (obj->TryGetObjectField(TEXT("ServerData"), ServerDataObject))
     {
+        ServerData.Reserve((*ServerDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ServerDataObject)->Values); It; ++It)
         {
             ServerData.Add(It.Key(), It.Value()->AsString());
@@ -10485,6 +10311,7 @@ bool PlayFab::MultiplayerModels::FJoinLobbyRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10494,6 +10321,7 @@ bool PlayFab::MultiplayerModels::FJoinLobbyRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* MemberDataObject;
     if (obj->TryGetObjectField(TEXT("MemberData"), MemberDataObject))
     {
+        MemberData.Reserve((*MemberDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MemberDataObject)->Values); It; ++It)
         {
             MemberData.Add(It.Key(), It.Value()->AsString());
@@ -10598,6 +10426,7 @@ bool PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10689,6 +10518,7 @@ bool PlayFab::MultiplayerModels::FLeaveLobbyAsServerRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10754,6 +10584,7 @@ bool PlayFab::MultiplayerModels::FLeaveLobbyRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10818,6 +10649,7 @@ bool PlayFab::MultiplayerModels::FListAssetSummariesRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10876,11 +10708,7 @@ bool PlayFab::MultiplayerModels::FListAssetSummariesResponse::readFromValue(cons
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AssetSummariesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AssetSummaries"));
-    for (int32 Idx = 0; Idx < AssetSummariesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AssetSummariesArray[Idx];
-        AssetSummaries.Add(FAssetSummary(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AssetSummariesArray, AssetSummaries);
 
 
     const TSharedPtr<FJsonValue> PageSizeValue = obj->TryGetField(TEXT("PageSize"));
@@ -10942,6 +10770,7 @@ bool PlayFab::MultiplayerModels::FListBuildAliasesRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11000,11 +10829,7 @@ bool PlayFab::MultiplayerModels::FListBuildAliasesResponse::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BuildAliasesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BuildAliases"));
-    for (int32 Idx = 0; Idx < BuildAliasesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BuildAliasesArray[Idx];
-        BuildAliases.Add(FBuildAliasDetailsResponse(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BuildAliasesArray, BuildAliases);
 
 
     const TSharedPtr<FJsonValue> PageSizeValue = obj->TryGetField(TEXT("PageSize"));
@@ -11066,6 +10891,7 @@ bool PlayFab::MultiplayerModels::FListBuildSummariesRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11124,11 +10950,7 @@ bool PlayFab::MultiplayerModels::FListBuildSummariesResponse::readFromValue(cons
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BuildSummariesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BuildSummaries"));
-    for (int32 Idx = 0; Idx < BuildSummariesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BuildSummariesArray[Idx];
-        BuildSummaries.Add(FBuildSummary(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BuildSummariesArray, BuildSummaries);
 
 
     const TSharedPtr<FJsonValue> PageSizeValue = obj->TryGetField(TEXT("PageSize"));
@@ -11190,6 +11012,7 @@ bool PlayFab::MultiplayerModels::FListCertificateSummariesRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11248,11 +11071,7 @@ bool PlayFab::MultiplayerModels::FListCertificateSummariesResponse::readFromValu
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&CertificateSummariesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("CertificateSummaries"));
-    for (int32 Idx = 0; Idx < CertificateSummariesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CertificateSummariesArray[Idx];
-        CertificateSummaries.Add(FCertificateSummary(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CertificateSummariesArray, CertificateSummaries);
 
 
     const TSharedPtr<FJsonValue> PageSizeValue = obj->TryGetField(TEXT("PageSize"));
@@ -11314,6 +11133,7 @@ bool PlayFab::MultiplayerModels::FListContainerImagesRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11438,6 +11258,7 @@ bool PlayFab::MultiplayerModels::FListContainerImageTagsRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11568,6 +11389,7 @@ bool PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::readFr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11686,6 +11508,7 @@ bool PlayFab::MultiplayerModels::FListMultiplayerServersRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11778,11 +11601,7 @@ bool PlayFab::MultiplayerModels::FMultiplayerServerSummary::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ConnectedPlayersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ConnectedPlayers"));
-    for (int32 Idx = 0; Idx < ConnectedPlayersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ConnectedPlayersArray[Idx];
-        ConnectedPlayers.Add(FConnectedPlayer(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ConnectedPlayersArray, ConnectedPlayers);
 
 
     const TSharedPtr<FJsonValue> LastStateTransitionTimeValue = obj->TryGetField(TEXT("LastStateTransitionTime"));
@@ -11863,11 +11682,7 @@ bool PlayFab::MultiplayerModels::FListMultiplayerServersResponse::readFromValue(
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&MultiplayerServerSummariesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("MultiplayerServerSummaries"));
-    for (int32 Idx = 0; Idx < MultiplayerServerSummariesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MultiplayerServerSummariesArray[Idx];
-        MultiplayerServerSummaries.Add(FMultiplayerServerSummary(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MultiplayerServerSummariesArray, MultiplayerServerSummaries);
 
 
     const TSharedPtr<FJsonValue> PageSizeValue = obj->TryGetField(TEXT("PageSize"));
@@ -11917,6 +11732,7 @@ bool PlayFab::MultiplayerModels::FListPartyQosServersRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -12013,11 +11829,7 @@ bool PlayFab::MultiplayerModels::FListPartyQosServersResponse::readFromValue(con
     }
 
     const TArray<TSharedPtr<FJsonValue>>&QosServersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("QosServers"));
-    for (int32 Idx = 0; Idx < QosServersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = QosServersArray[Idx];
-        QosServers.Add(FQosServer(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(QosServersArray, QosServers);
 
 
     const TSharedPtr<FJsonValue> SkipTokenValue = obj->TryGetField(TEXT("SkipToken"));
@@ -12072,6 +11884,7 @@ bool PlayFab::MultiplayerModels::FListQosServersForTitleRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -12137,11 +11950,7 @@ bool PlayFab::MultiplayerModels::FListQosServersForTitleResponse::readFromValue(
     }
 
     const TArray<TSharedPtr<FJsonValue>>&QosServersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("QosServers"));
-    for (int32 Idx = 0; Idx < QosServersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = QosServersArray[Idx];
-        QosServers.Add(FQosServer(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(QosServersArray, QosServers);
 
 
     const TSharedPtr<FJsonValue> SkipTokenValue = obj->TryGetField(TEXT("SkipToken"));
@@ -12196,6 +12005,7 @@ bool PlayFab::MultiplayerModels::FListSecretSummariesRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -12317,11 +12127,7 @@ bool PlayFab::MultiplayerModels::FListSecretSummariesResponse::readFromValue(con
     }
 
     const TArray<TSharedPtr<FJsonValue>>&SecretSummariesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("SecretSummaries"));
-    for (int32 Idx = 0; Idx < SecretSummariesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SecretSummariesArray[Idx];
-        SecretSummaries.Add(FSecretSummary(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SecretSummariesArray, SecretSummaries);
 
 
     const TSharedPtr<FJsonValue> SkipTokenValue = obj->TryGetField(TEXT("SkipToken"));
@@ -12377,6 +12183,7 @@ bool PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::rea
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -12456,6 +12263,7 @@ bool PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -12491,11 +12299,7 @@ bool PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRespons
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ChangesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Changes"));
-    for (int32 Idx = 0; Idx < ChangesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ChangesArray[Idx];
-        Changes.Add(FQuotaChange(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ChangesArray, Changes);
 
 
     return HasSucceeded;
@@ -12570,6 +12374,7 @@ bool PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -12707,11 +12512,7 @@ bool PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::readFromV
     }
 
     const TArray<TSharedPtr<FJsonValue>>&VirtualMachinesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("VirtualMachines"));
-    for (int32 Idx = 0; Idx < VirtualMachinesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VirtualMachinesArray[Idx];
-        VirtualMachines.Add(FVirtualMachineSummary(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VirtualMachinesArray, VirtualMachines);
 
 
     return HasSucceeded;
@@ -12753,14 +12554,14 @@ MultiplayerModels::OsPlatform PlayFab::MultiplayerModels::readOsPlatformFromValu
 
 MultiplayerModels::OsPlatform PlayFab::MultiplayerModels::readOsPlatformFromValue(const FString& value)
 {
-    static TMap<FString, OsPlatform> _OsPlatformMap;
-    if (_OsPlatformMap.Num() == 0)
+    static const TMap<FString, OsPlatform> _OsPlatformMap = []()
     {
-        // Auto-generate the map on the first use
-        _OsPlatformMap.Add(TEXT("Windows"), OsPlatformWindows);
-        _OsPlatformMap.Add(TEXT("Linux"), OsPlatformLinux);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, OsPlatform> Map;
+        Map.Add(TEXT("Windows"), OsPlatformWindows);
+        Map.Add(TEXT("Linux"), OsPlatformLinux);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -12810,11 +12611,7 @@ bool PlayFab::MultiplayerModels::FPartyInvitationConfiguration::readFromValue(co
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&EntityKeysArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("EntityKeys"));
-    for (int32 Idx = 0; Idx < EntityKeysArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = EntityKeysArray[Idx];
-        EntityKeys.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(EntityKeysArray, EntityKeys);
 
 
     const TSharedPtr<FJsonValue> IdentifierValue = obj->TryGetField(TEXT("Identifier"));
@@ -12851,14 +12648,14 @@ MultiplayerModels::PartyInvitationRevocability PlayFab::MultiplayerModels::readP
 
 MultiplayerModels::PartyInvitationRevocability PlayFab::MultiplayerModels::readPartyInvitationRevocabilityFromValue(const FString& value)
 {
-    static TMap<FString, PartyInvitationRevocability> _PartyInvitationRevocabilityMap;
-    if (_PartyInvitationRevocabilityMap.Num() == 0)
+    static const TMap<FString, PartyInvitationRevocability> _PartyInvitationRevocabilityMap = []()
     {
-        // Auto-generate the map on the first use
-        _PartyInvitationRevocabilityMap.Add(TEXT("Creator"), PartyInvitationRevocabilityCreator);
-        _PartyInvitationRevocabilityMap.Add(TEXT("Anyone"), PartyInvitationRevocabilityAnyone);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, PartyInvitationRevocability> Map;
+        Map.Add(TEXT("Creator"), PartyInvitationRevocabilityCreator);
+        Map.Add(TEXT("Anyone"), PartyInvitationRevocabilityAnyone);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -13011,6 +12808,7 @@ bool PlayFab::MultiplayerModels::FRemoveMemberFromLobbyRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13127,6 +12925,7 @@ bool PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13259,11 +13058,7 @@ bool PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::readFromValu
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ConnectedPlayersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ConnectedPlayers"));
-    for (int32 Idx = 0; Idx < ConnectedPlayersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ConnectedPlayersArray[Idx];
-        ConnectedPlayers.Add(FConnectedPlayer(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ConnectedPlayersArray, ConnectedPlayers);
 
 
     const TSharedPtr<FJsonValue> FQDNValue = obj->TryGetField(TEXT("FQDN"));
@@ -13286,19 +13081,11 @@ bool PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::readFromValu
 
 
     const TArray<TSharedPtr<FJsonValue>>&PortsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Ports"));
-    for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PortsArray, Ports);
 
 
     const TArray<TSharedPtr<FJsonValue>>&PublicIPV4AddressesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PublicIPV4Addresses"));
-    for (int32 Idx = 0; Idx < PublicIPV4AddressesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PublicIPV4AddressesArray[Idx];
-        PublicIPV4Addresses.Add(FPublicIpAddress(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PublicIPV4AddressesArray, PublicIPV4Addresses);
 
 
     const TSharedPtr<FJsonValue> RegionValue = obj->TryGetField(TEXT("Region"));
@@ -13384,6 +13171,7 @@ bool PlayFab::MultiplayerModels::FRequestPartyServiceRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13496,6 +13284,7 @@ bool PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::r
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13580,14 +13369,14 @@ MultiplayerModels::RoutingType PlayFab::MultiplayerModels::readRoutingTypeFromVa
 
 MultiplayerModels::RoutingType PlayFab::MultiplayerModels::readRoutingTypeFromValue(const FString& value)
 {
-    static TMap<FString, RoutingType> _RoutingTypeMap;
-    if (_RoutingTypeMap.Num() == 0)
+    static const TMap<FString, RoutingType> _RoutingTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _RoutingTypeMap.Add(TEXT("Microsoft"), RoutingTypeMicrosoft);
-        _RoutingTypeMap.Add(TEXT("Internet"), RoutingTypeInternet);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, RoutingType> Map;
+        Map.Add(TEXT("Microsoft"), RoutingTypeMicrosoft);
+        Map.Add(TEXT("Internet"), RoutingTypeInternet);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -13680,14 +13469,14 @@ MultiplayerModels::ServerType PlayFab::MultiplayerModels::readServerTypeFromValu
 
 MultiplayerModels::ServerType PlayFab::MultiplayerModels::readServerTypeFromValue(const FString& value)
 {
-    static TMap<FString, ServerType> _ServerTypeMap;
-    if (_ServerTypeMap.Num() == 0)
+    static const TMap<FString, ServerType> _ServerTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _ServerTypeMap.Add(TEXT("Container"), ServerTypeContainer);
-        _ServerTypeMap.Add(TEXT("Process"), ServerTypeProcess);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ServerType> Map;
+        Map.Add(TEXT("Container"), ServerTypeContainer);
+        Map.Add(TEXT("Process"), ServerTypeProcess);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -13739,6 +13528,7 @@ bool PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13772,14 +13562,14 @@ MultiplayerModels::SubscriptionType PlayFab::MultiplayerModels::readSubscription
 
 MultiplayerModels::SubscriptionType PlayFab::MultiplayerModels::readSubscriptionTypeFromValue(const FString& value)
 {
-    static TMap<FString, SubscriptionType> _SubscriptionTypeMap;
-    if (_SubscriptionTypeMap.Num() == 0)
+    static const TMap<FString, SubscriptionType> _SubscriptionTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _SubscriptionTypeMap.Add(TEXT("LobbyChange"), SubscriptionTypeLobbyChange);
-        _SubscriptionTypeMap.Add(TEXT("LobbyInvite"), SubscriptionTypeLobbyInvite);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SubscriptionType> Map;
+        Map.Add(TEXT("LobbyChange"), SubscriptionTypeLobbyChange);
+        Map.Add(TEXT("LobbyInvite"), SubscriptionTypeLobbyInvite);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -13850,6 +13640,7 @@ bool PlayFab::MultiplayerModels::FSubscribeToLobbyResourceRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13983,6 +13774,7 @@ bool PlayFab::MultiplayerModels::FUnsubscribeFromLobbyResourceRequest::readFromV
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14063,6 +13855,7 @@ bool PlayFab::MultiplayerModels::FUntagContainerImageRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14153,16 +13946,13 @@ bool PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::readFromValue(const T
     }
 
     const TArray<TSharedPtr<FJsonValue>>&BuildSelectionCriteriaArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BuildSelectionCriteria"));
-    for (int32 Idx = 0; Idx < BuildSelectionCriteriaArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BuildSelectionCriteriaArray[Idx];
-        BuildSelectionCriteria.Add(FBuildSelectionCriterion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BuildSelectionCriteriaArray, BuildSelectionCriteria);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14236,6 +14026,7 @@ bool PlayFab::MultiplayerModels::FUpdateBuildNameRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14301,6 +14092,7 @@ bool PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14361,16 +14153,13 @@ bool PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::readFromValue(const
     }
 
     const TArray<TSharedPtr<FJsonValue>>&BuildRegionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BuildRegions"));
-    for (int32 Idx = 0; Idx < BuildRegionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BuildRegionsArray[Idx];
-        BuildRegions.Add(FBuildRegionParams(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BuildRegionsArray, BuildRegions);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14447,6 +14236,7 @@ bool PlayFab::MultiplayerModels::FUpdateLobbyAsServerRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14463,6 +14253,7 @@ bool PlayFab::MultiplayerModels::FUpdateLobbyAsServerRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* ServerDataObject;
     if (obj->TryGetObjectField(TEXT("ServerData"), ServerDataObject))
     {
+        ServerData.Reserve((*ServerDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ServerDataObject)->Values); It; ++It)
         {
             ServerData.Add(It.Key(), It.Value()->AsString());
@@ -14610,6 +14401,7 @@ bool PlayFab::MultiplayerModels::FUpdateLobbyRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14619,6 +14411,7 @@ bool PlayFab::MultiplayerModels::FUpdateLobbyRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* LobbyDataObject;
     if (obj->TryGetObjectField(TEXT("LobbyData"), LobbyDataObject))
     {
+        LobbyData.Reserve((*LobbyDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LobbyDataObject)->Values); It; ++It)
         {
             LobbyData.Add(It.Key(), It.Value()->AsString());
@@ -14644,6 +14437,7 @@ bool PlayFab::MultiplayerModels::FUpdateLobbyRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* MemberDataObject;
     if (obj->TryGetObjectField(TEXT("MemberData"), MemberDataObject))
     {
+        MemberData.Reserve((*MemberDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MemberDataObject)->Values); It; ++It)
         {
             MemberData.Add(It.Key(), It.Value()->AsString());
@@ -14669,6 +14463,7 @@ bool PlayFab::MultiplayerModels::FUpdateLobbyRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* SearchDataObject;
     if (obj->TryGetObjectField(TEXT("SearchData"), SearchDataObject))
     {
+        SearchData.Reserve((*SearchDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*SearchDataObject)->Values); It; ++It)
         {
             SearchData.Add(It.Key(), It.Value()->AsString());
@@ -14719,6 +14514,7 @@ bool PlayFab::MultiplayerModels::FUploadCertificateRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14780,6 +14576,7 @@ bool PlayFab::MultiplayerModels::FUploadSecretRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14802,3 +14599,5 @@ bool PlayFab::MultiplayerModels::FUploadSecretRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_MULTIPLAYER_API
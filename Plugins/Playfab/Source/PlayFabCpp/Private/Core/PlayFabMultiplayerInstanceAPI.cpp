@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_MULTIPLAYER_API
 #include "Core/PlayFabMultiplayerInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabMultiplayerInstanceAPI::GetOrC
     return this->authContext;
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CancelAllMatchmakingTicketsForPlayer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CancelAllMatchmakingTicketsForPlayer(
     MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest& request,
     const FCancelAllMatchmakingTicketsForPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabMultiplayerInstanceAPI::CancelAllMatchmakingTicketsForPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelAllMatchmakingTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCancelAllMatchmakingTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCancelAllMatchmakingTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelAllMatchmakingTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCancelAllMatchmakingTicketsForPlayerResul
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CancelAllServerBackfillTicketsForPlayer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CancelAllServerBackfillTicketsForPlayer(
     MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest& request,
     const FCancelAllServerBackfillTicketsForPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabMultiplayerInstanceAPI::CancelAllServerBackfillTicketsForPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelAllServerBackfillTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCancelAllServerBackfillTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCancelAllServerBackfillTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelAllServerBackfillTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCancelAllServerBackfillTicketsForPlayerRe
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CancelMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CancelMatchmakingTicket(
     MultiplayerModels::FCancelMatchmakingTicketRequest& request,
     const FCancelMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabMultiplayerInstanceAPI::CancelMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCancelMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCancelMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCancelMatchmakingTicketResult(FHttpReques
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CancelServerBackfillTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CancelServerBackfillTicket(
     MultiplayerModels::FCancelServerBackfillTicketRequest& request,
     const FCancelServerBackfillTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabMultiplayerInstanceAPI::CancelServerBackfillTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelServerBackfillTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCancelServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCancelServerBackfillTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelServerBackfillTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCancelServerBackfillTicketResult(FHttpReq
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateBuildAlias(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateBuildAlias(
     MultiplayerModels::FCreateBuildAliasRequest& request,
     const FCreateBuildAliasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateBuildAlias(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateBuildAliasResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithCustomContainer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateBuildWithCustomContainer(
     MultiplayerModels::FCreateBuildWithCustomContainerRequest& request,
     const FCreateBuildWithCustomContainerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithCustomContainer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildWithCustomContainer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithCustomContainerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithCustomContainerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildWithCustomContainerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithCustomContainerResult(FHtt
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithManagedContainer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateBuildWithManagedContainer(
     MultiplayerModels::FCreateBuildWithManagedContainerRequest& request,
     const FCreateBuildWithManagedContainerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithManagedContainer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildWithManagedContainer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithManagedContainerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithManagedContainerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildWithManagedContainerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithManagedContainerResult(FHt
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithProcessBasedServer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateBuildWithProcessBasedServer(
     MultiplayerModels::FCreateBuildWithProcessBasedServerRequest& request,
     const FCreateBuildWithProcessBasedServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithProcessBasedServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildWithProcessBasedServer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithProcessBasedServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithProcessBasedServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildWithProcessBasedServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithProcessBasedServerResult(F
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateLobby(
     MultiplayerModels::FCreateLobbyRequest& request,
     const FCreateLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/CreateLobby"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -347,7 +348,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateLobbyResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateMatchmakingTicket(
     MultiplayerModels::FCreateMatchmakingTicketRequest& request,
     const FCreateMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -360,7 +361,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CreateMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -377,7 +378,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateMatchmakingTicketResult(FHttpReques
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateRemoteUser(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateRemoteUser(
     MultiplayerModels::FCreateRemoteUserRequest& request,
     const FCreateRemoteUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -390,7 +391,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateRemoteUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateRemoteUser"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateRemoteUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateRemoteUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateRemoteUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -407,7 +408,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateRemoteUserResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateServerBackfillTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateServerBackfillTicket(
     MultiplayerModels::FCreateServerBackfillTicketRequest& request,
     const FCreateServerBackfillTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -420,7 +421,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateServerBackfillTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CreateServerBackfillTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateServerBackfillTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateServerBackfillTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -437,7 +438,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateServerBackfillTicketResult(FHttpReq
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateServerMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateServerMatchmakingTicket(
     MultiplayerModels::FCreateServerMatchmakingTicketRequest& request,
     const FCreateServerMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -450,7 +451,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateServerMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CreateServerMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateServerMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateServerMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateServerMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -467,7 +468,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateServerMatchmakingTicketResult(FHttp
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::CreateTitleMultiplayerServersQuotaChange(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::CreateTitleMultiplayerServersQuotaChange(
     MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest& request,
     const FCreateTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -480,7 +481,7 @@ bool UPlayFabMultiplayerInstanceAPI::CreateTitleMultiplayerServersQuotaChange(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateTitleMultiplayerServersQuotaChange"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateTitleMultiplayerServersQuotaChangeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateTitleMultiplayerServersQuotaChangeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateTitleMultiplayerServersQuotaChangeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -497,7 +498,7 @@ void UPlayFabMultiplayerInstanceAPI::OnCreateTitleMultiplayerServersQuotaChangeR
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::DeleteAsset(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::DeleteAsset(
     MultiplayerModels::FDeleteAssetRequest& request,
     const FDeleteAssetDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -510,7 +511,7 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteAsset(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteAsset"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteAssetResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteAssetResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteAssetDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -527,7 +528,7 @@ void UPlayFabMultiplayerInstanceAPI::OnDeleteAssetResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::DeleteBuild(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::DeleteBuild(
     MultiplayerModels::FDeleteBuildRequest& request,
     const FDeleteBuildDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -540,7 +541,7 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteBuild(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteBuild"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -557,7 +558,7 @@ void UPlayFabMultiplayerInstanceAPI::OnDeleteBuildResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::DeleteBuildAlias(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::DeleteBuildAlias(
     MultiplayerModels::FDeleteBuildAliasRequest& request,
     const FDeleteBuildAliasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -570,7 +571,7 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteBuildAlias(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -587,7 +588,7 @@ void UPlayFabMultiplayerInstanceAPI::OnDeleteBuildAliasResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::DeleteBuildRegion(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::DeleteBuildRegion(
     MultiplayerModels::FDeleteBuildRegionRequest& request,
     const FDeleteBuildRegionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -600,7 +601,7 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteBuildRegion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteBuildRegion"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteBuildRegionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteBuildRegionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteBuildRegionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -617,7 +618,7 @@ void UPlayFabMultiplayerInstanceAPI::OnDeleteBuildRegionResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::DeleteCertificate(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::DeleteCertificate(
     MultiplayerModels::FDeleteCertificateRequest& request,
     const FDeleteCertificateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -630,7 +631,7 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteCertificate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteCertificate"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteCertificateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteCertificateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteCertificateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -647,7 +648,7 @@ void UPlayFabMultiplayerInstanceAPI::OnDeleteCertificateResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::DeleteContainerImageRepository(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::DeleteContainerImageRepository(
     MultiplayerModels::FDeleteContainerImageRequest& request,
     const FDeleteContainerImageRepositoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -660,7 +661,7 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteContainerImageRepository(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteContainerImageRepository"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteContainerImageRepositoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteContainerImageRepositoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteContainerImageRepositoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -677,7 +678,7 @@ void UPlayFabMultiplayerInstanceAPI::OnDeleteContainerImageRepositoryResult(FHtt
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::DeleteLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::DeleteLobby(
     MultiplayerModels::FDeleteLobbyRequest& request,
     const FDeleteLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -690,7 +691,7 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/DeleteLobby"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -707,7 +708,7 @@ void UPlayFabMultiplayerInstanceAPI::OnDeleteLobbyResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::DeleteRemoteUser(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::DeleteRemoteUser(
     MultiplayerModels::FDeleteRemoteUserRequest& request,
     const FDeleteRemoteUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -720,7 +721,7 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteRemoteUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteRemoteUser"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteRemoteUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteRemoteUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteRemoteUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -737,7 +738,7 @@ void UPlayFabMultiplayerInstanceAPI::OnDeleteRemoteUserResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::DeleteSecret(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::DeleteSecret(
     MultiplayerModels::FDeleteSecretRequest& request,
     const FDeleteSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -750,7 +751,7 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteSecret"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -767,7 +768,7 @@ void UPlayFabMultiplayerInstanceAPI::OnDeleteSecretResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::EnableMultiplayerServersForTitle(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::EnableMultiplayerServersForTitle(
     MultiplayerModels::FEnableMultiplayerServersForTitleRequest& request,
     const FEnableMultiplayerServersForTitleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -780,7 +781,7 @@ bool UPlayFabMultiplayerInstanceAPI::EnableMultiplayerServersForTitle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/EnableMultiplayerServersForTitle"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnEnableMultiplayerServersForTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnEnableMultiplayerServersForTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FEnableMultiplayerServersForTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -797,7 +798,7 @@ void UPlayFabMultiplayerInstanceAPI::OnEnableMultiplayerServersForTitleResult(FH
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::FindFriendLobbies(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::FindFriendLobbies(
     MultiplayerModels::FFindFriendLobbiesRequest& request,
     const FFindFriendLobbiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -810,7 +811,7 @@ bool UPlayFabMultiplayerInstanceAPI::FindFriendLobbies(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/FindFriendLobbies"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnFindFriendLobbiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnFindFriendLobbiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FFindFriendLobbiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -827,7 +828,7 @@ void UPlayFabMultiplayerInstanceAPI::OnFindFriendLobbiesResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::FindLobbies(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::FindLobbies(
     MultiplayerModels::FFindLobbiesRequest& request,
     const FFindLobbiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -840,7 +841,7 @@ bool UPlayFabMultiplayerInstanceAPI::FindLobbies(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/FindLobbies"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnFindLobbiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnFindLobbiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FFindLobbiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -857,7 +858,7 @@ void UPlayFabMultiplayerInstanceAPI::OnFindLobbiesResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetAssetDownloadUrl(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetAssetDownloadUrl(
     MultiplayerModels::FGetAssetDownloadUrlRequest& request,
     const FGetAssetDownloadUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -870,7 +871,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetAssetDownloadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetAssetDownloadUrl"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetAssetDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetAssetDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAssetDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -887,7 +888,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetAssetDownloadUrlResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetAssetUploadUrl(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetAssetUploadUrl(
     MultiplayerModels::FGetAssetUploadUrlRequest& request,
     const FGetAssetUploadUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -900,7 +901,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetAssetUploadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetAssetUploadUrl"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetAssetUploadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetAssetUploadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAssetUploadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -917,7 +918,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetAssetUploadUrlResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetBuild(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetBuild(
     MultiplayerModels::FGetBuildRequest& request,
     const FGetBuildDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -930,7 +931,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetBuild(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetBuild"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -947,7 +948,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetBuildResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetBuildAlias(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetBuildAlias(
     MultiplayerModels::FGetBuildAliasRequest& request,
     const FGetBuildAliasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -960,7 +961,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetBuildAlias(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -977,7 +978,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetBuildAliasResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetContainerRegistryCredentials(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetContainerRegistryCredentials(
     MultiplayerModels::FGetContainerRegistryCredentialsRequest& request,
     const FGetContainerRegistryCredentialsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -990,7 +991,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetContainerRegistryCredentials(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetContainerRegistryCredentials"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetContainerRegistryCredentialsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetContainerRegistryCredentialsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContainerRegistryCredentialsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1007,7 +1008,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetContainerRegistryCredentialsResult(FHt
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetLobby(
     MultiplayerModels::FGetLobbyRequest& request,
     const FGetLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1020,7 +1021,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/GetLobby"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1037,7 +1038,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetLobbyResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetMatch(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetMatch(
     MultiplayerModels::FGetMatchRequest& request,
     const FGetMatchDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1050,7 +1051,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetMatch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetMatch"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMatchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMatchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1067,7 +1068,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetMatchResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetMatchmakingTicket(
     MultiplayerModels::FGetMatchmakingTicketRequest& request,
     const FGetMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1080,7 +1081,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1097,7 +1098,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetMatchmakingTicketResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerDetails(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerDetails(
     MultiplayerModels::FGetMultiplayerServerDetailsRequest& request,
     const FGetMultiplayerServerDetailsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1110,7 +1111,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerDetails(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetMultiplayerServerDetails"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerDetailsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerDetailsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMultiplayerServerDetailsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1127,7 +1128,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerDetailsResult(FHttpRe
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerLogs(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerLogs(
     MultiplayerModels::FGetMultiplayerServerLogsRequest& request,
     const FGetMultiplayerServerLogsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1140,7 +1141,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerLogs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetMultiplayerServerLogs"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerLogsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerLogsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMultiplayerServerLogsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1157,7 +1158,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerLogsResult(FHttpReque
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerSessionLogsBySessionId(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetMultiplayerSessionLogsBySessionId(
     MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest& request,
     const FGetMultiplayerSessionLogsBySessionIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1170,7 +1171,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerSessionLogsBySessionId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetMultiplayerSessionLogsBySessionId"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerSessionLogsBySessionIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerSessionLogsBySessionIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMultiplayerSessionLogsBySessionIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1187,7 +1188,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerSessionLogsBySessionIdResul
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetQueueStatistics(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetQueueStatistics(
     MultiplayerModels::FGetQueueStatisticsRequest& request,
     const FGetQueueStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1200,7 +1201,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetQueueStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetQueueStatistics"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetQueueStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetQueueStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetQueueStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1217,7 +1218,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetQueueStatisticsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetRemoteLoginEndpoint(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetRemoteLoginEndpoint(
     MultiplayerModels::FGetRemoteLoginEndpointRequest& request,
     const FGetRemoteLoginEndpointDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1230,7 +1231,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetRemoteLoginEndpoint(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetRemoteLoginEndpoint"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetRemoteLoginEndpointResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetRemoteLoginEndpointResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRemoteLoginEndpointDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1247,7 +1248,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetRemoteLoginEndpointResult(FHttpRequest
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetServerBackfillTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetServerBackfillTicket(
     MultiplayerModels::FGetServerBackfillTicketRequest& request,
     const FGetServerBackfillTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1260,7 +1261,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetServerBackfillTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetServerBackfillTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetServerBackfillTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetServerBackfillTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1277,7 +1278,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetServerBackfillTicketResult(FHttpReques
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetTitleEnabledForMultiplayerServersStatus(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetTitleEnabledForMultiplayerServersStatus(
     MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest& request,
     const FGetTitleEnabledForMultiplayerServersStatusDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1290,7 +1291,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetTitleEnabledForMultiplayerServersStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetTitleEnabledForMultiplayerServersStatus"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetTitleEnabledForMultiplayerServersStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetTitleEnabledForMultiplayerServersStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleEnabledForMultiplayerServersStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1307,7 +1308,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetTitleEnabledForMultiplayerServersStatu
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotaChange(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotaChange(
     MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest& request,
     const FGetTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1320,7 +1321,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotaChange(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetTitleMultiplayerServersQuotaChange"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotaChangeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotaChangeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleMultiplayerServersQuotaChangeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1337,7 +1338,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotaChangeResu
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotas(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotas(
     MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest& request,
     const FGetTitleMultiplayerServersQuotasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1350,7 +1351,7 @@ bool UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotas(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetTitleMultiplayerServersQuotas"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleMultiplayerServersQuotasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1367,7 +1368,7 @@ void UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotasResult(FH
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::InviteToLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::InviteToLobby(
     MultiplayerModels::FInviteToLobbyRequest& request,
     const FInviteToLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1380,7 +1381,7 @@ bool UPlayFabMultiplayerInstanceAPI::InviteToLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/InviteToLobby"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnInviteToLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnInviteToLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInviteToLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1397,7 +1398,7 @@ void UPlayFabMultiplayerInstanceAPI::OnInviteToLobbyResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::JoinArrangedLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::JoinArrangedLobby(
     MultiplayerModels::FJoinArrangedLobbyRequest& request,
     const FJoinArrangedLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1410,7 +1411,7 @@ bool UPlayFabMultiplayerInstanceAPI::JoinArrangedLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/JoinArrangedLobby"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnJoinArrangedLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnJoinArrangedLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FJoinArrangedLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1427,7 +1428,7 @@ void UPlayFabMultiplayerInstanceAPI::OnJoinArrangedLobbyResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::JoinLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::JoinLobby(
     MultiplayerModels::FJoinLobbyRequest& request,
     const FJoinLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1440,7 +1441,7 @@ bool UPlayFabMultiplayerInstanceAPI::JoinLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/JoinLobby"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnJoinLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnJoinLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FJoinLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1457,7 +1458,7 @@ void UPlayFabMultiplayerInstanceAPI::OnJoinLobbyResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::JoinLobbyAsServer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::JoinLobbyAsServer(
     MultiplayerModels::FJoinLobbyAsServerRequest& request,
     const FJoinLobbyAsServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1470,7 +1471,7 @@ bool UPlayFabMultiplayerInstanceAPI::JoinLobbyAsServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/JoinLobbyAsServer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnJoinLobbyAsServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnJoinLobbyAsServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FJoinLobbyAsServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1487,7 +1488,7 @@ void UPlayFabMultiplayerInstanceAPI::OnJoinLobbyAsServerResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::JoinMatchmakingTicket(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::JoinMatchmakingTicket(
     MultiplayerModels::FJoinMatchmakingTicketRequest& request,
     const FJoinMatchmakingTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1500,7 +1501,7 @@ bool UPlayFabMultiplayerInstanceAPI::JoinMatchmakingTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/JoinMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnJoinMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnJoinMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FJoinMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1517,7 +1518,7 @@ void UPlayFabMultiplayerInstanceAPI::OnJoinMatchmakingTicketResult(FHttpRequestP
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::LeaveLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::LeaveLobby(
     MultiplayerModels::FLeaveLobbyRequest& request,
     const FLeaveLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1530,7 +1531,7 @@ bool UPlayFabMultiplayerInstanceAPI::LeaveLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/LeaveLobby"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnLeaveLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnLeaveLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLeaveLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1547,7 +1548,7 @@ void UPlayFabMultiplayerInstanceAPI::OnLeaveLobbyResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::LeaveLobbyAsServer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::LeaveLobbyAsServer(
     MultiplayerModels::FLeaveLobbyAsServerRequest& request,
     const FLeaveLobbyAsServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1560,7 +1561,7 @@ bool UPlayFabMultiplayerInstanceAPI::LeaveLobbyAsServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/LeaveLobbyAsServer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnLeaveLobbyAsServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnLeaveLobbyAsServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLeaveLobbyAsServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1577,7 +1578,7 @@ void UPlayFabMultiplayerInstanceAPI::OnLeaveLobbyAsServerResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListArchivedMultiplayerServers(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListArchivedMultiplayerServers(
     MultiplayerModels::FListMultiplayerServersRequest& request,
     const FListArchivedMultiplayerServersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1590,7 +1591,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListArchivedMultiplayerServers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListArchivedMultiplayerServers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListArchivedMultiplayerServersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListArchivedMultiplayerServersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListArchivedMultiplayerServersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1607,7 +1608,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListArchivedMultiplayerServersResult(FHtt
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListAssetSummaries(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListAssetSummaries(
     MultiplayerModels::FListAssetSummariesRequest& request,
     const FListAssetSummariesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1620,7 +1621,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListAssetSummaries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListAssetSummaries"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListAssetSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListAssetSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListAssetSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1637,7 +1638,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListAssetSummariesResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListBuildAliases(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListBuildAliases(
     MultiplayerModels::FListBuildAliasesRequest& request,
     const FListBuildAliasesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1650,7 +1651,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListBuildAliases(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListBuildAliases"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListBuildAliasesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListBuildAliasesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListBuildAliasesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1667,7 +1668,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListBuildAliasesResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListBuildSummariesV2(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListBuildSummariesV2(
     MultiplayerModels::FListBuildSummariesRequest& request,
     const FListBuildSummariesV2Delegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1680,7 +1681,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListBuildSummariesV2(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListBuildSummariesV2"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListBuildSummariesV2Result, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListBuildSummariesV2Result(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListBuildSummariesV2Delegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1697,7 +1698,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListBuildSummariesV2Result(FHttpRequestPt
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListCertificateSummaries(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListCertificateSummaries(
     MultiplayerModels::FListCertificateSummariesRequest& request,
     const FListCertificateSummariesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1710,7 +1711,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListCertificateSummaries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListCertificateSummaries"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListCertificateSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListCertificateSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListCertificateSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1727,7 +1728,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListCertificateSummariesResult(FHttpReque
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListContainerImages(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListContainerImages(
     MultiplayerModels::FListContainerImagesRequest& request,
     const FListContainerImagesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1740,7 +1741,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListContainerImages(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListContainerImages"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListContainerImagesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListContainerImagesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListContainerImagesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1757,7 +1758,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListContainerImagesResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListContainerImageTags(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListContainerImageTags(
     MultiplayerModels::FListContainerImageTagsRequest& request,
     const FListContainerImageTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1770,7 +1771,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListContainerImageTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListContainerImageTags"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListContainerImageTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListContainerImageTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListContainerImageTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1787,7 +1788,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListContainerImageTagsResult(FHttpRequest
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListMatchmakingTicketsForPlayer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListMatchmakingTicketsForPlayer(
     MultiplayerModels::FListMatchmakingTicketsForPlayerRequest& request,
     const FListMatchmakingTicketsForPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1800,7 +1801,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListMatchmakingTicketsForPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/ListMatchmakingTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListMatchmakingTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListMatchmakingTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMatchmakingTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1817,7 +1818,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListMatchmakingTicketsForPlayerResult(FHt
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListMultiplayerServers(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListMultiplayerServers(
     MultiplayerModels::FListMultiplayerServersRequest& request,
     const FListMultiplayerServersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1830,7 +1831,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListMultiplayerServers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListMultiplayerServers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListMultiplayerServersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListMultiplayerServersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMultiplayerServersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1847,7 +1848,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListMultiplayerServersResult(FHttpRequest
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListPartyQosServers(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListPartyQosServers(
     MultiplayerModels::FListPartyQosServersRequest& request,
     const FListPartyQosServersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1857,7 +1858,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListPartyQosServers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListPartyQosServers"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListPartyQosServersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListPartyQosServersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListPartyQosServersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1874,7 +1875,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListPartyQosServersResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListQosServersForTitle(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListQosServersForTitle(
     MultiplayerModels::FListQosServersForTitleRequest& request,
     const FListQosServersForTitleDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1887,7 +1888,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListQosServersForTitle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListQosServersForTitle"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListQosServersForTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListQosServersForTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListQosServersForTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1904,7 +1905,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListQosServersForTitleResult(FHttpRequest
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListSecretSummaries(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListSecretSummaries(
     MultiplayerModels::FListSecretSummariesRequest& request,
     const FListSecretSummariesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1917,7 +1918,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListSecretSummaries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListSecretSummaries"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListSecretSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListSecretSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListSecretSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1934,7 +1935,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListSecretSummariesResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListServerBackfillTicketsForPlayer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListServerBackfillTicketsForPlayer(
     MultiplayerModels::FListServerBackfillTicketsForPlayerRequest& request,
     const FListServerBackfillTicketsForPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1947,7 +1948,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListServerBackfillTicketsForPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/ListServerBackfillTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListServerBackfillTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListServerBackfillTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListServerBackfillTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1964,7 +1965,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListServerBackfillTicketsForPlayerResult(
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListTitleMultiplayerServersQuotaChanges(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListTitleMultiplayerServersQuotaChanges(
     MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest& request,
     const FListTitleMultiplayerServersQuotaChangesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1977,7 +1978,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListTitleMultiplayerServersQuotaChanges(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListTitleMultiplayerServersQuotaChanges"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListTitleMultiplayerServersQuotaChangesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListTitleMultiplayerServersQuotaChangesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListTitleMultiplayerServersQuotaChangesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1994,7 +1995,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListTitleMultiplayerServersQuotaChangesRe
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ListVirtualMachineSummaries(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ListVirtualMachineSummaries(
     MultiplayerModels::FListVirtualMachineSummariesRequest& request,
     const FListVirtualMachineSummariesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2007,7 +2008,7 @@ bool UPlayFabMultiplayerInstanceAPI::ListVirtualMachineSummaries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListVirtualMachineSummaries"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListVirtualMachineSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListVirtualMachineSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListVirtualMachineSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2024,7 +2025,7 @@ void UPlayFabMultiplayerInstanceAPI::OnListVirtualMachineSummariesResult(FHttpRe
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::RemoveMember(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::RemoveMember(
     MultiplayerModels::FRemoveMemberFromLobbyRequest& request,
     const FRemoveMemberDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2037,7 +2038,7 @@ bool UPlayFabMultiplayerInstanceAPI::RemoveMember(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/RemoveMember"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnRemoveMemberResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnRemoveMemberResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveMemberDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2054,7 +2055,7 @@ void UPlayFabMultiplayerInstanceAPI::OnRemoveMemberResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::RequestMultiplayerServer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::RequestMultiplayerServer(
     MultiplayerModels::FRequestMultiplayerServerRequest& request,
     const FRequestMultiplayerServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2067,7 +2068,7 @@ bool UPlayFabMultiplayerInstanceAPI::RequestMultiplayerServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/RequestMultiplayerServer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnRequestMultiplayerServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnRequestMultiplayerServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRequestMultiplayerServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2084,7 +2085,7 @@ void UPlayFabMultiplayerInstanceAPI::OnRequestMultiplayerServerResult(FHttpReque
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::RequestPartyService(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::RequestPartyService(
     MultiplayerModels::FRequestPartyServiceRequest& request,
     const FRequestPartyServiceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2097,7 +2098,7 @@ bool UPlayFabMultiplayerInstanceAPI::RequestPartyService(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Party/RequestPartyService"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnRequestPartyServiceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnRequestPartyServiceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRequestPartyServiceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2114,7 +2115,7 @@ void UPlayFabMultiplayerInstanceAPI::OnRequestPartyServiceResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::RolloverContainerRegistryCredentials(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::RolloverContainerRegistryCredentials(
     MultiplayerModels::FRolloverContainerRegistryCredentialsRequest& request,
     const FRolloverContainerRegistryCredentialsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2127,7 +2128,7 @@ bool UPlayFabMultiplayerInstanceAPI::RolloverContainerRegistryCredentials(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/RolloverContainerRegistryCredentials"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnRolloverContainerRegistryCredentialsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnRolloverContainerRegistryCredentialsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRolloverContainerRegistryCredentialsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2144,7 +2145,7 @@ void UPlayFabMultiplayerInstanceAPI::OnRolloverContainerRegistryCredentialsResul
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::ShutdownMultiplayerServer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::ShutdownMultiplayerServer(
     MultiplayerModels::FShutdownMultiplayerServerRequest& request,
     const FShutdownMultiplayerServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2157,7 +2158,7 @@ bool UPlayFabMultiplayerInstanceAPI::ShutdownMultiplayerServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ShutdownMultiplayerServer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnShutdownMultiplayerServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnShutdownMultiplayerServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FShutdownMultiplayerServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2174,7 +2175,7 @@ void UPlayFabMultiplayerInstanceAPI::OnShutdownMultiplayerServerResult(FHttpRequ
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::SubscribeToLobbyResource(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::SubscribeToLobbyResource(
     MultiplayerModels::FSubscribeToLobbyResourceRequest& request,
     const FSubscribeToLobbyResourceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2187,7 +2188,7 @@ bool UPlayFabMultiplayerInstanceAPI::SubscribeToLobbyResource(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/SubscribeToLobbyResource"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnSubscribeToLobbyResourceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnSubscribeToLobbyResourceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubscribeToLobbyResourceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2204,7 +2205,7 @@ void UPlayFabMultiplayerInstanceAPI::OnSubscribeToLobbyResourceResult(FHttpReque
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UnsubscribeFromLobbyResource(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UnsubscribeFromLobbyResource(
     MultiplayerModels::FUnsubscribeFromLobbyResourceRequest& request,
     const FUnsubscribeFromLobbyResourceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2217,7 +2218,7 @@ bool UPlayFabMultiplayerInstanceAPI::UnsubscribeFromLobbyResource(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/UnsubscribeFromLobbyResource"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUnsubscribeFromLobbyResourceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUnsubscribeFromLobbyResourceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnsubscribeFromLobbyResourceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2234,7 +2235,7 @@ void UPlayFabMultiplayerInstanceAPI::OnUnsubscribeFromLobbyResourceResult(FHttpR
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UntagContainerImage(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UntagContainerImage(
     MultiplayerModels::FUntagContainerImageRequest& request,
     const FUntagContainerImageDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2247,7 +2248,7 @@ bool UPlayFabMultiplayerInstanceAPI::UntagContainerImage(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UntagContainerImage"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUntagContainerImageResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUntagContainerImageResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUntagContainerImageDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2264,7 +2265,7 @@ void UPlayFabMultiplayerInstanceAPI::OnUntagContainerImageResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UpdateBuildAlias(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UpdateBuildAlias(
     MultiplayerModels::FUpdateBuildAliasRequest& request,
     const FUpdateBuildAliasDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2277,7 +2278,7 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateBuildAlias(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2294,7 +2295,7 @@ void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildAliasResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UpdateBuildName(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UpdateBuildName(
     MultiplayerModels::FUpdateBuildNameRequest& request,
     const FUpdateBuildNameDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2307,7 +2308,7 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateBuildName(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildName"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2324,7 +2325,7 @@ void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildNameResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UpdateBuildRegion(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UpdateBuildRegion(
     MultiplayerModels::FUpdateBuildRegionRequest& request,
     const FUpdateBuildRegionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2337,7 +2338,7 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateBuildRegion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildRegion"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildRegionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2354,7 +2355,7 @@ void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UpdateBuildRegions(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UpdateBuildRegions(
     MultiplayerModels::FUpdateBuildRegionsRequest& request,
     const FUpdateBuildRegionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2367,7 +2368,7 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateBuildRegions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildRegions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildRegionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2384,7 +2385,7 @@ void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UpdateLobby(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UpdateLobby(
     MultiplayerModels::FUpdateLobbyRequest& request,
     const FUpdateLobbyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2397,7 +2398,7 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateLobby(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/UpdateLobby"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateLobbyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateLobbyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateLobbyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2414,7 +2415,7 @@ void UPlayFabMultiplayerInstanceAPI::OnUpdateLobbyResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UpdateLobbyAsServer(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UpdateLobbyAsServer(
     MultiplayerModels::FUpdateLobbyAsServerRequest& request,
     const FUpdateLobbyAsServerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2427,7 +2428,7 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateLobbyAsServer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Lobby/UpdateLobbyAsServer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateLobbyAsServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateLobbyAsServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateLobbyAsServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2444,7 +2445,7 @@ void UPlayFabMultiplayerInstanceAPI::OnUpdateLobbyAsServerResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UploadCertificate(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UploadCertificate(
     MultiplayerModels::FUploadCertificateRequest& request,
     const FUploadCertificateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2457,7 +2458,7 @@ bool UPlayFabMultiplayerInstanceAPI::UploadCertificate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UploadCertificate"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUploadCertificateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUploadCertificateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUploadCertificateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2474,7 +2475,7 @@ void UPlayFabMultiplayerInstanceAPI::OnUploadCertificateResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabMultiplayerInstanceAPI::UploadSecret(
+FPlayFabRequestHandle UPlayFabMultiplayerInstanceAPI::UploadSecret(
     MultiplayerModels::FUploadSecretRequest& request,
     const FUploadSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2487,7 +2488,7 @@ bool UPlayFabMultiplayerInstanceAPI::UploadSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UploadSecret"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUploadSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUploadSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUploadSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2503,3 +2504,5 @@ void UPlayFabMultiplayerInstanceAPI::OnUploadSecretResult(FHttpRequestPtr HttpRe
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_MULTIPLAYER_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_PROFILES_API
 #include "Core/PlayFabProfilesAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabProfilesAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabProfilesAPI::GetGlobalPolicy(
+FPlayFabRequestHandle UPlayFabProfilesAPI::GetGlobalPolicy(
     ProfilesModels::FGetGlobalPolicyRequest& request,
     const FGetGlobalPolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabProfilesAPI::GetGlobalPolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetGlobalPolicy"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnGetGlobalPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesAPI::OnGetGlobalPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGlobalPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabProfilesAPI::OnGetGlobalPolicyResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabProfilesAPI::GetProfile(
+FPlayFabRequestHandle UPlayFabProfilesAPI::GetProfile(
     ProfilesModels::FGetEntityProfileRequest& request,
     const FGetProfileDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabProfilesAPI::GetProfile(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetProfile"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnGetProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesAPI::OnGetProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabProfilesAPI::OnGetProfileResult(FHttpRequestPtr HttpRequest, FHttpR
     }
 }
 
-bool UPlayFabProfilesAPI::GetProfiles(
+FPlayFabRequestHandle UPlayFabProfilesAPI::GetProfiles(
     ProfilesModels::FGetEntityProfilesRequest& request,
     const FGetProfilesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabProfilesAPI::GetProfiles(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetProfiles"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnGetProfilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesAPI::OnGetProfilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetProfilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabProfilesAPI::OnGetProfilesResult(FHttpRequestPtr HttpRequest, FHttp
     }
 }
 
-bool UPlayFabProfilesAPI::GetTitlePlayersFromMasterPlayerAccountIds(
+FPlayFabRequestHandle UPlayFabProfilesAPI::GetTitlePlayersFromMasterPlayerAccountIds(
     ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest& request,
     const FGetTitlePlayersFromMasterPlayerAccountIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabProfilesAPI::GetTitlePlayersFromMasterPlayerAccountIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetTitlePlayersFromMasterPlayerAccountIds"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnGetTitlePlayersFromMasterPlayerAccountIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesAPI::OnGetTitlePlayersFromMasterPlayerAccountIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePlayersFromMasterPlayerAccountIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabProfilesAPI::OnGetTitlePlayersFromMasterPlayerAccountIdsResult(FHtt
     }
 }
 
-bool UPlayFabProfilesAPI::GetTitlePlayersFromXboxLiveIDs(
+FPlayFabRequestHandle UPlayFabProfilesAPI::GetTitlePlayersFromXboxLiveIDs(
     ProfilesModels::FGetTitlePlayersFromXboxLiveIDsRequest& request,
     const FGetTitlePlayersFromXboxLiveIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabProfilesAPI::GetTitlePlayersFromXboxLiveIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetTitlePlayersFromXboxLiveIDs"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnGetTitlePlayersFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesAPI::OnGetTitlePlayersFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePlayersFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabProfilesAPI::OnGetTitlePlayersFromXboxLiveIDsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabProfilesAPI::SetDisplayName(
+FPlayFabRequestHandle UPlayFabProfilesAPI::SetDisplayName(
     ProfilesModels::FSetDisplayNameRequest& request,
     const FSetDisplayNameDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabProfilesAPI::SetDisplayName(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetDisplayName"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnSetDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesAPI::OnSetDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabProfilesAPI::OnSetDisplayNameResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabProfilesAPI::SetGlobalPolicy(
+FPlayFabRequestHandle UPlayFabProfilesAPI::SetGlobalPolicy(
     ProfilesModels::FSetGlobalPolicyRequest& request,
     const FSetGlobalPolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,7 +221,7 @@ bool UPlayFabProfilesAPI::SetGlobalPolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetGlobalPolicy"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnSetGlobalPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesAPI::OnSetGlobalPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetGlobalPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -237,7 +238,7 @@ void UPlayFabProfilesAPI::OnSetGlobalPolicyResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabProfilesAPI::SetProfileLanguage(
+FPlayFabRequestHandle UPlayFabProfilesAPI::SetProfileLanguage(
     ProfilesModels::FSetProfileLanguageRequest& request,
     const FSetProfileLanguageDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -250,7 +251,7 @@ bool UPlayFabProfilesAPI::SetProfileLanguage(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetProfileLanguage"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnSetProfileLanguageResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesAPI::OnSetProfileLanguageResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetProfileLanguageDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -267,7 +268,7 @@ void UPlayFabProfilesAPI::OnSetProfileLanguageResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabProfilesAPI::SetProfilePolicy(
+FPlayFabRequestHandle UPlayFabProfilesAPI::SetProfilePolicy(
     ProfilesModels::FSetEntityProfilePolicyRequest& request,
     const FSetProfilePolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -280,7 +281,7 @@ bool UPlayFabProfilesAPI::SetProfilePolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetProfilePolicy"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnSetProfilePolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesAPI::OnSetProfilePolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetProfilePolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -296,3 +297,5 @@ void UPlayFabProfilesAPI::OnSetProfilePolicyResult(FHttpRequestPtr HttpRequest,
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_PROFILES_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_PROFILES_API
 
 #include "Core/PlayFabProfilesDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -28,14 +29,14 @@ ProfilesModels::EffectType PlayFab::ProfilesModels::readEffectTypeFromValue(cons
 
 ProfilesModels::EffectType PlayFab::ProfilesModels::readEffectTypeFromValue(const FString& value)
 {
-    static TMap<FString, EffectType> _EffectTypeMap;
-    if (_EffectTypeMap.Num() == 0)
+    static const TMap<FString, EffectType> _EffectTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _EffectTypeMap.Add(TEXT("Allow"), EffectTypeAllow);
-        _EffectTypeMap.Add(TEXT("Deny"), EffectTypeDeny);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, EffectType> Map;
+        Map.Add(TEXT("Allow"), EffectTypeAllow);
+        Map.Add(TEXT("Deny"), EffectTypeDeny);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -120,7 +121,7 @@ void PlayFab::ProfilesModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -165,7 +166,7 @@ void PlayFab::ProfilesModels::FEntityLineage::writeJSON(JsonWriter& writer) cons
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (GroupId.IsEmpty() == false)
@@ -619,6 +620,7 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* FilesObject;
     if (obj->TryGetObjectField(TEXT("Files"), FilesObject))
     {
+        Files.Reserve((*FilesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*FilesObject)->Values); It; ++It)
         {
             Files.Add(It.Key(), FEntityProfileFileMetadata(It.Value()->AsObject()));
@@ -641,6 +643,7 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* ObjectsObject;
     if (obj->TryGetObjectField(TEXT("Objects"), ObjectsObject))
     {
+        Objects.Reserve((*ObjectsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ObjectsObject)->Values); It; ++It)
         {
             Objects.Add(It.Key(), FEntityDataObject(It.Value()->AsObject()));
@@ -648,16 +651,13 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PermissionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Permissions"));
-    for (int32 Idx = 0; Idx < PermissionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PermissionsArray[Idx];
-        Permissions.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PermissionsArray, Permissions);
 
 
     const TSharedPtr<FJsonObject>* StatisticsObject;
     if (obj->TryGetObjectField(TEXT("Statistics"), StatisticsObject))
     {
+        Statistics.Reserve((*StatisticsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*StatisticsObject)->Values); It; ++It)
         {
             Statistics.Add(It.Key(), FEntityStatisticValue(It.Value()->AsObject()));
@@ -717,6 +717,7 @@ bool PlayFab::ProfilesModels::FGetEntityProfileRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -813,6 +814,7 @@ bool PlayFab::ProfilesModels::FGetEntityProfilesRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -827,11 +829,7 @@ bool PlayFab::ProfilesModels::FGetEntityProfilesRequest::readFromValue(const TSh
     }
 
     const TArray<TSharedPtr<FJsonValue>>&EntitiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Entities"));
-    for (int32 Idx = 0; Idx < EntitiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = EntitiesArray[Idx];
-        Entities.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(EntitiesArray, Entities);
 
 
     return HasSucceeded;
@@ -863,11 +861,7 @@ bool PlayFab::ProfilesModels::FGetEntityProfilesResponse::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ProfilesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Profiles"));
-    for (int32 Idx = 0; Idx < ProfilesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ProfilesArray[Idx];
-        Profiles.Add(FEntityProfileBody(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ProfilesArray, Profiles);
 
 
     return HasSucceeded;
@@ -910,6 +904,7 @@ bool PlayFab::ProfilesModels::FGetGlobalPolicyRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -951,11 +946,7 @@ bool PlayFab::ProfilesModels::FGetGlobalPolicyResponse::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&PermissionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Permissions"));
-    for (int32 Idx = 0; Idx < PermissionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PermissionsArray[Idx];
-        Permissions.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PermissionsArray, Permissions);
 
 
     return HasSucceeded;
@@ -1003,6 +994,7 @@ bool PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest:
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1064,6 +1056,7 @@ bool PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse
     const TSharedPtr<FJsonObject>* TitlePlayerAccountsObject;
     if (obj->TryGetObjectField(TEXT("TitlePlayerAccounts"), TitlePlayerAccountsObject))
     {
+        TitlePlayerAccounts.Reserve((*TitlePlayerAccountsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TitlePlayerAccountsObject)->Values); It; ++It)
         {
             TitlePlayerAccounts.Add(It.Key(), FEntityKey(It.Value()->AsObject()));
@@ -1103,6 +1096,7 @@ bool PlayFab::ProfilesModels::FGetTitlePlayersFromProviderIDsResponse::readFromV
     const TSharedPtr<FJsonObject>* TitlePlayerAccountsObject;
     if (obj->TryGetObjectField(TEXT("TitlePlayerAccounts"), TitlePlayerAccountsObject))
     {
+        TitlePlayerAccounts.Reserve((*TitlePlayerAccountsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TitlePlayerAccountsObject)->Values); It; ++It)
         {
             TitlePlayerAccounts.Add(It.Key(), FEntityLineage(It.Value()->AsObject()));
@@ -1164,6 +1158,7 @@ bool PlayFab::ProfilesModels::FGetTitlePlayersFromXboxLiveIDsRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1208,16 +1203,16 @@ ProfilesModels::OperationTypes PlayFab::ProfilesModels::readOperationTypesFromVa
 
 ProfilesModels::OperationTypes PlayFab::ProfilesModels::readOperationTypesFromValue(const FString& value)
 {
-    static TMap<FString, OperationTypes> _OperationTypesMap;
-    if (_OperationTypesMap.Num() == 0)
+    static const TMap<FString, OperationTypes> _OperationTypesMap = []()
     {
-        // Auto-generate the map on the first use
-        _OperationTypesMap.Add(TEXT("Created"), OperationTypesCreated);
-        _OperationTypesMap.Add(TEXT("Updated"), OperationTypesUpdated);
-        _OperationTypesMap.Add(TEXT("Deleted"), OperationTypesDeleted);
-        _OperationTypesMap.Add(TEXT("None"), OperationTypesNone);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, OperationTypes> Map;
+        Map.Add(TEXT("Created"), OperationTypesCreated);
+        Map.Add(TEXT("Updated"), OperationTypesUpdated);
+        Map.Add(TEXT("Deleted"), OperationTypesDeleted);
+        Map.Add(TEXT("None"), OperationTypesNone);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1278,6 +1273,7 @@ bool PlayFab::ProfilesModels::FSetDisplayNameRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1386,6 +1382,7 @@ bool PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1399,11 +1396,7 @@ bool PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::readFromValue(cons
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatementsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statements"));
-    for (int32 Idx = 0; Idx < StatementsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatementsArray[Idx];
-        Statements.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatementsArray, Statements);
 
 
     return HasSucceeded;
@@ -1435,11 +1428,7 @@ bool PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&PermissionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Permissions"));
-    for (int32 Idx = 0; Idx < PermissionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PermissionsArray[Idx];
-        Permissions.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PermissionsArray, Permissions);
 
 
     return HasSucceeded;
@@ -1484,6 +1473,7 @@ bool PlayFab::ProfilesModels::FSetGlobalPolicyRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1491,11 +1481,7 @@ bool PlayFab::ProfilesModels::FSetGlobalPolicyRequest::readFromValue(const TShar
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PermissionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Permissions"));
-    for (int32 Idx = 0; Idx < PermissionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PermissionsArray[Idx];
-        Permissions.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PermissionsArray, Permissions);
 
 
     return HasSucceeded;
@@ -1569,6 +1555,7 @@ bool PlayFab::ProfilesModels::FSetProfileLanguageRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1638,3 +1625,5 @@ bool PlayFab::ProfilesModels::FSetProfileLanguageResponse::readFromValue(const T
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_PROFILES_API
@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_PROFILES_API
 #include "Core/PlayFabProfilesInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabProfilesInstanceAPI::GetOrCrea
     return this->authContext;
 }
 
-bool UPlayFabProfilesInstanceAPI::GetGlobalPolicy(
+FPlayFabRequestHandle UPlayFabProfilesInstanceAPI::GetGlobalPolicy(
     ProfilesModels::FGetGlobalPolicyRequest& request,
     const FGetGlobalPolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabProfilesInstanceAPI::GetGlobalPolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Profile/GetGlobalPolicy"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesInstanceAPI::OnGetGlobalPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesInstanceAPI::OnGetGlobalPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGlobalPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabProfilesInstanceAPI::OnGetGlobalPolicyResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabProfilesInstanceAPI::GetProfile(
+FPlayFabRequestHandle UPlayFabProfilesInstanceAPI::GetProfile(
     ProfilesModels::FGetEntityProfileRequest& request,
     const FGetProfileDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabProfilesInstanceAPI::GetProfile(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Profile/GetProfile"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesInstanceAPI::OnGetProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesInstanceAPI::OnGetProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabProfilesInstanceAPI::OnGetProfileResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabProfilesInstanceAPI::GetProfiles(
+FPlayFabRequestHandle UPlayFabProfilesInstanceAPI::GetProfiles(
     ProfilesModels::FGetEntityProfilesRequest& request,
     const FGetProfilesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabProfilesInstanceAPI::GetProfiles(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Profile/GetProfiles"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesInstanceAPI::OnGetProfilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesInstanceAPI::OnGetProfilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetProfilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabProfilesInstanceAPI::OnGetProfilesResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabProfilesInstanceAPI::GetTitlePlayersFromMasterPlayerAccountIds(
+FPlayFabRequestHandle UPlayFabProfilesInstanceAPI::GetTitlePlayersFromMasterPlayerAccountIds(
     ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest& request,
     const FGetTitlePlayersFromMasterPlayerAccountIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabProfilesInstanceAPI::GetTitlePlayersFromMasterPlayerAccountIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Profile/GetTitlePlayersFromMasterPlayerAccountIds"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesInstanceAPI::OnGetTitlePlayersFromMasterPlayerAccountIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesInstanceAPI::OnGetTitlePlayersFromMasterPlayerAccountIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePlayersFromMasterPlayerAccountIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabProfilesInstanceAPI::OnGetTitlePlayersFromMasterPlayerAccountIdsRes
     }
 }
 
-bool UPlayFabProfilesInstanceAPI::GetTitlePlayersFromXboxLiveIDs(
+FPlayFabRequestHandle UPlayFabProfilesInstanceAPI::GetTitlePlayersFromXboxLiveIDs(
     ProfilesModels::FGetTitlePlayersFromXboxLiveIDsRequest& request,
     const FGetTitlePlayersFromXboxLiveIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabProfilesInstanceAPI::GetTitlePlayersFromXboxLiveIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Profile/GetTitlePlayersFromXboxLiveIDs"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesInstanceAPI::OnGetTitlePlayersFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesInstanceAPI::OnGetTitlePlayersFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePlayersFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabProfilesInstanceAPI::OnGetTitlePlayersFromXboxLiveIDsResult(FHttpRe
     }
 }
 
-bool UPlayFabProfilesInstanceAPI::SetDisplayName(
+FPlayFabRequestHandle UPlayFabProfilesInstanceAPI::SetDisplayName(
     ProfilesModels::FSetDisplayNameRequest& request,
     const FSetDisplayNameDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabProfilesInstanceAPI::SetDisplayName(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Profile/SetDisplayName"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesInstanceAPI::OnSetDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesInstanceAPI::OnSetDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabProfilesInstanceAPI::OnSetDisplayNameResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabProfilesInstanceAPI::SetGlobalPolicy(
+FPlayFabRequestHandle UPlayFabProfilesInstanceAPI::SetGlobalPolicy(
     ProfilesModels::FSetGlobalPolicyRequest& request,
     const FSetGlobalPolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabProfilesInstanceAPI::SetGlobalPolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Profile/SetGlobalPolicy"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesInstanceAPI::OnSetGlobalPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesInstanceAPI::OnSetGlobalPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetGlobalPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabProfilesInstanceAPI::OnSetGlobalPolicyResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabProfilesInstanceAPI::SetProfileLanguage(
+FPlayFabRequestHandle UPlayFabProfilesInstanceAPI::SetProfileLanguage(
     ProfilesModels::FSetProfileLanguageRequest& request,
     const FSetProfileLanguageDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabProfilesInstanceAPI::SetProfileLanguage(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Profile/SetProfileLanguage"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesInstanceAPI::OnSetProfileLanguageResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesInstanceAPI::OnSetProfileLanguageResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetProfileLanguageDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabProfilesInstanceAPI::OnSetProfileLanguageResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabProfilesInstanceAPI::SetProfilePolicy(
+FPlayFabRequestHandle UPlayFabProfilesInstanceAPI::SetProfilePolicy(
     ProfilesModels::FSetEntityProfilePolicyRequest& request,
     const FSetProfilePolicyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabProfilesInstanceAPI::SetProfilePolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Profile/SetProfilePolicy"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesInstanceAPI::OnSetProfilePolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProfilesInstanceAPI::OnSetProfilePolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetProfilePolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -346,3 +347,5 @@ void UPlayFabProfilesInstanceAPI::OnSetProfilePolicyResult(FHttpRequestPtr HttpR
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_PROFILES_API
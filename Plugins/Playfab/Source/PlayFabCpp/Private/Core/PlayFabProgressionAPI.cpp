@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_PROGRESSION_API
 #include "Core/PlayFabProgressionAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -27,7 +28,7 @@ FString UPlayFabProgressionAPI::GetBuildIdentifier() const
 }
 
 
-bool UPlayFabProgressionAPI::CreateLeaderboardDefinition(
+FPlayFabRequestHandle UPlayFabProgressionAPI::CreateLeaderboardDefinition(
     ProgressionModels::FCreateLeaderboardDefinitionRequest& request,
     const FCreateLeaderboardDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -40,7 +41,7 @@ bool UPlayFabProgressionAPI::CreateLeaderboardDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/CreateLeaderboardDefinition"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnCreateLeaderboardDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnCreateLeaderboardDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateLeaderboardDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -57,7 +58,7 @@ void UPlayFabProgressionAPI::OnCreateLeaderboardDefinitionResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabProgressionAPI::CreateStatisticDefinition(
+FPlayFabRequestHandle UPlayFabProgressionAPI::CreateStatisticDefinition(
     ProgressionModels::FCreateStatisticDefinitionRequest& request,
     const FCreateStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -70,7 +71,7 @@ bool UPlayFabProgressionAPI::CreateStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/CreateStatisticDefinition"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnCreateStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnCreateStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -87,7 +88,7 @@ void UPlayFabProgressionAPI::OnCreateStatisticDefinitionResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabProgressionAPI::DeleteLeaderboardDefinition(
+FPlayFabRequestHandle UPlayFabProgressionAPI::DeleteLeaderboardDefinition(
     ProgressionModels::FDeleteLeaderboardDefinitionRequest& request,
     const FDeleteLeaderboardDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -100,7 +101,7 @@ bool UPlayFabProgressionAPI::DeleteLeaderboardDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/DeleteLeaderboardDefinition"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnDeleteLeaderboardDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnDeleteLeaderboardDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteLeaderboardDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -117,7 +118,7 @@ void UPlayFabProgressionAPI::OnDeleteLeaderboardDefinitionResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabProgressionAPI::DeleteLeaderboardEntries(
+FPlayFabRequestHandle UPlayFabProgressionAPI::DeleteLeaderboardEntries(
     ProgressionModels::FDeleteLeaderboardEntriesRequest& request,
     const FDeleteLeaderboardEntriesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -130,7 +131,7 @@ bool UPlayFabProgressionAPI::DeleteLeaderboardEntries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/DeleteLeaderboardEntries"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnDeleteLeaderboardEntriesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnDeleteLeaderboardEntriesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteLeaderboardEntriesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -147,7 +148,7 @@ void UPlayFabProgressionAPI::OnDeleteLeaderboardEntriesResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabProgressionAPI::DeleteStatisticDefinition(
+FPlayFabRequestHandle UPlayFabProgressionAPI::DeleteStatisticDefinition(
     ProgressionModels::FDeleteStatisticDefinitionRequest& request,
     const FDeleteStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -160,7 +161,7 @@ bool UPlayFabProgressionAPI::DeleteStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/DeleteStatisticDefinition"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnDeleteStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnDeleteStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -177,7 +178,7 @@ void UPlayFabProgressionAPI::OnDeleteStatisticDefinitionResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabProgressionAPI::DeleteStatistics(
+FPlayFabRequestHandle UPlayFabProgressionAPI::DeleteStatistics(
     ProgressionModels::FDeleteStatisticsRequest& request,
     const FDeleteStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -190,7 +191,7 @@ bool UPlayFabProgressionAPI::DeleteStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/DeleteStatistics"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnDeleteStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnDeleteStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -207,7 +208,7 @@ void UPlayFabProgressionAPI::OnDeleteStatisticsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabProgressionAPI::GetFriendLeaderboardForEntity(
+FPlayFabRequestHandle UPlayFabProgressionAPI::GetFriendLeaderboardForEntity(
     ProgressionModels::FGetFriendLeaderboardForEntityRequest& request,
     const FGetFriendLeaderboardForEntityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -220,7 +221,7 @@ bool UPlayFabProgressionAPI::GetFriendLeaderboardForEntity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/GetFriendLeaderboardForEntity"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnGetFriendLeaderboardForEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnGetFriendLeaderboardForEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardForEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -237,7 +238,7 @@ void UPlayFabProgressionAPI::OnGetFriendLeaderboardForEntityResult(FHttpRequestP
     }
 }
 
-bool UPlayFabProgressionAPI::GetLeaderboard(
+FPlayFabRequestHandle UPlayFabProgressionAPI::GetLeaderboard(
     ProgressionModels::FGetEntityLeaderboardRequest& request,
     const FGetLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -250,7 +251,7 @@ bool UPlayFabProgressionAPI::GetLeaderboard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/GetLeaderboard"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -267,7 +268,7 @@ void UPlayFabProgressionAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabProgressionAPI::GetLeaderboardAroundEntity(
+FPlayFabRequestHandle UPlayFabProgressionAPI::GetLeaderboardAroundEntity(
     ProgressionModels::FGetLeaderboardAroundEntityRequest& request,
     const FGetLeaderboardAroundEntityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -280,7 +281,7 @@ bool UPlayFabProgressionAPI::GetLeaderboardAroundEntity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/GetLeaderboardAroundEntity"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnGetLeaderboardAroundEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnGetLeaderboardAroundEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -297,7 +298,7 @@ void UPlayFabProgressionAPI::OnGetLeaderboardAroundEntityResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabProgressionAPI::GetLeaderboardDefinition(
+FPlayFabRequestHandle UPlayFabProgressionAPI::GetLeaderboardDefinition(
     ProgressionModels::FGetLeaderboardDefinitionRequest& request,
     const FGetLeaderboardDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -310,7 +311,7 @@ bool UPlayFabProgressionAPI::GetLeaderboardDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/GetLeaderboardDefinition"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnGetLeaderboardDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnGetLeaderboardDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -327,7 +328,7 @@ void UPlayFabProgressionAPI::OnGetLeaderboardDefinitionResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabProgressionAPI::GetLeaderboardForEntities(
+FPlayFabRequestHandle UPlayFabProgressionAPI::GetLeaderboardForEntities(
     ProgressionModels::FGetLeaderboardForEntitiesRequest& request,
     const FGetLeaderboardForEntitiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -340,7 +341,7 @@ bool UPlayFabProgressionAPI::GetLeaderboardForEntities(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/GetLeaderboardForEntities"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnGetLeaderboardForEntitiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnGetLeaderboardForEntitiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForEntitiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -357,7 +358,7 @@ void UPlayFabProgressionAPI::OnGetLeaderboardForEntitiesResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabProgressionAPI::GetStatisticDefinition(
+FPlayFabRequestHandle UPlayFabProgressionAPI::GetStatisticDefinition(
     ProgressionModels::FGetStatisticDefinitionRequest& request,
     const FGetStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -370,7 +371,7 @@ bool UPlayFabProgressionAPI::GetStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/GetStatisticDefinition"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnGetStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnGetStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -387,7 +388,7 @@ void UPlayFabProgressionAPI::OnGetStatisticDefinitionResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabProgressionAPI::GetStatistics(
+FPlayFabRequestHandle UPlayFabProgressionAPI::GetStatistics(
     ProgressionModels::FGetStatisticsRequest& request,
     const FGetStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -400,7 +401,7 @@ bool UPlayFabProgressionAPI::GetStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/GetStatistics"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnGetStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnGetStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -417,7 +418,7 @@ void UPlayFabProgressionAPI::OnGetStatisticsResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabProgressionAPI::GetStatisticsForEntities(
+FPlayFabRequestHandle UPlayFabProgressionAPI::GetStatisticsForEntities(
     ProgressionModels::FGetStatisticsForEntitiesRequest& request,
     const FGetStatisticsForEntitiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -430,7 +431,7 @@ bool UPlayFabProgressionAPI::GetStatisticsForEntities(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/GetStatisticsForEntities"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnGetStatisticsForEntitiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnGetStatisticsForEntitiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStatisticsForEntitiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -447,7 +448,7 @@ void UPlayFabProgressionAPI::OnGetStatisticsForEntitiesResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabProgressionAPI::IncrementLeaderboardVersion(
+FPlayFabRequestHandle UPlayFabProgressionAPI::IncrementLeaderboardVersion(
     ProgressionModels::FIncrementLeaderboardVersionRequest& request,
     const FIncrementLeaderboardVersionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -460,7 +461,7 @@ bool UPlayFabProgressionAPI::IncrementLeaderboardVersion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/IncrementLeaderboardVersion"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnIncrementLeaderboardVersionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnIncrementLeaderboardVersionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementLeaderboardVersionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -477,7 +478,7 @@ void UPlayFabProgressionAPI::OnIncrementLeaderboardVersionResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabProgressionAPI::IncrementStatisticVersion(
+FPlayFabRequestHandle UPlayFabProgressionAPI::IncrementStatisticVersion(
     ProgressionModels::FIncrementStatisticVersionRequest& request,
     const FIncrementStatisticVersionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -490,7 +491,7 @@ bool UPlayFabProgressionAPI::IncrementStatisticVersion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/IncrementStatisticVersion"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnIncrementStatisticVersionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnIncrementStatisticVersionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementStatisticVersionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -507,7 +508,7 @@ void UPlayFabProgressionAPI::OnIncrementStatisticVersionResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabProgressionAPI::ListLeaderboardDefinitions(
+FPlayFabRequestHandle UPlayFabProgressionAPI::ListLeaderboardDefinitions(
     ProgressionModels::FListLeaderboardDefinitionsRequest& request,
     const FListLeaderboardDefinitionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -520,7 +521,7 @@ bool UPlayFabProgressionAPI::ListLeaderboardDefinitions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/ListLeaderboardDefinitions"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnListLeaderboardDefinitionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnListLeaderboardDefinitionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListLeaderboardDefinitionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -537,7 +538,7 @@ void UPlayFabProgressionAPI::OnListLeaderboardDefinitionsResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabProgressionAPI::ListStatisticDefinitions(
+FPlayFabRequestHandle UPlayFabProgressionAPI::ListStatisticDefinitions(
     ProgressionModels::FListStatisticDefinitionsRequest& request,
     const FListStatisticDefinitionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -550,7 +551,7 @@ bool UPlayFabProgressionAPI::ListStatisticDefinitions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/ListStatisticDefinitions"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnListStatisticDefinitionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnListStatisticDefinitionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListStatisticDefinitionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -567,7 +568,7 @@ void UPlayFabProgressionAPI::OnListStatisticDefinitionsResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabProgressionAPI::UnlinkLeaderboardFromStatistic(
+FPlayFabRequestHandle UPlayFabProgressionAPI::UnlinkLeaderboardFromStatistic(
     ProgressionModels::FUnlinkLeaderboardFromStatisticRequest& request,
     const FUnlinkLeaderboardFromStatisticDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -580,7 +581,7 @@ bool UPlayFabProgressionAPI::UnlinkLeaderboardFromStatistic(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/UnlinkLeaderboardFromStatistic"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnUnlinkLeaderboardFromStatisticResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnUnlinkLeaderboardFromStatisticResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkLeaderboardFromStatisticDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -597,7 +598,7 @@ void UPlayFabProgressionAPI::OnUnlinkLeaderboardFromStatisticResult(FHttpRequest
     }
 }
 
-bool UPlayFabProgressionAPI::UpdateLeaderboardDefinition(
+FPlayFabRequestHandle UPlayFabProgressionAPI::UpdateLeaderboardDefinition(
     ProgressionModels::FUpdateLeaderboardDefinitionRequest& request,
     const FUpdateLeaderboardDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -610,7 +611,7 @@ bool UPlayFabProgressionAPI::UpdateLeaderboardDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/UpdateLeaderboardDefinition"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnUpdateLeaderboardDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnUpdateLeaderboardDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateLeaderboardDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -627,7 +628,7 @@ void UPlayFabProgressionAPI::OnUpdateLeaderboardDefinitionResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabProgressionAPI::UpdateLeaderboardEntries(
+FPlayFabRequestHandle UPlayFabProgressionAPI::UpdateLeaderboardEntries(
     ProgressionModels::FUpdateLeaderboardEntriesRequest& request,
     const FUpdateLeaderboardEntriesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -640,7 +641,7 @@ bool UPlayFabProgressionAPI::UpdateLeaderboardEntries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Leaderboard/UpdateLeaderboardEntries"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnUpdateLeaderboardEntriesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnUpdateLeaderboardEntriesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateLeaderboardEntriesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -657,7 +658,7 @@ void UPlayFabProgressionAPI::OnUpdateLeaderboardEntriesResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabProgressionAPI::UpdateStatisticDefinition(
+FPlayFabRequestHandle UPlayFabProgressionAPI::UpdateStatisticDefinition(
     ProgressionModels::FUpdateStatisticDefinitionRequest& request,
     const FUpdateStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -670,7 +671,7 @@ bool UPlayFabProgressionAPI::UpdateStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/UpdateStatisticDefinition"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnUpdateStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnUpdateStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -687,7 +688,7 @@ void UPlayFabProgressionAPI::OnUpdateStatisticDefinitionResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabProgressionAPI::UpdateStatistics(
+FPlayFabRequestHandle UPlayFabProgressionAPI::UpdateStatistics(
     ProgressionModels::FUpdateStatisticsRequest& request,
     const FUpdateStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -700,7 +701,7 @@ bool UPlayFabProgressionAPI::UpdateStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Statistic/UpdateStatistics"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionAPI::OnUpdateStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionAPI::OnUpdateStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -716,3 +717,5 @@ void UPlayFabProgressionAPI::OnUpdateStatisticsResult(FHttpRequestPtr HttpReques
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_PROGRESSION_API
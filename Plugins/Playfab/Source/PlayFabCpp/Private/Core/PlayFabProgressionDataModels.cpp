@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_PROGRESSION_API
 
 #include "Core/PlayFabProgressionDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -81,14 +82,14 @@ ProgressionModels::LeaderboardSortDirection PlayFab::ProgressionModels::readLead
 
 ProgressionModels::LeaderboardSortDirection PlayFab::ProgressionModels::readLeaderboardSortDirectionFromValue(const FString& value)
 {
-    static TMap<FString, LeaderboardSortDirection> _LeaderboardSortDirectionMap;
-    if (_LeaderboardSortDirectionMap.Num() == 0)
+    static const TMap<FString, LeaderboardSortDirection> _LeaderboardSortDirectionMap = []()
     {
-        // Auto-generate the map on the first use
-        _LeaderboardSortDirectionMap.Add(TEXT("Descending"), LeaderboardSortDirectionDescending);
-        _LeaderboardSortDirectionMap.Add(TEXT("Ascending"), LeaderboardSortDirectionAscending);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, LeaderboardSortDirection> Map;
+        Map.Add(TEXT("Descending"), LeaderboardSortDirectionDescending);
+        Map.Add(TEXT("Ascending"), LeaderboardSortDirectionAscending);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -174,17 +175,17 @@ ProgressionModels::ResetInterval PlayFab::ProgressionModels::readResetIntervalFr
 
 ProgressionModels::ResetInterval PlayFab::ProgressionModels::readResetIntervalFromValue(const FString& value)
 {
-    static TMap<FString, ResetInterval> _ResetIntervalMap;
-    if (_ResetIntervalMap.Num() == 0)
+    static const TMap<FString, ResetInterval> _ResetIntervalMap = []()
     {
-        // Auto-generate the map on the first use
-        _ResetIntervalMap.Add(TEXT("Manual"), ResetIntervalManual);
-        _ResetIntervalMap.Add(TEXT("Hour"), ResetIntervalHour);
-        _ResetIntervalMap.Add(TEXT("Day"), ResetIntervalDay);
-        _ResetIntervalMap.Add(TEXT("Week"), ResetIntervalWeek);
-        _ResetIntervalMap.Add(TEXT("Month"), ResetIntervalMonth);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ResetInterval> Map;
+        Map.Add(TEXT("Manual"), ResetIntervalManual);
+        Map.Add(TEXT("Hour"), ResetIntervalHour);
+        Map.Add(TEXT("Day"), ResetIntervalDay);
+        Map.Add(TEXT("Week"), ResetIntervalWeek);
+        Map.Add(TEXT("Month"), ResetIntervalMonth);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -290,16 +291,13 @@ bool PlayFab::ProgressionModels::FCreateLeaderboardDefinitionRequest::readFromVa
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ColumnsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Columns"));
-    for (int32 Idx = 0; Idx < ColumnsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ColumnsArray[Idx];
-        Columns.Add(FLeaderboardColumn(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ColumnsArray, Columns);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -355,16 +353,16 @@ ProgressionModels::StatisticAggregationMethod PlayFab::ProgressionModels::readSt
 
 ProgressionModels::StatisticAggregationMethod PlayFab::ProgressionModels::readStatisticAggregationMethodFromValue(const FString& value)
 {
-    static TMap<FString, StatisticAggregationMethod> _StatisticAggregationMethodMap;
-    if (_StatisticAggregationMethodMap.Num() == 0)
+    static const TMap<FString, StatisticAggregationMethod> _StatisticAggregationMethodMap = []()
     {
-        // Auto-generate the map on the first use
-        _StatisticAggregationMethodMap.Add(TEXT("Last"), StatisticAggregationMethodLast);
-        _StatisticAggregationMethodMap.Add(TEXT("Min"), StatisticAggregationMethodMin);
-        _StatisticAggregationMethodMap.Add(TEXT("Max"), StatisticAggregationMethodMax);
-        _StatisticAggregationMethodMap.Add(TEXT("Sum"), StatisticAggregationMethodSum);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, StatisticAggregationMethod> Map;
+        Map.Add(TEXT("Last"), StatisticAggregationMethodLast);
+        Map.Add(TEXT("Min"), StatisticAggregationMethodMin);
+        Map.Add(TEXT("Max"), StatisticAggregationMethodMax);
+        Map.Add(TEXT("Sum"), StatisticAggregationMethodSum);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -477,16 +475,13 @@ bool PlayFab::ProgressionModels::FCreateStatisticDefinitionRequest::readFromValu
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ColumnsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Columns"));
-    for (int32 Idx = 0; Idx < ColumnsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ColumnsArray[Idx];
-        Columns.Add(FStatisticColumn(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ColumnsArray, Columns);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -556,6 +551,7 @@ bool PlayFab::ProgressionModels::FDeleteLeaderboardDefinitionRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -621,6 +617,7 @@ bool PlayFab::ProgressionModels::FDeleteLeaderboardEntriesRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -679,6 +676,7 @@ bool PlayFab::ProgressionModels::FDeleteStatisticDefinitionRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -711,7 +709,7 @@ void PlayFab::ProgressionModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -823,6 +821,7 @@ bool PlayFab::ProgressionModels::FDeleteStatisticsRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -836,11 +835,7 @@ bool PlayFab::ProgressionModels::FDeleteStatisticsRequest::readFromValue(const T
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticDelete(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     return HasSucceeded;
@@ -1089,11 +1084,7 @@ bool PlayFab::ProgressionModels::FEntityStatistics::readFromValue(const TSharedP
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FEntityStatisticValue(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     return HasSucceeded;
@@ -1120,18 +1111,18 @@ ProgressionModels::ExternalFriendSources PlayFab::ProgressionModels::readExterna
 
 ProgressionModels::ExternalFriendSources PlayFab::ProgressionModels::readExternalFriendSourcesFromValue(const FString& value)
 {
-    static TMap<FString, ExternalFriendSources> _ExternalFriendSourcesMap;
-    if (_ExternalFriendSourcesMap.Num() == 0)
+    static const TMap<FString, ExternalFriendSources> _ExternalFriendSourcesMap = []()
     {
-        // Auto-generate the map on the first use
-        _ExternalFriendSourcesMap.Add(TEXT("None"), ExternalFriendSourcesNone);
-        _ExternalFriendSourcesMap.Add(TEXT("Steam"), ExternalFriendSourcesSteam);
-        _ExternalFriendSourcesMap.Add(TEXT("Facebook"), ExternalFriendSourcesFacebook);
-        _ExternalFriendSourcesMap.Add(TEXT("Xbox"), ExternalFriendSourcesXbox);
-        _ExternalFriendSourcesMap.Add(TEXT("Psn"), ExternalFriendSourcesPsn);
-        _ExternalFriendSourcesMap.Add(TEXT("All"), ExternalFriendSourcesAll);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ExternalFriendSources> Map;
+        Map.Add(TEXT("None"), ExternalFriendSourcesNone);
+        Map.Add(TEXT("Steam"), ExternalFriendSourcesSteam);
+        Map.Add(TEXT("Facebook"), ExternalFriendSourcesFacebook);
+        Map.Add(TEXT("Xbox"), ExternalFriendSourcesXbox);
+        Map.Add(TEXT("Psn"), ExternalFriendSourcesPsn);
+        Map.Add(TEXT("All"), ExternalFriendSourcesAll);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1198,6 +1189,7 @@ bool PlayFab::ProgressionModels::FGetEntityLeaderboardRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1282,11 +1274,7 @@ bool PlayFab::ProgressionModels::FGetEntityLeaderboardResponse::readFromValue(co
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ColumnsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Columns"));
-    for (int32 Idx = 0; Idx < ColumnsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ColumnsArray[Idx];
-        Columns.Add(FLeaderboardColumn(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ColumnsArray, Columns);
 
 
     const TSharedPtr<FJsonValue> EntryCountValue = obj->TryGetField(TEXT("EntryCount"));
@@ -1302,11 +1290,7 @@ bool PlayFab::ProgressionModels::FGetEntityLeaderboardResponse::readFromValue(co
 
 
     const TArray<TSharedPtr<FJsonValue>>&RankingsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Rankings"));
-    for (int32 Idx = 0; Idx < RankingsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = RankingsArray[Idx];
-        Rankings.Add(FEntityLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(RankingsArray, Rankings);
 
 
     const TSharedPtr<FJsonValue> VersionValue = obj->TryGetField(TEXT("Version"));
@@ -1384,6 +1368,7 @@ bool PlayFab::ProgressionModels::FGetFriendLeaderboardForEntityRequest::readFrom
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1478,6 +1463,7 @@ bool PlayFab::ProgressionModels::FGetLeaderboardAroundEntityRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1554,6 +1540,7 @@ bool PlayFab::ProgressionModels::FGetLeaderboardDefinitionRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1631,11 +1618,7 @@ bool PlayFab::ProgressionModels::FGetLeaderboardDefinitionResponse::readFromValu
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ColumnsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Columns"));
-    for (int32 Idx = 0; Idx < ColumnsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ColumnsArray[Idx];
-        Columns.Add(FLeaderboardColumn(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ColumnsArray, Columns);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -1737,6 +1720,7 @@ bool PlayFab::ProgressionModels::FGetLeaderboardForEntitiesRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1802,6 +1786,7 @@ bool PlayFab::ProgressionModels::FGetStatisticDefinitionRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1884,11 +1869,7 @@ bool PlayFab::ProgressionModels::FGetStatisticDefinitionResponse::readFromValue(
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ColumnsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Columns"));
-    for (int32 Idx = 0; Idx < ColumnsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ColumnsArray[Idx];
-        Columns.Add(FStatisticColumn(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ColumnsArray, Columns);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -1969,6 +1950,7 @@ bool PlayFab::ProgressionModels::FGetStatisticsForEntitiesRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -1976,11 +1958,7 @@ bool PlayFab::ProgressionModels::FGetStatisticsForEntitiesRequest::readFromValue
     }
 
     const TArray<TSharedPtr<FJsonValue>>&EntitiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Entities"));
-    for (int32 Idx = 0; Idx < EntitiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = EntitiesArray[Idx];
-        Entities.Add(FEntityKey(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(EntitiesArray, Entities);
 
 
     return HasSucceeded;
@@ -2012,11 +1990,7 @@ bool PlayFab::ProgressionModels::FStatisticColumnCollection::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ColumnsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Columns"));
-    for (int32 Idx = 0; Idx < ColumnsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ColumnsArray[Idx];
-        Columns.Add(FStatisticColumn(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ColumnsArray, Columns);
 
 
     return HasSucceeded;
@@ -2061,6 +2035,7 @@ bool PlayFab::ProgressionModels::FGetStatisticsForEntitiesResponse::readFromValu
     const TSharedPtr<FJsonObject>* ColumnDetailsObject;
     if (obj->TryGetObjectField(TEXT("ColumnDetails"), ColumnDetailsObject))
     {
+        ColumnDetails.Reserve((*ColumnDetailsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ColumnDetailsObject)->Values); It; ++It)
         {
             ColumnDetails.Add(It.Key(), FStatisticColumnCollection(It.Value()->AsObject()));
@@ -2068,11 +2043,7 @@ bool PlayFab::ProgressionModels::FGetStatisticsForEntitiesResponse::readFromValu
     }
 
     const TArray<TSharedPtr<FJsonValue>>&EntitiesStatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("EntitiesStatistics"));
-    for (int32 Idx = 0; Idx < EntitiesStatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = EntitiesStatisticsArray[Idx];
-        EntitiesStatistics.Add(FEntityStatistics(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(EntitiesStatisticsArray, EntitiesStatistics);
 
 
     return HasSucceeded;
@@ -2115,6 +2086,7 @@ bool PlayFab::ProgressionModels::FGetStatisticsRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2178,6 +2150,7 @@ bool PlayFab::ProgressionModels::FGetStatisticsResponse::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* ColumnDetailsObject;
     if (obj->TryGetObjectField(TEXT("ColumnDetails"), ColumnDetailsObject))
     {
+        ColumnDetails.Reserve((*ColumnDetailsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ColumnDetailsObject)->Values); It; ++It)
         {
             ColumnDetails.Add(It.Key(), FStatisticColumnCollection(It.Value()->AsObject()));
@@ -2193,6 +2166,7 @@ bool PlayFab::ProgressionModels::FGetStatisticsResponse::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* StatisticsObject;
     if (obj->TryGetObjectField(TEXT("Statistics"), StatisticsObject))
     {
+        Statistics.Reserve((*StatisticsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*StatisticsObject)->Values); It; ++It)
         {
             Statistics.Add(It.Key(), FEntityStatisticValue(It.Value()->AsObject()));
@@ -2242,6 +2216,7 @@ bool PlayFab::ProgressionModels::FIncrementLeaderboardVersionRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2327,6 +2302,7 @@ bool PlayFab::ProgressionModels::FIncrementStatisticVersionRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2433,11 +2409,7 @@ bool PlayFab::ProgressionModels::FLeaderboardDefinition::readFromValue(const TSh
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ColumnsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Columns"));
-    for (int32 Idx = 0; Idx < ColumnsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ColumnsArray[Idx];
-        Columns.Add(FLeaderboardColumn(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ColumnsArray, Columns);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -2577,6 +2549,7 @@ bool PlayFab::ProgressionModels::FListLeaderboardDefinitionsRequest::readFromVal
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2612,11 +2585,7 @@ bool PlayFab::ProgressionModels::FListLeaderboardDefinitionsResponse::readFromVa
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardDefinitionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("LeaderboardDefinitions"));
-    for (int32 Idx = 0; Idx < LeaderboardDefinitionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardDefinitionsArray[Idx];
-        LeaderboardDefinitions.Add(FLeaderboardDefinition(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardDefinitionsArray, LeaderboardDefinitions);
 
 
     return HasSucceeded;
@@ -2652,6 +2621,7 @@ bool PlayFab::ProgressionModels::FListStatisticDefinitionsRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2727,11 +2697,7 @@ bool PlayFab::ProgressionModels::FStatisticDefinition::readFromValue(const TShar
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ColumnsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Columns"));
-    for (int32 Idx = 0; Idx < ColumnsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ColumnsArray[Idx];
-        Columns.Add(FStatisticColumn(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ColumnsArray, Columns);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -2815,6 +2781,7 @@ bool PlayFab::ProgressionModels::FListStatisticDefinitionsResponse::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -2822,11 +2789,7 @@ bool PlayFab::ProgressionModels::FListStatisticDefinitionsResponse::readFromValu
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticDefinitionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("StatisticDefinitions"));
-    for (int32 Idx = 0; Idx < StatisticDefinitionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticDefinitionsArray[Idx];
-        StatisticDefinitions.Add(FStatisticDefinition(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticDefinitionsArray, StatisticDefinitions);
 
 
     return HasSucceeded;
@@ -2955,6 +2918,7 @@ bool PlayFab::ProgressionModels::FUnlinkLeaderboardFromStatisticRequest::readFro
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3031,6 +2995,7 @@ bool PlayFab::ProgressionModels::FUpdateLeaderboardDefinitionRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3109,6 +3074,7 @@ bool PlayFab::ProgressionModels::FUpdateLeaderboardEntriesRequest::readFromValue
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3116,11 +3082,7 @@ bool PlayFab::ProgressionModels::FUpdateLeaderboardEntriesRequest::readFromValue
     }
 
     const TArray<TSharedPtr<FJsonValue>>&EntriesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Entries"));
-    for (int32 Idx = 0; Idx < EntriesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = EntriesArray[Idx];
-        Entries.Add(FLeaderboardEntryUpdate(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(EntriesArray, Entries);
 
 
     const TSharedPtr<FJsonValue> LeaderboardNameValue = obj->TryGetField(TEXT("LeaderboardName"));
@@ -3180,6 +3142,7 @@ bool PlayFab::ProgressionModels::FUpdateStatisticDefinitionRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3251,6 +3214,7 @@ bool PlayFab::ProgressionModels::FUpdateStatisticsRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3264,11 +3228,7 @@ bool PlayFab::ProgressionModels::FUpdateStatisticsRequest::readFromValue(const T
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticUpdate(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     const TSharedPtr<FJsonValue> TransactionIdValue = obj->TryGetField(TEXT("TransactionId"));
@@ -3329,6 +3289,7 @@ bool PlayFab::ProgressionModels::FUpdateStatisticsResponse::readFromValue(const
     const TSharedPtr<FJsonObject>* ColumnDetailsObject;
     if (obj->TryGetObjectField(TEXT("ColumnDetails"), ColumnDetailsObject))
     {
+        ColumnDetails.Reserve((*ColumnDetailsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ColumnDetailsObject)->Values); It; ++It)
         {
             ColumnDetails.Add(It.Key(), FStatisticColumnCollection(It.Value()->AsObject()));
@@ -3344,6 +3305,7 @@ bool PlayFab::ProgressionModels::FUpdateStatisticsResponse::readFromValue(const
     const TSharedPtr<FJsonObject>* StatisticsObject;
     if (obj->TryGetObjectField(TEXT("Statistics"), StatisticsObject))
     {
+        Statistics.Reserve((*StatisticsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*StatisticsObject)->Values); It; ++It)
         {
             Statistics.Add(It.Key(), FEntityStatisticValue(It.Value()->AsObject()));
@@ -3353,3 +3315,5 @@ bool PlayFab::ProgressionModels::FUpdateStatisticsResponse::readFromValue(const
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_PROGRESSION_API
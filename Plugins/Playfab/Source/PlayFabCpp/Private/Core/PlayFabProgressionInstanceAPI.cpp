@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_PROGRESSION_API
 #include "Core/PlayFabProgressionInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabProgressionInstanceAPI::GetOrC
     return this->authContext;
 }
 
-bool UPlayFabProgressionInstanceAPI::CreateLeaderboardDefinition(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::CreateLeaderboardDefinition(
     ProgressionModels::FCreateLeaderboardDefinitionRequest& request,
     const FCreateLeaderboardDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabProgressionInstanceAPI::CreateLeaderboardDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/CreateLeaderboardDefinition"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnCreateLeaderboardDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnCreateLeaderboardDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateLeaderboardDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabProgressionInstanceAPI::OnCreateLeaderboardDefinitionResult(FHttpRe
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::CreateStatisticDefinition(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::CreateStatisticDefinition(
     ProgressionModels::FCreateStatisticDefinitionRequest& request,
     const FCreateStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabProgressionInstanceAPI::CreateStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/CreateStatisticDefinition"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnCreateStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnCreateStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabProgressionInstanceAPI::OnCreateStatisticDefinitionResult(FHttpRequ
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::DeleteLeaderboardDefinition(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::DeleteLeaderboardDefinition(
     ProgressionModels::FDeleteLeaderboardDefinitionRequest& request,
     const FDeleteLeaderboardDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabProgressionInstanceAPI::DeleteLeaderboardDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/DeleteLeaderboardDefinition"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnDeleteLeaderboardDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnDeleteLeaderboardDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteLeaderboardDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabProgressionInstanceAPI::OnDeleteLeaderboardDefinitionResult(FHttpRe
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::DeleteLeaderboardEntries(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::DeleteLeaderboardEntries(
     ProgressionModels::FDeleteLeaderboardEntriesRequest& request,
     const FDeleteLeaderboardEntriesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabProgressionInstanceAPI::DeleteLeaderboardEntries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/DeleteLeaderboardEntries"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnDeleteLeaderboardEntriesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnDeleteLeaderboardEntriesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteLeaderboardEntriesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabProgressionInstanceAPI::OnDeleteLeaderboardEntriesResult(FHttpReque
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::DeleteStatisticDefinition(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::DeleteStatisticDefinition(
     ProgressionModels::FDeleteStatisticDefinitionRequest& request,
     const FDeleteStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabProgressionInstanceAPI::DeleteStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/DeleteStatisticDefinition"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnDeleteStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnDeleteStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabProgressionInstanceAPI::OnDeleteStatisticDefinitionResult(FHttpRequ
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::DeleteStatistics(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::DeleteStatistics(
     ProgressionModels::FDeleteStatisticsRequest& request,
     const FDeleteStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabProgressionInstanceAPI::DeleteStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/DeleteStatistics"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnDeleteStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnDeleteStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabProgressionInstanceAPI::OnDeleteStatisticsResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::GetFriendLeaderboardForEntity(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::GetFriendLeaderboardForEntity(
     ProgressionModels::FGetFriendLeaderboardForEntityRequest& request,
     const FGetFriendLeaderboardForEntityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabProgressionInstanceAPI::GetFriendLeaderboardForEntity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/GetFriendLeaderboardForEntity"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnGetFriendLeaderboardForEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnGetFriendLeaderboardForEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardForEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabProgressionInstanceAPI::OnGetFriendLeaderboardForEntityResult(FHttp
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::GetLeaderboard(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::GetLeaderboard(
     ProgressionModels::FGetEntityLeaderboardRequest& request,
     const FGetLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabProgressionInstanceAPI::GetLeaderboard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/GetLeaderboard"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabProgressionInstanceAPI::OnGetLeaderboardResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::GetLeaderboardAroundEntity(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::GetLeaderboardAroundEntity(
     ProgressionModels::FGetLeaderboardAroundEntityRequest& request,
     const FGetLeaderboardAroundEntityDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabProgressionInstanceAPI::GetLeaderboardAroundEntity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/GetLeaderboardAroundEntity"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnGetLeaderboardAroundEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnGetLeaderboardAroundEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -347,7 +348,7 @@ void UPlayFabProgressionInstanceAPI::OnGetLeaderboardAroundEntityResult(FHttpReq
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::GetLeaderboardDefinition(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::GetLeaderboardDefinition(
     ProgressionModels::FGetLeaderboardDefinitionRequest& request,
     const FGetLeaderboardDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -360,7 +361,7 @@ bool UPlayFabProgressionInstanceAPI::GetLeaderboardDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/GetLeaderboardDefinition"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnGetLeaderboardDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnGetLeaderboardDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -377,7 +378,7 @@ void UPlayFabProgressionInstanceAPI::OnGetLeaderboardDefinitionResult(FHttpReque
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::GetLeaderboardForEntities(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::GetLeaderboardForEntities(
     ProgressionModels::FGetLeaderboardForEntitiesRequest& request,
     const FGetLeaderboardForEntitiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -390,7 +391,7 @@ bool UPlayFabProgressionInstanceAPI::GetLeaderboardForEntities(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/GetLeaderboardForEntities"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnGetLeaderboardForEntitiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnGetLeaderboardForEntitiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForEntitiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -407,7 +408,7 @@ void UPlayFabProgressionInstanceAPI::OnGetLeaderboardForEntitiesResult(FHttpRequ
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::GetStatisticDefinition(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::GetStatisticDefinition(
     ProgressionModels::FGetStatisticDefinitionRequest& request,
     const FGetStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -420,7 +421,7 @@ bool UPlayFabProgressionInstanceAPI::GetStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/GetStatisticDefinition"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnGetStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnGetStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -437,7 +438,7 @@ void UPlayFabProgressionInstanceAPI::OnGetStatisticDefinitionResult(FHttpRequest
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::GetStatistics(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::GetStatistics(
     ProgressionModels::FGetStatisticsRequest& request,
     const FGetStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -450,7 +451,7 @@ bool UPlayFabProgressionInstanceAPI::GetStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/GetStatistics"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnGetStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnGetStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -467,7 +468,7 @@ void UPlayFabProgressionInstanceAPI::OnGetStatisticsResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::GetStatisticsForEntities(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::GetStatisticsForEntities(
     ProgressionModels::FGetStatisticsForEntitiesRequest& request,
     const FGetStatisticsForEntitiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -480,7 +481,7 @@ bool UPlayFabProgressionInstanceAPI::GetStatisticsForEntities(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/GetStatisticsForEntities"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnGetStatisticsForEntitiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnGetStatisticsForEntitiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStatisticsForEntitiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -497,7 +498,7 @@ void UPlayFabProgressionInstanceAPI::OnGetStatisticsForEntitiesResult(FHttpReque
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::IncrementLeaderboardVersion(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::IncrementLeaderboardVersion(
     ProgressionModels::FIncrementLeaderboardVersionRequest& request,
     const FIncrementLeaderboardVersionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -510,7 +511,7 @@ bool UPlayFabProgressionInstanceAPI::IncrementLeaderboardVersion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/IncrementLeaderboardVersion"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnIncrementLeaderboardVersionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnIncrementLeaderboardVersionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementLeaderboardVersionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -527,7 +528,7 @@ void UPlayFabProgressionInstanceAPI::OnIncrementLeaderboardVersionResult(FHttpRe
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::IncrementStatisticVersion(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::IncrementStatisticVersion(
     ProgressionModels::FIncrementStatisticVersionRequest& request,
     const FIncrementStatisticVersionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -540,7 +541,7 @@ bool UPlayFabProgressionInstanceAPI::IncrementStatisticVersion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/IncrementStatisticVersion"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnIncrementStatisticVersionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnIncrementStatisticVersionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementStatisticVersionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -557,7 +558,7 @@ void UPlayFabProgressionInstanceAPI::OnIncrementStatisticVersionResult(FHttpRequ
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::ListLeaderboardDefinitions(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::ListLeaderboardDefinitions(
     ProgressionModels::FListLeaderboardDefinitionsRequest& request,
     const FListLeaderboardDefinitionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -570,7 +571,7 @@ bool UPlayFabProgressionInstanceAPI::ListLeaderboardDefinitions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/ListLeaderboardDefinitions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnListLeaderboardDefinitionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnListLeaderboardDefinitionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListLeaderboardDefinitionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -587,7 +588,7 @@ void UPlayFabProgressionInstanceAPI::OnListLeaderboardDefinitionsResult(FHttpReq
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::ListStatisticDefinitions(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::ListStatisticDefinitions(
     ProgressionModels::FListStatisticDefinitionsRequest& request,
     const FListStatisticDefinitionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -600,7 +601,7 @@ bool UPlayFabProgressionInstanceAPI::ListStatisticDefinitions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/ListStatisticDefinitions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnListStatisticDefinitionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnListStatisticDefinitionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListStatisticDefinitionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -617,7 +618,7 @@ void UPlayFabProgressionInstanceAPI::OnListStatisticDefinitionsResult(FHttpReque
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::UnlinkLeaderboardFromStatistic(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::UnlinkLeaderboardFromStatistic(
     ProgressionModels::FUnlinkLeaderboardFromStatisticRequest& request,
     const FUnlinkLeaderboardFromStatisticDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -630,7 +631,7 @@ bool UPlayFabProgressionInstanceAPI::UnlinkLeaderboardFromStatistic(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/UnlinkLeaderboardFromStatistic"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnUnlinkLeaderboardFromStatisticResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnUnlinkLeaderboardFromStatisticResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkLeaderboardFromStatisticDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -647,7 +648,7 @@ void UPlayFabProgressionInstanceAPI::OnUnlinkLeaderboardFromStatisticResult(FHtt
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::UpdateLeaderboardDefinition(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::UpdateLeaderboardDefinition(
     ProgressionModels::FUpdateLeaderboardDefinitionRequest& request,
     const FUpdateLeaderboardDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -660,7 +661,7 @@ bool UPlayFabProgressionInstanceAPI::UpdateLeaderboardDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/UpdateLeaderboardDefinition"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnUpdateLeaderboardDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnUpdateLeaderboardDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateLeaderboardDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -677,7 +678,7 @@ void UPlayFabProgressionInstanceAPI::OnUpdateLeaderboardDefinitionResult(FHttpRe
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::UpdateLeaderboardEntries(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::UpdateLeaderboardEntries(
     ProgressionModels::FUpdateLeaderboardEntriesRequest& request,
     const FUpdateLeaderboardEntriesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -690,7 +691,7 @@ bool UPlayFabProgressionInstanceAPI::UpdateLeaderboardEntries(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Leaderboard/UpdateLeaderboardEntries"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnUpdateLeaderboardEntriesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnUpdateLeaderboardEntriesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateLeaderboardEntriesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -707,7 +708,7 @@ void UPlayFabProgressionInstanceAPI::OnUpdateLeaderboardEntriesResult(FHttpReque
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::UpdateStatisticDefinition(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::UpdateStatisticDefinition(
     ProgressionModels::FUpdateStatisticDefinitionRequest& request,
     const FUpdateStatisticDefinitionDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -720,7 +721,7 @@ bool UPlayFabProgressionInstanceAPI::UpdateStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/UpdateStatisticDefinition"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnUpdateStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnUpdateStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -737,7 +738,7 @@ void UPlayFabProgressionInstanceAPI::OnUpdateStatisticDefinitionResult(FHttpRequ
     }
 }
 
-bool UPlayFabProgressionInstanceAPI::UpdateStatistics(
+FPlayFabRequestHandle UPlayFabProgressionInstanceAPI::UpdateStatistics(
     ProgressionModels::FUpdateStatisticsRequest& request,
     const FUpdateStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -750,7 +751,7 @@ bool UPlayFabProgressionInstanceAPI::UpdateStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Statistic/UpdateStatistics"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProgressionInstanceAPI::OnUpdateStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabProgressionInstanceAPI::OnUpdateStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -766,3 +767,5 @@ void UPlayFabProgressionInstanceAPI::OnUpdateStatisticsResult(FHttpRequestPtr Ht
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_PROGRESSION_API
@@ -0,0 +1,30 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabRequestHandle.h"
+#include "PlayFabResultHandler.h"
+
+using namespace PlayFab;
+
+bool FPlayFabRequestHandle::IsPending() const
+{
+    TSharedPtr<IHttpRequest> PinnedRequest = Request.Pin();
+    if (!PinnedRequest.IsValid())
+    {
+        return false;
+    }
+    const EHttpRequestStatus::Type Status = PinnedRequest->GetStatus();
+    return Status == EHttpRequestStatus::NotStarted || Status == EHttpRequestStatus::Processing;
+}
+
+void FPlayFabRequestHandle::Cancel()
+{
+    TSharedPtr<IHttpRequest> PinnedRequest = Request.Pin();
+    if (PinnedRequest.IsValid())
+    {
+        PlayFabRequestHandler::CancelRequest(PinnedRequest.ToSharedRef());
+    }
+    Request.Reset();
+}
@@ -5,11 +5,17 @@
 
 #include "PlayFabResultHandler.h"
 #include "PlayFab.h"
+#include "PlayFabDispatchScheduler.h"
+#include "PlayFabJsonHelpers.h"
+#include "PlayFabTrace.h"
 #include "Serialization/JsonSerializer.h"
 
 using namespace PlayFab;
+using PlayFabCommon::EPlayFabTracePhase;
+using PlayFabCommon::FPlayFabTraceScope;
+using PlayFabCommon::PlayFabTrace;
 
-int PlayFabRequestHandler::pendingCalls = 0;
+std::atomic<int> PlayFabRequestHandler::pendingCalls(0);
 
 int PlayFabRequestHandler::GetPendingCalls()
 {
@@ -42,58 +48,154 @@ TSharedRef<IHttpRequest> PlayFabRequestHandler::SendFullUrlRequest(const FString
     return HttpRequest;
 }
 
+FPlayFabRequestHandle PlayFabRequestHandler::ProcessRequest(const TSharedRef<IHttpRequest>& HttpRequest, const FPlayFabCppRequestCommon& request)
+{
+    // Goes through the shared scheduler instead of straight to the HTTP module, see PlayFabDispatchScheduler.
+    // The trace id is taken, so a body serialized from the same model later starts over.
+    const uint64 TraceRequestId = request.TraceRequestId;
+    request.TraceRequestId = 0;
+    const bool bSubmitted = PlayFabCommon::PlayFabDispatchScheduler::Get().Submit(HttpRequest, request.TimeoutSeconds, TraceRequestId);
+    return FPlayFabRequestHandle(HttpRequest, bSubmitted);
+}
+
+bool PlayFabRequestHandler::CancelRequest(const TSharedRef<IHttpRequest>& HttpRequest)
+{
+    if (!PlayFabCommon::PlayFabDispatchScheduler::Get().Cancel(HttpRequest))
+    {
+        return false;
+    }
+
+    // DecodeRequest will not run for this request
+    PlayFabRequestHandler::pendingCalls -= 1;
+    return true;
+}
+
 bool PlayFabRequestHandler::DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError)
 {
     PlayFabRequestHandler::pendingCalls -= 1;
+    const uint64 TraceId = PlayFabTrace::FindRequestId(HttpRequest.Get());
+    FPlayFabTraceScope TraceScope(TraceId, EPlayFabTracePhase::Decode);
 
-    FString ResponseStr, ErrorStr;
     if (bSucceeded && HttpResponse.IsValid())
     {
-        if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
+        // Parse the UTF-8 body where it is. GetContentAsString would allocate a TCHAR copy of the whole response first.
+        const TArray<uint8>& Content = HttpResponse->GetContent();
+        const FUtf8StringView ContentView(reinterpret_cast<const UTF8CHAR*>(Content.GetData()), Content.Num());
+        const TOptional<bool> bDecoded = DecodeResponse(TJsonReaderFactory<UTF8CHAR>::CreateFromView(ContentView), HttpResponse, OutResult, OutError, TraceId);
+        if (bDecoded.IsSet())
         {
-            // Create the Json parser
-            ResponseStr = HttpResponse->GetContentAsString();
-            TSharedPtr<FJsonObject> JsonObject;
-            TSharedRef<TJsonReader<> > JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
+            return bDecoded.GetValue();
+        }
+    }
 
-            if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid())
-            {
-                if (PlayFabRequestHandler::DecodeError(JsonObject, OutError))
-                {
-                    return false;
-                }
+    SetTimeoutError(OutError);
+    return false;
+}
 
-                const TSharedPtr<FJsonObject>* DataJsonObject;
-                if (JsonObject->TryGetObjectField(TEXT("data"), DataJsonObject))
-                {
-                    return OutResult.readFromValue(*DataJsonObject);
-                }
-            }
+bool PlayFabRequestHandler::DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError, const FString& RawField, PlayFab::FJsonKeeper& OutRawValue)
+{
+    PlayFabRequestHandler::pendingCalls -= 1;
+    const uint64 TraceId = PlayFabTrace::FindRequestId(HttpRequest.Get());
+    FPlayFabTraceScope TraceScope(TraceId, EPlayFabTracePhase::Decode);
+
+    if (bSucceeded && HttpResponse.IsValid())
+    {
+        const TArray<uint8>& Content = HttpResponse->GetContent();
+        const FUtf8StringView ContentView(reinterpret_cast<const UTF8CHAR*>(Content.GetData()), Content.Num());
+        FUtf8StringView RawValue;
+
+        int32 RawStart, RawEnd;
+        TOptional<bool> bDecoded;
+        if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()) && FPlayFabJsonHelpers::FindRawValue(ContentView, { TEXT("data"), RawField }, RawStart, RawEnd))
+        {
+            // The rest of the response, with null in place of the slice so the parser skips over it.
+            // The slice is usually the bulk of the response, everything around it is small.
+            RawValue = ContentView.Mid(RawStart, RawEnd - RawStart);
+            const FUtf8StringView Null(UTF8TEXT("null"));
+            TArray<UTF8CHAR> Rest;
+            Rest.Reserve(RawStart + Null.Len() + (ContentView.Len() - RawEnd));
+            Rest.Append(ContentView.GetData(), RawStart);
+            Rest.Append(Null.GetData(), Null.Len());
+            Rest.Append(ContentView.GetData() + RawEnd, ContentView.Len() - RawEnd);
+            bDecoded = DecodeResponse(TJsonReaderFactory<UTF8CHAR>::CreateFromView(FUtf8StringView(Rest.GetData(), Rest.Num())), HttpResponse, OutResult, OutError, TraceId);
         }
         else
         {
-            // Create the Json parser
-            ResponseStr = HttpResponse->GetContentAsString();
-            TSharedPtr<FJsonObject> JsonObject;
-            TSharedRef<TJsonReader<> > JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
+            bDecoded = DecodeResponse(TJsonReaderFactory<UTF8CHAR>::CreateFromView(ContentView), HttpResponse, OutResult, OutError, TraceId);
+        }
 
-            if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid())
+        if (bDecoded.IsSet())
+        {
+            if (bDecoded.GetValue() && !RawValue.IsEmpty())
             {
-                if (PlayFabRequestHandler::DecodeError(JsonObject, OutError))
-                {
-                    return false;
-                }
+                OutRawValue.SetRawJson(RawValue);
             }
+            return bDecoded.GetValue();
         }
     }
 
+    SetTimeoutError(OutError);
+    return false;
+}
+
+bool PlayFabRequestHandler::DecodeStreamedRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppError& OutError)
+{
+    PlayFabRequestHandler::pendingCalls -= 1;
+    const uint64 TraceId = PlayFabTrace::FindRequestId(HttpRequest.Get());
+    FPlayFabTraceScope TraceScope(TraceId, EPlayFabTracePhase::Decode);
+
+    if (bSucceeded && HttpResponse.IsValid())
+    {
+        if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
+        {
+            return true;
+        }
+
+        // Error replies are small, the DOM is fine here
+        const TArray<uint8>& Content = HttpResponse->GetContent();
+        const FUtf8StringView ContentView(reinterpret_cast<const UTF8CHAR*>(Content.GetData()), Content.Num());
+        TSharedPtr<FJsonObject> JsonObject;
+        if (FJsonSerializer::Deserialize(TJsonReaderFactory<UTF8CHAR>::CreateFromView(ContentView), JsonObject) && JsonObject.IsValid()
+            && PlayFabRequestHandler::DecodeError(JsonObject, OutError))
+        {
+            return false;
+        }
+    }
+
+    SetTimeoutError(OutError);
+    return false;
+}
+
+template <typename CharType>
+TOptional<bool> PlayFabRequestHandler::DecodeResponse(const TSharedRef<TJsonReader<CharType> >& JsonReader, FHttpResponsePtr HttpResponse, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError, uint64 TraceId)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+    {
+        return TOptional<bool>();
+    }
+
+    if (PlayFabRequestHandler::DecodeError(JsonObject, OutError))
+    {
+        return false;
+    }
+
+    const TSharedPtr<FJsonObject>* DataJsonObject;
+    if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()) && JsonObject->TryGetObjectField(TEXT("data"), DataJsonObject))
+    {
+        FPlayFabTraceScope TraceScope(TraceId, EPlayFabTracePhase::ModelDecode);
+        return OutResult.readFromValue(*DataJsonObject);
+    }
+    return TOptional<bool>();
+}
+
+void PlayFabRequestHandler::SetTimeoutError(PlayFab::FPlayFabCppError& OutError)
+{
     // If we get here, we failed to connect meaningfully to the server - Assume a timeout
     OutError.HttpCode = 408;
     OutError.ErrorCode = PlayFabErrorConnectionTimeout;
     // For text returns, use the non-json response if possible, else default to no response
     OutError.ErrorName = OutError.ErrorMessage = OutError.HttpStatus = TEXT("Request Timeout or null response");
-
-    return false;
 }
 
 bool PlayFabRequestHandler::DecodeError(TSharedPtr<FJsonObject> JsonObject, PlayFab::FPlayFabCppError& OutError)
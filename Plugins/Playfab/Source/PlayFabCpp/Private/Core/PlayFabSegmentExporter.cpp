@@ -0,0 +1,373 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#if WITH_PLAYFAB_ADMIN_API
+#include "Core/PlayFabSegmentExporter.h"
+#include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabResultHandler.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "PlayFab.h"
+
+using namespace PlayFab;
+using namespace PlayFab::AdminModels;
+
+namespace
+{
+    typedef TJsonReader<UTF8CHAR> FPageReader;
+    typedef TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR> > FLineWriter;
+
+    // Copies the object or array the reader has just entered to Writer, up to its closing token
+    bool CopyValue(FPageReader& Reader, EJsonNotation Notation, FLineWriter& Writer)
+    {
+        int32 Depth = 0;
+        do
+        {
+            const FString& Identifier = Reader.GetIdentifier();
+            switch (Notation)
+            {
+            case EJsonNotation::ObjectStart:
+                Identifier.IsEmpty() ? Writer.WriteObjectStart() : Writer.WriteObjectStart(Identifier);
+                ++Depth;
+                break;
+            case EJsonNotation::ArrayStart:
+                Identifier.IsEmpty() ? Writer.WriteArrayStart() : Writer.WriteArrayStart(Identifier);
+                ++Depth;
+                break;
+            case EJsonNotation::ObjectEnd:
+                Writer.WriteObjectEnd();
+                --Depth;
+                break;
+            case EJsonNotation::ArrayEnd:
+                Writer.WriteArrayEnd();
+                --Depth;
+                break;
+            case EJsonNotation::String:
+                Identifier.IsEmpty() ? Writer.WriteValue(Reader.GetValueAsString()) : Writer.WriteValue(Identifier, Reader.GetValueAsString());
+                break;
+            case EJsonNotation::Number:
+                // Written as received, so 64 bit ids and timestamps do not go through a double
+                Identifier.IsEmpty() ? Writer.WriteRawJSONValue(Reader.GetValueAsNumberString()) : Writer.WriteRawJSONValue(Identifier, Reader.GetValueAsNumberString());
+                break;
+            case EJsonNotation::Boolean:
+                Identifier.IsEmpty() ? Writer.WriteValue(Reader.GetValueAsBoolean()) : Writer.WriteValue(Identifier, Reader.GetValueAsBoolean());
+                break;
+            case EJsonNotation::Null:
+                Identifier.IsEmpty() ? Writer.WriteNull() : Writer.WriteNull(Identifier);
+                break;
+            default:
+                return false;
+            }
+            if (Depth == 0)
+            {
+                return true;
+            }
+        } while (Reader.ReadNext(Notation));
+        return false;
+    }
+
+    // Appends one line per element of data.PlayerProfiles to OutLines. Nothing else of the page is kept.
+    bool TranscodePage(FUtf8StringView Content, TArray<uint8>& OutLines, int32& OutProfiles)
+    {
+        TSharedRef<FPageReader> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(Content);
+        TArray<FString, TInlineAllocator<8> > Scopes; // Identifiers of the open objects and arrays, the root first
+        FString Line;
+        EJsonNotation Notation;
+        while (Reader->ReadNext(Notation))
+        {
+            switch (Notation)
+            {
+            case EJsonNotation::ObjectStart:
+                if (Scopes.Num() == 3 && Scopes[1] == TEXT("data") && Scopes[2] == TEXT("PlayerProfiles"))
+                {
+                    Line.Reset();
+                    TSharedRef<FLineWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR> >::Create(&Line);
+                    if (!CopyValue(*Reader, Notation, *Writer))
+                    {
+                        return false;
+                    }
+                    Writer->Close();
+
+                    const FTCHARToUTF8 Utf8Line(*Line, Line.Len());
+                    OutLines.Append(reinterpret_cast<const uint8*>(Utf8Line.Get()), Utf8Line.Length());
+                    OutLines.Add('\n');
+                    ++OutProfiles;
+                    break;
+                }
+                Scopes.Add(Reader->GetIdentifier());
+                break;
+            case EJsonNotation::ArrayStart:
+                Scopes.Add(Reader->GetIdentifier());
+                break;
+            case EJsonNotation::ObjectEnd:
+            case EJsonNotation::ArrayEnd:
+                Scopes.Pop(EAllowShrinking::No);
+                break;
+            case EJsonNotation::Error:
+                return false;
+            default:
+                break;
+            }
+        }
+        return !Reader->HasError();
+    }
+
+    // Reads a member of the data object of a page without parsing the page
+    bool FindPageValue(FUtf8StringView Content, const TCHAR* Member, FString& OutValue)
+    {
+        int32 Start, End;
+        if (!FPlayFabJsonHelpers::FindRawValue(Content, { TEXT("data"), Member }, Start, End))
+        {
+            return false;
+        }
+
+        // Wrapped in an array so strings come back unescaped
+        const FString Raw = TEXT("[") + FString(FUtf8StringView(Content.GetData() + Start, End - Start)) + TEXT("]");
+        TArray<TSharedPtr<FJsonValue> > Values;
+        if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Raw), Values) || Values.Num() != 1 || !Values[0].IsValid())
+        {
+            return false;
+        }
+        return Values[0]->TryGetString(OutValue);
+    }
+
+    FPlayFabCppError MakeExportError(int32 HttpCode, PlayFabErrorCode ErrorCode, const FString& Message)
+    {
+        FPlayFabCppError errorResult;
+        errorResult.HttpCode = HttpCode;
+        errorResult.ErrorCode = ErrorCode;
+        errorResult.ErrorName = errorResult.HttpStatus = TEXT("Segment export failed");
+        errorResult.ErrorMessage = Message;
+        return errorResult;
+    }
+
+    FUtf8StringView GetContentView(const FHttpResponsePtr& HttpResponse)
+    {
+        const TArray<uint8>& Content = HttpResponse->GetContent();
+        return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Content.GetData()), Content.Num());
+    }
+}
+
+PlayFabSegmentExporter::~PlayFabSegmentExporter()
+{
+    PageRequest.Cancel();
+}
+
+bool PlayFabSegmentExporter::Start(const FGetPlayersInSegmentRequest& request, const FString& FilePath, const FProgressDelegate& InCompleteDelegate, const FPlayFabErrorDelegate& InErrorDelegate)
+{
+    check(IsInGameThread());
+    if (bRunning)
+    {
+        UE_LOG(LogPlayFabCpp, Error, TEXT("PlayFabSegmentExporter: an export is already running"));
+        return false;
+    }
+
+    File.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+    if (!File.IsValid())
+    {
+        UE_LOG(LogPlayFabCpp, Error, TEXT("PlayFabSegmentExporter: cannot open %s for writing"), *FilePath);
+        return false;
+    }
+
+    Request = request;
+    Path = FilePath;
+    CompleteDelegate = InCompleteDelegate;
+    ErrorDelegate = InErrorDelegate;
+    PagesWritten = 0;
+    ProfilesWritten = 0;
+    bWriteFailed = false;
+    LastWrite = UE::Tasks::FTask();
+    ProfilesInSegment = 0;
+    bRunning = true;
+    bFinishing = false;
+
+    RequestPage(FString());
+    return true;
+}
+
+void PlayFabSegmentExporter::Cancel()
+{
+    check(IsInGameThread());
+    if (bRunning)
+    {
+        FinishWithError(499, PlayFabErrorOperationCanceled, TEXT("Segment export cancelled"));
+    }
+}
+
+PlayFabSegmentExporter::FProgress PlayFabSegmentExporter::GetProgress() const
+{
+    FProgress Progress;
+    Progress.PagesWritten = PagesWritten;
+    Progress.ProfilesWritten = ProfilesWritten;
+    Progress.ProfilesInSegment = ProfilesInSegment;
+    return Progress;
+}
+
+void PlayFabSegmentExporter::RequestPage(const FString& ContinuationToken)
+{
+    if (!bRunning || bFinishing)
+    {
+        return;
+    }
+
+    FString devSecretKey = Request.AuthenticationContext.IsValid() ? Request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
+    if (devSecretKey.Len() == 0) {
+        UE_LOG(LogPlayFabCpp, Error, TEXT("You must first set your PlayFab developerSecretKey to use this function (Unreal Settings Menu, or in C++ code)"));
+    }
+
+    Request.ContinuationToken = ContinuationToken;
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayersInSegment"), Request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    HttpRequest->OnProcessRequestComplete().BindSP(this, &PlayFabSegmentExporter::OnPageResult);
+    PageRequest = PlayFabRequestHandler::ProcessRequest(HttpRequest, Request);
+    if (!PageRequest)
+    {
+        FinishWithError(400, PlayFabErrorUnknownError, TEXT("GetPlayersInSegment could not be sent"));
+    }
+}
+
+void PlayFabSegmentExporter::OnPageResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+{
+    FPlayFabCppError errorResult;
+    if (!PlayFabRequestHandler::DecodeStreamedRequest(HttpRequest, HttpResponse, bSucceeded, errorResult))
+    {
+        Finish(&errorResult);
+        return;
+    }
+    if (bFinishing)
+    {
+        return;
+    }
+
+    const FUtf8StringView Content = GetContentView(HttpResponse);
+    FString ContinuationToken;
+    FindPageValue(Content, TEXT("ContinuationToken"), ContinuationToken);
+    if (Request.ContinuationToken.IsEmpty()) // First page
+    {
+        int32 Start, End;
+        if (FPlayFabJsonHelpers::FindRawValue(Content, { TEXT("data"), TEXT("ProfilesInSegment") }, Start, End))
+        {
+            LexFromString(ProfilesInSegment, *FString(FUtf8StringView(Content.GetData() + Start, End - Start)));
+        }
+    }
+
+    // Pages are written in order, each one after the previous
+    const UE::Tasks::FTask PreviousWrite = LastWrite;
+    TSharedRef<PlayFabSegmentExporter> Self = AsShared();
+    LastWrite = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Self, HttpResponse]() { Self->WritePage(HttpResponse); }, UE::Tasks::Prerequisites(PreviousWrite));
+
+    if (ContinuationToken.IsEmpty())
+    {
+        Finish(nullptr);
+        return;
+    }
+
+    // The next page is fetched while this one is written, but not before the page ahead of it is on disk.
+    // That keeps at most two pages in memory when the disk is slower than the service.
+    NextContinuationToken = ContinuationToken;
+    if (PreviousWrite.IsCompleted())
+    {
+        RequestPage(NextContinuationToken);
+        return;
+    }
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [Self]()
+    {
+        AsyncTask(ENamedThreads::GameThread, [Self]() { Self->RequestPage(Self->NextContinuationToken); });
+    }, UE::Tasks::Prerequisites(PreviousWrite));
+}
+
+void PlayFabSegmentExporter::WritePage(FHttpResponsePtr HttpResponse)
+{
+    if (bWriteFailed)
+    {
+        return;
+    }
+
+    TArray<uint8> Lines;
+    int32 Profiles = 0;
+    bool bWritten = TranscodePage(GetContentView(HttpResponse), Lines, Profiles);
+    if (bWritten)
+    {
+        File->Serialize(Lines.GetData(), Lines.Num());
+        bWritten = !File->IsError();
+    }
+
+    if (bWritten)
+    {
+        ++PagesWritten;
+        ProfilesWritten += Profiles;
+    }
+    else
+    {
+        bWriteFailed = true;
+    }
+
+    TSharedRef<PlayFabSegmentExporter> Self = AsShared();
+    AsyncTask(ENamedThreads::GameThread, [Self, bWritten]() { Self->OnPageWritten(bWritten); });
+}
+
+void PlayFabSegmentExporter::OnPageWritten(bool bWritten)
+{
+    if (!bWritten)
+    {
+        FinishWithError(500, PlayFabErrorUnknownError, FString::Printf(TEXT("A GetPlayersInSegment page could not be written to %s"), *Path));
+        return;
+    }
+    if (bRunning)
+    {
+        OnProgress.ExecuteIfBound(GetProgress());
+    }
+}
+
+void PlayFabSegmentExporter::Finish(const FPlayFabCppError* Error)
+{
+    if (bFinishing)
+    {
+        return;
+    }
+    bFinishing = true;
+    PageRequest.Cancel();
+
+    // The file is closed once the pages already handed to the tasks are written
+    TOptional<FPlayFabCppError> Result;
+    if (Error != nullptr)
+    {
+        Result = *Error;
+    }
+    TSharedRef<PlayFabSegmentExporter> Self = AsShared();
+    LastWrite = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Self, Result]()
+    {
+        const bool bClosed = Self->File->Close() && !Self->bWriteFailed;
+        Self->File.Reset();
+
+        AsyncTask(ENamedThreads::GameThread, [Self, Result, bClosed]()
+        {
+            Self->bRunning = false;
+            if (Result.IsSet())
+            {
+                Self->ErrorDelegate.ExecuteIfBound(Result.GetValue());
+            }
+            else if (!bClosed)
+            {
+                Self->ErrorDelegate.ExecuteIfBound(MakeExportError(500, PlayFabErrorUnknownError, FString::Printf(TEXT("%s could not be written"), *Self->Path)));
+            }
+            else
+            {
+                Self->CompleteDelegate.ExecuteIfBound(Self->GetProgress());
+            }
+        });
+    }, UE::Tasks::Prerequisites(LastWrite));
+}
+
+void PlayFabSegmentExporter::FinishWithError(int32 HttpCode, PlayFabErrorCode ErrorCode, const FString& Message)
+{
+    const FPlayFabCppError errorResult = MakeExportError(HttpCode, ErrorCode, Message);
+    Finish(&errorResult);
+}
+
+#endif // WITH_PLAYFAB_ADMIN_API
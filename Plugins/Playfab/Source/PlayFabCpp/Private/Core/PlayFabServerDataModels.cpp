@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_SERVER_API
 
 #include "Core/PlayFabServerDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
@@ -136,7 +137,7 @@ void PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -157,7 +158,7 @@ void PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!VirtualCurrency.IsEmpty() == false)
@@ -194,6 +195,7 @@ bool PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -235,7 +237,7 @@ void PlayFab::ServerModels::FAddFriendRequest::writeJSON(JsonWriter& writer) con
     if (FriendPlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("FriendPlayFabId"));
-        writer->WriteValue(FriendPlayFabId);
+        writer->WriteValue(FriendPlayFabId.ToString());
     }
 
     if (FriendTitleDisplayName.IsEmpty() == false)
@@ -257,7 +259,7 @@ void PlayFab::ServerModels::FAddFriendRequest::writeJSON(JsonWriter& writer) con
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -377,7 +379,7 @@ void PlayFab::ServerModels::FAddGenericIDRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -430,7 +432,7 @@ void PlayFab::ServerModels::FAddPlayerTagRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!TagName.IsEmpty() == false)
@@ -453,6 +455,7 @@ bool PlayFab::ServerModels::FAddPlayerTagRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -588,7 +591,7 @@ void PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!VirtualCurrency.IsEmpty() == false)
@@ -618,6 +621,7 @@ bool PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -658,14 +662,14 @@ ServerModels::PushNotificationPlatform PlayFab::ServerModels::readPushNotificati
 
 ServerModels::PushNotificationPlatform PlayFab::ServerModels::readPushNotificationPlatformFromValue(const FString& value)
 {
-    static TMap<FString, PushNotificationPlatform> _PushNotificationPlatformMap;
-    if (_PushNotificationPlatformMap.Num() == 0)
+    static const TMap<FString, PushNotificationPlatform> _PushNotificationPlatformMap = []()
     {
-        // Auto-generate the map on the first use
-        _PushNotificationPlatformMap.Add(TEXT("ApplePushNotificationService"), PushNotificationPlatformApplePushNotificationService);
-        _PushNotificationPlatformMap.Add(TEXT("GoogleCloudMessaging"), PushNotificationPlatformGoogleCloudMessaging);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, PushNotificationPlatform> Map;
+        Map.Add(TEXT("ApplePushNotificationService"), PushNotificationPlatformApplePushNotificationService);
+        Map.Add(TEXT("GoogleCloudMessaging"), PushNotificationPlatformGoogleCloudMessaging);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1442,17 +1446,17 @@ ServerModels::TitleActivationStatus PlayFab::ServerModels::readTitleActivationSt
 
 ServerModels::TitleActivationStatus PlayFab::ServerModels::readTitleActivationStatusFromValue(const FString& value)
 {
-    static TMap<FString, TitleActivationStatus> _TitleActivationStatusMap;
-    if (_TitleActivationStatusMap.Num() == 0)
+    static const TMap<FString, TitleActivationStatus> _TitleActivationStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _TitleActivationStatusMap.Add(TEXT("None"), TitleActivationStatusNone);
-        _TitleActivationStatusMap.Add(TEXT("ActivatedTitleKey"), TitleActivationStatusActivatedTitleKey);
-        _TitleActivationStatusMap.Add(TEXT("PendingSteam"), TitleActivationStatusPendingSteam);
-        _TitleActivationStatusMap.Add(TEXT("ActivatedSteam"), TitleActivationStatusActivatedSteam);
-        _TitleActivationStatusMap.Add(TEXT("RevokedSteam"), TitleActivationStatusRevokedSteam);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, TitleActivationStatus> Map;
+        Map.Add(TEXT("None"), TitleActivationStatusNone);
+        Map.Add(TEXT("ActivatedTitleKey"), TitleActivationStatusActivatedTitleKey);
+        Map.Add(TEXT("PendingSteam"), TitleActivationStatusPendingSteam);
+        Map.Add(TEXT("ActivatedSteam"), TitleActivationStatusActivatedSteam);
+        Map.Add(TEXT("RevokedSteam"), TitleActivationStatusRevokedSteam);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1641,174 +1645,174 @@ ServerModels::Currency PlayFab::ServerModels::readCurrencyFromValue(const TShare
 
 ServerModels::Currency PlayFab::ServerModels::readCurrencyFromValue(const FString& value)
 {
-    static TMap<FString, Currency> _CurrencyMap;
-    if (_CurrencyMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _CurrencyMap.Add(TEXT("AED"), CurrencyAED);
-        _CurrencyMap.Add(TEXT("AFN"), CurrencyAFN);
-        _CurrencyMap.Add(TEXT("ALL"), CurrencyALL);
-        _CurrencyMap.Add(TEXT("AMD"), CurrencyAMD);
-        _CurrencyMap.Add(TEXT("ANG"), CurrencyANG);
-        _CurrencyMap.Add(TEXT("AOA"), CurrencyAOA);
-        _CurrencyMap.Add(TEXT("ARS"), CurrencyARS);
-        _CurrencyMap.Add(TEXT("AUD"), CurrencyAUD);
-        _CurrencyMap.Add(TEXT("AWG"), CurrencyAWG);
-        _CurrencyMap.Add(TEXT("AZN"), CurrencyAZN);
-        _CurrencyMap.Add(TEXT("BAM"), CurrencyBAM);
-        _CurrencyMap.Add(TEXT("BBD"), CurrencyBBD);
-        _CurrencyMap.Add(TEXT("BDT"), CurrencyBDT);
-        _CurrencyMap.Add(TEXT("BGN"), CurrencyBGN);
-        _CurrencyMap.Add(TEXT("BHD"), CurrencyBHD);
-        _CurrencyMap.Add(TEXT("BIF"), CurrencyBIF);
-        _CurrencyMap.Add(TEXT("BMD"), CurrencyBMD);
-        _CurrencyMap.Add(TEXT("BND"), CurrencyBND);
-        _CurrencyMap.Add(TEXT("BOB"), CurrencyBOB);
-        _CurrencyMap.Add(TEXT("BRL"), CurrencyBRL);
-        _CurrencyMap.Add(TEXT("BSD"), CurrencyBSD);
-        _CurrencyMap.Add(TEXT("BTN"), CurrencyBTN);
-        _CurrencyMap.Add(TEXT("BWP"), CurrencyBWP);
-        _CurrencyMap.Add(TEXT("BYR"), CurrencyBYR);
-        _CurrencyMap.Add(TEXT("BZD"), CurrencyBZD);
-        _CurrencyMap.Add(TEXT("CAD"), CurrencyCAD);
-        _CurrencyMap.Add(TEXT("CDF"), CurrencyCDF);
-        _CurrencyMap.Add(TEXT("CHF"), CurrencyCHF);
-        _CurrencyMap.Add(TEXT("CLP"), CurrencyCLP);
-        _CurrencyMap.Add(TEXT("CNY"), CurrencyCNY);
-        _CurrencyMap.Add(TEXT("COP"), CurrencyCOP);
-        _CurrencyMap.Add(TEXT("CRC"), CurrencyCRC);
-        _CurrencyMap.Add(TEXT("CUC"), CurrencyCUC);
-        _CurrencyMap.Add(TEXT("CUP"), CurrencyCUP);
-        _CurrencyMap.Add(TEXT("CVE"), CurrencyCVE);
-        _CurrencyMap.Add(TEXT("CZK"), CurrencyCZK);
-        _CurrencyMap.Add(TEXT("DJF"), CurrencyDJF);
-        _CurrencyMap.Add(TEXT("DKK"), CurrencyDKK);
-        _CurrencyMap.Add(TEXT("DOP"), CurrencyDOP);
-        _CurrencyMap.Add(TEXT("DZD"), CurrencyDZD);
-        _CurrencyMap.Add(TEXT("EGP"), CurrencyEGP);
-        _CurrencyMap.Add(TEXT("ERN"), CurrencyERN);
-        _CurrencyMap.Add(TEXT("ETB"), CurrencyETB);
-        _CurrencyMap.Add(TEXT("EUR"), CurrencyEUR);
-        _CurrencyMap.Add(TEXT("FJD"), CurrencyFJD);
-        _CurrencyMap.Add(TEXT("FKP"), CurrencyFKP);
-        _CurrencyMap.Add(TEXT("GBP"), CurrencyGBP);
-        _CurrencyMap.Add(TEXT("GEL"), CurrencyGEL);
-        _CurrencyMap.Add(TEXT("GGP"), CurrencyGGP);
-        _CurrencyMap.Add(TEXT("GHS"), CurrencyGHS);
-        _CurrencyMap.Add(TEXT("GIP"), CurrencyGIP);
-        _CurrencyMap.Add(TEXT("GMD"), CurrencyGMD);
-        _CurrencyMap.Add(TEXT("GNF"), CurrencyGNF);
-        _CurrencyMap.Add(TEXT("GTQ"), CurrencyGTQ);
-        _CurrencyMap.Add(TEXT("GYD"), CurrencyGYD);
-        _CurrencyMap.Add(TEXT("HKD"), CurrencyHKD);
-        _CurrencyMap.Add(TEXT("HNL"), CurrencyHNL);
-        _CurrencyMap.Add(TEXT("HRK"), CurrencyHRK);
-        _CurrencyMap.Add(TEXT("HTG"), CurrencyHTG);
-        _CurrencyMap.Add(TEXT("HUF"), CurrencyHUF);
-        _CurrencyMap.Add(TEXT("IDR"), CurrencyIDR);
-        _CurrencyMap.Add(TEXT("ILS"), CurrencyILS);
-        _CurrencyMap.Add(TEXT("IMP"), CurrencyIMP);
-        _CurrencyMap.Add(TEXT("INR"), CurrencyINR);
-        _CurrencyMap.Add(TEXT("IQD"), CurrencyIQD);
-        _CurrencyMap.Add(TEXT("IRR"), CurrencyIRR);
-        _CurrencyMap.Add(TEXT("ISK"), CurrencyISK);
-        _CurrencyMap.Add(TEXT("JEP"), CurrencyJEP);
-        _CurrencyMap.Add(TEXT("JMD"), CurrencyJMD);
-        _CurrencyMap.Add(TEXT("JOD"), CurrencyJOD);
-        _CurrencyMap.Add(TEXT("JPY"), CurrencyJPY);
-        _CurrencyMap.Add(TEXT("KES"), CurrencyKES);
-        _CurrencyMap.Add(TEXT("KGS"), CurrencyKGS);
-        _CurrencyMap.Add(TEXT("KHR"), CurrencyKHR);
-        _CurrencyMap.Add(TEXT("KMF"), CurrencyKMF);
-        _CurrencyMap.Add(TEXT("KPW"), CurrencyKPW);
-        _CurrencyMap.Add(TEXT("KRW"), CurrencyKRW);
-        _CurrencyMap.Add(TEXT("KWD"), CurrencyKWD);
-        _CurrencyMap.Add(TEXT("KYD"), CurrencyKYD);
-        _CurrencyMap.Add(TEXT("KZT"), CurrencyKZT);
-        _CurrencyMap.Add(TEXT("LAK"), CurrencyLAK);
-        _CurrencyMap.Add(TEXT("LBP"), CurrencyLBP);
-        _CurrencyMap.Add(TEXT("LKR"), CurrencyLKR);
-        _CurrencyMap.Add(TEXT("LRD"), CurrencyLRD);
-        _CurrencyMap.Add(TEXT("LSL"), CurrencyLSL);
-        _CurrencyMap.Add(TEXT("LYD"), CurrencyLYD);
-        _CurrencyMap.Add(TEXT("MAD"), CurrencyMAD);
-        _CurrencyMap.Add(TEXT("MDL"), CurrencyMDL);
-        _CurrencyMap.Add(TEXT("MGA"), CurrencyMGA);
-        _CurrencyMap.Add(TEXT("MKD"), CurrencyMKD);
-        _CurrencyMap.Add(TEXT("MMK"), CurrencyMMK);
-        _CurrencyMap.Add(TEXT("MNT"), CurrencyMNT);
-        _CurrencyMap.Add(TEXT("MOP"), CurrencyMOP);
-        _CurrencyMap.Add(TEXT("MRO"), CurrencyMRO);
-        _CurrencyMap.Add(TEXT("MUR"), CurrencyMUR);
-        _CurrencyMap.Add(TEXT("MVR"), CurrencyMVR);
-        _CurrencyMap.Add(TEXT("MWK"), CurrencyMWK);
-        _CurrencyMap.Add(TEXT("MXN"), CurrencyMXN);
-        _CurrencyMap.Add(TEXT("MYR"), CurrencyMYR);
-        _CurrencyMap.Add(TEXT("MZN"), CurrencyMZN);
-        _CurrencyMap.Add(TEXT("NAD"), CurrencyNAD);
-        _CurrencyMap.Add(TEXT("NGN"), CurrencyNGN);
-        _CurrencyMap.Add(TEXT("NIO"), CurrencyNIO);
-        _CurrencyMap.Add(TEXT("NOK"), CurrencyNOK);
-        _CurrencyMap.Add(TEXT("NPR"), CurrencyNPR);
-        _CurrencyMap.Add(TEXT("NZD"), CurrencyNZD);
-        _CurrencyMap.Add(TEXT("OMR"), CurrencyOMR);
-        _CurrencyMap.Add(TEXT("PAB"), CurrencyPAB);
-        _CurrencyMap.Add(TEXT("PEN"), CurrencyPEN);
-        _CurrencyMap.Add(TEXT("PGK"), CurrencyPGK);
-        _CurrencyMap.Add(TEXT("PHP"), CurrencyPHP);
-        _CurrencyMap.Add(TEXT("PKR"), CurrencyPKR);
-        _CurrencyMap.Add(TEXT("PLN"), CurrencyPLN);
-        _CurrencyMap.Add(TEXT("PYG"), CurrencyPYG);
-        _CurrencyMap.Add(TEXT("QAR"), CurrencyQAR);
-        _CurrencyMap.Add(TEXT("RON"), CurrencyRON);
-        _CurrencyMap.Add(TEXT("RSD"), CurrencyRSD);
-        _CurrencyMap.Add(TEXT("RUB"), CurrencyRUB);
-        _CurrencyMap.Add(TEXT("RWF"), CurrencyRWF);
-        _CurrencyMap.Add(TEXT("SAR"), CurrencySAR);
-        _CurrencyMap.Add(TEXT("SBD"), CurrencySBD);
-        _CurrencyMap.Add(TEXT("SCR"), CurrencySCR);
-        _CurrencyMap.Add(TEXT("SDG"), CurrencySDG);
-        _CurrencyMap.Add(TEXT("SEK"), CurrencySEK);
-        _CurrencyMap.Add(TEXT("SGD"), CurrencySGD);
-        _CurrencyMap.Add(TEXT("SHP"), CurrencySHP);
-        _CurrencyMap.Add(TEXT("SLL"), CurrencySLL);
-        _CurrencyMap.Add(TEXT("SOS"), CurrencySOS);
-        _CurrencyMap.Add(TEXT("SPL"), CurrencySPL);
-        _CurrencyMap.Add(TEXT("SRD"), CurrencySRD);
-        _CurrencyMap.Add(TEXT("STD"), CurrencySTD);
-        _CurrencyMap.Add(TEXT("SVC"), CurrencySVC);
-        _CurrencyMap.Add(TEXT("SYP"), CurrencySYP);
-        _CurrencyMap.Add(TEXT("SZL"), CurrencySZL);
-        _CurrencyMap.Add(TEXT("THB"), CurrencyTHB);
-        _CurrencyMap.Add(TEXT("TJS"), CurrencyTJS);
-        _CurrencyMap.Add(TEXT("TMT"), CurrencyTMT);
-        _CurrencyMap.Add(TEXT("TND"), CurrencyTND);
-        _CurrencyMap.Add(TEXT("TOP"), CurrencyTOP);
-        _CurrencyMap.Add(TEXT("TRY"), CurrencyTRY);
-        _CurrencyMap.Add(TEXT("TTD"), CurrencyTTD);
-        _CurrencyMap.Add(TEXT("TVD"), CurrencyTVD);
-        _CurrencyMap.Add(TEXT("TWD"), CurrencyTWD);
-        _CurrencyMap.Add(TEXT("TZS"), CurrencyTZS);
-        _CurrencyMap.Add(TEXT("UAH"), CurrencyUAH);
-        _CurrencyMap.Add(TEXT("UGX"), CurrencyUGX);
-        _CurrencyMap.Add(TEXT("USD"), CurrencyUSD);
-        _CurrencyMap.Add(TEXT("UYU"), CurrencyUYU);
-        _CurrencyMap.Add(TEXT("UZS"), CurrencyUZS);
-        _CurrencyMap.Add(TEXT("VEF"), CurrencyVEF);
-        _CurrencyMap.Add(TEXT("VND"), CurrencyVND);
-        _CurrencyMap.Add(TEXT("VUV"), CurrencyVUV);
-        _CurrencyMap.Add(TEXT("WST"), CurrencyWST);
-        _CurrencyMap.Add(TEXT("XAF"), CurrencyXAF);
-        _CurrencyMap.Add(TEXT("XCD"), CurrencyXCD);
-        _CurrencyMap.Add(TEXT("XDR"), CurrencyXDR);
-        _CurrencyMap.Add(TEXT("XOF"), CurrencyXOF);
-        _CurrencyMap.Add(TEXT("XPF"), CurrencyXPF);
-        _CurrencyMap.Add(TEXT("YER"), CurrencyYER);
-        _CurrencyMap.Add(TEXT("ZAR"), CurrencyZAR);
-        _CurrencyMap.Add(TEXT("ZMW"), CurrencyZMW);
-        _CurrencyMap.Add(TEXT("ZWD"), CurrencyZWD);
-
-    }
+    static const TMap<FString, Currency> _CurrencyMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, Currency> Map;
+        Map.Add(TEXT("AED"), CurrencyAED);
+        Map.Add(TEXT("AFN"), CurrencyAFN);
+        Map.Add(TEXT("ALL"), CurrencyALL);
+        Map.Add(TEXT("AMD"), CurrencyAMD);
+        Map.Add(TEXT("ANG"), CurrencyANG);
+        Map.Add(TEXT("AOA"), CurrencyAOA);
+        Map.Add(TEXT("ARS"), CurrencyARS);
+        Map.Add(TEXT("AUD"), CurrencyAUD);
+        Map.Add(TEXT("AWG"), CurrencyAWG);
+        Map.Add(TEXT("AZN"), CurrencyAZN);
+        Map.Add(TEXT("BAM"), CurrencyBAM);
+        Map.Add(TEXT("BBD"), CurrencyBBD);
+        Map.Add(TEXT("BDT"), CurrencyBDT);
+        Map.Add(TEXT("BGN"), CurrencyBGN);
+        Map.Add(TEXT("BHD"), CurrencyBHD);
+        Map.Add(TEXT("BIF"), CurrencyBIF);
+        Map.Add(TEXT("BMD"), CurrencyBMD);
+        Map.Add(TEXT("BND"), CurrencyBND);
+        Map.Add(TEXT("BOB"), CurrencyBOB);
+        Map.Add(TEXT("BRL"), CurrencyBRL);
+        Map.Add(TEXT("BSD"), CurrencyBSD);
+        Map.Add(TEXT("BTN"), CurrencyBTN);
+        Map.Add(TEXT("BWP"), CurrencyBWP);
+        Map.Add(TEXT("BYR"), CurrencyBYR);
+        Map.Add(TEXT("BZD"), CurrencyBZD);
+        Map.Add(TEXT("CAD"), CurrencyCAD);
+        Map.Add(TEXT("CDF"), CurrencyCDF);
+        Map.Add(TEXT("CHF"), CurrencyCHF);
+        Map.Add(TEXT("CLP"), CurrencyCLP);
+        Map.Add(TEXT("CNY"), CurrencyCNY);
+        Map.Add(TEXT("COP"), CurrencyCOP);
+        Map.Add(TEXT("CRC"), CurrencyCRC);
+        Map.Add(TEXT("CUC"), CurrencyCUC);
+        Map.Add(TEXT("CUP"), CurrencyCUP);
+        Map.Add(TEXT("CVE"), CurrencyCVE);
+        Map.Add(TEXT("CZK"), CurrencyCZK);
+        Map.Add(TEXT("DJF"), CurrencyDJF);
+        Map.Add(TEXT("DKK"), CurrencyDKK);
+        Map.Add(TEXT("DOP"), CurrencyDOP);
+        Map.Add(TEXT("DZD"), CurrencyDZD);
+        Map.Add(TEXT("EGP"), CurrencyEGP);
+        Map.Add(TEXT("ERN"), CurrencyERN);
+        Map.Add(TEXT("ETB"), CurrencyETB);
+        Map.Add(TEXT("EUR"), CurrencyEUR);
+        Map.Add(TEXT("FJD"), CurrencyFJD);
+        Map.Add(TEXT("FKP"), CurrencyFKP);
+        Map.Add(TEXT("GBP"), CurrencyGBP);
+        Map.Add(TEXT("GEL"), CurrencyGEL);
+        Map.Add(TEXT("GGP"), CurrencyGGP);
+        Map.Add(TEXT("GHS"), CurrencyGHS);
+        Map.Add(TEXT("GIP"), CurrencyGIP);
+        Map.Add(TEXT("GMD"), CurrencyGMD);
+        Map.Add(TEXT("GNF"), CurrencyGNF);
+        Map.Add(TEXT("GTQ"), CurrencyGTQ);
+        Map.Add(TEXT("GYD"), CurrencyGYD);
+        Map.Add(TEXT("HKD"), CurrencyHKD);
+        Map.Add(TEXT("HNL"), CurrencyHNL);
+        Map.Add(TEXT("HRK"), CurrencyHRK);
+        Map.Add(TEXT("HTG"), CurrencyHTG);
+        Map.Add(TEXT("HUF"), CurrencyHUF);
+        Map.Add(TEXT("IDR"), CurrencyIDR);
+        Map.Add(TEXT("ILS"), CurrencyILS);
+        Map.Add(TEXT("IMP"), CurrencyIMP);
+        Map.Add(TEXT("INR"), CurrencyINR);
+        Map.Add(TEXT("IQD"), CurrencyIQD);
+        Map.Add(TEXT("IRR"), CurrencyIRR);
+        Map.Add(TEXT("ISK"), CurrencyISK);
+        Map.Add(TEXT("JEP"), CurrencyJEP);
+        Map.Add(TEXT("JMD"), CurrencyJMD);
+        Map.Add(TEXT("JOD"), CurrencyJOD);
+        Map.Add(TEXT("JPY"), CurrencyJPY);
+        Map.Add(TEXT("KES"), CurrencyKES);
+        Map.Add(TEXT("KGS"), CurrencyKGS);
+        Map.Add(TEXT("KHR"), CurrencyKHR);
+        Map.Add(TEXT("KMF"), CurrencyKMF);
+        Map.Add(TEXT("KPW"), CurrencyKPW);
+        Map.Add(TEXT("KRW"), CurrencyKRW);
+        Map.Add(TEXT("KWD"), CurrencyKWD);
+        Map.Add(TEXT("KYD"), CurrencyKYD);
+        Map.Add(TEXT("KZT"), CurrencyKZT);
+        Map.Add(TEXT("LAK"), CurrencyLAK);
+        Map.Add(TEXT("LBP"), CurrencyLBP);
+        Map.Add(TEXT("LKR"), CurrencyLKR);
+        Map.Add(TEXT("LRD"), CurrencyLRD);
+        Map.Add(TEXT("LSL"), CurrencyLSL);
+        Map.Add(TEXT("LYD"), CurrencyLYD);
+        Map.Add(TEXT("MAD"), CurrencyMAD);
+        Map.Add(TEXT("MDL"), CurrencyMDL);
+        Map.Add(TEXT("MGA"), CurrencyMGA);
+        Map.Add(TEXT("MKD"), CurrencyMKD);
+        Map.Add(TEXT("MMK"), CurrencyMMK);
+        Map.Add(TEXT("MNT"), CurrencyMNT);
+        Map.Add(TEXT("MOP"), CurrencyMOP);
+        Map.Add(TEXT("MRO"), CurrencyMRO);
+        Map.Add(TEXT("MUR"), CurrencyMUR);
+        Map.Add(TEXT("MVR"), CurrencyMVR);
+        Map.Add(TEXT("MWK"), CurrencyMWK);
+        Map.Add(TEXT("MXN"), CurrencyMXN);
+        Map.Add(TEXT("MYR"), CurrencyMYR);
+        Map.Add(TEXT("MZN"), CurrencyMZN);
+        Map.Add(TEXT("NAD"), CurrencyNAD);
+        Map.Add(TEXT("NGN"), CurrencyNGN);
+        Map.Add(TEXT("NIO"), CurrencyNIO);
+        Map.Add(TEXT("NOK"), CurrencyNOK);
+        Map.Add(TEXT("NPR"), CurrencyNPR);
+        Map.Add(TEXT("NZD"), CurrencyNZD);
+        Map.Add(TEXT("OMR"), CurrencyOMR);
+        Map.Add(TEXT("PAB"), CurrencyPAB);
+        Map.Add(TEXT("PEN"), CurrencyPEN);
+        Map.Add(TEXT("PGK"), CurrencyPGK);
+        Map.Add(TEXT("PHP"), CurrencyPHP);
+        Map.Add(TEXT("PKR"), CurrencyPKR);
+        Map.Add(TEXT("PLN"), CurrencyPLN);
+        Map.Add(TEXT("PYG"), CurrencyPYG);
+        Map.Add(TEXT("QAR"), CurrencyQAR);
+        Map.Add(TEXT("RON"), CurrencyRON);
+        Map.Add(TEXT("RSD"), CurrencyRSD);
+        Map.Add(TEXT("RUB"), CurrencyRUB);
+        Map.Add(TEXT("RWF"), CurrencyRWF);
+        Map.Add(TEXT("SAR"), CurrencySAR);
+        Map.Add(TEXT("SBD"), CurrencySBD);
+        Map.Add(TEXT("SCR"), CurrencySCR);
+        Map.Add(TEXT("SDG"), CurrencySDG);
+        Map.Add(TEXT("SEK"), CurrencySEK);
+        Map.Add(TEXT("SGD"), CurrencySGD);
+        Map.Add(TEXT("SHP"), CurrencySHP);
+        Map.Add(TEXT("SLL"), CurrencySLL);
+        Map.Add(TEXT("SOS"), CurrencySOS);
+        Map.Add(TEXT("SPL"), CurrencySPL);
+        Map.Add(TEXT("SRD"), CurrencySRD);
+        Map.Add(TEXT("STD"), CurrencySTD);
+        Map.Add(TEXT("SVC"), CurrencySVC);
+        Map.Add(TEXT("SYP"), CurrencySYP);
+        Map.Add(TEXT("SZL"), CurrencySZL);
+        Map.Add(TEXT("THB"), CurrencyTHB);
+        Map.Add(TEXT("TJS"), CurrencyTJS);
+        Map.Add(TEXT("TMT"), CurrencyTMT);
+        Map.Add(TEXT("TND"), CurrencyTND);
+        Map.Add(TEXT("TOP"), CurrencyTOP);
+        Map.Add(TEXT("TRY"), CurrencyTRY);
+        Map.Add(TEXT("TTD"), CurrencyTTD);
+        Map.Add(TEXT("TVD"), CurrencyTVD);
+        Map.Add(TEXT("TWD"), CurrencyTWD);
+        Map.Add(TEXT("TZS"), CurrencyTZS);
+        Map.Add(TEXT("UAH"), CurrencyUAH);
+        Map.Add(TEXT("UGX"), CurrencyUGX);
+        Map.Add(TEXT("USD"), CurrencyUSD);
+        Map.Add(TEXT("UYU"), CurrencyUYU);
+        Map.Add(TEXT("UZS"), CurrencyUZS);
+        Map.Add(TEXT("VEF"), CurrencyVEF);
+        Map.Add(TEXT("VND"), CurrencyVND);
+        Map.Add(TEXT("VUV"), CurrencyVUV);
+        Map.Add(TEXT("WST"), CurrencyWST);
+        Map.Add(TEXT("XAF"), CurrencyXAF);
+        Map.Add(TEXT("XCD"), CurrencyXCD);
+        Map.Add(TEXT("XDR"), CurrencyXDR);
+        Map.Add(TEXT("XOF"), CurrencyXOF);
+        Map.Add(TEXT("XPF"), CurrencyXPF);
+        Map.Add(TEXT("YER"), CurrencyYER);
+        Map.Add(TEXT("ZAR"), CurrencyZAR);
+        Map.Add(TEXT("ZMW"), CurrencyZMW);
+        Map.Add(TEXT("ZWD"), CurrencyZWD);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1936,39 +1940,39 @@ ServerModels::UserOrigination PlayFab::ServerModels::readUserOriginationFromValu
 
 ServerModels::UserOrigination PlayFab::ServerModels::readUserOriginationFromValue(const FString& value)
 {
-    static TMap<FString, UserOrigination> _UserOriginationMap;
-    if (_UserOriginationMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _UserOriginationMap.Add(TEXT("Organic"), UserOriginationOrganic);
-        _UserOriginationMap.Add(TEXT("Steam"), UserOriginationSteam);
-        _UserOriginationMap.Add(TEXT("Google"), UserOriginationGoogle);
-        _UserOriginationMap.Add(TEXT("Amazon"), UserOriginationAmazon);
-        _UserOriginationMap.Add(TEXT("Facebook"), UserOriginationFacebook);
-        _UserOriginationMap.Add(TEXT("Kongregate"), UserOriginationKongregate);
-        _UserOriginationMap.Add(TEXT("GamersFirst"), UserOriginationGamersFirst);
-        _UserOriginationMap.Add(TEXT("Unknown"), UserOriginationUnknown);
-        _UserOriginationMap.Add(TEXT("IOS"), UserOriginationIOS);
-        _UserOriginationMap.Add(TEXT("LoadTest"), UserOriginationLoadTest);
-        _UserOriginationMap.Add(TEXT("Android"), UserOriginationAndroid);
-        _UserOriginationMap.Add(TEXT("PSN"), UserOriginationPSN);
-        _UserOriginationMap.Add(TEXT("GameCenter"), UserOriginationGameCenter);
-        _UserOriginationMap.Add(TEXT("CustomId"), UserOriginationCustomId);
-        _UserOriginationMap.Add(TEXT("XboxLive"), UserOriginationXboxLive);
-        _UserOriginationMap.Add(TEXT("Parse"), UserOriginationParse);
-        _UserOriginationMap.Add(TEXT("Twitch"), UserOriginationTwitch);
-        _UserOriginationMap.Add(TEXT("ServerCustomId"), UserOriginationServerCustomId);
-        _UserOriginationMap.Add(TEXT("NintendoSwitchDeviceId"), UserOriginationNintendoSwitchDeviceId);
-        _UserOriginationMap.Add(TEXT("FacebookInstantGamesId"), UserOriginationFacebookInstantGamesId);
-        _UserOriginationMap.Add(TEXT("OpenIdConnect"), UserOriginationOpenIdConnect);
-        _UserOriginationMap.Add(TEXT("Apple"), UserOriginationApple);
-        _UserOriginationMap.Add(TEXT("NintendoSwitchAccount"), UserOriginationNintendoSwitchAccount);
-        _UserOriginationMap.Add(TEXT("GooglePlayGames"), UserOriginationGooglePlayGames);
-        _UserOriginationMap.Add(TEXT("XboxMobileStore"), UserOriginationXboxMobileStore);
-        _UserOriginationMap.Add(TEXT("King"), UserOriginationKing);
-        _UserOriginationMap.Add(TEXT("BattleNet"), UserOriginationBattleNet);
-
-    }
+    static const TMap<FString, UserOrigination> _UserOriginationMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, UserOrigination> Map;
+        Map.Add(TEXT("Organic"), UserOriginationOrganic);
+        Map.Add(TEXT("Steam"), UserOriginationSteam);
+        Map.Add(TEXT("Google"), UserOriginationGoogle);
+        Map.Add(TEXT("Amazon"), UserOriginationAmazon);
+        Map.Add(TEXT("Facebook"), UserOriginationFacebook);
+        Map.Add(TEXT("Kongregate"), UserOriginationKongregate);
+        Map.Add(TEXT("GamersFirst"), UserOriginationGamersFirst);
+        Map.Add(TEXT("Unknown"), UserOriginationUnknown);
+        Map.Add(TEXT("IOS"), UserOriginationIOS);
+        Map.Add(TEXT("LoadTest"), UserOriginationLoadTest);
+        Map.Add(TEXT("Android"), UserOriginationAndroid);
+        Map.Add(TEXT("PSN"), UserOriginationPSN);
+        Map.Add(TEXT("GameCenter"), UserOriginationGameCenter);
+        Map.Add(TEXT("CustomId"), UserOriginationCustomId);
+        Map.Add(TEXT("XboxLive"), UserOriginationXboxLive);
+        Map.Add(TEXT("Parse"), UserOriginationParse);
+        Map.Add(TEXT("Twitch"), UserOriginationTwitch);
+        Map.Add(TEXT("ServerCustomId"), UserOriginationServerCustomId);
+        Map.Add(TEXT("NintendoSwitchDeviceId"), UserOriginationNintendoSwitchDeviceId);
+        Map.Add(TEXT("FacebookInstantGamesId"), UserOriginationFacebookInstantGamesId);
+        Map.Add(TEXT("OpenIdConnect"), UserOriginationOpenIdConnect);
+        Map.Add(TEXT("Apple"), UserOriginationApple);
+        Map.Add(TEXT("NintendoSwitchAccount"), UserOriginationNintendoSwitchAccount);
+        Map.Add(TEXT("GooglePlayGames"), UserOriginationGooglePlayGames);
+        Map.Add(TEXT("XboxMobileStore"), UserOriginationXboxMobileStore);
+        Map.Add(TEXT("King"), UserOriginationKing);
+        Map.Add(TEXT("BattleNet"), UserOriginationBattleNet);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -1996,7 +2000,7 @@ void PlayFab::ServerModels::FEntityKey::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("Id"));
-        writer->WriteValue(Id);
+        writer->WriteValue(Id.ToString());
     }
 
     if (Type.IsEmpty() == false)
@@ -2343,7 +2347,7 @@ void PlayFab::ServerModels::FUserAccountInfo::writeJSON(JsonWriter& writer) cons
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (PrivateInfo.IsValid())
@@ -2479,11 +2483,7 @@ bool PlayFab::ServerModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     }
 
     const TArray<TSharedPtr<FJsonValue>>&OpenIdInfoArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("OpenIdInfo"));
-    for (int32 Idx = 0; Idx < OpenIdInfoArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = OpenIdInfoArray[Idx];
-        OpenIdInfo.Add(FUserOpenIdInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(OpenIdInfoArray, OpenIdInfo);
 
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -2616,7 +2616,7 @@ void PlayFab::ServerModels::FAwardSteamAchievementItem::writeJSON(JsonWriter& wr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("Result"));
@@ -2676,11 +2676,7 @@ bool PlayFab::ServerModels::FAwardSteamAchievementRequest::readFromValue(const T
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AchievementsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Achievements"));
-    for (int32 Idx = 0; Idx < AchievementsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AchievementsArray[Idx];
-        Achievements.Add(FAwardSteamAchievementItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AchievementsArray, Achievements);
 
 
     return HasSucceeded;
@@ -2712,11 +2708,7 @@ bool PlayFab::ServerModels::FAwardSteamAchievementResult::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AchievementResultsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AchievementResults"));
-    for (int32 Idx = 0; Idx < AchievementResultsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AchievementResultsArray[Idx];
-        AchievementResults.Add(FAwardSteamAchievementItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AchievementResultsArray, AchievementResults);
 
 
     return HasSucceeded;
@@ -2761,7 +2753,7 @@ void PlayFab::ServerModels::FBanInfo::writeJSON(JsonWriter& writer) const
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Reason.IsEmpty() == false)
@@ -2856,15 +2848,15 @@ ServerModels::UserFamilyType PlayFab::ServerModels::readUserFamilyTypeFromValue(
 
 ServerModels::UserFamilyType PlayFab::ServerModels::readUserFamilyTypeFromValue(const FString& value)
 {
-    static TMap<FString, UserFamilyType> _UserFamilyTypeMap;
-    if (_UserFamilyTypeMap.Num() == 0)
+    static const TMap<FString, UserFamilyType> _UserFamilyTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _UserFamilyTypeMap.Add(TEXT("None"), UserFamilyTypeNone);
-        _UserFamilyTypeMap.Add(TEXT("Xbox"), UserFamilyTypeXbox);
-        _UserFamilyTypeMap.Add(TEXT("Steam"), UserFamilyTypeSteam);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, UserFamilyType> Map;
+        Map.Add(TEXT("None"), UserFamilyTypeNone);
+        Map.Add(TEXT("Xbox"), UserFamilyTypeXbox);
+        Map.Add(TEXT("Steam"), UserFamilyTypeSteam);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -2904,7 +2896,7 @@ void PlayFab::ServerModels::FBanRequest::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Reason.IsEmpty() == false)
@@ -2993,16 +2985,13 @@ bool PlayFab::ServerModels::FBanUsersRequest::readFromValue(const TSharedPtr<FJs
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BansArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Bans"));
-    for (int32 Idx = 0; Idx < BansArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BansArray[Idx];
-        Bans.Add(FBanRequest(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BansArray, Bans);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -3038,11 +3027,7 @@ bool PlayFab::ServerModels::FBanUsersResult::readFromValue(const TSharedPtr<FJso
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -3573,7 +3558,7 @@ void PlayFab::ServerModels::FItemInstance::writeJSON(JsonWriter& writer) const
     if (ItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (PurchaseDate.notNull())
@@ -3636,6 +3621,7 @@ bool PlayFab::ServerModels::FItemInstance::readFromValue(const TSharedPtr<FJsonO
     const TSharedPtr<FJsonObject>* CustomDataObject;
     if (obj->TryGetObjectField(TEXT("CustomData"), CustomDataObject))
     {
+        CustomData.Reserve((*CustomDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
             CustomData.Add(It.Key(), It.Value()->AsString());
@@ -3723,7 +3709,7 @@ void PlayFab::ServerModels::FCharacterInventory::writeJSON(JsonWriter& writer) c
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (Inventory.Num() != 0)
@@ -3750,11 +3736,7 @@ bool PlayFab::ServerModels::FCharacterInventory::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&InventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Inventory"));
-    for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(InventoryArray, Inventory);
 
 
     return HasSucceeded;
@@ -3772,7 +3754,7 @@ void PlayFab::ServerModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& wr
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CharacterName.IsEmpty() == false)
@@ -3796,7 +3778,7 @@ void PlayFab::ServerModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& wr
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("Position"));
@@ -3876,7 +3858,7 @@ void PlayFab::ServerModels::FCharacterResult::writeJSON(JsonWriter& writer) cons
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CharacterName.IsEmpty() == false)
@@ -3941,16 +3923,16 @@ ServerModels::ChurnRiskLevel PlayFab::ServerModels::readChurnRiskLevelFromValue(
 
 ServerModels::ChurnRiskLevel PlayFab::ServerModels::readChurnRiskLevelFromValue(const FString& value)
 {
-    static TMap<FString, ChurnRiskLevel> _ChurnRiskLevelMap;
-    if (_ChurnRiskLevelMap.Num() == 0)
+    static const TMap<FString, ChurnRiskLevel> _ChurnRiskLevelMap = []()
     {
-        // Auto-generate the map on the first use
-        _ChurnRiskLevelMap.Add(TEXT("NoData"), ChurnRiskLevelNoData);
-        _ChurnRiskLevelMap.Add(TEXT("LowRisk"), ChurnRiskLevelLowRisk);
-        _ChurnRiskLevelMap.Add(TEXT("MediumRisk"), ChurnRiskLevelMediumRisk);
-        _ChurnRiskLevelMap.Add(TEXT("HighRisk"), ChurnRiskLevelHighRisk);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ChurnRiskLevel> Map;
+        Map.Add(TEXT("NoData"), ChurnRiskLevelNoData);
+        Map.Add(TEXT("LowRisk"), ChurnRiskLevelLowRisk);
+        Map.Add(TEXT("MediumRisk"), ChurnRiskLevelMediumRisk);
+        Map.Add(TEXT("HighRisk"), ChurnRiskLevelHighRisk);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -3980,15 +3962,15 @@ ServerModels::CloudScriptRevisionOption PlayFab::ServerModels::readCloudScriptRe
 
 ServerModels::CloudScriptRevisionOption PlayFab::ServerModels::readCloudScriptRevisionOptionFromValue(const FString& value)
 {
-    static TMap<FString, CloudScriptRevisionOption> _CloudScriptRevisionOptionMap;
-    if (_CloudScriptRevisionOptionMap.Num() == 0)
+    static const TMap<FString, CloudScriptRevisionOption> _CloudScriptRevisionOptionMap = []()
     {
-        // Auto-generate the map on the first use
-        _CloudScriptRevisionOptionMap.Add(TEXT("Live"), CloudScriptRevisionOptionLive);
-        _CloudScriptRevisionOptionMap.Add(TEXT("Latest"), CloudScriptRevisionOptionLatest);
-        _CloudScriptRevisionOptionMap.Add(TEXT("Specific"), CloudScriptRevisionOptionSpecific);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, CloudScriptRevisionOption> Map;
+        Map.Add(TEXT("Live"), CloudScriptRevisionOptionLive);
+        Map.Add(TEXT("Latest"), CloudScriptRevisionOptionLatest);
+        Map.Add(TEXT("Specific"), CloudScriptRevisionOptionSpecific);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -4012,7 +3994,7 @@ void PlayFab::ServerModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) c
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("ConsumeCount"));
@@ -4036,7 +4018,7 @@ void PlayFab::ServerModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -4046,7 +4028,7 @@ void PlayFab::ServerModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -4073,6 +4055,7 @@ bool PlayFab::ServerModels::FConsumeItemRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -4108,7 +4091,7 @@ void PlayFab::ServerModels::FConsumeItemResult::writeJSON(JsonWriter& writer) co
     if (ItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("RemainingUses"));
@@ -4156,15 +4139,15 @@ ServerModels::EmailVerificationStatus PlayFab::ServerModels::readEmailVerificati
 
 ServerModels::EmailVerificationStatus PlayFab::ServerModels::readEmailVerificationStatusFromValue(const FString& value)
 {
-    static TMap<FString, EmailVerificationStatus> _EmailVerificationStatusMap;
-    if (_EmailVerificationStatusMap.Num() == 0)
+    static const TMap<FString, EmailVerificationStatus> _EmailVerificationStatusMap = []()
     {
-        // Auto-generate the map on the first use
-        _EmailVerificationStatusMap.Add(TEXT("Unverified"), EmailVerificationStatusUnverified);
-        _EmailVerificationStatusMap.Add(TEXT("Pending"), EmailVerificationStatusPending);
-        _EmailVerificationStatusMap.Add(TEXT("Confirmed"), EmailVerificationStatusConfirmed);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, EmailVerificationStatus> Map;
+        Map.Add(TEXT("Unverified"), EmailVerificationStatusUnverified);
+        Map.Add(TEXT("Pending"), EmailVerificationStatusPending);
+        Map.Add(TEXT("Confirmed"), EmailVerificationStatusConfirmed);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -4305,20 +4288,20 @@ ServerModels::ContinentCode PlayFab::ServerModels::readContinentCodeFromValue(co
 
 ServerModels::ContinentCode PlayFab::ServerModels::readContinentCodeFromValue(const FString& value)
 {
-    static TMap<FString, ContinentCode> _ContinentCodeMap;
-    if (_ContinentCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _ContinentCodeMap.Add(TEXT("AF"), ContinentCodeAF);
-        _ContinentCodeMap.Add(TEXT("AN"), ContinentCodeAN);
-        _ContinentCodeMap.Add(TEXT("AS"), ContinentCodeAS);
-        _ContinentCodeMap.Add(TEXT("EU"), ContinentCodeEU);
-        _ContinentCodeMap.Add(TEXT("NA"), ContinentCodeNA);
-        _ContinentCodeMap.Add(TEXT("OC"), ContinentCodeOC);
-        _ContinentCodeMap.Add(TEXT("SA"), ContinentCodeSA);
-        _ContinentCodeMap.Add(TEXT("Unknown"), ContinentCodeUnknown);
-
-    }
+    static const TMap<FString, ContinentCode> _ContinentCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ContinentCode> Map;
+        Map.Add(TEXT("AF"), ContinentCodeAF);
+        Map.Add(TEXT("AN"), ContinentCodeAN);
+        Map.Add(TEXT("AS"), ContinentCodeAS);
+        Map.Add(TEXT("EU"), ContinentCodeEU);
+        Map.Add(TEXT("NA"), ContinentCodeNA);
+        Map.Add(TEXT("OC"), ContinentCodeOC);
+        Map.Add(TEXT("SA"), ContinentCodeSA);
+        Map.Add(TEXT("Unknown"), ContinentCodeUnknown);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -4595,262 +4578,262 @@ ServerModels::CountryCode PlayFab::ServerModels::readCountryCodeFromValue(const
 
 ServerModels::CountryCode PlayFab::ServerModels::readCountryCodeFromValue(const FString& value)
 {
-    static TMap<FString, CountryCode> _CountryCodeMap;
-    if (_CountryCodeMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _CountryCodeMap.Add(TEXT("AF"), CountryCodeAF);
-        _CountryCodeMap.Add(TEXT("AX"), CountryCodeAX);
-        _CountryCodeMap.Add(TEXT("AL"), CountryCodeAL);
-        _CountryCodeMap.Add(TEXT("DZ"), CountryCodeDZ);
-        _CountryCodeMap.Add(TEXT("AS"), CountryCodeAS);
-        _CountryCodeMap.Add(TEXT("AD"), CountryCodeAD);
-        _CountryCodeMap.Add(TEXT("AO"), CountryCodeAO);
-        _CountryCodeMap.Add(TEXT("AI"), CountryCodeAI);
-        _CountryCodeMap.Add(TEXT("AQ"), CountryCodeAQ);
-        _CountryCodeMap.Add(TEXT("AG"), CountryCodeAG);
-        _CountryCodeMap.Add(TEXT("AR"), CountryCodeAR);
-        _CountryCodeMap.Add(TEXT("AM"), CountryCodeAM);
-        _CountryCodeMap.Add(TEXT("AW"), CountryCodeAW);
-        _CountryCodeMap.Add(TEXT("AU"), CountryCodeAU);
-        _CountryCodeMap.Add(TEXT("AT"), CountryCodeAT);
-        _CountryCodeMap.Add(TEXT("AZ"), CountryCodeAZ);
-        _CountryCodeMap.Add(TEXT("BS"), CountryCodeBS);
-        _CountryCodeMap.Add(TEXT("BH"), CountryCodeBH);
-        _CountryCodeMap.Add(TEXT("BD"), CountryCodeBD);
-        _CountryCodeMap.Add(TEXT("BB"), CountryCodeBB);
-        _CountryCodeMap.Add(TEXT("BY"), CountryCodeBY);
-        _CountryCodeMap.Add(TEXT("BE"), CountryCodeBE);
-        _CountryCodeMap.Add(TEXT("BZ"), CountryCodeBZ);
-        _CountryCodeMap.Add(TEXT("BJ"), CountryCodeBJ);
-        _CountryCodeMap.Add(TEXT("BM"), CountryCodeBM);
-        _CountryCodeMap.Add(TEXT("BT"), CountryCodeBT);
-        _CountryCodeMap.Add(TEXT("BO"), CountryCodeBO);
-        _CountryCodeMap.Add(TEXT("BQ"), CountryCodeBQ);
-        _CountryCodeMap.Add(TEXT("BA"), CountryCodeBA);
-        _CountryCodeMap.Add(TEXT("BW"), CountryCodeBW);
-        _CountryCodeMap.Add(TEXT("BV"), CountryCodeBV);
-        _CountryCodeMap.Add(TEXT("BR"), CountryCodeBR);
-        _CountryCodeMap.Add(TEXT("IO"), CountryCodeIO);
-        _CountryCodeMap.Add(TEXT("BN"), CountryCodeBN);
-        _CountryCodeMap.Add(TEXT("BG"), CountryCodeBG);
-        _CountryCodeMap.Add(TEXT("BF"), CountryCodeBF);
-        _CountryCodeMap.Add(TEXT("BI"), CountryCodeBI);
-        _CountryCodeMap.Add(TEXT("KH"), CountryCodeKH);
-        _CountryCodeMap.Add(TEXT("CM"), CountryCodeCM);
-        _CountryCodeMap.Add(TEXT("CA"), CountryCodeCA);
-        _CountryCodeMap.Add(TEXT("CV"), CountryCodeCV);
-        _CountryCodeMap.Add(TEXT("KY"), CountryCodeKY);
-        _CountryCodeMap.Add(TEXT("CF"), CountryCodeCF);
-        _CountryCodeMap.Add(TEXT("TD"), CountryCodeTD);
-        _CountryCodeMap.Add(TEXT("CL"), CountryCodeCL);
-        _CountryCodeMap.Add(TEXT("CN"), CountryCodeCN);
-        _CountryCodeMap.Add(TEXT("CX"), CountryCodeCX);
-        _CountryCodeMap.Add(TEXT("CC"), CountryCodeCC);
-        _CountryCodeMap.Add(TEXT("CO"), CountryCodeCO);
-        _CountryCodeMap.Add(TEXT("KM"), CountryCodeKM);
-        _CountryCodeMap.Add(TEXT("CG"), CountryCodeCG);
-        _CountryCodeMap.Add(TEXT("CD"), CountryCodeCD);
-        _CountryCodeMap.Add(TEXT("CK"), CountryCodeCK);
-        _CountryCodeMap.Add(TEXT("CR"), CountryCodeCR);
-        _CountryCodeMap.Add(TEXT("CI"), CountryCodeCI);
-        _CountryCodeMap.Add(TEXT("HR"), CountryCodeHR);
-        _CountryCodeMap.Add(TEXT("CU"), CountryCodeCU);
-        _CountryCodeMap.Add(TEXT("CW"), CountryCodeCW);
-        _CountryCodeMap.Add(TEXT("CY"), CountryCodeCY);
-        _CountryCodeMap.Add(TEXT("CZ"), CountryCodeCZ);
-        _CountryCodeMap.Add(TEXT("DK"), CountryCodeDK);
-        _CountryCodeMap.Add(TEXT("DJ"), CountryCodeDJ);
-        _CountryCodeMap.Add(TEXT("DM"), CountryCodeDM);
-        _CountryCodeMap.Add(TEXT("DO"), CountryCodeDO);
-        _CountryCodeMap.Add(TEXT("EC"), CountryCodeEC);
-        _CountryCodeMap.Add(TEXT("EG"), CountryCodeEG);
-        _CountryCodeMap.Add(TEXT("SV"), CountryCodeSV);
-        _CountryCodeMap.Add(TEXT("GQ"), CountryCodeGQ);
-        _CountryCodeMap.Add(TEXT("ER"), CountryCodeER);
-        _CountryCodeMap.Add(TEXT("EE"), CountryCodeEE);
-        _CountryCodeMap.Add(TEXT("ET"), CountryCodeET);
-        _CountryCodeMap.Add(TEXT("FK"), CountryCodeFK);
-        _CountryCodeMap.Add(TEXT("FO"), CountryCodeFO);
-        _CountryCodeMap.Add(TEXT("FJ"), CountryCodeFJ);
-        _CountryCodeMap.Add(TEXT("FI"), CountryCodeFI);
-        _CountryCodeMap.Add(TEXT("FR"), CountryCodeFR);
-        _CountryCodeMap.Add(TEXT("GF"), CountryCodeGF);
-        _CountryCodeMap.Add(TEXT("PF"), CountryCodePF);
-        _CountryCodeMap.Add(TEXT("TF"), CountryCodeTF);
-        _CountryCodeMap.Add(TEXT("GA"), CountryCodeGA);
-        _CountryCodeMap.Add(TEXT("GM"), CountryCodeGM);
-        _CountryCodeMap.Add(TEXT("GE"), CountryCodeGE);
-        _CountryCodeMap.Add(TEXT("DE"), CountryCodeDE);
-        _CountryCodeMap.Add(TEXT("GH"), CountryCodeGH);
-        _CountryCodeMap.Add(TEXT("GI"), CountryCodeGI);
-        _CountryCodeMap.Add(TEXT("GR"), CountryCodeGR);
-        _CountryCodeMap.Add(TEXT("GL"), CountryCodeGL);
-        _CountryCodeMap.Add(TEXT("GD"), CountryCodeGD);
-        _CountryCodeMap.Add(TEXT("GP"), CountryCodeGP);
-        _CountryCodeMap.Add(TEXT("GU"), CountryCodeGU);
-        _CountryCodeMap.Add(TEXT("GT"), CountryCodeGT);
-        _CountryCodeMap.Add(TEXT("GG"), CountryCodeGG);
-        _CountryCodeMap.Add(TEXT("GN"), CountryCodeGN);
-        _CountryCodeMap.Add(TEXT("GW"), CountryCodeGW);
-        _CountryCodeMap.Add(TEXT("GY"), CountryCodeGY);
-        _CountryCodeMap.Add(TEXT("HT"), CountryCodeHT);
-        _CountryCodeMap.Add(TEXT("HM"), CountryCodeHM);
-        _CountryCodeMap.Add(TEXT("VA"), CountryCodeVA);
-        _CountryCodeMap.Add(TEXT("HN"), CountryCodeHN);
-        _CountryCodeMap.Add(TEXT("HK"), CountryCodeHK);
-        _CountryCodeMap.Add(TEXT("HU"), CountryCodeHU);
-        _CountryCodeMap.Add(TEXT("IS"), CountryCodeIS);
-        _CountryCodeMap.Add(TEXT("IN"), CountryCodeIN);
-        _CountryCodeMap.Add(TEXT("ID"), CountryCodeID);
-        _CountryCodeMap.Add(TEXT("IR"), CountryCodeIR);
-        _CountryCodeMap.Add(TEXT("IQ"), CountryCodeIQ);
-        _CountryCodeMap.Add(TEXT("IE"), CountryCodeIE);
-        _CountryCodeMap.Add(TEXT("IM"), CountryCodeIM);
-        _CountryCodeMap.Add(TEXT("IL"), CountryCodeIL);
-        _CountryCodeMap.Add(TEXT("IT"), CountryCodeIT);
-        _CountryCodeMap.Add(TEXT("JM"), CountryCodeJM);
-        _CountryCodeMap.Add(TEXT("JP"), CountryCodeJP);
-        _CountryCodeMap.Add(TEXT("JE"), CountryCodeJE);
-        _CountryCodeMap.Add(TEXT("JO"), CountryCodeJO);
-        _CountryCodeMap.Add(TEXT("KZ"), CountryCodeKZ);
-        _CountryCodeMap.Add(TEXT("KE"), CountryCodeKE);
-        _CountryCodeMap.Add(TEXT("KI"), CountryCodeKI);
-        _CountryCodeMap.Add(TEXT("KP"), CountryCodeKP);
-        _CountryCodeMap.Add(TEXT("KR"), CountryCodeKR);
-        _CountryCodeMap.Add(TEXT("KW"), CountryCodeKW);
-        _CountryCodeMap.Add(TEXT("KG"), CountryCodeKG);
-        _CountryCodeMap.Add(TEXT("LA"), CountryCodeLA);
-        _CountryCodeMap.Add(TEXT("LV"), CountryCodeLV);
-        _CountryCodeMap.Add(TEXT("LB"), CountryCodeLB);
-        _CountryCodeMap.Add(TEXT("LS"), CountryCodeLS);
-        _CountryCodeMap.Add(TEXT("LR"), CountryCodeLR);
-        _CountryCodeMap.Add(TEXT("LY"), CountryCodeLY);
-        _CountryCodeMap.Add(TEXT("LI"), CountryCodeLI);
-        _CountryCodeMap.Add(TEXT("LT"), CountryCodeLT);
-        _CountryCodeMap.Add(TEXT("LU"), CountryCodeLU);
-        _CountryCodeMap.Add(TEXT("MO"), CountryCodeMO);
-        _CountryCodeMap.Add(TEXT("MK"), CountryCodeMK);
-        _CountryCodeMap.Add(TEXT("MG"), CountryCodeMG);
-        _CountryCodeMap.Add(TEXT("MW"), CountryCodeMW);
-        _CountryCodeMap.Add(TEXT("MY"), CountryCodeMY);
-        _CountryCodeMap.Add(TEXT("MV"), CountryCodeMV);
-        _CountryCodeMap.Add(TEXT("ML"), CountryCodeML);
-        _CountryCodeMap.Add(TEXT("MT"), CountryCodeMT);
-        _CountryCodeMap.Add(TEXT("MH"), CountryCodeMH);
-        _CountryCodeMap.Add(TEXT("MQ"), CountryCodeMQ);
-        _CountryCodeMap.Add(TEXT("MR"), CountryCodeMR);
-        _CountryCodeMap.Add(TEXT("MU"), CountryCodeMU);
-        _CountryCodeMap.Add(TEXT("YT"), CountryCodeYT);
-        _CountryCodeMap.Add(TEXT("MX"), CountryCodeMX);
-        _CountryCodeMap.Add(TEXT("FM"), CountryCodeFM);
-        _CountryCodeMap.Add(TEXT("MD"), CountryCodeMD);
-        _CountryCodeMap.Add(TEXT("MC"), CountryCodeMC);
-        _CountryCodeMap.Add(TEXT("MN"), CountryCodeMN);
-        _CountryCodeMap.Add(TEXT("ME"), CountryCodeME);
-        _CountryCodeMap.Add(TEXT("MS"), CountryCodeMS);
-        _CountryCodeMap.Add(TEXT("MA"), CountryCodeMA);
-        _CountryCodeMap.Add(TEXT("MZ"), CountryCodeMZ);
-        _CountryCodeMap.Add(TEXT("MM"), CountryCodeMM);
-        _CountryCodeMap.Add(TEXT("NA"), CountryCodeNA);
-        _CountryCodeMap.Add(TEXT("NR"), CountryCodeNR);
-        _CountryCodeMap.Add(TEXT("NP"), CountryCodeNP);
-        _CountryCodeMap.Add(TEXT("NL"), CountryCodeNL);
-        _CountryCodeMap.Add(TEXT("NC"), CountryCodeNC);
-        _CountryCodeMap.Add(TEXT("NZ"), CountryCodeNZ);
-        _CountryCodeMap.Add(TEXT("NI"), CountryCodeNI);
-        _CountryCodeMap.Add(TEXT("NE"), CountryCodeNE);
-        _CountryCodeMap.Add(TEXT("NG"), CountryCodeNG);
-        _CountryCodeMap.Add(TEXT("NU"), CountryCodeNU);
-        _CountryCodeMap.Add(TEXT("NF"), CountryCodeNF);
-        _CountryCodeMap.Add(TEXT("MP"), CountryCodeMP);
-        _CountryCodeMap.Add(TEXT("NO"), CountryCodeNO);
-        _CountryCodeMap.Add(TEXT("OM"), CountryCodeOM);
-        _CountryCodeMap.Add(TEXT("PK"), CountryCodePK);
-        _CountryCodeMap.Add(TEXT("PW"), CountryCodePW);
-        _CountryCodeMap.Add(TEXT("PS"), CountryCodePS);
-        _CountryCodeMap.Add(TEXT("PA"), CountryCodePA);
-        _CountryCodeMap.Add(TEXT("PG"), CountryCodePG);
-        _CountryCodeMap.Add(TEXT("PY"), CountryCodePY);
-        _CountryCodeMap.Add(TEXT("PE"), CountryCodePE);
-        _CountryCodeMap.Add(TEXT("PH"), CountryCodePH);
-        _CountryCodeMap.Add(TEXT("PN"), CountryCodePN);
-        _CountryCodeMap.Add(TEXT("PL"), CountryCodePL);
-        _CountryCodeMap.Add(TEXT("PT"), CountryCodePT);
-        _CountryCodeMap.Add(TEXT("PR"), CountryCodePR);
-        _CountryCodeMap.Add(TEXT("QA"), CountryCodeQA);
-        _CountryCodeMap.Add(TEXT("RE"), CountryCodeRE);
-        _CountryCodeMap.Add(TEXT("RO"), CountryCodeRO);
-        _CountryCodeMap.Add(TEXT("RU"), CountryCodeRU);
-        _CountryCodeMap.Add(TEXT("RW"), CountryCodeRW);
-        _CountryCodeMap.Add(TEXT("BL"), CountryCodeBL);
-        _CountryCodeMap.Add(TEXT("SH"), CountryCodeSH);
-        _CountryCodeMap.Add(TEXT("KN"), CountryCodeKN);
-        _CountryCodeMap.Add(TEXT("LC"), CountryCodeLC);
-        _CountryCodeMap.Add(TEXT("MF"), CountryCodeMF);
-        _CountryCodeMap.Add(TEXT("PM"), CountryCodePM);
-        _CountryCodeMap.Add(TEXT("VC"), CountryCodeVC);
-        _CountryCodeMap.Add(TEXT("WS"), CountryCodeWS);
-        _CountryCodeMap.Add(TEXT("SM"), CountryCodeSM);
-        _CountryCodeMap.Add(TEXT("ST"), CountryCodeST);
-        _CountryCodeMap.Add(TEXT("SA"), CountryCodeSA);
-        _CountryCodeMap.Add(TEXT("SN"), CountryCodeSN);
-        _CountryCodeMap.Add(TEXT("RS"), CountryCodeRS);
-        _CountryCodeMap.Add(TEXT("SC"), CountryCodeSC);
-        _CountryCodeMap.Add(TEXT("SL"), CountryCodeSL);
-        _CountryCodeMap.Add(TEXT("SG"), CountryCodeSG);
-        _CountryCodeMap.Add(TEXT("SX"), CountryCodeSX);
-        _CountryCodeMap.Add(TEXT("SK"), CountryCodeSK);
-        _CountryCodeMap.Add(TEXT("SI"), CountryCodeSI);
-        _CountryCodeMap.Add(TEXT("SB"), CountryCodeSB);
-        _CountryCodeMap.Add(TEXT("SO"), CountryCodeSO);
-        _CountryCodeMap.Add(TEXT("ZA"), CountryCodeZA);
-        _CountryCodeMap.Add(TEXT("GS"), CountryCodeGS);
-        _CountryCodeMap.Add(TEXT("SS"), CountryCodeSS);
-        _CountryCodeMap.Add(TEXT("ES"), CountryCodeES);
-        _CountryCodeMap.Add(TEXT("LK"), CountryCodeLK);
-        _CountryCodeMap.Add(TEXT("SD"), CountryCodeSD);
-        _CountryCodeMap.Add(TEXT("SR"), CountryCodeSR);
-        _CountryCodeMap.Add(TEXT("SJ"), CountryCodeSJ);
-        _CountryCodeMap.Add(TEXT("SZ"), CountryCodeSZ);
-        _CountryCodeMap.Add(TEXT("SE"), CountryCodeSE);
-        _CountryCodeMap.Add(TEXT("CH"), CountryCodeCH);
-        _CountryCodeMap.Add(TEXT("SY"), CountryCodeSY);
-        _CountryCodeMap.Add(TEXT("TW"), CountryCodeTW);
-        _CountryCodeMap.Add(TEXT("TJ"), CountryCodeTJ);
-        _CountryCodeMap.Add(TEXT("TZ"), CountryCodeTZ);
-        _CountryCodeMap.Add(TEXT("TH"), CountryCodeTH);
-        _CountryCodeMap.Add(TEXT("TL"), CountryCodeTL);
-        _CountryCodeMap.Add(TEXT("TG"), CountryCodeTG);
-        _CountryCodeMap.Add(TEXT("TK"), CountryCodeTK);
-        _CountryCodeMap.Add(TEXT("TO"), CountryCodeTO);
-        _CountryCodeMap.Add(TEXT("TT"), CountryCodeTT);
-        _CountryCodeMap.Add(TEXT("TN"), CountryCodeTN);
-        _CountryCodeMap.Add(TEXT("TR"), CountryCodeTR);
-        _CountryCodeMap.Add(TEXT("TM"), CountryCodeTM);
-        _CountryCodeMap.Add(TEXT("TC"), CountryCodeTC);
-        _CountryCodeMap.Add(TEXT("TV"), CountryCodeTV);
-        _CountryCodeMap.Add(TEXT("UG"), CountryCodeUG);
-        _CountryCodeMap.Add(TEXT("UA"), CountryCodeUA);
-        _CountryCodeMap.Add(TEXT("AE"), CountryCodeAE);
-        _CountryCodeMap.Add(TEXT("GB"), CountryCodeGB);
-        _CountryCodeMap.Add(TEXT("US"), CountryCodeUS);
-        _CountryCodeMap.Add(TEXT("UM"), CountryCodeUM);
-        _CountryCodeMap.Add(TEXT("UY"), CountryCodeUY);
-        _CountryCodeMap.Add(TEXT("UZ"), CountryCodeUZ);
-        _CountryCodeMap.Add(TEXT("VU"), CountryCodeVU);
-        _CountryCodeMap.Add(TEXT("VE"), CountryCodeVE);
-        _CountryCodeMap.Add(TEXT("VN"), CountryCodeVN);
-        _CountryCodeMap.Add(TEXT("VG"), CountryCodeVG);
-        _CountryCodeMap.Add(TEXT("VI"), CountryCodeVI);
-        _CountryCodeMap.Add(TEXT("WF"), CountryCodeWF);
-        _CountryCodeMap.Add(TEXT("EH"), CountryCodeEH);
-        _CountryCodeMap.Add(TEXT("YE"), CountryCodeYE);
-        _CountryCodeMap.Add(TEXT("ZM"), CountryCodeZM);
-        _CountryCodeMap.Add(TEXT("ZW"), CountryCodeZW);
-        _CountryCodeMap.Add(TEXT("Unknown"), CountryCodeUnknown);
-
-    }
+    static const TMap<FString, CountryCode> _CountryCodeMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, CountryCode> Map;
+        Map.Add(TEXT("AF"), CountryCodeAF);
+        Map.Add(TEXT("AX"), CountryCodeAX);
+        Map.Add(TEXT("AL"), CountryCodeAL);
+        Map.Add(TEXT("DZ"), CountryCodeDZ);
+        Map.Add(TEXT("AS"), CountryCodeAS);
+        Map.Add(TEXT("AD"), CountryCodeAD);
+        Map.Add(TEXT("AO"), CountryCodeAO);
+        Map.Add(TEXT("AI"), CountryCodeAI);
+        Map.Add(TEXT("AQ"), CountryCodeAQ);
+        Map.Add(TEXT("AG"), CountryCodeAG);
+        Map.Add(TEXT("AR"), CountryCodeAR);
+        Map.Add(TEXT("AM"), CountryCodeAM);
+        Map.Add(TEXT("AW"), CountryCodeAW);
+        Map.Add(TEXT("AU"), CountryCodeAU);
+        Map.Add(TEXT("AT"), CountryCodeAT);
+        Map.Add(TEXT("AZ"), CountryCodeAZ);
+        Map.Add(TEXT("BS"), CountryCodeBS);
+        Map.Add(TEXT("BH"), CountryCodeBH);
+        Map.Add(TEXT("BD"), CountryCodeBD);
+        Map.Add(TEXT("BB"), CountryCodeBB);
+        Map.Add(TEXT("BY"), CountryCodeBY);
+        Map.Add(TEXT("BE"), CountryCodeBE);
+        Map.Add(TEXT("BZ"), CountryCodeBZ);
+        Map.Add(TEXT("BJ"), CountryCodeBJ);
+        Map.Add(TEXT("BM"), CountryCodeBM);
+        Map.Add(TEXT("BT"), CountryCodeBT);
+        Map.Add(TEXT("BO"), CountryCodeBO);
+        Map.Add(TEXT("BQ"), CountryCodeBQ);
+        Map.Add(TEXT("BA"), CountryCodeBA);
+        Map.Add(TEXT("BW"), CountryCodeBW);
+        Map.Add(TEXT("BV"), CountryCodeBV);
+        Map.Add(TEXT("BR"), CountryCodeBR);
+        Map.Add(TEXT("IO"), CountryCodeIO);
+        Map.Add(TEXT("BN"), CountryCodeBN);
+        Map.Add(TEXT("BG"), CountryCodeBG);
+        Map.Add(TEXT("BF"), CountryCodeBF);
+        Map.Add(TEXT("BI"), CountryCodeBI);
+        Map.Add(TEXT("KH"), CountryCodeKH);
+        Map.Add(TEXT("CM"), CountryCodeCM);
+        Map.Add(TEXT("CA"), CountryCodeCA);
+        Map.Add(TEXT("CV"), CountryCodeCV);
+        Map.Add(TEXT("KY"), CountryCodeKY);
+        Map.Add(TEXT("CF"), CountryCodeCF);
+        Map.Add(TEXT("TD"), CountryCodeTD);
+        Map.Add(TEXT("CL"), CountryCodeCL);
+        Map.Add(TEXT("CN"), CountryCodeCN);
+        Map.Add(TEXT("CX"), CountryCodeCX);
+        Map.Add(TEXT("CC"), CountryCodeCC);
+        Map.Add(TEXT("CO"), CountryCodeCO);
+        Map.Add(TEXT("KM"), CountryCodeKM);
+        Map.Add(TEXT("CG"), CountryCodeCG);
+        Map.Add(TEXT("CD"), CountryCodeCD);
+        Map.Add(TEXT("CK"), CountryCodeCK);
+        Map.Add(TEXT("CR"), CountryCodeCR);
+        Map.Add(TEXT("CI"), CountryCodeCI);
+        Map.Add(TEXT("HR"), CountryCodeHR);
+        Map.Add(TEXT("CU"), CountryCodeCU);
+        Map.Add(TEXT("CW"), CountryCodeCW);
+        Map.Add(TEXT("CY"), CountryCodeCY);
+        Map.Add(TEXT("CZ"), CountryCodeCZ);
+        Map.Add(TEXT("DK"), CountryCodeDK);
+        Map.Add(TEXT("DJ"), CountryCodeDJ);
+        Map.Add(TEXT("DM"), CountryCodeDM);
+        Map.Add(TEXT("DO"), CountryCodeDO);
+        Map.Add(TEXT("EC"), CountryCodeEC);
+        Map.Add(TEXT("EG"), CountryCodeEG);
+        Map.Add(TEXT("SV"), CountryCodeSV);
+        Map.Add(TEXT("GQ"), CountryCodeGQ);
+        Map.Add(TEXT("ER"), CountryCodeER);
+        Map.Add(TEXT("EE"), CountryCodeEE);
+        Map.Add(TEXT("ET"), CountryCodeET);
+        Map.Add(TEXT("FK"), CountryCodeFK);
+        Map.Add(TEXT("FO"), CountryCodeFO);
+        Map.Add(TEXT("FJ"), CountryCodeFJ);
+        Map.Add(TEXT("FI"), CountryCodeFI);
+        Map.Add(TEXT("FR"), CountryCodeFR);
+        Map.Add(TEXT("GF"), CountryCodeGF);
+        Map.Add(TEXT("PF"), CountryCodePF);
+        Map.Add(TEXT("TF"), CountryCodeTF);
+        Map.Add(TEXT("GA"), CountryCodeGA);
+        Map.Add(TEXT("GM"), CountryCodeGM);
+        Map.Add(TEXT("GE"), CountryCodeGE);
+        Map.Add(TEXT("DE"), CountryCodeDE);
+        Map.Add(TEXT("GH"), CountryCodeGH);
+        Map.Add(TEXT("GI"), CountryCodeGI);
+        Map.Add(TEXT("GR"), CountryCodeGR);
+        Map.Add(TEXT("GL"), CountryCodeGL);
+        Map.Add(TEXT("GD"), CountryCodeGD);
+        Map.Add(TEXT("GP"), CountryCodeGP);
+        Map.Add(TEXT("GU"), CountryCodeGU);
+        Map.Add(TEXT("GT"), CountryCodeGT);
+        Map.Add(TEXT("GG"), CountryCodeGG);
+        Map.Add(TEXT("GN"), CountryCodeGN);
+        Map.Add(TEXT("GW"), CountryCodeGW);
+        Map.Add(TEXT("GY"), CountryCodeGY);
+        Map.Add(TEXT("HT"), CountryCodeHT);
+        Map.Add(TEXT("HM"), CountryCodeHM);
+        Map.Add(TEXT("VA"), CountryCodeVA);
+        Map.Add(TEXT("HN"), CountryCodeHN);
+        Map.Add(TEXT("HK"), CountryCodeHK);
+        Map.Add(TEXT("HU"), CountryCodeHU);
+        Map.Add(TEXT("IS"), CountryCodeIS);
+        Map.Add(TEXT("IN"), CountryCodeIN);
+        Map.Add(TEXT("ID"), CountryCodeID);
+        Map.Add(TEXT("IR"), CountryCodeIR);
+        Map.Add(TEXT("IQ"), CountryCodeIQ);
+        Map.Add(TEXT("IE"), CountryCodeIE);
+        Map.Add(TEXT("IM"), CountryCodeIM);
+        Map.Add(TEXT("IL"), CountryCodeIL);
+        Map.Add(TEXT("IT"), CountryCodeIT);
+        Map.Add(TEXT("JM"), CountryCodeJM);
+        Map.Add(TEXT("JP"), CountryCodeJP);
+        Map.Add(TEXT("JE"), CountryCodeJE);
+        Map.Add(TEXT("JO"), CountryCodeJO);
+        Map.Add(TEXT("KZ"), CountryCodeKZ);
+        Map.Add(TEXT("KE"), CountryCodeKE);
+        Map.Add(TEXT("KI"), CountryCodeKI);
+        Map.Add(TEXT("KP"), CountryCodeKP);
+        Map.Add(TEXT("KR"), CountryCodeKR);
+        Map.Add(TEXT("KW"), CountryCodeKW);
+        Map.Add(TEXT("KG"), CountryCodeKG);
+        Map.Add(TEXT("LA"), CountryCodeLA);
+        Map.Add(TEXT("LV"), CountryCodeLV);
+        Map.Add(TEXT("LB"), CountryCodeLB);
+        Map.Add(TEXT("LS"), CountryCodeLS);
+        Map.Add(TEXT("LR"), CountryCodeLR);
+        Map.Add(TEXT("LY"), CountryCodeLY);
+        Map.Add(TEXT("LI"), CountryCodeLI);
+        Map.Add(TEXT("LT"), CountryCodeLT);
+        Map.Add(TEXT("LU"), CountryCodeLU);
+        Map.Add(TEXT("MO"), CountryCodeMO);
+        Map.Add(TEXT("MK"), CountryCodeMK);
+        Map.Add(TEXT("MG"), CountryCodeMG);
+        Map.Add(TEXT("MW"), CountryCodeMW);
+        Map.Add(TEXT("MY"), CountryCodeMY);
+        Map.Add(TEXT("MV"), CountryCodeMV);
+        Map.Add(TEXT("ML"), CountryCodeML);
+        Map.Add(TEXT("MT"), CountryCodeMT);
+        Map.Add(TEXT("MH"), CountryCodeMH);
+        Map.Add(TEXT("MQ"), CountryCodeMQ);
+        Map.Add(TEXT("MR"), CountryCodeMR);
+        Map.Add(TEXT("MU"), CountryCodeMU);
+        Map.Add(TEXT("YT"), CountryCodeYT);
+        Map.Add(TEXT("MX"), CountryCodeMX);
+        Map.Add(TEXT("FM"), CountryCodeFM);
+        Map.Add(TEXT("MD"), CountryCodeMD);
+        Map.Add(TEXT("MC"), CountryCodeMC);
+        Map.Add(TEXT("MN"), CountryCodeMN);
+        Map.Add(TEXT("ME"), CountryCodeME);
+        Map.Add(TEXT("MS"), CountryCodeMS);
+        Map.Add(TEXT("MA"), CountryCodeMA);
+        Map.Add(TEXT("MZ"), CountryCodeMZ);
+        Map.Add(TEXT("MM"), CountryCodeMM);
+        Map.Add(TEXT("NA"), CountryCodeNA);
+        Map.Add(TEXT("NR"), CountryCodeNR);
+        Map.Add(TEXT("NP"), CountryCodeNP);
+        Map.Add(TEXT("NL"), CountryCodeNL);
+        Map.Add(TEXT("NC"), CountryCodeNC);
+        Map.Add(TEXT("NZ"), CountryCodeNZ);
+        Map.Add(TEXT("NI"), CountryCodeNI);
+        Map.Add(TEXT("NE"), CountryCodeNE);
+        Map.Add(TEXT("NG"), CountryCodeNG);
+        Map.Add(TEXT("NU"), CountryCodeNU);
+        Map.Add(TEXT("NF"), CountryCodeNF);
+        Map.Add(TEXT("MP"), CountryCodeMP);
+        Map.Add(TEXT("NO"), CountryCodeNO);
+        Map.Add(TEXT("OM"), CountryCodeOM);
+        Map.Add(TEXT("PK"), CountryCodePK);
+        Map.Add(TEXT("PW"), CountryCodePW);
+        Map.Add(TEXT("PS"), CountryCodePS);
+        Map.Add(TEXT("PA"), CountryCodePA);
+        Map.Add(TEXT("PG"), CountryCodePG);
+        Map.Add(TEXT("PY"), CountryCodePY);
+        Map.Add(TEXT("PE"), CountryCodePE);
+        Map.Add(TEXT("PH"), CountryCodePH);
+        Map.Add(TEXT("PN"), CountryCodePN);
+        Map.Add(TEXT("PL"), CountryCodePL);
+        Map.Add(TEXT("PT"), CountryCodePT);
+        Map.Add(TEXT("PR"), CountryCodePR);
+        Map.Add(TEXT("QA"), CountryCodeQA);
+        Map.Add(TEXT("RE"), CountryCodeRE);
+        Map.Add(TEXT("RO"), CountryCodeRO);
+        Map.Add(TEXT("RU"), CountryCodeRU);
+        Map.Add(TEXT("RW"), CountryCodeRW);
+        Map.Add(TEXT("BL"), CountryCodeBL);
+        Map.Add(TEXT("SH"), CountryCodeSH);
+        Map.Add(TEXT("KN"), CountryCodeKN);
+        Map.Add(TEXT("LC"), CountryCodeLC);
+        Map.Add(TEXT("MF"), CountryCodeMF);
+        Map.Add(TEXT("PM"), CountryCodePM);
+        Map.Add(TEXT("VC"), CountryCodeVC);
+        Map.Add(TEXT("WS"), CountryCodeWS);
+        Map.Add(TEXT("SM"), CountryCodeSM);
+        Map.Add(TEXT("ST"), CountryCodeST);
+        Map.Add(TEXT("SA"), CountryCodeSA);
+        Map.Add(TEXT("SN"), CountryCodeSN);
+        Map.Add(TEXT("RS"), CountryCodeRS);
+        Map.Add(TEXT("SC"), CountryCodeSC);
+        Map.Add(TEXT("SL"), CountryCodeSL);
+        Map.Add(TEXT("SG"), CountryCodeSG);
+        Map.Add(TEXT("SX"), CountryCodeSX);
+        Map.Add(TEXT("SK"), CountryCodeSK);
+        Map.Add(TEXT("SI"), CountryCodeSI);
+        Map.Add(TEXT("SB"), CountryCodeSB);
+        Map.Add(TEXT("SO"), CountryCodeSO);
+        Map.Add(TEXT("ZA"), CountryCodeZA);
+        Map.Add(TEXT("GS"), CountryCodeGS);
+        Map.Add(TEXT("SS"), CountryCodeSS);
+        Map.Add(TEXT("ES"), CountryCodeES);
+        Map.Add(TEXT("LK"), CountryCodeLK);
+        Map.Add(TEXT("SD"), CountryCodeSD);
+        Map.Add(TEXT("SR"), CountryCodeSR);
+        Map.Add(TEXT("SJ"), CountryCodeSJ);
+        Map.Add(TEXT("SZ"), CountryCodeSZ);
+        Map.Add(TEXT("SE"), CountryCodeSE);
+        Map.Add(TEXT("CH"), CountryCodeCH);
+        Map.Add(TEXT("SY"), CountryCodeSY);
+        Map.Add(TEXT("TW"), CountryCodeTW);
+        Map.Add(TEXT("TJ"), CountryCodeTJ);
+        Map.Add(TEXT("TZ"), CountryCodeTZ);
+        Map.Add(TEXT("TH"), CountryCodeTH);
+        Map.Add(TEXT("TL"), CountryCodeTL);
+        Map.Add(TEXT("TG"), CountryCodeTG);
+        Map.Add(TEXT("TK"), CountryCodeTK);
+        Map.Add(TEXT("TO"), CountryCodeTO);
+        Map.Add(TEXT("TT"), CountryCodeTT);
+        Map.Add(TEXT("TN"), CountryCodeTN);
+        Map.Add(TEXT("TR"), CountryCodeTR);
+        Map.Add(TEXT("TM"), CountryCodeTM);
+        Map.Add(TEXT("TC"), CountryCodeTC);
+        Map.Add(TEXT("TV"), CountryCodeTV);
+        Map.Add(TEXT("UG"), CountryCodeUG);
+        Map.Add(TEXT("UA"), CountryCodeUA);
+        Map.Add(TEXT("AE"), CountryCodeAE);
+        Map.Add(TEXT("GB"), CountryCodeGB);
+        Map.Add(TEXT("US"), CountryCodeUS);
+        Map.Add(TEXT("UM"), CountryCodeUM);
+        Map.Add(TEXT("UY"), CountryCodeUY);
+        Map.Add(TEXT("UZ"), CountryCodeUZ);
+        Map.Add(TEXT("VU"), CountryCodeVU);
+        Map.Add(TEXT("VE"), CountryCodeVE);
+        Map.Add(TEXT("VN"), CountryCodeVN);
+        Map.Add(TEXT("VG"), CountryCodeVG);
+        Map.Add(TEXT("VI"), CountryCodeVI);
+        Map.Add(TEXT("WF"), CountryCodeWF);
+        Map.Add(TEXT("EH"), CountryCodeEH);
+        Map.Add(TEXT("YE"), CountryCodeYE);
+        Map.Add(TEXT("ZM"), CountryCodeZM);
+        Map.Add(TEXT("ZW"), CountryCodeZW);
+        Map.Add(TEXT("Unknown"), CountryCodeUnknown);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -4986,7 +4969,7 @@ void PlayFab::ServerModels::FDeleteCharacterFromUserRequest::writeJSON(JsonWrite
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -5007,7 +4990,7 @@ void PlayFab::ServerModels::FDeleteCharacterFromUserRequest::writeJSON(JsonWrite
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("SaveCharacterInventory"));
@@ -5030,6 +5013,7 @@ bool PlayFab::ServerModels::FDeleteCharacterFromUserRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5147,7 +5131,7 @@ void PlayFab::ServerModels::FDeletePlayerCustomPropertiesRequest::writeJSON(Json
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("PropertyNames"));
@@ -5166,6 +5150,7 @@ bool PlayFab::ServerModels::FDeletePlayerCustomPropertiesRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5212,7 +5197,7 @@ void PlayFab::ServerModels::FDeletePlayerCustomPropertiesResult::writeJSON(JsonW
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("PropertiesVersion"));
@@ -5226,11 +5211,7 @@ bool PlayFab::ServerModels::FDeletePlayerCustomPropertiesResult::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DeletedPropertiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("DeletedProperties"));
-    for (int32 Idx = 0; Idx < DeletedPropertiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DeletedPropertiesArray[Idx];
-        DeletedProperties.Add(FDeletedPropertyDetails(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DeletedPropertiesArray, DeletedProperties);
 
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -5266,7 +5247,7 @@ void PlayFab::ServerModels::FDeletePlayerRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -5808,11 +5789,7 @@ bool PlayFab::ServerModels::FExecuteCloudScriptResult::readFromValue(const TShar
     }
 
     const TArray<TSharedPtr<FJsonValue>>&LogsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Logs"));
-    for (int32 Idx = 0; Idx < LogsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LogsArray[Idx];
-        Logs.Add(FLogStatement(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LogsArray, Logs);
 
 
     const TSharedPtr<FJsonValue> LogsTooLargeValue = obj->TryGetField(TEXT("LogsTooLarge"));
@@ -5895,7 +5872,7 @@ void PlayFab::ServerModels::FExecuteCloudScriptServerRequest::writeJSON(JsonWrit
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (RevisionSelection.notNull())
@@ -5920,6 +5897,7 @@ bool PlayFab::ServerModels::FExecuteCloudScriptServerRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -5986,18 +5964,18 @@ ServerModels::ExternalFriendSources PlayFab::ServerModels::readExternalFriendSou
 
 ServerModels::ExternalFriendSources PlayFab::ServerModels::readExternalFriendSourcesFromValue(const FString& value)
 {
-    static TMap<FString, ExternalFriendSources> _ExternalFriendSourcesMap;
-    if (_ExternalFriendSourcesMap.Num() == 0)
+    static const TMap<FString, ExternalFriendSources> _ExternalFriendSourcesMap = []()
     {
-        // Auto-generate the map on the first use
-        _ExternalFriendSourcesMap.Add(TEXT("None"), ExternalFriendSourcesNone);
-        _ExternalFriendSourcesMap.Add(TEXT("Steam"), ExternalFriendSourcesSteam);
-        _ExternalFriendSourcesMap.Add(TEXT("Facebook"), ExternalFriendSourcesFacebook);
-        _ExternalFriendSourcesMap.Add(TEXT("Xbox"), ExternalFriendSourcesXbox);
-        _ExternalFriendSourcesMap.Add(TEXT("Psn"), ExternalFriendSourcesPsn);
-        _ExternalFriendSourcesMap.Add(TEXT("All"), ExternalFriendSourcesAll);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ExternalFriendSources> Map;
+        Map.Add(TEXT("None"), ExternalFriendSourcesNone);
+        Map.Add(TEXT("Steam"), ExternalFriendSourcesSteam);
+        Map.Add(TEXT("Facebook"), ExternalFriendSourcesFacebook);
+        Map.Add(TEXT("Xbox"), ExternalFriendSourcesXbox);
+        Map.Add(TEXT("Psn"), ExternalFriendSourcesPsn);
+        Map.Add(TEXT("All"), ExternalFriendSourcesAll);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6027,7 +6005,7 @@ void PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonWr
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -6072,7 +6050,7 @@ void PlayFab::ServerModels::FFacebookPlayFabIdPair::writeJSON(JsonWriter& writer
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -6138,36 +6116,36 @@ ServerModels::LoginIdentityProvider PlayFab::ServerModels::readLoginIdentityProv
 
 ServerModels::LoginIdentityProvider PlayFab::ServerModels::readLoginIdentityProviderFromValue(const FString& value)
 {
-    static TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap;
-    if (_LoginIdentityProviderMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _LoginIdentityProviderMap.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
-        _LoginIdentityProviderMap.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
-        _LoginIdentityProviderMap.Add(TEXT("Custom"), LoginIdentityProviderCustom);
-        _LoginIdentityProviderMap.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
-        _LoginIdentityProviderMap.Add(TEXT("Steam"), LoginIdentityProviderSteam);
-        _LoginIdentityProviderMap.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
-        _LoginIdentityProviderMap.Add(TEXT("PSN"), LoginIdentityProviderPSN);
-        _LoginIdentityProviderMap.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
-        _LoginIdentityProviderMap.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
-        _LoginIdentityProviderMap.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
-        _LoginIdentityProviderMap.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
-        _LoginIdentityProviderMap.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
-        _LoginIdentityProviderMap.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
-        _LoginIdentityProviderMap.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
-        _LoginIdentityProviderMap.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
-        _LoginIdentityProviderMap.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
-        _LoginIdentityProviderMap.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
-        _LoginIdentityProviderMap.Add(TEXT("Apple"), LoginIdentityProviderApple);
-        _LoginIdentityProviderMap.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
-        _LoginIdentityProviderMap.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
-        _LoginIdentityProviderMap.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
-        _LoginIdentityProviderMap.Add(TEXT("King"), LoginIdentityProviderKing);
-
-    }
+    static const TMap<FString, LoginIdentityProvider> _LoginIdentityProviderMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, LoginIdentityProvider> Map;
+        Map.Add(TEXT("Unknown"), LoginIdentityProviderUnknown);
+        Map.Add(TEXT("PlayFab"), LoginIdentityProviderPlayFab);
+        Map.Add(TEXT("Custom"), LoginIdentityProviderCustom);
+        Map.Add(TEXT("GameCenter"), LoginIdentityProviderGameCenter);
+        Map.Add(TEXT("GooglePlay"), LoginIdentityProviderGooglePlay);
+        Map.Add(TEXT("Steam"), LoginIdentityProviderSteam);
+        Map.Add(TEXT("XBoxLive"), LoginIdentityProviderXBoxLive);
+        Map.Add(TEXT("PSN"), LoginIdentityProviderPSN);
+        Map.Add(TEXT("Kongregate"), LoginIdentityProviderKongregate);
+        Map.Add(TEXT("Facebook"), LoginIdentityProviderFacebook);
+        Map.Add(TEXT("IOSDevice"), LoginIdentityProviderIOSDevice);
+        Map.Add(TEXT("AndroidDevice"), LoginIdentityProviderAndroidDevice);
+        Map.Add(TEXT("Twitch"), LoginIdentityProviderTwitch);
+        Map.Add(TEXT("WindowsHello"), LoginIdentityProviderWindowsHello);
+        Map.Add(TEXT("GameServer"), LoginIdentityProviderGameServer);
+        Map.Add(TEXT("CustomServer"), LoginIdentityProviderCustomServer);
+        Map.Add(TEXT("NintendoSwitch"), LoginIdentityProviderNintendoSwitch);
+        Map.Add(TEXT("FacebookInstantGames"), LoginIdentityProviderFacebookInstantGames);
+        Map.Add(TEXT("OpenIdConnect"), LoginIdentityProviderOpenIdConnect);
+        Map.Add(TEXT("Apple"), LoginIdentityProviderApple);
+        Map.Add(TEXT("NintendoSwitchAccount"), LoginIdentityProviderNintendoSwitchAccount);
+        Map.Add(TEXT("GooglePlayGames"), LoginIdentityProviderGooglePlayGames);
+        Map.Add(TEXT("XboxMobileStore"), LoginIdentityProviderXboxMobileStore);
+        Map.Add(TEXT("King"), LoginIdentityProviderKing);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6342,20 +6320,20 @@ ServerModels::SubscriptionProviderStatus PlayFab::ServerModels::readSubscription
 
 ServerModels::SubscriptionProviderStatus PlayFab::ServerModels::readSubscriptionProviderStatusFromValue(const FString& value)
 {
-    static TMap<FString, SubscriptionProviderStatus> _SubscriptionProviderStatusMap;
-    if (_SubscriptionProviderStatusMap.Num() == 0)
-    {
-        // Auto-generate the map on the first use
-        _SubscriptionProviderStatusMap.Add(TEXT("NoError"), SubscriptionProviderStatusNoError);
-        _SubscriptionProviderStatusMap.Add(TEXT("Cancelled"), SubscriptionProviderStatusCancelled);
-        _SubscriptionProviderStatusMap.Add(TEXT("UnknownError"), SubscriptionProviderStatusUnknownError);
-        _SubscriptionProviderStatusMap.Add(TEXT("BillingError"), SubscriptionProviderStatusBillingError);
-        _SubscriptionProviderStatusMap.Add(TEXT("ProductUnavailable"), SubscriptionProviderStatusProductUnavailable);
-        _SubscriptionProviderStatusMap.Add(TEXT("CustomerDidNotAcceptPriceChange"), SubscriptionProviderStatusCustomerDidNotAcceptPriceChange);
-        _SubscriptionProviderStatusMap.Add(TEXT("FreeTrial"), SubscriptionProviderStatusFreeTrial);
-        _SubscriptionProviderStatusMap.Add(TEXT("PaymentPending"), SubscriptionProviderStatusPaymentPending);
-
-    }
+    static const TMap<FString, SubscriptionProviderStatus> _SubscriptionProviderStatusMap = []()
+    {
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SubscriptionProviderStatus> Map;
+        Map.Add(TEXT("NoError"), SubscriptionProviderStatusNoError);
+        Map.Add(TEXT("Cancelled"), SubscriptionProviderStatusCancelled);
+        Map.Add(TEXT("UnknownError"), SubscriptionProviderStatusUnknownError);
+        Map.Add(TEXT("BillingError"), SubscriptionProviderStatusBillingError);
+        Map.Add(TEXT("ProductUnavailable"), SubscriptionProviderStatusProductUnavailable);
+        Map.Add(TEXT("CustomerDidNotAcceptPriceChange"), SubscriptionProviderStatusCustomerDidNotAcceptPriceChange);
+        Map.Add(TEXT("FreeTrial"), SubscriptionProviderStatusFreeTrial);
+        Map.Add(TEXT("PaymentPending"), SubscriptionProviderStatusPaymentPending);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -6540,11 +6518,7 @@ bool PlayFab::ServerModels::FMembershipModel::readFromValue(const TSharedPtr<FJs
     }
 
     const TArray<TSharedPtr<FJsonValue>>&SubscriptionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Subscriptions"));
-    for (int32 Idx = 0; Idx < SubscriptionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SubscriptionsArray[Idx];
-        Subscriptions.Add(FSubscriptionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SubscriptionsArray, Subscriptions);
 
 
     return HasSucceeded;
@@ -6896,11 +6870,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AdCampaignAttributionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AdCampaignAttributions"));
-    for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttributionModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AdCampaignAttributionsArray, AdCampaignAttributions);
 
 
     const TSharedPtr<FJsonValue> AvatarUrlValue = obj->TryGetField(TEXT("AvatarUrl"));
@@ -6916,11 +6886,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
 
 
     const TArray<TSharedPtr<FJsonValue>>&ContactEmailAddressesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ContactEmailAddresses"));
-    for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfoModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContactEmailAddressesArray, ContactEmailAddresses);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -6943,27 +6909,15 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
 
 
     const TArray<TSharedPtr<FJsonValue>>&LinkedAccountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("LinkedAccounts"));
-    for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FLinkedPlatformAccountModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LinkedAccountsArray, LinkedAccounts);
 
 
     const TArray<TSharedPtr<FJsonValue>>&LocationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Locations"));
-    for (int32 Idx = 0; Idx < LocationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LocationsArray[Idx];
-        Locations.Add(FLocationModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LocationsArray, Locations);
 
 
     const TArray<TSharedPtr<FJsonValue>>&MembershipsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Memberships"));
-    for (int32 Idx = 0; Idx < MembershipsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = MembershipsArray[Idx];
-        Memberships.Add(FMembershipModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(MembershipsArray, Memberships);
 
 
     Origination = readLoginIdentityProviderFromValue(obj->TryGetField(TEXT("Origination")));
@@ -6983,27 +6937,15 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PushNotificationRegistrationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PushNotificationRegistrations"));
-    for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistrationModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PushNotificationRegistrationsArray, PushNotificationRegistrations);
 
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     const TArray<TSharedPtr<FJsonValue>>&TagsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Tags"));
-    for (int32 Idx = 0; Idx < TagsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = TagsArray[Idx];
-        Tags.Add(FTagModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(TagsArray, Tags);
 
 
     const TSharedPtr<FJsonValue> TitleIdValue = obj->TryGetField(TEXT("TitleId"));
@@ -7021,11 +6963,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ValuesToDateArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ValuesToDate"));
-    for (int32 Idx = 0; Idx < ValuesToDateArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ValuesToDateArray[Idx];
-        ValuesToDate.Add(FValueToDateModel(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ValuesToDateArray, ValuesToDate);
 
 
     return HasSucceeded;
@@ -7055,7 +6993,7 @@ void PlayFab::ServerModels::FFriendInfo::writeJSON(JsonWriter& writer) const
     if (FriendPlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("FriendPlayFabId"));
-        writer->WriteValue(FriendPlayFabId);
+        writer->WriteValue(FriendPlayFabId.ToString());
     }
 
     if (GameCenterInfo.IsValid())
@@ -7197,7 +7135,7 @@ void PlayFab::ServerModels::FGenericPlayFabIdPair::writeJSON(JsonWriter& writer)
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -7330,11 +7268,7 @@ bool PlayFab::ServerModels::FGetAllSegmentsResult::readFromValue(const TSharedPt
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&SegmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Segments"));
-    for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SegmentsArray, Segments);
 
 
     return HasSucceeded;
@@ -7398,11 +7332,7 @@ bool PlayFab::ServerModels::FGetCatalogItemsResult::readFromValue(const TSharedP
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&CatalogArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Catalog"));
-    for (int32 Idx = 0; Idx < CatalogArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CatalogArray[Idx];
-        Catalog.Add(FCatalogItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CatalogArray, Catalog);
 
 
     return HasSucceeded;
@@ -7424,7 +7354,7 @@ void PlayFab::ServerModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writ
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (IfChangedFromDataVersion.notNull())
@@ -7449,7 +7379,7 @@ void PlayFab::ServerModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writ
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -7502,14 +7432,14 @@ ServerModels::UserDataPermission PlayFab::ServerModels::readUserDataPermissionFr
 
 ServerModels::UserDataPermission PlayFab::ServerModels::readUserDataPermissionFromValue(const FString& value)
 {
-    static TMap<FString, UserDataPermission> _UserDataPermissionMap;
-    if (_UserDataPermissionMap.Num() == 0)
+    static const TMap<FString, UserDataPermission> _UserDataPermissionMap = []()
     {
-        // Auto-generate the map on the first use
-        _UserDataPermissionMap.Add(TEXT("Private"), UserDataPermissionPrivate);
-        _UserDataPermissionMap.Add(TEXT("Public"), UserDataPermissionPublic);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, UserDataPermission> Map;
+        Map.Add(TEXT("Private"), UserDataPermissionPrivate);
+        Map.Add(TEXT("Public"), UserDataPermissionPublic);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -7581,7 +7511,7 @@ void PlayFab::ServerModels::FGetCharacterDataResult::writeJSON(JsonWriter& write
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (Data.Num() != 0)
@@ -7601,7 +7531,7 @@ void PlayFab::ServerModels::FGetCharacterDataResult::writeJSON(JsonWriter& write
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -7621,6 +7551,7 @@ bool PlayFab::ServerModels::FGetCharacterDataResult::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
@@ -7666,7 +7597,7 @@ void PlayFab::ServerModels::FGetCharacterInventoryRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -7687,7 +7618,7 @@ void PlayFab::ServerModels::FGetCharacterInventoryRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -7714,6 +7645,7 @@ bool PlayFab::ServerModels::FGetCharacterInventoryRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -7789,7 +7721,7 @@ void PlayFab::ServerModels::FGetCharacterInventoryResult::writeJSON(JsonWriter&
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (Inventory.Num() != 0)
@@ -7804,7 +7736,7 @@ void PlayFab::ServerModels::FGetCharacterInventoryResult::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (VirtualCurrency.Num() != 0)
@@ -7844,11 +7776,7 @@ bool PlayFab::ServerModels::FGetCharacterInventoryResult::readFromValue(const TS
     }
 
     const TArray<TSharedPtr<FJsonValue>>&InventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Inventory"));
-    for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(InventoryArray, Inventory);
 
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -7871,6 +7799,7 @@ bool PlayFab::ServerModels::FGetCharacterInventoryResult::readFromValue(const TS
     const TSharedPtr<FJsonObject>* VirtualCurrencyRechargeTimesObject;
     if (obj->TryGetObjectField(TEXT("VirtualCurrencyRechargeTimes"), VirtualCurrencyRechargeTimesObject))
     {
+        VirtualCurrencyRechargeTimes.Reserve((*VirtualCurrencyRechargeTimesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
             VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
@@ -7962,11 +7891,7 @@ bool PlayFab::ServerModels::FGetCharacterLeaderboardResult::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     return HasSucceeded;
@@ -7988,7 +7913,7 @@ void PlayFab::ServerModels::FGetCharacterStatisticsRequest::writeJSON(JsonWriter
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -7998,7 +7923,7 @@ void PlayFab::ServerModels::FGetCharacterStatisticsRequest::writeJSON(JsonWriter
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -8037,7 +7962,7 @@ void PlayFab::ServerModels::FGetCharacterStatisticsResult::writeJSON(JsonWriter&
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CharacterStatistics.Num() != 0)
@@ -8054,7 +7979,7 @@ void PlayFab::ServerModels::FGetCharacterStatisticsResult::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -8411,7 +8336,7 @@ void PlayFab::ServerModels::FGetFriendLeaderboardRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (ProfileConstraints.IsValid())
@@ -8461,6 +8386,7 @@ bool PlayFab::ServerModels::FGetFriendLeaderboardRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8561,7 +8487,7 @@ void PlayFab::ServerModels::FGetFriendsListRequest::writeJSON(JsonWriter& writer
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (ProfileConstraints.IsValid())
@@ -8586,6 +8512,7 @@ bool PlayFab::ServerModels::FGetFriendsListRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8643,11 +8570,7 @@ bool PlayFab::ServerModels::FGetFriendsListResult::readFromValue(const TSharedPt
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&FriendsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Friends"));
-    for (int32 Idx = 0; Idx < FriendsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = FriendsArray[Idx];
-        Friends.Add(FFriendInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(FriendsArray, Friends);
 
 
     return HasSucceeded;
@@ -8669,7 +8592,7 @@ void PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::writeJSON(Jso
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("MaxResultsCount"));
@@ -8682,7 +8605,7 @@ void PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::writeJSON(Jso
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!StatisticName.IsEmpty() == false)
@@ -8759,11 +8682,7 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::readFromValue(
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     return HasSucceeded;
@@ -8800,7 +8719,7 @@ void PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::writeJSON(JsonWrit
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (ProfileConstraints.IsValid())
@@ -8841,6 +8760,7 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::readFromValue(cons
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -8910,7 +8830,7 @@ void PlayFab::ServerModels::FPlayerLeaderboardEntry::writeJSON(JsonWriter& write
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("Position"));
@@ -9004,11 +8924,7 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundUserResult::readFromValue(const
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     const TSharedPtr<FJsonValue> NextResetValue = obj->TryGetField(TEXT("NextReset"));
@@ -9042,7 +8958,7 @@ void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::writeJSON(
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!StatisticName.IsEmpty() == false)
@@ -9105,11 +9021,7 @@ bool PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::readFromVal
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     return HasSucceeded;
@@ -9180,6 +9092,7 @@ bool PlayFab::ServerModels::FGetLeaderboardRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9265,11 +9178,7 @@ bool PlayFab::ServerModels::FGetLeaderboardResult::readFromValue(const TSharedPt
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&LeaderboardArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Leaderboard"));
-    for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LeaderboardArray, Leaderboard);
 
 
     const TSharedPtr<FJsonValue> NextResetValue = obj->TryGetField(TEXT("NextReset"));
@@ -9493,7 +9402,7 @@ void PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -9506,6 +9415,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -9714,19 +9624,11 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     }
 
     const TArray<TSharedPtr<FJsonValue>>&CharacterInventoriesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("CharacterInventories"));
-    for (int32 Idx = 0; Idx < CharacterInventoriesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CharacterInventoriesArray[Idx];
-        CharacterInventories.Add(FCharacterInventory(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CharacterInventoriesArray, CharacterInventories);
 
 
     const TArray<TSharedPtr<FJsonValue>>&CharacterListArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("CharacterList"));
-    for (int32 Idx = 0; Idx < CharacterListArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CharacterListArray[Idx];
-        CharacterList.Add(FCharacterResult(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CharacterListArray, CharacterList);
 
 
     const TSharedPtr<FJsonValue> PlayerProfileValue = obj->TryGetField(TEXT("PlayerProfile"));
@@ -9736,16 +9638,13 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PlayerStatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PlayerStatistics"));
-    for (int32 Idx = 0; Idx < PlayerStatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PlayerStatisticsArray[Idx];
-        PlayerStatistics.Add(FStatisticValue(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PlayerStatisticsArray, PlayerStatistics);
 
 
     const TSharedPtr<FJsonObject>* TitleDataObject;
     if (obj->TryGetObjectField(TEXT("TitleData"), TitleDataObject))
     {
+        TitleData.Reserve((*TitleDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TitleDataObject)->Values); It; ++It)
         {
             TitleData.Add(It.Key(), It.Value()->AsString());
@@ -9755,6 +9654,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     const TSharedPtr<FJsonObject>* UserDataObject;
     if (obj->TryGetObjectField(TEXT("UserData"), UserDataObject))
     {
+        UserData.Reserve((*UserDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserDataObject)->Values); It; ++It)
         {
             UserData.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
@@ -9769,16 +9669,13 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     }
 
     const TArray<TSharedPtr<FJsonValue>>&UserInventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("UserInventory"));
-    for (int32 Idx = 0; Idx < UserInventoryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = UserInventoryArray[Idx];
-        UserInventory.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(UserInventoryArray, UserInventory);
 
 
     const TSharedPtr<FJsonObject>* UserReadOnlyDataObject;
     if (obj->TryGetObjectField(TEXT("UserReadOnlyData"), UserReadOnlyDataObject))
     {
+        UserReadOnlyData.Reserve((*UserReadOnlyDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserReadOnlyDataObject)->Values); It; ++It)
         {
             UserReadOnlyData.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
@@ -9805,6 +9702,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     const TSharedPtr<FJsonObject>* UserVirtualCurrencyRechargeTimesObject;
     if (obj->TryGetObjectField(TEXT("UserVirtualCurrencyRechargeTimes"), UserVirtualCurrencyRechargeTimesObject))
     {
+        UserVirtualCurrencyRechargeTimes.Reserve((*UserVirtualCurrencyRechargeTimesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserVirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
             UserVirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
@@ -9833,7 +9731,7 @@ void PlayFab::ServerModels::FGetPlayerCombinedInfoResult::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -9875,7 +9773,7 @@ void PlayFab::ServerModels::FGetPlayerCustomPropertyRequest::writeJSON(JsonWrite
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!PropertyName.IsEmpty() == false)
@@ -9925,7 +9823,7 @@ void PlayFab::ServerModels::FGetPlayerCustomPropertyResult::writeJSON(JsonWriter
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("PropertiesVersion"));
@@ -9995,7 +9893,7 @@ void PlayFab::ServerModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writ
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (ProfileConstraints.IsValid())
@@ -10014,6 +9912,7 @@ bool PlayFab::ServerModels::FGetPlayerProfileRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10094,11 +9993,7 @@ bool PlayFab::ServerModels::FGetPlayerSegmentsResult::readFromValue(const TShare
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&SegmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Segments"));
-    for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(SegmentsArray, Segments);
 
 
     return HasSucceeded;
@@ -10175,6 +10070,7 @@ bool PlayFab::ServerModels::FGetPlayersInSegmentRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10652,11 +10548,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AdCampaignAttributionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AdCampaignAttributions"));
-    for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttribution(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AdCampaignAttributionsArray, AdCampaignAttributions);
 
 
     const TSharedPtr<FJsonValue> AvatarUrlValue = obj->TryGetField(TEXT("AvatarUrl"));
@@ -10674,11 +10566,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     ChurnPrediction = readChurnRiskLevelFromValue(obj->TryGetField(TEXT("ChurnPrediction")));
 
     const TArray<TSharedPtr<FJsonValue>>&ContactEmailAddressesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ContactEmailAddresses"));
-    for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ContactEmailAddressesArray, ContactEmailAddresses);
 
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -10689,6 +10577,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     const TSharedPtr<FJsonObject>* CustomPropertiesObject;
     if (obj->TryGetObjectField(TEXT("CustomProperties"), CustomPropertiesObject))
     {
+        CustomProperties.Reserve((*CustomPropertiesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomPropertiesObject)->Values); It; ++It)
         {
             CustomProperties.Add(It.Key(), FJsonKeeper(It.Value()));
@@ -10708,16 +10597,13 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
 
 
     const TArray<TSharedPtr<FJsonValue>>&LinkedAccountsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("LinkedAccounts"));
-    for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FPlayerLinkedAccount(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(LinkedAccountsArray, LinkedAccounts);
 
 
     const TSharedPtr<FJsonObject>* LocationsObject;
     if (obj->TryGetObjectField(TEXT("Locations"), LocationsObject))
     {
+        Locations.Reserve((*LocationsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LocationsObject)->Values); It; ++It)
         {
             Locations.Add(It.Key(), FPlayerLocation(It.Value()->AsObject()));
@@ -10736,11 +10622,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PlayerStatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PlayerStatistics"));
-    for (int32 Idx = 0; Idx < PlayerStatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PlayerStatisticsArray[Idx];
-        PlayerStatistics.Add(FPlayerStatistic(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PlayerStatisticsArray, PlayerStatistics);
 
 
     const TSharedPtr<FJsonValue> PublisherIdValue = obj->TryGetField(TEXT("PublisherId"));
@@ -10751,11 +10633,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PushNotificationRegistrationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PushNotificationRegistrations"));
-    for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistration(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PushNotificationRegistrationsArray, PushNotificationRegistrations);
 
 
     const TSharedPtr<FJsonObject>* StatisticsObject;
@@ -10849,11 +10727,7 @@ bool PlayFab::ServerModels::FGetPlayersInSegmentResult::readFromValue(const TSha
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PlayerProfilesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PlayerProfiles"));
-    for (int32 Idx = 0; Idx < PlayerProfilesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PlayerProfilesArray[Idx];
-        PlayerProfiles.Add(FPlayerProfile(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PlayerProfilesArray, PlayerProfiles);
 
 
     const TSharedPtr<FJsonValue> ProfilesInSegmentValue = obj->TryGetField(TEXT("ProfilesInSegment"));
@@ -10893,7 +10767,7 @@ void PlayFab::ServerModels::FGetPlayersSegmentsRequest::writeJSON(JsonWriter& wr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -10906,6 +10780,7 @@ bool PlayFab::ServerModels::FGetPlayersSegmentsRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -10995,7 +10870,7 @@ void PlayFab::ServerModels::FGetPlayerStatisticsRequest::writeJSON(JsonWriter& w
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (StatisticNames.Num() != 0)
@@ -11026,6 +10901,7 @@ bool PlayFab::ServerModels::FGetPlayerStatisticsRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11042,11 +10918,7 @@ bool PlayFab::ServerModels::FGetPlayerStatisticsRequest::readFromValue(const TSh
     obj->TryGetStringArrayField(TEXT("StatisticNames"), StatisticNames);
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticNameVersionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("StatisticNameVersions"));
-    for (int32 Idx = 0; Idx < StatisticNameVersionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticNameVersionsArray[Idx];
-        StatisticNameVersions.Add(FStatisticNameVersion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticNameVersionsArray, StatisticNameVersions);
 
 
     return HasSucceeded;
@@ -11064,7 +10936,7 @@ void PlayFab::ServerModels::FGetPlayerStatisticsResult::writeJSON(JsonWriter& wr
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Statistics.Num() != 0)
@@ -11091,11 +10963,7 @@ bool PlayFab::ServerModels::FGetPlayerStatisticsResult::readFromValue(const TSha
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticValue(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     return HasSucceeded;
@@ -11137,6 +11005,7 @@ bool PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11262,11 +11131,7 @@ bool PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticVersionsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("StatisticVersions"));
-    for (int32 Idx = 0; Idx < StatisticVersionsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticVersionsArray[Idx];
-        StatisticVersions.Add(FPlayerStatisticVersion(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticVersionsArray, StatisticVersions);
 
 
     return HasSucceeded;
@@ -11305,7 +11170,7 @@ void PlayFab::ServerModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -11318,6 +11183,7 @@ bool PlayFab::ServerModels::FGetPlayerTagsRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -11357,7 +11223,7 @@ void PlayFab::ServerModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("Tags"));
@@ -11438,11 +11304,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FFacebookPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11501,11 +11363,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::rea
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FFacebookInstantGamesPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11534,11 +11392,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&GenericIDsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GenericIDs"));
-    for (int32 Idx = 0; Idx < GenericIDsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GenericIDsArray[Idx];
-        GenericIDs.Add(FGenericServiceId(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GenericIDsArray, GenericIDs);
 
 
     return HasSucceeded;
@@ -11570,11 +11424,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::readFromValue(co
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FGenericPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11625,7 +11475,7 @@ void PlayFab::ServerModels::FNintendoServiceAccountPlayFabIdPair::writeJSON(Json
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -11678,11 +11528,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromNintendoServiceAccountIdsResult::r
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FNintendoServiceAccountPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11733,7 +11579,7 @@ void PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -11786,11 +11632,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::rea
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FNintendoSwitchPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11848,7 +11690,7 @@ void PlayFab::ServerModels::FPSNAccountPlayFabIdPair::writeJSON(JsonWriter& writ
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (PSNAccountId.IsEmpty() == false)
@@ -11907,11 +11749,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::readFromValue
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FPSNAccountPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -11969,7 +11807,7 @@ void PlayFab::ServerModels::FPSNOnlinePlayFabIdPair::writeJSON(JsonWriter& write
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (PSNOnlineId.IsEmpty() == false)
@@ -12028,11 +11866,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromPSNOnlineIDsResult::readFromValue(
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FPSNOnlinePlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12080,7 +11914,7 @@ void PlayFab::ServerModels::FSteamPlayFabIdPair::writeJSON(JsonWriter& writer) c
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (SteamStringId.IsEmpty() == false)
@@ -12139,11 +11973,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::readFromValue(cons
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FSteamPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12188,7 +12018,7 @@ void PlayFab::ServerModels::FSteamNamePlayFabIdPair::writeJSON(JsonWriter& write
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (SteamName.IsEmpty() == false)
@@ -12247,11 +12077,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromSteamNamesResult::readFromValue(co
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FSteamNamePlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12296,7 +12122,7 @@ void PlayFab::ServerModels::FTwitchPlayFabIdPair::writeJSON(JsonWriter& writer)
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (TwitchId.IsEmpty() == false)
@@ -12355,11 +12181,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromTwitchIDsResult::readFromValue(con
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FTwitchPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12417,7 +12239,7 @@ void PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (XboxLiveAccountId.IsEmpty() == false)
@@ -12476,11 +12298,7 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::readFromValue(c
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FXboxLiveAccountPlayFabIdPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -12543,6 +12361,7 @@ bool PlayFab::ServerModels::FGetPublisherDataResult::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -12609,14 +12428,14 @@ ServerModels::ResultTableNodeType PlayFab::ServerModels::readResultTableNodeType
 
 ServerModels::ResultTableNodeType PlayFab::ServerModels::readResultTableNodeTypeFromValue(const FString& value)
 {
-    static TMap<FString, ResultTableNodeType> _ResultTableNodeTypeMap;
-    if (_ResultTableNodeTypeMap.Num() == 0)
+    static const TMap<FString, ResultTableNodeType> _ResultTableNodeTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _ResultTableNodeTypeMap.Add(TEXT("ItemId"), ResultTableNodeTypeItemId);
-        _ResultTableNodeTypeMap.Add(TEXT("TableId"), ResultTableNodeTypeTableId);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, ResultTableNodeType> Map;
+        Map.Add(TEXT("ItemId"), ResultTableNodeTypeItemId);
+        Map.Add(TEXT("TableId"), ResultTableNodeTypeTableId);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -12725,11 +12544,7 @@ bool PlayFab::ServerModels::FRandomResultTableListing::readFromValue(const TShar
     }
 
     const TArray<TSharedPtr<FJsonValue>>&NodesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Nodes"));
-    for (int32 Idx = 0; Idx < NodesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = NodesArray[Idx];
-        Nodes.Add(FResultTableNode(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(NodesArray, Nodes);
 
 
     const TSharedPtr<FJsonValue> TableIdValue = obj->TryGetField(TEXT("TableId"));
@@ -12772,6 +12587,7 @@ bool PlayFab::ServerModels::FGetRandomResultTablesResult::readFromValue(const TS
     const TSharedPtr<FJsonObject>* TablesObject;
     if (obj->TryGetObjectField(TEXT("Tables"), TablesObject))
     {
+        Tables.Reserve((*TablesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TablesObject)->Values); It; ++It)
         {
             Tables.Add(It.Key(), FRandomResultTableListing(It.Value()->AsObject()));
@@ -12820,7 +12636,7 @@ void PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::writeJSON(JsonWriter&
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (ServerCustomId.IsEmpty() == false)
@@ -12879,11 +12695,7 @@ bool PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::readFromVal
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&DataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Data"));
-    for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FServerCustomIDPlayFabIDPair(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(DataArray, Data);
 
 
     return HasSucceeded;
@@ -13049,6 +12861,7 @@ bool PlayFab::ServerModels::FGetSharedGroupDataResult::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), FSharedGroupDataRecord(It.Value()->AsObject()));
@@ -13139,19 +12952,19 @@ ServerModels::SourceType PlayFab::ServerModels::readSourceTypeFromValue(const TS
 
 ServerModels::SourceType PlayFab::ServerModels::readSourceTypeFromValue(const FString& value)
 {
-    static TMap<FString, SourceType> _SourceTypeMap;
-    if (_SourceTypeMap.Num() == 0)
+    static const TMap<FString, SourceType> _SourceTypeMap = []()
     {
-        // Auto-generate the map on the first use
-        _SourceTypeMap.Add(TEXT("Admin"), SourceTypeAdmin);
-        _SourceTypeMap.Add(TEXT("BackEnd"), SourceTypeBackEnd);
-        _SourceTypeMap.Add(TEXT("GameClient"), SourceTypeGameClient);
-        _SourceTypeMap.Add(TEXT("GameServer"), SourceTypeGameServer);
-        _SourceTypeMap.Add(TEXT("Partner"), SourceTypePartner);
-        _SourceTypeMap.Add(TEXT("Custom"), SourceTypeCustom);
-        _SourceTypeMap.Add(TEXT("API"), SourceTypeAPI);
-
-    }
+        // Auto-generate the map on the first use; static initialization is thread-safe, models may be decoded on worker threads
+        TMap<FString, SourceType> Map;
+        Map.Add(TEXT("Admin"), SourceTypeAdmin);
+        Map.Add(TEXT("BackEnd"), SourceTypeBackEnd);
+        Map.Add(TEXT("GameClient"), SourceTypeGameClient);
+        Map.Add(TEXT("GameServer"), SourceTypeGameServer);
+        Map.Add(TEXT("Partner"), SourceTypePartner);
+        Map.Add(TEXT("Custom"), SourceTypeCustom);
+        Map.Add(TEXT("API"), SourceTypeAPI);
+        return Map;
+    }();
 
     if (!value.IsEmpty())
     {
@@ -13332,11 +13145,7 @@ bool PlayFab::ServerModels::FGetStoreItemsResult::readFromValue(const TSharedPtr
     Source = readSourceTypeFromValue(obj->TryGetField(TEXT("Source")));
 
     const TArray<TSharedPtr<FJsonValue>>&StoreArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Store"));
-    for (int32 Idx = 0; Idx < StoreArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StoreArray[Idx];
-        Store.Add(FStoreItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StoreArray, Store);
 
 
     const TSharedPtr<FJsonValue> StoreIdValue = obj->TryGetField(TEXT("StoreId"));
@@ -13378,7 +13187,7 @@ void PlayFab::ServerModels::FGetStoreItemsServerRequest::writeJSON(JsonWriter& w
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!StoreId.IsEmpty() == false)
@@ -13408,6 +13217,7 @@ bool PlayFab::ServerModels::FGetStoreItemsServerRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -13550,6 +13360,7 @@ bool PlayFab::ServerModels::FGetTitleDataResult::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -13683,11 +13494,7 @@ bool PlayFab::ServerModels::FGetTitleNewsResult::readFromValue(const TSharedPtr<
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&NewsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("News"));
-    for (int32 Idx = 0; Idx < NewsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = NewsArray[Idx];
-        News.Add(FTitleNewsItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(NewsArray, News);
 
 
     return HasSucceeded;
@@ -13709,7 +13516,7 @@ void PlayFab::ServerModels::FGetUserAccountInfoRequest::writeJSON(JsonWriter& wr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -13777,7 +13584,7 @@ void PlayFab::ServerModels::FGetUserBansRequest::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -13823,11 +13630,7 @@ bool PlayFab::ServerModels::FGetUserBansResult::readFromValue(const TSharedPtr<F
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -13864,7 +13667,7 @@ void PlayFab::ServerModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -13919,7 +13722,7 @@ void PlayFab::ServerModels::FGetUserDataResult::writeJSON(JsonWriter& writer) co
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -13932,6 +13735,7 @@ bool PlayFab::ServerModels::FGetUserDataResult::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
@@ -13982,7 +13786,7 @@ void PlayFab::ServerModels::FGetUserInventoryRequest::writeJSON(JsonWriter& writ
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -13995,6 +13799,7 @@ bool PlayFab::ServerModels::FGetUserInventoryRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14032,7 +13837,7 @@ void PlayFab::ServerModels::FGetUserInventoryResult::writeJSON(JsonWriter& write
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (VirtualCurrency.Num() != 0)
@@ -14065,11 +13870,7 @@ bool PlayFab::ServerModels::FGetUserInventoryResult::readFromValue(const TShared
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&InventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Inventory"));
-    for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(InventoryArray, Inventory);
 
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -14092,6 +13893,7 @@ bool PlayFab::ServerModels::FGetUserInventoryResult::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* VirtualCurrencyRechargeTimesObject;
     if (obj->TryGetObjectField(TEXT("VirtualCurrencyRechargeTimes"), VirtualCurrencyRechargeTimesObject))
     {
+        VirtualCurrencyRechargeTimes.Reserve((*VirtualCurrencyRechargeTimesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
             VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
@@ -14148,7 +13950,7 @@ void PlayFab::ServerModels::FGrantCharacterToUserRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -14175,6 +13977,7 @@ bool PlayFab::ServerModels::FGrantCharacterToUserRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14203,7 +14006,7 @@ void PlayFab::ServerModels::FGrantCharacterToUserResult::writeJSON(JsonWriter& w
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -14262,7 +14065,7 @@ void PlayFab::ServerModels::FGrantedItemInstance::writeJSON(JsonWriter& writer)
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomData.Num() != 0)
@@ -14303,13 +14106,13 @@ void PlayFab::ServerModels::FGrantedItemInstance::writeJSON(JsonWriter& writer)
     if (ItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (PurchaseDate.notNull())
@@ -14382,6 +14185,7 @@ bool PlayFab::ServerModels::FGrantedItemInstance::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomDataObject;
     if (obj->TryGetObjectField(TEXT("CustomData"), CustomDataObject))
     {
+        CustomData.Reserve((*CustomDataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
             CustomData.Add(It.Key(), It.Value()->AsString());
@@ -14499,7 +14303,7 @@ void PlayFab::ServerModels::FGrantItemsToCharacterRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -14529,7 +14333,7 @@ void PlayFab::ServerModels::FGrantItemsToCharacterRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -14563,6 +14367,7 @@ bool PlayFab::ServerModels::FGrantItemsToCharacterRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14607,11 +14412,7 @@ bool PlayFab::ServerModels::FGrantItemsToCharacterResult::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemGrantResultsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ItemGrantResults"));
-    for (int32 Idx = 0; Idx < ItemGrantResultsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemGrantResultsArray[Idx];
-        ItemGrantResults.Add(FGrantedItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemGrantResultsArray, ItemGrantResults);
 
 
     return HasSucceeded;
@@ -14662,7 +14463,7 @@ void PlayFab::ServerModels::FGrantItemsToUserRequest::writeJSON(JsonWriter& writ
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -14689,6 +14490,7 @@ bool PlayFab::ServerModels::FGrantItemsToUserRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14733,11 +14535,7 @@ bool PlayFab::ServerModels::FGrantItemsToUserResult::readFromValue(const TShared
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemGrantResultsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ItemGrantResults"));
-    for (int32 Idx = 0; Idx < ItemGrantResultsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemGrantResultsArray[Idx];
-        ItemGrantResults.Add(FGrantedItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemGrantResultsArray, ItemGrantResults);
 
 
     return HasSucceeded;
@@ -14761,7 +14559,7 @@ void PlayFab::ServerModels::FItemGrant::writeJSON(JsonWriter& writer) const
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (Data.Num() != 0)
@@ -14801,7 +14599,7 @@ void PlayFab::ServerModels::FItemGrant::writeJSON(JsonWriter& writer) const
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -14828,6 +14626,7 @@ bool PlayFab::ServerModels::FItemGrant::readFromValue(const TSharedPtr<FJsonObje
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -14902,6 +14701,7 @@ bool PlayFab::ServerModels::FGrantItemsToUsersRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -14909,11 +14709,7 @@ bool PlayFab::ServerModels::FGrantItemsToUsersRequest::readFromValue(const TShar
     }
 
     const TArray<TSharedPtr<FJsonValue>>&ItemGrantsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ItemGrants"));
-    for (int32 Idx = 0; Idx < ItemGrantsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemGrantsArray[Idx];
-        ItemGrants.Add(FItemGrant(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemGrantsArray, ItemGrants);
 
 
     return HasSucceeded;
@@ -14945,11 +14741,7 @@ bool PlayFab::ServerModels::FGrantItemsToUsersResult::readFromValue(const TShare
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemGrantResultsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ItemGrantResults"));
-    for (int32 Idx = 0; Idx < ItemGrantResultsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemGrantResultsArray[Idx];
-        ItemGrantResults.Add(FGrantedItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemGrantResultsArray, ItemGrantResults);
 
 
     return HasSucceeded;
@@ -14998,7 +14790,7 @@ void PlayFab::ServerModels::FLinkNintendoServiceAccountRequest::writeJSON(JsonWr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -15011,6 +14803,7 @@ bool PlayFab::ServerModels::FLinkNintendoServiceAccountRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15074,7 +14867,7 @@ void PlayFab::ServerModels::FLinkNintendoServiceAccountSubjectRequest::writeJSON
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!Subject.IsEmpty() == false)
@@ -15097,6 +14890,7 @@ bool PlayFab::ServerModels::FLinkNintendoServiceAccountSubjectRequest::readFromV
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15170,7 +14964,7 @@ void PlayFab::ServerModels::FLinkNintendoSwitchDeviceIdRequest::writeJSON(JsonWr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -15183,6 +14977,7 @@ bool PlayFab::ServerModels::FLinkNintendoSwitchDeviceIdRequest::readFromValue(co
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15281,7 +15076,7 @@ void PlayFab::ServerModels::FLinkPSNAccountRequest::writeJSON(JsonWriter& writer
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!RedirectUri.IsEmpty() == false)
@@ -15311,6 +15106,7 @@ bool PlayFab::ServerModels::FLinkPSNAccountRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15406,7 +15202,7 @@ void PlayFab::ServerModels::FLinkPSNIdRequest::writeJSON(JsonWriter& writer) con
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!PSNUserId.IsEmpty() == false)
@@ -15429,6 +15225,7 @@ bool PlayFab::ServerModels::FLinkPSNIdRequest::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15518,7 +15315,7 @@ void PlayFab::ServerModels::FLinkServerCustomIdRequest::writeJSON(JsonWriter& wr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!ServerCustomId.IsEmpty() == false)
@@ -15541,6 +15338,7 @@ bool PlayFab::ServerModels::FLinkServerCustomIdRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15623,7 +15421,7 @@ void PlayFab::ServerModels::FLinkSteamIdRequest::writeJSON(JsonWriter& writer) c
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!SteamId.IsEmpty() == false)
@@ -15646,6 +15444,7 @@ bool PlayFab::ServerModels::FLinkSteamIdRequest::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15728,7 +15527,7 @@ void PlayFab::ServerModels::FLinkXboxAccountRequest::writeJSON(JsonWriter& write
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!XboxToken.IsEmpty() == false)
@@ -15751,6 +15550,7 @@ bool PlayFab::ServerModels::FLinkXboxAccountRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -15816,7 +15616,7 @@ void PlayFab::ServerModels::FListPlayerCustomPropertiesRequest::writeJSON(JsonWr
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -15848,7 +15648,7 @@ void PlayFab::ServerModels::FListPlayerCustomPropertiesResult::writeJSON(JsonWri
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Properties.Num() != 0)
@@ -15878,11 +15678,7 @@ bool PlayFab::ServerModels::FListPlayerCustomPropertiesResult::readFromValue(con
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PropertiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Properties"));
-    for (int32 Idx = 0; Idx < PropertiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PropertiesArray[Idx];
-        Properties.Add(FCustomPropertyDetails(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PropertiesArray, Properties);
 
 
     const TSharedPtr<FJsonValue> PropertiesVersionValue = obj->TryGetField(TEXT("PropertiesVersion"));
@@ -15911,7 +15707,7 @@ void PlayFab::ServerModels::FListUsersCharactersRequest::writeJSON(JsonWriter& w
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -15957,11 +15753,7 @@ bool PlayFab::ServerModels::FListUsersCharactersResult::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&CharactersArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Characters"));
-    for (int32 Idx = 0; Idx < CharactersArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = CharactersArray[Idx];
-        Characters.Add(FCharacterResult(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(CharactersArray, Characters);
 
 
     return HasSucceeded;
@@ -16095,6 +15887,7 @@ bool PlayFab::ServerModels::FLoginWithPSNRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16190,6 +15983,7 @@ bool PlayFab::ServerModels::FLoginWithServerCustomIdRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16279,6 +16073,7 @@ bool PlayFab::ServerModels::FLoginWithSteamIdRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16371,6 +16166,7 @@ bool PlayFab::ServerModels::FLoginWithXboxIdRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16460,6 +16256,7 @@ bool PlayFab::ServerModels::FLoginWithXboxRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16551,7 +16348,7 @@ void PlayFab::ServerModels::FModifyItemUsesRequest::writeJSON(JsonWriter& writer
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -16561,7 +16358,7 @@ void PlayFab::ServerModels::FModifyItemUsesRequest::writeJSON(JsonWriter& writer
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("UsesToAdd"));
@@ -16577,6 +16374,7 @@ bool PlayFab::ServerModels::FModifyItemUsesRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -16619,7 +16417,7 @@ void PlayFab::ServerModels::FModifyItemUsesResult::writeJSON(JsonWriter& writer)
     if (ItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("RemainingUses"));
@@ -16667,7 +16465,7 @@ void PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWrit
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (VirtualCurrency.IsEmpty() == false)
@@ -16730,7 +16528,7 @@ void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::writeJSON(
     else
     {
         writer->WriteIdentifierPrefix(TEXT("GivingCharacterId"));
-        writer->WriteValue(GivingCharacterId);
+        writer->WriteValue(GivingCharacterId.ToString());
     }
 
     if (!ItemInstanceId.IsEmpty() == false)
@@ -16740,7 +16538,7 @@ void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::writeJSON(
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -16750,7 +16548,7 @@ void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::writeJSON(
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!ReceivingCharacterId.IsEmpty() == false)
@@ -16760,7 +16558,7 @@ void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::writeJSON(
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ReceivingCharacterId"));
-        writer->WriteValue(ReceivingCharacterId);
+        writer->WriteValue(ReceivingCharacterId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -16836,7 +16634,7 @@ void PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ItemInstanceId.IsEmpty() == false)
@@ -16846,7 +16644,7 @@ void PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -16856,7 +16654,7 @@ void PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -16925,7 +16723,7 @@ void PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ItemInstanceId.IsEmpty() == false)
@@ -16935,7 +16733,7 @@ void PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -16945,7 +16743,7 @@ void PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -17118,7 +16916,7 @@ void PlayFab::ServerModels::FRedeemCouponRequest::writeJSON(JsonWriter& writer)
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!CouponCode.IsEmpty() == false)
@@ -17149,7 +16947,7 @@ void PlayFab::ServerModels::FRedeemCouponRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -17183,6 +16981,7 @@ bool PlayFab::ServerModels::FRedeemCouponRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17225,11 +17024,7 @@ bool PlayFab::ServerModels::FRedeemCouponResult::readFromValue(const TSharedPtr<
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&GrantedItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GrantedItems"));
-    for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GrantedItemsArray, GrantedItems);
 
 
     return HasSucceeded;
@@ -17251,7 +17046,7 @@ void PlayFab::ServerModels::FRemoveFriendRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("FriendPlayFabId"));
-        writer->WriteValue(FriendPlayFabId);
+        writer->WriteValue(FriendPlayFabId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -17261,7 +17056,7 @@ void PlayFab::ServerModels::FRemoveFriendRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -17307,7 +17102,7 @@ void PlayFab::ServerModels::FRemoveGenericIDRequest::writeJSON(JsonWriter& write
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -17360,7 +17155,7 @@ void PlayFab::ServerModels::FRemovePlayerTagRequest::writeJSON(JsonWriter& write
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!TagName.IsEmpty() == false)
@@ -17383,6 +17178,7 @@ bool PlayFab::ServerModels::FRemovePlayerTagRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17551,6 +17347,7 @@ bool PlayFab::ServerModels::FReportPlayerServerRequest::readFromValue(const TSha
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -17619,7 +17416,7 @@ void PlayFab::ServerModels::FRevokeAllBansForUserRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -17665,11 +17462,7 @@ bool PlayFab::ServerModels::FRevokeAllBansForUserResult::readFromValue(const TSh
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -17728,11 +17521,7 @@ bool PlayFab::ServerModels::FRevokeBansResult::readFromValue(const TSharedPtr<FJ
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -17750,7 +17539,7 @@ void PlayFab::ServerModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer)
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ItemInstanceId.IsEmpty() == false)
@@ -17760,7 +17549,7 @@ void PlayFab::ServerModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -17770,7 +17559,7 @@ void PlayFab::ServerModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -17816,7 +17605,7 @@ void PlayFab::ServerModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& w
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ItemInstanceId.IsEmpty() == false)
@@ -17826,7 +17615,7 @@ void PlayFab::ServerModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& w
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -17836,7 +17625,7 @@ void PlayFab::ServerModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& w
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -17893,11 +17682,7 @@ bool PlayFab::ServerModels::FRevokeInventoryItemsRequest::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Items"));
-    for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FRevokeInventoryItem(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ItemsArray, Items);
 
 
     return HasSucceeded;
@@ -17974,11 +17759,7 @@ bool PlayFab::ServerModels::FRevokeInventoryItemsResult::readFromValue(const TSh
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&ErrorsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Errors"));
-    for (int32 Idx = 0; Idx < ErrorsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = ErrorsArray[Idx];
-        Errors.Add(FRevokeItemError(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(ErrorsArray, Errors);
 
 
     return HasSucceeded;
@@ -18082,6 +17863,7 @@ bool PlayFab::ServerModels::FSavePushNotificationTemplateRequest::readFromValue(
     const TSharedPtr<FJsonObject>* LocalizedPushNotificationTemplatesObject;
     if (obj->TryGetObjectField(TEXT("LocalizedPushNotificationTemplates"), LocalizedPushNotificationTemplatesObject))
     {
+        LocalizedPushNotificationTemplates.Reserve((*LocalizedPushNotificationTemplatesObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LocalizedPushNotificationTemplatesObject)->Values); It; ++It)
         {
             LocalizedPushNotificationTemplates.Add(It.Key(), FLocalizedPushNotificationProperties(It.Value()->AsObject()));
@@ -18182,6 +17964,7 @@ bool PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::readFromValu
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18268,7 +18051,7 @@ void PlayFab::ServerModels::FSendEmailFromTemplateRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -18281,6 +18064,7 @@ bool PlayFab::ServerModels::FSendEmailFromTemplateRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18373,6 +18157,7 @@ bool PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18471,16 +18256,13 @@ bool PlayFab::ServerModels::FSendPushNotificationRequest::readFromValue(const TS
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&AdvancedPlatformDeliveryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("AdvancedPlatformDelivery"));
-    for (int32 Idx = 0; Idx < AdvancedPlatformDeliveryArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = AdvancedPlatformDeliveryArray[Idx];
-        AdvancedPlatformDelivery.Add(FAdvancedPushPlatformMsg(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(AdvancedPlatformDeliveryArray, AdvancedPlatformDelivery);
 
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -18677,11 +18459,7 @@ bool PlayFab::ServerModels::FTreatmentAssignment::readFromValue(const TSharedPtr
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&VariablesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Variables"));
-    for (int32 Idx = 0; Idx < VariablesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = VariablesArray[Idx];
-        Variables.Add(FVariable(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(VariablesArray, Variables);
 
 
     obj->TryGetStringArrayField(TEXT("Variants"), Variants);
@@ -18726,7 +18504,7 @@ void PlayFab::ServerModels::FServerLoginResult::writeJSON(JsonWriter& writer) co
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (SessionTicket.IsEmpty() == false)
@@ -18823,7 +18601,7 @@ void PlayFab::ServerModels::FSetFriendTagsRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("FriendPlayFabId"));
-        writer->WriteValue(FriendPlayFabId);
+        writer->WriteValue(FriendPlayFabId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -18833,7 +18611,7 @@ void PlayFab::ServerModels::FSetFriendTagsRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("Tags"));
@@ -18890,7 +18668,7 @@ void PlayFab::ServerModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& write
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19150,7 +18928,7 @@ void PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::writeJSON(
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -19171,7 +18949,7 @@ void PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::writeJSON(
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!VirtualCurrency.IsEmpty() == false)
@@ -19208,6 +18986,7 @@ bool PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::readFromVa
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19261,7 +19040,7 @@ void PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!VirtualCurrency.IsEmpty() == false)
@@ -19291,6 +19070,7 @@ bool PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19341,7 +19121,7 @@ void PlayFab::ServerModels::FUnlinkNintendoServiceAccountRequest::writeJSON(Json
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19354,6 +19134,7 @@ bool PlayFab::ServerModels::FUnlinkNintendoServiceAccountRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19403,7 +19184,7 @@ void PlayFab::ServerModels::FUnlinkNintendoSwitchDeviceIdRequest::writeJSON(Json
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19416,6 +19197,7 @@ bool PlayFab::ServerModels::FUnlinkNintendoSwitchDeviceIdRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19485,7 +19267,7 @@ void PlayFab::ServerModels::FUnlinkPSNAccountRequest::writeJSON(JsonWriter& writ
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19498,6 +19280,7 @@ bool PlayFab::ServerModels::FUnlinkPSNAccountRequest::readFromValue(const TShare
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19560,7 +19343,7 @@ void PlayFab::ServerModels::FUnlinkServerCustomIdRequest::writeJSON(JsonWriter&
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (!ServerCustomId.IsEmpty() == false)
@@ -19583,6 +19366,7 @@ bool PlayFab::ServerModels::FUnlinkServerCustomIdRequest::readFromValue(const TS
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19652,7 +19436,7 @@ void PlayFab::ServerModels::FUnlinkSteamIdRequest::writeJSON(JsonWriter& writer)
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19665,6 +19449,7 @@ bool PlayFab::ServerModels::FUnlinkSteamIdRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19727,7 +19512,7 @@ void PlayFab::ServerModels::FUnlinkXboxAccountRequest::writeJSON(JsonWriter& wri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19740,6 +19525,7 @@ bool PlayFab::ServerModels::FUnlinkXboxAccountRequest::readFromValue(const TShar
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19793,7 +19579,7 @@ void PlayFab::ServerModels::FUnlockContainerInstanceRequest::writeJSON(JsonWrite
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ContainerItemInstanceId.IsEmpty() == false)
@@ -19803,7 +19589,7 @@ void PlayFab::ServerModels::FUnlockContainerInstanceRequest::writeJSON(JsonWrite
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ContainerItemInstanceId"));
-        writer->WriteValue(ContainerItemInstanceId);
+        writer->WriteValue(ContainerItemInstanceId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -19820,7 +19606,7 @@ void PlayFab::ServerModels::FUnlockContainerInstanceRequest::writeJSON(JsonWrite
     if (KeyItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("KeyItemInstanceId"));
-        writer->WriteValue(KeyItemInstanceId);
+        writer->WriteValue(KeyItemInstanceId.ToString());
     }
 
     if (!PlayFabId.IsEmpty() == false)
@@ -19830,7 +19616,7 @@ void PlayFab::ServerModels::FUnlockContainerInstanceRequest::writeJSON(JsonWrite
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19864,6 +19650,7 @@ bool PlayFab::ServerModels::FUnlockContainerInstanceRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -19905,7 +19692,7 @@ void PlayFab::ServerModels::FUnlockContainerItemRequest::writeJSON(JsonWriter& w
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (!ContainerItemId.IsEmpty() == false)
@@ -19936,7 +19723,7 @@ void PlayFab::ServerModels::FUnlockContainerItemRequest::writeJSON(JsonWriter& w
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -19970,6 +19757,7 @@ bool PlayFab::ServerModels::FUnlockContainerItemRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20007,13 +19795,13 @@ void PlayFab::ServerModels::FUnlockContainerItemResult::writeJSON(JsonWriter& wr
     if (UnlockedItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("UnlockedItemInstanceId"));
-        writer->WriteValue(UnlockedItemInstanceId);
+        writer->WriteValue(UnlockedItemInstanceId.ToString());
     }
 
     if (UnlockedWithItemInstanceId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("UnlockedWithItemInstanceId"));
-        writer->WriteValue(UnlockedWithItemInstanceId);
+        writer->WriteValue(UnlockedWithItemInstanceId.ToString());
     }
 
     if (VirtualCurrency.Num() != 0)
@@ -20035,11 +19823,7 @@ bool PlayFab::ServerModels::FUnlockContainerItemResult::readFromValue(const TSha
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&GrantedItemsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GrantedItems"));
-    for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FItemInstance(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(GrantedItemsArray, GrantedItems);
 
 
     const TSharedPtr<FJsonValue> UnlockedItemInstanceIdValue = obj->TryGetField(TEXT("UnlockedItemInstanceId"));
@@ -20095,7 +19879,7 @@ void PlayFab::ServerModels::FUpdateAvatarUrlRequest::writeJSON(JsonWriter& write
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -20252,11 +20036,7 @@ bool PlayFab::ServerModels::FUpdateBansRequest::readFromValue(const TSharedPtr<F
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BansArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Bans"));
-    for (int32 Idx = 0; Idx < BansArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BansArray[Idx];
-        Bans.Add(FUpdateBanRequest(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BansArray, Bans);
 
 
     return HasSucceeded;
@@ -20288,11 +20068,7 @@ bool PlayFab::ServerModels::FUpdateBansResult::readFromValue(const TSharedPtr<FJ
     bool HasSucceeded = true;
 
     const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(BanDataArray, BanData);
 
 
     return HasSucceeded;
@@ -20314,7 +20090,7 @@ void PlayFab::ServerModels::FUpdateCharacterDataRequest::writeJSON(JsonWriter& w
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -20361,7 +20137,7 @@ void PlayFab::ServerModels::FUpdateCharacterDataRequest::writeJSON(JsonWriter& w
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -20381,6 +20157,7 @@ bool PlayFab::ServerModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20390,6 +20167,7 @@ bool PlayFab::ServerModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -20455,7 +20233,7 @@ void PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonWri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CharacterStatistics.Num() != 0)
@@ -20487,7 +20265,7 @@ void PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonWri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -20517,6 +20295,7 @@ bool PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20630,7 +20409,7 @@ void PlayFab::ServerModels::FUpdatePlayerCustomPropertiesRequest::writeJSON(Json
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("Properties"));
@@ -20649,6 +20428,7 @@ bool PlayFab::ServerModels::FUpdatePlayerCustomPropertiesRequest::readFromValue(
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20670,11 +20450,7 @@ bool PlayFab::ServerModels::FUpdatePlayerCustomPropertiesRequest::readFromValue(
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PropertiesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Properties"));
-    for (int32 Idx = 0; Idx < PropertiesArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = PropertiesArray[Idx];
-        Properties.Add(FUpdateProperty(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(PropertiesArray, Properties);
 
 
     return HasSucceeded;
@@ -20692,7 +20468,7 @@ void PlayFab::ServerModels::FUpdatePlayerCustomPropertiesResult::writeJSON(JsonW
     if (PlayFabId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteIdentifierPrefix(TEXT("PropertiesVersion"));
@@ -20755,7 +20531,7 @@ void PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::writeJSON(JsonWriter
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteArrayStart(TEXT("Statistics"));
@@ -20774,6 +20550,7 @@ bool PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20795,11 +20572,7 @@ bool PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::readFromValue(const
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Statistics"));
-    for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
-    {
-        TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticUpdate(CurrentItem->AsObject()));
-    }
+    FPlayFabJsonHelpers::ReadObjectArray(StatisticsArray, Statistics);
 
 
     return HasSucceeded;
@@ -20890,6 +20663,7 @@ bool PlayFab::ServerModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -20899,6 +20673,7 @@ bool PlayFab::ServerModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -20991,7 +20766,7 @@ void PlayFab::ServerModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -21004,6 +20779,7 @@ bool PlayFab::ServerModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21013,6 +20789,7 @@ bool PlayFab::ServerModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -21109,7 +20886,7 @@ void PlayFab::ServerModels::FUpdateUserInternalDataRequest::writeJSON(JsonWriter
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -21122,6 +20899,7 @@ bool PlayFab::ServerModels::FUpdateUserInternalDataRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21131,6 +20909,7 @@ bool PlayFab::ServerModels::FUpdateUserInternalDataRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -21161,7 +20940,7 @@ void PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::writeJSON(JsonW
     if (CharacterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -21193,7 +20972,7 @@ void PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("ItemInstanceId"));
-        writer->WriteValue(ItemInstanceId);
+        writer->WriteValue(ItemInstanceId.ToString());
     }
 
     if (KeysToRemove.Num() != 0)
@@ -21212,7 +20991,7 @@ void PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::writeJSON(JsonW
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     writer->WriteObjectEnd();
@@ -21232,6 +21011,7 @@ bool PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21241,6 +21021,7 @@ bool PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::readFromValue(c
     const TSharedPtr<FJsonObject>* DataObject;
     if (obj->TryGetObjectField(TEXT("Data"), DataObject))
     {
+        Data.Reserve((*DataObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
             Data.Add(It.Key(), It.Value()->AsString());
@@ -21325,7 +21106,7 @@ void PlayFab::ServerModels::FWriteServerCharacterEventRequest::writeJSON(JsonWri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
+        writer->WriteValue(CharacterId.ToString());
     }
 
     if (CustomTags.Num() != 0)
@@ -21356,7 +21137,7 @@ void PlayFab::ServerModels::FWriteServerCharacterEventRequest::writeJSON(JsonWri
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Timestamp.notNull())
@@ -21375,6 +21156,7 @@ bool PlayFab::ServerModels::FWriteServerCharacterEventRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* BodyObject;
     if (obj->TryGetObjectField(TEXT("Body"), BodyObject))
     {
+        Body.Reserve((*BodyObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
             Body.Add(It.Key(), FJsonKeeper(It.Value()));
@@ -21391,6 +21173,7 @@ bool PlayFab::ServerModels::FWriteServerCharacterEventRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21467,7 +21250,7 @@ void PlayFab::ServerModels::FWriteServerPlayerEventRequest::writeJSON(JsonWriter
     else
     {
         writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        writer->WriteValue(PlayFabId.ToString());
     }
 
     if (Timestamp.notNull())
@@ -21486,6 +21269,7 @@ bool PlayFab::ServerModels::FWriteServerPlayerEventRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* BodyObject;
     if (obj->TryGetObjectField(TEXT("Body"), BodyObject))
     {
+        Body.Reserve((*BodyObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
             Body.Add(It.Key(), FJsonKeeper(It.Value()));
@@ -21495,6 +21279,7 @@ bool PlayFab::ServerModels::FWriteServerPlayerEventRequest::readFromValue(const
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21580,6 +21365,7 @@ bool PlayFab::ServerModels::FWriteTitleEventRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* BodyObject;
     if (obj->TryGetObjectField(TEXT("Body"), BodyObject))
     {
+        Body.Reserve((*BodyObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
             Body.Add(It.Key(), FJsonKeeper(It.Value()));
@@ -21589,6 +21375,7 @@ bool PlayFab::ServerModels::FWriteTitleEventRequest::readFromValue(const TShared
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
+        CustomTags.Reserve((*CustomTagsObject)->Values.Num());
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
             CustomTags.Add(It.Key(), It.Value()->AsString());
@@ -21610,3 +21397,5 @@ bool PlayFab::ServerModels::FWriteTitleEventRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+
+#endif // WITH_PLAYFAB_SERVER_API
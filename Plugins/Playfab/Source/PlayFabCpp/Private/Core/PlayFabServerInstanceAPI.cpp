@@ -4,6 +4,7 @@
 
 
 // This is automatically generated by PlayFab SDKGenerator. DO NOT modify this manually!
+#if WITH_PLAYFAB_SERVER_API
 #include "Core/PlayFabServerInstanceAPI.h"
 #include "Core/PlayFabSettings.h"
 #include "Core/PlayFabResultHandler.h"
@@ -77,7 +78,7 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabServerInstanceAPI::GetOrCreate
     return this->authContext;
 }
 
-bool UPlayFabServerInstanceAPI::AddCharacterVirtualCurrency(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::AddCharacterVirtualCurrency(
     ServerModels::FAddCharacterVirtualCurrencyRequest& request,
     const FAddCharacterVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -90,7 +91,7 @@ bool UPlayFabServerInstanceAPI::AddCharacterVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddCharacterVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddCharacterVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnAddCharacterVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddCharacterVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -107,7 +108,7 @@ void UPlayFabServerInstanceAPI::OnAddCharacterVirtualCurrencyResult(FHttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::AddFriend(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::AddFriend(
     ServerModels::FAddFriendRequest& request,
     const FAddFriendDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -120,7 +121,7 @@ bool UPlayFabServerInstanceAPI::AddFriend(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddFriend"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -137,7 +138,7 @@ void UPlayFabServerInstanceAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabServerInstanceAPI::AddGenericID(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::AddGenericID(
     ServerModels::FAddGenericIDRequest& request,
     const FAddGenericIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -150,7 +151,7 @@ bool UPlayFabServerInstanceAPI::AddGenericID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddGenericID"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -167,7 +168,7 @@ void UPlayFabServerInstanceAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::AddPlayerTag(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::AddPlayerTag(
     ServerModels::FAddPlayerTagRequest& request,
     const FAddPlayerTagDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -180,7 +181,7 @@ bool UPlayFabServerInstanceAPI::AddPlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddPlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddPlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -197,7 +198,7 @@ void UPlayFabServerInstanceAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::AddSharedGroupMembers(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::AddSharedGroupMembers(
     ServerModels::FAddSharedGroupMembersRequest& request,
     const FAddSharedGroupMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -210,7 +211,7 @@ bool UPlayFabServerInstanceAPI::AddSharedGroupMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddSharedGroupMembers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -227,7 +228,7 @@ void UPlayFabServerInstanceAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::AddUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::AddUserVirtualCurrency(
     ServerModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -240,7 +241,7 @@ bool UPlayFabServerInstanceAPI::AddUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -257,7 +258,7 @@ void UPlayFabServerInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabServerInstanceAPI::AuthenticateSessionTicket(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::AuthenticateSessionTicket(
     ServerModels::FAuthenticateSessionTicketRequest& request,
     const FAuthenticateSessionTicketDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -270,7 +271,7 @@ bool UPlayFabServerInstanceAPI::AuthenticateSessionTicket(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AuthenticateSessionTicket"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAuthenticateSessionTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnAuthenticateSessionTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAuthenticateSessionTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -287,7 +288,7 @@ void UPlayFabServerInstanceAPI::OnAuthenticateSessionTicketResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabServerInstanceAPI::AwardSteamAchievement(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::AwardSteamAchievement(
     ServerModels::FAwardSteamAchievementRequest& request,
     const FAwardSteamAchievementDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -300,7 +301,7 @@ bool UPlayFabServerInstanceAPI::AwardSteamAchievement(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AwardSteamAchievement"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAwardSteamAchievementResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnAwardSteamAchievementResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAwardSteamAchievementDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -317,7 +318,7 @@ void UPlayFabServerInstanceAPI::OnAwardSteamAchievementResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::BanUsers(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::BanUsers(
     ServerModels::FBanUsersRequest& request,
     const FBanUsersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -330,7 +331,7 @@ bool UPlayFabServerInstanceAPI::BanUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/BanUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBanUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -347,7 +348,7 @@ void UPlayFabServerInstanceAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FH
     }
 }
 
-bool UPlayFabServerInstanceAPI::ConsumeItem(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::ConsumeItem(
     ServerModels::FConsumeItemRequest& request,
     const FConsumeItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -360,7 +361,7 @@ bool UPlayFabServerInstanceAPI::ConsumeItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ConsumeItem"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -377,7 +378,7 @@ void UPlayFabServerInstanceAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabServerInstanceAPI::CreateSharedGroup(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::CreateSharedGroup(
     ServerModels::FCreateSharedGroupRequest& request,
     const FCreateSharedGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -390,7 +391,7 @@ bool UPlayFabServerInstanceAPI::CreateSharedGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/CreateSharedGroup"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -407,7 +408,7 @@ void UPlayFabServerInstanceAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabServerInstanceAPI::DeleteCharacterFromUser(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::DeleteCharacterFromUser(
     ServerModels::FDeleteCharacterFromUserRequest& request,
     const FDeleteCharacterFromUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -420,7 +421,7 @@ bool UPlayFabServerInstanceAPI::DeleteCharacterFromUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeleteCharacterFromUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeleteCharacterFromUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnDeleteCharacterFromUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteCharacterFromUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -437,7 +438,7 @@ void UPlayFabServerInstanceAPI::OnDeleteCharacterFromUserResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::DeletePlayer(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::DeletePlayer(
     ServerModels::FDeletePlayerRequest& request,
     const FDeletePlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -450,7 +451,7 @@ bool UPlayFabServerInstanceAPI::DeletePlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeletePlayer"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -467,7 +468,7 @@ void UPlayFabServerInstanceAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::DeletePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::DeletePlayerCustomProperties(
     ServerModels::FDeletePlayerCustomPropertiesRequest& request,
     const FDeletePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -480,7 +481,7 @@ bool UPlayFabServerInstanceAPI::DeletePlayerCustomProperties(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeletePlayerCustomProperties"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeletePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnDeletePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -497,7 +498,7 @@ void UPlayFabServerInstanceAPI::OnDeletePlayerCustomPropertiesResult(FHttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::DeletePushNotificationTemplate(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::DeletePushNotificationTemplate(
     ServerModels::FDeletePushNotificationTemplateRequest& request,
     const FDeletePushNotificationTemplateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -510,7 +511,7 @@ bool UPlayFabServerInstanceAPI::DeletePushNotificationTemplate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeletePushNotificationTemplate"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeletePushNotificationTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnDeletePushNotificationTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePushNotificationTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -527,7 +528,7 @@ void UPlayFabServerInstanceAPI::OnDeletePushNotificationTemplateResult(FHttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::DeleteSharedGroup(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::DeleteSharedGroup(
     ServerModels::FDeleteSharedGroupRequest& request,
     const FDeleteSharedGroupDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -540,7 +541,7 @@ bool UPlayFabServerInstanceAPI::DeleteSharedGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeleteSharedGroup"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeleteSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnDeleteSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -557,7 +558,7 @@ void UPlayFabServerInstanceAPI::OnDeleteSharedGroupResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabServerInstanceAPI::EvaluateRandomResultTable(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::EvaluateRandomResultTable(
     ServerModels::FEvaluateRandomResultTableRequest& request,
     const FEvaluateRandomResultTableDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -570,7 +571,7 @@ bool UPlayFabServerInstanceAPI::EvaluateRandomResultTable(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/EvaluateRandomResultTable"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnEvaluateRandomResultTableResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnEvaluateRandomResultTableResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FEvaluateRandomResultTableDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -587,7 +588,7 @@ void UPlayFabServerInstanceAPI::OnEvaluateRandomResultTableResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabServerInstanceAPI::ExecuteCloudScript(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::ExecuteCloudScript(
     ServerModels::FExecuteCloudScriptServerRequest& request,
     const FExecuteCloudScriptDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -600,7 +601,7 @@ bool UPlayFabServerInstanceAPI::ExecuteCloudScript(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ExecuteCloudScript"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -617,7 +618,7 @@ void UPlayFabServerInstanceAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetAllSegments(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetAllSegments(
     const FGetAllSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -625,7 +626,7 @@ bool UPlayFabServerInstanceAPI::GetAllSegments(
     return UPlayFabServerInstanceAPI::GetAllSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabServerInstanceAPI::GetAllSegments(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetAllSegments(
     ServerModels::FGetAllSegmentsRequest& request,
     const FGetAllSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -638,7 +639,7 @@ bool UPlayFabServerInstanceAPI::GetAllSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetAllSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -655,7 +656,7 @@ void UPlayFabServerInstanceAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetAllUsersCharacters(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetAllUsersCharacters(
     ServerModels::FListUsersCharactersRequest& request,
     const FGetAllUsersCharactersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -668,7 +669,7 @@ bool UPlayFabServerInstanceAPI::GetAllUsersCharacters(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetAllUsersCharacters"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllUsersCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -685,7 +686,7 @@ void UPlayFabServerInstanceAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetCatalogItems(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetCatalogItems(
     ServerModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -698,7 +699,7 @@ bool UPlayFabServerInstanceAPI::GetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -715,7 +716,7 @@ void UPlayFabServerInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetCharacterData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetCharacterData(
     ServerModels::FGetCharacterDataRequest& request,
     const FGetCharacterDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -728,7 +729,7 @@ bool UPlayFabServerInstanceAPI::GetCharacterData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -745,7 +746,7 @@ void UPlayFabServerInstanceAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetCharacterInternalData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetCharacterInternalData(
     ServerModels::FGetCharacterDataRequest& request,
     const FGetCharacterInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -758,7 +759,7 @@ bool UPlayFabServerInstanceAPI::GetCharacterInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -775,7 +776,7 @@ void UPlayFabServerInstanceAPI::OnGetCharacterInternalDataResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetCharacterInventory(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetCharacterInventory(
     ServerModels::FGetCharacterInventoryRequest& request,
     const FGetCharacterInventoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -788,7 +789,7 @@ bool UPlayFabServerInstanceAPI::GetCharacterInventory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterInventory"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -805,7 +806,7 @@ void UPlayFabServerInstanceAPI::OnGetCharacterInventoryResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetCharacterLeaderboard(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetCharacterLeaderboard(
     ServerModels::FGetCharacterLeaderboardRequest& request,
     const FGetCharacterLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -818,7 +819,7 @@ bool UPlayFabServerInstanceAPI::GetCharacterLeaderboard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterLeaderboard"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -835,7 +836,7 @@ void UPlayFabServerInstanceAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetCharacterReadOnlyData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetCharacterReadOnlyData(
     ServerModels::FGetCharacterDataRequest& request,
     const FGetCharacterReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -848,7 +849,7 @@ bool UPlayFabServerInstanceAPI::GetCharacterReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -865,7 +866,7 @@ void UPlayFabServerInstanceAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetCharacterStatistics(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetCharacterStatistics(
     ServerModels::FGetCharacterStatisticsRequest& request,
     const FGetCharacterStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -878,7 +879,7 @@ bool UPlayFabServerInstanceAPI::GetCharacterStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -895,7 +896,7 @@ void UPlayFabServerInstanceAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetContentDownloadUrl(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetContentDownloadUrl(
     ServerModels::FGetContentDownloadUrlRequest& request,
     const FGetContentDownloadUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -908,7 +909,7 @@ bool UPlayFabServerInstanceAPI::GetContentDownloadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetContentDownloadUrl"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -925,7 +926,7 @@ void UPlayFabServerInstanceAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetFriendLeaderboard(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetFriendLeaderboard(
     ServerModels::FGetFriendLeaderboardRequest& request,
     const FGetFriendLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -938,7 +939,7 @@ bool UPlayFabServerInstanceAPI::GetFriendLeaderboard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetFriendLeaderboard"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -955,7 +956,7 @@ void UPlayFabServerInstanceAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetFriendsList(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetFriendsList(
     ServerModels::FGetFriendsListRequest& request,
     const FGetFriendsListDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -968,7 +969,7 @@ bool UPlayFabServerInstanceAPI::GetFriendsList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetFriendsList"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetFriendsListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendsListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -985,7 +986,7 @@ void UPlayFabServerInstanceAPI::OnGetFriendsListResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetLeaderboard(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetLeaderboard(
     ServerModels::FGetLeaderboardRequest& request,
     const FGetLeaderboardDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -998,7 +999,7 @@ bool UPlayFabServerInstanceAPI::GetLeaderboard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboard"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1015,7 +1016,7 @@ void UPlayFabServerInstanceAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetLeaderboardAroundCharacter(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetLeaderboardAroundCharacter(
     ServerModels::FGetLeaderboardAroundCharacterRequest& request,
     const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1028,7 +1029,7 @@ bool UPlayFabServerInstanceAPI::GetLeaderboardAroundCharacter(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboardAroundCharacter"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetLeaderboardAroundCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1045,7 +1046,7 @@ void UPlayFabServerInstanceAPI::OnGetLeaderboardAroundCharacterResult(FHttpReque
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetLeaderboardAroundUser(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetLeaderboardAroundUser(
     ServerModels::FGetLeaderboardAroundUserRequest& request,
     const FGetLeaderboardAroundUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1058,7 +1059,7 @@ bool UPlayFabServerInstanceAPI::GetLeaderboardAroundUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboardAroundUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetLeaderboardAroundUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetLeaderboardAroundUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1075,7 +1076,7 @@ void UPlayFabServerInstanceAPI::OnGetLeaderboardAroundUserResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetLeaderboardForUserCharacters(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetLeaderboardForUserCharacters(
     ServerModels::FGetLeaderboardForUsersCharactersRequest& request,
     const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1088,7 +1089,7 @@ bool UPlayFabServerInstanceAPI::GetLeaderboardForUserCharacters(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboardForUserCharacters"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetLeaderboardForUserCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForUserCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1105,7 +1106,7 @@ void UPlayFabServerInstanceAPI::OnGetLeaderboardForUserCharactersResult(FHttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayerCombinedInfo(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayerCombinedInfo(
     ServerModels::FGetPlayerCombinedInfoRequest& request,
     const FGetPlayerCombinedInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1118,7 +1119,7 @@ bool UPlayFabServerInstanceAPI::GetPlayerCombinedInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerCombinedInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCombinedInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1135,7 +1136,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayerCustomProperty(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayerCustomProperty(
     ServerModels::FGetPlayerCustomPropertyRequest& request,
     const FGetPlayerCustomPropertyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1148,7 +1149,7 @@ bool UPlayFabServerInstanceAPI::GetPlayerCustomProperty(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerCustomProperty"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerCustomPropertyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCustomPropertyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1165,7 +1166,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayerCustomPropertyResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayerProfile(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayerProfile(
     ServerModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1178,7 +1179,7 @@ bool UPlayFabServerInstanceAPI::GetPlayerProfile(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerProfile"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1195,7 +1196,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayerSegments(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayerSegments(
     ServerModels::FGetPlayersSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1208,7 +1209,7 @@ bool UPlayFabServerInstanceAPI::GetPlayerSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1225,7 +1226,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayersInSegment(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayersInSegment(
     ServerModels::FGetPlayersInSegmentRequest& request,
     const FGetPlayersInSegmentDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1238,7 +1239,7 @@ bool UPlayFabServerInstanceAPI::GetPlayersInSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1255,7 +1256,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayerStatistics(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayerStatistics(
     ServerModels::FGetPlayerStatisticsRequest& request,
     const FGetPlayerStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1268,7 +1269,7 @@ bool UPlayFabServerInstanceAPI::GetPlayerStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1285,7 +1286,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayerStatisticVersions(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayerStatisticVersions(
     ServerModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1298,7 +1299,7 @@ bool UPlayFabServerInstanceAPI::GetPlayerStatisticVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1315,7 +1316,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayerTags(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayerTags(
     ServerModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1328,7 +1329,7 @@ bool UPlayFabServerInstanceAPI::GetPlayerTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerTags"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1345,7 +1346,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookIDs(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookIDs(
     ServerModels::FGetPlayFabIDsFromFacebookIDsRequest& request,
     const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1358,7 +1359,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromFacebookIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1375,7 +1376,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request,
     const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1388,7 +1389,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1405,7 +1406,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromGenericIDs(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromGenericIDs(
     ServerModels::FGetPlayFabIDsFromGenericIDsRequest& request,
     const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1418,7 +1419,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromGenericIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromGenericIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGenericIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1435,7 +1436,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
     ServerModels::FGetPlayFabIDsFromNintendoServiceAccountIdsRequest& request,
     const FGetPlayFabIDsFromNintendoServiceAccountIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1448,7 +1449,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromNintendoServiceAccountIds"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoServiceAccountIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1465,7 +1466,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResu
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request,
     const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1478,7 +1479,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1495,7 +1496,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
     ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request,
     const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1508,7 +1509,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNAccountIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1525,7 +1526,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNOnlineIDs(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNOnlineIDs(
     ServerModels::FGetPlayFabIDsFromPSNOnlineIDsRequest& request,
     const FGetPlayFabIDsFromPSNOnlineIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1538,7 +1539,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNOnlineIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromPSNOnlineIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromPSNOnlineIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromPSNOnlineIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNOnlineIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1555,7 +1556,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromPSNOnlineIDsResult(FHttpReque
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamIDs(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamIDs(
     ServerModels::FGetPlayFabIDsFromSteamIDsRequest& request,
     const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1568,7 +1569,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromSteamIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1585,7 +1586,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamNames(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamNames(
     ServerModels::FGetPlayFabIDsFromSteamNamesRequest& request,
     const FGetPlayFabIDsFromSteamNamesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1598,7 +1599,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamNames(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromSteamNames"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromSteamNamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromSteamNamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamNamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1615,7 +1616,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromSteamNamesResult(FHttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromTwitchIDs(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromTwitchIDs(
     ServerModels::FGetPlayFabIDsFromTwitchIDsRequest& request,
     const FGetPlayFabIDsFromTwitchIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1628,7 +1629,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromTwitchIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromTwitchIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromTwitchIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromTwitchIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromTwitchIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1645,7 +1646,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromTwitchIDsResult(FHttpRequestP
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
     ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request,
     const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1658,7 +1659,7 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1675,7 +1676,7 @@ void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetPublisherData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetPublisherData(
     ServerModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1688,7 +1689,7 @@ bool UPlayFabServerInstanceAPI::GetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1705,7 +1706,7 @@ void UPlayFabServerInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetRandomResultTables(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetRandomResultTables(
     ServerModels::FGetRandomResultTablesRequest& request,
     const FGetRandomResultTablesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1718,7 +1719,7 @@ bool UPlayFabServerInstanceAPI::GetRandomResultTables(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1735,7 +1736,7 @@ void UPlayFabServerInstanceAPI::OnGetRandomResultTablesResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetServerCustomIDsFromPlayFabIDs(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetServerCustomIDsFromPlayFabIDs(
     ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest& request,
     const FGetServerCustomIDsFromPlayFabIDsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1748,7 +1749,7 @@ bool UPlayFabServerInstanceAPI::GetServerCustomIDsFromPlayFabIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetServerCustomIDsFromPlayFabIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetServerCustomIDsFromPlayFabIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetServerCustomIDsFromPlayFabIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetServerCustomIDsFromPlayFabIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1765,7 +1766,7 @@ void UPlayFabServerInstanceAPI::OnGetServerCustomIDsFromPlayFabIDsResult(FHttpRe
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetSharedGroupData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetSharedGroupData(
     ServerModels::FGetSharedGroupDataRequest& request,
     const FGetSharedGroupDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1778,7 +1779,7 @@ bool UPlayFabServerInstanceAPI::GetSharedGroupData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetSharedGroupData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1795,7 +1796,7 @@ void UPlayFabServerInstanceAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetStoreItems(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetStoreItems(
     ServerModels::FGetStoreItemsServerRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1808,7 +1809,7 @@ bool UPlayFabServerInstanceAPI::GetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1825,7 +1826,7 @@ void UPlayFabServerInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetTime(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetTime(
     const FGetTimeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
 { 
@@ -1833,7 +1834,7 @@ bool UPlayFabServerInstanceAPI::GetTime(
     return UPlayFabServerInstanceAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate);
 }
 
-bool UPlayFabServerInstanceAPI::GetTime(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetTime(
     ServerModels::FGetTimeRequest& request,
     const FGetTimeDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1846,7 +1847,7 @@ bool UPlayFabServerInstanceAPI::GetTime(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTime"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTimeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1863,7 +1864,7 @@ void UPlayFabServerInstanceAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHt
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetTitleData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetTitleData(
     ServerModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1876,7 +1877,7 @@ bool UPlayFabServerInstanceAPI::GetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1893,7 +1894,7 @@ void UPlayFabServerInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetTitleInternalData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetTitleInternalData(
     ServerModels::FGetTitleDataRequest& request,
     const FGetTitleInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1906,7 +1907,7 @@ bool UPlayFabServerInstanceAPI::GetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1923,7 +1924,7 @@ void UPlayFabServerInstanceAPI::OnGetTitleInternalDataResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetTitleNews(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetTitleNews(
     ServerModels::FGetTitleNewsRequest& request,
     const FGetTitleNewsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1936,7 +1937,7 @@ bool UPlayFabServerInstanceAPI::GetTitleNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTitleNews"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1953,7 +1954,7 @@ void UPlayFabServerInstanceAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetUserAccountInfo(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetUserAccountInfo(
     ServerModels::FGetUserAccountInfoRequest& request,
     const FGetUserAccountInfoDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1966,7 +1967,7 @@ bool UPlayFabServerInstanceAPI::GetUserAccountInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserAccountInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1983,7 +1984,7 @@ void UPlayFabServerInstanceAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetUserBans(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetUserBans(
     ServerModels::FGetUserBansRequest& request,
     const FGetUserBansDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -1996,7 +1997,7 @@ bool UPlayFabServerInstanceAPI::GetUserBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2013,7 +2014,7 @@ void UPlayFabServerInstanceAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetUserData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetUserData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2026,7 +2027,7 @@ bool UPlayFabServerInstanceAPI::GetUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2043,7 +2044,7 @@ void UPlayFabServerInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetUserInternalData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetUserInternalData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2056,7 +2057,7 @@ bool UPlayFabServerInstanceAPI::GetUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2073,7 +2074,7 @@ void UPlayFabServerInstanceAPI::OnGetUserInternalDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetUserInventory(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetUserInventory(
     ServerModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2086,7 +2087,7 @@ bool UPlayFabServerInstanceAPI::GetUserInventory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserInventory"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2103,7 +2104,7 @@ void UPlayFabServerInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetUserPublisherData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetUserPublisherData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2116,7 +2117,7 @@ bool UPlayFabServerInstanceAPI::GetUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2133,7 +2134,7 @@ void UPlayFabServerInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetUserPublisherInternalData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetUserPublisherInternalData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserPublisherInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2146,7 +2147,7 @@ bool UPlayFabServerInstanceAPI::GetUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2163,7 +2164,7 @@ void UPlayFabServerInstanceAPI::OnGetUserPublisherInternalDataResult(FHttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetUserPublisherReadOnlyData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetUserPublisherReadOnlyData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2176,7 +2177,7 @@ bool UPlayFabServerInstanceAPI::GetUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2193,7 +2194,7 @@ void UPlayFabServerInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::GetUserReadOnlyData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GetUserReadOnlyData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2206,7 +2207,7 @@ bool UPlayFabServerInstanceAPI::GetUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2223,7 +2224,7 @@ void UPlayFabServerInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabServerInstanceAPI::GrantCharacterToUser(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GrantCharacterToUser(
     ServerModels::FGrantCharacterToUserRequest& request,
     const FGrantCharacterToUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2236,7 +2237,7 @@ bool UPlayFabServerInstanceAPI::GrantCharacterToUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantCharacterToUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGrantCharacterToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantCharacterToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2253,7 +2254,7 @@ void UPlayFabServerInstanceAPI::OnGrantCharacterToUserResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabServerInstanceAPI::GrantItemsToCharacter(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GrantItemsToCharacter(
     ServerModels::FGrantItemsToCharacterRequest& request,
     const FGrantItemsToCharacterDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2266,7 +2267,7 @@ bool UPlayFabServerInstanceAPI::GrantItemsToCharacter(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantItemsToCharacter"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGrantItemsToCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGrantItemsToCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2283,7 +2284,7 @@ void UPlayFabServerInstanceAPI::OnGrantItemsToCharacterResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::GrantItemsToUser(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GrantItemsToUser(
     ServerModels::FGrantItemsToUserRequest& request,
     const FGrantItemsToUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2296,7 +2297,7 @@ bool UPlayFabServerInstanceAPI::GrantItemsToUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantItemsToUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGrantItemsToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGrantItemsToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2313,7 +2314,7 @@ void UPlayFabServerInstanceAPI::OnGrantItemsToUserResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::GrantItemsToUsers(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::GrantItemsToUsers(
     ServerModels::FGrantItemsToUsersRequest& request,
     const FGrantItemsToUsersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2326,7 +2327,7 @@ bool UPlayFabServerInstanceAPI::GrantItemsToUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantItemsToUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2343,7 +2344,7 @@ void UPlayFabServerInstanceAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabServerInstanceAPI::LinkNintendoServiceAccount(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LinkNintendoServiceAccount(
     ServerModels::FLinkNintendoServiceAccountRequest& request,
     const FLinkNintendoServiceAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2356,7 +2357,7 @@ bool UPlayFabServerInstanceAPI::LinkNintendoServiceAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2373,7 +2374,7 @@ void UPlayFabServerInstanceAPI::OnLinkNintendoServiceAccountResult(FHttpRequestP
     }
 }
 
-bool UPlayFabServerInstanceAPI::LinkNintendoServiceAccountSubject(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LinkNintendoServiceAccountSubject(
     ServerModels::FLinkNintendoServiceAccountSubjectRequest& request,
     const FLinkNintendoServiceAccountSubjectDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2386,7 +2387,7 @@ bool UPlayFabServerInstanceAPI::LinkNintendoServiceAccountSubject(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkNintendoServiceAccountSubject"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkNintendoServiceAccountSubjectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLinkNintendoServiceAccountSubjectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoServiceAccountSubjectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2403,7 +2404,7 @@ void UPlayFabServerInstanceAPI::OnLinkNintendoServiceAccountSubjectResult(FHttpR
     }
 }
 
-bool UPlayFabServerInstanceAPI::LinkNintendoSwitchDeviceId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LinkNintendoSwitchDeviceId(
     ServerModels::FLinkNintendoSwitchDeviceIdRequest& request,
     const FLinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2416,7 +2417,7 @@ bool UPlayFabServerInstanceAPI::LinkNintendoSwitchDeviceId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2433,7 +2434,7 @@ void UPlayFabServerInstanceAPI::OnLinkNintendoSwitchDeviceIdResult(FHttpRequestP
     }
 }
 
-bool UPlayFabServerInstanceAPI::LinkPSNAccount(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LinkPSNAccount(
     ServerModels::FLinkPSNAccountRequest& request,
     const FLinkPSNAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2446,7 +2447,7 @@ bool UPlayFabServerInstanceAPI::LinkPSNAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkPSNAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2463,7 +2464,7 @@ void UPlayFabServerInstanceAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabServerInstanceAPI::LinkPSNId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LinkPSNId(
     ServerModels::FLinkPSNIdRequest& request,
     const FLinkPSNIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2476,7 +2477,7 @@ bool UPlayFabServerInstanceAPI::LinkPSNId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkPSNId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkPSNIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLinkPSNIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkPSNIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2493,7 +2494,7 @@ void UPlayFabServerInstanceAPI::OnLinkPSNIdResult(FHttpRequestPtr HttpRequest, F
     }
 }
 
-bool UPlayFabServerInstanceAPI::LinkServerCustomId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LinkServerCustomId(
     ServerModels::FLinkServerCustomIdRequest& request,
     const FLinkServerCustomIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2506,7 +2507,7 @@ bool UPlayFabServerInstanceAPI::LinkServerCustomId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkServerCustomId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkServerCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLinkServerCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkServerCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2523,7 +2524,7 @@ void UPlayFabServerInstanceAPI::OnLinkServerCustomIdResult(FHttpRequestPtr HttpR
     }
 }
 
-bool UPlayFabServerInstanceAPI::LinkSteamId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LinkSteamId(
     ServerModels::FLinkSteamIdRequest& request,
     const FLinkSteamIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2536,7 +2537,7 @@ bool UPlayFabServerInstanceAPI::LinkSteamId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkSteamId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkSteamIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLinkSteamIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkSteamIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2553,7 +2554,7 @@ void UPlayFabServerInstanceAPI::OnLinkSteamIdResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabServerInstanceAPI::LinkXboxAccount(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LinkXboxAccount(
     ServerModels::FLinkXboxAccountRequest& request,
     const FLinkXboxAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2566,7 +2567,7 @@ bool UPlayFabServerInstanceAPI::LinkXboxAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkXboxAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2583,7 +2584,7 @@ void UPlayFabServerInstanceAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::ListPlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::ListPlayerCustomProperties(
     ServerModels::FListPlayerCustomPropertiesRequest& request,
     const FListPlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2596,7 +2597,7 @@ bool UPlayFabServerInstanceAPI::ListPlayerCustomProperties(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ListPlayerCustomProperties"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnListPlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnListPlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListPlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2613,7 +2614,7 @@ void UPlayFabServerInstanceAPI::OnListPlayerCustomPropertiesResult(FHttpRequestP
     }
 }
 
-bool UPlayFabServerInstanceAPI::LoginWithPSN(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LoginWithPSN(
     ServerModels::FLoginWithPSNRequest& request,
     const FLoginWithPSNDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2626,7 +2627,7 @@ bool UPlayFabServerInstanceAPI::LoginWithPSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithPSN"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLoginWithPSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2643,7 +2644,7 @@ void UPlayFabServerInstanceAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::LoginWithServerCustomId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LoginWithServerCustomId(
     ServerModels::FLoginWithServerCustomIdRequest& request,
     const FLoginWithServerCustomIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2656,7 +2657,7 @@ bool UPlayFabServerInstanceAPI::LoginWithServerCustomId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithServerCustomId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLoginWithServerCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLoginWithServerCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithServerCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2673,7 +2674,7 @@ void UPlayFabServerInstanceAPI::OnLoginWithServerCustomIdResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::LoginWithSteamId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LoginWithSteamId(
     ServerModels::FLoginWithSteamIdRequest& request,
     const FLoginWithSteamIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2686,7 +2687,7 @@ bool UPlayFabServerInstanceAPI::LoginWithSteamId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithSteamId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLoginWithSteamIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLoginWithSteamIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithSteamIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2703,7 +2704,7 @@ void UPlayFabServerInstanceAPI::OnLoginWithSteamIdResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::LoginWithXbox(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LoginWithXbox(
     ServerModels::FLoginWithXboxRequest& request,
     const FLoginWithXboxDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2716,7 +2717,7 @@ bool UPlayFabServerInstanceAPI::LoginWithXbox(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithXbox"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2733,7 +2734,7 @@ void UPlayFabServerInstanceAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::LoginWithXboxId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::LoginWithXboxId(
     ServerModels::FLoginWithXboxIdRequest& request,
     const FLoginWithXboxIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2746,7 +2747,7 @@ bool UPlayFabServerInstanceAPI::LoginWithXboxId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithXboxId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLoginWithXboxIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnLoginWithXboxIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2763,7 +2764,7 @@ void UPlayFabServerInstanceAPI::OnLoginWithXboxIdResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::ModifyItemUses(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::ModifyItemUses(
     ServerModels::FModifyItemUsesRequest& request,
     const FModifyItemUsesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2776,7 +2777,7 @@ bool UPlayFabServerInstanceAPI::ModifyItemUses(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ModifyItemUses"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnModifyItemUsesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnModifyItemUsesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FModifyItemUsesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2793,7 +2794,7 @@ void UPlayFabServerInstanceAPI::OnModifyItemUsesResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabServerInstanceAPI::MoveItemToCharacterFromCharacter(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::MoveItemToCharacterFromCharacter(
     ServerModels::FMoveItemToCharacterFromCharacterRequest& request,
     const FMoveItemToCharacterFromCharacterDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2806,7 +2807,7 @@ bool UPlayFabServerInstanceAPI::MoveItemToCharacterFromCharacter(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/MoveItemToCharacterFromCharacter"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMoveItemToCharacterFromCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2823,7 +2824,7 @@ void UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromCharacterResult(FHttpRe
     }
 }
 
-bool UPlayFabServerInstanceAPI::MoveItemToCharacterFromUser(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::MoveItemToCharacterFromUser(
     ServerModels::FMoveItemToCharacterFromUserRequest& request,
     const FMoveItemToCharacterFromUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2836,7 +2837,7 @@ bool UPlayFabServerInstanceAPI::MoveItemToCharacterFromUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/MoveItemToCharacterFromUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMoveItemToCharacterFromUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2853,7 +2854,7 @@ void UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromUserResult(FHttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::MoveItemToUserFromCharacter(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::MoveItemToUserFromCharacter(
     ServerModels::FMoveItemToUserFromCharacterRequest& request,
     const FMoveItemToUserFromCharacterDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2866,7 +2867,7 @@ bool UPlayFabServerInstanceAPI::MoveItemToUserFromCharacter(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/MoveItemToUserFromCharacter"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnMoveItemToUserFromCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnMoveItemToUserFromCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMoveItemToUserFromCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2883,7 +2884,7 @@ void UPlayFabServerInstanceAPI::OnMoveItemToUserFromCharacterResult(FHttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::RedeemCoupon(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::RedeemCoupon(
     ServerModels::FRedeemCouponRequest& request,
     const FRedeemCouponDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2896,7 +2897,7 @@ bool UPlayFabServerInstanceAPI::RedeemCoupon(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RedeemCoupon"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemCouponDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2913,7 +2914,7 @@ void UPlayFabServerInstanceAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::RemoveFriend(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::RemoveFriend(
     ServerModels::FRemoveFriendRequest& request,
     const FRemoveFriendDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2926,7 +2927,7 @@ bool UPlayFabServerInstanceAPI::RemoveFriend(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemoveFriend"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2943,7 +2944,7 @@ void UPlayFabServerInstanceAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::RemoveGenericID(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::RemoveGenericID(
     ServerModels::FRemoveGenericIDRequest& request,
     const FRemoveGenericIDDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2956,7 +2957,7 @@ bool UPlayFabServerInstanceAPI::RemoveGenericID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemoveGenericID"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2973,7 +2974,7 @@ void UPlayFabServerInstanceAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::RemovePlayerTag(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::RemovePlayerTag(
     ServerModels::FRemovePlayerTagRequest& request,
     const FRemovePlayerTagDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -2986,7 +2987,7 @@ bool UPlayFabServerInstanceAPI::RemovePlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemovePlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemovePlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3003,7 +3004,7 @@ void UPlayFabServerInstanceAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::RemoveSharedGroupMembers(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::RemoveSharedGroupMembers(
     ServerModels::FRemoveSharedGroupMembersRequest& request,
     const FRemoveSharedGroupMembersDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3016,7 +3017,7 @@ bool UPlayFabServerInstanceAPI::RemoveSharedGroupMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemoveSharedGroupMembers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3033,7 +3034,7 @@ void UPlayFabServerInstanceAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::ReportPlayer(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::ReportPlayer(
     ServerModels::FReportPlayerServerRequest& request,
     const FReportPlayerDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3046,7 +3047,7 @@ bool UPlayFabServerInstanceAPI::ReportPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ReportPlayer"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3063,7 +3064,7 @@ void UPlayFabServerInstanceAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::RevokeAllBansForUser(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::RevokeAllBansForUser(
     ServerModels::FRevokeAllBansForUserRequest& request,
     const FRevokeAllBansForUserDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3076,7 +3077,7 @@ bool UPlayFabServerInstanceAPI::RevokeAllBansForUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeAllBansForUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeAllBansForUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3093,7 +3094,7 @@ void UPlayFabServerInstanceAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabServerInstanceAPI::RevokeBans(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::RevokeBans(
     ServerModels::FRevokeBansRequest& request,
     const FRevokeBansDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3106,7 +3107,7 @@ bool UPlayFabServerInstanceAPI::RevokeBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3123,7 +3124,7 @@ void UPlayFabServerInstanceAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabServerInstanceAPI::RevokeInventoryItem(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::RevokeInventoryItem(
     ServerModels::FRevokeInventoryItemRequest& request,
     const FRevokeInventoryItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3136,7 +3137,7 @@ bool UPlayFabServerInstanceAPI::RevokeInventoryItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeInventoryItem"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3153,7 +3154,7 @@ void UPlayFabServerInstanceAPI::OnRevokeInventoryItemResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabServerInstanceAPI::RevokeInventoryItems(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::RevokeInventoryItems(
     ServerModels::FRevokeInventoryItemsRequest& request,
     const FRevokeInventoryItemsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3166,7 +3167,7 @@ bool UPlayFabServerInstanceAPI::RevokeInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeInventoryItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3183,7 +3184,7 @@ void UPlayFabServerInstanceAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabServerInstanceAPI::SavePushNotificationTemplate(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SavePushNotificationTemplate(
     ServerModels::FSavePushNotificationTemplateRequest& request,
     const FSavePushNotificationTemplateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3196,7 +3197,7 @@ bool UPlayFabServerInstanceAPI::SavePushNotificationTemplate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SavePushNotificationTemplate"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSavePushNotificationTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSavePushNotificationTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSavePushNotificationTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3213,7 +3214,7 @@ void UPlayFabServerInstanceAPI::OnSavePushNotificationTemplateResult(FHttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::SendCustomAccountRecoveryEmail(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SendCustomAccountRecoveryEmail(
     ServerModels::FSendCustomAccountRecoveryEmailRequest& request,
     const FSendCustomAccountRecoveryEmailDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3226,7 +3227,7 @@ bool UPlayFabServerInstanceAPI::SendCustomAccountRecoveryEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendCustomAccountRecoveryEmail"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSendCustomAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSendCustomAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendCustomAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3243,7 +3244,7 @@ void UPlayFabServerInstanceAPI::OnSendCustomAccountRecoveryEmailResult(FHttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::SendEmailFromTemplate(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SendEmailFromTemplate(
     ServerModels::FSendEmailFromTemplateRequest& request,
     const FSendEmailFromTemplateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3256,7 +3257,7 @@ bool UPlayFabServerInstanceAPI::SendEmailFromTemplate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendEmailFromTemplate"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSendEmailFromTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSendEmailFromTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendEmailFromTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3273,7 +3274,7 @@ void UPlayFabServerInstanceAPI::OnSendEmailFromTemplateResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::SendPushNotification(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SendPushNotification(
     ServerModels::FSendPushNotificationRequest& request,
     const FSendPushNotificationDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3286,7 +3287,7 @@ bool UPlayFabServerInstanceAPI::SendPushNotification(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendPushNotification"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSendPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSendPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3303,7 +3304,7 @@ void UPlayFabServerInstanceAPI::OnSendPushNotificationResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabServerInstanceAPI::SendPushNotificationFromTemplate(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SendPushNotificationFromTemplate(
     ServerModels::FSendPushNotificationFromTemplateRequest& request,
     const FSendPushNotificationFromTemplateDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3316,7 +3317,7 @@ bool UPlayFabServerInstanceAPI::SendPushNotificationFromTemplate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendPushNotificationFromTemplate"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSendPushNotificationFromTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSendPushNotificationFromTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendPushNotificationFromTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3333,7 +3334,7 @@ void UPlayFabServerInstanceAPI::OnSendPushNotificationFromTemplateResult(FHttpRe
     }
 }
 
-bool UPlayFabServerInstanceAPI::SetFriendTags(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SetFriendTags(
     ServerModels::FSetFriendTagsRequest& request,
     const FSetFriendTagsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3346,7 +3347,7 @@ bool UPlayFabServerInstanceAPI::SetFriendTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetFriendTags"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetFriendTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3363,7 +3364,7 @@ void UPlayFabServerInstanceAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::SetPlayerSecret(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SetPlayerSecret(
     ServerModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3376,7 +3377,7 @@ bool UPlayFabServerInstanceAPI::SetPlayerSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetPlayerSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3393,7 +3394,7 @@ void UPlayFabServerInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::SetPublisherData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SetPublisherData(
     ServerModels::FSetPublisherDataRequest& request,
     const FSetPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3406,7 +3407,7 @@ bool UPlayFabServerInstanceAPI::SetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3423,7 +3424,7 @@ void UPlayFabServerInstanceAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::SetTitleData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SetTitleData(
     ServerModels::FSetTitleDataRequest& request,
     const FSetTitleDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3436,7 +3437,7 @@ bool UPlayFabServerInstanceAPI::SetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3453,7 +3454,7 @@ void UPlayFabServerInstanceAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::SetTitleInternalData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SetTitleInternalData(
     ServerModels::FSetTitleDataRequest& request,
     const FSetTitleInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3466,7 +3467,7 @@ bool UPlayFabServerInstanceAPI::SetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3483,7 +3484,7 @@ void UPlayFabServerInstanceAPI::OnSetTitleInternalDataResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabServerInstanceAPI::SubtractCharacterVirtualCurrency(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SubtractCharacterVirtualCurrency(
     ServerModels::FSubtractCharacterVirtualCurrencyRequest& request,
     const FSubtractCharacterVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3496,7 +3497,7 @@ bool UPlayFabServerInstanceAPI::SubtractCharacterVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SubtractCharacterVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSubtractCharacterVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSubtractCharacterVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractCharacterVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3513,7 +3514,7 @@ void UPlayFabServerInstanceAPI::OnSubtractCharacterVirtualCurrencyResult(FHttpRe
     }
 }
 
-bool UPlayFabServerInstanceAPI::SubtractUserVirtualCurrency(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::SubtractUserVirtualCurrency(
     ServerModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3526,7 +3527,7 @@ bool UPlayFabServerInstanceAPI::SubtractUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3543,7 +3544,7 @@ void UPlayFabServerInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::UnlinkNintendoServiceAccount(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UnlinkNintendoServiceAccount(
     ServerModels::FUnlinkNintendoServiceAccountRequest& request,
     const FUnlinkNintendoServiceAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3556,7 +3557,7 @@ bool UPlayFabServerInstanceAPI::UnlinkNintendoServiceAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUnlinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3573,7 +3574,7 @@ void UPlayFabServerInstanceAPI::OnUnlinkNintendoServiceAccountResult(FHttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::UnlinkNintendoSwitchDeviceId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UnlinkNintendoSwitchDeviceId(
     ServerModels::FUnlinkNintendoSwitchDeviceIdRequest& request,
     const FUnlinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3586,7 +3587,7 @@ bool UPlayFabServerInstanceAPI::UnlinkNintendoSwitchDeviceId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUnlinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3603,7 +3604,7 @@ void UPlayFabServerInstanceAPI::OnUnlinkNintendoSwitchDeviceIdResult(FHttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::UnlinkPSNAccount(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UnlinkPSNAccount(
     ServerModels::FUnlinkPSNAccountRequest& request,
     const FUnlinkPSNAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3616,7 +3617,7 @@ bool UPlayFabServerInstanceAPI::UnlinkPSNAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkPSNAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3633,7 +3634,7 @@ void UPlayFabServerInstanceAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::UnlinkServerCustomId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UnlinkServerCustomId(
     ServerModels::FUnlinkServerCustomIdRequest& request,
     const FUnlinkServerCustomIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3646,7 +3647,7 @@ bool UPlayFabServerInstanceAPI::UnlinkServerCustomId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkServerCustomId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlinkServerCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUnlinkServerCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkServerCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3663,7 +3664,7 @@ void UPlayFabServerInstanceAPI::OnUnlinkServerCustomIdResult(FHttpRequestPtr Htt
     }
 }
 
-bool UPlayFabServerInstanceAPI::UnlinkSteamId(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UnlinkSteamId(
     ServerModels::FUnlinkSteamIdRequest& request,
     const FUnlinkSteamIdDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3676,7 +3677,7 @@ bool UPlayFabServerInstanceAPI::UnlinkSteamId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkSteamId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlinkSteamIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUnlinkSteamIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkSteamIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3693,7 +3694,7 @@ void UPlayFabServerInstanceAPI::OnUnlinkSteamIdResult(FHttpRequestPtr HttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::UnlinkXboxAccount(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UnlinkXboxAccount(
     ServerModels::FUnlinkXboxAccountRequest& request,
     const FUnlinkXboxAccountDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3706,7 +3707,7 @@ bool UPlayFabServerInstanceAPI::UnlinkXboxAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkXboxAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3723,7 +3724,7 @@ void UPlayFabServerInstanceAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRe
     }
 }
 
-bool UPlayFabServerInstanceAPI::UnlockContainerInstance(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UnlockContainerInstance(
     ServerModels::FUnlockContainerInstanceRequest& request,
     const FUnlockContainerInstanceDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3736,7 +3737,7 @@ bool UPlayFabServerInstanceAPI::UnlockContainerInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlockContainerInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3753,7 +3754,7 @@ void UPlayFabServerInstanceAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::UnlockContainerItem(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UnlockContainerItem(
     ServerModels::FUnlockContainerItemRequest& request,
     const FUnlockContainerItemDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3766,7 +3767,7 @@ bool UPlayFabServerInstanceAPI::UnlockContainerItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlockContainerItem"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUnlockContainerItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3783,7 +3784,7 @@ void UPlayFabServerInstanceAPI::OnUnlockContainerItemResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateAvatarUrl(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateAvatarUrl(
     ServerModels::FUpdateAvatarUrlRequest& request,
     const FUpdateAvatarUrlDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3796,7 +3797,7 @@ bool UPlayFabServerInstanceAPI::UpdateAvatarUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateAvatarUrl"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateAvatarUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3813,7 +3814,7 @@ void UPlayFabServerInstanceAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequ
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateBans(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateBans(
     ServerModels::FUpdateBansRequest& request,
     const FUpdateBansDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3826,7 +3827,7 @@ bool UPlayFabServerInstanceAPI::UpdateBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3843,7 +3844,7 @@ void UPlayFabServerInstanceAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest,
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateCharacterData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateCharacterData(
     ServerModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3856,7 +3857,7 @@ bool UPlayFabServerInstanceAPI::UpdateCharacterData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3873,7 +3874,7 @@ void UPlayFabServerInstanceAPI::OnUpdateCharacterDataResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateCharacterInternalData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateCharacterInternalData(
     ServerModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3886,7 +3887,7 @@ bool UPlayFabServerInstanceAPI::UpdateCharacterInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateCharacterInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateCharacterInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3903,7 +3904,7 @@ void UPlayFabServerInstanceAPI::OnUpdateCharacterInternalDataResult(FHttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateCharacterReadOnlyData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateCharacterReadOnlyData(
     ServerModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3916,7 +3917,7 @@ bool UPlayFabServerInstanceAPI::UpdateCharacterReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3933,7 +3934,7 @@ void UPlayFabServerInstanceAPI::OnUpdateCharacterReadOnlyDataResult(FHttpRequest
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateCharacterStatistics(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateCharacterStatistics(
     ServerModels::FUpdateCharacterStatisticsRequest& request,
     const FUpdateCharacterStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3946,7 +3947,7 @@ bool UPlayFabServerInstanceAPI::UpdateCharacterStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3963,7 +3964,7 @@ void UPlayFabServerInstanceAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPt
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdatePlayerCustomProperties(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdatePlayerCustomProperties(
     ServerModels::FUpdatePlayerCustomPropertiesRequest& request,
     const FUpdatePlayerCustomPropertiesDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -3976,7 +3977,7 @@ bool UPlayFabServerInstanceAPI::UpdatePlayerCustomProperties(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdatePlayerCustomProperties"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdatePlayerCustomPropertiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdatePlayerCustomPropertiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerCustomPropertiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3993,7 +3994,7 @@ void UPlayFabServerInstanceAPI::OnUpdatePlayerCustomPropertiesResult(FHttpReques
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdatePlayerStatistics(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdatePlayerStatistics(
     ServerModels::FUpdatePlayerStatisticsRequest& request,
     const FUpdatePlayerStatisticsDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4006,7 +4007,7 @@ bool UPlayFabServerInstanceAPI::UpdatePlayerStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdatePlayerStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4023,7 +4024,7 @@ void UPlayFabServerInstanceAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateSharedGroupData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateSharedGroupData(
     ServerModels::FUpdateSharedGroupDataRequest& request,
     const FUpdateSharedGroupDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4036,7 +4037,7 @@ bool UPlayFabServerInstanceAPI::UpdateSharedGroupData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateSharedGroupData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4053,7 +4054,7 @@ void UPlayFabServerInstanceAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr Ht
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateUserData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateUserData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4066,7 +4067,7 @@ bool UPlayFabServerInstanceAPI::UpdateUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4083,7 +4084,7 @@ void UPlayFabServerInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpReque
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateUserInternalData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateUserInternalData(
     ServerModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4096,7 +4097,7 @@ bool UPlayFabServerInstanceAPI::UpdateUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4113,7 +4114,7 @@ void UPlayFabServerInstanceAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateUserInventoryItemCustomData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateUserInventoryItemCustomData(
     ServerModels::FUpdateUserInventoryItemDataRequest& request,
     const FUpdateUserInventoryItemCustomDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4126,7 +4127,7 @@ bool UPlayFabServerInstanceAPI::UpdateUserInventoryItemCustomData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserInventoryItemCustomData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserInventoryItemCustomDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserInventoryItemCustomDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInventoryItemCustomDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4143,7 +4144,7 @@ void UPlayFabServerInstanceAPI::OnUpdateUserInventoryItemCustomDataResult(FHttpR
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateUserPublisherData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateUserPublisherData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4156,7 +4157,7 @@ bool UPlayFabServerInstanceAPI::UpdateUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4173,7 +4174,7 @@ void UPlayFabServerInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateUserPublisherInternalData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateUserPublisherInternalData(
     ServerModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserPublisherInternalDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4186,7 +4187,7 @@ bool UPlayFabServerInstanceAPI::UpdateUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4203,7 +4204,7 @@ void UPlayFabServerInstanceAPI::OnUpdateUserPublisherInternalDataResult(FHttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateUserPublisherReadOnlyData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateUserPublisherReadOnlyData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4216,7 +4217,7 @@ bool UPlayFabServerInstanceAPI::UpdateUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4233,7 +4234,7 @@ void UPlayFabServerInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::UpdateUserReadOnlyData(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::UpdateUserReadOnlyData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserReadOnlyDataDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4246,7 +4247,7 @@ bool UPlayFabServerInstanceAPI::UpdateUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4263,7 +4264,7 @@ void UPlayFabServerInstanceAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr H
     }
 }
 
-bool UPlayFabServerInstanceAPI::WriteCharacterEvent(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::WriteCharacterEvent(
     ServerModels::FWriteServerCharacterEventRequest& request,
     const FWriteCharacterEventDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4276,7 +4277,7 @@ bool UPlayFabServerInstanceAPI::WriteCharacterEvent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/WriteCharacterEvent"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnWriteCharacterEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteCharacterEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4293,7 +4294,7 @@ void UPlayFabServerInstanceAPI::OnWriteCharacterEventResult(FHttpRequestPtr Http
     }
 }
 
-bool UPlayFabServerInstanceAPI::WritePlayerEvent(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::WritePlayerEvent(
     ServerModels::FWriteServerPlayerEventRequest& request,
     const FWritePlayerEventDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4306,7 +4307,7 @@ bool UPlayFabServerInstanceAPI::WritePlayerEvent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/WritePlayerEvent"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWritePlayerEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4323,7 +4324,7 @@ void UPlayFabServerInstanceAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpReq
     }
 }
 
-bool UPlayFabServerInstanceAPI::WriteTitleEvent(
+FPlayFabRequestHandle UPlayFabServerInstanceAPI::WriteTitleEvent(
     ServerModels::FWriteTitleEventRequest& request,
     const FWriteTitleEventDelegate& SuccessDelegate,
     const FPlayFabErrorDelegate& ErrorDelegate)
@@ -4336,7 +4337,7 @@ bool UPlayFabServerInstanceAPI::WriteTitleEvent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/WriteTitleEvent"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, request);
 }
 
 void UPlayFabServerInstanceAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTitleEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4352,3 +4353,5 @@ void UPlayFabServerInstanceAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequ
         ErrorDelegate.ExecuteIfBound(errorResult);
     }
 }
+
+#endif // WITH_PLAYFAB_SERVER_API
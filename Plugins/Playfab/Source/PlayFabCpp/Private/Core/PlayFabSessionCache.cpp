@@ -0,0 +1,346 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#if WITH_PLAYFAB_CLIENT_API
+#include "Core/PlayFabSessionCache.h"
+#include "Core/PlayFabSettings.h"
+
+using namespace PlayFab;
+using namespace PlayFab::ClientModels;
+
+template <typename ValueType>
+void PlayFabSessionCache::FKeyedPart<ValueType>::Assign(const TMap<FString, ValueType>& InValues, const TArray<FString>& RequestedKeys)
+{
+    Reset();
+    Merge(InValues, RequestedKeys);
+}
+
+template <typename ValueType>
+void PlayFabSessionCache::FKeyedPart<ValueType>::Merge(const TMap<FString, ValueType>& InValues, const TArray<FString>& RequestedKeys)
+{
+    // An empty key list means "every key", so the answer is complete
+    if (RequestedKeys.Num() == 0)
+    {
+        Values = InValues;
+        KnownKeys.Reset();
+        bAllKeys = true;
+        return;
+    }
+
+    for (const FString& Key : RequestedKeys)
+    {
+        // A requested key missing from the answer does not exist, which is worth remembering too
+        Values.Remove(Key);
+        KnownKeys.Add(Key);
+    }
+    Values.Append(InValues);
+}
+
+template <typename ValueType>
+bool PlayFabSessionCache::FKeyedPart<ValueType>::TryGet(const TArray<FString>& Keys, TMap<FString, ValueType>& OutValues) const
+{
+    if (Keys.Num() == 0)
+    {
+        if (!bAllKeys)
+        {
+            return false;
+        }
+        OutValues = Values;
+        return true;
+    }
+
+    for (const FString& Key : Keys)
+    {
+        if (!bAllKeys && !KnownKeys.Contains(Key))
+        {
+            return false;
+        }
+    }
+    for (const FString& Key : Keys)
+    {
+        if (const ValueType* Value = Values.Find(Key))
+        {
+            OutValues.Add(Key, *Value);
+        }
+    }
+    return true;
+}
+
+namespace
+{
+    TMap<FString, FStatisticValue> StatisticsByName(const TArray<FStatisticValue>& Statistics)
+    {
+        TMap<FString, FStatisticValue> Result;
+        Result.Reserve(Statistics.Num());
+        for (const FStatisticValue& Statistic : Statistics)
+        {
+            Result.Add(Statistic.StatisticName, Statistic);
+        }
+        return Result;
+    }
+}
+
+PlayFabSessionCache::PlayFabSessionCache(PlayFabClientPtr InClientAPI)
+    : ClientAPI(InClientAPI)
+{
+    InfoRequestParameters.GetTitleData = true;
+    InfoRequestParameters.GetUserData = true;
+    InfoRequestParameters.GetUserReadOnlyData = true;
+    InfoRequestParameters.GetPlayerStatistics = true;
+    InfoRequestParameters.GetUserInventory = true;
+    InfoRequestParameters.GetUserVirtualCurrency = true;
+}
+
+void PlayFabSessionCache::Store(const FGetPlayerCombinedInfoResultPayload& Payload, const FGetPlayerCombinedInfoRequestParams& RequestParams, const FPlayFabId& InPlayFabId)
+{
+    InvalidateAll();
+    PlayFabId = InPlayFabId;
+    // Login handlers set the new ticket before the success delegate runs
+    SessionTicket = PlayFabSettings::GetClientSessionTicket();
+    Hits = 0;
+    Misses = 0;
+
+    if (RequestParams.GetTitleData)
+    {
+        TitleData.Assign(Payload.TitleData, RequestParams.TitleDataKeys);
+        bCached[(int32)EPart::TitleData] = true;
+    }
+    if (RequestParams.GetUserData)
+    {
+        UserData.Assign(Payload.UserData, RequestParams.UserDataKeys);
+        UserDataVersion = Payload.UserDataVersion;
+        bCached[(int32)EPart::UserData] = true;
+    }
+    if (RequestParams.GetUserReadOnlyData)
+    {
+        UserReadOnlyData.Assign(Payload.UserReadOnlyData, RequestParams.UserReadOnlyDataKeys);
+        UserReadOnlyDataVersion = Payload.UserReadOnlyDataVersion;
+        bCached[(int32)EPart::UserReadOnlyData] = true;
+    }
+    if (RequestParams.GetPlayerStatistics)
+    {
+        PlayerStatistics.Assign(StatisticsByName(Payload.PlayerStatistics), RequestParams.PlayerStatisticNames);
+        bCached[(int32)EPart::PlayerStatistics] = true;
+    }
+    // GetUserInventory answers both, so both are needed to serve it
+    if (RequestParams.GetUserInventory && RequestParams.GetUserVirtualCurrency)
+    {
+        UserInventory.Inventory = Payload.UserInventory;
+        UserInventory.VirtualCurrency = Payload.UserVirtualCurrency;
+        UserInventory.VirtualCurrencyRechargeTimes = Payload.UserVirtualCurrencyRechargeTimes;
+        bCached[(int32)EPart::UserInventory] = true;
+    }
+}
+
+bool PlayFabSessionCache::IsCached(EPart Part) const
+{
+    return bCached[(int32)Part];
+}
+
+void PlayFabSessionCache::Invalidate(EPart Part)
+{
+    bCached[(int32)Part] = false;
+    switch (Part)
+    {
+    case EPart::TitleData: TitleData.Reset(); break;
+    case EPart::UserData: UserData.Reset(); break;
+    case EPart::UserReadOnlyData: UserReadOnlyData.Reset(); break;
+    case EPart::PlayerStatistics: PlayerStatistics.Reset(); break;
+    case EPart::UserInventory: UserInventory = FGetUserInventoryResult(); break;
+    default: break;
+    }
+}
+
+void PlayFabSessionCache::InvalidateAll()
+{
+    for (int32 Part = 0; Part < (int32)EPart::Count; ++Part)
+    {
+        Invalidate((EPart)Part);
+    }
+}
+
+FPlayFabRequestHandle PlayFabSessionCache::GetTitleData(FGetTitleDataRequest& request, const UPlayFabClientAPI::FGetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    CheckSession();
+    FGetTitleDataResult result;
+    if (IsCached(EPart::TitleData) && request.OverrideLabel.IsEmpty() && TitleData.TryGet(request.Keys, result.Data))
+    {
+        Hits += 1;
+        SuccessDelegate.ExecuteIfBound(result);
+        return FPlayFabRequestHandle(true);
+    }
+
+    Misses += 1;
+    if (!request.OverrideLabel.IsEmpty())
+    {
+        // Overridden values are not the ones the cache holds
+        return GetClientAPI()->GetTitleData(request, SuccessDelegate, ErrorDelegate);
+    }
+    return GetClientAPI()->GetTitleData(request,
+        UPlayFabClientAPI::FGetTitleDataDelegate::CreateSP(this, &PlayFabSessionCache::OnTitleDataResult, SuccessDelegate, request.Keys), ErrorDelegate);
+}
+
+FPlayFabRequestHandle PlayFabSessionCache::GetUserData(FGetUserDataRequest& request, const UPlayFabClientAPI::FGetUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    CheckSession();
+    const bool bOwnData = IsOwnPlayer(request.PlayFabId, request.AuthenticationContext) && request.IfChangedFromDataVersion.isNull();
+    FGetUserDataResult result;
+    if (bOwnData && IsCached(EPart::UserData) && UserData.TryGet(request.Keys, result.Data))
+    {
+        result.DataVersion = UserDataVersion;
+        Hits += 1;
+        SuccessDelegate.ExecuteIfBound(result);
+        return FPlayFabRequestHandle(true);
+    }
+
+    Misses += 1;
+    if (!bOwnData)
+    {
+        return GetClientAPI()->GetUserData(request, SuccessDelegate, ErrorDelegate);
+    }
+    return GetClientAPI()->GetUserData(request,
+        UPlayFabClientAPI::FGetUserDataDelegate::CreateSP(this, &PlayFabSessionCache::OnUserDataResult, SuccessDelegate, request.Keys), ErrorDelegate);
+}
+
+FPlayFabRequestHandle PlayFabSessionCache::GetUserReadOnlyData(FGetUserDataRequest& request, const UPlayFabClientAPI::FGetUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    CheckSession();
+    const bool bOwnData = IsOwnPlayer(request.PlayFabId, request.AuthenticationContext) && request.IfChangedFromDataVersion.isNull();
+    FGetUserDataResult result;
+    if (bOwnData && IsCached(EPart::UserReadOnlyData) && UserReadOnlyData.TryGet(request.Keys, result.Data))
+    {
+        result.DataVersion = UserReadOnlyDataVersion;
+        Hits += 1;
+        SuccessDelegate.ExecuteIfBound(result);
+        return FPlayFabRequestHandle(true);
+    }
+
+    Misses += 1;
+    if (!bOwnData)
+    {
+        return GetClientAPI()->GetUserReadOnlyData(request, SuccessDelegate, ErrorDelegate);
+    }
+    return GetClientAPI()->GetUserReadOnlyData(request,
+        UPlayFabClientAPI::FGetUserReadOnlyDataDelegate::CreateSP(this, &PlayFabSessionCache::OnUserReadOnlyDataResult, SuccessDelegate, request.Keys), ErrorDelegate);
+}
+
+FPlayFabRequestHandle PlayFabSessionCache::GetPlayerStatistics(FGetPlayerStatisticsRequest& request, const UPlayFabClientAPI::FGetPlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    CheckSession();
+    // The login payload only holds current versions
+    const bool bOwnData = IsOwnPlayer(FPlayFabId(), request.AuthenticationContext) && request.StatisticNameVersions.Num() == 0;
+    TMap<FString, FStatisticValue> Statistics;
+    if (bOwnData && IsCached(EPart::PlayerStatistics) && PlayerStatistics.TryGet(request.StatisticNames, Statistics))
+    {
+        FGetPlayerStatisticsResult result;
+        Statistics.GenerateValueArray(result.Statistics);
+        Hits += 1;
+        SuccessDelegate.ExecuteIfBound(result);
+        return FPlayFabRequestHandle(true);
+    }
+
+    Misses += 1;
+    if (!bOwnData)
+    {
+        return GetClientAPI()->GetPlayerStatistics(request, SuccessDelegate, ErrorDelegate);
+    }
+    return GetClientAPI()->GetPlayerStatistics(request,
+        UPlayFabClientAPI::FGetPlayerStatisticsDelegate::CreateSP(this, &PlayFabSessionCache::OnPlayerStatisticsResult, SuccessDelegate, request.StatisticNames), ErrorDelegate);
+}
+
+FPlayFabRequestHandle PlayFabSessionCache::GetUserInventory(FGetUserInventoryRequest& request, const UPlayFabClientAPI::FGetUserInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+{
+    CheckSession();
+    const bool bOwnData = IsOwnPlayer(FPlayFabId(), request.AuthenticationContext);
+    if (bOwnData && IsCached(EPart::UserInventory))
+    {
+        Hits += 1;
+        SuccessDelegate.ExecuteIfBound(UserInventory);
+        return FPlayFabRequestHandle(true);
+    }
+
+    Misses += 1;
+    if (!bOwnData)
+    {
+        return GetClientAPI()->GetUserInventory(request, SuccessDelegate, ErrorDelegate);
+    }
+    return GetClientAPI()->GetUserInventory(request,
+        UPlayFabClientAPI::FGetUserInventoryDelegate::CreateSP(this, &PlayFabSessionCache::OnUserInventoryResult, SuccessDelegate), ErrorDelegate);
+}
+
+void PlayFabSessionCache::OnTitleDataResult(const FGetTitleDataResult& result, UPlayFabClientAPI::FGetTitleDataDelegate SuccessDelegate, TArray<FString> Keys)
+{
+    TitleData.Merge(result.Data, Keys);
+    bCached[(int32)EPart::TitleData] = true;
+    SuccessDelegate.ExecuteIfBound(result);
+}
+
+void PlayFabSessionCache::OnUserDataResult(const FGetUserDataResult& result, UPlayFabClientAPI::FGetUserDataDelegate SuccessDelegate, TArray<FString> Keys)
+{
+    // Merging across versions would mix old and new records
+    if (result.DataVersion != UserDataVersion)
+    {
+        UserData.Reset();
+    }
+    UserData.Merge(result.Data, Keys);
+    UserDataVersion = result.DataVersion;
+    bCached[(int32)EPart::UserData] = true;
+    SuccessDelegate.ExecuteIfBound(result);
+}
+
+void PlayFabSessionCache::OnUserReadOnlyDataResult(const FGetUserDataResult& result, UPlayFabClientAPI::FGetUserReadOnlyDataDelegate SuccessDelegate, TArray<FString> Keys)
+{
+    if (result.DataVersion != UserReadOnlyDataVersion)
+    {
+        UserReadOnlyData.Reset();
+    }
+    UserReadOnlyData.Merge(result.Data, Keys);
+    UserReadOnlyDataVersion = result.DataVersion;
+    bCached[(int32)EPart::UserReadOnlyData] = true;
+    SuccessDelegate.ExecuteIfBound(result);
+}
+
+void PlayFabSessionCache::OnPlayerStatisticsResult(const FGetPlayerStatisticsResult& result, UPlayFabClientAPI::FGetPlayerStatisticsDelegate SuccessDelegate, TArray<FString> StatisticNames)
+{
+    PlayerStatistics.Merge(StatisticsByName(result.Statistics), StatisticNames);
+    bCached[(int32)EPart::PlayerStatistics] = true;
+    SuccessDelegate.ExecuteIfBound(result);
+}
+
+void PlayFabSessionCache::OnUserInventoryResult(const FGetUserInventoryResult& result, UPlayFabClientAPI::FGetUserInventoryDelegate SuccessDelegate)
+{
+    UserInventory = result;
+    bCached[(int32)EPart::UserInventory] = true;
+    SuccessDelegate.ExecuteIfBound(result);
+}
+
+bool PlayFabSessionCache::IsOwnPlayer(const FPlayFabId& RequestedPlayFabId, const TSharedPtr<UPlayFabAuthenticationContext>& AuthenticationContext) const
+{
+    // An empty id means the player the request is authenticated as, which is not the cached one when it carries another login
+    if (AuthenticationContext.IsValid() && AuthenticationContext->GetPlayFabId() != PlayFabId.ToString())
+    {
+        return false;
+    }
+    return RequestedPlayFabId.IsEmpty() || RequestedPlayFabId == PlayFabId;
+}
+
+void PlayFabSessionCache::CheckSession()
+{
+    // A login that did not go through PrepareLogin replaced the session ticket, the cached player may not be the current one anymore
+    const FString CurrentSessionTicket = PlayFabSettings::GetClientSessionTicket();
+    if (CurrentSessionTicket != SessionTicket)
+    {
+        InvalidateAll();
+        PlayFabId = FPlayFabId();
+        SessionTicket = CurrentSessionTicket;
+    }
+}
+
+PlayFabClientPtr PlayFabSessionCache::GetClientAPI() const
+{
+    return ClientAPI.IsValid() ? ClientAPI : IPlayFabModuleInterface::Get().GetClientAPI();
+}
+
+#endif // WITH_PLAYFAB_CLIENT_API
@@ -0,0 +1,294 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#if WITH_PLAYFAB_CLIENT_API
+#include "Core/PlayFabTimeSync.h"
+#include "Core/PlayFabClientAPI.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeRWLock.h"
+
+using namespace PlayFab;
+using namespace PlayFab::ClientModels;
+
+namespace
+{
+    // Samples the offset and drift are computed from
+    constexpr int32 MaxSamples = 8;
+    // The first samples come quickly so the estimate settles within seconds of login
+    constexpr int32 QuickSamples = 4;
+    constexpr double QuickSampleInterval = 2.0;
+    // A sample is an outlier when its round trip exceeds this many times the median, plus a margin for very fast links
+    constexpr double OutlierFactor = 2.0;
+    constexpr double OutlierMargin = 0.05;
+    // Drift is only fitted over this span at least, and never trusted beyond the bound
+    constexpr double MinDriftSpan = 120.0;
+    constexpr double MaxDrift = 500e-6;
+    // Error allowed for the drift estimate when reporting accuracy
+    constexpr double DriftUncertainty = 50e-6;
+    // Corrections are slewed in at this fraction of real time; forward jumps larger than StepThreshold are applied at once
+    constexpr double SlewRate = 0.1;
+    constexpr double StepThreshold = 1.0;
+
+    double ToUnixSeconds(const FDateTime& Time)
+    {
+        return (Time - FDateTime(1970, 1, 1)).GetTotalSeconds();
+    }
+
+    double LocalUnixSeconds()
+    {
+        return ToUnixSeconds(FDateTime::UtcNow());
+    }
+}
+
+PlayFabTimeSync& PlayFabTimeSync::Get()
+{
+    static PlayFabTimeSync Instance;
+    return Instance;
+}
+
+PlayFabTimeSync::PlayFabTimeSync()
+{
+}
+
+void PlayFabTimeSync::Start(float IntervalSeconds, PlayFabClientPtr InClientAPI)
+{
+    Interval = FMath::Max(IntervalSeconds, 1.0f);
+    if (InClientAPI.IsValid())
+    {
+        ClientAPI = InClientAPI;
+    }
+    NextSampleAt = 0.0;
+
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &PlayFabTimeSync::OnTick), 1.0f);
+    }
+    OnTick(0.0f);
+}
+
+void PlayFabTimeSync::Stop()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+}
+
+void PlayFabTimeSync::SampleNow()
+{
+    NextSampleAt = 0.0;
+    OnTick(0.0f);
+}
+
+bool PlayFabTimeSync::OnTick(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+    if (bSampleInFlight || Now < NextSampleAt)
+    {
+        return true;
+    }
+
+    if (!ClientAPI.IsValid())
+    {
+        ClientAPI = IPlayFabModuleInterface::Get().GetClientAPI();
+    }
+    // GetTime needs a session ticket; try again on the next tick
+    if (!ClientAPI.IsValid() || !ClientAPI->IsClientLoggedIn())
+    {
+        return true;
+    }
+
+    bSampleInFlight = true;
+    const FPlayFabRequestHandle Handle = ClientAPI->GetTime(
+        UPlayFabClientAPI::FGetTimeDelegate::CreateRaw(this, &PlayFabTimeSync::OnGetTime, FPlatformTime::Seconds()),
+        FPlayFabErrorDelegate::CreateRaw(this, &PlayFabTimeSync::OnGetTimeError));
+    if (!Handle)
+    {
+        // Not sent, so neither delegate will run
+        OnGetTimeError(FPlayFabCppError());
+    }
+    return true;
+}
+
+void PlayFabTimeSync::OnGetTime(const FGetTimeResult& result, double SentAt)
+{
+    const double Now = FPlatformTime::Seconds();
+    bSampleInFlight = false;
+
+    FSample Sample;
+    Sample.RoundTrip = Now - SentAt;
+    Sample.LocalSeconds = SentAt + Sample.RoundTrip * 0.5;
+    Sample.ServerSeconds = ToUnixSeconds(result.Time);
+
+    // The delegate runs on the next game thread tick, so the round trip includes up to a frame of latency. Outliers are the
+    // samples held up much longer than usual, by a retry, a hitch or a congested link. The median includes the rejected samples,
+    // so a lasting change in latency (another network, a move to mobile data) raises it and samples are accepted again.
+    bool bOutlier = false;
+    if (RecentRoundTrips.Num() >= 3)
+    {
+        TArray<double> RoundTrips = RecentRoundTrips;
+        RoundTrips.Sort();
+        const double Median = RoundTrips[RoundTrips.Num() / 2];
+        bOutlier = Sample.RoundTrip > Median * OutlierFactor + OutlierMargin;
+    }
+    if (RecentRoundTrips.Num() == MaxSamples)
+    {
+        RecentRoundTrips.RemoveAt(0);
+    }
+    RecentRoundTrips.Add(Sample.RoundTrip);
+
+    if (bOutlier)
+    {
+        FRWScopeLock ScopeLock(Lock, SLT_Write);
+        ++Rejected;
+    }
+    else
+    {
+        if (Recent.Num() == MaxSamples)
+        {
+            Recent.RemoveAt(0);
+        }
+        Recent.Add(Sample);
+        UpdateEstimate(Now);
+    }
+
+    NextSampleAt = Now + (Recent.Num() < QuickSamples ? FMath::Min<double>(QuickSampleInterval, Interval) : Interval);
+}
+
+void PlayFabTimeSync::OnGetTimeError(const FPlayFabCppError& error)
+{
+    bSampleInFlight = false;
+    NextSampleAt = FPlatformTime::Seconds() + Interval;
+
+    FRWScopeLock ScopeLock(Lock, SLT_Write);
+    ++Rejected;
+}
+
+void PlayFabTimeSync::UpdateEstimate(double Now)
+{
+    // The sample with the shortest round trip has the tightest bound on the offset
+    const FSample* Best = &Recent[0];
+    for (const FSample& Each : Recent)
+    {
+        if (Each.RoundTrip < Best->RoundTrip)
+        {
+            Best = &Each;
+        }
+    }
+
+    // Drift is the slope of the offset over local time, fitted by least squares once the samples span long enough
+    double NewDrift = 0.0;
+    if (Recent.Num() >= 3 && Recent.Last().LocalSeconds - Recent[0].LocalSeconds >= MinDriftSpan)
+    {
+        double MeanX = 0.0, MeanY = 0.0;
+        for (const FSample& Each : Recent)
+        {
+            MeanX += Each.LocalSeconds;
+            MeanY += Each.ServerSeconds - Each.LocalSeconds;
+        }
+        MeanX /= Recent.Num();
+        MeanY /= Recent.Num();
+
+        double Covariance = 0.0, Variance = 0.0;
+        for (const FSample& Each : Recent)
+        {
+            const double DX = Each.LocalSeconds - MeanX;
+            Covariance += DX * (Each.ServerSeconds - Each.LocalSeconds - MeanY);
+            Variance += DX * DX;
+        }
+        if (Variance > 0.0)
+        {
+            NewDrift = FMath::Clamp(Covariance / Variance, -MaxDrift, MaxDrift);
+        }
+    }
+
+    FRWScopeLock ScopeLock(Lock, SLT_Write);
+    const bool bWasSynced = bSynced;
+    const double Before = bWasSynced ? EstimateServerSeconds(Now) : 0.0;
+
+    BaseLocal = Best->LocalSeconds;
+    BaseServer = Best->ServerSeconds;
+    Drift = NewDrift;
+    BestRoundTrip = Best->RoundTrip;
+    LastSampleLocal = Recent.Last().LocalSeconds;
+    ++Accepted;
+    bSynced = true;
+    SlewFrom = 0.0;
+    SlewDuration = 0.0;
+
+    if (!bWasSynced)
+    {
+        // The first sample replaces the local clock; ordering is only kept from here on
+        LastReturnedMicros.store(0);
+        return;
+    }
+
+    // Keep the estimate continuous: carry the difference to the old estimate and fade it out
+    const double Correction = Before - EstimateServerSeconds(Now);
+    if (-Correction < StepThreshold)
+    {
+        SlewFrom = Correction;
+        SlewStart = Now;
+        SlewDuration = FMath::Abs(Correction) / SlewRate;
+    }
+}
+
+double PlayFabTimeSync::EstimateServerSeconds(double Now) const
+{
+    double Seconds = BaseServer + (Now - BaseLocal) * (1.0 + Drift);
+    if (SlewDuration > 0.0)
+    {
+        Seconds += SlewFrom * FMath::Max(0.0, 1.0 - (Now - SlewStart) / SlewDuration);
+    }
+    return Seconds;
+}
+
+bool PlayFabTimeSync::IsSynced() const
+{
+    FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+    return bSynced;
+}
+
+double PlayFabTimeSync::GetServerUnixTime() const
+{
+    double Seconds;
+    {
+        FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+        Seconds = bSynced ? EstimateServerSeconds(FPlatformTime::Seconds()) : LocalUnixSeconds();
+    }
+
+    // Slewing keeps the estimate continuous; this covers readers racing each other and a local clock set back before the first sample
+    int64 Micros = (int64)(Seconds * 1e6);
+    int64 Last = LastReturnedMicros.load();
+    while (Micros > Last && !LastReturnedMicros.compare_exchange_weak(Last, Micros))
+    {
+    }
+    return FMath::Max(Micros, Last) / 1e6;
+}
+
+FDateTime PlayFabTimeSync::GetServerTime() const
+{
+    const double Seconds = GetServerUnixTime();
+    return FDateTime(1970, 1, 1) + FTimespan((int64)(Seconds * ETimespan::TicksPerSecond));
+}
+
+PlayFabTimeSync::FStats PlayFabTimeSync::GetStats() const
+{
+    const double Now = FPlatformTime::Seconds();
+
+    FStats Stats;
+    FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+    Stats.Samples = Accepted;
+    Stats.Rejected = Rejected;
+    if (bSynced)
+    {
+        Stats.LastSampleAgeSeconds = Now - LastSampleLocal;
+        Stats.OffsetMs = (EstimateServerSeconds(Now) - LocalUnixSeconds()) * 1000.0;
+        Stats.RoundTripMs = BestRoundTrip * 1000.0;
+        Stats.AccuracyMs = (BestRoundTrip * 0.5 + (Now - BaseLocal) * DriftUncertainty) * 1000.0;
+        Stats.DriftPpm = Drift * 1e6;
+    }
+    return Stats;
+}
+
+#endif // WITH_PLAYFAB_CLIENT_API
@@ -7,24 +7,59 @@
 
 #include "PlayFabSettings.h"
 #include "PlayFabCommon.h"
+#include "Core/PlayFabConnectionWarmer.h"
+#include "CoreGlobals.h"
+#include "Misc/CoreDelegates.h"
 
 // Api's
+#if WITH_PLAYFAB_ADMIN_API
 #include "Core/PlayFabAdminAPI.h"
+#endif
+#if WITH_PLAYFAB_CLIENT_API
 #include "Core/PlayFabClientAPI.h"
+#endif
+#if WITH_PLAYFAB_SERVER_API
 #include "Core/PlayFabServerAPI.h"
+#endif
+#if WITH_PLAYFAB_AUTHENTICATION_API
 #include "Core/PlayFabAuthenticationAPI.h"
+#endif
+#if WITH_PLAYFAB_CLOUDSCRIPT_API
 #include "Core/PlayFabCloudScriptAPI.h"
+#endif
+#if WITH_PLAYFAB_DATA_API
 #include "Core/PlayFabDataAPI.h"
+#endif
+#if WITH_PLAYFAB_ECONOMY_API
 #include "Core/PlayFabEconomyAPI.h"
+#endif
+#if WITH_PLAYFAB_EVENTS_API
 #include "Core/PlayFabEventsAPI.h"
+#endif
+#if WITH_PLAYFAB_EXPERIMENTATION_API
 #include "Core/PlayFabExperimentationAPI.h"
+#endif
+#if WITH_PLAYFAB_INSIGHTS_API
 #include "Core/PlayFabInsightsAPI.h"
+#endif
+#if WITH_PLAYFAB_GROUPS_API
 #include "Core/PlayFabGroupsAPI.h"
+#endif
+#if WITH_PLAYFAB_PROGRESSION_API
 #include "Core/PlayFabProgressionAPI.h"
+#endif
+#if WITH_PLAYFAB_LOCALIZATION_API
 #include "Core/PlayFabLocalizationAPI.h"
+#endif
+#if WITH_PLAYFAB_MULTIPLAYER_API
 #include "Core/PlayFabMultiplayerAPI.h"
+#endif
+#if WITH_PLAYFAB_PROFILES_API
 #include "Core/PlayFabProfilesAPI.h"
+#endif
+#if WITH_PLAYFAB_ADDON_API
 #include "Core/PlayFabAddonAPI.h"
+#endif
 
 DEFINE_LOG_CATEGORY(LogPlayFabCpp);
 
@@ -51,6 +86,8 @@ class FPlayFabModule : public IPlayFabModuleInterface
     PlayFabProfilesPtr GetProfilesAPI() const override { return ProfilesAPI; };
     PlayFabAddonPtr GetAddonAPI() const override { return AddonAPI; };
 
+    FDelegateHandle PostEngineInitHandle;
+
     PlayFabAdminPtr AdminAPI;
     PlayFabClientPtr ClientAPI;
     PlayFabServerPtr ServerAPI;
@@ -77,29 +114,70 @@ void FPlayFabModule::StartupModule()
     PlayFab::PlayFabSettings::buildIdentifier = IPlayFabCommonModuleInterface::Get().GetBuildIdentifier();
     PlayFab::PlayFabSettings::versionString = IPlayFabCommonModuleInterface::Get().GetVersionString();
 
-    // create the API
-    
+    // create the API, for the families compiled in (see PlayFabCpp.Build.cs)
+#if WITH_PLAYFAB_ADMIN_API
     AdminAPI = MakeShareable(new PlayFab::UPlayFabAdminAPI());
+#endif
+#if WITH_PLAYFAB_CLIENT_API
     ClientAPI = MakeShareable(new PlayFab::UPlayFabClientAPI());
+#endif
+#if WITH_PLAYFAB_SERVER_API
     ServerAPI = MakeShareable(new PlayFab::UPlayFabServerAPI());
+#endif
+#if WITH_PLAYFAB_AUTHENTICATION_API
     AuthenticationAPI = MakeShareable(new PlayFab::UPlayFabAuthenticationAPI());
+#endif
+#if WITH_PLAYFAB_CLOUDSCRIPT_API
     CloudScriptAPI = MakeShareable(new PlayFab::UPlayFabCloudScriptAPI());
+#endif
+#if WITH_PLAYFAB_DATA_API
     DataAPI = MakeShareable(new PlayFab::UPlayFabDataAPI());
+#endif
+#if WITH_PLAYFAB_ECONOMY_API
     EconomyAPI = MakeShareable(new PlayFab::UPlayFabEconomyAPI());
+#endif
+#if WITH_PLAYFAB_EVENTS_API
     EventsAPI = MakeShareable(new PlayFab::UPlayFabEventsAPI());
+#endif
+#if WITH_PLAYFAB_EXPERIMENTATION_API
     ExperimentationAPI = MakeShareable(new PlayFab::UPlayFabExperimentationAPI());
+#endif
+#if WITH_PLAYFAB_INSIGHTS_API
     InsightsAPI = MakeShareable(new PlayFab::UPlayFabInsightsAPI());
+#endif
+#if WITH_PLAYFAB_GROUPS_API
     GroupsAPI = MakeShareable(new PlayFab::UPlayFabGroupsAPI());
+#endif
+#if WITH_PLAYFAB_PROGRESSION_API
     ProgressionAPI = MakeShareable(new PlayFab::UPlayFabProgressionAPI());
+#endif
+#if WITH_PLAYFAB_LOCALIZATION_API
     LocalizationAPI = MakeShareable(new PlayFab::UPlayFabLocalizationAPI());
+#endif
+#if WITH_PLAYFAB_MULTIPLAYER_API
     MultiplayerAPI = MakeShareable(new PlayFab::UPlayFabMultiplayerAPI());
+#endif
+#if WITH_PLAYFAB_PROFILES_API
     ProfilesAPI = MakeShareable(new PlayFab::UPlayFabProfilesAPI());
+#endif
+#if WITH_PLAYFAB_ADDON_API
     AddonAPI = MakeShareable(new PlayFab::UPlayFabAddonAPI());
+#endif
+
+    // The HTTP module and the PlayFab settings are ready after engine init, while the startup loading screen is still up,
+    // so the handshake happens behind it and the first login reuses the connection
+    if (!GIsEditor && !IsRunningCommandlet())
+    {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddLambda([]()
+        {
+            PlayFab::PlayFabConnectionWarmer::Warm();
+        });
+    }
 }
 
 void FPlayFabModule::ShutdownModule()
 {
-    
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
 }
 
 IMPLEMENT_MODULE(FPlayFabModule, PlayFabCpp)
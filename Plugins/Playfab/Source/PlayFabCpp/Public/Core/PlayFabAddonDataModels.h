@@ -17,7 +17,7 @@ namespace AddonModels
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
     {
         // Unique ID of the entity.
-        FString Id;
+        FPlayFabId Id;
 
         // [optional] Entity type. See https://docs.microsoft.com/gaming/playfab/features/data/entities/available-built-in-entity-types
         FString Type;
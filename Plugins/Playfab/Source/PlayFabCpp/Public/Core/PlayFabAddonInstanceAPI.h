@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabAddonDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "PlayFabAPISettings.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
@@ -81,59 +82,59 @@ namespace PlayFab
 
         // ------------ Generated API calls
         // Creates the Apple addon on a title, or updates it if it already exists.
-        bool CreateOrUpdateApple(AddonModels::FCreateOrUpdateAppleRequest& request, const FCreateOrUpdateAppleDelegate& SuccessDelegate = FCreateOrUpdateAppleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateOrUpdateApple(AddonModels::FCreateOrUpdateAppleRequest& request, const FCreateOrUpdateAppleDelegate& SuccessDelegate = FCreateOrUpdateAppleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Creates the Facebook addon on a title, or updates it if it already exists.
-        bool CreateOrUpdateFacebook(AddonModels::FCreateOrUpdateFacebookRequest& request, const FCreateOrUpdateFacebookDelegate& SuccessDelegate = FCreateOrUpdateFacebookDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateOrUpdateFacebook(AddonModels::FCreateOrUpdateFacebookRequest& request, const FCreateOrUpdateFacebookDelegate& SuccessDelegate = FCreateOrUpdateFacebookDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Creates the Facebook Instant Games addon on a title, or updates it if it already exists.
-        bool CreateOrUpdateFacebookInstantGames(AddonModels::FCreateOrUpdateFacebookInstantGamesRequest& request, const FCreateOrUpdateFacebookInstantGamesDelegate& SuccessDelegate = FCreateOrUpdateFacebookInstantGamesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateOrUpdateFacebookInstantGames(AddonModels::FCreateOrUpdateFacebookInstantGamesRequest& request, const FCreateOrUpdateFacebookInstantGamesDelegate& SuccessDelegate = FCreateOrUpdateFacebookInstantGamesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Creates the Google addon on a title, or updates it if it already exists.
-        bool CreateOrUpdateGoogle(AddonModels::FCreateOrUpdateGoogleRequest& request, const FCreateOrUpdateGoogleDelegate& SuccessDelegate = FCreateOrUpdateGoogleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateOrUpdateGoogle(AddonModels::FCreateOrUpdateGoogleRequest& request, const FCreateOrUpdateGoogleDelegate& SuccessDelegate = FCreateOrUpdateGoogleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Creates the Kongregate addon on a title, or updates it if it already exists.
-        bool CreateOrUpdateKongregate(AddonModels::FCreateOrUpdateKongregateRequest& request, const FCreateOrUpdateKongregateDelegate& SuccessDelegate = FCreateOrUpdateKongregateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateOrUpdateKongregate(AddonModels::FCreateOrUpdateKongregateRequest& request, const FCreateOrUpdateKongregateDelegate& SuccessDelegate = FCreateOrUpdateKongregateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Creates the Nintendo addon on a title, or updates it if it already exists.
-        bool CreateOrUpdateNintendo(AddonModels::FCreateOrUpdateNintendoRequest& request, const FCreateOrUpdateNintendoDelegate& SuccessDelegate = FCreateOrUpdateNintendoDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateOrUpdateNintendo(AddonModels::FCreateOrUpdateNintendoRequest& request, const FCreateOrUpdateNintendoDelegate& SuccessDelegate = FCreateOrUpdateNintendoDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Creates the PSN addon on a title, or updates it if it already exists.
-        bool CreateOrUpdatePSN(AddonModels::FCreateOrUpdatePSNRequest& request, const FCreateOrUpdatePSNDelegate& SuccessDelegate = FCreateOrUpdatePSNDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateOrUpdatePSN(AddonModels::FCreateOrUpdatePSNRequest& request, const FCreateOrUpdatePSNDelegate& SuccessDelegate = FCreateOrUpdatePSNDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Creates the Steam addon on a title, or updates it if it already exists.
-        bool CreateOrUpdateSteam(AddonModels::FCreateOrUpdateSteamRequest& request, const FCreateOrUpdateSteamDelegate& SuccessDelegate = FCreateOrUpdateSteamDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateOrUpdateSteam(AddonModels::FCreateOrUpdateSteamRequest& request, const FCreateOrUpdateSteamDelegate& SuccessDelegate = FCreateOrUpdateSteamDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Creates the Twitch addon on a title, or updates it if it already exists.
-        bool CreateOrUpdateTwitch(AddonModels::FCreateOrUpdateTwitchRequest& request, const FCreateOrUpdateTwitchDelegate& SuccessDelegate = FCreateOrUpdateTwitchDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateOrUpdateTwitch(AddonModels::FCreateOrUpdateTwitchRequest& request, const FCreateOrUpdateTwitchDelegate& SuccessDelegate = FCreateOrUpdateTwitchDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the Apple addon on a title.
-        bool DeleteApple(AddonModels::FDeleteAppleRequest& request, const FDeleteAppleDelegate& SuccessDelegate = FDeleteAppleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteApple(AddonModels::FDeleteAppleRequest& request, const FDeleteAppleDelegate& SuccessDelegate = FDeleteAppleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the Facebook addon on a title.
-        bool DeleteFacebook(AddonModels::FDeleteFacebookRequest& request, const FDeleteFacebookDelegate& SuccessDelegate = FDeleteFacebookDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteFacebook(AddonModels::FDeleteFacebookRequest& request, const FDeleteFacebookDelegate& SuccessDelegate = FDeleteFacebookDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the Facebook addon on a title.
-        bool DeleteFacebookInstantGames(AddonModels::FDeleteFacebookInstantGamesRequest& request, const FDeleteFacebookInstantGamesDelegate& SuccessDelegate = FDeleteFacebookInstantGamesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteFacebookInstantGames(AddonModels::FDeleteFacebookInstantGamesRequest& request, const FDeleteFacebookInstantGamesDelegate& SuccessDelegate = FDeleteFacebookInstantGamesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the Google addon on a title.
-        bool DeleteGoogle(AddonModels::FDeleteGoogleRequest& request, const FDeleteGoogleDelegate& SuccessDelegate = FDeleteGoogleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteGoogle(AddonModels::FDeleteGoogleRequest& request, const FDeleteGoogleDelegate& SuccessDelegate = FDeleteGoogleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the Kongregate addon on a title.
-        bool DeleteKongregate(AddonModels::FDeleteKongregateRequest& request, const FDeleteKongregateDelegate& SuccessDelegate = FDeleteKongregateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteKongregate(AddonModels::FDeleteKongregateRequest& request, const FDeleteKongregateDelegate& SuccessDelegate = FDeleteKongregateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the Nintendo addon on a title.
-        bool DeleteNintendo(AddonModels::FDeleteNintendoRequest& request, const FDeleteNintendoDelegate& SuccessDelegate = FDeleteNintendoDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteNintendo(AddonModels::FDeleteNintendoRequest& request, const FDeleteNintendoDelegate& SuccessDelegate = FDeleteNintendoDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the PSN addon on a title.
-        bool DeletePSN(AddonModels::FDeletePSNRequest& request, const FDeletePSNDelegate& SuccessDelegate = FDeletePSNDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeletePSN(AddonModels::FDeletePSNRequest& request, const FDeletePSNDelegate& SuccessDelegate = FDeletePSNDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the Steam addon on a title.
-        bool DeleteSteam(AddonModels::FDeleteSteamRequest& request, const FDeleteSteamDelegate& SuccessDelegate = FDeleteSteamDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteSteam(AddonModels::FDeleteSteamRequest& request, const FDeleteSteamDelegate& SuccessDelegate = FDeleteSteamDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the Twitch addon on a title.
-        bool DeleteTwitch(AddonModels::FDeleteTwitchRequest& request, const FDeleteTwitchDelegate& SuccessDelegate = FDeleteTwitchDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteTwitch(AddonModels::FDeleteTwitchRequest& request, const FDeleteTwitchDelegate& SuccessDelegate = FDeleteTwitchDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets information of the Apple addon on a title, omits secrets.
-        bool GetApple(AddonModels::FGetAppleRequest& request, const FGetAppleDelegate& SuccessDelegate = FGetAppleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetApple(AddonModels::FGetAppleRequest& request, const FGetAppleDelegate& SuccessDelegate = FGetAppleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets information of the Facebook addon on a title, omits secrets.
-        bool GetFacebook(AddonModels::FGetFacebookRequest& request, const FGetFacebookDelegate& SuccessDelegate = FGetFacebookDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetFacebook(AddonModels::FGetFacebookRequest& request, const FGetFacebookDelegate& SuccessDelegate = FGetFacebookDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets information of the Facebook Instant Games addon on a title, omits secrets.
-        bool GetFacebookInstantGames(AddonModels::FGetFacebookInstantGamesRequest& request, const FGetFacebookInstantGamesDelegate& SuccessDelegate = FGetFacebookInstantGamesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetFacebookInstantGames(AddonModels::FGetFacebookInstantGamesRequest& request, const FGetFacebookInstantGamesDelegate& SuccessDelegate = FGetFacebookInstantGamesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets information of the Google addon on a title, omits secrets.
-        bool GetGoogle(AddonModels::FGetGoogleRequest& request, const FGetGoogleDelegate& SuccessDelegate = FGetGoogleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetGoogle(AddonModels::FGetGoogleRequest& request, const FGetGoogleDelegate& SuccessDelegate = FGetGoogleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets information of the Kongregate addon on a title, omits secrets.
-        bool GetKongregate(AddonModels::FGetKongregateRequest& request, const FGetKongregateDelegate& SuccessDelegate = FGetKongregateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetKongregate(AddonModels::FGetKongregateRequest& request, const FGetKongregateDelegate& SuccessDelegate = FGetKongregateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets information of the Nintendo addon on a title, omits secrets.
-        bool GetNintendo(AddonModels::FGetNintendoRequest& request, const FGetNintendoDelegate& SuccessDelegate = FGetNintendoDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetNintendo(AddonModels::FGetNintendoRequest& request, const FGetNintendoDelegate& SuccessDelegate = FGetNintendoDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets information of the PSN addon on a title, omits secrets.
-        bool GetPSN(AddonModels::FGetPSNRequest& request, const FGetPSNDelegate& SuccessDelegate = FGetPSNDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetPSN(AddonModels::FGetPSNRequest& request, const FGetPSNDelegate& SuccessDelegate = FGetPSNDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets information of the Steam addon on a title, omits secrets.
-        bool GetSteam(AddonModels::FGetSteamRequest& request, const FGetSteamDelegate& SuccessDelegate = FGetSteamDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetSteam(AddonModels::FGetSteamRequest& request, const FGetSteamDelegate& SuccessDelegate = FGetSteamDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets information of the Twitch addon on a title, omits secrets.
-        bool GetTwitch(AddonModels::FGetTwitchRequest& request, const FGetTwitchDelegate& SuccessDelegate = FGetTwitchDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetTwitch(AddonModels::FGetTwitchRequest& request, const FGetTwitchDelegate& SuccessDelegate = FGetTwitchDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
@@ -865,7 +865,7 @@ namespace AdminModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique tag for player profile.
         FString TagName;
@@ -920,7 +920,7 @@ namespace AdminModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // PlayFab unique identifier of the user whose virtual currency balance is to be increased.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Name of the virtual currency which is to be incremented.
         FString VirtualCurrency;
@@ -1090,7 +1090,7 @@ namespace AdminModels
         FString IPAddress;
 
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] The reason why this ban was applied.
         FString Reason;
@@ -1170,7 +1170,7 @@ namespace AdminModels
         FString IPAddress;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] The reason for this ban. Maximum 140 characters.
         FString Reason;
@@ -4574,7 +4574,7 @@ namespace AdminModels
         FString MetaData;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FDeleteMasterPlayerAccountRequest() :
             FPlayFabCppRequestCommon(),
@@ -4627,7 +4627,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FDeleteMasterPlayerEventDataRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FDeleteMasterPlayerEventDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -4674,7 +4674,7 @@ namespace AdminModels
         FString MembershipId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Id of the subscription that should be deleted from the membership.
         FString SubscriptionId;
@@ -4753,7 +4753,7 @@ namespace AdminModels
         Boxed<int32> ExpectedPropertiesVersion;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // A list of property names denoting which properties should be deleted.
         TArray<FString> PropertyNames;
@@ -4783,7 +4783,7 @@ namespace AdminModels
         // [optional] The list of properties requested to be deleted.
         TArray<FDeletedPropertyDetails> DeletedProperties;
         // [optional] PlayFab unique identifier of the user whose properties were deleted.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * Indicates the current version of a player's properties that have been set. This is incremented after updates and
@@ -4814,7 +4814,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FDeletePlayerRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FDeletePlayerRequest() :
             FPlayFabCppRequestCommon(),
@@ -5125,7 +5125,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
     {
         // Unique ID of the entity.
-        FString Id;
+        FPlayFabId Id;
 
         // [optional] Entity type. See https://docs.microsoft.com/gaming/playfab/features/data/entities/available-built-in-entity-types
         FString Type;
@@ -5152,7 +5152,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FExportMasterPlayerDataRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FExportMasterPlayerDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -5701,7 +5701,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FGetPlayedTitleListRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayedTitleListRequest() :
             FPlayFabCppRequestCommon(),
@@ -5746,7 +5746,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FGetPlayerCustomPropertyRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Specific property name to search for in the player's properties.
         FString PropertyName;
@@ -5773,7 +5773,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FGetPlayerCustomPropertyResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] PlayFab unique identifier of the user whose properties are being returned.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * Indicates the current version of a player's properties that have been set. This is incremented after updates and
@@ -5834,7 +5834,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FGetPlayerIdFromAuthTokenResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] The player ID from the token passed in
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayerIdFromAuthTokenResult() :
             FPlayFabCppResultCommon(),
@@ -5946,7 +5946,7 @@ namespace AdminModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] If non-null, this determines which properties of the resulting player profiles to return. For API calls from the client,
@@ -6905,7 +6905,7 @@ namespace AdminModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayersSegmentsRequest() :
             FPlayFabCppRequestCommon(),
@@ -7087,7 +7087,7 @@ namespace AdminModels
         FString Namespace;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayerTagsRequest() :
             FPlayFabCppRequestCommon(),
@@ -7112,7 +7112,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FGetPlayerTagsResult : public PlayFab::FPlayFabCppResultCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Canonical tags (including namespace and tag's name) for the requested user
         TArray<FString> Tags;
@@ -7908,7 +7908,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FGetUserBansRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserBansRequest() :
             FPlayFabCppRequestCommon(),
@@ -7961,7 +7961,7 @@ namespace AdminModels
         // [optional] Specific keys to search for in the custom user data.
         TArray<FString> Keys;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -8038,7 +8038,7 @@ namespace AdminModels
         uint32 DataVersion;
 
         // [optional] PlayFab unique identifier of the user whose custom data is being returned.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserDataResult() :
             FPlayFabCppResultCommon(),
@@ -8065,7 +8065,7 @@ namespace AdminModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserInventoryRequest() :
             FPlayFabCppRequestCommon(),
@@ -8120,7 +8120,7 @@ namespace AdminModels
         FString ItemId;
 
         // [optional] Unique item identifier for this specific instance of the item.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // [optional] Timestamp for when this instance was purchased.
         Boxed<FDateTime> PurchaseDate;
@@ -8209,7 +8209,7 @@ namespace AdminModels
         // [optional] Array of inventory items belonging to the user.
         TArray<FItemInstance> Inventory;
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Array of virtual currency balance(s) belonging to the user.
         TMap<FString, int32> VirtualCurrency;
@@ -8253,7 +8253,7 @@ namespace AdminModels
         FString CatalogVersion;
 
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         /**
          * [optional] A set of custom key-value pairs on the instance of the inventory item, which is not to be confused with the catalog
@@ -8273,10 +8273,10 @@ namespace AdminModels
         FString ItemId;
 
         // [optional] Unique item identifier for this specific instance of the item.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Timestamp for when this instance was purchased.
         Boxed<FDateTime> PurchaseDate;
@@ -8337,7 +8337,7 @@ namespace AdminModels
         FString Annotation;
 
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         /**
          * [optional] Key-value pairs to be written to the custom data. Note that keys are trimmed of whitespace, are limited in size, and may
@@ -8353,7 +8353,7 @@ namespace AdminModels
          */
         TArray<FString> KeysToRemove;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FItemGrant() :
             FPlayFabCppBaseModel(),
@@ -8622,7 +8622,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FListPlayerCustomPropertiesRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FListPlayerCustomPropertiesRequest() :
             FPlayFabCppRequestCommon(),
@@ -8645,7 +8645,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FListPlayerCustomPropertiesResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] PlayFab unique identifier of the user whose properties are being returned.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Player specific properties and their corresponding values for this title.
         TArray<FCustomPropertyDetails> Properties;
@@ -8722,7 +8722,7 @@ namespace AdminModels
         FString Email;
 
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Title specific username to match against existing user accounts
         FString TitleDisplayName;
@@ -9405,7 +9405,7 @@ namespace AdminModels
         // [optional] OpenID Connect information, if any OpenID Connect accounts have been linked
         TArray<FUserOpenIdInfo> OpenIdInfo;
         // [optional] Unique identifier for the user account
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Personal information for the user which is considered more sensitive
         TSharedPtr<FUserPrivateAccountInfo> PrivateInfo;
@@ -9506,7 +9506,7 @@ namespace AdminModels
         int32 BalanceChange;
 
         // [optional] User currency was subtracted from.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Name of the virtual currency which was modified.
         FString VirtualCurrency;
@@ -9575,7 +9575,7 @@ namespace AdminModels
         FString OrderId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] The Reason parameter should correspond with the payment providers reason field, if they require one such as Facebook. In
@@ -9632,7 +9632,7 @@ namespace AdminModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique tag for player profile.
         FString TagName;
@@ -9701,12 +9701,12 @@ namespace AdminModels
     struct PLAYFABCPP_API FResetCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FResetCharacterStatisticsRequest() :
             FPlayFabCppRequestCommon(),
@@ -9801,7 +9801,7 @@ namespace AdminModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FResetUserStatisticsRequest() :
             FPlayFabCppRequestCommon(),
@@ -9864,7 +9864,7 @@ namespace AdminModels
         ResolutionOutcome Outcome;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] The Reason parameter should correspond with the payment providers reason field, if they require one such as Facebook. In
@@ -9920,7 +9920,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FRevokeAllBansForUserRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FRevokeAllBansForUserRequest() :
             FPlayFabCppRequestCommon(),
@@ -10009,13 +10009,13 @@ namespace AdminModels
     struct PLAYFABCPP_API FRevokeInventoryItem : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Unique PlayFab assigned instance identifier of the item
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FRevokeInventoryItem() :
             FPlayFabCppBaseModel(),
@@ -10040,13 +10040,13 @@ namespace AdminModels
     struct PLAYFABCPP_API FRevokeInventoryItemRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Unique PlayFab assigned instance identifier of the item
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FRevokeInventoryItemRequest() :
             FPlayFabCppRequestCommon(),
@@ -10270,7 +10270,7 @@ namespace AdminModels
         FString MembershipId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FSetMembershipOverrideRequest() :
             FPlayFabCppRequestCommon(),
@@ -10318,7 +10318,7 @@ namespace AdminModels
         FString PlayerSecret;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FSetPlayerSecretRequest() :
             FPlayFabCppRequestCommon(),
@@ -10672,7 +10672,7 @@ namespace AdminModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // PlayFab unique identifier of the user whose virtual currency balance is to be decreased.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Name of the virtual currency which is to be decremented.
         FString VirtualCurrency;
@@ -10852,7 +10852,7 @@ namespace AdminModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // [optional] PlayFab user ID of the developer initiating the request.
-        FString DeveloperPlayFabId;
+        FPlayFabId DeveloperPlayFabId;
 
         // List of Cloud Script files to upload to create the new revision. Must have at least one file.
         TArray<FCloudScriptFile> Files;
@@ -10992,7 +10992,7 @@ namespace AdminModels
         Boxed<int32> ExpectedPropertiesVersion;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Collection of properties to be set for a player.
         TArray<FUpdateProperty> Properties;
@@ -11020,7 +11020,7 @@ namespace AdminModels
     struct PLAYFABCPP_API FUpdatePlayerCustomPropertiesResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] PlayFab unique identifier of the user whose properties were updated.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * Indicates the current version of a player's properties that have been set. This is incremented after updates and
@@ -11439,7 +11439,7 @@ namespace AdminModels
         Boxed<UserDataPermission> Permission;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUpdateUserDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -11504,7 +11504,7 @@ namespace AdminModels
          */
         TArray<FString> KeysToRemove;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUpdateUserInternalDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -11535,7 +11535,7 @@ namespace AdminModels
         FString DisplayName;
 
         // PlayFab unique identifier of the user whose title specific display name is to be changed
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUpdateUserTitleDisplayNameRequest() :
             FPlayFabCppRequestCommon(),
@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabAuthenticationDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 
@@ -34,23 +35,23 @@ namespace PlayFab
          * Create a game_server entity token and return a new or existing game_server entity.
          * Create or return a game_server entity token. Caller must be a title entity.
          */
-        bool AuthenticateGameServerWithCustomId(AuthenticationModels::FAuthenticateCustomIdRequest& request, const FAuthenticateGameServerWithCustomIdDelegate& SuccessDelegate = FAuthenticateGameServerWithCustomIdDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle AuthenticateGameServerWithCustomId(AuthenticationModels::FAuthenticateCustomIdRequest& request, const FAuthenticateGameServerWithCustomIdDelegate& SuccessDelegate = FAuthenticateGameServerWithCustomIdDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Delete a game_server entity.
          * Delete a game_server entity. The caller can be the game_server entity attempting to delete itself. Or a title entity attempting to delete game_server entities for this title.
          */
-        bool Delete(AuthenticationModels::FDeleteRequest& request, const FDeleteDelegate& SuccessDelegate = FDeleteDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle Delete(AuthenticationModels::FDeleteRequest& request, const FDeleteDelegate& SuccessDelegate = FDeleteDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Method to exchange a legacy AuthenticationTicket or title SecretKey for an Entity Token or to refresh a still valid
          * Entity Token.
          * This API must be called with X-SecretKey, X-Authentication or X-EntityToken headers. An optional EntityKey may be included to attempt to set the resulting EntityToken to a specific entity, however the entity must be a relation of the caller, such as the master_player_account of a character. If sending X-EntityToken the account will be marked as freshly logged in and will issue a new token. If using X-Authentication or X-EntityToken the header must still be valid and cannot be expired or revoked.
          */
-        bool GetEntityToken(AuthenticationModels::FGetEntityTokenRequest& request, const FGetEntityTokenDelegate& SuccessDelegate = FGetEntityTokenDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetEntityToken(AuthenticationModels::FGetEntityTokenRequest& request, const FGetEntityTokenDelegate& SuccessDelegate = FGetEntityTokenDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Method for a server to validate a client provided EntityToken. Only callable by the title entity.
          * Given an entity token, validates that it hasn't expired or been revoked and will return details of the owner.
          */
-        bool ValidateEntityToken(AuthenticationModels::FValidateEntityTokenRequest& request, const FValidateEntityTokenDelegate& SuccessDelegate = FValidateEntityTokenDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ValidateEntityToken(AuthenticationModels::FValidateEntityTokenRequest& request, const FValidateEntityTokenDelegate& SuccessDelegate = FValidateEntityTokenDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
@@ -200,7 +200,7 @@ namespace ClientModels
         FString FriendEmail;
 
         // [optional] PlayFab identifier of the user to attempt to add to the local user's friend list.
-        FString FriendPlayFabId;
+        FPlayFabId FriendPlayFabId;
 
         // [optional] Title-specific display name of the user to attempt to add to the local user's friend list.
         FString FriendTitleDisplayName;
@@ -772,7 +772,7 @@ namespace ClientModels
         FString ItemId;
 
         // [optional] Unique instance identifier for this catalog item.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // [optional] Cost of the catalog item for each applicable real world currency.
         TMap<FString, uint32> RealCurrencyPrices;
@@ -1052,7 +1052,7 @@ namespace ClientModels
         FString ItemId;
 
         // [optional] Unique item identifier for this specific instance of the item.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // [optional] Timestamp for when this instance was purchased.
         Boxed<FDateTime> PurchaseDate;
@@ -1104,7 +1104,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FCharacterInventory : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] The id of this character.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The inventory of this character.
         TArray<FItemInstance> Inventory;
@@ -1130,7 +1130,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FCharacterLeaderboardEntry : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] PlayFab unique identifier of the character that belongs to the user for this leaderboard entry.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] Title-specific display name of the character for this leaderboard entry.
         FString CharacterName;
@@ -1142,7 +1142,7 @@ namespace ClientModels
         FString DisplayName;
 
         // [optional] PlayFab unique identifier of the user for this leaderboard entry.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // User's overall position in the leaderboard.
         int32 Position;
@@ -1177,7 +1177,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FCharacterResult : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] The id for this character on this player.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The name of this character.
         FString CharacterName;
@@ -1275,7 +1275,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FConsumeItemRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Number of uses to consume from the item.
         int32 ConsumeCount;
@@ -1283,7 +1283,7 @@ namespace ClientModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique instance identifier of the item to be consumed.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         FConsumeItemRequest() :
             FPlayFabCppRequestCommon(),
@@ -1309,7 +1309,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FConsumeItemResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique instance identifier of the item with uses consumed.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Number of uses remaining on the item.
         int32 RemainingUses;
@@ -2311,7 +2311,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
     {
         // Unique ID of the entity.
-        FString Id;
+        FPlayFabId Id;
 
         // [optional] Entity type. See https://docs.microsoft.com/gaming/playfab/features/data/entities/available-built-in-entity-types
         FString Type;
@@ -2576,7 +2576,7 @@ namespace ClientModels
         FString FacebookInstantGamesId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Facebook Instant Games identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FFacebookInstantGamesPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -2603,7 +2603,7 @@ namespace ClientModels
         FString FacebookId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Facebook identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FFacebookPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -3224,7 +3224,7 @@ namespace ClientModels
         TSharedPtr<FUserFacebookInfo> FacebookInfo;
 
         // [optional] PlayFab unique identifier for this friend.
-        FString FriendPlayFabId;
+        FPlayFabId FriendPlayFabId;
 
         /**
          * [optional] Available Game Center information (if the user and connected Game Center friend both have PlayFab Accounts in the same
@@ -3288,7 +3288,7 @@ namespace ClientModels
         FString GameCenterId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Game Center identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGameCenterPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -3315,7 +3315,7 @@ namespace ClientModels
         TSharedPtr<FGenericServiceId> GenericId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the given generic identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGenericPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -3345,7 +3345,7 @@ namespace ClientModels
          * [optional] Unique PlayFab identifier of the user whose info is being requested. Optional, defaults to the authenticated user if no
          * other lookup identifier set.
          */
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] Title-specific username for the account to find (if no Email is set). Note that if the non-unique Title Display Names
@@ -3875,7 +3875,7 @@ namespace ClientModels
         // [optional] OpenID Connect information, if any OpenID Connect accounts have been linked
         TArray<FUserOpenIdInfo> OpenIdInfo;
         // [optional] Unique identifier for the user account
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Personal information for the user which is considered more sensitive
         TSharedPtr<FUserPrivateAccountInfo> PrivateInfo;
@@ -4088,7 +4088,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FGetCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         /**
          * [optional] The version that currently exists according to the caller. The call will return the data for all of the keys if the
@@ -4099,7 +4099,7 @@ namespace ClientModels
         // [optional] Specific keys to search for in the custom user data.
         TArray<FString> Keys;
         // [optional] Unique PlayFab identifier of the user to load data for. Optional, defaults to yourself if not set.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetCharacterDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -4169,7 +4169,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FGetCharacterDataResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] User specific data for this title.
         TMap<FString, FUserDataRecord> Data;
@@ -4205,7 +4205,7 @@ namespace ClientModels
         FString CatalogVersion;
 
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
@@ -4267,7 +4267,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FGetCharacterInventoryResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique identifier of the character for this inventory.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] Array of inventory items belonging to the character.
         TArray<FItemInstance> Inventory;
@@ -4352,7 +4352,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FGetCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         FGetCharacterStatisticsRequest() :
             FPlayFabCppRequestCommon(),
@@ -4552,7 +4552,7 @@ namespace ClientModels
         Boxed<int32> MaxResultsCount;
 
         // [optional] PlayFab unique identifier of the user to center the leaderboard around. If null will center on the logged in user.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] If non-null, this determines which properties of the resulting player profiles to return. For API calls from the client,
@@ -4605,7 +4605,7 @@ namespace ClientModels
         FString DisplayName;
 
         // [optional] PlayFab unique identifier of the user for this leaderboard entry.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // User's overall position in the leaderboard.
         int32 Position;
@@ -4795,7 +4795,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FGetLeaderboardAroundCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character on which to center the leaderboard.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] Maximum number of entries to retrieve. Default 10, maximum 100.
         Boxed<int32> MaxResultsCount;
@@ -4853,7 +4853,7 @@ namespace ClientModels
         Boxed<int32> MaxResultsCount;
 
         // [optional] PlayFab unique identifier of the user to center the leaderboard around. If null will center on the logged in user.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] If non-null, this determines which properties of the resulting player profiles to return. For API calls from the client,
@@ -5232,7 +5232,7 @@ namespace ClientModels
         FGetPlayerCombinedInfoRequestParams InfoRequestParameters;
 
         // [optional] PlayFabId of the user whose data will be returned. If not filled included, we return the data for the calling player.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayerCombinedInfoRequest() :
             FPlayFabCppRequestCommon(),
@@ -5356,7 +5356,7 @@ namespace ClientModels
         TSharedPtr<FGetPlayerCombinedInfoResultPayload> InfoResultPayload;
 
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayerCombinedInfoResult() :
             FPlayFabCppResultCommon(),
@@ -5435,7 +5435,7 @@ namespace ClientModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] If non-null, this determines which properties of the resulting player profiles to return. For API calls from the client,
@@ -5741,7 +5741,7 @@ namespace ClientModels
         FString Namespace;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayerTagsRequest() :
             FPlayFabCppRequestCommon(),
@@ -5766,7 +5766,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FGetPlayerTagsResult : public PlayFab::FPlayFabCppResultCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Canonical tags (including namespace and tag's name) for the requested user
         TArray<FString> Tags;
@@ -6056,7 +6056,7 @@ namespace ClientModels
         FString GoogleId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Google identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGooglePlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -6130,7 +6130,7 @@ namespace ClientModels
         FString GooglePlayGamesPlayerId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Google Play Games identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGooglePlayGamesPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -6204,7 +6204,7 @@ namespace ClientModels
         FString KongregateId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Kongregate identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FKongregatePlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -6281,7 +6281,7 @@ namespace ClientModels
          * [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Nintendo Switch Service Account
          * identifier.
          */
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FNintendoServiceAccountPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -6355,7 +6355,7 @@ namespace ClientModels
         FString NintendoSwitchDeviceId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Nintendo Switch Device identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FNintendoSwitchPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -6433,7 +6433,7 @@ namespace ClientModels
          * [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the PlayStation :tm: Network
          * identifier.
          */
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique PlayStation :tm: Network identifier for a user.
         FString PSNAccountId;
@@ -6514,7 +6514,7 @@ namespace ClientModels
          * [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the PlayStation :tm: Network
          * identifier.
          */
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique PlayStation :tm: Network identifier for a user.
         FString PSNOnlineId;
@@ -6588,7 +6588,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FSteamPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Steam identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique Steam identifier for a user.
         FString SteamStringId;
@@ -6662,7 +6662,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FSteamNamePlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Steam identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique Steam identifier for a user, also known as Steam persona name.
         FString SteamName;
@@ -6736,7 +6736,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FTwitchPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Twitch identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique Twitch identifier for a user.
         FString TwitchId;
@@ -6814,7 +6814,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FXboxLiveAccountPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Xbox Live identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique Xbox Live identifier for a user.
         FString XboxLiveAccountId;
@@ -7500,7 +7500,7 @@ namespace ClientModels
          * [optional] Unique PlayFab identifier of the user to load data for. Optional, defaults to yourself if not set. When specified to a
          * PlayFab id of another player, then this will only return public keys for that account.
          */
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -7641,7 +7641,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FGrantCharacterToUserResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique identifier tagged to this character.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] Type of character that was created.
         FString CharacterType;
@@ -8615,7 +8615,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FListUsersCharactersRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FListUsersCharactersRequest() :
             FPlayFabCppRequestCommon(),
@@ -8758,7 +8758,7 @@ namespace ClientModels
         bool NewlyCreated;
 
         // [optional] Player's unique PlayFabId.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique token authorizing the user and game at the server level, for the current session.
         FString SessionTicket;
@@ -9803,7 +9803,7 @@ namespace ClientModels
         int32 BalanceChange;
 
         // [optional] User currency was subtracted from.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Name of the virtual currency which was modified.
         FString VirtualCurrency;
@@ -10047,7 +10047,7 @@ namespace ClientModels
         FString CatalogVersion;
 
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
@@ -10154,7 +10154,7 @@ namespace ClientModels
         FString CatalogVersion;
 
         // [optional] Optional identifier for the Character that should receive the item. If null, item is added to the player
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Generated coupon code to redeem.
         FString CouponCode;
@@ -10359,7 +10359,7 @@ namespace ClientModels
         TSharedPtr<FEntityTokenResponse> EntityToken;
 
         // [optional] PlayFab unique identifier for this newly created account.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique token identifying the user and game at the server level, for the current session.
         FString SessionTicket;
@@ -10436,7 +10436,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FRemoveFriendRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // PlayFab identifier of the friend account which is to be removed.
-        FString FriendPlayFabId;
+        FPlayFabId FriendPlayFabId;
 
         FRemoveFriendRequest() :
             FPlayFabCppRequestCommon(),
@@ -10855,7 +10855,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FSetFriendTagsRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // PlayFab identifier of the friend account to which the tag(s) should be applied.
-        FString FriendPlayFabId;
+        FPlayFabId FriendPlayFabId;
 
         // Array of tags to set on the friend account.
         TArray<FString> Tags;
@@ -11761,10 +11761,10 @@ namespace ClientModels
         FString CatalogVersion;
 
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // ItemInstanceId of the container to unlock.
-        FString ContainerItemInstanceId;
+        FPlayFabId ContainerItemInstanceId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
@@ -11772,7 +11772,7 @@ namespace ClientModels
          * [optional] ItemInstanceId of the key that will be consumed by unlocking this container. If the container requires a key, this
          * parameter is required.
          */
-        FString KeyItemInstanceId;
+        FPlayFabId KeyItemInstanceId;
 
         FUnlockContainerInstanceRequest() :
             FPlayFabCppRequestCommon(),
@@ -11805,7 +11805,7 @@ namespace ClientModels
         FString CatalogVersion;
 
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Catalog ItemId of the container type to unlock.
         FString ContainerItemId;
@@ -11838,10 +11838,10 @@ namespace ClientModels
         // [optional] Items granted to the player as a result of unlocking the container.
         TArray<FItemInstance> GrantedItems;
         // [optional] Unique instance identifier of the container unlocked.
-        FString UnlockedItemInstanceId;
+        FPlayFabId UnlockedItemInstanceId;
 
         // [optional] Unique instance identifier of the key used to unlock the container, if applicable.
-        FString UnlockedWithItemInstanceId;
+        FPlayFabId UnlockedWithItemInstanceId;
 
         // [optional] Virtual currency granted to the player as a result of unlocking the container.
         TMap<FString, uint32> VirtualCurrency;
@@ -11892,7 +11892,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FUpdateCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
@@ -11960,7 +11960,7 @@ namespace ClientModels
     struct PLAYFABCPP_API FUpdateCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] Statistics to be updated with the provided values, in the Key(string), Value(int) pattern.
         TMap<FString, int32> CharacterStatistics;
@@ -12564,7 +12564,7 @@ namespace ClientModels
         // [optional] Custom event properties. Each property consists of a name (string) and a value (JSON object).
         TMap<FString, FJsonKeeper> Body;
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
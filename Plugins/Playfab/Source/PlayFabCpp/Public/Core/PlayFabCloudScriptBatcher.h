@@ -0,0 +1,84 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlayFab.h"
+#include "Containers/Ticker.h"
+#include "Core/PlayFabCloudScriptAPI.h"
+#include "Core/PlayFabCloudScriptDataModels.h"
+#include "Core/PlayFabRequestHandle.h"
+#include "HAL/CriticalSection.h"
+
+namespace PlayFab
+{
+    /**
+    * Collects the ExecuteFunction calls made within a short window and sends them as one call to a dispatcher function,
+    * which runs them and returns every result in one reply. Each result goes back to the delegates of its own call.
+    *
+    * Usage:
+    *     TSharedRef<PlayFabCloudScriptBatcher> Batcher = MakeShared<PlayFabCloudScriptBatcher>(TEXT("BatchDispatch"));
+    *     Batcher->ExecuteFunction(request, SuccessDelegate, ErrorDelegate);     // same contract as UPlayFabCloudScriptAPI
+    *
+    * Dispatcher contract. The dispatcher receives as FunctionParameter
+    *     { "Calls": [ { "Id": 1, "FunctionName": "GrantReward", "FunctionParameter": { ... } }, ... ] }
+    * and returns as FunctionResult
+    *     { "Results": [ { "Id": 1, "FunctionName": "GrantReward", "FunctionResult": { ... }, "ExecutionTimeMilliseconds": 12, "Error": null }, ... ] }
+    * Every entry of Results has the shape of an ExecuteFunction result plus the Id of its call, in any order.
+    * An entry with Error set reaches the success delegate, exactly like an ExecuteFunction result would. A call missing from Results fails.
+    * With LocalApiServer set in playfab.local.settings.json the dispatcher runs on the local function host, like any other function.
+    * The automation test PlayFab.CloudScript.BatchContract checks the client half: the envelope written, and replies fanned out to the calls.
+    *
+    * Calls that set AuthenticationContext, Entity or GeneratePlayStreamEvent are sent on their own, and only calls with the same
+    * TimeoutSeconds share an envelope. Calls may be made from any thread; delegates run on the game thread, also for batches still
+    * in flight when the batcher is destroyed. The handle of a batched call is not cancellable.
+    */
+    class PLAYFABCPP_API PlayFabCloudScriptBatcher : public TSharedFromThis<PlayFabCloudScriptBatcher>
+    {
+    public:
+        struct FCall
+        {
+            int32 Id = 0;
+            CloudScriptModels::FExecuteFunctionRequest Request;
+            UPlayFabCloudScriptAPI::FExecuteFunctionDelegate SuccessDelegate;
+            FPlayFabErrorDelegate ErrorDelegate;
+        };
+
+        explicit PlayFabCloudScriptBatcher(const FString& InDispatcherFunction, PlayFabCloudScriptPtr InCloudScriptAPI = nullptr);
+        ~PlayFabCloudScriptBatcher();
+
+        // How long the first call of a batch waits for others
+        float WindowSeconds = 0.02f;
+        // A batch is sent as soon as it has this many calls
+        int32 MaxCallsPerBatch = 16;
+
+        FPlayFabRequestHandle ExecuteFunction(CloudScriptModels::FExecuteFunctionRequest& request, const UPlayFabCloudScriptAPI::FExecuteFunctionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+
+        // Sends the calls collected so far without waiting for the window to end
+        void Flush();
+
+        // Both halves of the dispatcher contract
+        static void WriteEnvelope(const TArray<FCall>& Calls, FJsonKeeper& OutFunctionParameter);
+        // False if the dispatcher reply is not a Results envelope. Entries without a valid Id are skipped.
+        static bool ReadResults(const FJsonKeeper& FunctionResult, TMap<int32, CloudScriptModels::FExecuteFunctionResult>& OutResults);
+        // Hands the dispatcher reply to the delegates of each call
+        static void OnBatchResult(const CloudScriptModels::FExecuteFunctionResult& result, TSharedRef<TArray<FCall> > Calls, FString DispatcherFunction);
+
+    private:
+        bool OnWindowElapsed(float DeltaTime);
+        void SendBatch(TSharedRef<TArray<FCall> > Calls, float TimeoutSeconds);
+        static void OnBatchError(const FPlayFabCppError& error, TSharedRef<TArray<FCall> > Calls);
+        PlayFabCloudScriptPtr GetCloudScriptAPI() const;
+
+        FString DispatcherFunction;
+        PlayFabCloudScriptPtr CloudScriptAPI;
+
+        FCriticalSection Lock; // Guards the members below
+        TArray<FCall> Pending;
+        int32 NextId = 1;
+        FTSTicker::FDelegateHandle WindowHandle;
+    };
+}
@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabCloudScriptDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "PlayFabAPISettings.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
@@ -73,48 +74,48 @@ namespace PlayFab
          * custom server-side functionality you can implement, and it can be used in conjunction with virtually anything.
          * Executes CloudScript with the entity profile that is defined in the request.
          */
-        bool ExecuteEntityCloudScript(CloudScriptModels::FExecuteEntityCloudScriptRequest& request, const FExecuteEntityCloudScriptDelegate& SuccessDelegate = FExecuteEntityCloudScriptDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ExecuteEntityCloudScript(CloudScriptModels::FExecuteEntityCloudScriptRequest& request, const FExecuteEntityCloudScriptDelegate& SuccessDelegate = FExecuteEntityCloudScriptDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Cloud Script is one of PlayFab's most versatile features. It allows client code to request execution of any kind of
          * custom server-side functionality you can implement, and it can be used in conjunction with virtually anything.
          * Executes an Azure Function with the profile of the entity that is defined in the request.
          */
-        bool ExecuteFunction(CloudScriptModels::FExecuteFunctionRequest& request, const FExecuteFunctionDelegate& SuccessDelegate = FExecuteFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ExecuteFunction(CloudScriptModels::FExecuteFunctionRequest& request, const FExecuteFunctionDelegate& SuccessDelegate = FExecuteFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets registered Azure Functions for a given title id and function name.
-        bool GetFunction(CloudScriptModels::FGetFunctionRequest& request, const FGetFunctionDelegate& SuccessDelegate = FGetFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetFunction(CloudScriptModels::FGetFunctionRequest& request, const FGetFunctionDelegate& SuccessDelegate = FGetFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Lists all currently registered Event Hub triggered Azure Functions for a given title.
-        bool ListEventHubFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListEventHubFunctionsDelegate& SuccessDelegate = FListEventHubFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListEventHubFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListEventHubFunctionsDelegate& SuccessDelegate = FListEventHubFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Lists all currently registered Azure Functions for a given title.
-        bool ListFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListFunctionsDelegate& SuccessDelegate = FListFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListFunctionsDelegate& SuccessDelegate = FListFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists all currently registered HTTP triggered Azure Functions for a given title.
          * A title can have many functions, ListHttpFunctions will return a list of all the currently registered HTTP triggered functions for a given title.
          */
-        bool ListHttpFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListHttpFunctionsDelegate& SuccessDelegate = FListHttpFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListHttpFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListHttpFunctionsDelegate& SuccessDelegate = FListHttpFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Lists all currently registered Queue triggered Azure Functions for a given title.
-        bool ListQueuedFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListQueuedFunctionsDelegate& SuccessDelegate = FListQueuedFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListQueuedFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListQueuedFunctionsDelegate& SuccessDelegate = FListQueuedFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Generate an entity PlayStream event for the provided function result.
-        bool PostFunctionResultForEntityTriggeredAction(CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest& request, const FPostFunctionResultForEntityTriggeredActionDelegate& SuccessDelegate = FPostFunctionResultForEntityTriggeredActionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle PostFunctionResultForEntityTriggeredAction(CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest& request, const FPostFunctionResultForEntityTriggeredActionDelegate& SuccessDelegate = FPostFunctionResultForEntityTriggeredActionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Generate an entity PlayStream event for the provided function result.
-        bool PostFunctionResultForFunctionExecution(CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest& request, const FPostFunctionResultForFunctionExecutionDelegate& SuccessDelegate = FPostFunctionResultForFunctionExecutionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle PostFunctionResultForFunctionExecution(CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest& request, const FPostFunctionResultForFunctionExecutionDelegate& SuccessDelegate = FPostFunctionResultForFunctionExecutionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Generate a player PlayStream event for the provided function result.
-        bool PostFunctionResultForPlayerTriggeredAction(CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest& request, const FPostFunctionResultForPlayerTriggeredActionDelegate& SuccessDelegate = FPostFunctionResultForPlayerTriggeredActionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle PostFunctionResultForPlayerTriggeredAction(CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest& request, const FPostFunctionResultForPlayerTriggeredActionDelegate& SuccessDelegate = FPostFunctionResultForPlayerTriggeredActionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Generate a PlayStream event for the provided function result.
-        bool PostFunctionResultForScheduledTask(CloudScriptModels::FPostFunctionResultForScheduledTaskRequest& request, const FPostFunctionResultForScheduledTaskDelegate& SuccessDelegate = FPostFunctionResultForScheduledTaskDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle PostFunctionResultForScheduledTask(CloudScriptModels::FPostFunctionResultForScheduledTaskRequest& request, const FPostFunctionResultForScheduledTaskDelegate& SuccessDelegate = FPostFunctionResultForScheduledTaskDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Registers an event hub triggered Azure Function with a title.
          * A title can have many functions, RegisterEventHubFunction associates a function name with an event hub name and connection string.
          */
-        bool RegisterEventHubFunction(CloudScriptModels::FRegisterEventHubFunctionRequest& request, const FRegisterEventHubFunctionDelegate& SuccessDelegate = FRegisterEventHubFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle RegisterEventHubFunction(CloudScriptModels::FRegisterEventHubFunctionRequest& request, const FRegisterEventHubFunctionDelegate& SuccessDelegate = FRegisterEventHubFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Registers an HTTP triggered Azure function with a title.
-        bool RegisterHttpFunction(CloudScriptModels::FRegisterHttpFunctionRequest& request, const FRegisterHttpFunctionDelegate& SuccessDelegate = FRegisterHttpFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle RegisterHttpFunction(CloudScriptModels::FRegisterHttpFunctionRequest& request, const FRegisterHttpFunctionDelegate& SuccessDelegate = FRegisterHttpFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Registers a queue triggered Azure Function with a title.
          * A title can have many functions, RegisterQueuedFunction associates a function name with a queue name and connection string.
          */
-        bool RegisterQueuedFunction(CloudScriptModels::FRegisterQueuedFunctionRequest& request, const FRegisterQueuedFunctionDelegate& SuccessDelegate = FRegisterQueuedFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle RegisterQueuedFunction(CloudScriptModels::FRegisterQueuedFunctionRequest& request, const FRegisterQueuedFunctionDelegate& SuccessDelegate = FRegisterQueuedFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Unregisters an Azure Function with a title.
-        bool UnregisterFunction(CloudScriptModels::FUnregisterFunctionRequest& request, const FUnregisterFunctionDelegate& SuccessDelegate = FUnregisterFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UnregisterFunction(CloudScriptModels::FUnregisterFunctionRequest& request, const FUnregisterFunctionDelegate& SuccessDelegate = FUnregisterFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
@@ -0,0 +1,29 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlayFabAPISettings.h"
+
+namespace PlayFab
+{
+    /**
+    * Opens the connection to the PlayFab API host ahead of the first call, so that call does not pay for DNS, TCP and TLS setup.
+    * In games the PlayFabCpp module warms the default host right after engine init, behind the startup loading screen.
+    * Sends one HEAD request to the host of GeneratePfUrl; the HTTP module keeps the connection for the calls that follow.
+    * The request goes straight to the HTTP module: it is not queued with the API calls, carries no credentials and is not
+    * counted by GetPendingCalls. Each host is warmed once per run. Turned off by PlayFab.PrewarmConnection 0.
+    */
+    class PLAYFABCPP_API PlayFabConnectionWarmer
+    {
+    public:
+        // Pass the settings of an instance API to warm its host instead of the default one. Any thread.
+        static void Warm(TSharedPtr<UPlayFabAPISettings> settings = nullptr);
+
+        // True once the warm-up request of the host has completed, successfully or not
+        static bool IsWarm(TSharedPtr<UPlayFabAPISettings> settings = nullptr);
+    };
+}
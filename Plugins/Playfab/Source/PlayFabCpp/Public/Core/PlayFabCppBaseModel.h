@@ -11,6 +11,7 @@
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonReader.h"
 #include "PlayFabAuthenticationContext.h"
+#include "PlayFabId.h"
 #include <Policies/CondensedJsonPrintPolicy.h>
 
 namespace PlayFab
@@ -48,11 +49,18 @@ namespace PlayFab
         virtual bool readFromValue(const TSharedPtr<FJsonValue>& value) { return false; };
 
         FString toJSONString() const;
+        // Also returns the PlayFabTrace id of the serialization, 0 when not tracing
+        FString toJSONString(uint64& OutTraceId) const;
     };
 
     struct PLAYFABCPP_API FPlayFabCppRequestCommon : FPlayFabCppBaseModel
     {
         TSharedPtr<UPlayFabAuthenticationContext> AuthenticationContext; // an optional authentication context (can used in multi-user scenarios)
+        float TimeoutSeconds = 0.0f; // an optional deadline for the call, queue time included (0 keeps the HTTP module timeout)
+        mutable uint64 TraceRequestId = 0; // PlayFabTrace id of the last body serialized, taken by PlayFabRequestHandler::ProcessRequest
+
+        // Serializes the body and keeps its trace id, so the HTTP request built from it carries the same id
+        FString toJSONString() const { return FPlayFabCppBaseModel::toJSONString(TraceRequestId); }
     };
 
     struct PLAYFABCPP_API FPlayFabCppResultCommon : FPlayFabCppBaseModel
@@ -68,6 +76,8 @@ namespace PlayFab
     {
     private:
         TSharedRef<class FJsonValue> JsonValue; // Reference so that any time this struct is avaiable, the JsonValue is aswell, even if a FJsonValueNull
+        struct FRawJson;
+        TSharedPtr<FRawJson> RawJson; // Set in raw mode: the serialized value and the DOM parsed from it on first use, shared between copies
 
     public:
         FJsonKeeper() : JsonValue(MakeShareable(new FJsonValueNull())) {}
@@ -87,29 +97,38 @@ namespace PlayFab
         FJsonKeeper(const double& val) : JsonValue(MakeShareable(new FJsonValueNumber(val))) {}
 
         bool notNull() const { return !isNull(); }
-        bool isNull() const { return JsonValue->IsNull(); }
-
-        FJsonKeeper& operator=(const TSharedPtr<class FJsonValue>& val) { JsonValue = val.ToSharedRef(); return *this; }
-        FJsonKeeper& operator=(const TSharedPtr<class FJsonObject>& val) { JsonValue = MakeShareable(new FJsonValueObject(val)); return *this; }
-        FJsonKeeper& operator=(const FString& val) { JsonValue = MakeShareable(new FJsonValueString(val)); return *this; }
-        FJsonKeeper& operator=(const bool& val) { JsonValue = MakeShareable(new FJsonValueBoolean(val)); return *this; }
-        FJsonKeeper& operator=(const int8& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
-        FJsonKeeper& operator=(const int16& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
-        FJsonKeeper& operator=(const int32& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
-        FJsonKeeper& operator=(const int64& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
-        FJsonKeeper& operator=(const uint8& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
-        FJsonKeeper& operator=(const uint16& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
-        FJsonKeeper& operator=(const uint32& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
-        FJsonKeeper& operator=(const uint64& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
-        FJsonKeeper& operator=(const float& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
-        FJsonKeeper& operator=(const double& val) { JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        bool isNull() const { return !RawJson.IsValid() && JsonValue->IsNull(); }
+
+        // Raw mode: the text must already be valid JSON. It is written to the request body as is, and only parsed if GetJsonValue is called.
+        // Empty text or "null" makes the keeper null.
+        void SetRawJson(const FString& InRawJson);
+        void SetRawJson(FUtf8StringView InRawJson);
+        bool IsRaw() const { return RawJson.IsValid(); }
+        // The serialized value; outside raw mode the DOM is serialized on every call
+        FString GetRawJson() const;
+
+        FJsonKeeper& operator=(const TSharedPtr<class FJsonValue>& val) { RawJson.Reset(); JsonValue = val.ToSharedRef(); return *this; }
+        FJsonKeeper& operator=(const TSharedPtr<class FJsonObject>& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueObject(val)); return *this; }
+        FJsonKeeper& operator=(const FString& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueString(val)); return *this; }
+        FJsonKeeper& operator=(const bool& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueBoolean(val)); return *this; }
+        FJsonKeeper& operator=(const int8& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        FJsonKeeper& operator=(const int16& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        FJsonKeeper& operator=(const int32& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        FJsonKeeper& operator=(const int64& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        FJsonKeeper& operator=(const uint8& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        FJsonKeeper& operator=(const uint16& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        FJsonKeeper& operator=(const uint32& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        FJsonKeeper& operator=(const uint64& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        FJsonKeeper& operator=(const float& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
+        FJsonKeeper& operator=(const double& val) { RawJson.Reset(); JsonValue = MakeShareable(new FJsonValueNumber(val)); return *this; }
 
         ~FJsonKeeper() {}
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<class FJsonObject>& obj) override;
         bool readFromValue(const TSharedPtr<class FJsonValue>& value) override;
 
-        TSharedPtr<class FJsonValue> GetJsonValue() const { return JsonValue; };
+        // Safe to call from any thread, copies in raw mode parse the shared text once
+        TSharedPtr<class FJsonValue> GetJsonValue() const;
     };
 
     void writeDatetime(FDateTime datetime, JsonWriter& writer);
@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabDataDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 
@@ -37,37 +38,37 @@ namespace PlayFab
          * Abort pending file uploads to an entity's profile.
          * Aborts the pending upload of the requested files.
          */
-        bool AbortFileUploads(DataModels::FAbortFileUploadsRequest& request, const FAbortFileUploadsDelegate& SuccessDelegate = FAbortFileUploadsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle AbortFileUploads(DataModels::FAbortFileUploadsRequest& request, const FAbortFileUploadsDelegate& SuccessDelegate = FAbortFileUploadsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Delete files on an entity's profile.
          * Deletes the requested files from the entity's profile.
          */
-        bool DeleteFiles(DataModels::FDeleteFilesRequest& request, const FDeleteFilesDelegate& SuccessDelegate = FDeleteFilesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteFiles(DataModels::FDeleteFilesRequest& request, const FDeleteFilesDelegate& SuccessDelegate = FDeleteFilesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Finalize file uploads to an entity's profile.
          * Finalizes the upload of the requested files. Verifies that the files have been successfully uploaded and moves the file pointers from pending to live.
          */
-        bool FinalizeFileUploads(DataModels::FFinalizeFileUploadsRequest& request, const FFinalizeFileUploadsDelegate& SuccessDelegate = FFinalizeFileUploadsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle FinalizeFileUploads(DataModels::FFinalizeFileUploadsRequest& request, const FFinalizeFileUploadsDelegate& SuccessDelegate = FFinalizeFileUploadsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Retrieves file metadata from an entity's profile.
          * Returns URLs that may be used to download the files for a profile for a limited length of time. Only returns files that have been successfully uploaded, files that are still pending will either return the old value, if it exists, or nothing.
          */
-        bool GetFiles(DataModels::FGetFilesRequest& request, const FGetFilesDelegate& SuccessDelegate = FGetFilesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetFiles(DataModels::FGetFilesRequest& request, const FGetFilesDelegate& SuccessDelegate = FGetFilesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Retrieves objects from an entity's profile.
          * Gets JSON objects from an entity profile and returns it. 
          */
-        bool GetObjects(DataModels::FGetObjectsRequest& request, const FGetObjectsDelegate& SuccessDelegate = FGetObjectsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetObjects(DataModels::FGetObjectsRequest& request, const FGetObjectsDelegate& SuccessDelegate = FGetObjectsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Initiates file uploads to an entity's profile.
          * Returns URLs that may be used to upload the files for a profile 5 minutes. After using the upload calls FinalizeFileUploads must be called to move the file status from pending to live.
          */
-        bool InitiateFileUploads(DataModels::FInitiateFileUploadsRequest& request, const FInitiateFileUploadsDelegate& SuccessDelegate = FInitiateFileUploadsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle InitiateFileUploads(DataModels::FInitiateFileUploadsRequest& request, const FInitiateFileUploadsDelegate& SuccessDelegate = FInitiateFileUploadsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Sets objects on an entity's profile.
          * Sets JSON objects on the requested entity profile. May include a version number to be used to perform optimistic concurrency operations during update. If the current version differs from the version in the request the request will be ignored. If no version is set on the request then the value will always be updated if the values differ. Using the version value does not guarantee a write though, ConcurrentEditError may still occur if multiple clients are attempting to update the same profile. 
          */
-        bool SetObjects(DataModels::FSetObjectsRequest& request, const FSetObjectsDelegate& SuccessDelegate = FSetObjectsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SetObjects(DataModels::FSetObjectsRequest& request, const FSetObjectsDelegate& SuccessDelegate = FSetObjectsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
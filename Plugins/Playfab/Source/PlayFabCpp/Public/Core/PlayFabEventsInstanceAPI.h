@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabEventsDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "PlayFabAPISettings.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
@@ -61,35 +62,35 @@ namespace PlayFab
 
         // ------------ Generated API calls
         // Creates a new telemetry key for the title.
-        bool CreateTelemetryKey(EventsModels::FCreateTelemetryKeyRequest& request, const FCreateTelemetryKeyDelegate& SuccessDelegate = FCreateTelemetryKeyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateTelemetryKey(EventsModels::FCreateTelemetryKeyRequest& request, const FCreateTelemetryKeyDelegate& SuccessDelegate = FCreateTelemetryKeyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
         // Deletes a telemetry key configured for the title.
-        bool DeleteTelemetryKey(EventsModels::FDeleteTelemetryKeyRequest& request, const FDeleteTelemetryKeyDelegate& SuccessDelegate = FDeleteTelemetryKeyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteTelemetryKey(EventsModels::FDeleteTelemetryKeyRequest& request, const FDeleteTelemetryKeyDelegate& SuccessDelegate = FDeleteTelemetryKeyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
         // Gets information about a telemetry key configured for the title.
-        bool GetTelemetryKey(EventsModels::FGetTelemetryKeyRequest& request, const FGetTelemetryKeyDelegate& SuccessDelegate = FGetTelemetryKeyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetTelemetryKey(EventsModels::FGetTelemetryKeyRequest& request, const FGetTelemetryKeyDelegate& SuccessDelegate = FGetTelemetryKeyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
         // Lists all telemetry keys configured for the title.
-        bool ListTelemetryKeys(EventsModels::FListTelemetryKeysRequest& request, const FListTelemetryKeysDelegate& SuccessDelegate = FListTelemetryKeysDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListTelemetryKeys(EventsModels::FListTelemetryKeysRequest& request, const FListTelemetryKeysDelegate& SuccessDelegate = FListTelemetryKeysDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
         // Sets a telemetry key to the active or deactivated state.
-        bool SetTelemetryKeyActive(EventsModels::FSetTelemetryKeyActiveRequest& request, const FSetTelemetryKeyActiveDelegate& SuccessDelegate = FSetTelemetryKeyActiveDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SetTelemetryKeyActive(EventsModels::FSetTelemetryKeyActiveRequest& request, const FSetTelemetryKeyActiveDelegate& SuccessDelegate = FSetTelemetryKeyActiveDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
         // Write batches of entity based events to PlayStream. The namespace of the Event must be 'custom' or start with 'custom.'.
-        bool WriteEvents(EventsModels::FWriteEventsRequest& request, const FWriteEventsDelegate& SuccessDelegate = FWriteEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle WriteEvents(EventsModels::FWriteEventsRequest& request, const FWriteEventsDelegate& SuccessDelegate = FWriteEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
         /**
          * Write batches of entity based events to as Telemetry events (bypass PlayStream). The namespace must be 'custom' or start
          * with 'custom.'
          * This API must be called with either X-EntityToken or X-TelemetryKey headers. If sending X-EntityToken the value must be a valid EntityToken for your title. If using X-TelemetryKey the value must be a Telemetry Key configured for your title set to 'Active'. If both are provided, X-TelemetryKey will be ignored.
          */
-        bool WriteTelemetryEvents(EventsModels::FWriteEventsRequest& request, const FWriteTelemetryEventsDelegate& SuccessDelegate = FWriteTelemetryEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle WriteTelemetryEvents(EventsModels::FWriteEventsRequest& request, const FWriteTelemetryEventsDelegate& SuccessDelegate = FWriteTelemetryEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
         /**
         * Write batches of entity based events to as Telemetry events (bypass PlayStream) using a Telemetry Key. The namespace must be 'custom' or start
         * with 'custom.'
         */
-        bool WriteTelemetryEvents(EventsModels::FWriteEventsRequest& request, FString telemetryKey, const FWriteTelemetryEventsDelegate& SuccessDelegate = FWriteTelemetryEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle WriteTelemetryEvents(EventsModels::FWriteEventsRequest& request, FString telemetryKey, const FWriteTelemetryEventsDelegate& SuccessDelegate = FWriteTelemetryEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabExperimentationDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 
@@ -40,31 +41,31 @@ namespace PlayFab
 
         // ------------ Generated API calls
         // Creates a new experiment exclusion group for a title.
-        bool CreateExclusionGroup(ExperimentationModels::FCreateExclusionGroupRequest& request, const FCreateExclusionGroupDelegate& SuccessDelegate = FCreateExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateExclusionGroup(ExperimentationModels::FCreateExclusionGroupRequest& request, const FCreateExclusionGroupDelegate& SuccessDelegate = FCreateExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Creates a new experiment for a title.
-        bool CreateExperiment(ExperimentationModels::FCreateExperimentRequest& request, const FCreateExperimentDelegate& SuccessDelegate = FCreateExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateExperiment(ExperimentationModels::FCreateExperimentRequest& request, const FCreateExperimentDelegate& SuccessDelegate = FCreateExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes an existing exclusion group for a title.
-        bool DeleteExclusionGroup(ExperimentationModels::FDeleteExclusionGroupRequest& request, const FDeleteExclusionGroupDelegate& SuccessDelegate = FDeleteExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteExclusionGroup(ExperimentationModels::FDeleteExclusionGroupRequest& request, const FDeleteExclusionGroupDelegate& SuccessDelegate = FDeleteExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes an existing experiment for a title.
-        bool DeleteExperiment(ExperimentationModels::FDeleteExperimentRequest& request, const FDeleteExperimentDelegate& SuccessDelegate = FDeleteExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteExperiment(ExperimentationModels::FDeleteExperimentRequest& request, const FDeleteExperimentDelegate& SuccessDelegate = FDeleteExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets the details of all exclusion groups for a title.
-        bool GetExclusionGroups(ExperimentationModels::FGetExclusionGroupsRequest& request, const FGetExclusionGroupsDelegate& SuccessDelegate = FGetExclusionGroupsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetExclusionGroups(ExperimentationModels::FGetExclusionGroupsRequest& request, const FGetExclusionGroupsDelegate& SuccessDelegate = FGetExclusionGroupsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets the details of all exclusion groups for a title.
-        bool GetExclusionGroupTraffic(ExperimentationModels::FGetExclusionGroupTrafficRequest& request, const FGetExclusionGroupTrafficDelegate& SuccessDelegate = FGetExclusionGroupTrafficDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetExclusionGroupTraffic(ExperimentationModels::FGetExclusionGroupTrafficRequest& request, const FGetExclusionGroupTrafficDelegate& SuccessDelegate = FGetExclusionGroupTrafficDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets the details of all experiments for a title.
-        bool GetExperiments(ExperimentationModels::FGetExperimentsRequest& request, const FGetExperimentsDelegate& SuccessDelegate = FGetExperimentsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetExperiments(ExperimentationModels::FGetExperimentsRequest& request, const FGetExperimentsDelegate& SuccessDelegate = FGetExperimentsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets the latest scorecard of the experiment for the title.
-        bool GetLatestScorecard(ExperimentationModels::FGetLatestScorecardRequest& request, const FGetLatestScorecardDelegate& SuccessDelegate = FGetLatestScorecardDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetLatestScorecard(ExperimentationModels::FGetLatestScorecardRequest& request, const FGetLatestScorecardDelegate& SuccessDelegate = FGetLatestScorecardDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets the treatment assignments for a player for every running experiment in the title.
-        bool GetTreatmentAssignment(ExperimentationModels::FGetTreatmentAssignmentRequest& request, const FGetTreatmentAssignmentDelegate& SuccessDelegate = FGetTreatmentAssignmentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetTreatmentAssignment(ExperimentationModels::FGetTreatmentAssignmentRequest& request, const FGetTreatmentAssignmentDelegate& SuccessDelegate = FGetTreatmentAssignmentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Starts an existing experiment for a title.
-        bool StartExperiment(ExperimentationModels::FStartExperimentRequest& request, const FStartExperimentDelegate& SuccessDelegate = FStartExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle StartExperiment(ExperimentationModels::FStartExperimentRequest& request, const FStartExperimentDelegate& SuccessDelegate = FStartExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Stops an existing experiment for a title.
-        bool StopExperiment(ExperimentationModels::FStopExperimentRequest& request, const FStopExperimentDelegate& SuccessDelegate = FStopExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle StopExperiment(ExperimentationModels::FStopExperimentRequest& request, const FStopExperimentDelegate& SuccessDelegate = FStopExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Updates an existing exclusion group for a title.
-        bool UpdateExclusionGroup(ExperimentationModels::FUpdateExclusionGroupRequest& request, const FUpdateExclusionGroupDelegate& SuccessDelegate = FUpdateExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateExclusionGroup(ExperimentationModels::FUpdateExclusionGroupRequest& request, const FUpdateExclusionGroupDelegate& SuccessDelegate = FUpdateExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Updates an existing experiment for a title.
-        bool UpdateExperiment(ExperimentationModels::FUpdateExperimentRequest& request, const FUpdateExperimentDelegate& SuccessDelegate = FUpdateExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateExperiment(ExperimentationModels::FUpdateExperimentRequest& request, const FUpdateExperimentDelegate& SuccessDelegate = FUpdateExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
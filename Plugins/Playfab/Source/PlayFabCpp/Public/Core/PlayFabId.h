@@ -0,0 +1,55 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PlayFab
+{
+    /**
+    * Compact value type for PlayFab identifiers: PlayFabId, character and item instance ids, EntityKey.Id.
+    * The usual form, 16 upper-case hex digits, is packed into a 64-bit integer. Any other text is interned once and referenced by index.
+    * Comparing and hashing are integer operations, and copies never allocate. Ids are case-sensitive.
+    * Interned text is kept until ResetInternTable, so the intern table grows with every distinct non-hex id seen until then.
+    * Ids issued by PlayFab are mostly hex and never interned; avoid building ids from unbounded user input.
+    */
+    class PLAYFABCPP_API FPlayFabId
+    {
+    public:
+        FPlayFabId() : Value(0), Kind(EKind::Empty) {}
+        // Implicit, so models keep accepting plain strings
+        FPlayFabId(const FString& Id);
+        FPlayFabId(const TCHAR* Id) : FPlayFabId(FString(Id)) {}
+
+        bool IsEmpty() const { return Kind == EKind::Empty; }
+        // Exactly the text the id was made from
+        FString ToString() const;
+
+        bool operator==(const FPlayFabId& Other) const { return Value == Other.Value && Kind == Other.Kind; }
+        bool operator!=(const FPlayFabId& Other) const { return !(*this == Other); }
+
+        // Forgets every interned id, e.g. on logout. Ids interned before keep comparing equal to each other, but never to ids made
+        // afterwards, and their ToString is empty; only call it once the ids of the previous session are no longer needed.
+        static void ResetInternTable();
+        static int32 GetInternedCount();
+
+        friend uint32 GetTypeHash(const FPlayFabId& Id)
+        {
+            return HashCombineFast(::GetTypeHash(Id.Value), (uint32)Id.Kind);
+        }
+
+    private:
+        enum class EKind : uint8
+        {
+            Empty,
+            Hex,      // Value holds the 16 hex digits
+            Interned  // Value holds the generation, shard and index of the text in the intern table
+        };
+
+        uint64 Value;
+        EKind Kind;
+    };
+}
@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabInsightsDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "PlayFabAPISettings.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
@@ -63,20 +64,20 @@ namespace PlayFab
          * Gets the current values for the Insights performance and data storage retention, list of pending operations, and the
          * performance and data storage retention limits.
          */
-        bool GetDetails(InsightsModels::FInsightsEmptyRequest& request, const FGetDetailsDelegate& SuccessDelegate = FGetDetailsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetDetails(InsightsModels::FInsightsEmptyRequest& request, const FGetDetailsDelegate& SuccessDelegate = FGetDetailsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Retrieves the range of allowed values for performance and data storage retention values as well as the submeter details
          * for each performance level.
          */
-        bool GetLimits(InsightsModels::FInsightsEmptyRequest& request, const FGetLimitsDelegate& SuccessDelegate = FGetLimitsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetLimits(InsightsModels::FInsightsEmptyRequest& request, const FGetLimitsDelegate& SuccessDelegate = FGetLimitsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets the status of a SetPerformance or SetStorageRetention operation.
-        bool GetOperationStatus(InsightsModels::FInsightsGetOperationStatusRequest& request, const FGetOperationStatusDelegate& SuccessDelegate = FGetOperationStatusDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetOperationStatus(InsightsModels::FInsightsGetOperationStatusRequest& request, const FGetOperationStatusDelegate& SuccessDelegate = FGetOperationStatusDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets a list of pending SetPerformance and/or SetStorageRetention operations for the title.
-        bool GetPendingOperations(InsightsModels::FInsightsGetPendingOperationsRequest& request, const FGetPendingOperationsDelegate& SuccessDelegate = FGetPendingOperationsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetPendingOperations(InsightsModels::FInsightsGetPendingOperationsRequest& request, const FGetPendingOperationsDelegate& SuccessDelegate = FGetPendingOperationsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Sets the Insights performance level value for the title.
-        bool SetPerformance(InsightsModels::FInsightsSetPerformanceRequest& request, const FSetPerformanceDelegate& SuccessDelegate = FSetPerformanceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SetPerformance(InsightsModels::FInsightsSetPerformanceRequest& request, const FSetPerformanceDelegate& SuccessDelegate = FSetPerformanceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Sets the Insights data storage retention days value for the title.
-        bool SetStorageRetention(InsightsModels::FInsightsSetStorageRetentionRequest& request, const FSetStorageRetentionDelegate& SuccessDelegate = FSetStorageRetentionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SetStorageRetention(InsightsModels::FInsightsSetStorageRetentionRequest& request, const FSetStorageRetentionDelegate& SuccessDelegate = FSetStorageRetentionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
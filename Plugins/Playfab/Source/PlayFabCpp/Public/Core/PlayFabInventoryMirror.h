@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlayFab.h"
+#include "Core/PlayFabEconomyAPI.h"
+#include "Core/PlayFabEconomyDataModels.h"
+#include "Core/PlayFabRequestHandle.h"
+
+namespace PlayFab
+{
+    /**
+    * Local copy of the Economy v2 inventory collections of one entity, kept current without downloading them again after every write.
+    *
+    * Usage:
+    *     TSharedRef<PlayFabInventoryMirror> Inventory = MakeShared<PlayFabInventoryMirror>();
+    *     Inventory->Refresh(TEXT("default"), OnRefreshed, OnError);     // full download, once
+    *     Inventory->AddInventoryItems(request, SuccessDelegate, ErrorDelegate);
+    *     const EconomyModels::FInventoryItem* Item = Inventory->FindItem(TEXT("default"), ItemId);
+    *
+    * Writes go through the same calls as UPlayFabEconomyAPI. When one succeeds, its operations are applied to the local copy and the
+    * returned ETag and transaction ids are stored. A write without an ETag is sent as is and applied optimistically: ETags are opaque, so a
+    * change made elsewhere in the meantime only shows up at the next refresh, or as a conflict on a write that carries the local ETag
+    * (set by the caller, or by bSendLocalETag). The collection is downloaded again after a conflict, after a write carrying another ETag
+    * than the local one, after writes that overlap each other or a refresh, or when an operation cannot be applied locally
+    * (an alternate id, a purchase without PriceAmounts, a stack that is not in the copy).
+    * Items added to a new stack take their Type from another stack of the same item; it stays empty until the next refresh otherwise.
+    * Game thread only.
+    */
+    class PLAYFABCPP_API PlayFabInventoryMirror : public TSharedFromThis<PlayFabInventoryMirror>
+    {
+    public:
+        DECLARE_DELEGATE_OneParam(FCollectionDelegate, const FString& /*CollectionId*/);
+
+        explicit PlayFabInventoryMirror(PlayFabEconomyPtr InEconomyAPI = nullptr);
+
+        // Entity the collections belong to. Empty for the entity of the logged in player.
+        TSharedPtr<EconomyModels::FEntityKey> Entity;
+
+        // Runs whenever the local copy of a collection changed, after a write or a refresh
+        FCollectionDelegate OnCollectionChanged;
+
+        // Sends writes that leave ETag empty with the ETag of the local copy, so a change made elsewhere fails them with a conflict and
+        // the collection is downloaded again. Off by default, since it turns an unconditional write into a conditional one.
+        bool bSendLocalETag = false;
+
+        // Downloads every page of a collection and replaces the local copy
+        FPlayFabRequestHandle Refresh(const FString& CollectionId, const FCollectionDelegate& SuccessDelegate = FCollectionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool IsMirrored(const FString& CollectionId) const;
+        void Forget(const FString& CollectionId);
+
+        // Same contract as the UPlayFabEconomyAPI functions of the same name
+        FPlayFabRequestHandle AddInventoryItems(EconomyModels::FAddInventoryItemsRequest& request, const UPlayFabEconomyAPI::FAddInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SubtractInventoryItems(EconomyModels::FSubtractInventoryItemsRequest& request, const UPlayFabEconomyAPI::FSubtractInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateInventoryItems(EconomyModels::FUpdateInventoryItemsRequest& request, const UPlayFabEconomyAPI::FUpdateInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteInventoryItems(EconomyModels::FDeleteInventoryItemsRequest& request, const UPlayFabEconomyAPI::FDeleteInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle PurchaseInventoryItems(EconomyModels::FPurchaseInventoryItemsRequest& request, const UPlayFabEconomyAPI::FPurchaseInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ExecuteInventoryOperations(EconomyModels::FExecuteInventoryOperationsRequest& request, const UPlayFabEconomyAPI::FExecuteInventoryOperationsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+
+        // Lookups on the local copy. An empty StackId means the default stack.
+        const EconomyModels::FInventoryItem* FindItem(const FString& CollectionId, const FString& ItemId, const FString& StackId = FString()) const;
+        TArray<const EconomyModels::FInventoryItem*> FindStacks(const FString& CollectionId, const FString& ItemId) const;
+        int32 GetTotalAmount(const FString& CollectionId, const FString& ItemId) const;
+        TArray<EconomyModels::FInventoryItem> GetItems(const FString& CollectionId) const;
+        FString GetETag(const FString& CollectionId) const;
+        // Transaction ids of the writes applied since the last refresh, oldest first
+        TArray<FString> GetTransactionIds(const FString& CollectionId) const;
+
+        // Number of writes applied locally / collections downloaded again because of a conflict
+        int32 GetAppliedCount() const { return Applied; }
+        int32 GetRefetchCount() const { return Refetches; }
+
+    private:
+        struct FCollection
+        {
+            // Item id -> stack id -> item
+            TMap<FString, TMap<FString, EconomyModels::FInventoryItem> > Items;
+            FString ETag;
+            TArray<FString> TransactionIds;
+            bool bLoaded = false;
+            bool bRefreshing = false;
+            // Writes in flight, and whether one of them could not be applied to the local copy
+            int32 PendingWrites = 0;
+            bool bUnappliedWrite = false;
+        };
+
+        template <typename ResponseType, typename RequestType, typename DelegateType>
+        FPlayFabRequestHandle Write(RequestType& request, TArray<EconomyModels::FInventoryOperation> Operations,
+            FPlayFabRequestHandle (UPlayFabEconomyAPI::*Call)(RequestType&, const DelegateType&, const FPlayFabErrorDelegate&),
+            const DelegateType& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+        {
+            if (!request.Entity.IsValid())
+            {
+                request.Entity = Entity;
+            }
+            const FString CollectionId = NormalizeCollectionId(request.CollectionId);
+            const bool bApplicable = BeginWrite(CollectionId, request.ETag);
+            return (GetEconomyAPI().Get()->*Call)(request,
+                DelegateType::CreateSP(this, &PlayFabInventoryMirror::OnWriteResult<ResponseType, DelegateType>, SuccessDelegate, CollectionId, MoveTemp(Operations), bApplicable),
+                FPlayFabErrorDelegate::CreateSP(this, &PlayFabInventoryMirror::OnWriteError, ErrorDelegate, CollectionId));
+        }
+
+        template <typename ResponseType, typename DelegateType>
+        void OnWriteResult(const ResponseType& result, DelegateType SuccessDelegate, FString CollectionId, TArray<EconomyModels::FInventoryOperation> Operations, bool bApplicable)
+        {
+            EndWrite(CollectionId, Operations, result.ETag, result.TransactionIds, bApplicable);
+            SuccessDelegate.ExecuteIfBound(result);
+        }
+
+        void OnWriteError(const FPlayFabCppError& error, FPlayFabErrorDelegate ErrorDelegate, FString CollectionId);
+        void OnRefreshPage(const EconomyModels::FGetInventoryItemsResponse& result, FString CollectionId, TSharedRef<TArray<EconomyModels::FInventoryItem> > Loaded, FCollectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate);
+        void OnRefreshError(const FPlayFabCppError& error, FString CollectionId, FPlayFabErrorDelegate ErrorDelegate);
+        FPlayFabRequestHandle RequestPage(const FString& CollectionId, const FString& ContinuationToken, TSharedRef<TArray<EconomyModels::FInventoryItem> > Loaded, const FCollectionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate);
+
+        // Fills in the local ETag when the request has none and bSendLocalETag is set; returns whether the outcome can be applied to the local copy
+        bool BeginWrite(const FString& CollectionId, FString& RequestETag);
+        void EndWrite(const FString& CollectionId, const TArray<EconomyModels::FInventoryOperation>& Operations, const FString& ETag, const TArray<FString>& TransactionIds, bool bApplicable);
+        bool ApplyOperation(FCollection& Collection, const EconomyModels::FInventoryOperation& Operation) const;
+        void Refetch(const FString& CollectionId);
+
+        static FString NormalizeCollectionId(const FString& CollectionId);
+        static FString NormalizeStackId(const FString& StackId);
+        PlayFabEconomyPtr GetEconomyAPI() const;
+
+        PlayFabEconomyPtr EconomyAPI;
+        TMap<FString, FCollection> Collections;
+        int32 Applied = 0;
+        int32 Refetches = 0;
+    };
+}
@@ -6,9 +6,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
-
-class FJsonObject;
-class FJsonValue;
+#include "Async/ParallelFor.h"
+#include "Dom/JsonValue.h"
 
 namespace PlayFab
 {
@@ -18,6 +17,46 @@ namespace PlayFab
 
         // Returns the array named Key or nullptr if it is missing or the wrong type
         static const TArray< TSharedPtr<class FJsonValue> >& ReadArray(TSharedPtr<class FJsonObject> Item, const FString& Key);
+
+        // Decodes the objects of a JSON array and appends them to OutItems, in array order.
+        // Arrays with at least PlayFab.ParallelDecodeThreshold elements are decoded in chunks with ParallelFor; the result is the same as the serial path.
+        template <typename ItemType>
+        static void ReadObjectArray(const TArray< TSharedPtr<class FJsonValue> >& Array, TArray<ItemType>& OutItems)
+        {
+            ReadObjectArray(Array, OutItems, GetParallelDecodeThreshold());
+        }
+
+        template <typename ItemType>
+        static void ReadObjectArray(const TArray< TSharedPtr<class FJsonValue> >& Array, TArray<ItemType>& OutItems, int32 Threshold)
+        {
+            const int32 Count = Array.Num();
+            if (Threshold <= 0 || Count < Threshold)
+            {
+                OutItems.Reserve(OutItems.Num() + Count);
+                for (const TSharedPtr<FJsonValue>& Item : Array)
+                {
+                    OutItems.Emplace(Item->AsObject());
+                }
+                return;
+            }
+
+            // Every element has its own slot, so the chunks never touch the same memory
+            const int32 First = OutItems.Num();
+            OutItems.SetNum(First + Count);
+            ItemType* Out = OutItems.GetData() + First;
+            const int32 NumChunks = FMath::DivideAndRoundUp(Count, ParallelDecodeChunkSize);
+            ParallelFor(NumChunks, [&Array, Out, Count](int32 Chunk)
+            {
+                const int32 End = FMath::Min(Count, (Chunk + 1) * ParallelDecodeChunkSize);
+                for (int32 Idx = Chunk * ParallelDecodeChunkSize; Idx < End; ++Idx)
+                {
+                    Out[Idx].readFromValue(Array[Idx]->AsObject());
+                }
+            });
+        }
+
+        static int32 GetParallelDecodeThreshold();
+        static constexpr int32 ParallelDecodeChunkSize = 32;
 //
 //         static void WriteValue(JsonWriter& writer, const FString& Identifier, const bool Value);
 //         static void WriteValue(JsonWriter& writer, const FString& Identifier, const double Value);
@@ -33,6 +72,12 @@ namespace PlayFab
         static bool ReadValue(const TSharedPtr<class FJsonObject>& obj, const FString& FieldName, int32& OutNumber);
         static bool ReadValue(const TSharedPtr<class FJsonObject>& obj, const FString& FieldName, uint32& OutNumber);
 
+        // Locates a value in serialized JSON without building a DOM. Path names one member per object level, starting at the root.
+        // On success the value is Json.Mid(OutStart, OutEnd - OutStart).
+        static bool FindRawValue(const FString& Json, const TArray<FString>& Path, int32& OutStart, int32& OutEnd);
+        // Same scan over the UTF-8 bytes of a response, as returned by IHttpResponse::GetContent
+        static bool FindRawValue(FUtf8StringView Json, const TArray<FString>& Path, int32& OutStart, int32& OutEnd);
+
         // why?
 //         static bool ReadValue(const TSharedPtr<class FJsonObject>& obj, const FString& FieldName, OptionalBool& OutNumber);
 //         static bool ReadValue(const TSharedPtr<class FJsonObject>& obj, const FString& FieldName, OptionalUint16& OutNumber);
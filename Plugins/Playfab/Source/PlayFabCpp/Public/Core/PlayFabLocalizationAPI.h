@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabLocalizationDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 
@@ -28,7 +29,7 @@ namespace PlayFab
 
         // ------------ Generated API calls
         // Retrieves the list of allowed languages, only accessible by title entities
-        bool GetLanguageList(LocalizationModels::FGetLanguageListRequest& request, const FGetLanguageListDelegate& SuccessDelegate = FGetLanguageListDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetLanguageList(LocalizationModels::FGetLanguageListRequest& request, const FGetLanguageListDelegate& SuccessDelegate = FGetLanguageListDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabMultiplayerDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 
@@ -111,406 +112,406 @@ namespace PlayFab
          * Cancel all active tickets the player is a member of in a given queue.
          * Cancels all tickets of which the player is a member in a given queue that are not cancelled or matched. This API is useful if you lose track of what tickets the player is a member of (if the title crashes for instance) and want to "reset". The Entity field is optional if the caller is a player and defaults to that player. Players may not cancel tickets for other people. The Entity field is required if the caller is a server (authenticated as the title).
          */
-        bool CancelAllMatchmakingTicketsForPlayer(MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest& request, const FCancelAllMatchmakingTicketsForPlayerDelegate& SuccessDelegate = FCancelAllMatchmakingTicketsForPlayerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CancelAllMatchmakingTicketsForPlayer(MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest& request, const FCancelAllMatchmakingTicketsForPlayerDelegate& SuccessDelegate = FCancelAllMatchmakingTicketsForPlayerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Cancel all active backfill tickets the player is a member of in a given queue.
          * Cancels all backfill tickets of which the player is a member in a given queue that are not cancelled or matched. This API is useful if you lose track of what tickets the player is a member of (if the server crashes for instance) and want to "reset".
          */
-        bool CancelAllServerBackfillTicketsForPlayer(MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest& request, const FCancelAllServerBackfillTicketsForPlayerDelegate& SuccessDelegate = FCancelAllServerBackfillTicketsForPlayerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CancelAllServerBackfillTicketsForPlayer(MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest& request, const FCancelAllServerBackfillTicketsForPlayerDelegate& SuccessDelegate = FCancelAllServerBackfillTicketsForPlayerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Cancel a matchmaking ticket.
          * Only servers and ticket members can cancel a ticket. The ticket can be in five different states when it is cancelled. 1: the ticket is waiting for members to join it, and it has not started matching. If the ticket is cancelled at this stage, it will never match. 2: the ticket is matching. If the ticket is cancelled, it will stop matching. 3: the ticket is matched. A matched ticket cannot be cancelled. 4: the ticket is already cancelled and nothing happens. 5: the ticket is waiting for a server. If the ticket is cancelled, server allocation will be stopped. A server may still be allocated due to a race condition, but that will not be reflected in the ticket. There may be race conditions between the ticket getting matched and the client making a cancellation request. The client must handle the possibility that the cancel request fails if a match is found before the cancellation request is processed. We do not allow resubmitting a cancelled ticket because players must consent to enter matchmaking again. Create a new ticket instead.
          */
-        bool CancelMatchmakingTicket(MultiplayerModels::FCancelMatchmakingTicketRequest& request, const FCancelMatchmakingTicketDelegate& SuccessDelegate = FCancelMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CancelMatchmakingTicket(MultiplayerModels::FCancelMatchmakingTicketRequest& request, const FCancelMatchmakingTicketDelegate& SuccessDelegate = FCancelMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Cancel a server backfill ticket.
          * Only servers can cancel a backfill ticket. The ticket can be in three different states when it is cancelled. 1: the ticket is matching. If the ticket is cancelled, it will stop matching. 2: the ticket is matched. A matched ticket cannot be cancelled. 3: the ticket is already cancelled and nothing happens. There may be race conditions between the ticket getting matched and the server making a cancellation request. The server must handle the possibility that the cancel request fails if a match is found before the cancellation request is processed. We do not allow resubmitting a cancelled ticket. Create a new ticket instead.
          */
-        bool CancelServerBackfillTicket(MultiplayerModels::FCancelServerBackfillTicketRequest& request, const FCancelServerBackfillTicketDelegate& SuccessDelegate = FCancelServerBackfillTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CancelServerBackfillTicket(MultiplayerModels::FCancelServerBackfillTicketRequest& request, const FCancelServerBackfillTicketDelegate& SuccessDelegate = FCancelServerBackfillTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Creates a multiplayer server build alias.
          * Creates a multiplayer server build alias and returns the created alias.
          */
-        bool CreateBuildAlias(MultiplayerModels::FCreateBuildAliasRequest& request, const FCreateBuildAliasDelegate& SuccessDelegate = FCreateBuildAliasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateBuildAlias(MultiplayerModels::FCreateBuildAliasRequest& request, const FCreateBuildAliasDelegate& SuccessDelegate = FCreateBuildAliasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Creates a multiplayer server build with a custom container.
          * Creates a multiplayer server build with a custom container and returns information about the build creation request.
          */
-        bool CreateBuildWithCustomContainer(MultiplayerModels::FCreateBuildWithCustomContainerRequest& request, const FCreateBuildWithCustomContainerDelegate& SuccessDelegate = FCreateBuildWithCustomContainerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateBuildWithCustomContainer(MultiplayerModels::FCreateBuildWithCustomContainerRequest& request, const FCreateBuildWithCustomContainerDelegate& SuccessDelegate = FCreateBuildWithCustomContainerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Creates a multiplayer server build with a managed container.
          * Creates a multiplayer server build with a managed container and returns information about the build creation request.
          */
-        bool CreateBuildWithManagedContainer(MultiplayerModels::FCreateBuildWithManagedContainerRequest& request, const FCreateBuildWithManagedContainerDelegate& SuccessDelegate = FCreateBuildWithManagedContainerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateBuildWithManagedContainer(MultiplayerModels::FCreateBuildWithManagedContainerRequest& request, const FCreateBuildWithManagedContainerDelegate& SuccessDelegate = FCreateBuildWithManagedContainerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Creates a multiplayer server build with the server running as a process.
          * Creates a multiplayer server build with the game server running as a process and returns information about the build creation request.
          */
-        bool CreateBuildWithProcessBasedServer(MultiplayerModels::FCreateBuildWithProcessBasedServerRequest& request, const FCreateBuildWithProcessBasedServerDelegate& SuccessDelegate = FCreateBuildWithProcessBasedServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateBuildWithProcessBasedServer(MultiplayerModels::FCreateBuildWithProcessBasedServerRequest& request, const FCreateBuildWithProcessBasedServerDelegate& SuccessDelegate = FCreateBuildWithProcessBasedServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Create a lobby.
          * Creates a multiplayer lobby. The caller is the lobby creator. Caller may be a server or player entity.
          */
-        bool CreateLobby(MultiplayerModels::FCreateLobbyRequest& request, const FCreateLobbyDelegate& SuccessDelegate = FCreateLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateLobby(MultiplayerModels::FCreateLobbyRequest& request, const FCreateLobbyDelegate& SuccessDelegate = FCreateLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Create a matchmaking ticket as a client.
          * The client specifies the creator's attributes and optionally a list of other users to match with.
          */
-        bool CreateMatchmakingTicket(MultiplayerModels::FCreateMatchmakingTicketRequest& request, const FCreateMatchmakingTicketDelegate& SuccessDelegate = FCreateMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateMatchmakingTicket(MultiplayerModels::FCreateMatchmakingTicketRequest& request, const FCreateMatchmakingTicketDelegate& SuccessDelegate = FCreateMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Creates a remote user to log on to a VM for a multiplayer server build.
          * Creates a remote user to log on to a VM for a multiplayer server build in a specific region. Returns user credential information necessary to log on.
          */
-        bool CreateRemoteUser(MultiplayerModels::FCreateRemoteUserRequest& request, const FCreateRemoteUserDelegate& SuccessDelegate = FCreateRemoteUserDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateRemoteUser(MultiplayerModels::FCreateRemoteUserRequest& request, const FCreateRemoteUserDelegate& SuccessDelegate = FCreateRemoteUserDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Create a backfill matchmaking ticket as a server. A backfill ticket represents an ongoing game. The matchmaking service
          * automatically starts matching the backfill ticket against other matchmaking tickets. Backfill tickets cannot match with
          * other backfill tickets.
          * The server specifies all the members, their teams and their attributes, and the server details if applicable.
          */
-        bool CreateServerBackfillTicket(MultiplayerModels::FCreateServerBackfillTicketRequest& request, const FCreateServerBackfillTicketDelegate& SuccessDelegate = FCreateServerBackfillTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateServerBackfillTicket(MultiplayerModels::FCreateServerBackfillTicketRequest& request, const FCreateServerBackfillTicketDelegate& SuccessDelegate = FCreateServerBackfillTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Create a matchmaking ticket as a server. The matchmaking service automatically starts matching the ticket against other
          * matchmaking tickets.
          * The server specifies all the members and their attributes.
          */
-        bool CreateServerMatchmakingTicket(MultiplayerModels::FCreateServerMatchmakingTicketRequest& request, const FCreateServerMatchmakingTicketDelegate& SuccessDelegate = FCreateServerMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateServerMatchmakingTicket(MultiplayerModels::FCreateServerMatchmakingTicketRequest& request, const FCreateServerMatchmakingTicketDelegate& SuccessDelegate = FCreateServerMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Creates a request to change a title's multiplayer server quotas.
          * Creates a request to change a title's multiplayer server quotas.
          */
-        bool CreateTitleMultiplayerServersQuotaChange(MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest& request, const FCreateTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate = FCreateTitleMultiplayerServersQuotaChangeDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateTitleMultiplayerServersQuotaChange(MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest& request, const FCreateTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate = FCreateTitleMultiplayerServersQuotaChangeDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Deletes a multiplayer server game asset for a title.
          * Deletes a multiplayer server game asset for a title.
          */
-        bool DeleteAsset(MultiplayerModels::FDeleteAssetRequest& request, const FDeleteAssetDelegate& SuccessDelegate = FDeleteAssetDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteAsset(MultiplayerModels::FDeleteAssetRequest& request, const FDeleteAssetDelegate& SuccessDelegate = FDeleteAssetDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Deletes a multiplayer server build.
          * Deletes a multiplayer server build.
          */
-        bool DeleteBuild(MultiplayerModels::FDeleteBuildRequest& request, const FDeleteBuildDelegate& SuccessDelegate = FDeleteBuildDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteBuild(MultiplayerModels::FDeleteBuildRequest& request, const FDeleteBuildDelegate& SuccessDelegate = FDeleteBuildDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Deletes a multiplayer server build alias.
          * Deletes a multiplayer server build alias.
          */
-        bool DeleteBuildAlias(MultiplayerModels::FDeleteBuildAliasRequest& request, const FDeleteBuildAliasDelegate& SuccessDelegate = FDeleteBuildAliasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteBuildAlias(MultiplayerModels::FDeleteBuildAliasRequest& request, const FDeleteBuildAliasDelegate& SuccessDelegate = FDeleteBuildAliasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Removes a multiplayer server build's region.
          * Removes a multiplayer server build's region.
          */
-        bool DeleteBuildRegion(MultiplayerModels::FDeleteBuildRegionRequest& request, const FDeleteBuildRegionDelegate& SuccessDelegate = FDeleteBuildRegionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteBuildRegion(MultiplayerModels::FDeleteBuildRegionRequest& request, const FDeleteBuildRegionDelegate& SuccessDelegate = FDeleteBuildRegionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Deletes a multiplayer server game certificate.
          * Deletes a multiplayer server game certificate.
          */
-        bool DeleteCertificate(MultiplayerModels::FDeleteCertificateRequest& request, const FDeleteCertificateDelegate& SuccessDelegate = FDeleteCertificateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteCertificate(MultiplayerModels::FDeleteCertificateRequest& request, const FDeleteCertificateDelegate& SuccessDelegate = FDeleteCertificateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Deletes a container image repository.
          * Removes the specified container image repository. After this operation, a 'docker pull' will fail for all the tags of the specified image. Morever, ListContainerImages will not return the specified image.
          */
-        bool DeleteContainerImageRepository(MultiplayerModels::FDeleteContainerImageRequest& request, const FDeleteContainerImageRepositoryDelegate& SuccessDelegate = FDeleteContainerImageRepositoryDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteContainerImageRepository(MultiplayerModels::FDeleteContainerImageRequest& request, const FDeleteContainerImageRepositoryDelegate& SuccessDelegate = FDeleteContainerImageRepositoryDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Delete a lobby.
          * Delete a lobby. This method is only callable by servers.
          */
-        bool DeleteLobby(MultiplayerModels::FDeleteLobbyRequest& request, const FDeleteLobbyDelegate& SuccessDelegate = FDeleteLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteLobby(MultiplayerModels::FDeleteLobbyRequest& request, const FDeleteLobbyDelegate& SuccessDelegate = FDeleteLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Deletes a remote user to log on to a VM for a multiplayer server build.
          * Deletes a remote user to log on to a VM for a multiplayer server build in a specific region. Returns user credential information necessary to log on.
          */
-        bool DeleteRemoteUser(MultiplayerModels::FDeleteRemoteUserRequest& request, const FDeleteRemoteUserDelegate& SuccessDelegate = FDeleteRemoteUserDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteRemoteUser(MultiplayerModels::FDeleteRemoteUserRequest& request, const FDeleteRemoteUserDelegate& SuccessDelegate = FDeleteRemoteUserDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Deletes a multiplayer server game secret.
          * Deletes a multiplayer server game secret.
          */
-        bool DeleteSecret(MultiplayerModels::FDeleteSecretRequest& request, const FDeleteSecretDelegate& SuccessDelegate = FDeleteSecretDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteSecret(MultiplayerModels::FDeleteSecretRequest& request, const FDeleteSecretDelegate& SuccessDelegate = FDeleteSecretDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Enables the multiplayer server feature for a title.
          * Enables the multiplayer server feature for a title and returns the enabled status. The enabled status can be Initializing, Enabled, and Disabled. It can up to 20 minutes or more for the title to be enabled for the feature. On average, it can take up to 20 minutes for the title to be enabled for the feature.
          */
-        bool EnableMultiplayerServersForTitle(MultiplayerModels::FEnableMultiplayerServersForTitleRequest& request, const FEnableMultiplayerServersForTitleDelegate& SuccessDelegate = FEnableMultiplayerServersForTitleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle EnableMultiplayerServersForTitle(MultiplayerModels::FEnableMultiplayerServersForTitleRequest& request, const FEnableMultiplayerServersForTitleDelegate& SuccessDelegate = FEnableMultiplayerServersForTitleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Find lobbies which match certain criteria, and which friends are in.
          * Find lobbies which match certain criteria and contain friends of the caller. Friends optionally include Steam, Facebook and Xbox friends. Returns a maximum of 50 instances for client calls. This method is not callable by servers.
          */
-        bool FindFriendLobbies(MultiplayerModels::FFindFriendLobbiesRequest& request, const FFindFriendLobbiesDelegate& SuccessDelegate = FFindFriendLobbiesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle FindFriendLobbies(MultiplayerModels::FFindFriendLobbiesRequest& request, const FFindFriendLobbiesDelegate& SuccessDelegate = FFindFriendLobbiesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Find all the lobbies that match certain criteria.
          * Find lobbies which match certain criteria. Returns a maximum of 500 entries for server callers, and 50 entries for client callers.
          */
-        bool FindLobbies(MultiplayerModels::FFindLobbiesRequest& request, const FFindLobbiesDelegate& SuccessDelegate = FFindLobbiesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle FindLobbies(MultiplayerModels::FFindLobbiesRequest& request, const FFindLobbiesDelegate& SuccessDelegate = FFindLobbiesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets a URL that can be used to download the specified asset. A sample pre-authenticated url -
          * https://sampleStorageAccount.blob.core.windows.net/gameassets/gameserver.zip?sv=2015-04-05&ss=b&srt=sco&sp=rw&st=startDate&se=endDate&spr=https&sig=sampleSig&api-version=2017-07-29
          * Gets a URL that can be used to download the specified asset.
          */
-        bool GetAssetDownloadUrl(MultiplayerModels::FGetAssetDownloadUrlRequest& request, const FGetAssetDownloadUrlDelegate& SuccessDelegate = FGetAssetDownloadUrlDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetAssetDownloadUrl(MultiplayerModels::FGetAssetDownloadUrlRequest& request, const FGetAssetDownloadUrlDelegate& SuccessDelegate = FGetAssetDownloadUrlDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets the URL to upload assets to. A sample pre-authenticated url -
          * https://sampleStorageAccount.blob.core.windows.net/gameassets/gameserver.zip?sv=2015-04-05&ss=b&srt=sco&sp=rw&st=startDate&se=endDate&spr=https&sig=sampleSig&api-version=2017-07-29
          * Gets the URL to upload assets to.
          */
-        bool GetAssetUploadUrl(MultiplayerModels::FGetAssetUploadUrlRequest& request, const FGetAssetUploadUrlDelegate& SuccessDelegate = FGetAssetUploadUrlDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetAssetUploadUrl(MultiplayerModels::FGetAssetUploadUrlRequest& request, const FGetAssetUploadUrlDelegate& SuccessDelegate = FGetAssetUploadUrlDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets a multiplayer server build.
          * Returns the details about a multiplayer server build.
          */
-        bool GetBuild(MultiplayerModels::FGetBuildRequest& request, const FGetBuildDelegate& SuccessDelegate = FGetBuildDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetBuild(MultiplayerModels::FGetBuildRequest& request, const FGetBuildDelegate& SuccessDelegate = FGetBuildDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets a multiplayer server build alias.
          * Returns the details about a multiplayer server build alias.
          */
-        bool GetBuildAlias(MultiplayerModels::FGetBuildAliasRequest& request, const FGetBuildAliasDelegate& SuccessDelegate = FGetBuildAliasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetBuildAlias(MultiplayerModels::FGetBuildAliasRequest& request, const FGetBuildAliasDelegate& SuccessDelegate = FGetBuildAliasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets the credentials to the container registry.
          * Gets credentials to the container registry where game developers can upload custom container images to before creating a new build.
          */
-        bool GetContainerRegistryCredentials(MultiplayerModels::FGetContainerRegistryCredentialsRequest& request, const FGetContainerRegistryCredentialsDelegate& SuccessDelegate = FGetContainerRegistryCredentialsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetContainerRegistryCredentials(MultiplayerModels::FGetContainerRegistryCredentialsRequest& request, const FGetContainerRegistryCredentialsDelegate& SuccessDelegate = FGetContainerRegistryCredentialsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Get a lobby.
-        bool GetLobby(MultiplayerModels::FGetLobbyRequest& request, const FGetLobbyDelegate& SuccessDelegate = FGetLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetLobby(MultiplayerModels::FGetLobbyRequest& request, const FGetLobbyDelegate& SuccessDelegate = FGetLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Get a match.
          * When matchmaking has successfully matched together a collection of tickets, it produces a 'match' with an Id. The match contains all of the players that were matched together, and their team assigments. Only servers and ticket members can get the match.
          */
-        bool GetMatch(MultiplayerModels::FGetMatchRequest& request, const FGetMatchDelegate& SuccessDelegate = FGetMatchDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetMatch(MultiplayerModels::FGetMatchRequest& request, const FGetMatchDelegate& SuccessDelegate = FGetMatchDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Get a matchmaking ticket by ticket Id.
          * The ticket includes the invited players, their attributes if they have joined, the ticket status, the match Id when applicable, etc. Only servers, the ticket creator and the invited players can get the ticket.
          */
-        bool GetMatchmakingTicket(MultiplayerModels::FGetMatchmakingTicketRequest& request, const FGetMatchmakingTicketDelegate& SuccessDelegate = FGetMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetMatchmakingTicket(MultiplayerModels::FGetMatchmakingTicketRequest& request, const FGetMatchmakingTicketDelegate& SuccessDelegate = FGetMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets multiplayer server session details for a build.
          * Gets multiplayer server session details for a build in a specific region.
          */
-        bool GetMultiplayerServerDetails(MultiplayerModels::FGetMultiplayerServerDetailsRequest& request, const FGetMultiplayerServerDetailsDelegate& SuccessDelegate = FGetMultiplayerServerDetailsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetMultiplayerServerDetails(MultiplayerModels::FGetMultiplayerServerDetailsRequest& request, const FGetMultiplayerServerDetailsDelegate& SuccessDelegate = FGetMultiplayerServerDetailsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets multiplayer server logs after a server has terminated.
          * Gets multiplayer server logs for a specific server id in a region. The logs are available only after a server has terminated.
          */
-        bool GetMultiplayerServerLogs(MultiplayerModels::FGetMultiplayerServerLogsRequest& request, const FGetMultiplayerServerLogsDelegate& SuccessDelegate = FGetMultiplayerServerLogsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetMultiplayerServerLogs(MultiplayerModels::FGetMultiplayerServerLogsRequest& request, const FGetMultiplayerServerLogsDelegate& SuccessDelegate = FGetMultiplayerServerLogsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets multiplayer server logs after a server has terminated.
          * Gets multiplayer server logs for a specific server id in a region. The logs are available only after a server has terminated.
          */
-        bool GetMultiplayerSessionLogsBySessionId(MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest& request, const FGetMultiplayerSessionLogsBySessionIdDelegate& SuccessDelegate = FGetMultiplayerSessionLogsBySessionIdDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetMultiplayerSessionLogsBySessionId(MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest& request, const FGetMultiplayerSessionLogsBySessionIdDelegate& SuccessDelegate = FGetMultiplayerSessionLogsBySessionIdDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Get the statistics for a queue.
          * Returns the matchmaking statistics for a queue. These include the number of players matching and the statistics related to the time to match statistics in seconds (average and percentiles). Statistics are refreshed once every 5 minutes. Servers can access all statistics no matter what the ClientStatisticsVisibility is configured to. Clients can access statistics according to the ClientStatisticsVisibility. Client requests are forbidden if all visibility fields are false.
          */
-        bool GetQueueStatistics(MultiplayerModels::FGetQueueStatisticsRequest& request, const FGetQueueStatisticsDelegate& SuccessDelegate = FGetQueueStatisticsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetQueueStatistics(MultiplayerModels::FGetQueueStatisticsRequest& request, const FGetQueueStatisticsDelegate& SuccessDelegate = FGetQueueStatisticsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets a remote login endpoint to a VM that is hosting a multiplayer server build.
          * Gets a remote login endpoint to a VM that is hosting a multiplayer server build in a specific region.
          */
-        bool GetRemoteLoginEndpoint(MultiplayerModels::FGetRemoteLoginEndpointRequest& request, const FGetRemoteLoginEndpointDelegate& SuccessDelegate = FGetRemoteLoginEndpointDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetRemoteLoginEndpoint(MultiplayerModels::FGetRemoteLoginEndpointRequest& request, const FGetRemoteLoginEndpointDelegate& SuccessDelegate = FGetRemoteLoginEndpointDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Get a matchmaking backfill ticket by ticket Id.
          * The ticket includes the players, their attributes, their teams, the ticket status, the match Id and the server details when applicable, etc. Only servers can get the ticket.
          */
-        bool GetServerBackfillTicket(MultiplayerModels::FGetServerBackfillTicketRequest& request, const FGetServerBackfillTicketDelegate& SuccessDelegate = FGetServerBackfillTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetServerBackfillTicket(MultiplayerModels::FGetServerBackfillTicketRequest& request, const FGetServerBackfillTicketDelegate& SuccessDelegate = FGetServerBackfillTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets the status of whether a title is enabled for the multiplayer server feature.
          * Gets the status of whether a title is enabled for the multiplayer server feature. The enabled status can be Initializing, Enabled, and Disabled.
          */
-        bool GetTitleEnabledForMultiplayerServersStatus(MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest& request, const FGetTitleEnabledForMultiplayerServersStatusDelegate& SuccessDelegate = FGetTitleEnabledForMultiplayerServersStatusDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetTitleEnabledForMultiplayerServersStatus(MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest& request, const FGetTitleEnabledForMultiplayerServersStatusDelegate& SuccessDelegate = FGetTitleEnabledForMultiplayerServersStatusDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets a title's server quota change request.
          * Gets a title's server quota change request.
          */
-        bool GetTitleMultiplayerServersQuotaChange(MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest& request, const FGetTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate = FGetTitleMultiplayerServersQuotaChangeDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetTitleMultiplayerServersQuotaChange(MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest& request, const FGetTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate = FGetTitleMultiplayerServersQuotaChangeDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Gets the quotas for a title in relation to multiplayer servers.
          * Gets the quotas for a title in relation to multiplayer servers.
          */
-        bool GetTitleMultiplayerServersQuotas(MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest& request, const FGetTitleMultiplayerServersQuotasDelegate& SuccessDelegate = FGetTitleMultiplayerServersQuotasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetTitleMultiplayerServersQuotas(MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest& request, const FGetTitleMultiplayerServersQuotasDelegate& SuccessDelegate = FGetTitleMultiplayerServersQuotasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Send a notification to invite a player to a lobby.
          * Invite a player to a lobby the caller is already a member of. Only players may call this.
          */
-        bool InviteToLobby(MultiplayerModels::FInviteToLobbyRequest& request, const FInviteToLobbyDelegate& SuccessDelegate = FInviteToLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle InviteToLobby(MultiplayerModels::FInviteToLobbyRequest& request, const FInviteToLobbyDelegate& SuccessDelegate = FInviteToLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Join an Arranged lobby.
-        bool JoinArrangedLobby(MultiplayerModels::FJoinArrangedLobbyRequest& request, const FJoinArrangedLobbyDelegate& SuccessDelegate = FJoinArrangedLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle JoinArrangedLobby(MultiplayerModels::FJoinArrangedLobbyRequest& request, const FJoinArrangedLobbyDelegate& SuccessDelegate = FJoinArrangedLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Join a lobby.
-        bool JoinLobby(MultiplayerModels::FJoinLobbyRequest& request, const FJoinLobbyDelegate& SuccessDelegate = FJoinLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle JoinLobby(MultiplayerModels::FJoinLobbyRequest& request, const FJoinLobbyDelegate& SuccessDelegate = FJoinLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Preview: Join a lobby as a server entity. This is restricted to client lobbies which are using connections.
          * Preview: Join a lobby as a server entity.
          */
-        bool JoinLobbyAsServer(MultiplayerModels::FJoinLobbyAsServerRequest& request, const FJoinLobbyAsServerDelegate& SuccessDelegate = FJoinLobbyAsServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle JoinLobbyAsServer(MultiplayerModels::FJoinLobbyAsServerRequest& request, const FJoinLobbyAsServerDelegate& SuccessDelegate = FJoinLobbyAsServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Join a matchmaking ticket.
          * Add the player to a matchmaking ticket and specify all of its matchmaking attributes. Players can join a ticket if and only if their EntityKeys are already listed in the ticket's Members list. The matchmaking service automatically starts matching the ticket against other matchmaking tickets once all players have joined the ticket. It is not possible to join a ticket once it has started matching.
          */
-        bool JoinMatchmakingTicket(MultiplayerModels::FJoinMatchmakingTicketRequest& request, const FJoinMatchmakingTicketDelegate& SuccessDelegate = FJoinMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle JoinMatchmakingTicket(MultiplayerModels::FJoinMatchmakingTicketRequest& request, const FJoinMatchmakingTicketDelegate& SuccessDelegate = FJoinMatchmakingTicketDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Leave a lobby.
          * Leave a lobby. Members will also be automatically unsubscribed from the lobby.
          */
-        bool LeaveLobby(MultiplayerModels::FLeaveLobbyRequest& request, const FLeaveLobbyDelegate& SuccessDelegate = FLeaveLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle LeaveLobby(MultiplayerModels::FLeaveLobbyRequest& request, const FLeaveLobbyDelegate& SuccessDelegate = FLeaveLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Preview: Request for server to leave a lobby. This is restricted to client owned lobbies which are using connections.
          * Preview: Request for server to leave a lobby.
          */
-        bool LeaveLobbyAsServer(MultiplayerModels::FLeaveLobbyAsServerRequest& request, const FLeaveLobbyAsServerDelegate& SuccessDelegate = FLeaveLobbyAsServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle LeaveLobbyAsServer(MultiplayerModels::FLeaveLobbyAsServerRequest& request, const FLeaveLobbyAsServerDelegate& SuccessDelegate = FLeaveLobbyAsServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists archived multiplayer server sessions for a build.
          * Returns a list of archived multiplayer servers for a build in a specific region.
          */
-        bool ListArchivedMultiplayerServers(MultiplayerModels::FListMultiplayerServersRequest& request, const FListArchivedMultiplayerServersDelegate& SuccessDelegate = FListArchivedMultiplayerServersDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListArchivedMultiplayerServers(MultiplayerModels::FListMultiplayerServersRequest& request, const FListArchivedMultiplayerServersDelegate& SuccessDelegate = FListArchivedMultiplayerServersDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists multiplayer server game assets for a title.
          * Returns a list of multiplayer server game asset summaries for a title.
          */
-        bool ListAssetSummaries(MultiplayerModels::FListAssetSummariesRequest& request, const FListAssetSummariesDelegate& SuccessDelegate = FListAssetSummariesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListAssetSummaries(MultiplayerModels::FListAssetSummariesRequest& request, const FListAssetSummariesDelegate& SuccessDelegate = FListAssetSummariesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists details of all build aliases for a title. Accepts tokens for title and if game client access is enabled, allows
          * game client to request list of builds with player entity token.
          * Returns a list of summarized details of all multiplayer server builds for a title.
          */
-        bool ListBuildAliases(MultiplayerModels::FListBuildAliasesRequest& request, const FListBuildAliasesDelegate& SuccessDelegate = FListBuildAliasesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListBuildAliases(MultiplayerModels::FListBuildAliasesRequest& request, const FListBuildAliasesDelegate& SuccessDelegate = FListBuildAliasesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists summarized details of all multiplayer server builds for a title. Accepts tokens for title and if game client
          * access is enabled, allows game client to request list of builds with player entity token.
          * Returns a list of summarized details of all multiplayer server builds for a title.
          */
-        bool ListBuildSummariesV2(MultiplayerModels::FListBuildSummariesRequest& request, const FListBuildSummariesV2Delegate& SuccessDelegate = FListBuildSummariesV2Delegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListBuildSummariesV2(MultiplayerModels::FListBuildSummariesRequest& request, const FListBuildSummariesV2Delegate& SuccessDelegate = FListBuildSummariesV2Delegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists multiplayer server game certificates for a title.
          * Returns a list of multiplayer server game certificates for a title.
          */
-        bool ListCertificateSummaries(MultiplayerModels::FListCertificateSummariesRequest& request, const FListCertificateSummariesDelegate& SuccessDelegate = FListCertificateSummariesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListCertificateSummaries(MultiplayerModels::FListCertificateSummariesRequest& request, const FListCertificateSummariesDelegate& SuccessDelegate = FListCertificateSummariesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists custom container images for a title.
          * Returns a list of the container images that have been uploaded to the container registry for a title.
          */
-        bool ListContainerImages(MultiplayerModels::FListContainerImagesRequest& request, const FListContainerImagesDelegate& SuccessDelegate = FListContainerImagesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListContainerImages(MultiplayerModels::FListContainerImagesRequest& request, const FListContainerImagesDelegate& SuccessDelegate = FListContainerImagesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists the tags for a custom container image.
          * Returns a list of the tags for a particular container image that exists in the container registry for a title.
          */
-        bool ListContainerImageTags(MultiplayerModels::FListContainerImageTagsRequest& request, const FListContainerImageTagsDelegate& SuccessDelegate = FListContainerImageTagsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListContainerImageTags(MultiplayerModels::FListContainerImageTagsRequest& request, const FListContainerImageTagsDelegate& SuccessDelegate = FListContainerImageTagsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * List all matchmaking ticket Ids the user is a member of.
          * If the caller is a title, the EntityKey in the request is required. If the caller is a player, then it is optional. If it is provided it must match the caller's entity.
          */
-        bool ListMatchmakingTicketsForPlayer(MultiplayerModels::FListMatchmakingTicketsForPlayerRequest& request, const FListMatchmakingTicketsForPlayerDelegate& SuccessDelegate = FListMatchmakingTicketsForPlayerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListMatchmakingTicketsForPlayer(MultiplayerModels::FListMatchmakingTicketsForPlayerRequest& request, const FListMatchmakingTicketsForPlayerDelegate& SuccessDelegate = FListMatchmakingTicketsForPlayerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists multiplayer server sessions for a build.
          * Returns a list of multiplayer servers for a build in a specific region.
          */
-        bool ListMultiplayerServers(MultiplayerModels::FListMultiplayerServersRequest& request, const FListMultiplayerServersDelegate& SuccessDelegate = FListMultiplayerServersDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListMultiplayerServers(MultiplayerModels::FListMultiplayerServersRequest& request, const FListMultiplayerServersDelegate& SuccessDelegate = FListMultiplayerServersDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists quality of service servers for party.
          * Returns a list of quality of service servers for party.
          */
-        bool ListPartyQosServers(MultiplayerModels::FListPartyQosServersRequest& request, const FListPartyQosServersDelegate& SuccessDelegate = FListPartyQosServersDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListPartyQosServers(MultiplayerModels::FListPartyQosServersRequest& request, const FListPartyQosServersDelegate& SuccessDelegate = FListPartyQosServersDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists quality of service servers for the title. By default, servers are only returned for regions where a Multiplayer
          * Servers build has been deployed.
          * Returns a list of quality of service servers for a title.
          */
-        bool ListQosServersForTitle(MultiplayerModels::FListQosServersForTitleRequest& request, const FListQosServersForTitleDelegate& SuccessDelegate = FListQosServersForTitleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListQosServersForTitle(MultiplayerModels::FListQosServersForTitleRequest& request, const FListQosServersForTitleDelegate& SuccessDelegate = FListQosServersForTitleDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists multiplayer server game secrets for a title.
          * Returns a list of multiplayer server game secrets for a title.
          */
-        bool ListSecretSummaries(MultiplayerModels::FListSecretSummariesRequest& request, const FListSecretSummariesDelegate& SuccessDelegate = FListSecretSummariesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListSecretSummaries(MultiplayerModels::FListSecretSummariesRequest& request, const FListSecretSummariesDelegate& SuccessDelegate = FListSecretSummariesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * List all server backfill ticket Ids the user is a member of.
          * List all server backfill ticket Ids the user is a member of.
          */
-        bool ListServerBackfillTicketsForPlayer(MultiplayerModels::FListServerBackfillTicketsForPlayerRequest& request, const FListServerBackfillTicketsForPlayerDelegate& SuccessDelegate = FListServerBackfillTicketsForPlayerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListServerBackfillTicketsForPlayer(MultiplayerModels::FListServerBackfillTicketsForPlayerRequest& request, const FListServerBackfillTicketsForPlayerDelegate& SuccessDelegate = FListServerBackfillTicketsForPlayerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * List all server quota change requests for a title.
          * List all server quota change requests for a title.
          */
-        bool ListTitleMultiplayerServersQuotaChanges(MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest& request, const FListTitleMultiplayerServersQuotaChangesDelegate& SuccessDelegate = FListTitleMultiplayerServersQuotaChangesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListTitleMultiplayerServersQuotaChanges(MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest& request, const FListTitleMultiplayerServersQuotaChangesDelegate& SuccessDelegate = FListTitleMultiplayerServersQuotaChangesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Lists virtual machines for a title.
          * Returns a list of virtual machines for a title.
          */
-        bool ListVirtualMachineSummaries(MultiplayerModels::FListVirtualMachineSummariesRequest& request, const FListVirtualMachineSummariesDelegate& SuccessDelegate = FListVirtualMachineSummariesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListVirtualMachineSummaries(MultiplayerModels::FListVirtualMachineSummariesRequest& request, const FListVirtualMachineSummariesDelegate& SuccessDelegate = FListVirtualMachineSummariesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Remove a member from a lobby.
          * Remove another member from a lobby. Owners and servers may remove any member from a lobby. Members cannot remove themselves but they can use LeaveLobby instead. Members are also unsubscribed from the lobby.
          */
-        bool RemoveMember(MultiplayerModels::FRemoveMemberFromLobbyRequest& request, const FRemoveMemberDelegate& SuccessDelegate = FRemoveMemberDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle RemoveMember(MultiplayerModels::FRemoveMemberFromLobbyRequest& request, const FRemoveMemberDelegate& SuccessDelegate = FRemoveMemberDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Request a multiplayer server session. Accepts tokens for title and if game client access is enabled, allows game client
          * to request a server with player entity token.
          * Requests a multiplayer server session from a particular build in any of the given preferred regions.
          */
-        bool RequestMultiplayerServer(MultiplayerModels::FRequestMultiplayerServerRequest& request, const FRequestMultiplayerServerDelegate& SuccessDelegate = FRequestMultiplayerServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle RequestMultiplayerServer(MultiplayerModels::FRequestMultiplayerServerRequest& request, const FRequestMultiplayerServerDelegate& SuccessDelegate = FRequestMultiplayerServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Request a party session.
          * Requests a party session from a particular set of builds if build alias params is provided, in any of the given preferred regions.
          */
-        bool RequestPartyService(MultiplayerModels::FRequestPartyServiceRequest& request, const FRequestPartyServiceDelegate& SuccessDelegate = FRequestPartyServiceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle RequestPartyService(MultiplayerModels::FRequestPartyServiceRequest& request, const FRequestPartyServiceDelegate& SuccessDelegate = FRequestPartyServiceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Rolls over the credentials to the container registry.
          * Gets new credentials to the container registry where game developers can upload custom container images to before creating a new build.
          */
-        bool RolloverContainerRegistryCredentials(MultiplayerModels::FRolloverContainerRegistryCredentialsRequest& request, const FRolloverContainerRegistryCredentialsDelegate& SuccessDelegate = FRolloverContainerRegistryCredentialsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle RolloverContainerRegistryCredentials(MultiplayerModels::FRolloverContainerRegistryCredentialsRequest& request, const FRolloverContainerRegistryCredentialsDelegate& SuccessDelegate = FRolloverContainerRegistryCredentialsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Shuts down a multiplayer server session.
          * Executes the shutdown callback from the GSDK and terminates the multiplayer server session. The callback in the GSDK will allow for graceful shutdown with a 15 minute timeoutIf graceful shutdown has not been completed before 15 minutes have elapsed, the multiplayer server session will be forcefully terminated on it's own.
          */
-        bool ShutdownMultiplayerServer(MultiplayerModels::FShutdownMultiplayerServerRequest& request, const FShutdownMultiplayerServerDelegate& SuccessDelegate = FShutdownMultiplayerServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ShutdownMultiplayerServer(MultiplayerModels::FShutdownMultiplayerServerRequest& request, const FShutdownMultiplayerServerDelegate& SuccessDelegate = FShutdownMultiplayerServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Subscribe to lobby resource notifications.
          * Subscribe to lobby resource notifications. Lobby subscriptions have two types; LobbyChange and LobbyInvite.
          */
-        bool SubscribeToLobbyResource(MultiplayerModels::FSubscribeToLobbyResourceRequest& request, const FSubscribeToLobbyResourceDelegate& SuccessDelegate = FSubscribeToLobbyResourceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SubscribeToLobbyResource(MultiplayerModels::FSubscribeToLobbyResourceRequest& request, const FSubscribeToLobbyResourceDelegate& SuccessDelegate = FSubscribeToLobbyResourceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Unsubscribe from lobby notifications.
          * Unsubscribe from lobby notifications.
          */
-        bool UnsubscribeFromLobbyResource(MultiplayerModels::FUnsubscribeFromLobbyResourceRequest& request, const FUnsubscribeFromLobbyResourceDelegate& SuccessDelegate = FUnsubscribeFromLobbyResourceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UnsubscribeFromLobbyResource(MultiplayerModels::FUnsubscribeFromLobbyResourceRequest& request, const FUnsubscribeFromLobbyResourceDelegate& SuccessDelegate = FUnsubscribeFromLobbyResourceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Untags a container image.
          * Removes the specified tag from the image. After this operation, a 'docker pull' will fail for the specified image and tag combination. Morever, ListContainerImageTags will not return the specified tag.
          */
-        bool UntagContainerImage(MultiplayerModels::FUntagContainerImageRequest& request, const FUntagContainerImageDelegate& SuccessDelegate = FUntagContainerImageDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UntagContainerImage(MultiplayerModels::FUntagContainerImageRequest& request, const FUntagContainerImageDelegate& SuccessDelegate = FUntagContainerImageDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Creates a multiplayer server build alias.
          * Creates a multiplayer server build alias and returns the created alias.
          */
-        bool UpdateBuildAlias(MultiplayerModels::FUpdateBuildAliasRequest& request, const FUpdateBuildAliasDelegate& SuccessDelegate = FUpdateBuildAliasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateBuildAlias(MultiplayerModels::FUpdateBuildAliasRequest& request, const FUpdateBuildAliasDelegate& SuccessDelegate = FUpdateBuildAliasDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Updates a multiplayer server build's name.
          * Updates a multiplayer server build's name.
          */
-        bool UpdateBuildName(MultiplayerModels::FUpdateBuildNameRequest& request, const FUpdateBuildNameDelegate& SuccessDelegate = FUpdateBuildNameDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateBuildName(MultiplayerModels::FUpdateBuildNameRequest& request, const FUpdateBuildNameDelegate& SuccessDelegate = FUpdateBuildNameDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Updates a multiplayer server build's region. If the region is not yet created, it will be created
          * Updates a multiplayer server build's region.
          */
-        bool UpdateBuildRegion(MultiplayerModels::FUpdateBuildRegionRequest& request, const FUpdateBuildRegionDelegate& SuccessDelegate = FUpdateBuildRegionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateBuildRegion(MultiplayerModels::FUpdateBuildRegionRequest& request, const FUpdateBuildRegionDelegate& SuccessDelegate = FUpdateBuildRegionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Updates a multiplayer server build's regions.
          * Updates a multiplayer server build's regions.
          */
-        bool UpdateBuildRegions(MultiplayerModels::FUpdateBuildRegionsRequest& request, const FUpdateBuildRegionsDelegate& SuccessDelegate = FUpdateBuildRegionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateBuildRegions(MultiplayerModels::FUpdateBuildRegionsRequest& request, const FUpdateBuildRegionsDelegate& SuccessDelegate = FUpdateBuildRegionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Update a lobby.
-        bool UpdateLobby(MultiplayerModels::FUpdateLobbyRequest& request, const FUpdateLobbyDelegate& SuccessDelegate = FUpdateLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateLobby(MultiplayerModels::FUpdateLobbyRequest& request, const FUpdateLobbyDelegate& SuccessDelegate = FUpdateLobbyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Preview: Update fields related to a joined server in the lobby the server is in. Servers can keep a lobby from expiring
          * by being the one to "update" the lobby in some way. Servers have no impact on last member leave/last member disconnect
          * behavior.
          * Preview: Updates joined server information in lobby.
          */
-        bool UpdateLobbyAsServer(MultiplayerModels::FUpdateLobbyAsServerRequest& request, const FUpdateLobbyAsServerDelegate& SuccessDelegate = FUpdateLobbyAsServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateLobbyAsServer(MultiplayerModels::FUpdateLobbyAsServerRequest& request, const FUpdateLobbyAsServerDelegate& SuccessDelegate = FUpdateLobbyAsServerDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Uploads a multiplayer server game certificate.
          * Uploads a multiplayer server game certificate.
          */
-        bool UploadCertificate(MultiplayerModels::FUploadCertificateRequest& request, const FUploadCertificateDelegate& SuccessDelegate = FUploadCertificateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UploadCertificate(MultiplayerModels::FUploadCertificateRequest& request, const FUploadCertificateDelegate& SuccessDelegate = FUploadCertificateDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Uploads a multiplayer server game secret.
          * Uploads a multiplayer server game secret.
          */
-        bool UploadSecret(MultiplayerModels::FUploadSecretRequest& request, const FUploadSecretDelegate& SuccessDelegate = FUploadSecretDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UploadSecret(MultiplayerModels::FUploadSecretRequest& request, const FUploadSecretDelegate& SuccessDelegate = FUploadSecretDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
@@ -58,7 +58,7 @@ namespace ProfilesModels
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
     {
         // Unique ID of the entity.
-        FString Id;
+        FPlayFabId Id;
 
         // [optional] Entity type. See https://docs.microsoft.com/gaming/playfab/features/data/entities/available-built-in-entity-types
         FString Type;
@@ -85,7 +85,7 @@ namespace ProfilesModels
     struct PLAYFABCPP_API FEntityLineage : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] The Character Id of the associated entity.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The Group Id of the associated entity.
         FString GroupId;
@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabProfilesDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "PlayFabAPISettings.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
@@ -66,48 +67,48 @@ namespace PlayFab
          * Gets the global title access policy
          * Retrieves the title access policy that is used before the profile's policy is inspected during a request. If never customized this will return the default starter policy built by PlayFab.
          */
-        bool GetGlobalPolicy(ProfilesModels::FGetGlobalPolicyRequest& request, const FGetGlobalPolicyDelegate& SuccessDelegate = FGetGlobalPolicyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetGlobalPolicy(ProfilesModels::FGetGlobalPolicyRequest& request, const FGetGlobalPolicyDelegate& SuccessDelegate = FGetGlobalPolicyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Retrieves the entity's profile.
          * Given an entity type and entity identifier will retrieve the profile from the entity store. If the profile being retrieved is the caller's, then the read operation is consistent, if not it is an inconsistent read. An inconsistent read means that we do not guarantee all committed writes have occurred before reading the profile, allowing for a stale read. If consistency is important the Version Number on the result can be used to compare which version of the profile any reader has.
          */
-        bool GetProfile(ProfilesModels::FGetEntityProfileRequest& request, const FGetProfileDelegate& SuccessDelegate = FGetProfileDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetProfile(ProfilesModels::FGetEntityProfileRequest& request, const FGetProfileDelegate& SuccessDelegate = FGetProfileDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Retrieves the entity's profile.
          * Given a set of entity types and entity identifiers will retrieve all readable profiles properties for the caller. Profiles that the caller is not allowed to read will silently not be included in the results.
          */
-        bool GetProfiles(ProfilesModels::FGetEntityProfilesRequest& request, const FGetProfilesDelegate& SuccessDelegate = FGetProfilesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetProfiles(ProfilesModels::FGetEntityProfilesRequest& request, const FGetProfilesDelegate& SuccessDelegate = FGetProfilesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Retrieves the title player accounts associated with the given master player account.
          * Given a master player account id (PlayFab ID), returns all title player accounts associated with it.
          */
-        bool GetTitlePlayersFromMasterPlayerAccountIds(ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest& request, const FGetTitlePlayersFromMasterPlayerAccountIdsDelegate& SuccessDelegate = FGetTitlePlayersFromMasterPlayerAccountIdsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetTitlePlayersFromMasterPlayerAccountIds(ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest& request, const FGetTitlePlayersFromMasterPlayerAccountIdsDelegate& SuccessDelegate = FGetTitlePlayersFromMasterPlayerAccountIdsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Retrieves the title player accounts associated with the given XUIDs.
          * Given a collection of Xbox IDs (XUIDs), returns all title player accounts.
          */
-        bool GetTitlePlayersFromXboxLiveIDs(ProfilesModels::FGetTitlePlayersFromXboxLiveIDsRequest& request, const FGetTitlePlayersFromXboxLiveIDsDelegate& SuccessDelegate = FGetTitlePlayersFromXboxLiveIDsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetTitlePlayersFromXboxLiveIDs(ProfilesModels::FGetTitlePlayersFromXboxLiveIDsRequest& request, const FGetTitlePlayersFromXboxLiveIDsDelegate& SuccessDelegate = FGetTitlePlayersFromXboxLiveIDsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Update the display name of the entity
          * Given an entity profile, will update its display name to the one passed in if the profile's version is equal to the specified value
          */
-        bool SetDisplayName(ProfilesModels::FSetDisplayNameRequest& request, const FSetDisplayNameDelegate& SuccessDelegate = FSetDisplayNameDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SetDisplayName(ProfilesModels::FSetDisplayNameRequest& request, const FSetDisplayNameDelegate& SuccessDelegate = FSetDisplayNameDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Sets the global title access policy
          * Updates the title access policy that is used before the profile's policy is inspected during a request. Policies are compiled and cached for several minutes so an update here may not be reflected in behavior for a short time.
          */
-        bool SetGlobalPolicy(ProfilesModels::FSetGlobalPolicyRequest& request, const FSetGlobalPolicyDelegate& SuccessDelegate = FSetGlobalPolicyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SetGlobalPolicy(ProfilesModels::FSetGlobalPolicyRequest& request, const FSetGlobalPolicyDelegate& SuccessDelegate = FSetGlobalPolicyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Updates the entity's language. The precedence hierarchy for communication to the player is Title Player Account
          * language, Master Player Account language, and then title default language if the first two aren't set or supported.
          * Given an entity profile, will update its language to the one passed in if the profile's version is equal to the one passed in.
          */
-        bool SetProfileLanguage(ProfilesModels::FSetProfileLanguageRequest& request, const FSetProfileLanguageDelegate& SuccessDelegate = FSetProfileLanguageDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SetProfileLanguage(ProfilesModels::FSetProfileLanguageRequest& request, const FSetProfileLanguageDelegate& SuccessDelegate = FSetProfileLanguageDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Sets the profiles access policy
          * This will set the access policy statements on the given entity profile. This is not additive, any existing statements will be replaced with the statements in this request.
          */
-        bool SetProfilePolicy(ProfilesModels::FSetEntityProfilePolicyRequest& request, const FSetProfilePolicyDelegate& SuccessDelegate = FSetProfilePolicyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle SetProfilePolicy(ProfilesModels::FSetEntityProfilePolicyRequest& request, const FSetProfilePolicyDelegate& SuccessDelegate = FSetProfilePolicyDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
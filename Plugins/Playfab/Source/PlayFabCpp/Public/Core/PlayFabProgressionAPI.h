@@ -10,6 +10,7 @@
 #include "Core/PlayFabError.h"
 #include "Core/PlayFabProgressionDataModels.h"
 #include "Core/PlayFabSettings.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 
@@ -50,54 +51,54 @@ namespace PlayFab
 
         // ------------ Generated API calls
         // Creates a new leaderboard definition.
-        bool CreateLeaderboardDefinition(ProgressionModels::FCreateLeaderboardDefinitionRequest& request, const FCreateLeaderboardDefinitionDelegate& SuccessDelegate = FCreateLeaderboardDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateLeaderboardDefinition(ProgressionModels::FCreateLeaderboardDefinitionRequest& request, const FCreateLeaderboardDefinitionDelegate& SuccessDelegate = FCreateLeaderboardDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Create a new entity statistic definition.
-        bool CreateStatisticDefinition(ProgressionModels::FCreateStatisticDefinitionRequest& request, const FCreateStatisticDefinitionDelegate& SuccessDelegate = FCreateStatisticDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle CreateStatisticDefinition(ProgressionModels::FCreateStatisticDefinitionRequest& request, const FCreateStatisticDefinitionDelegate& SuccessDelegate = FCreateStatisticDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes a leaderboard definition.
-        bool DeleteLeaderboardDefinition(ProgressionModels::FDeleteLeaderboardDefinitionRequest& request, const FDeleteLeaderboardDefinitionDelegate& SuccessDelegate = FDeleteLeaderboardDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteLeaderboardDefinition(ProgressionModels::FDeleteLeaderboardDefinitionRequest& request, const FDeleteLeaderboardDefinitionDelegate& SuccessDelegate = FDeleteLeaderboardDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Deletes the specified entries from the given leaderboard.
-        bool DeleteLeaderboardEntries(ProgressionModels::FDeleteLeaderboardEntriesRequest& request, const FDeleteLeaderboardEntriesDelegate& SuccessDelegate = FDeleteLeaderboardEntriesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteLeaderboardEntries(ProgressionModels::FDeleteLeaderboardEntriesRequest& request, const FDeleteLeaderboardEntriesDelegate& SuccessDelegate = FDeleteLeaderboardEntriesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Delete an entity statistic definition. Will delete all statistics on entity profiles and leaderboards.
-        bool DeleteStatisticDefinition(ProgressionModels::FDeleteStatisticDefinitionRequest& request, const FDeleteStatisticDefinitionDelegate& SuccessDelegate = FDeleteStatisticDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteStatisticDefinition(ProgressionModels::FDeleteStatisticDefinitionRequest& request, const FDeleteStatisticDefinitionDelegate& SuccessDelegate = FDeleteStatisticDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Delete statistics on an entity profile. This will remove all rankings from associated leaderboards.
-        bool DeleteStatistics(ProgressionModels::FDeleteStatisticsRequest& request, const FDeleteStatisticsDelegate& SuccessDelegate = FDeleteStatisticsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle DeleteStatistics(ProgressionModels::FDeleteStatisticsRequest& request, const FDeleteStatisticsDelegate& SuccessDelegate = FDeleteStatisticsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Get the friend leaderboard for the specified entity. A maximum of 25 friend entries are listed in the leaderboard.
-        bool GetFriendLeaderboardForEntity(ProgressionModels::FGetFriendLeaderboardForEntityRequest& request, const FGetFriendLeaderboardForEntityDelegate& SuccessDelegate = FGetFriendLeaderboardForEntityDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetFriendLeaderboardForEntity(ProgressionModels::FGetFriendLeaderboardForEntityRequest& request, const FGetFriendLeaderboardForEntityDelegate& SuccessDelegate = FGetFriendLeaderboardForEntityDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Get the leaderboard for a specific entity type and statistic.
-        bool GetLeaderboard(ProgressionModels::FGetEntityLeaderboardRequest& request, const FGetLeaderboardDelegate& SuccessDelegate = FGetLeaderboardDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetLeaderboard(ProgressionModels::FGetEntityLeaderboardRequest& request, const FGetLeaderboardDelegate& SuccessDelegate = FGetLeaderboardDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Get the leaderboard around a specific entity.
-        bool GetLeaderboardAroundEntity(ProgressionModels::FGetLeaderboardAroundEntityRequest& request, const FGetLeaderboardAroundEntityDelegate& SuccessDelegate = FGetLeaderboardAroundEntityDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetLeaderboardAroundEntity(ProgressionModels::FGetLeaderboardAroundEntityRequest& request, const FGetLeaderboardAroundEntityDelegate& SuccessDelegate = FGetLeaderboardAroundEntityDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets the specified leaderboard definition.
-        bool GetLeaderboardDefinition(ProgressionModels::FGetLeaderboardDefinitionRequest& request, const FGetLeaderboardDefinitionDelegate& SuccessDelegate = FGetLeaderboardDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetLeaderboardDefinition(ProgressionModels::FGetLeaderboardDefinitionRequest& request, const FGetLeaderboardDefinitionDelegate& SuccessDelegate = FGetLeaderboardDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Get the leaderboard limited to a set of entities.
-        bool GetLeaderboardForEntities(ProgressionModels::FGetLeaderboardForEntitiesRequest& request, const FGetLeaderboardForEntitiesDelegate& SuccessDelegate = FGetLeaderboardForEntitiesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetLeaderboardForEntities(ProgressionModels::FGetLeaderboardForEntitiesRequest& request, const FGetLeaderboardForEntitiesDelegate& SuccessDelegate = FGetLeaderboardForEntitiesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Get current statistic definition information
-        bool GetStatisticDefinition(ProgressionModels::FGetStatisticDefinitionRequest& request, const FGetStatisticDefinitionDelegate& SuccessDelegate = FGetStatisticDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetStatisticDefinition(ProgressionModels::FGetStatisticDefinitionRequest& request, const FGetStatisticDefinitionDelegate& SuccessDelegate = FGetStatisticDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets statistics for the specified entity.
-        bool GetStatistics(ProgressionModels::FGetStatisticsRequest& request, const FGetStatisticsDelegate& SuccessDelegate = FGetStatisticsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetStatistics(ProgressionModels::FGetStatisticsRequest& request, const FGetStatisticsDelegate& SuccessDelegate = FGetStatisticsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Gets statistics for the specified collection of entities.
-        bool GetStatisticsForEntities(ProgressionModels::FGetStatisticsForEntitiesRequest& request, const FGetStatisticsForEntitiesDelegate& SuccessDelegate = FGetStatisticsForEntitiesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetStatisticsForEntities(ProgressionModels::FGetStatisticsForEntitiesRequest& request, const FGetStatisticsForEntitiesDelegate& SuccessDelegate = FGetStatisticsForEntitiesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Increment a leaderboard version.
-        bool IncrementLeaderboardVersion(ProgressionModels::FIncrementLeaderboardVersionRequest& request, const FIncrementLeaderboardVersionDelegate& SuccessDelegate = FIncrementLeaderboardVersionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle IncrementLeaderboardVersion(ProgressionModels::FIncrementLeaderboardVersionRequest& request, const FIncrementLeaderboardVersionDelegate& SuccessDelegate = FIncrementLeaderboardVersionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Increment an entity statistic definition version.
-        bool IncrementStatisticVersion(ProgressionModels::FIncrementStatisticVersionRequest& request, const FIncrementStatisticVersionDelegate& SuccessDelegate = FIncrementStatisticVersionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle IncrementStatisticVersion(ProgressionModels::FIncrementStatisticVersionRequest& request, const FIncrementStatisticVersionDelegate& SuccessDelegate = FIncrementStatisticVersionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Lists the leaderboard definitions defined for the Title.
-        bool ListLeaderboardDefinitions(ProgressionModels::FListLeaderboardDefinitionsRequest& request, const FListLeaderboardDefinitionsDelegate& SuccessDelegate = FListLeaderboardDefinitionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListLeaderboardDefinitions(ProgressionModels::FListLeaderboardDefinitionsRequest& request, const FListLeaderboardDefinitionsDelegate& SuccessDelegate = FListLeaderboardDefinitionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Get all current statistic definitions information
-        bool ListStatisticDefinitions(ProgressionModels::FListStatisticDefinitionsRequest& request, const FListStatisticDefinitionsDelegate& SuccessDelegate = FListStatisticDefinitionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle ListStatisticDefinitions(ProgressionModels::FListStatisticDefinitionsRequest& request, const FListStatisticDefinitionsDelegate& SuccessDelegate = FListStatisticDefinitionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Unlinks a leaderboard definition from it's linked statistic definition.
-        bool UnlinkLeaderboardFromStatistic(ProgressionModels::FUnlinkLeaderboardFromStatisticRequest& request, const FUnlinkLeaderboardFromStatisticDelegate& SuccessDelegate = FUnlinkLeaderboardFromStatisticDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UnlinkLeaderboardFromStatistic(ProgressionModels::FUnlinkLeaderboardFromStatisticRequest& request, const FUnlinkLeaderboardFromStatisticDelegate& SuccessDelegate = FUnlinkLeaderboardFromStatisticDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Updates a leaderboard definition.
-        bool UpdateLeaderboardDefinition(ProgressionModels::FUpdateLeaderboardDefinitionRequest& request, const FUpdateLeaderboardDefinitionDelegate& SuccessDelegate = FUpdateLeaderboardDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateLeaderboardDefinition(ProgressionModels::FUpdateLeaderboardDefinitionRequest& request, const FUpdateLeaderboardDefinitionDelegate& SuccessDelegate = FUpdateLeaderboardDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Adds or updates entries on the specified leaderboard.
-        bool UpdateLeaderboardEntries(ProgressionModels::FUpdateLeaderboardEntriesRequest& request, const FUpdateLeaderboardEntriesDelegate& SuccessDelegate = FUpdateLeaderboardEntriesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateLeaderboardEntries(ProgressionModels::FUpdateLeaderboardEntriesRequest& request, const FUpdateLeaderboardEntriesDelegate& SuccessDelegate = FUpdateLeaderboardEntriesDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         // Update an existing entity statistic definition.
-        bool UpdateStatisticDefinition(ProgressionModels::FUpdateStatisticDefinitionRequest& request, const FUpdateStatisticDefinitionDelegate& SuccessDelegate = FUpdateStatisticDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateStatisticDefinition(ProgressionModels::FUpdateStatisticDefinitionRequest& request, const FUpdateStatisticDefinitionDelegate& SuccessDelegate = FUpdateStatisticDefinitionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
         /**
          * Update statistics on an entity profile. Depending on the statistic definition, this may result in entity being ranked on
          * various leaderboards.
          */
-        bool UpdateStatistics(ProgressionModels::FUpdateStatisticsRequest& request, const FUpdateStatisticsDelegate& SuccessDelegate = FUpdateStatisticsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle UpdateStatistics(ProgressionModels::FUpdateStatisticsRequest& request, const FUpdateStatisticsDelegate& SuccessDelegate = FUpdateStatisticsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
 
     private:
         // ------------ Generated result handlers
@@ -0,0 +1,38 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+
+namespace PlayFab
+{
+    /**
+    * Returned by every API call. Converts to bool the same way the old return value did: true when the request was handed to the HTTP layer.
+    * Keeping the handle does not keep the request alive.
+    * API calls may be made from any thread. Their success/error delegates always run on the game thread.
+    */
+    class PLAYFABCPP_API FPlayFabRequestHandle
+    {
+    public:
+        FPlayFabRequestHandle() : bSubmitted(false) {}
+        FPlayFabRequestHandle(const TSharedRef<IHttpRequest>& InRequest, bool bInSubmitted) : Request(InRequest), bSubmitted(bInSubmitted) {}
+        // For calls answered without a request, e.g. served from PlayFabSessionCache
+        explicit FPlayFabRequestHandle(bool bInSubmitted) : bSubmitted(bInSubmitted) {}
+
+        operator bool() const { return bSubmitted; }
+
+        // True while the request is queued or in flight
+        bool IsPending() const;
+
+        // Aborts the request. Neither the response decoding nor the success/error delegates will run afterwards.
+        void Cancel();
+
+    private:
+        TWeakPtr<IHttpRequest> Request;
+        bool bSubmitted;
+    };
+}
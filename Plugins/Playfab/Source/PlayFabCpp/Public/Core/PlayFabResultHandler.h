@@ -9,20 +9,33 @@
 #include "PlayFabAPISettings.h"
 #include "PlayFabCppBaseModel.h"
 #include "PlayFabError.h"
+#include "PlayFabRequestHandle.h"
 #include "PlayFabSettings.h"
 #include "Http.h"
+#include <atomic>
 
 namespace PlayFab
 {
     class PlayFabRequestHandler
     {
     private:
-        static int pendingCalls;
+        static std::atomic<int> pendingCalls; // Calls may be started from any thread
     public:
         static int GetPendingCalls();
         static TSharedRef<IHttpRequest> SendRequest(TSharedPtr<UPlayFabAPISettings> settings, const FString& urlPath, const FString& callBody, const FString& authKey, const FString& authValue);
         static TSharedRef<IHttpRequest> SendFullUrlRequest(const FString& fullUrl, const FString& callBody, const FString& authKey, const FString& authValue);
+        static FPlayFabRequestHandle ProcessRequest(const TSharedRef<IHttpRequest>& HttpRequest, const FPlayFabCppRequestCommon& request);
+        static bool CancelRequest(const TSharedRef<IHttpRequest>& HttpRequest);
         static bool DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError);
+        // Same as above, but the data member RawField is cut out of the response text before parsing and handed back unparsed in OutRawValue
+        static bool DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError, const FString& RawField, PlayFab::FJsonKeeper& OutRawValue);
+        // For callers that read the body of a successful response themselves: only a failed response is parsed, into OutError
+        static bool DecodeStreamedRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppError& OutError);
         static bool DecodeError(TSharedPtr<FJsonObject> JsonObject, PlayFab::FPlayFabCppError& OutError);
+    private:
+        // Unset when the body is not a PlayFab reply at all
+        template <typename CharType>
+        static TOptional<bool> DecodeResponse(const TSharedRef<TJsonReader<CharType> >& JsonReader, FHttpResponsePtr HttpResponse, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError, uint64 TraceId);
+        static void SetTimeoutError(PlayFab::FPlayFabCppError& OutError);
     };
 };
@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/PlayFabAdminDataModels.h"
+#include "Core/PlayFabError.h"
+#include "Core/PlayFabRequestHandle.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+namespace PlayFab
+{
+    /**
+    * Dumps every player profile of a segment to a newline-delimited JSON file (one PlayerProfile object per line).
+    *
+    * Usage:
+    *     TSharedRef<PlayFabSegmentExporter> Exporter = MakeShared<PlayFabSegmentExporter>();
+    *     AdminModels::FGetPlayersInSegmentRequest request;
+    *     request.SegmentId = TEXT("...");
+    *     Exporter->Start(request, FPaths::ProjectSavedDir() / TEXT("Segment.ndjson"), OnComplete, OnError);
+    *
+    * Pages of Admin GetPlayersInSegment are fetched one after the other. Each page is copied to the file by a background
+    * task, token by token, without building the result models, while the next page is already being fetched.
+    * At most two pages are held in memory at any time, whatever the size of the segment.
+    * Delegates run on the game thread. Requires the Admin API (WITH_PLAYFAB_ADMIN_API) and a developer secret key.
+    */
+    class PLAYFABCPP_API PlayFabSegmentExporter : public TSharedFromThis<PlayFabSegmentExporter>
+    {
+    public:
+        struct FProgress
+        {
+            int32 PagesWritten = 0;
+            int32 ProfilesWritten = 0;
+            int32 ProfilesInSegment = 0; // As reported with the first page
+        };
+
+        DECLARE_DELEGATE_OneParam(FProgressDelegate, const FProgress&);
+
+        ~PlayFabSegmentExporter();
+
+        // Called after every page written to the file
+        FProgressDelegate OnProgress;
+
+        // request provides SegmentId, MaxBatchSize (profiles per page), SecondsToLive and AuthenticationContext. Its ContinuationToken is ignored.
+        // The file is overwritten. Returns false if an export is already running or the file cannot be opened.
+        bool Start(const AdminModels::FGetPlayersInSegmentRequest& request, const FString& FilePath, const FProgressDelegate& CompleteDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+
+        // Stops after the page being written. The error delegate runs with a cancellation error; the file keeps the pages written so far.
+        void Cancel();
+
+        bool IsRunning() const { return bRunning; }
+        FProgress GetProgress() const;
+
+    private:
+        void RequestPage(const FString& ContinuationToken);
+        void OnPageResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
+        void WritePage(FHttpResponsePtr HttpResponse);
+        void OnPageWritten(bool bWritten);
+        void Finish(const FPlayFabCppError* Error);
+        void FinishWithError(int32 HttpCode, PlayFabErrorCode ErrorCode, const FString& Message);
+
+        AdminModels::FGetPlayersInSegmentRequest Request;
+        FString Path;
+        FProgressDelegate CompleteDelegate;
+        FPlayFabErrorDelegate ErrorDelegate;
+
+        // Written by the page tasks, which run one at a time in page order
+        TUniquePtr<FArchive> File;
+        std::atomic<int32> PagesWritten{ 0 };
+        std::atomic<int32> ProfilesWritten{ 0 };
+        std::atomic<bool> bWriteFailed{ false };
+
+        // Game thread only
+        UE::Tasks::FTask LastWrite;
+        FPlayFabRequestHandle PageRequest;
+        FString NextContinuationToken;
+        int32 ProfilesInSegment = 0;
+        bool bRunning = false;
+        bool bFinishing = false;
+    };
+}
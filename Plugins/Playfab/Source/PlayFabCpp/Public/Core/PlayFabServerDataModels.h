@@ -85,12 +85,12 @@ namespace ServerModels
         int32 Amount;
 
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // PlayFab unique identifier of the user whose virtual currency balance is to be incremented.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Name of the virtual currency which is to be incremented.
         FString VirtualCurrency;
@@ -123,7 +123,7 @@ namespace ServerModels
         FString FriendEmail;
 
         // [optional] The PlayFab identifier of the user being added.
-        FString FriendPlayFabId;
+        FPlayFabId FriendPlayFabId;
 
         // [optional] Title-specific display name of the user to being added.
         FString FriendTitleDisplayName;
@@ -132,7 +132,7 @@ namespace ServerModels
         FString FriendUsername;
 
         // PlayFab identifier of the player to add a new friend.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FAddFriendRequest() :
             FPlayFabCppRequestCommon(),
@@ -189,7 +189,7 @@ namespace ServerModels
         FGenericServiceId GenericId;
 
         // PlayFabId of the user to link.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FAddGenericIDRequest() :
             FPlayFabCppRequestCommon(),
@@ -215,7 +215,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique tag for player profile.
         FString TagName;
@@ -315,7 +315,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // PlayFab unique identifier of the user whose virtual currency balance is to be increased.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Name of the virtual currency which is to be incremented.
         FString VirtualCurrency;
@@ -1080,7 +1080,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
     {
         // Unique ID of the entity.
-        FString Id;
+        FPlayFabId Id;
 
         // [optional] Entity type. See https://docs.microsoft.com/gaming/playfab/features/data/entities/available-built-in-entity-types
         FString Type;
@@ -1259,7 +1259,7 @@ namespace ServerModels
         // [optional] OpenID Connect information, if any OpenID Connect accounts have been linked
         TArray<FUserOpenIdInfo> OpenIdInfo;
         // [optional] Unique identifier for the user account
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Personal information for the user which is considered more sensitive
         TSharedPtr<FUserPrivateAccountInfo> PrivateInfo;
@@ -1358,7 +1358,7 @@ namespace ServerModels
         FString AchievementName;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Result of the award attempt (only valid on response, not on request).
         bool Result;
@@ -1445,7 +1445,7 @@ namespace ServerModels
         FString IPAddress;
 
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] The reason why this ban was applied.
         FString Reason;
@@ -1498,7 +1498,7 @@ namespace ServerModels
         FString IPAddress;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] The reason for this ban. Maximum 140 characters.
         FString Reason;
@@ -1822,7 +1822,7 @@ namespace ServerModels
         FString ItemId;
 
         // [optional] Unique item identifier for this specific instance of the item.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // [optional] Timestamp for when this instance was purchased.
         Boxed<FDateTime> PurchaseDate;
@@ -1874,7 +1874,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FCharacterInventory : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] The id of this character.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The inventory of this character.
         TArray<FItemInstance> Inventory;
@@ -1900,7 +1900,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FCharacterLeaderboardEntry : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] PlayFab unique identifier of the character that belongs to the user for this leaderboard entry.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] Title-specific display name of the character for this leaderboard entry.
         FString CharacterName;
@@ -1912,7 +1912,7 @@ namespace ServerModels
         FString DisplayName;
 
         // [optional] PlayFab unique identifier of the user for this leaderboard entry.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // User's overall position in the leaderboard.
         int32 Position;
@@ -1947,7 +1947,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FCharacterResult : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] The id for this character on this player.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The name of this character.
         FString CharacterName;
@@ -2001,7 +2001,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FConsumeItemRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Number of uses to consume from the item.
         int32 ConsumeCount;
@@ -2009,10 +2009,10 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique instance identifier of the item to be consumed.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FConsumeItemRequest() :
             FPlayFabCppRequestCommon(),
@@ -2039,7 +2039,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FConsumeItemResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique instance identifier of the item with uses consumed.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Number of uses remaining on the item.
         int32 RemainingUses;
@@ -2486,12 +2486,12 @@ namespace ServerModels
     struct PLAYFABCPP_API FDeleteCharacterFromUserRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * If true, the character's inventory will be transferred up to the owning user; otherwise, this request will purge those
@@ -2577,7 +2577,7 @@ namespace ServerModels
         Boxed<int32> ExpectedPropertiesVersion;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // A list of property names denoting which properties should be deleted.
         TArray<FString> PropertyNames;
@@ -2607,7 +2607,7 @@ namespace ServerModels
         // [optional] The list of properties requested to be deleted.
         TArray<FDeletedPropertyDetails> DeletedProperties;
         // [optional] PlayFab unique identifier of the user whose properties were deleted.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * Indicates the current version of a player's properties that have been set. This is incremented after updates and
@@ -2638,7 +2638,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FDeletePlayerRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FDeletePlayerRequest() :
             FPlayFabCppRequestCommon(),
@@ -3022,7 +3022,7 @@ namespace ServerModels
         Boxed<bool> GeneratePlayStreamEvent;
 
         // The unique user identifier for the player on whose behalf the script is being run
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] Option for which revision of the CloudScript to execute. 'Latest' executes the most recently created revision, 'Live'
@@ -3078,7 +3078,7 @@ namespace ServerModels
         FString FacebookInstantGamesId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Facebook Instant Games identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FFacebookInstantGamesPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -3105,7 +3105,7 @@ namespace ServerModels
         FString FacebookId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Facebook identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FFacebookPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -3560,7 +3560,7 @@ namespace ServerModels
         TSharedPtr<FUserFacebookInfo> FacebookInfo;
 
         // [optional] PlayFab unique identifier for this friend.
-        FString FriendPlayFabId;
+        FPlayFabId FriendPlayFabId;
 
         /**
          * [optional] Available Game Center information (if the user and connected Game Center friend both have PlayFab Accounts in the same
@@ -3624,7 +3624,7 @@ namespace ServerModels
         TSharedPtr<FGenericServiceId> GenericId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the given generic identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGenericPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -3765,7 +3765,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         /**
          * [optional] The version that currently exists according to the caller. The call will return the data for all of the keys if the
@@ -3776,7 +3776,7 @@ namespace ServerModels
         // [optional] Specific keys to search for in the custom user data.
         TArray<FString> Keys;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetCharacterDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -3846,7 +3846,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetCharacterDataResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] User specific data for this title.
         TMap<FString, FUserDataRecord> Data;
@@ -3857,7 +3857,7 @@ namespace ServerModels
         uint32 DataVersion;
 
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetCharacterDataResult() :
             FPlayFabCppResultCommon(),
@@ -3886,12 +3886,12 @@ namespace ServerModels
         FString CatalogVersion;
 
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetCharacterInventoryRequest() :
             FPlayFabCppRequestCommon(),
@@ -3952,12 +3952,12 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetCharacterInventoryResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique identifier of the character for this inventory.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] Array of inventory items belonging to the character.
         TArray<FItemInstance> Inventory;
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Array of virtual currency balance(s) belonging to the character.
         TMap<FString, int32> VirtualCurrency;
@@ -4041,10 +4041,10 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetCharacterStatisticsRequest() :
             FPlayFabCppRequestCommon(),
@@ -4068,12 +4068,12 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetCharacterStatisticsResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique identifier of the character for the statistics.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] Character statistics for the requested user.
         TMap<FString, int32> CharacterStatistics;
         // [optional] PlayFab unique identifier of the user whose character statistics are being returned.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetCharacterStatisticsResult() :
             FPlayFabCppResultCommon(),
@@ -4253,7 +4253,7 @@ namespace ServerModels
         int32 MaxResultsCount;
 
         // The player whose friend leaderboard to get
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] If non-null, this determines which properties of the resulting player profiles to return. For API calls from the client,
@@ -4315,7 +4315,7 @@ namespace ServerModels
         Boxed<ExternalFriendSources> ExternalPlatformFriends;
 
         // PlayFab identifier of the player whose friend list to get.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] If non-null, this determines which properties of the resulting player profiles to return. For API calls from the client,
@@ -4374,13 +4374,13 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetLeaderboardAroundCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Maximum number of entries to retrieve.
         int32 MaxResultsCount;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique identifier for the title-specific statistic for the leaderboard.
         FString StatisticName;
@@ -4436,7 +4436,7 @@ namespace ServerModels
         int32 MaxResultsCount;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] If non-null, this determines which properties of the resulting player profiles to return. For API calls from the client,
@@ -4484,7 +4484,7 @@ namespace ServerModels
         FString DisplayName;
 
         // [optional] PlayFab unique identifier of the user for this leaderboard entry.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // User's overall position in the leaderboard.
         int32 Position;
@@ -4550,7 +4550,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetLeaderboardForUsersCharactersRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique identifier for the title-specific statistic for the leaderboard.
         FString StatisticName;
@@ -4762,7 +4762,7 @@ namespace ServerModels
         FGetPlayerCombinedInfoRequestParams InfoRequestParameters;
 
         // PlayFabId of the user whose data will be returned
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayerCombinedInfoRequest() :
             FPlayFabCppRequestCommon(),
@@ -4886,7 +4886,7 @@ namespace ServerModels
         TSharedPtr<FGetPlayerCombinedInfoResultPayload> InfoResultPayload;
 
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayerCombinedInfoResult() :
             FPlayFabCppResultCommon(),
@@ -4910,7 +4910,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetPlayerCustomPropertyRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Specific property name to search for in the player's properties.
         FString PropertyName;
@@ -4937,7 +4937,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetPlayerCustomPropertyResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] PlayFab unique identifier of the user whose properties are being returned.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * Indicates the current version of a player's properties that have been set. This is incremented after updates and
@@ -4973,7 +4973,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * [optional] If non-null, this determines which properties of the resulting player profiles to return. For API calls from the client,
@@ -5372,7 +5372,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayersSegmentsRequest() :
             FPlayFabCppRequestCommon(),
@@ -5425,7 +5425,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // user for whom statistics are being requested
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] statistics to return
         TArray<FString> StatisticNames;
@@ -5458,7 +5458,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetPlayerStatisticsResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] PlayFab unique identifier of the user whose statistics are being returned
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] User statistics for the requested user.
         TArray<FStatisticValue> Statistics;
@@ -5580,7 +5580,7 @@ namespace ServerModels
         FString Namespace;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetPlayerTagsRequest() :
             FPlayFabCppRequestCommon(),
@@ -5605,7 +5605,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetPlayerTagsResult : public PlayFab::FPlayFabCppResultCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Canonical tags (including namespace and tag's name) for the requested user
         TArray<FString> Tags;
@@ -5803,7 +5803,7 @@ namespace ServerModels
          * [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Nintendo Switch Service Account
          * identifier.
          */
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FNintendoServiceAccountPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -5877,7 +5877,7 @@ namespace ServerModels
         FString NintendoSwitchDeviceId;
 
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Nintendo Switch Device identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FNintendoSwitchPlayFabIdPair() :
             FPlayFabCppBaseModel(),
@@ -5955,7 +5955,7 @@ namespace ServerModels
          * [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the PlayStation :tm: Network
          * identifier.
          */
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique PlayStation :tm: Network identifier for a user.
         FString PSNAccountId;
@@ -6036,7 +6036,7 @@ namespace ServerModels
          * [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the PlayStation :tm: Network
          * identifier.
          */
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique PlayStation :tm: Network identifier for a user.
         FString PSNOnlineId;
@@ -6110,7 +6110,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FSteamPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Steam identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique Steam identifier for a user.
         FString SteamStringId;
@@ -6184,7 +6184,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FSteamNamePlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Steam identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique Steam identifier for a user, also known as Steam persona name.
         FString SteamName;
@@ -6258,7 +6258,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FTwitchPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Twitch identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique Twitch identifier for a user.
         FString TwitchId;
@@ -6336,7 +6336,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FXboxLiveAccountPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Xbox Live identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique Xbox Live identifier for a user.
         FString XboxLiveAccountId;
@@ -6576,7 +6576,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FServerCustomIDPlayFabIDPair : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique server custom identifier for this player.
         FString ServerCustomId;
@@ -6850,7 +6850,7 @@ namespace ServerModels
          * [optional] Optional identifier for the player to use in requesting the store information - if used, segment overrides will be
          * applied
          */
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unqiue identifier for the store which is being requested
         FString StoreId;
@@ -7052,7 +7052,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetUserAccountInfoRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserAccountInfoRequest() :
             FPlayFabCppRequestCommon(),
@@ -7098,7 +7098,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGetUserBansRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserBansRequest() :
             FPlayFabCppRequestCommon(),
@@ -7151,7 +7151,7 @@ namespace ServerModels
         // [optional] Specific keys to search for in the custom user data.
         TArray<FString> Keys;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -7184,7 +7184,7 @@ namespace ServerModels
         uint32 DataVersion;
 
         // [optional] PlayFab unique identifier of the user whose custom data is being returned.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserDataResult() :
             FPlayFabCppResultCommon(),
@@ -7211,7 +7211,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGetUserInventoryRequest() :
             FPlayFabCppRequestCommon(),
@@ -7237,7 +7237,7 @@ namespace ServerModels
         // [optional] Array of inventory items belonging to the user.
         TArray<FItemInstance> Inventory;
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Array of virtual currency balance(s) belonging to the user.
         TMap<FString, int32> VirtualCurrency;
@@ -7275,7 +7275,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGrantCharacterToUserRequest() :
             FPlayFabCppRequestCommon(),
@@ -7301,7 +7301,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FGrantCharacterToUserResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique identifier tagged to this character.
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         FGrantCharacterToUserResult() :
             FPlayFabCppResultCommon(),
@@ -7338,7 +7338,7 @@ namespace ServerModels
         FString CatalogVersion;
 
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         /**
          * [optional] A set of custom key-value pairs on the instance of the inventory item, which is not to be confused with the catalog
@@ -7358,10 +7358,10 @@ namespace ServerModels
         FString ItemId;
 
         // [optional] Unique item identifier for this specific instance of the item.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // [optional] Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Timestamp for when this instance was purchased.
         Boxed<FDateTime> PurchaseDate;
@@ -7425,14 +7425,14 @@ namespace ServerModels
         FString CatalogVersion;
 
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // [optional] Array of itemIds to grant to the user.
         TArray<FString> ItemIds;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGrantItemsToCharacterRequest() :
             FPlayFabCppRequestCommon(),
@@ -7492,7 +7492,7 @@ namespace ServerModels
         // Array of itemIds to grant to the user.
         TArray<FString> ItemIds;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FGrantItemsToUserRequest() :
             FPlayFabCppRequestCommon(),
@@ -7544,7 +7544,7 @@ namespace ServerModels
         FString Annotation;
 
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         /**
          * [optional] Key-value pairs to be written to the custom data. Note that keys are trimmed of whitespace, are limited in size, and may
@@ -7560,7 +7560,7 @@ namespace ServerModels
          */
         TArray<FString> KeysToRemove;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FItemGrant() :
             FPlayFabCppBaseModel(),
@@ -7650,7 +7650,7 @@ namespace ServerModels
         FString IdentityToken;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FLinkNintendoServiceAccountRequest() :
             FPlayFabCppRequestCommon(),
@@ -7681,7 +7681,7 @@ namespace ServerModels
         Boxed<bool> ForceLink;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // The Nintendo Service Account subject or id to link to the PlayFab user.
         FString Subject;
@@ -7718,7 +7718,7 @@ namespace ServerModels
         FString NintendoSwitchDeviceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FLinkNintendoSwitchDeviceIdRequest() :
             FPlayFabCppRequestCommon(),
@@ -7774,7 +7774,7 @@ namespace ServerModels
         Boxed<int32> IssuerId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Redirect URI supplied to PlayStation :tm: Network when requesting an auth code
         FString RedirectUri;
@@ -7832,7 +7832,7 @@ namespace ServerModels
         Boxed<int32> IssuerId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Id of the PlayStation :tm: Network user. Also known as the PSN Account Id.
         FString PSNUserId;
@@ -7886,7 +7886,7 @@ namespace ServerModels
         Boxed<bool> ForceLink;
 
         // Unique PlayFab identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique server custom identifier for this player.
         FString ServerCustomId;
@@ -7939,7 +7939,7 @@ namespace ServerModels
         Boxed<bool> ForceLink;
 
         // Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Xbox Live identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique Steam identifier for a user.
         FString SteamId;
@@ -7992,7 +7992,7 @@ namespace ServerModels
         Boxed<bool> ForceLink;
 
         // Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Xbox Live identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Token provided by the Xbox Live SDK/XDK method GetTokenAndSignatureAsync("POST", "https://playfabapi.com/", "").
         FString XboxToken;
@@ -8040,7 +8040,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FListPlayerCustomPropertiesRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FListPlayerCustomPropertiesRequest() :
             FPlayFabCppRequestCommon(),
@@ -8063,7 +8063,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FListPlayerCustomPropertiesResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] PlayFab unique identifier of the user whose properties are being returned.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Player specific properties and their corresponding values for this title.
         TArray<FCustomPropertyDetails> Properties;
@@ -8096,7 +8096,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FListUsersCharactersRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FListUsersCharactersRequest() :
             FPlayFabCppRequestCommon(),
@@ -8383,10 +8383,10 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique instance identifier of the item to be modified.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // PlayFab unique identifier of the user whose item is being modified.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Number of uses to add to the item. Can be negative to remove uses.
         int32 UsesToAdd;
@@ -8415,7 +8415,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FModifyItemUsesResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] Unique instance identifier of the item with uses consumed.
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Number of uses remaining on the item.
         int32 RemainingUses;
@@ -8451,7 +8451,7 @@ namespace ServerModels
         int32 BalanceChange;
 
         // [optional] User currency was subtracted from.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Name of the virtual currency which was modified.
         FString VirtualCurrency;
@@ -8480,16 +8480,16 @@ namespace ServerModels
     struct PLAYFABCPP_API FMoveItemToCharacterFromCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique identifier of the character that currently has the item.
-        FString GivingCharacterId;
+        FPlayFabId GivingCharacterId;
 
         // Unique PlayFab assigned instance identifier of the item
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique identifier of the character that will be receiving the item.
-        FString ReceivingCharacterId;
+        FPlayFabId ReceivingCharacterId;
 
         FMoveItemToCharacterFromCharacterRequest() :
             FPlayFabCppRequestCommon(),
@@ -8534,13 +8534,13 @@ namespace ServerModels
     struct PLAYFABCPP_API FMoveItemToCharacterFromUserRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Unique PlayFab assigned instance identifier of the item
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FMoveItemToCharacterFromUserRequest() :
             FPlayFabCppRequestCommon(),
@@ -8584,13 +8584,13 @@ namespace ServerModels
     struct PLAYFABCPP_API FMoveItemToUserFromCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Unique PlayFab assigned instance identifier of the item
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FMoveItemToUserFromCharacterRequest() :
             FPlayFabCppRequestCommon(),
@@ -8680,7 +8680,7 @@ namespace ServerModels
         FString CatalogVersion;
 
         // [optional] Optional identifier for the Character that should receive the item. If null, item is added to the player
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Generated coupon code to redeem.
         FString CouponCode;
@@ -8688,7 +8688,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FRedeemCouponRequest() :
             FPlayFabCppRequestCommon(),
@@ -8737,10 +8737,10 @@ namespace ServerModels
     struct PLAYFABCPP_API FRemoveFriendRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // PlayFab identifier of the friend account which is to be removed.
-        FString FriendPlayFabId;
+        FPlayFabId FriendPlayFabId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FRemoveFriendRequest() :
             FPlayFabCppRequestCommon(),
@@ -8767,7 +8767,7 @@ namespace ServerModels
         FGenericServiceId GenericId;
 
         // PlayFabId of the user to remove.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FRemoveGenericIDRequest() :
             FPlayFabCppRequestCommon(),
@@ -8793,7 +8793,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique tag for player profile.
         FString TagName;
@@ -8942,7 +8942,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FRevokeAllBansForUserRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FRevokeAllBansForUserRequest() :
             FPlayFabCppRequestCommon(),
@@ -9031,13 +9031,13 @@ namespace ServerModels
     struct PLAYFABCPP_API FRevokeInventoryItem : public PlayFab::FPlayFabCppBaseModel
     {
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Unique PlayFab assigned instance identifier of the item
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FRevokeInventoryItem() :
             FPlayFabCppBaseModel(),
@@ -9062,13 +9062,13 @@ namespace ServerModels
     struct PLAYFABCPP_API FRevokeInventoryItemRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Unique PlayFab assigned instance identifier of the item
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FRevokeInventoryItemRequest() :
             FPlayFabCppRequestCommon(),
@@ -9302,7 +9302,7 @@ namespace ServerModels
         FString EmailTemplateId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FSendEmailFromTemplateRequest() :
             FPlayFabCppRequestCommon(),
@@ -9543,7 +9543,7 @@ namespace ServerModels
         bool NewlyCreated;
 
         // [optional] Player's unique PlayFabId.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] Unique token authorizing the user and game at the server level, for the current session.
         FString SessionTicket;
@@ -9582,10 +9582,10 @@ namespace ServerModels
     struct PLAYFABCPP_API FSetFriendTagsRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // PlayFab identifier of the friend account to which the tag(s) should be applied.
-        FString FriendPlayFabId;
+        FPlayFabId FriendPlayFabId;
 
         // PlayFab identifier of the player whose friend is to be updated.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Array of tags to set on the friend account.
         TArray<FString> Tags;
@@ -9615,7 +9615,7 @@ namespace ServerModels
         FString PlayerSecret;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FSetPlayerSecretRequest() :
             FPlayFabCppRequestCommon(),
@@ -9793,12 +9793,12 @@ namespace ServerModels
         int32 Amount;
 
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Name of the virtual currency which is to be decremented.
         FString VirtualCurrency;
@@ -9833,7 +9833,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // PlayFab unique identifier of the user whose virtual currency balance is to be decreased.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Name of the virtual currency which is to be decremented.
         FString VirtualCurrency;
@@ -9864,7 +9864,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUnlinkNintendoServiceAccountRequest() :
             FPlayFabCppRequestCommon(),
@@ -9893,7 +9893,7 @@ namespace ServerModels
         FString NintendoSwitchDeviceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUnlinkNintendoSwitchDeviceIdRequest() :
             FPlayFabCppRequestCommon(),
@@ -9939,7 +9939,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUnlinkPSNAccountRequest() :
             FPlayFabCppRequestCommon(),
@@ -9984,7 +9984,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Unique server custom identifier for this player.
         FString ServerCustomId;
@@ -10033,7 +10033,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Steam account.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUnlinkSteamIdRequest() :
             FPlayFabCppRequestCommon(),
@@ -10078,7 +10078,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab identifier for a user, or null if no PlayFab account is linked to the Xbox Live identifier.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUnlinkXboxAccountRequest() :
             FPlayFabCppRequestCommon(),
@@ -10127,10 +10127,10 @@ namespace ServerModels
         FString CatalogVersion;
 
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // ItemInstanceId of the container to unlock.
-        FString ContainerItemInstanceId;
+        FPlayFabId ContainerItemInstanceId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
@@ -10138,10 +10138,10 @@ namespace ServerModels
          * [optional] ItemInstanceId of the key that will be consumed by unlocking this container. If the container requires a key, this
          * parameter is required.
          */
-        FString KeyItemInstanceId;
+        FPlayFabId KeyItemInstanceId;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUnlockContainerInstanceRequest() :
             FPlayFabCppRequestCommon(),
@@ -10175,7 +10175,7 @@ namespace ServerModels
         FString CatalogVersion;
 
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // Catalog ItemId of the container type to unlock.
         FString ContainerItemId;
@@ -10183,7 +10183,7 @@ namespace ServerModels
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUnlockContainerItemRequest() :
             FPlayFabCppRequestCommon(),
@@ -10212,10 +10212,10 @@ namespace ServerModels
         // [optional] Items granted to the player as a result of unlocking the container.
         TArray<FItemInstance> GrantedItems;
         // [optional] Unique instance identifier of the container unlocked.
-        FString UnlockedItemInstanceId;
+        FPlayFabId UnlockedItemInstanceId;
 
         // [optional] Unique instance identifier of the key used to unlock the container, if applicable.
-        FString UnlockedWithItemInstanceId;
+        FPlayFabId UnlockedWithItemInstanceId;
 
         // [optional] Virtual currency granted to the player as a result of unlocking the container.
         TMap<FString, uint32> VirtualCurrency;
@@ -10246,7 +10246,7 @@ namespace ServerModels
         FString ImageUrl;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUpdateAvatarUrlRequest() :
             FPlayFabCppRequestCommon(),
@@ -10361,7 +10361,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FUpdateCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
@@ -10379,7 +10379,7 @@ namespace ServerModels
         Boxed<UserDataPermission> Permission;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUpdateCharacterDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -10433,14 +10433,14 @@ namespace ServerModels
     struct PLAYFABCPP_API FUpdateCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] Statistics to be updated with the provided values.
         TMap<FString, int32> CharacterStatistics;
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUpdateCharacterStatisticsRequest() :
             FPlayFabCppRequestCommon(),
@@ -10520,7 +10520,7 @@ namespace ServerModels
         Boxed<int32> ExpectedPropertiesVersion;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Collection of properties to be set for a player.
         TArray<FUpdateProperty> Properties;
@@ -10548,7 +10548,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FUpdatePlayerCustomPropertiesResult : public PlayFab::FPlayFabCppResultCommon
     {
         // [optional] PlayFab unique identifier of the user whose properties were updated.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         /**
          * Indicates the current version of a player's properties that have been set. This is incremented after updates and
@@ -10586,7 +10586,7 @@ namespace ServerModels
         Boxed<bool> ForceUpdate;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // Statistics to be updated with the provided values
         TArray<FStatisticUpdate> Statistics;
@@ -10709,7 +10709,7 @@ namespace ServerModels
         Boxed<UserDataPermission> Permission;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUpdateUserDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -10774,7 +10774,7 @@ namespace ServerModels
          */
         TArray<FString> KeysToRemove;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUpdateUserInternalDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -10800,7 +10800,7 @@ namespace ServerModels
     struct PLAYFABCPP_API FUpdateUserInventoryItemDataRequest : public PlayFab::FPlayFabCppRequestCommon
     {
         // [optional] Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
@@ -10810,7 +10810,7 @@ namespace ServerModels
          */
         TMap<FString, FString> Data;
         // Unique PlayFab assigned instance identifier of the item
-        FString ItemInstanceId;
+        FPlayFabId ItemInstanceId;
 
         /**
          * [optional] Optional list of Data-keys to remove from UserData. Some SDKs cannot insert null-values into Data due to language
@@ -10818,7 +10818,7 @@ namespace ServerModels
          */
         TArray<FString> KeysToRemove;
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         FUpdateUserInventoryItemDataRequest() :
             FPlayFabCppRequestCommon(),
@@ -10874,7 +10874,7 @@ namespace ServerModels
         // [optional] Custom event properties. Each property consists of a name (string) and a value (JSON object).
         TMap<FString, FJsonKeeper> Body;
         // Unique PlayFab assigned ID for a specific character owned by a user
-        FString CharacterId;
+        FPlayFabId CharacterId;
 
         // [optional] The optional custom tags associated with the request (e.g. build number, external trace identifiers, etc.).
         TMap<FString, FString> CustomTags;
@@ -10885,7 +10885,7 @@ namespace ServerModels
         FString EventName;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] The time (in UTC) associated with this event. The value defaults to the current time.
         Boxed<FDateTime> Timestamp;
@@ -10926,7 +10926,7 @@ namespace ServerModels
         FString EventName;
 
         // Unique PlayFab assigned ID of the user on whom the operation will be performed.
-        FString PlayFabId;
+        FPlayFabId PlayFabId;
 
         // [optional] The time (in UTC) associated with this event. The value defaults to the current time.
         Boxed<FDateTime> Timestamp;
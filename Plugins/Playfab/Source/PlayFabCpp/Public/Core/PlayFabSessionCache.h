@@ -0,0 +1,130 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlayFab.h"
+#include "Core/PlayFabClientAPI.h"
+#include "Core/PlayFabClientDataModels.h"
+#include "Core/PlayFabRequestHandle.h"
+
+namespace PlayFab
+{
+    /**
+    * Local cache of the player data returned with the login (GetPlayerCombinedInfo payload).
+    *
+    * Usage:
+    *     TSharedRef<PlayFabSessionCache> Session = MakeShared<PlayFabSessionCache>();
+    *     Session->PrepareLogin(request, SuccessDelegate);      // any Client login request/delegate pair
+    *     ClientAPI->LoginWithCustomID(request, SuccessDelegate, ErrorDelegate);
+    *     ...
+    *     Session->GetTitleData(titleRequest, OnTitleData);      // served locally when the login payload covers it
+    *
+    * Reads that the cache can answer complete synchronously, inside the call. Everything else goes to the Client API,
+    * and the answer is stored for the next read. Call Invalidate after writing data that is cached.
+    * Requests carrying the authentication context of another player always go to the Client API, and a login that did not
+    * go through PrepareLogin empties the cache on the next read.
+    */
+    class PLAYFABCPP_API PlayFabSessionCache : public TSharedFromThis<PlayFabSessionCache>
+    {
+    public:
+        enum class EPart : uint8
+        {
+            TitleData,
+            UserData,
+            UserReadOnlyData,
+            PlayerStatistics,
+            UserInventory,
+
+            Count
+        };
+
+        explicit PlayFabSessionCache(PlayFabClientPtr InClientAPI = nullptr);
+
+        // Parts requested with every login. Defaults to all cacheable parts, with every key.
+        ClientModels::FGetPlayerCombinedInfoRequestParams InfoRequestParameters;
+
+        // Attaches InfoRequestParameters to a Client login request and wraps its success delegate so the payload is cached before it runs
+        template <typename LoginRequestType, typename LoginDelegateType>
+        void PrepareLogin(LoginRequestType& request, LoginDelegateType& SuccessDelegate)
+        {
+            request.InfoRequestParameters = MakeShareable(new ClientModels::FGetPlayerCombinedInfoRequestParams(InfoRequestParameters));
+            SuccessDelegate = LoginDelegateType::CreateSP(this, &PlayFabSessionCache::OnLoginResult<LoginDelegateType>, SuccessDelegate);
+        }
+
+        // Replaces the cache content with a combined info payload
+        void Store(const ClientModels::FGetPlayerCombinedInfoResultPayload& Payload, const ClientModels::FGetPlayerCombinedInfoRequestParams& RequestParams, const FPlayFabId& PlayFabId);
+
+        bool IsCached(EPart Part) const;
+        void Invalidate(EPart Part);
+        void InvalidateAll();
+
+        // Same contract as the UPlayFabClientAPI functions of the same name
+        FPlayFabRequestHandle GetTitleData(ClientModels::FGetTitleDataRequest& request, const UPlayFabClientAPI::FGetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetUserData(ClientModels::FGetUserDataRequest& request, const UPlayFabClientAPI::FGetUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetUserReadOnlyData(ClientModels::FGetUserDataRequest& request, const UPlayFabClientAPI::FGetUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetPlayerStatistics(ClientModels::FGetPlayerStatisticsRequest& request, const UPlayFabClientAPI::FGetPlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        FPlayFabRequestHandle GetUserInventory(ClientModels::FGetUserInventoryRequest& request, const UPlayFabClientAPI::FGetUserInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+
+        // Number of reads answered locally / forwarded to PlayFab since the last login
+        int32 GetHitCount() const { return Hits; }
+        int32 GetMissCount() const { return Misses; }
+
+    private:
+        // A keyed map part: either every key is known, or only the listed ones are
+        template <typename ValueType>
+        struct FKeyedPart
+        {
+            TMap<FString, ValueType> Values;
+            TSet<FString> KnownKeys;
+            bool bAllKeys = false;
+
+            void Reset() { Values.Reset(); KnownKeys.Reset(); bAllKeys = false; }
+            void Assign(const TMap<FString, ValueType>& InValues, const TArray<FString>& RequestedKeys);
+            void Merge(const TMap<FString, ValueType>& InValues, const TArray<FString>& RequestedKeys);
+            bool TryGet(const TArray<FString>& Keys, TMap<FString, ValueType>& OutValues) const;
+        };
+
+        template <typename LoginDelegateType>
+        void OnLoginResult(const ClientModels::FLoginResult& result, LoginDelegateType SuccessDelegate)
+        {
+            if (result.InfoResultPayload.IsValid())
+            {
+                Store(*result.InfoResultPayload, InfoRequestParameters, result.PlayFabId);
+            }
+            SuccessDelegate.ExecuteIfBound(result);
+        }
+
+        void OnTitleDataResult(const ClientModels::FGetTitleDataResult& result, UPlayFabClientAPI::FGetTitleDataDelegate SuccessDelegate, TArray<FString> Keys);
+        void OnUserDataResult(const ClientModels::FGetUserDataResult& result, UPlayFabClientAPI::FGetUserDataDelegate SuccessDelegate, TArray<FString> Keys);
+        void OnUserReadOnlyDataResult(const ClientModels::FGetUserDataResult& result, UPlayFabClientAPI::FGetUserReadOnlyDataDelegate SuccessDelegate, TArray<FString> Keys);
+        void OnPlayerStatisticsResult(const ClientModels::FGetPlayerStatisticsResult& result, UPlayFabClientAPI::FGetPlayerStatisticsDelegate SuccessDelegate, TArray<FString> StatisticNames);
+        void OnUserInventoryResult(const ClientModels::FGetUserInventoryResult& result, UPlayFabClientAPI::FGetUserInventoryDelegate SuccessDelegate);
+
+        // Whether a request reads the cached player: no other PlayFabId, and no authentication context of another player
+        bool IsOwnPlayer(const FPlayFabId& RequestedPlayFabId, const TSharedPtr<UPlayFabAuthenticationContext>& AuthenticationContext) const;
+        // Drops the cache when another login replaced the one it was filled by
+        void CheckSession();
+        PlayFabClientPtr GetClientAPI() const;
+
+        PlayFabClientPtr ClientAPI;
+        FPlayFabId PlayFabId;
+        // The client session ticket of the login the cache was filled by
+        FString SessionTicket;
+        bool bCached[(int32)EPart::Count] = {};
+
+        FKeyedPart<FString> TitleData;
+        FKeyedPart<ClientModels::FUserDataRecord> UserData;
+        uint32 UserDataVersion = 0;
+        FKeyedPart<ClientModels::FUserDataRecord> UserReadOnlyData;
+        uint32 UserReadOnlyDataVersion = 0;
+        FKeyedPart<ClientModels::FStatisticValue> PlayerStatistics;
+        ClientModels::FGetUserInventoryResult UserInventory;
+
+        int32 Hits = 0;
+        int32 Misses = 0;
+    };
+}
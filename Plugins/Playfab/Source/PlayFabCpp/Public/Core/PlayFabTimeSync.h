@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlayFab.h"
+#include "Containers/Ticker.h"
+#include "Core/PlayFabClientDataModels.h"
+#include "Core/PlayFabError.h"
+#include "Misc/DateTime.h"
+#include <atomic>
+
+namespace PlayFab
+{
+    /**
+    * Estimate of the PlayFab server clock, kept by sampling Client GetTime in the background.
+    *
+    * Usage:
+    *     PlayFabTimeSync::Get().Start();                    // after login; GetTime needs a session
+    *     const FDateTime Now = PlayFabTimeSync::Get().GetServerTime();      // no network call, any thread
+    *
+    * Each sample is placed at the midpoint of its round trip, the way NTP does. The offset comes from the sample with the shortest
+    * round trip among the recent ones, because its midpoint assumption has the smallest possible error (half the round trip).
+    * Samples whose round trip is far above the median of the recent round trips are dropped. The drift of the local clock is fitted over the accepted samples.
+    * Corrections are slewed in rather than stepped, and GetServerTime never goes backwards, so timestamps taken one after the other
+    * (e.g. race times submitted with leaderboard entries) stay ordered. Until the first sample the local UTC clock is returned, and that
+    * first sample may move the estimate back once.
+    */
+    class PLAYFABCPP_API PlayFabTimeSync
+    {
+    public:
+        struct FStats
+        {
+            int32 Samples = 0;          // Accepted since Start
+            int32 Rejected = 0;         // Failed calls and outliers
+            double OffsetMs = 0.0;      // Server clock minus local UTC clock
+            double RoundTripMs = 0.0;   // Of the sample the offset comes from
+            double AccuracyMs = 0.0;    // Worst case error of the estimate right now
+            double DriftPpm = 0.0;      // Rate of the local clock against the server, parts per million
+            double LastSampleAgeSeconds = 0.0;
+        };
+
+        static PlayFabTimeSync& Get();
+
+        // Samples right away, then every IntervalSeconds. Game thread.
+        void Start(float IntervalSeconds = 60.0f, PlayFabClientPtr InClientAPI = nullptr);
+        void Stop();
+        // Takes one sample now, e.g. after a hitch or a resume from suspend. Game thread.
+        void SampleNow();
+
+        bool IsSynced() const;
+        FDateTime GetServerTime() const;
+        // Seconds since the Unix epoch, with sub-millisecond resolution
+        double GetServerUnixTime() const;
+        FStats GetStats() const;
+
+    private:
+        struct FSample
+        {
+            double LocalSeconds = 0.0;  // Monotonic clock at the midpoint of the round trip
+            double ServerSeconds = 0.0; // Unix seconds reported by the server
+            double RoundTrip = 0.0;
+        };
+
+        PlayFabTimeSync();
+
+        bool OnTick(float DeltaTime);
+        void OnGetTime(const ClientModels::FGetTimeResult& result, double SentAt);
+        void OnGetTimeError(const FPlayFabCppError& error);
+        void UpdateEstimate(double Now);
+        double EstimateServerSeconds(double Now) const;
+
+        // Game thread only
+        PlayFabClientPtr ClientAPI;
+        FTSTicker::FDelegateHandle TickerHandle;
+        float Interval = 60.0f;
+        double NextSampleAt = 0.0;
+        bool bSampleInFlight = false;
+        TArray<FSample> Recent;
+        // Round trips of the recent samples, rejected ones included, for the outlier check
+        TArray<double> RecentRoundTrips;
+
+        // Read from any thread, guarded by Lock
+        mutable FRWLock Lock;
+        bool bSynced = false;
+        double BaseLocal = 0.0;     // Estimate: Server = BaseServer + (Local - BaseLocal) * (1 + Drift)
+        double BaseServer = 0.0;
+        double Drift = 0.0;
+        double SlewFrom = 0.0;      // Correction still being slewed in, in seconds, starting at SlewStart
+        double SlewStart = 0.0;
+        double SlewDuration = 0.0;
+        double BestRoundTrip = 0.0;
+        double LastSampleLocal = 0.0;
+        int32 Accepted = 0;
+        int32 Rejected = 0;
+
+        // Last value handed out, in Unix microseconds, so readers on any thread never see time go backwards
+        mutable std::atomic<int64> LastReturnedMicros{ 0 };
+    };
+}